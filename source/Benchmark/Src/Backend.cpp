@@ -0,0 +1,256 @@
+#include "Backend.hpp"
+
+#include <Command/CommandBuffer.hpp>
+#include <Command/CommandPool.hpp>
+#include <Command/Queue.hpp>
+#include <Core/Connection.hpp>
+#include <Core/PlatformWindowHandle.hpp>
+#include <Core/Renderer.hpp>
+#include <Descriptor/DescriptorSet.hpp>
+#include <Descriptor/DescriptorSetLayout.hpp>
+#include <Descriptor/DescriptorSetLayoutBinding.hpp>
+#include <Descriptor/DescriptorSetPool.hpp>
+#include <Image/Texture.hpp>
+#include <Image/TextureView.hpp>
+#include <Pipeline/InputAssemblyState.hpp>
+#include <Pipeline/MultisampleState.hpp>
+#include <Pipeline/Pipeline.hpp>
+#include <Pipeline/PipelineLayout.hpp>
+#include <Pipeline/VertexLayout.hpp>
+#include <RenderPass/FrameBuffer.hpp>
+#include <RenderPass/RenderPass.hpp>
+#include <RenderPass/RenderSubpass.hpp>
+#include <RenderPass/RenderSubpassState.hpp>
+#include <Shader/ShaderModule.hpp>
+#include <Sync/Fence.hpp>
+
+#include <regex>
+
+namespace bench
+{
+	namespace
+	{
+		std::string const VertexShader = R"(layout( location = 0 ) in vec4 position;
+
+layout( set = 0, binding = 0 ) uniform Matrix
+{
+	mat4 mtxProjection;
+};
+
+void main()
+{
+	gl_Position = mtxProjection * position;
+}
+)";
+
+		std::string const FragmentShader = R"(layout( location = 0 ) out vec4 pxl_colour;
+
+void main()
+{
+	pxl_colour = vec4( 1.0, 1.0, 1.0, 1.0 );
+}
+)";
+	}
+
+	Backend::Backend( common::RendererFactory & factory
+		, std::string const & name )
+		: m_name{ name }
+	{
+		renderer::Renderer::Configuration config
+		{
+			"RendererBenchmark",
+			"RendererLib",
+			false,
+		};
+		m_renderer = factory.create( m_name, config );
+		m_device = m_renderer->createDevice( m_renderer->createConnection( 0u
+			, renderer::WindowHandle{} ) );
+		m_device->enable();
+
+		// Recording the same command buffer again needs it to be individually resettable.
+		commandPool = m_device->createCommandPool( m_device->getGraphicsQueue().getFamilyIndex()
+			, renderer::CommandPoolCreateFlag::eResetCommandBuffer );
+		commandBuffer = commandPool->createCommandBuffer();
+		uploadCommandBuffer = commandPool->createCommandBuffer();
+		fence = m_device->createFence();
+		stagingBuffer = std::make_unique< renderer::StagingBuffer >( *m_device
+			, 0u
+			, MaxUploadSize );
+
+		doCreateRenderPass();
+		doCreateDescriptorSet();
+		doCreatePipeline();
+		doCreateBuffers();
+	}
+
+	Backend::~Backend()
+	{
+		m_device->waitIdle();
+
+		dstBuffer.reset();
+		srcBuffer.reset();
+		vertexBuffer.reset();
+		vertexLayout.reset();
+		pipeline.reset();
+		pipelineLayout.reset();
+		descriptorSet.reset();
+		descriptorPool.reset();
+		descriptorLayout.reset();
+		uploadUbo.reset();
+		matrixUbo.reset();
+		frameBuffer.reset();
+		renderPass.reset();
+		targetView.reset();
+		target.reset();
+		stagingBuffer.reset();
+		fence.reset();
+		uploadCommandBuffer.reset();
+		commandBuffer.reset();
+		commandPool.reset();
+
+		m_device->disable();
+		m_device.reset();
+		m_renderer.reset();
+	}
+
+	std::string Backend::doLoadShader( std::string const & source )const
+	{
+		if ( m_name == "vk" )
+		{
+			return R"(#version 450
+#extension GL_KHR_vulkan_glsl : enable
+
+)" + source;
+		}
+
+		if ( m_name == "gl" )
+		{
+			std::regex regex{ R"(set[ ]*=[ ]*\d*, )" };
+			return R"(#version 420
+#extension GL_ARB_explicit_attrib_location : enable
+#extension GL_ARB_explicit_uniform_location : enable
+
+)" + std::regex_replace( source, regex, "" );
+		}
+
+		return source;
+	}
+
+	void Backend::doCreateRenderPass()
+	{
+		renderer::RenderPassAttachmentArray attaches
+		{
+			{
+				0u,
+				renderer::PixelFormat::eR8G8B8A8,
+				renderer::SampleCountFlag::e1,
+				renderer::AttachmentLoadOp::eClear,
+				renderer::AttachmentStoreOp::eStore,
+				renderer::AttachmentLoadOp::eDontCare,
+				renderer::AttachmentStoreOp::eDontCare,
+				renderer::ImageLayout::eUndefined,
+				renderer::ImageLayout::eColourAttachmentOptimal,
+			}
+		};
+		renderer::RenderSubpassAttachmentArray subAttaches
+		{
+			{ 0u, renderer::ImageLayout::eColourAttachmentOptimal }
+		};
+		renderer::RenderSubpassPtrArray subpasses;
+		subpasses.emplace_back( m_device->createRenderSubpass( renderer::PipelineBindPoint::eGraphics
+			, renderer::RenderSubpassState{ renderer::PipelineStageFlag::eColourAttachmentOutput
+				, renderer::AccessFlag::eColourAttachmentWrite }
+			, subAttaches ) );
+		renderPass = m_device->createRenderPass( attaches
+			, std::move( subpasses )
+			, renderer::RenderSubpassState{ renderer::PipelineStageFlag::eColourAttachmentOutput
+				, renderer::AccessFlag::eColourAttachmentWrite }
+			, renderer::RenderSubpassState{ renderer::PipelineStageFlag::eColourAttachmentOutput
+				, renderer::AccessFlag::eColourAttachmentWrite } );
+
+		target = m_device->createTexture();
+		target->setImage( renderer::PixelFormat::eR8G8B8A8
+			, { TargetSize, TargetSize }
+			, renderer::ImageUsageFlag::eColourAttachment );
+		targetView = target->createView( target->getType()
+			, target->getFormat() );
+		renderer::FrameBufferAttachmentArray fbAttaches;
+		fbAttaches.emplace_back( *( renderPass->begin() + 0u ), *targetView );
+		frameBuffer = renderPass->createFrameBuffer( { TargetSize, TargetSize }
+			, std::move( fbAttaches ) );
+	}
+
+	void Backend::doCreateDescriptorSet()
+	{
+		matrixUbo = std::make_unique< renderer::UniformBuffer< renderer::Mat4 > >( *m_device
+			, 1u
+			, renderer::BufferTarget::eTransferDst
+			, renderer::MemoryPropertyFlag::eHostVisible );
+		matrixUbo->upload();
+		std::vector< renderer::DescriptorSetLayoutBinding > bindings
+		{
+			renderer::DescriptorSetLayoutBinding{ 0u, renderer::DescriptorType::eUniformBuffer, renderer::ShaderStageFlag::eVertex },
+		};
+		descriptorLayout = m_device->createDescriptorSetLayout( std::move( bindings ) );
+		descriptorPool = descriptorLayout->createPool( 1u );
+		descriptorSet = descriptorPool->createDescriptorSet();
+		descriptorSet->createBinding( descriptorLayout->getBinding( 0u )
+			, *matrixUbo
+			, 0u
+			, 1u );
+		descriptorSet->update();
+	}
+
+	void Backend::doCreatePipeline()
+	{
+		vertexLayout = renderer::makeLayout< renderer::Vec4 >( 0u );
+		vertexLayout->createAttribute< renderer::Vec4 >( 0u, 0u );
+		pipelineLayout = m_device->createPipelineLayout( *descriptorLayout );
+
+		std::vector< renderer::ShaderStageState > shaderStages;
+		shaderStages.emplace_back( m_device->createShaderModule( renderer::ShaderStageFlag::eVertex ) );
+		shaderStages.emplace_back( m_device->createShaderModule( renderer::ShaderStageFlag::eFragment ) );
+		shaderStages[0].getModule().loadShader( doLoadShader( VertexShader ) );
+		shaderStages[1].getModule().loadShader( doLoadShader( FragmentShader ) );
+
+		pipeline = pipelineLayout->createPipeline( renderer::GraphicsPipelineCreateInfo
+		{
+			std::move( shaderStages ),
+			*renderPass,
+			renderer::VertexInputState::create( *vertexLayout ),
+			renderer::InputAssemblyState{ renderer::PrimitiveTopology::eTriangleList },
+			renderer::RasterisationState{ 1.0f }
+		} );
+	}
+
+	void Backend::doCreateBuffers()
+	{
+		std::vector< renderer::Vec4 > vertexData
+		{
+			{ -1.0f, -1.0f, 0.0f, 1.0f },
+			{ +1.0f, -1.0f, 0.0f, 1.0f },
+			{ 0.0f, +1.0f, 0.0f, 1.0f },
+		};
+		vertexBuffer = renderer::makeVertexBuffer< renderer::Vec4 >( *m_device
+			, uint32_t( vertexData.size() )
+			, renderer::BufferTarget::eTransferDst
+			, renderer::MemoryPropertyFlag::eDeviceLocal );
+		stagingBuffer->uploadVertexData( *uploadCommandBuffer
+			, vertexData
+			, *vertexBuffer
+			, renderer::PipelineStageFlag::eVertexInput );
+
+		uploadUbo = std::make_unique< renderer::UniformBuffer< renderer::Mat4 > >( *m_device
+			, UniformCount
+			, renderer::BufferTarget::eTransferDst
+			, renderer::MemoryPropertyFlag::eHostVisible );
+		srcBuffer = renderer::makeBuffer< uint8_t >( *m_device
+			, MaxUploadSize
+			, renderer::BufferTarget::eTransferSrc
+			, renderer::MemoryPropertyFlag::eDeviceLocal );
+		dstBuffer = renderer::makeBuffer< uint8_t >( *m_device
+			, MaxUploadSize
+			, renderer::BufferTarget::eTransferDst
+			, renderer::MemoryPropertyFlag::eDeviceLocal );
+	}
+}
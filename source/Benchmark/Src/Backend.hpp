@@ -0,0 +1,123 @@
+/*
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "RendererPlugin.hpp"
+
+#include <Buffer/Buffer.hpp>
+#include <Buffer/StagingBuffer.hpp>
+#include <Buffer/UniformBuffer.hpp>
+#include <Buffer/VertexBuffer.hpp>
+#include <Core/Device.hpp>
+
+namespace bench
+{
+	/**
+	*\~english
+	*\brief
+	*	A renderer, with a headless device and the resources the benchmarks record commands with.
+	*\remarks
+	*	The device stays enabled during the benchmark's whole life, for the OpenGL context to stay current.
+	*\~french
+	*\brief
+	*	Un renderer, avec un périphérique sans fenêtre et les ressources avec lesquelles les benchmarks enregistrent des commandes.
+	*\remarks
+	*	Le périphérique reste activé pendant toute la vie du benchmark, pour que le contexte OpenGL reste courant.
+	*/
+	class Backend
+	{
+	public:
+		//! The render target dimensions.
+		static uint32_t constexpr TargetSize = 256u;
+		//! The maximum size of a StagingBuffer upload.
+		static uint32_t constexpr MaxUploadSize = 8u * 1024u * 1024u;
+		//! The UniformBuffer elements count.
+		static uint32_t constexpr UniformCount = 256u;
+
+	public:
+		/**
+		*\~english
+		*\brief
+		*	Creates the renderer, its device and the resources.
+		*\param[in] factory
+		*	The factory holding the loaded plugins.
+		*\param[in] name
+		*	The renderer name (gl, vk, null).
+		*\~french
+		*\brief
+		*	Crée le renderer, son périphérique et les ressources.
+		*\param[in] factory
+		*	La fabrique contenant les plugins chargés.
+		*\param[in] name
+		*	Le nom du renderer (gl, vk, null).
+		*/
+		Backend( common::RendererFactory & factory
+			, std::string const & name );
+		~Backend();
+
+		std::string const & getName()const
+		{
+			return m_name;
+		}
+
+		renderer::Device const & getDevice()const
+		{
+			return *m_device;
+		}
+
+	private:
+		std::string doLoadShader( std::string const & source )const;
+		void doCreateRenderPass();
+		void doCreateDescriptorSet();
+		void doCreatePipeline();
+		void doCreateBuffers();
+
+	private:
+		std::string m_name;
+		renderer::RendererPtr m_renderer;
+		renderer::DevicePtr m_device;
+
+	public:
+		renderer::CommandPoolPtr commandPool;
+		renderer::CommandBufferPtr commandBuffer;
+		renderer::CommandBufferPtr uploadCommandBuffer;
+		renderer::FencePtr fence;
+		renderer::StagingBufferPtr stagingBuffer;
+		renderer::TexturePtr target;
+		renderer::TextureViewPtr targetView;
+		renderer::RenderPassPtr renderPass;
+		renderer::FrameBufferPtr frameBuffer;
+		renderer::UniformBufferPtr< renderer::Mat4 > matrixUbo;
+		renderer::UniformBufferPtr< renderer::Mat4 > uploadUbo;
+		renderer::DescriptorSetLayoutPtr descriptorLayout;
+		renderer::DescriptorSetPoolPtr descriptorPool;
+		renderer::DescriptorSetPtr descriptorSet;
+		renderer::PipelineLayoutPtr pipelineLayout;
+		renderer::PipelinePtr pipeline;
+		renderer::VertexLayoutPtr vertexLayout;
+		renderer::VertexBufferPtr< renderer::Vec4 > vertexBuffer;
+		renderer::BufferPtr< uint8_t > srcBuffer;
+		renderer::BufferPtr< uint8_t > dstBuffer;
+	};
+
+	using BackendPtr = std::unique_ptr< Backend >;
+	/**
+	*\~english
+	*\brief
+	*	Registers the CommandBuffer benchmarks of a backend: recording per command type, and submission.
+	*\~french
+	*\brief
+	*	Enregistre les benchmarks de CommandBuffer d'un backend : enregistrement par type de commande, et soumission.
+	*/
+	void registerCommandBufferBenchmarks( Backend & backend );
+	/**
+	*\~english
+	*\brief
+	*	Registers the buffers upload benchmarks of a backend.
+	*\~french
+	*\brief
+	*	Enregistre les benchmarks de mise à jour de tampons d'un backend.
+	*/
+	void registerBufferBenchmarks( Backend & backend );
+}
@@ -0,0 +1,55 @@
+#include "Backend.hpp"
+
+#include <benchmark/benchmark.h>
+
+namespace bench
+{
+	namespace
+	{
+		void doBenchmarkUniformUpload( benchmark::State & state
+			, Backend & backend )
+		{
+			auto count = uint32_t( state.range( 0 ) );
+			auto & ubo = *backend.uploadUbo;
+
+			for ( auto _ : state )
+			{
+				ubo.upload( 0u, count );
+			}
+
+			state.SetBytesProcessed( int64_t( state.iterations() ) * count * int64_t( sizeof( renderer::Mat4 ) ) );
+		}
+
+		void doBenchmarkStagingUpload( benchmark::State & state
+			, Backend & backend )
+		{
+			auto size = uint32_t( state.range( 0 ) );
+			renderer::ByteArray data( size, uint8_t( 0xA5 ) );
+
+			for ( auto _ : state )
+			{
+				backend.stagingBuffer->uploadBufferData( *backend.uploadCommandBuffer
+					, data.data()
+					, size
+					, *backend.dstBuffer );
+			}
+
+			state.SetBytesProcessed( int64_t( state.iterations() ) * size );
+		}
+	}
+
+	void registerBufferBenchmarks( Backend & backend )
+	{
+		benchmark::RegisterBenchmark( ( "UniformBuffer/Upload/" + backend.getName() ).c_str()
+			, [&backend]( benchmark::State & state )
+			{
+				doBenchmarkUniformUpload( state, backend );
+			} )->RangeMultiplier( 4 )->Range( 1, Backend::UniformCount );
+		// Each upload is a staging copy, a submission and a wait.
+		benchmark::RegisterBenchmark( ( "StagingBuffer/Upload/" + backend.getName() ).c_str()
+			, [&backend]( benchmark::State & state )
+			{
+				doBenchmarkStagingUpload( state, backend );
+			} )->RangeMultiplier( 8 )->Range( 1024, Backend::MaxUploadSize )->UseRealTime();
+	}
+}
@@ -0,0 +1,215 @@
+#include "Backend.hpp"
+
+#include <Command/CommandBuffer.hpp>
+#include <Command/Queue.hpp>
+#include <Pipeline/Scissor.hpp>
+#include <Pipeline/Viewport.hpp>
+#include <Sync/Fence.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <functional>
+
+namespace bench
+{
+	namespace
+	{
+		using RecordFunction = std::function< void( Backend const &, renderer::CommandBuffer const &, uint32_t ) >;
+
+		struct RecordedCommand
+		{
+			std::string name;
+			//! Tells if the command is recorded inside a render pass, after the pipeline and its resources are bound.
+			bool inRenderPass;
+			RecordFunction record;
+		};
+
+		void doBeginRenderPass( Backend const & backend
+			, renderer::CommandBuffer const & commandBuffer )
+		{
+			commandBuffer.beginRenderPass( *backend.renderPass
+				, *backend.frameBuffer
+				, { renderer::ClearValue{ { 0.0f, 0.0f, 0.0f, 1.0f } } }
+				, renderer::SubpassContents::eInline );
+			commandBuffer.bindPipeline( *backend.pipeline );
+			commandBuffer.setViewport( { Backend::TargetSize, Backend::TargetSize, 0, 0 } );
+			commandBuffer.setScissor( { 0, 0, Backend::TargetSize, Backend::TargetSize } );
+			commandBuffer.bindVertexBuffer( 0u, backend.vertexBuffer->getBuffer(), 0u );
+			commandBuffer.bindDescriptorSet( *backend.descriptorSet
+				, *backend.pipelineLayout );
+		}
+
+		std::vector< RecordedCommand > const & getRecordedCommands()
+		{
+			static std::vector< RecordedCommand > const result
+			{
+				{
+					"BindPipeline",
+					true,
+					[]( Backend const & backend, renderer::CommandBuffer const & commandBuffer, uint32_t )
+					{
+						commandBuffer.bindPipeline( *backend.pipeline );
+					}
+				},
+				{
+					"BindDescriptorSet",
+					true,
+					[]( Backend const & backend, renderer::CommandBuffer const & commandBuffer, uint32_t )
+					{
+						commandBuffer.bindDescriptorSet( *backend.descriptorSet
+							, *backend.pipelineLayout );
+					}
+				},
+				{
+					"SetViewport",
+					true,
+					[]( Backend const & backend, renderer::CommandBuffer const & commandBuffer, uint32_t )
+					{
+						commandBuffer.setViewport( { Backend::TargetSize, Backend::TargetSize, 0, 0 } );
+					}
+				},
+				{
+					"Draw",
+					true,
+					[]( Backend const & backend, renderer::CommandBuffer const & commandBuffer, uint32_t )
+					{
+						commandBuffer.draw( 3u );
+					}
+				},
+				{
+					// With OpenGL, the draw following a vertex buffer bind looks up the pipeline's VAO (Pipeline::findGeometryBuffers).
+					"BindVertexBufferDraw",
+					true,
+					[]( Backend const & backend, renderer::CommandBuffer const & commandBuffer, uint32_t )
+					{
+						commandBuffer.bindVertexBuffer( 0u, backend.vertexBuffer->getBuffer(), 0u );
+						commandBuffer.draw( 3u );
+					}
+				},
+				{
+					"CopyBuffer",
+					false,
+					[]( Backend const & backend, renderer::CommandBuffer const & commandBuffer, uint32_t )
+					{
+						commandBuffer.copyBuffer( backend.srcBuffer->getBuffer()
+							, backend.dstBuffer->getBuffer()
+							, 256u );
+					}
+				},
+				{
+					"Transition",
+					false,
+					[]( Backend const & backend, renderer::CommandBuffer const & commandBuffer, uint32_t index )
+					{
+						// Alternating the states, for each transition to actually need a barrier.
+						if ( index % 2u )
+						{
+							commandBuffer.transition( backend.dstBuffer->getBuffer()
+								, renderer::AccessFlag::eTransferWrite
+								, renderer::PipelineStageFlag::eTransfer );
+						}
+						else
+						{
+							commandBuffer.transition( backend.dstBuffer->getBuffer()
+								, renderer::AccessFlag::eShaderRead
+								, renderer::PipelineStageFlag::eVertexShader );
+						}
+					}
+				},
+			};
+			return result;
+		}
+
+		void doRecord( Backend const & backend
+			, renderer::CommandBuffer const & commandBuffer
+			, RecordedCommand const & command
+			, uint32_t count
+			, renderer::CommandBufferUsageFlags flags )
+		{
+			commandBuffer.begin( flags );
+
+			if ( command.inRenderPass )
+			{
+				doBeginRenderPass( backend, commandBuffer );
+			}
+
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				command.record( backend, commandBuffer, i );
+			}
+
+			if ( command.inRenderPass )
+			{
+				commandBuffer.endRenderPass();
+			}
+
+			commandBuffer.end();
+		}
+
+		void doBenchmarkRecord( benchmark::State & state
+			, Backend & backend
+			, RecordedCommand const & command )
+		{
+			auto count = uint32_t( state.range( 0 ) );
+
+			for ( auto _ : state )
+			{
+				doRecord( backend
+					, *backend.commandBuffer
+					, command
+					, count
+					, renderer::CommandBufferUsageFlag::eOneTimeSubmit );
+			}
+
+			state.SetItemsProcessed( int64_t( state.iterations() ) * count );
+		}
+
+		void doBenchmarkSubmit( benchmark::State & state
+			, Backend & backend
+			, RecordedCommand const & command )
+		{
+			auto count = uint32_t( state.range( 0 ) );
+			doRecord( backend
+				, *backend.commandBuffer
+				, command
+				, count
+				, renderer::CommandBufferUsageFlag::eSimultaneousUse );
+			auto & queue = backend.getDevice().getGraphicsQueue();
+
+			for ( auto _ : state )
+			{
+				queue.submit( *backend.commandBuffer, backend.fence.get() );
+				backend.fence->wait( renderer::FenceTimeout );
+				backend.fence->reset();
+			}
+
+			state.SetItemsProcessed( int64_t( state.iterations() ) * count );
+		}
+	}
+
+	void registerCommandBufferBenchmarks( Backend & backend )
+	{
+		for ( auto & command : getRecordedCommands() )
+		{
+			benchmark::RegisterBenchmark( ( "CommandBuffer/Record/" + command.name + "/" + backend.getName() ).c_str()
+				, [&backend, &command]( benchmark::State & state )
+				{
+					doBenchmarkRecord( state, backend, command );
+				} )->RangeMultiplier( 16 )->Range( 1, 4096 );
+		}
+
+		// The OpenGL renderer applies its commands (BindDescriptorSetCommand::apply...) at submission.
+		for ( auto & command : getRecordedCommands() )
+		{
+			if ( command.name == "BindDescriptorSet"
+				|| command.name == "Draw" )
+			{
+				benchmark::RegisterBenchmark( ( "CommandBuffer/Submit/" + command.name + "/" + backend.getName() ).c_str()
+					, [&backend, &command]( benchmark::State & state )
+					{
+						doBenchmarkSubmit( state, backend, command );
+					} )->RangeMultiplier( 16 )->Range( 1, 4096 );
+			}
+		}
+	}
+}
@@ -0,0 +1,125 @@
+#include "Backend.hpp"
+#include "FileUtils.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <iostream>
+
+namespace
+{
+	struct Options
+	{
+		std::vector< std::string > renderers{ "null", "gl", "vk" };
+		std::string pluginsDir{ common::getExecutableDirectory() };
+	};
+
+	std::vector< std::string > doSplit( std::string const & value )
+	{
+		std::vector< std::string > result;
+		size_t start = 0u;
+		size_t end;
+
+		while ( ( end = value.find( ',', start ) ) != std::string::npos )
+		{
+			result.push_back( value.substr( start, end - start ) );
+			start = end + 1u;
+		}
+
+		result.push_back( value.substr( start ) );
+		return result;
+	}
+
+	// Consumes the options of this program, leaving the others to Google Benchmark.
+	Options doProcessCommandLine( int & argc, char ** argv )
+	{
+		static std::string const RenderersOption = "--renderers=";
+		static std::string const PluginsOption = "--plugins-dir=";
+		Options result;
+		int count = 1;
+
+		for ( int i = 1; i < argc; ++i )
+		{
+			std::string arg = argv[i];
+
+			if ( arg.find( RenderersOption ) == 0u )
+			{
+				result.renderers = doSplit( arg.substr( RenderersOption.size() ) );
+			}
+			else if ( arg.find( PluginsOption ) == 0u )
+			{
+				result.pluginsDir = arg.substr( PluginsOption.size() );
+			}
+			else
+			{
+				argv[count++] = argv[i];
+			}
+		}
+
+		argc = count;
+		return result;
+	}
+
+	std::vector< common::RendererPlugin > doListPlugins( std::string const & folder
+		, common::RendererFactory & factory )
+	{
+		common::StringArray files;
+		std::vector< common::RendererPlugin > result;
+
+		if ( common::listDirectoryFiles( folder, files, false ) )
+		{
+			for ( auto file : files )
+			{
+				if ( file.find( ".dll" ) != std::string::npos
+					|| file.find( ".so" ) != std::string::npos )
+				try
+				{
+					renderer::DynamicLibrary lib{ file };
+					result.emplace_back( std::move( lib )
+						, factory );
+				}
+				catch ( std::exception & exc )
+				{
+					std::clog << exc.what() << std::endl;
+				}
+			}
+		}
+
+		return result;
+	}
+}
+
+int main( int argc, char * argv[] )
+{
+	auto options = doProcessCommandLine( argc, argv );
+	benchmark::Initialize( &argc, argv );
+
+	if ( benchmark::ReportUnrecognizedArguments( argc, argv ) )
+	{
+		std::cerr << "Additional options: --renderers=<null,gl,vk> --plugins-dir=<folder>" << std::endl;
+		return 1;
+	}
+
+	common::RendererFactory factory;
+	auto plugins = doListPlugins( options.pluginsDir, factory );
+	std::vector< bench::BackendPtr > backends;
+
+	for ( auto & name : options.renderers )
+	{
+		try
+		{
+			backends.push_back( std::make_unique< bench::Backend >( factory, name ) );
+			bench::registerCommandBufferBenchmarks( *backends.back() );
+			bench::registerBufferBenchmarks( *backends.back() );
+		}
+		catch ( std::exception & exc )
+		{
+			// A backend without support on this machine doesn't prevent the others from running.
+			std::cerr << "Skipping the " << name << " renderer: " << exc.what() << std::endl;
+		}
+	}
+
+	benchmark::RunSpecifiedBenchmarks();
+	benchmark::Shutdown();
+	backends.clear();
+	return 0;
+}
@@ -0,0 +1,78 @@
+#include <Utils/Converter.hpp>
+#include <Utils/Mat4.hpp>
+#include <Utils/Transform.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+namespace bench
+{
+	namespace
+	{
+		utils::Mat4 doGetTransform( float angle )
+		{
+			utils::Mat4 result;
+			result = utils::translate( result, { 1.0f, 2.0f, -5.0f } );
+			return utils::rotate( result
+				, angle
+				, { 0.0f, 1.0f, 0.0f } );
+		}
+
+		void doBenchmarkMat4Multiply( benchmark::State & state )
+		{
+			auto lhs = doGetTransform( 0.5f );
+			auto rhs = doGetTransform( 1.5f );
+
+			for ( auto _ : state )
+			{
+				benchmark::DoNotOptimize( lhs );
+				benchmark::DoNotOptimize( rhs );
+				auto result = lhs * rhs;
+				benchmark::DoNotOptimize( result );
+			}
+		}
+
+		void doBenchmarkMat4Inverse( benchmark::State & state )
+		{
+			auto matrix = doGetTransform( 0.5f );
+
+			for ( auto _ : state )
+			{
+				benchmark::DoNotOptimize( matrix );
+				auto result = utils::inverse( matrix );
+				benchmark::DoNotOptimize( result );
+			}
+		}
+
+		template< utils::PixelFormat SrcF, utils::PixelFormat DstF >
+		void doBenchmarkConversion( benchmark::State & state )
+		{
+			auto pixels = size_t( state.range( 0 ) ) * size_t( state.range( 0 ) );
+			std::vector< uint8_t > src( pixels * utils::pixelSize( SrcF ), uint8_t( 0x7F ) );
+			std::vector< uint8_t > dst( pixels * utils::pixelSize( DstF ) );
+
+			for ( auto _ : state )
+			{
+				utils::convertBuffer< SrcF >( src.data()
+					, src.size()
+					, dst.data()
+					, DstF
+					, dst.size() );
+				benchmark::ClobberMemory();
+			}
+
+			state.SetItemsProcessed( int64_t( state.iterations() ) * int64_t( pixels ) );
+			state.SetBytesProcessed( int64_t( state.iterations() ) * int64_t( src.size() ) );
+		}
+	}
+
+	BENCHMARK( doBenchmarkMat4Multiply )->Name( "Mat4/Multiply" );
+	BENCHMARK( doBenchmarkMat4Inverse )->Name( "Mat4/Inverse" );
+	BENCHMARK_TEMPLATE( doBenchmarkConversion, utils::PixelFormat::eR8G8B8, utils::PixelFormat::eR8G8B8A8 )
+		->Name( "PixelConversion/R8G8B8ToR8G8B8A8" )->RangeMultiplier( 4 )->Range( 64, 1024 );
+	BENCHMARK_TEMPLATE( doBenchmarkConversion, utils::PixelFormat::eR8G8B8A8, utils::PixelFormat::eR8G8B8 )
+		->Name( "PixelConversion/R8G8B8A8ToR8G8B8" )->RangeMultiplier( 4 )->Range( 64, 1024 );
+	BENCHMARK_TEMPLATE( doBenchmarkConversion, utils::PixelFormat::eR8, utils::PixelFormat::eR8G8B8A8 )
+		->Name( "PixelConversion/R8ToR8G8B8A8" )->RangeMultiplier( 4 )->Range( 64, 1024 );
+}
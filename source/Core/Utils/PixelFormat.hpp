@@ -57,6 +57,12 @@ namespace utils
 		//!\~english	4 floating point components on 32 bits.
 		//!\~french		4 composantes flottantes sur 32 bits.
 		eRGBA32F,
+		//!\~english	4 integer components on 8 bits, RGBA, sRGB encoded.
+		//!\~french		4 composantes entières sur 8 bits, RGBA, encodées en sRGB.
+		eR8G8B8A8_SRGB,
+		//!\~english	3 integer components on 10 bits, and one on 2 bits, RGBA.
+		//!\~french		3 composantes entières sur 10 bits, et une sur 2 bits, RGBA.
+		eR10G10B10A2,
 		/**@}*/
 		/**
 		*\~english
@@ -26,6 +26,8 @@ namespace utils
 		case PixelFormat::eD32FS8:
 		case PixelFormat::eR8G8B8A8:
 		case PixelFormat::eB8G8R8A8:
+		case PixelFormat::eR8G8B8A8_SRGB:
+		case PixelFormat::eR10G10B10A2:
 			return 4u;
 
 		case PixelFormat::eR8G8B8:
@@ -0,0 +1,106 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Buffer/CaptureBuffer.hpp"
+
+#include "Core/CaptureDevice.hpp"
+
+#include <Sync/BufferMemoryBarrier.hpp>
+
+namespace capture_renderer
+{
+	Buffer::Buffer( Device const & device
+		, renderer::BufferBasePtr && inner )
+		: Buffer{ device, *inner }
+	{
+		m_ownInner = std::move( inner );
+	}
+
+	Buffer::Buffer( Device const & device
+		, renderer::BufferBase const & inner )
+		: renderer::BufferBase{ device
+			, inner.getSize()
+			, inner.getTargets()
+			, 0u }
+		, Object{ device.getWriter() }
+		, m_inner{ inner }
+	{
+	}
+
+	uint8_t * Buffer::lock( uint32_t offset
+		, uint32_t size
+		, renderer::MemoryMapFlags flags )const
+	{
+		auto result = m_inner.lock( offset, size, flags );
+
+		if ( result && checkFlag( flags, renderer::MemoryMapFlag::eWrite ) )
+		{
+			m_mapped = result;
+			m_mappedOffset = offset;
+			m_mappedSize = size;
+		}
+
+		return result;
+	}
+
+	void Buffer::flush( uint32_t offset
+		, uint32_t size )const
+	{
+		m_inner.flush( offset, size );
+	}
+
+	void Buffer::invalidate( uint32_t offset
+		, uint32_t size )const
+	{
+		m_inner.invalidate( offset, size );
+	}
+
+	void Buffer::unlock()const
+	{
+		if ( m_mapped && m_writer.isCapturing() )
+		{
+			// Written as a ByteArray, without the intermediate copy.
+			OutputStream stream;
+			stream.write( getObjectId() );
+			stream.write( m_mappedOffset );
+			stream.write( m_mappedSize );
+			stream.writeBytes( m_mapped, m_mappedSize );
+			m_writer.write( ChunkType::eBufferData, stream );
+		}
+
+		m_mapped = nullptr;
+		m_inner.unlock();
+	}
+
+	renderer::BufferMemoryBarrier Buffer::makeTransferDestination()const
+	{
+		return makeMemoryTransitionBarrier( renderer::AccessFlag::eTransferWrite );
+	}
+
+	renderer::BufferMemoryBarrier Buffer::makeTransferSource()const
+	{
+		return makeMemoryTransitionBarrier( renderer::AccessFlag::eTransferRead );
+	}
+
+	renderer::BufferMemoryBarrier Buffer::makeVertexShaderInputResource()const
+	{
+		return makeMemoryTransitionBarrier( renderer::AccessFlag::eVertexAttributeRead );
+	}
+
+	renderer::BufferMemoryBarrier Buffer::makeUniformBufferInput()const
+	{
+		return makeMemoryTransitionBarrier( renderer::AccessFlag::eUniformRead );
+	}
+
+	renderer::BufferMemoryBarrier Buffer::makeMemoryTransitionBarrier( renderer::AccessFlags dstAccess )const
+	{
+		return renderer::BufferMemoryBarrier{ getState().access
+			, dstAccess
+			, ~( 0u )
+			, ~( 0u )
+			, *this
+			, 0u
+			, getSize() };
+	}
+}
@@ -0,0 +1,126 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "Miscellaneous/CaptureObject.hpp"
+
+#include <Buffer/Buffer.hpp>
+
+namespace capture_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Tampon enveloppant celui du renderer capturé.
+	*\remarks
+	*	Les données écrites dans un tampon mappé sont enregistrées lorsqu'il est démappé.
+	*\~english
+	*\brief
+	*	Buffer wrapping the captured renderer's one.
+	*\remarks
+	*	The data written into a mapped buffer is recorded when it is unmapped.
+	*/
+	class Buffer
+		: public renderer::BufferBase
+		, public Object
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] inner
+		*	Le tampon capturé.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] inner
+		*	The captured buffer.
+		*/
+		Buffer( Device const & device
+			, renderer::BufferBasePtr && inner );
+		/**
+		*\~french
+		*\brief
+		*	Constructeur, pour un tampon capturé possédé par un autre objet.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] inner
+		*	Le tampon capturé.
+		*\~english
+		*\brief
+		*	Constructor, for a captured buffer owned by another object.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] inner
+		*	The captured buffer.
+		*/
+		Buffer( Device const & device
+			, renderer::BufferBase const & inner );
+		/**
+		*\copydoc	renderer::BufferBase::lock
+		*/
+		uint8_t * lock( uint32_t offset
+			, uint32_t size
+			, renderer::MemoryMapFlags flags )const override;
+		/**
+		*\copydoc	renderer::BufferBase::flush
+		*/
+		void flush( uint32_t offset
+			, uint32_t size )const override;
+		/**
+		*\copydoc	renderer::BufferBase::invalidate
+		*/
+		void invalidate( uint32_t offset
+			, uint32_t size )const override;
+		/**
+		*\copydoc	renderer::BufferBase::unlock
+		*/
+		void unlock()const override;
+		/**
+		*\copydoc	renderer::BufferBase::makeTransferDestination
+		*/
+		renderer::BufferMemoryBarrier makeTransferDestination()const override;
+		/**
+		*\copydoc	renderer::BufferBase::makeTransferSource
+		*/
+		renderer::BufferMemoryBarrier makeTransferSource()const override;
+		/**
+		*\copydoc	renderer::BufferBase::makeVertexShaderInputResource
+		*/
+		renderer::BufferMemoryBarrier makeVertexShaderInputResource()const override;
+		/**
+		*\copydoc	renderer::BufferBase::makeUniformBufferInput
+		*/
+		renderer::BufferMemoryBarrier makeUniformBufferInput()const override;
+		/**
+		*\copydoc	renderer::BufferBase::makeMemoryTransitionBarrier
+		*/
+		renderer::BufferMemoryBarrier makeMemoryTransitionBarrier( renderer::AccessFlags dstAccess )const override;
+		/**
+		*\~french
+		*\return
+		*	Le tampon capturé.
+		*\~english
+		*\return
+		*	The captured buffer.
+		*/
+		inline renderer::BufferBase const & getInner()const
+		{
+			return m_inner;
+		}
+
+	private:
+		renderer::BufferBasePtr m_ownInner;
+		renderer::BufferBase const & m_inner;
+		mutable uint8_t * m_mapped{ nullptr };
+		mutable uint32_t m_mappedOffset{ 0u };
+		mutable uint32_t m_mappedSize{ 0u };
+	};
+}
@@ -0,0 +1,23 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Buffer/CaptureBufferView.hpp"
+
+#include "Core/CaptureDevice.hpp"
+
+namespace capture_renderer
+{
+	BufferView::BufferView( Device const & device
+		, renderer::BufferViewPtr && inner
+		, renderer::BufferBase const & buffer )
+		: renderer::BufferView{ device
+			, buffer
+			, inner->getFormat()
+			, inner->getOffset()
+			, inner->getRange() }
+		, Object{ device.getWriter() }
+		, m_inner{ std::move( inner ) }
+	{
+	}
+}
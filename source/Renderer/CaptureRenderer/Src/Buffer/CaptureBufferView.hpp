@@ -0,0 +1,65 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "Miscellaneous/CaptureObject.hpp"
+
+#include <Buffer/BufferView.hpp>
+
+namespace capture_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Vue sur un tampon, enveloppant celle du renderer capturé.
+	*\~english
+	*\brief
+	*	View on a buffer, wrapping the captured renderer's one.
+	*/
+	class BufferView
+		: public renderer::BufferView
+		, public Object
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] inner
+		*	La vue capturée.
+		*\param[in] buffer
+		*	Le tampon sur lequel la vue est créée.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] inner
+		*	The captured view.
+		*\param[in] buffer
+		*	The buffer from which the view is created.
+		*/
+		BufferView( Device const & device
+			, renderer::BufferViewPtr && inner
+			, renderer::BufferBase const & buffer );
+		/**
+		*\~french
+		*\return
+		*	La vue capturée.
+		*\~english
+		*\return
+		*	The captured view.
+		*/
+		inline renderer::BufferView const & getInner()const
+		{
+			return *m_inner;
+		}
+
+	private:
+		renderer::BufferViewPtr m_inner;
+	};
+}
@@ -0,0 +1,34 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Buffer/CaptureUniformBuffer.hpp"
+
+#include "Buffer/CaptureBuffer.hpp"
+#include "Core/CaptureDevice.hpp"
+
+namespace capture_renderer
+{
+	UniformBuffer::UniformBuffer( Device const & device
+		, renderer::UniformBufferBasePtr && inner
+		, uint32_t count
+		, uint32_t size
+		, renderer::BufferTargets target
+		, renderer::MemoryPropertyFlags flags )
+		: renderer::UniformBufferBase{ device
+			, count
+			, size
+			, target
+			, flags }
+		, Object{ device.getWriter() }
+		, m_inner{ std::move( inner ) }
+	{
+		m_buffer = std::make_unique< Buffer >( device
+			, m_inner->getBuffer() );
+	}
+
+	uint32_t UniformBuffer::getAlignedSize( uint32_t size )const
+	{
+		return m_inner->getAlignedSize( size );
+	}
+}
@@ -0,0 +1,88 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "Miscellaneous/CaptureObject.hpp"
+
+#include <Buffer/UniformBuffer.hpp>
+
+namespace capture_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Tampon de variables uniformes enveloppant celui du renderer capturé.
+	*\remarks
+	*	Son tampon enveloppe celui du tampon capturé, sans le posséder.
+	*\~english
+	*\brief
+	*	Uniform buffer wrapping the captured renderer's one.
+	*\remarks
+	*	Its buffer wraps the captured one's, without owning it.
+	*/
+	class UniformBuffer
+		: public renderer::UniformBufferBase
+		, public Object
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] inner
+		*	Le tampon capturé.
+		*\param[in] count
+		*	Le nombre d'instances des données.
+		*\param[in] size
+		*	La taille d'une instance des données.
+		*\param[in] target
+		*	Les indicateurs d'utilisation du tampon.
+		*\param[in] flags
+		*	Les indicateurs de mémoire du tampon.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] inner
+		*	The captured buffer.
+		*\param[in] count
+		*	The data instances count.
+		*\param[in] size
+		*	The size of an instance of the data.
+		*\param[in] target
+		*	The buffer usage flags.
+		*\param[in] flags
+		*	The buffer memory flags.
+		*/
+		UniformBuffer( Device const & device
+			, renderer::UniformBufferBasePtr && inner
+			, uint32_t count
+			, uint32_t size
+			, renderer::BufferTargets target
+			, renderer::MemoryPropertyFlags flags );
+		/**
+		*\copydoc	renderer::UniformBufferBase::getAlignedSize
+		*/
+		uint32_t getAlignedSize( uint32_t size )const override;
+		/**
+		*\~french
+		*\return
+		*	Le tampon capturé.
+		*\~english
+		*\return
+		*	The captured buffer.
+		*/
+		inline renderer::UniformBufferBase const & getInner()const
+		{
+			return *m_inner;
+		}
+
+	private:
+		renderer::UniformBufferBasePtr m_inner;
+	};
+}
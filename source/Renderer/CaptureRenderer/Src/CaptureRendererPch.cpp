@@ -0,0 +1 @@
+#include "CaptureRendererPch.hpp"
@@ -0,0 +1 @@
+#include "CaptureRendererPrerequisites.hpp"
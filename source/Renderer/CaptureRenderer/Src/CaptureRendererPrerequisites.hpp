@@ -0,0 +1,88 @@
+/**
+*\file
+*	CaptureRendererPrerequisites.h
+*\author
+*	Sylvain Doremus
+*/
+#pragma once
+
+#include <RendererPrerequisites.hpp>
+
+#include <functional>
+
+namespace capture_renderer
+{
+	class Buffer;
+	class BufferView;
+	class CommandBuffer;
+	class CommandPool;
+	class ComputePipeline;
+	class DescriptorSet;
+	class DescriptorSetLayout;
+	class DescriptorSetPool;
+	class Device;
+	class Fence;
+	class FrameBuffer;
+	class InputStream;
+	class Object;
+	class OutputStream;
+	class Pipeline;
+	class PipelineLayout;
+	class Player;
+	class QueryPool;
+	class Queue;
+	class Renderer;
+	class RenderingResources;
+	class RenderPass;
+	class RenderSubpass;
+	class Sampler;
+	class Semaphore;
+	class ShaderModule;
+	class SwapChain;
+	class Texture;
+	class TextureView;
+	class UniformBuffer;
+	class Writer;
+	/**
+	*\~french
+	*\brief
+	*	L'identifiant d'un objet dans une capture.
+	*\~english
+	*\brief
+	*	An object's identifier in a capture.
+	*/
+	using ObjectId = uint32_t;
+	/**
+	*\~french
+	*\brief
+	*	L'identifiant des objets non créés via le renderer de capture (ceux internes à une swap chain, par exemple).
+	*\~english
+	*\brief
+	*	The identifier of the objects not created through the capture renderer (those internal to a swap chain, for example).
+	*/
+	static ObjectId constexpr ExternalObject = 0u;
+	/**
+	*\~french
+	*\brief
+	*	Récupère l'objet du renderer capturé, enveloppé par l'objet donné.
+	*\remarks
+	*	Un objet n'ayant pas été créé via le renderer de capture est retourné tel quel.
+	*\param[in] object
+	*	L'objet.
+	*\~english
+	*\brief
+	*	Retrieves the captured renderer's object, wrapped by the given object.
+	*\remarks
+	*	An object that wasn't created through the capture renderer is returned as is.
+	*\param[in] object
+	*	The object.
+	*/
+	template< typename CaptureT, typename RendererT >
+	inline RendererT const & unwrap( RendererT const & object )
+	{
+		auto capture = dynamic_cast< CaptureT const * >( &object );
+		return capture
+			? capture->getInner()
+			: object;
+	}
+}
@@ -0,0 +1,658 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Command/CaptureCommandBuffer.hpp"
+
+#include "Buffer/CaptureBuffer.hpp"
+#include "Command/CaptureCommandPool.hpp"
+#include "Core/CaptureDevice.hpp"
+#include "Descriptor/CaptureDescriptorSet.hpp"
+#include "Image/CaptureTexture.hpp"
+#include "Image/CaptureTextureView.hpp"
+#include "Miscellaneous/CaptureQueryPool.hpp"
+#include "Pipeline/CaptureComputePipeline.hpp"
+#include "Pipeline/CapturePipeline.hpp"
+#include "Pipeline/CapturePipelineLayout.hpp"
+#include "RenderPass/CaptureFrameBuffer.hpp"
+#include "RenderPass/CaptureRenderPass.hpp"
+
+#include <Buffer/PushConstantsBuffer.hpp>
+#include <Command/CommandBufferInheritanceInfo.hpp>
+#include <RenderPass/ClearAttachment.hpp>
+#include <RenderPass/ClearRect.hpp>
+#include <Sync/BufferMemoryBarrier.hpp>
+#include <Sync/ImageMemoryBarrier.hpp>
+
+namespace capture_renderer
+{
+	CommandBuffer::CommandBuffer( Device const & device
+		, CommandPool const & pool
+		, renderer::CommandBufferPtr && inner
+		, bool primary )
+		: renderer::CommandBuffer{ device, pool, primary }
+		, Object{ device.getWriter() }
+		, m_ownInner{ std::move( inner ) }
+		, m_inner{ *m_ownInner }
+	{
+	}
+
+	CommandBuffer::CommandBuffer( Device const & device
+		, CommandPool const & pool
+		, renderer::CommandBuffer const & inner )
+		: renderer::CommandBuffer{ device, pool, true }
+		, Object{ device.getWriter() }
+		// The swap chains only give const access to their command buffers,
+		// clearAttachments being the only non const command.
+		, m_inner{ const_cast< renderer::CommandBuffer & >( inner ) }
+	{
+	}
+
+	bool CommandBuffer::begin( renderer::CommandBufferUsageFlags flags )const
+	{
+		m_flags = flags;
+		m_inheritance.clear();
+		m_commands.clear();
+		m_count = 0u;
+		return m_inner.begin( flags );
+	}
+
+	bool CommandBuffer::begin( renderer::CommandBufferUsageFlags flags
+		, renderer::CommandBufferInheritanceInfo const & inheritanceInfo )const
+	{
+		m_flags = flags;
+		m_inheritance.clear();
+		m_commands.clear();
+		m_count = 0u;
+		m_inheritance.write( capture_renderer::getObjectId( inheritanceInfo.renderPass ) );
+		m_inheritance.write( inheritanceInfo.subpass );
+		m_inheritance.write( capture_renderer::getObjectId( inheritanceInfo.framebuffer ) );
+		m_inheritance.write( inheritanceInfo.occlusionQueryEnable );
+		m_inheritance.write( inheritanceInfo.queryFlags );
+		m_inheritance.write( inheritanceInfo.pipelineStatistics );
+		return m_inner.begin( flags
+			, renderer::CommandBufferInheritanceInfo
+			{
+				inheritanceInfo.renderPass
+					? &unwrap< RenderPass >( *inheritanceInfo.renderPass )
+					: nullptr,
+				inheritanceInfo.subpass,
+				inheritanceInfo.framebuffer
+					? &unwrap< FrameBuffer >( *inheritanceInfo.framebuffer )
+					: nullptr,
+				inheritanceInfo.occlusionQueryEnable,
+				inheritanceInfo.queryFlags,
+				inheritanceInfo.pipelineStatistics,
+			} );
+	}
+
+	bool CommandBuffer::end()const
+	{
+		m_writer.writeChunk( ChunkType::eRecord
+			, getObjectId()
+			, m_flags
+			, m_inheritance.getData()
+			, m_count
+			, m_commands.getData() );
+		m_commands.clear();
+		m_count = 0u;
+		return m_inner.end();
+	}
+
+	bool CommandBuffer::reset( renderer::CommandBufferResetFlags flags )const
+	{
+		m_commands.clear();
+		m_count = 0u;
+		return m_inner.reset( flags );
+	}
+
+	void CommandBuffer::nextSubpass( renderer::SubpassContents contents )const
+	{
+		doRecord( CommandType::eNextSubpass
+			, contents );
+		m_inner.nextSubpass( contents );
+	}
+
+	void CommandBuffer::endRenderPass()const
+	{
+		doRecord( CommandType::eEndRenderPass );
+		m_inner.endRenderPass();
+	}
+
+	void CommandBuffer::executeCommands( renderer::CommandBufferCRefArray const & commands )const
+	{
+		renderer::CommandBufferCRefArray inner;
+		std::vector< ObjectId > ids;
+
+		for ( auto & command : commands )
+		{
+			inner.emplace_back( unwrap< CommandBuffer >( command.get() ) );
+			ids.push_back( capture_renderer::getObjectId( command.get() ) );
+		}
+
+		doRecord( CommandType::eExecuteCommands
+			, ids );
+		m_inner.executeCommands( inner );
+	}
+
+	void CommandBuffer::clear( renderer::TextureView const & image
+		, renderer::RgbaColour const & colour )const
+	{
+		doRecord( CommandType::eClearColour
+			, capture_renderer::getObjectId( image )
+			, colour );
+		m_inner.clear( unwrap< TextureView >( image )
+			, colour );
+	}
+
+	void CommandBuffer::clear( renderer::TextureView const & image
+		, renderer::DepthStencilClearValue const & value )const
+	{
+		doRecord( CommandType::eClearDepthStencil
+			, capture_renderer::getObjectId( image )
+			, value );
+		m_inner.clear( unwrap< TextureView >( image )
+			, value );
+	}
+
+	void CommandBuffer::clearAttachments( renderer::ClearAttachmentArray const & clearAttachments
+		, renderer::ClearRectArray const & clearRects )
+	{
+		doRecord( CommandType::eClearAttachments
+			, clearAttachments
+			, clearRects );
+		m_inner.clearAttachments( clearAttachments
+			, clearRects );
+	}
+
+	void CommandBuffer::bindPipeline( renderer::Pipeline const & pipeline
+		, renderer::PipelineBindPoint bindingPoint )const
+	{
+		doRecord( CommandType::eBindPipeline
+			, capture_renderer::getObjectId( pipeline )
+			, bindingPoint );
+		m_inner.bindPipeline( unwrap< Pipeline >( pipeline )
+			, bindingPoint );
+	}
+
+	void CommandBuffer::bindPipeline( renderer::ComputePipeline const & pipeline
+		, renderer::PipelineBindPoint bindingPoint )const
+	{
+		doRecord( CommandType::eBindComputePipeline
+			, capture_renderer::getObjectId( pipeline )
+			, bindingPoint );
+		m_inner.bindPipeline( unwrap< ComputePipeline >( pipeline )
+			, bindingPoint );
+	}
+
+	void CommandBuffer::bindVertexBuffers( uint32_t firstBinding
+		, renderer::BufferCRefArray const & buffers
+		, renderer::UInt64Array offsets )const
+	{
+		renderer::BufferCRefArray inner;
+		std::vector< ObjectId > ids;
+
+		for ( auto & buffer : buffers )
+		{
+			inner.emplace_back( unwrap< Buffer >( buffer.get() ) );
+			ids.push_back( capture_renderer::getObjectId( buffer.get() ) );
+		}
+
+		doRecord( CommandType::eBindVertexBuffers
+			, firstBinding
+			, ids
+			, offsets );
+		m_inner.bindVertexBuffers( firstBinding
+			, inner
+			, offsets );
+	}
+
+	void CommandBuffer::bindIndexBuffer( renderer::BufferBase const & buffer
+		, uint64_t offset
+		, renderer::IndexType indexType )const
+	{
+		doRecord( CommandType::eBindIndexBuffer
+			, capture_renderer::getObjectId( buffer )
+			, offset
+			, indexType );
+		m_inner.bindIndexBuffer( unwrap< Buffer >( buffer )
+			, offset
+			, indexType );
+	}
+
+	void CommandBuffer::bindDescriptorSets( renderer::DescriptorSetCRefArray const & descriptorSets
+		, renderer::PipelineLayout const & layout
+		, renderer::UInt32Array const & dynamicOffsets
+		, renderer::PipelineBindPoint bindingPoint )const
+	{
+		renderer::DescriptorSetCRefArray inner;
+		std::vector< ObjectId > ids;
+
+		for ( auto & descriptorSet : descriptorSets )
+		{
+			inner.emplace_back( unwrap< DescriptorSet >( descriptorSet.get() ) );
+			ids.push_back( capture_renderer::getObjectId( descriptorSet.get() ) );
+		}
+
+		doRecord( CommandType::eBindDescriptorSets
+			, ids
+			, capture_renderer::getObjectId( layout )
+			, dynamicOffsets
+			, bindingPoint );
+		m_inner.bindDescriptorSets( inner
+			, unwrap< PipelineLayout >( layout )
+			, dynamicOffsets
+			, bindingPoint );
+	}
+
+	void CommandBuffer::setViewport( renderer::Viewport const & viewport )const
+	{
+		doRecord( CommandType::eSetViewport
+			, viewport );
+		m_inner.setViewport( viewport );
+	}
+
+	void CommandBuffer::setScissor( renderer::Scissor const & scissor )const
+	{
+		doRecord( CommandType::eSetScissor
+			, scissor );
+		m_inner.setScissor( scissor );
+	}
+
+	void CommandBuffer::draw( uint32_t vtxCount
+		, uint32_t instCount
+		, uint32_t firstVertex
+		, uint32_t firstInstance )const
+	{
+		doRecord( CommandType::eDraw
+			, vtxCount
+			, instCount
+			, firstVertex
+			, firstInstance );
+		m_inner.draw( vtxCount
+			, instCount
+			, firstVertex
+			, firstInstance );
+	}
+
+	void CommandBuffer::drawIndexed( uint32_t indexCount
+		, uint32_t instCount
+		, uint32_t firstIndex
+		, uint32_t vertexOffset
+		, uint32_t firstInstance )const
+	{
+		doRecord( CommandType::eDrawIndexed
+			, indexCount
+			, instCount
+			, firstIndex
+			, vertexOffset
+			, firstInstance );
+		m_inner.drawIndexed( indexCount
+			, instCount
+			, firstIndex
+			, vertexOffset
+			, firstInstance );
+	}
+
+	void CommandBuffer::drawIndirect( renderer::BufferBase const & buffer
+		, uint32_t offset
+		, uint32_t drawCount
+		, uint32_t stride )const
+	{
+		doRecord( CommandType::eDrawIndirect
+			, capture_renderer::getObjectId( buffer )
+			, offset
+			, drawCount
+			, stride );
+		m_inner.drawIndirect( unwrap< Buffer >( buffer )
+			, offset
+			, drawCount
+			, stride );
+	}
+
+	void CommandBuffer::drawIndexedIndirect( renderer::BufferBase const & buffer
+		, uint32_t offset
+		, uint32_t drawCount
+		, uint32_t stride )const
+	{
+		doRecord( CommandType::eDrawIndexedIndirect
+			, capture_renderer::getObjectId( buffer )
+			, offset
+			, drawCount
+			, stride );
+		m_inner.drawIndexedIndirect( unwrap< Buffer >( buffer )
+			, offset
+			, drawCount
+			, stride );
+	}
+
+	void CommandBuffer::drawIndirectCount( renderer::BufferBase const & buffer
+		, uint32_t offset
+		, renderer::BufferBase const & countBuffer
+		, uint32_t countBufferOffset
+		, uint32_t maxDrawCount
+		, uint32_t stride )const
+	{
+		doRecord( CommandType::eDrawIndirectCount
+			, capture_renderer::getObjectId( buffer )
+			, offset
+			, capture_renderer::getObjectId( countBuffer )
+			, countBufferOffset
+			, maxDrawCount
+			, stride );
+		m_inner.drawIndirectCount( unwrap< Buffer >( buffer )
+			, offset
+			, unwrap< Buffer >( countBuffer )
+			, countBufferOffset
+			, maxDrawCount
+			, stride );
+	}
+
+	void CommandBuffer::drawIndexedIndirectCount( renderer::BufferBase const & buffer
+		, uint32_t offset
+		, renderer::BufferBase const & countBuffer
+		, uint32_t countBufferOffset
+		, uint32_t maxDrawCount
+		, uint32_t stride )const
+	{
+		doRecord( CommandType::eDrawIndexedIndirectCount
+			, capture_renderer::getObjectId( buffer )
+			, offset
+			, capture_renderer::getObjectId( countBuffer )
+			, countBufferOffset
+			, maxDrawCount
+			, stride );
+		m_inner.drawIndexedIndirectCount( unwrap< Buffer >( buffer )
+			, offset
+			, unwrap< Buffer >( countBuffer )
+			, countBufferOffset
+			, maxDrawCount
+			, stride );
+	}
+
+	void CommandBuffer::copyToBuffer( renderer::BufferImageCopyArray const & copyInfo
+		, renderer::Texture const & src
+		, renderer::BufferBase const & dst )const
+	{
+		doRecord( CommandType::eCopyToBuffer
+			, copyInfo
+			, capture_renderer::getObjectId( src )
+			, capture_renderer::getObjectId( dst ) );
+		m_inner.copyToBuffer( copyInfo
+			, unwrap< Texture >( src )
+			, unwrap< Buffer >( dst ) );
+	}
+
+	void CommandBuffer::copyBuffer( renderer::BufferCopy const & copyInfo
+		, renderer::BufferBase const & src
+		, renderer::BufferBase const & dst )const
+	{
+		doRecord( CommandType::eCopyBuffer
+			, copyInfo
+			, capture_renderer::getObjectId( src )
+			, capture_renderer::getObjectId( dst ) );
+		m_inner.copyBuffer( copyInfo
+			, unwrap< Buffer >( src )
+			, unwrap< Buffer >( dst ) );
+	}
+
+	void CommandBuffer::resetQueryPool( renderer::QueryPool const & pool
+		, uint32_t firstQuery
+		, uint32_t queryCount )const
+	{
+		doRecord( CommandType::eResetQueryPool
+			, capture_renderer::getObjectId( pool )
+			, firstQuery
+			, queryCount );
+		m_inner.resetQueryPool( unwrap< QueryPool >( pool )
+			, firstQuery
+			, queryCount );
+	}
+
+	void CommandBuffer::beginQuery( renderer::QueryPool const & pool
+		, uint32_t query
+		, renderer::QueryControlFlags flags )const
+	{
+		doRecord( CommandType::eBeginQuery
+			, capture_renderer::getObjectId( pool )
+			, query
+			, flags );
+		m_inner.beginQuery( unwrap< QueryPool >( pool )
+			, query
+			, flags );
+	}
+
+	void CommandBuffer::endQuery( renderer::QueryPool const & pool
+		, uint32_t query )const
+	{
+		doRecord( CommandType::eEndQuery
+			, capture_renderer::getObjectId( pool )
+			, query );
+		m_inner.endQuery( unwrap< QueryPool >( pool )
+			, query );
+	}
+
+	void CommandBuffer::writeTimestamp( renderer::PipelineStageFlag pipelineStage
+		, renderer::QueryPool const & pool
+		, uint32_t query )const
+	{
+		doRecord( CommandType::eWriteTimestamp
+			, pipelineStage
+			, capture_renderer::getObjectId( pool )
+			, query );
+		m_inner.writeTimestamp( pipelineStage
+			, unwrap< QueryPool >( pool )
+			, query );
+	}
+
+	void CommandBuffer::copyQueryPoolResults( renderer::QueryPool const & pool
+		, uint32_t firstQuery
+		, uint32_t queryCount
+		, renderer::BufferBase const & dstBuffer
+		, uint32_t dstOffset
+		, uint32_t stride
+		, renderer::QueryResultFlags flags )const
+	{
+		doRecord( CommandType::eCopyQueryPoolResults
+			, capture_renderer::getObjectId( pool )
+			, firstQuery
+			, queryCount
+			, capture_renderer::getObjectId( dstBuffer )
+			, dstOffset
+			, stride
+			, flags );
+		m_inner.copyQueryPoolResults( unwrap< QueryPool >( pool )
+			, firstQuery
+			, queryCount
+			, unwrap< Buffer >( dstBuffer )
+			, dstOffset
+			, stride
+			, flags );
+	}
+
+	void CommandBuffer::pushConstants( renderer::PipelineLayout const & layout
+		, renderer::PushConstantsBufferBase const & pcb )const
+	{
+		doRecord( CommandType::ePushConstants
+			, capture_renderer::getObjectId( layout )
+			, pcb.getStageFlags()
+			, renderer::PushConstantArray( pcb.begin(), pcb.end() )
+			, renderer::ByteArray( pcb.getData(), pcb.getData() + pcb.getSize() ) );
+		m_inner.pushConstants( unwrap< PipelineLayout >( layout )
+			, pcb );
+	}
+
+	void CommandBuffer::dispatch( uint32_t groupCountX
+		, uint32_t groupCountY
+		, uint32_t groupCountZ )const
+	{
+		doRecord( CommandType::eDispatch
+			, groupCountX
+			, groupCountY
+			, groupCountZ );
+		m_inner.dispatch( groupCountX
+			, groupCountY
+			, groupCountZ );
+	}
+
+	void CommandBuffer::dispatchIndirect( renderer::BufferBase const & buffer
+		, uint32_t offset )const
+	{
+		doRecord( CommandType::eDispatchIndirect
+			, capture_renderer::getObjectId( buffer )
+			, offset );
+		m_inner.dispatchIndirect( unwrap< Buffer >( buffer )
+			, offset );
+	}
+
+	void CommandBuffer::setLineWidth( float width )const
+	{
+		doRecord( CommandType::eSetLineWidth
+			, width );
+		m_inner.setLineWidth( width );
+	}
+
+	void CommandBuffer::doBeginRenderPass( renderer::RenderPass const & renderPass
+		, renderer::FrameBuffer const & frameBuffer
+		, renderer::ClearValueArray const & clearValues
+		, renderer::SubpassContents contents )const
+	{
+		doRecord( CommandType::eBeginRenderPass
+			, capture_renderer::getObjectId( renderPass )
+			, capture_renderer::getObjectId( frameBuffer )
+			, clearValues
+			, contents );
+		m_inner.beginRenderPass( unwrap< RenderPass >( renderPass )
+			, unwrap< FrameBuffer >( frameBuffer )
+			, clearValues
+			, contents );
+	}
+
+	void CommandBuffer::doMemoryBarrier( renderer::PipelineStageFlags after
+		, renderer::PipelineStageFlags before
+		, renderer::BufferMemoryBarrier const & transitionBarrier )const
+	{
+		doRecord( CommandType::eBufferMemoryBarrier
+			, after
+			, before
+			, transitionBarrier.getSrcAccessMask()
+			, transitionBarrier.getDstAccessMask()
+			, transitionBarrier.getSrcQueueFamilyIndex()
+			, transitionBarrier.getDstQueueFamilyIndex()
+			, capture_renderer::getObjectId( transitionBarrier.getBuffer() )
+			, transitionBarrier.getOffset()
+			, transitionBarrier.getSize() );
+		m_inner.memoryBarrier( after
+			, before
+			, renderer::BufferMemoryBarrier
+			{
+				transitionBarrier.getSrcAccessMask(),
+				transitionBarrier.getDstAccessMask(),
+				transitionBarrier.getSrcQueueFamilyIndex(),
+				transitionBarrier.getDstQueueFamilyIndex(),
+				unwrap< Buffer >( transitionBarrier.getBuffer() ),
+				transitionBarrier.getOffset(),
+				transitionBarrier.getSize()
+			} );
+	}
+
+	void CommandBuffer::doMemoryBarrier( renderer::PipelineStageFlags after
+		, renderer::PipelineStageFlags before
+		, renderer::ImageMemoryBarrier const & transitionBarrier )const
+	{
+		doRecord( CommandType::eImageMemoryBarrier
+			, after
+			, before
+			, transitionBarrier.getSrcAccessMask()
+			, transitionBarrier.getDstAccessMask()
+			, transitionBarrier.getOldLayout()
+			, transitionBarrier.getNewLayout()
+			, transitionBarrier.getSrcQueueFamilyIndex()
+			, transitionBarrier.getDstQueueFamilyIndex()
+			, capture_renderer::getObjectId( transitionBarrier.getImage() )
+			, transitionBarrier.getSubresourceRange() );
+		m_inner.memoryBarrier( after
+			, before
+			, renderer::ImageMemoryBarrier
+			{
+				transitionBarrier.getSrcAccessMask(),
+				transitionBarrier.getDstAccessMask(),
+				transitionBarrier.getOldLayout(),
+				transitionBarrier.getNewLayout(),
+				transitionBarrier.getSrcQueueFamilyIndex(),
+				transitionBarrier.getDstQueueFamilyIndex(),
+				unwrap< Texture >( transitionBarrier.getImage() ),
+				transitionBarrier.getSubresourceRange()
+			} );
+	}
+
+	void CommandBuffer::doCopyToImage( renderer::BufferImageCopyArray const & copyInfo
+		, renderer::BufferBase const & src
+		, renderer::Texture const & dst )const
+	{
+		doRecord( CommandType::eCopyToImage
+			, copyInfo
+			, capture_renderer::getObjectId( src )
+			, capture_renderer::getObjectId( dst ) );
+		m_inner.copyToImage( copyInfo
+			, unwrap< Buffer >( src )
+			, unwrap< Texture >( dst ) );
+	}
+
+	void CommandBuffer::doCopyImage( renderer::ImageCopy const & copyInfo
+		, renderer::TextureView const & src
+		, renderer::TextureView const & dst )const
+	{
+		doRecord( CommandType::eCopyImage
+			, copyInfo
+			, capture_renderer::getObjectId( src )
+			, capture_renderer::getObjectId( dst ) );
+		m_inner.copyImage( copyInfo
+			, unwrap< TextureView >( src )
+			, unwrap< TextureView >( dst ) );
+	}
+
+	void CommandBuffer::doBlitImage( renderer::Texture const & srcImage
+		, renderer::ImageLayout srcLayout
+		, renderer::Texture const & dstImage
+		, renderer::ImageLayout dstLayout
+		, std::vector< renderer::ImageBlit > const & regions
+		, renderer::Filter filter )const
+	{
+		doRecord( CommandType::eBlitImage
+			, capture_renderer::getObjectId( srcImage )
+			, srcLayout
+			, capture_renderer::getObjectId( dstImage )
+			, dstLayout
+			, regions
+			, filter );
+		m_inner.blitImage( unwrap< Texture >( srcImage )
+			, srcLayout
+			, unwrap< Texture >( dstImage )
+			, dstLayout
+			, regions
+			, filter );
+	}
+
+	void CommandBuffer::doGenerateMipmaps( renderer::Texture const & texture
+		, uint32_t baseMipLevel
+		, renderer::ResourceState const & finalState )const
+	{
+		// The inner texture follows the same writes and barriers, so it regenerates the same levels.
+		doRecord( CommandType::eGenerateMipmaps
+			, capture_renderer::getObjectId( texture ) );
+		m_inner.generateMipmaps( unwrap< Texture >( texture ) );
+	}
+
+	template< typename ... ParamsT >
+	void CommandBuffer::doRecord( CommandType type
+		, ParamsT const & ... params )const
+	{
+		if ( m_writer.isCapturing() )
+		{
+			m_commands.write( type );
+			( m_commands.write( params ), ... );
+			++m_count;
+		}
+	}
+}
@@ -0,0 +1,348 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "Miscellaneous/CaptureObject.hpp"
+
+#include <Command/CommandBuffer.hpp>
+
+namespace capture_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Tampon de commandes enveloppant celui du renderer capturé.
+	*\remarks
+	*	Chaque commande est transmise au tampon capturé, et sérialisée.
+	*	Les commandes sont enregistrées en un seul chunk, à la fin de l'enregistrement.
+	*\~english
+	*\brief
+	*	Command buffer wrapping the captured renderer's one.
+	*\remarks
+	*	Each command is forwarded to the captured buffer, and serialised.
+	*	The commands are recorded in a single chunk, when the recording ends.
+	*/
+	class CommandBuffer
+		: public renderer::CommandBuffer
+		, public Object
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] pool
+		*	Le pool de tampons de commandes.
+		*\param[in] inner
+		*	Le tampon capturé.
+		*\param[in] primary
+		*	Dit si le tampon est un tampon de commandes primaire (\p true) ou secondaire (\p false).
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] pool
+		*	The command buffer pool.
+		*\param[in] inner
+		*	The captured buffer.
+		*\param[in] primary
+		*	Tells if the command buffer is primary (\p true) or not (\p false).
+		*/
+		CommandBuffer( Device const & device
+			, CommandPool const & pool
+			, renderer::CommandBufferPtr && inner
+			, bool primary );
+		/**
+		*\~french
+		*\brief
+		*	Constructeur, pour un tampon capturé possédé par une swap chain.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] pool
+		*	Le pool de tampons de commandes.
+		*\param[in] inner
+		*	Le tampon capturé.
+		*\~english
+		*\brief
+		*	Constructor, for a captured buffer owned by a swap chain.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] pool
+		*	The command buffer pool.
+		*\param[in] inner
+		*	The captured buffer.
+		*/
+		CommandBuffer( Device const & device
+			, CommandPool const & pool
+			, renderer::CommandBuffer const & inner );
+		/**
+		*\copydoc	renderer::CommandBuffer::begin
+		*/
+		bool begin( renderer::CommandBufferUsageFlags flags )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::begin
+		*/
+		bool begin( renderer::CommandBufferUsageFlags flags
+			, renderer::CommandBufferInheritanceInfo const & inheritanceInfo )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::end
+		*/
+		bool end()const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::reset
+		*/
+		bool reset( renderer::CommandBufferResetFlags flags )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::nextSubpass
+		*/
+		void nextSubpass( renderer::SubpassContents contents )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::endRenderPass
+		*/
+		void endRenderPass()const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::executeCommands
+		*/
+		void executeCommands( renderer::CommandBufferCRefArray const & commands )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::clear
+		*/
+		void clear( renderer::TextureView const & image
+			, renderer::RgbaColour const & colour )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::clear
+		*/
+		void clear( renderer::TextureView const & image
+			, renderer::DepthStencilClearValue const & value )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::clearAttachments
+		*/
+		void clearAttachments( renderer::ClearAttachmentArray const & clearAttachments
+			, renderer::ClearRectArray const & clearRects )override;
+		/**
+		*\copydoc	renderer::CommandBuffer::bindPipeline
+		*/
+		void bindPipeline( renderer::Pipeline const & pipeline
+			, renderer::PipelineBindPoint bindingPoint )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::bindPipeline
+		*/
+		void bindPipeline( renderer::ComputePipeline const & pipeline
+			, renderer::PipelineBindPoint bindingPoint )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::bindVertexBuffers
+		*/
+		void bindVertexBuffers( uint32_t firstBinding
+			, renderer::BufferCRefArray const & buffers
+			, renderer::UInt64Array offsets )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::bindIndexBuffer
+		*/
+		void bindIndexBuffer( renderer::BufferBase const & buffer
+			, uint64_t offset
+			, renderer::IndexType indexType )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::bindDescriptorSets
+		*/
+		void bindDescriptorSets( renderer::DescriptorSetCRefArray const & descriptorSets
+			, renderer::PipelineLayout const & layout
+			, renderer::UInt32Array const & dynamicOffsets
+			, renderer::PipelineBindPoint bindingPoint )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::setViewport
+		*/
+		void setViewport( renderer::Viewport const & viewport )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::setScissor
+		*/
+		void setScissor( renderer::Scissor const & scissor )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::draw
+		*/
+		void draw( uint32_t vtxCount
+			, uint32_t instCount
+			, uint32_t firstVertex
+			, uint32_t firstInstance )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::drawIndexed
+		*/
+		void drawIndexed( uint32_t indexCount
+			, uint32_t instCount
+			, uint32_t firstIndex
+			, uint32_t vertexOffset
+			, uint32_t firstInstance )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::drawIndirect
+		*/
+		void drawIndirect( renderer::BufferBase const & buffer
+			, uint32_t offset
+			, uint32_t drawCount
+			, uint32_t stride )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::drawIndexedIndirect
+		*/
+		void drawIndexedIndirect( renderer::BufferBase const & buffer
+			, uint32_t offset
+			, uint32_t drawCount
+			, uint32_t stride )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::drawIndirectCount
+		*/
+		void drawIndirectCount( renderer::BufferBase const & buffer
+			, uint32_t offset
+			, renderer::BufferBase const & countBuffer
+			, uint32_t countBufferOffset
+			, uint32_t maxDrawCount
+			, uint32_t stride )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::drawIndexedIndirectCount
+		*/
+		void drawIndexedIndirectCount( renderer::BufferBase const & buffer
+			, uint32_t offset
+			, renderer::BufferBase const & countBuffer
+			, uint32_t countBufferOffset
+			, uint32_t maxDrawCount
+			, uint32_t stride )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::copyToBuffer
+		*/
+		void copyToBuffer( renderer::BufferImageCopyArray const & copyInfo
+			, renderer::Texture const & src
+			, renderer::BufferBase const & dst )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::copyBuffer
+		*/
+		void copyBuffer( renderer::BufferCopy const & copyInfo
+			, renderer::BufferBase const & src
+			, renderer::BufferBase const & dst )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::resetQueryPool
+		*/
+		void resetQueryPool( renderer::QueryPool const & pool
+			, uint32_t firstQuery
+			, uint32_t queryCount )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::beginQuery
+		*/
+		void beginQuery( renderer::QueryPool const & pool
+			, uint32_t query
+			, renderer::QueryControlFlags flags )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::endQuery
+		*/
+		void endQuery( renderer::QueryPool const & pool
+			, uint32_t query )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::writeTimestamp
+		*/
+		void writeTimestamp( renderer::PipelineStageFlag pipelineStage
+			, renderer::QueryPool const & pool
+			, uint32_t query )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::copyQueryPoolResults
+		*/
+		void copyQueryPoolResults( renderer::QueryPool const & pool
+			, uint32_t firstQuery
+			, uint32_t queryCount
+			, renderer::BufferBase const & dstBuffer
+			, uint32_t dstOffset
+			, uint32_t stride
+			, renderer::QueryResultFlags flags )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::pushConstants
+		*/
+		void pushConstants( renderer::PipelineLayout const & layout
+			, renderer::PushConstantsBufferBase const & pcb )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::dispatch
+		*/
+		void dispatch( uint32_t groupCountX
+			, uint32_t groupCountY
+			, uint32_t groupCountZ )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::dispatchIndirect
+		*/
+		void dispatchIndirect( renderer::BufferBase const & buffer
+			, uint32_t offset )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::setLineWidth
+		*/
+		void setLineWidth( float width )const override;
+		/**
+		*\~french
+		*\return
+		*	Le tampon capturé.
+		*\~english
+		*\return
+		*	The captured buffer.
+		*/
+		inline renderer::CommandBuffer const & getInner()const
+		{
+			return m_inner;
+		}
+
+	private:
+		/**
+		*\copydoc	renderer::CommandBuffer::doBeginRenderPass
+		*/
+		void doBeginRenderPass( renderer::RenderPass const & renderPass
+			, renderer::FrameBuffer const & frameBuffer
+			, renderer::ClearValueArray const & clearValues
+			, renderer::SubpassContents contents )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::doMemoryBarrier
+		*/
+		void doMemoryBarrier( renderer::PipelineStageFlags after
+			, renderer::PipelineStageFlags before
+			, renderer::BufferMemoryBarrier const & transitionBarrier )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::doMemoryBarrier
+		*/
+		void doMemoryBarrier( renderer::PipelineStageFlags after
+			, renderer::PipelineStageFlags before
+			, renderer::ImageMemoryBarrier const & transitionBarrier )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::doCopyToImage
+		*/
+		void doCopyToImage( renderer::BufferImageCopyArray const & copyInfo
+			, renderer::BufferBase const & src
+			, renderer::Texture const & dst )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::doCopyImage
+		*/
+		void doCopyImage( renderer::ImageCopy const & copyInfo
+			, renderer::TextureView const & src
+			, renderer::TextureView const & dst )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::doBlitImage
+		*/
+		void doBlitImage( renderer::Texture const & srcImage
+			, renderer::ImageLayout srcLayout
+			, renderer::Texture const & dstImage
+			, renderer::ImageLayout dstLayout
+			, std::vector< renderer::ImageBlit > const & regions
+			, renderer::Filter filter )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::doGenerateMipmaps
+		*/
+		void doGenerateMipmaps( renderer::Texture const & texture
+			, uint32_t baseMipLevel
+			, renderer::ResourceState const & finalState )const override;
+		template< typename ... ParamsT >
+		void doRecord( CommandType type
+			, ParamsT const & ... params )const;
+
+	private:
+		renderer::CommandBufferPtr m_ownInner;
+		renderer::CommandBuffer & m_inner;
+		mutable renderer::CommandBufferUsageFlags m_flags{ 0u };
+		mutable OutputStream m_inheritance;
+		mutable OutputStream m_commands;
+		mutable uint32_t m_count{ 0u };
+	};
+}
@@ -0,0 +1,39 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Command/CaptureCommandPool.hpp"
+
+#include "Command/CaptureCommandBuffer.hpp"
+#include "Core/CaptureDevice.hpp"
+
+namespace capture_renderer
+{
+	CommandPool::CommandPool( Device const & device
+		, renderer::CommandPoolPtr && inner )
+		: CommandPool{ device, *inner }
+	{
+		m_ownInner = std::move( inner );
+	}
+
+	CommandPool::CommandPool( Device const & device
+		, renderer::CommandPool const & inner )
+		: renderer::CommandPool{ device, 0u }
+		, Object{ device.getWriter() }
+		, m_inner{ inner }
+	{
+	}
+
+	renderer::CommandBufferPtr CommandPool::createCommandBuffer( bool primary )const
+	{
+		auto result = std::make_unique< CommandBuffer >( static_cast< Device const & >( m_device )
+			, *this
+			, m_inner.createCommandBuffer( primary )
+			, primary );
+		m_writer.writeChunk( ChunkType::eCreateCommandBuffer
+			, result->getObjectId()
+			, getObjectId()
+			, primary );
+		return result;
+	}
+}
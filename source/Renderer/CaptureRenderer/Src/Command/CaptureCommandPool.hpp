@@ -0,0 +1,83 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "Miscellaneous/CaptureObject.hpp"
+
+#include <Command/CommandPool.hpp>
+
+namespace capture_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Pool de tampons de commandes enveloppant celui du renderer capturé.
+	*\~english
+	*\brief
+	*	Command buffers pool wrapping the captured renderer's one.
+	*/
+	class CommandPool
+		: public renderer::CommandPool
+		, public Object
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] inner
+		*	Le pool capturé.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] inner
+		*	The captured pool.
+		*/
+		CommandPool( Device const & device
+			, renderer::CommandPoolPtr && inner );
+		/**
+		*\~french
+		*\brief
+		*	Constructeur, pour un pool capturé possédé par le périphérique capturé.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] inner
+		*	Le pool capturé.
+		*\~english
+		*\brief
+		*	Constructor, for a captured pool owned by the captured device.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] inner
+		*	The captured pool.
+		*/
+		CommandPool( Device const & device
+			, renderer::CommandPool const & inner );
+		/**
+		*\copydoc	renderer::CommandPool::createCommandBuffer
+		*/
+		renderer::CommandBufferPtr createCommandBuffer( bool primary )const override;
+		/**
+		*\~french
+		*\return
+		*	Le pool capturé.
+		*\~english
+		*\return
+		*	The captured pool.
+		*/
+		inline renderer::CommandPool const & getInner()const
+		{
+			return m_inner;
+		}
+
+	private:
+		renderer::CommandPoolPtr m_ownInner;
+		renderer::CommandPool const & m_inner;
+	};
+}
@@ -0,0 +1,88 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Command/CaptureQueue.hpp"
+
+#include "Command/CaptureCommandBuffer.hpp"
+#include "Core/CaptureDevice.hpp"
+#include "Core/CaptureSwapChain.hpp"
+#include "Sync/CaptureFence.hpp"
+#include "Sync/CaptureSemaphore.hpp"
+
+namespace capture_renderer
+{
+	namespace
+	{
+		renderer::SemaphoreCRefArray unwrapSemaphores( renderer::SemaphoreCRefArray const & semaphores )
+		{
+			renderer::SemaphoreCRefArray result;
+
+			for ( auto & semaphore : semaphores )
+			{
+				result.emplace_back( unwrap< Semaphore >( semaphore.get() ) );
+			}
+
+			return result;
+		}
+	}
+
+	Queue::Queue( Device const & device
+		, renderer::Queue const & inner
+		, uint32_t index )
+		: m_device{ device }
+		, m_inner{ inner }
+		, m_index{ index }
+	{
+	}
+
+	bool Queue::submit( renderer::CommandBufferCRefArray const & commandBuffers
+		, renderer::SemaphoreCRefArray const & semaphoresToWait
+		, renderer::PipelineStageFlagsArray const & semaphoresStage
+		, renderer::SemaphoreCRefArray const & semaphoresToSignal
+		, renderer::Fence const * fence )const
+	{
+		renderer::CommandBufferCRefArray innerCommandBuffers;
+		std::vector< ObjectId > ids;
+
+		for ( auto & commandBuffer : commandBuffers )
+		{
+			innerCommandBuffers.emplace_back( unwrap< CommandBuffer >( commandBuffer.get() ) );
+			ids.push_back( capture_renderer::getObjectId( commandBuffer.get() ) );
+		}
+
+		m_device.getWriter().writeChunk( ChunkType::eSubmit
+			, m_index
+			, ids );
+		return m_inner.submit( innerCommandBuffers
+			, unwrapSemaphores( semaphoresToWait )
+			, semaphoresStage
+			, unwrapSemaphores( semaphoresToSignal )
+			, fence
+				? &unwrap< Fence >( *fence )
+				: nullptr );
+	}
+
+	bool Queue::present( renderer::SwapChainCRefArray const & swapChains
+		, renderer::UInt32Array const & imagesIndex
+		, renderer::SemaphoreCRefArray const & semaphoresToWait )const
+	{
+		renderer::SwapChainCRefArray innerSwapChains;
+
+		for ( auto & swapChain : swapChains )
+		{
+			innerSwapChains.emplace_back( unwrap< SwapChain >( swapChain.get() ) );
+		}
+
+		auto result = m_inner.present( innerSwapChains
+			, imagesIndex
+			, unwrapSemaphores( semaphoresToWait ) );
+		m_device.getWriter().endFrame();
+		return result;
+	}
+
+	bool Queue::waitIdle()const
+	{
+		return m_inner.waitIdle();
+	}
+}
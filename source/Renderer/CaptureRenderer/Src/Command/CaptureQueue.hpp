@@ -0,0 +1,85 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "CaptureRendererPrerequisites.hpp"
+
+#include <Command/Queue.hpp>
+
+namespace capture_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	File enveloppant celle du renderer capturé.
+	*\remarks
+	*	Les soumissions sont enregistrées, la présentation termine la frame de la capture.
+	*	Les sémaphores et barrières ne sont pas enregistrés, le Player synchronisant chaque frame.
+	*\~english
+	*\brief
+	*	Queue wrapping the captured renderer's one.
+	*\remarks
+	*	The submissions are recorded, the presentation ends the capture's frame.
+	*	The semaphores and fences aren't recorded, the Player synchronising each frame.
+	*/
+	class Queue
+		: public renderer::Queue
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] inner
+		*	La file capturée.
+		*\param[in] index
+		*	L'indice de la file, dans les chunks ChunkType::eSubmit.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] inner
+		*	The captured queue.
+		*\param[in] index
+		*	The queue index, in the ChunkType::eSubmit chunks.
+		*/
+		Queue( Device const & device
+			, renderer::Queue const & inner
+			, uint32_t index );
+		/**
+		*\copydoc	renderer::Queue::submit
+		*/
+		bool submit( renderer::CommandBufferCRefArray const & commandBuffers
+			, renderer::SemaphoreCRefArray const & semaphoresToWait
+			, renderer::PipelineStageFlagsArray const & semaphoresStage
+			, renderer::SemaphoreCRefArray const & semaphoresToSignal
+			, renderer::Fence const * fence )const override;
+		/**
+		*\copydoc	renderer::Queue::present
+		*/
+		bool present( renderer::SwapChainCRefArray const & swapChains
+			, renderer::UInt32Array const & imagesIndex
+			, renderer::SemaphoreCRefArray const & semaphoresToWait )const override;
+		/**
+		*\copydoc	renderer::Queue::waitIdle
+		*/
+		bool waitIdle()const override;
+		/**
+		*\copydoc	renderer::Queue::getFamilyIndex
+		*/
+		inline uint32_t getFamilyIndex()const override
+		{
+			return m_inner.getFamilyIndex();
+		}
+
+	private:
+		Device const & m_device;
+		renderer::Queue const & m_inner;
+		uint32_t m_index;
+	};
+}
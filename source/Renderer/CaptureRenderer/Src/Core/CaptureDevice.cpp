@@ -0,0 +1,386 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Core/CaptureDevice.hpp"
+
+#include "Buffer/CaptureBuffer.hpp"
+#include "Buffer/CaptureBufferView.hpp"
+#include "Buffer/CaptureUniformBuffer.hpp"
+#include "Command/CaptureCommandPool.hpp"
+#include "Command/CaptureQueue.hpp"
+#include "Core/CaptureSwapChain.hpp"
+#include "Descriptor/CaptureDescriptorSetLayout.hpp"
+#include "Image/CaptureSampler.hpp"
+#include "Image/CaptureTexture.hpp"
+#include "Miscellaneous/CaptureQueryPool.hpp"
+#include "Pipeline/CapturePipelineLayout.hpp"
+#include "RenderPass/CaptureRenderPass.hpp"
+#include "RenderPass/CaptureRenderSubpass.hpp"
+#include "Shader/CaptureShaderModule.hpp"
+#include "Sync/CaptureFence.hpp"
+#include "Sync/CaptureSemaphore.hpp"
+
+#include <Core/Renderer.hpp>
+#include <Descriptor/DescriptorSetLayoutBinding.hpp>
+#include <Miscellaneous/PushConstantRange.hpp>
+
+namespace capture_renderer
+{
+	Device::Device( renderer::Renderer const & renderer
+		, renderer::DevicePtr && inner
+		, renderer::Connection const & connection
+		, CaptureOptions const & options )
+		: renderer::Device{ renderer, inner->getPhysicalDevice(), connection }
+		, m_writer{ std::make_unique< Writer >( options, renderer.getName() ) }
+		, m_inner{ std::move( inner ) }
+	{
+		m_timestampPeriod = m_inner->getTimestampPeriod();
+		m_presentQueue = std::make_unique< Queue >( *this, m_inner->getPresentQueue(), PresentQueueIndex );
+		m_computeQueue = std::make_unique< Queue >( *this, m_inner->getComputeQueue(), ComputeQueueIndex );
+		m_graphicsQueue = std::make_unique< Queue >( *this, m_inner->getGraphicsQueue(), GraphicsQueueIndex );
+		m_presentCommandPool = std::make_unique< CommandPool >( *this, m_inner->getPresentCommandPool() );
+		m_computeCommandPool = std::make_unique< CommandPool >( *this, m_inner->getComputeCommandPool() );
+		m_graphicsCommandPool = std::make_unique< CommandPool >( *this, m_inner->getGraphicsCommandPool() );
+		doRegisterCommandPool( *m_presentCommandPool, m_presentQueue->getFamilyIndex(), 0u );
+		doRegisterCommandPool( *m_computeCommandPool, m_computeQueue->getFamilyIndex(), 0u );
+		doRegisterCommandPool( *m_graphicsCommandPool, m_graphicsQueue->getFamilyIndex(), 0u );
+	}
+
+	Device::~Device()
+	{
+		// The default command pools record their destruction.
+		m_presentCommandPool.reset();
+		m_computeCommandPool.reset();
+		m_graphicsCommandPool.reset();
+	}
+
+	renderer::RenderPassPtr Device::createRenderPass( renderer::RenderPassAttachmentArray const & attaches
+		, renderer::RenderSubpassPtrArray && subpasses
+		, renderer::RenderSubpassState const & initialState
+		, renderer::RenderSubpassState const & finalState )const
+	{
+		renderer::RenderSubpassPtrArray innerSubpasses;
+		OutputStream stream;
+
+		for ( auto & subpass : subpasses )
+		{
+			auto & capture = static_cast< RenderSubpass & >( *subpass );
+			capture.write( stream );
+			innerSubpasses.push_back( capture.releaseInner() );
+		}
+
+		auto result = std::make_unique< RenderPass >( *this
+			, m_inner->createRenderPass( attaches
+				, std::move( innerSubpasses )
+				, initialState
+				, finalState )
+			, attaches
+			, std::move( subpasses )
+			, initialState
+			, finalState );
+		m_writer->writeChunk( ChunkType::eCreateRenderPass
+			, result->getObjectId()
+			, attaches
+			, stream.getData()
+			, initialState
+			, finalState );
+		return result;
+	}
+
+	renderer::RenderSubpassPtr Device::createRenderSubpass( renderer::PipelineBindPoint pipelineBindPoint
+		, renderer::RenderSubpassState const & state
+		, renderer::RenderSubpassAttachmentArray const & inputAttaches
+		, renderer::RenderSubpassAttachmentArray const & colourAttaches
+		, renderer::RenderSubpassAttachmentArray const & resolveAttaches
+		, renderer::RenderSubpassAttachment const * depthAttach
+		, renderer::UInt32Array const & preserveAttaches )const
+	{
+		return std::make_unique< RenderSubpass >( *this
+			, m_inner->createRenderSubpass( pipelineBindPoint
+				, state
+				, inputAttaches
+				, colourAttaches
+				, resolveAttaches
+				, depthAttach
+				, preserveAttaches )
+			, pipelineBindPoint
+			, state
+			, inputAttaches
+			, colourAttaches
+			, resolveAttaches
+			, depthAttach
+			, preserveAttaches );
+	}
+
+	renderer::PipelineLayoutPtr Device::createPipelineLayout( renderer::DescriptorSetLayoutCRefArray const & setLayouts
+		, renderer::PushConstantRangeCRefArray const & pushConstantRanges )const
+	{
+		renderer::DescriptorSetLayoutCRefArray innerLayouts;
+		std::vector< ObjectId > layoutIds;
+		std::vector< renderer::PushConstantRange > ranges;
+
+		for ( auto & layout : setLayouts )
+		{
+			innerLayouts.emplace_back( unwrap< DescriptorSetLayout >( layout.get() ) );
+			layoutIds.push_back( capture_renderer::getObjectId( layout.get() ) );
+		}
+
+		for ( auto & range : pushConstantRanges )
+		{
+			ranges.push_back( range.get() );
+		}
+
+		auto result = std::make_unique< PipelineLayout >( *this
+			, m_inner->createPipelineLayout( innerLayouts, pushConstantRanges )
+			, setLayouts
+			, pushConstantRanges );
+		m_writer->writeChunk( ChunkType::eCreatePipelineLayout
+			, result->getObjectId()
+			, layoutIds
+			, ranges );
+		return result;
+	}
+
+	renderer::DescriptorSetLayoutPtr Device::createDescriptorSetLayout( renderer::DescriptorSetLayoutBindingArray && bindings )const
+	{
+		auto innerBindings = bindings;
+		auto result = std::make_unique< DescriptorSetLayout >( *this
+			, m_inner->createDescriptorSetLayout( std::move( innerBindings ) )
+			, std::move( bindings ) );
+		m_writer->writeChunk( ChunkType::eCreateDescriptorSetLayout
+			, result->getObjectId()
+			, result->getBindings() );
+		return result;
+	}
+
+	renderer::TexturePtr Device::createTexture( renderer::ImageLayout initialLayout )const
+	{
+		auto result = std::make_shared< Texture >( *this
+			, m_inner->createTexture( initialLayout ) );
+		m_writer->writeChunk( ChunkType::eCreateTexture
+			, result->getObjectId()
+			, initialLayout );
+		return result;
+	}
+
+	renderer::SamplerPtr Device::createSampler( renderer::WrapMode wrapS
+		, renderer::WrapMode wrapT
+		, renderer::WrapMode wrapR
+		, renderer::Filter minFilter
+		, renderer::Filter magFilter
+		, renderer::MipmapMode mipFilter
+		, float minLod
+		, float maxLod
+		, float lodBias
+		, renderer::BorderColour borderColour
+		, float maxAnisotropy
+		, renderer::CompareOp compareOp )const
+	{
+		auto result = std::make_shared< Sampler >( *this
+			, m_inner->createSampler( wrapS
+				, wrapT
+				, wrapR
+				, minFilter
+				, magFilter
+				, mipFilter
+				, minLod
+				, maxLod
+				, lodBias
+				, borderColour
+				, maxAnisotropy
+				, compareOp ) );
+		m_writer->writeChunk( ChunkType::eCreateSampler
+			, result->getObjectId()
+			, wrapS
+			, wrapT
+			, wrapR
+			, minFilter
+			, magFilter
+			, mipFilter
+			, minLod
+			, maxLod
+			, lodBias
+			, borderColour
+			, maxAnisotropy
+			, compareOp );
+		return result;
+	}
+
+	renderer::BufferBasePtr Device::createBuffer( uint32_t size
+		, renderer::BufferTargets target
+		, renderer::MemoryPropertyFlags memoryFlags )const
+	{
+		auto result = std::make_unique< Buffer >( *this
+			, m_inner->createBuffer( size
+				, target
+				, memoryFlags ) );
+		m_writer->writeChunk( ChunkType::eCreateBuffer
+			, result->getObjectId()
+			, size
+			, target
+			, memoryFlags );
+		return result;
+	}
+
+	renderer::BufferViewPtr Device::createBufferView( renderer::BufferBase const & buffer
+		, renderer::PixelFormat format
+		, uint32_t offset
+		, uint32_t range )const
+	{
+		auto result = std::make_unique< BufferView >( *this
+			, m_inner->createBufferView( unwrap< Buffer >( buffer )
+				, format
+				, offset
+				, range )
+			, buffer );
+		m_writer->writeChunk( ChunkType::eCreateBufferView
+			, result->getObjectId()
+			, capture_renderer::getObjectId( buffer )
+			, format
+			, offset
+			, range );
+		return result;
+	}
+
+	renderer::UniformBufferBasePtr Device::createUniformBuffer( uint32_t count
+		, uint32_t size
+		, renderer::BufferTargets target
+		, renderer::MemoryPropertyFlags memoryFlags )const
+	{
+		auto result = std::make_unique< UniformBuffer >( *this
+			, m_inner->createUniformBuffer( count
+				, size
+				, target
+				, memoryFlags )
+			, count
+			, size
+			, target
+			, memoryFlags );
+		m_writer->writeChunk( ChunkType::eCreateUniformBuffer
+			, result->getObjectId()
+			, capture_renderer::getObjectId( result->getBuffer() )
+			, count
+			, size
+			, target
+			, memoryFlags );
+		return result;
+	}
+
+	renderer::SwapChainPtr Device::createSwapChain( renderer::UIVec2 const & size )const
+	{
+		auto result = std::make_unique< SwapChain >( *this
+			, m_inner->createSwapChain( size ) );
+		m_writer->writeChunk( ChunkType::eCreateSwapChain
+			, result->getObjectId()
+			, result->getDimensions()
+			, result->getFormat() );
+		return result;
+	}
+
+	renderer::SemaphorePtr Device::createSemaphore()const
+	{
+		return std::make_unique< Semaphore >( *this
+			, m_inner->createSemaphore() );
+	}
+
+	renderer::FencePtr Device::createFence( renderer::FenceCreateFlags flags )const
+	{
+		return std::make_unique< Fence >( *this
+			, m_inner->createFence( flags )
+			, flags );
+	}
+
+	renderer::CommandPoolPtr Device::createCommandPool( uint32_t queueFamilyIndex
+		, renderer::CommandPoolCreateFlags const & flags )const
+	{
+		auto result = std::make_unique< CommandPool >( *this
+			, m_inner->createCommandPool( queueFamilyIndex
+				, flags ) );
+		doRegisterCommandPool( *result, queueFamilyIndex, flags );
+		return result;
+	}
+
+	renderer::ShaderModulePtr Device::createShaderModule( renderer::ShaderStageFlag stage )const
+	{
+		auto result = std::make_unique< ShaderModule >( *this
+			, m_inner->createShaderModule( stage )
+			, stage );
+		m_writer->writeChunk( ChunkType::eCreateShaderModule
+			, result->getObjectId()
+			, stage );
+		return result;
+	}
+
+	renderer::QueryPoolPtr Device::createQueryPool( renderer::QueryType type
+		, uint32_t count
+		, renderer::QueryPipelineStatisticFlags pipelineStatistics )const
+	{
+		auto result = std::make_unique< QueryPool >( *this
+			, m_inner->createQueryPool( type
+				, count
+				, pipelineStatistics )
+			, type
+			, count
+			, pipelineStatistics );
+		m_writer->writeChunk( ChunkType::eCreateQueryPool
+			, result->getObjectId()
+			, type
+			, count
+			, pipelineStatistics );
+		return result;
+	}
+
+	void Device::waitIdle()const
+	{
+		m_inner->waitIdle();
+	}
+
+	renderer::Mat4 Device::frustum( float left
+		, float right
+		, float bottom
+		, float top
+		, float zNear
+		, float zFar )const
+	{
+		return m_inner->frustum( left, right, bottom, top, zNear, zFar );
+	}
+
+	renderer::Mat4 Device::perspective( renderer::Angle fovy
+		, float aspect
+		, float zNear
+		, float zFar )const
+	{
+		return m_inner->perspective( fovy, aspect, zNear, zFar );
+	}
+
+	renderer::Mat4 Device::ortho( float left
+		, float right
+		, float bottom
+		, float top
+		, float zNear
+		, float zFar )const
+	{
+		return m_inner->ortho( left, right, bottom, top, zNear, zFar );
+	}
+
+	void Device::doRegisterCommandPool( renderer::CommandPool const & pool
+		, uint32_t queueFamilyIndex
+		, renderer::CommandPoolCreateFlags flags )const
+	{
+		m_writer->writeChunk( ChunkType::eCreateCommandPool
+			, capture_renderer::getObjectId( pool )
+			, queueFamilyIndex
+			, flags );
+	}
+
+	void Device::doEnable()const
+	{
+		m_inner->enable();
+	}
+
+	void Device::doDisable()const
+	{
+		m_inner->disable();
+	}
+}
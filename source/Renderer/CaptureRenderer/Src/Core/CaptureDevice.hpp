@@ -0,0 +1,230 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "Miscellaneous/CaptureWriter.hpp"
+
+#include <Core/Connection.hpp>
+#include <Core/Device.hpp>
+
+namespace capture_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Périphérique enveloppant celui du renderer capturé.
+	*\remarks
+	*	Il possède l'écrivain de la capture, et enveloppe chaque objet qu'il crée.
+	*\~english
+	*\brief
+	*	Device wrapping the captured renderer's one.
+	*\remarks
+	*	It owns the capture writer, and wraps each object it creates.
+	*/
+	class Device
+		: public renderer::Device
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] renderer
+		*	L'instance de Renderer.
+		*\param[in] inner
+		*	Le périphérique capturé.
+		*\param[in] connection
+		*	La connection à l'application, possédée par le périphérique capturé.
+		*\param[in] options
+		*	Les options de la capture.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] renderer
+		*	The Renderer instance.
+		*\param[in] inner
+		*	The captured device.
+		*\param[in] connection
+		*	The connection to the application, owned by the captured device.
+		*\param[in] options
+		*	The capture options.
+		*/
+		Device( renderer::Renderer const & renderer
+			, renderer::DevicePtr && inner
+			, renderer::Connection const & connection
+			, CaptureOptions const & options );
+		/**
+		*\~french
+		*\brief
+		*	Destructeur.
+		*\~english
+		*\brief
+		*	Destructor.
+		*/
+		~Device();
+		/**
+		*\copydoc	renderer::Device::createRenderPass
+		*/
+		renderer::RenderPassPtr createRenderPass( renderer::RenderPassAttachmentArray const & attaches
+			, renderer::RenderSubpassPtrArray && subpasses
+			, renderer::RenderSubpassState const & initialState
+			, renderer::RenderSubpassState const & finalState )const override;
+		/**
+		*\copydoc	renderer::Device::createRenderSubpass
+		*/
+		renderer::RenderSubpassPtr createRenderSubpass( renderer::PipelineBindPoint pipelineBindPoint
+			, renderer::RenderSubpassState const & state
+			, renderer::RenderSubpassAttachmentArray const & inputAttaches
+			, renderer::RenderSubpassAttachmentArray const & colourAttaches
+			, renderer::RenderSubpassAttachmentArray const & resolveAttaches
+			, renderer::RenderSubpassAttachment const * depthAttach
+			, renderer::UInt32Array const & preserveAttaches )const override;
+		/**
+		*\copydoc	renderer::Device::createPipelineLayout
+		*/
+		renderer::PipelineLayoutPtr createPipelineLayout( renderer::DescriptorSetLayoutCRefArray const & setLayouts
+			, renderer::PushConstantRangeCRefArray const & pushConstantRanges )const override;
+		/**
+		*\copydoc	renderer::Device::createDescriptorSetLayout
+		*/
+		renderer::DescriptorSetLayoutPtr createDescriptorSetLayout( renderer::DescriptorSetLayoutBindingArray && bindings )const override;
+		/**
+		*\copydoc	renderer::Device::createTexture
+		*/
+		renderer::TexturePtr createTexture( renderer::ImageLayout initialLayout )const override;
+		/**
+		*\copydoc	renderer::Device::createSampler
+		*/
+		renderer::SamplerPtr createSampler( renderer::WrapMode wrapS
+			, renderer::WrapMode wrapT
+			, renderer::WrapMode wrapR
+			, renderer::Filter minFilter
+			, renderer::Filter magFilter
+			, renderer::MipmapMode mipFilter
+			, float minLod
+			, float maxLod
+			, float lodBias
+			, renderer::BorderColour borderColour
+			, float maxAnisotropy
+			, renderer::CompareOp compareOp )const override;
+		/**
+		*\copydoc	renderer::Device::createBuffer
+		*/
+		renderer::BufferBasePtr createBuffer( uint32_t size
+			, renderer::BufferTargets target
+			, renderer::MemoryPropertyFlags memoryFlags )const override;
+		/**
+		*\copydoc	renderer::Device::createBufferView
+		*/
+		renderer::BufferViewPtr createBufferView( renderer::BufferBase const & buffer
+			, renderer::PixelFormat format
+			, uint32_t offset
+			, uint32_t range )const override;
+		/**
+		*\copydoc	renderer::Device::createUniformBuffer
+		*/
+		renderer::UniformBufferBasePtr createUniformBuffer( uint32_t count
+			, uint32_t size
+			, renderer::BufferTargets target
+			, renderer::MemoryPropertyFlags memoryFlags )const override;
+		/**
+		*\copydoc	renderer::Device::createSwapChain
+		*/
+		renderer::SwapChainPtr createSwapChain( renderer::UIVec2 const & size )const override;
+		/**
+		*\copydoc	renderer::Device::createSemaphore
+		*/
+		renderer::SemaphorePtr createSemaphore()const override;
+		/**
+		*\copydoc	renderer::Device::createFence
+		*/
+		renderer::FencePtr createFence( renderer::FenceCreateFlags flags )const override;
+		/**
+		*\copydoc	renderer::Device::createCommandPool
+		*/
+		renderer::CommandPoolPtr createCommandPool( uint32_t queueFamilyIndex
+			, renderer::CommandPoolCreateFlags const & flags )const override;
+		/**
+		*\copydoc	renderer::Device::createShaderModule
+		*/
+		renderer::ShaderModulePtr createShaderModule( renderer::ShaderStageFlag stage )const override;
+		/**
+		*\copydoc	renderer::Device::createQueryPool
+		*/
+		renderer::QueryPoolPtr createQueryPool( renderer::QueryType type
+			, uint32_t count
+			, renderer::QueryPipelineStatisticFlags pipelineStatistics )const override;
+		/**
+		*\copydoc	renderer::Device::waitIdle
+		*/
+		void waitIdle()const override;
+		/**
+		*\copydoc	renderer::Device::frustum
+		*/
+		renderer::Mat4 frustum( float left
+			, float right
+			, float bottom
+			, float top
+			, float zNear
+			, float zFar )const override;
+		/**
+		*\copydoc	renderer::Device::perspective
+		*/
+		renderer::Mat4 perspective( renderer::Angle fovy
+			, float aspect
+			, float zNear
+			, float zFar )const override;
+		/**
+		*\copydoc	renderer::Device::ortho
+		*/
+		renderer::Mat4 ortho( float left
+			, float right
+			, float bottom
+			, float top
+			, float zNear
+			, float zFar )const override;
+		/**
+		*\~french
+		*\return
+		*	L'écrivain de la capture.
+		*\~english
+		*\return
+		*	The capture writer.
+		*/
+		inline Writer & getWriter()const
+		{
+			return *m_writer;
+		}
+		/**
+		*\~french
+		*\return
+		*	Le périphérique capturé.
+		*\~english
+		*\return
+		*	The captured device.
+		*/
+		inline renderer::Device const & getInner()const
+		{
+			return *m_inner;
+		}
+
+	private:
+		void doRegisterCommandPool( renderer::CommandPool const & pool
+			, uint32_t queueFamilyIndex
+			, renderer::CommandPoolCreateFlags flags )const;
+		/**
+		*\copydoc	renderer::Device::doEnable
+		*/
+		void doEnable()const override;
+		/**
+		*\copydoc	renderer::Device::doDisable
+		*/
+		void doDisable()const override;
+
+	private:
+		std::unique_ptr< Writer > m_writer;
+		renderer::DevicePtr m_inner;
+	};
+}
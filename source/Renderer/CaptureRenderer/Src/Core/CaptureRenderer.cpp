@@ -0,0 +1,34 @@
+#include "Core/CaptureRenderer.hpp"
+
+#include "Core/CaptureDevice.hpp"
+
+#include <Core/Connection.hpp>
+
+namespace capture_renderer
+{
+	Renderer::Renderer( renderer::RendererPtr && inner
+		, Configuration const & configuration
+		, CaptureOptions const & options )
+		: renderer::Renderer{ inner->getClipDirection(), inner->getName(), configuration }
+		, m_inner{ std::move( inner ) }
+		, m_options{ options }
+	{
+	}
+
+	renderer::DevicePtr Renderer::createDevice( renderer::ConnectionPtr && connection )const
+	{
+		auto & innerConnection = *connection;
+		auto inner = m_inner->createDevice( std::move( connection ) );
+		return std::make_unique< Device >( *this
+			, std::move( inner )
+			, innerConnection
+			, m_options );
+	}
+
+	renderer::ConnectionPtr Renderer::createConnection( uint32_t deviceIndex
+		, renderer::WindowHandle && handle )const
+	{
+		return m_inner->createConnection( deviceIndex
+			, std::move( handle ) );
+	}
+}
@@ -0,0 +1,70 @@
+/**
+*\file
+*	CaptureRenderer.h
+*\author
+*	Sylvain Doremus
+*/
+#pragma once
+
+#include "Miscellaneous/CaptureWriter.hpp"
+
+#include <Core/Renderer.hpp>
+
+namespace capture_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Renderer enveloppant un autre renderer, pour enregistrer les appels faits à ses objets.
+	*\remarks
+	*	La création des ressources, les données envoyées et les tampons de commandes enregistrés
+	*	sont écrits dans un fichier, que le Player peut rejouer sur n'importe quel renderer.
+	*\~english
+	*\brief
+	*	Renderer wrapping another renderer, to record the calls made to its objects.
+	*\remarks
+	*	The resources creation, the uploaded data and the recorded command buffers
+	*	are written into a file, which the Player can replay on any renderer.
+	*/
+	class Renderer
+		: public renderer::Renderer
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] inner
+		*	Le renderer capturé.
+		*\param[in] configuration
+		*	La configuration de création.
+		*\param[in] options
+		*	Les options de la capture.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] inner
+		*	The captured renderer.
+		*\param[in] configuration
+		*	The creation options.
+		*\param[in] options
+		*	The capture options.
+		*/
+		Renderer( renderer::RendererPtr && inner
+			, Configuration const & configuration
+			, CaptureOptions const & options );
+		/**
+		*\copydoc	renderer::Renderer::createDevice
+		*/
+		renderer::DevicePtr createDevice( renderer::ConnectionPtr && connection )const override;
+		/**
+		*\copydoc	renderer::Renderer::createConnection
+		*/
+		renderer::ConnectionPtr createConnection( uint32_t deviceIndex
+			, renderer::WindowHandle && handle )const override;
+
+	private:
+		renderer::RendererPtr m_inner;
+		CaptureOptions m_options;
+	};
+}
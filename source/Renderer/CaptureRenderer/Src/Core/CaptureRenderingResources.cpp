@@ -0,0 +1,42 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Core/CaptureRenderingResources.hpp"
+
+#include "Command/CaptureCommandBuffer.hpp"
+#include "Command/CaptureCommandPool.hpp"
+#include "Core/CaptureDevice.hpp"
+#include "Sync/CaptureFence.hpp"
+#include "Sync/CaptureSemaphore.hpp"
+
+namespace capture_renderer
+{
+	RenderingResources::RenderingResources( Device const & device
+		, renderer::RenderingResources & inner )
+		: renderer::RenderingResources{ device }
+		, m_inner{ inner }
+	{
+		auto & pool = static_cast< CommandPool const & >( device.getGraphicsCommandPool() );
+		auto commandBuffer = std::make_unique< CommandBuffer >( device
+			, pool
+			, m_inner.getCommandBuffer() );
+		device.getWriter().writeChunk( ChunkType::eCreateCommandBuffer
+			, commandBuffer->getObjectId()
+			, pool.getObjectId()
+			, true );
+		m_commandBuffer = std::move( commandBuffer );
+		m_imageAvailableSemaphore = std::make_unique< Semaphore >( device
+			, m_inner.getImageAvailableSemaphore() );
+		m_finishedRenderingSemaphore = std::make_unique< Semaphore >( device
+			, m_inner.getRenderingFinishedSemaphore() );
+		m_fence = std::make_unique< Fence >( device
+			, m_inner.getFence() );
+		m_backBuffer = m_inner.getBackBuffer();
+	}
+
+	bool RenderingResources::waitRecord( uint32_t timeout )
+	{
+		return m_inner.waitRecord( timeout );
+	}
+}
@@ -0,0 +1,67 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "CaptureRendererPrerequisites.hpp"
+
+#include <Core/RenderingResources.hpp>
+
+namespace capture_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Ressources de rendu enveloppant celles d'une swap chain capturée.
+	*\remarks
+	*	Ses objets enveloppent ceux des ressources capturées, sans les posséder.
+	*\~english
+	*\brief
+	*	Rendering resources wrapping a captured swap chain's ones.
+	*\remarks
+	*	Its objects wrap the captured resources' ones, without owning them.
+	*/
+	class RenderingResources
+		: public renderer::RenderingResources
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] inner
+		*	Les ressources capturées.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] inner
+		*	The captured resources.
+		*/
+		RenderingResources( Device const & device
+			, renderer::RenderingResources & inner );
+		/**
+		*\copydoc	renderer::RenderingResources::waitRecord
+		*/
+		bool waitRecord( uint32_t timeout )override;
+		/**
+		*\~french
+		*\return
+		*	Les ressources capturées.
+		*\~english
+		*\return
+		*	The captured resources.
+		*/
+		inline renderer::RenderingResources & getInner()const
+		{
+			return m_inner;
+		}
+
+	private:
+		renderer::RenderingResources & m_inner;
+	};
+}
@@ -0,0 +1,155 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Core/CaptureSwapChain.hpp"
+
+#include "Command/CaptureCommandBuffer.hpp"
+#include "Command/CaptureCommandPool.hpp"
+#include "Core/CaptureDevice.hpp"
+#include "Core/CaptureRenderingResources.hpp"
+#include "Image/CaptureTexture.hpp"
+#include "Image/CaptureTextureView.hpp"
+#include "RenderPass/CaptureFrameBuffer.hpp"
+#include "RenderPass/CaptureRenderPass.hpp"
+
+#include <RenderPass/FrameBufferAttachment.hpp>
+
+namespace capture_renderer
+{
+	SwapChain::SwapChain( Device const & device
+		, renderer::SwapChainPtr && inner )
+		: renderer::SwapChain{ device, inner->getDimensions() }
+		, Object{ device.getWriter() }
+		, m_device{ device }
+		, m_inner{ std::move( inner ) }
+		, m_innerReset{ m_inner->onReset.connect( [this]()
+			{
+				m_dimensions = m_inner->getDimensions();
+				onReset();
+			} ) }
+	{
+		// The default resources are the captured swap chain's first ones.
+		auto & defaultResources = const_cast< renderer::RenderingResources & >( m_inner->getDefaultResources() );
+		m_renderingResources.push_back( std::make_unique< RenderingResources >( device
+			, defaultResources ) );
+	}
+
+	void SwapChain::reset( renderer::UIVec2 const & size )
+	{
+		m_inner->reset( size );
+	}
+
+	renderer::FrameBufferPtrArray SwapChain::createFrameBuffers( renderer::RenderPass const & renderPass )const
+	{
+		auto & innerRenderPass = unwrap< RenderPass >( renderPass );
+		auto innerFrameBuffers = m_inner->createFrameBuffers( innerRenderPass );
+		renderer::FrameBufferPtrArray result;
+		OutputStream stream;
+		stream.write( getObjectId() );
+		stream.write( capture_renderer::getObjectId( renderPass ) );
+		stream.write( uint32_t( innerFrameBuffers.size() ) );
+
+		for ( auto & innerFrameBuffer : innerFrameBuffers )
+		{
+			std::vector< renderer::TexturePtr > textures;
+			std::vector< renderer::TextureViewPtr > views;
+			renderer::FrameBufferAttachmentArray attaches;
+			OutputStream attachesStream;
+
+			for ( auto & attach : *innerFrameBuffer )
+			{
+				auto index = size_t( &attach.getAttachment() - innerRenderPass.getAttaches().data() );
+				auto texture = std::make_shared< Texture >( m_device
+					, attach.getTexture() );
+				auto view = std::make_shared< TextureView >( m_device
+					, *texture
+					, attach.getView() );
+				attaches.emplace_back( renderPass.getAttaches()[index], *view );
+				attachesStream.write( uint32_t( index ) );
+				attachesStream.write( texture->getObjectId() );
+				attachesStream.write( view->getObjectId() );
+				attachesStream.write( view->getFormat() );
+				textures.push_back( std::move( texture ) );
+				views.push_back( std::move( view ) );
+			}
+
+			auto dimensions = innerFrameBuffer->getDimensions();
+			auto frameBuffer = std::make_unique< FrameBuffer >( m_device
+				, static_cast< RenderPass const & >( renderPass )
+				, dimensions
+				, std::move( attaches )
+				, std::move( innerFrameBuffer )
+				, std::move( textures )
+				, std::move( views ) );
+			stream.write( frameBuffer->getObjectId() );
+			stream.write( dimensions );
+			stream.write( uint32_t( frameBuffer->getSize() ) );
+			stream.writeBytes( attachesStream.getData().data(), attachesStream.getData().size() );
+			result.push_back( std::move( frameBuffer ) );
+		}
+
+		if ( m_writer.isCapturing() )
+		{
+			m_writer.write( ChunkType::eCreateSwapChainFrameBuffers, stream );
+		}
+
+		return result;
+	}
+
+	renderer::CommandBufferPtrArray SwapChain::createCommandBuffers()const
+	{
+		auto & pool = static_cast< CommandPool const & >( m_device.getGraphicsCommandPool() );
+		renderer::CommandBufferPtrArray result;
+
+		for ( auto & inner : m_inner->createCommandBuffers() )
+		{
+			auto commandBuffer = std::make_unique< CommandBuffer >( m_device
+				, pool
+				, std::move( inner )
+				, true );
+			m_writer.writeChunk( ChunkType::eCreateCommandBuffer
+				, commandBuffer->getObjectId()
+				, pool.getObjectId()
+				, true );
+			result.push_back( std::move( commandBuffer ) );
+		}
+
+		return result;
+	}
+
+	renderer::RenderingResources * SwapChain::getResources()
+	{
+		auto inner = m_inner->getResources();
+
+		if ( !inner )
+		{
+			return nullptr;
+		}
+
+		auto it = std::find_if( m_renderingResources.begin()
+			, m_renderingResources.end()
+			, [inner]( renderer::RenderingResourcesPtr const & lookup )
+			{
+				return &static_cast< RenderingResources & >( *lookup ).getInner() == inner;
+			} );
+
+		if ( it == m_renderingResources.end() )
+		{
+			m_renderingResources.push_back( std::make_unique< RenderingResources >( m_device
+				, *inner ) );
+			it = std::prev( m_renderingResources.end() );
+		}
+
+		( *it )->setBackBuffer( inner->getBackBuffer() );
+		return it->get();
+	}
+
+	void SwapChain::present( renderer::RenderingResources & resources )
+	{
+		auto & inner = static_cast< RenderingResources & >( resources ).getInner();
+		m_inner->present( inner );
+		resources.setBackBuffer( inner.getBackBuffer() );
+		m_writer.endFrame();
+	}
+}
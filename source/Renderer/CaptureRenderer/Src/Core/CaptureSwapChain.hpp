@@ -0,0 +1,125 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "Miscellaneous/CaptureObject.hpp"
+
+#include <Core/SwapChain.hpp>
+
+namespace capture_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Swap chain enveloppant celle du renderer capturé.
+	*\remarks
+	*	Ses images sont enveloppées par les tampons d'images qu'elle crée,
+	*	le Player les remplaçant par des textures hors écran.
+	*	La présentation termine la frame de la capture.
+	*\~english
+	*\brief
+	*	Swap chain wrapping the captured renderer's one.
+	*\remarks
+	*	Its images are wrapped by the frame buffers it creates,
+	*	the Player replacing them with offscreen textures.
+	*	The presentation ends the capture's frame.
+	*/
+	class SwapChain
+		: public renderer::SwapChain
+		, public Object
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] inner
+		*	La swap chain capturée.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] inner
+		*	The captured swap chain.
+		*/
+		SwapChain( Device const & device
+			, renderer::SwapChainPtr && inner );
+		/**
+		*\copydoc	renderer::SwapChain::reset
+		*/
+		void reset( renderer::UIVec2 const & size )override;
+		/**
+		*\copydoc	renderer::SwapChain::createFrameBuffers
+		*/
+		renderer::FrameBufferPtrArray createFrameBuffers( renderer::RenderPass const & renderPass )const override;
+		/**
+		*\copydoc	renderer::SwapChain::createCommandBuffers
+		*/
+		renderer::CommandBufferPtrArray createCommandBuffers()const override;
+		/**
+		*\copydoc	renderer::SwapChain::getResources
+		*/
+		renderer::RenderingResources * getResources()override;
+		/**
+		*\copydoc	renderer::SwapChain::present
+		*/
+		void present( renderer::RenderingResources & resources )override;
+		/**
+		*\copydoc	renderer::SwapChain::getOffscreenImage
+		*/
+		inline renderer::Texture const * getOffscreenImage()const override
+		{
+			return m_inner->getOffscreenImage();
+		}
+		/**
+		*\copydoc	renderer::SwapChain::setClearColour
+		*/
+		inline void setClearColour( renderer::RgbaColour const & value )override
+		{
+			m_inner->setClearColour( value );
+		}
+		/**
+		*\copydoc	renderer::SwapChain::getClearColour
+		*/
+		inline renderer::RgbaColour getClearColour()const override
+		{
+			return m_inner->getClearColour();
+		}
+		/**
+		*\copydoc	renderer::SwapChain::getDimensions
+		*/
+		inline renderer::UIVec2 getDimensions()const override
+		{
+			return m_inner->getDimensions();
+		}
+		/**
+		*\copydoc	renderer::SwapChain::getFormat
+		*/
+		inline renderer::PixelFormat getFormat()const override
+		{
+			return m_inner->getFormat();
+		}
+		/**
+		*\~french
+		*\return
+		*	La swap chain capturée.
+		*\~english
+		*\return
+		*	The captured swap chain.
+		*/
+		inline renderer::SwapChain const & getInner()const
+		{
+			return *m_inner;
+		}
+
+	private:
+		Device const & m_device;
+		renderer::SwapChainPtr m_inner;
+		renderer::SignalConnection< renderer::SwapChain::OnReset > m_innerReset;
+	};
+}
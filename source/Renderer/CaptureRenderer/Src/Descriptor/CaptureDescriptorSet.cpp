@@ -0,0 +1,298 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Descriptor/CaptureDescriptorSet.hpp"
+
+#include "Buffer/CaptureBuffer.hpp"
+#include "Buffer/CaptureBufferView.hpp"
+#include "Buffer/CaptureUniformBuffer.hpp"
+#include "Core/CaptureDevice.hpp"
+#include "Descriptor/CaptureDescriptorSetLayout.hpp"
+#include "Descriptor/CaptureDescriptorSetPool.hpp"
+#include "Image/CaptureSampler.hpp"
+#include "Image/CaptureTextureView.hpp"
+
+#include <Descriptor/DescriptorSetLayoutBinding.hpp>
+
+#include <algorithm>
+
+namespace capture_renderer
+{
+	DescriptorSet::DescriptorSet( Device const & device
+		, DescriptorSetPool const & pool
+		, renderer::DescriptorSetPtr && inner
+		, uint32_t bindingPoint )
+		: renderer::DescriptorSet{ pool, bindingPoint }
+		, Object{ device.getWriter() }
+		, m_inner{ std::move( inner ) }
+		, m_layout{ static_cast< DescriptorSetLayout const & >( pool.getLayout() ) }
+	{
+	}
+
+	renderer::CombinedTextureSamplerBinding const & DescriptorSet::createBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+		, renderer::TextureView const & view
+		, renderer::Sampler const & sampler
+		, renderer::ImageLayout layout
+		, uint32_t index )
+	{
+		auto bindingIndex = doGetBindingIndex( layoutBinding );
+		m_inner->createBinding( doGetInnerBinding( bindingIndex )
+			, unwrap< TextureView >( view )
+			, unwrap< Sampler >( sampler )
+			, layout
+			, index );
+		m_writer.writeChunk( ChunkType::eCreateBinding
+			, getObjectId()
+			, BindingType::eCombinedTextureSampler
+			, bindingIndex
+			, capture_renderer::getObjectId( view )
+			, capture_renderer::getObjectId( sampler )
+			, layout
+			, index );
+		return doCreateBinding< renderer::CombinedTextureSamplerBinding >( layoutBinding
+			, view
+			, sampler
+			, layout
+			, index );
+	}
+
+	renderer::SamplerBinding const & DescriptorSet::createBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+		, renderer::Sampler const & sampler
+		, uint32_t index )
+	{
+		auto bindingIndex = doGetBindingIndex( layoutBinding );
+		m_inner->createBinding( doGetInnerBinding( bindingIndex )
+			, unwrap< Sampler >( sampler )
+			, index );
+		m_writer.writeChunk( ChunkType::eCreateBinding
+			, getObjectId()
+			, BindingType::eSampler
+			, bindingIndex
+			, capture_renderer::getObjectId( sampler )
+			, index );
+		return doCreateBinding< renderer::SamplerBinding >( layoutBinding
+			, sampler
+			, index );
+	}
+
+	renderer::SampledTextureBinding const & DescriptorSet::createBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+		, renderer::TextureView const & view
+		, renderer::ImageLayout layout
+		, uint32_t index )
+	{
+		auto bindingIndex = doGetBindingIndex( layoutBinding );
+		m_inner->createBinding( doGetInnerBinding( bindingIndex )
+			, unwrap< TextureView >( view )
+			, layout
+			, index );
+		m_writer.writeChunk( ChunkType::eCreateBinding
+			, getObjectId()
+			, BindingType::eSampledTexture
+			, bindingIndex
+			, capture_renderer::getObjectId( view )
+			, layout
+			, index );
+		return doCreateBinding< renderer::SampledTextureBinding >( layoutBinding
+			, view
+			, layout
+			, index );
+	}
+
+	renderer::StorageTextureBinding const & DescriptorSet::createBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+		, renderer::TextureView const & view
+		, uint32_t index )
+	{
+		auto bindingIndex = doGetBindingIndex( layoutBinding );
+		m_inner->createBinding( doGetInnerBinding( bindingIndex )
+			, unwrap< TextureView >( view )
+			, index );
+		m_writer.writeChunk( ChunkType::eCreateBinding
+			, getObjectId()
+			, BindingType::eStorageTexture
+			, bindingIndex
+			, capture_renderer::getObjectId( view )
+			, index );
+		return doCreateBinding< renderer::StorageTextureBinding >( layoutBinding
+			, view
+			, index );
+	}
+
+	renderer::UniformBufferBinding const & DescriptorSet::createBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+		, renderer::UniformBufferBase const & uniformBuffer
+		, uint32_t offset
+		, uint32_t range
+		, uint32_t index )
+	{
+		auto bindingIndex = doGetBindingIndex( layoutBinding );
+		m_inner->createBinding( doGetInnerBinding( bindingIndex )
+			, unwrap< UniformBuffer >( uniformBuffer )
+			, offset
+			, range
+			, index );
+		m_writer.writeChunk( ChunkType::eCreateBinding
+			, getObjectId()
+			, BindingType::eUniformBuffer
+			, bindingIndex
+			, capture_renderer::getObjectId( uniformBuffer )
+			, offset
+			, range
+			, index );
+		return doCreateBinding< renderer::UniformBufferBinding >( layoutBinding
+			, uniformBuffer
+			, offset
+			, range
+			, index );
+	}
+
+	renderer::StorageBufferBinding const & DescriptorSet::createBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+		, renderer::BufferBase const & storageBuffer
+		, uint32_t offset
+		, uint32_t range
+		, uint32_t index )
+	{
+		auto bindingIndex = doGetBindingIndex( layoutBinding );
+		m_inner->createBinding( doGetInnerBinding( bindingIndex )
+			, unwrap< Buffer >( storageBuffer )
+			, offset
+			, range
+			, index );
+		m_writer.writeChunk( ChunkType::eCreateBinding
+			, getObjectId()
+			, BindingType::eStorageBuffer
+			, bindingIndex
+			, capture_renderer::getObjectId( storageBuffer )
+			, offset
+			, range
+			, index );
+		return doCreateBinding< renderer::StorageBufferBinding >( layoutBinding
+			, storageBuffer
+			, offset
+			, range
+			, index );
+	}
+
+	renderer::TexelBufferBinding const & DescriptorSet::createBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+		, renderer::BufferBase const & buffer
+		, renderer::BufferView const & view
+		, uint32_t index )
+	{
+		auto bindingIndex = doGetBindingIndex( layoutBinding );
+		m_inner->createBinding( doGetInnerBinding( bindingIndex )
+			, unwrap< Buffer >( buffer )
+			, unwrap< BufferView >( view )
+			, index );
+		m_writer.writeChunk( ChunkType::eCreateBinding
+			, getObjectId()
+			, BindingType::eTexelBuffer
+			, bindingIndex
+			, capture_renderer::getObjectId( buffer )
+			, capture_renderer::getObjectId( view )
+			, index );
+		return doCreateBinding< renderer::TexelBufferBinding >( layoutBinding
+			, buffer
+			, view
+			, index );
+	}
+
+	renderer::DynamicUniformBufferBinding const & DescriptorSet::createDynamicBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+		, renderer::UniformBufferBase const & uniformBuffer
+		, uint32_t offset
+		, uint32_t range
+		, uint32_t index )
+	{
+		auto bindingIndex = doGetBindingIndex( layoutBinding );
+		m_inner->createDynamicBinding( doGetInnerBinding( bindingIndex )
+			, unwrap< UniformBuffer >( uniformBuffer )
+			, offset
+			, range
+			, index );
+		m_writer.writeChunk( ChunkType::eCreateBinding
+			, getObjectId()
+			, BindingType::eDynamicUniformBuffer
+			, bindingIndex
+			, capture_renderer::getObjectId( uniformBuffer )
+			, offset
+			, range
+			, index );
+		return doCreateBinding< renderer::DynamicUniformBufferBinding >( layoutBinding
+			, uniformBuffer
+			, offset
+			, range
+			, index );
+	}
+
+	renderer::DynamicStorageBufferBinding const & DescriptorSet::createDynamicBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+		, renderer::BufferBase const & storageBuffer
+		, uint32_t offset
+		, uint32_t range
+		, uint32_t index )
+	{
+		auto bindingIndex = doGetBindingIndex( layoutBinding );
+		m_inner->createDynamicBinding( doGetInnerBinding( bindingIndex )
+			, unwrap< Buffer >( storageBuffer )
+			, offset
+			, range
+			, index );
+		m_writer.writeChunk( ChunkType::eCreateBinding
+			, getObjectId()
+			, BindingType::eDynamicStorageBuffer
+			, bindingIndex
+			, capture_renderer::getObjectId( storageBuffer )
+			, offset
+			, range
+			, index );
+		return doCreateBinding< renderer::DynamicStorageBufferBinding >( layoutBinding
+			, storageBuffer
+			, offset
+			, range
+			, index );
+	}
+
+	void DescriptorSet::update()const
+	{
+		m_inner->update();
+		m_writer.writeChunk( ChunkType::eUpdateDescriptorSet
+			, getObjectId() );
+	}
+
+	uint32_t DescriptorSet::doGetBindingIndex( renderer::DescriptorSetLayoutBinding const & layoutBinding )const
+	{
+		auto & bindings = m_layout.getBindings();
+
+		// The layout binding usually comes from the layout itself.
+		if ( &layoutBinding >= bindings.data()
+			&& &layoutBinding < bindings.data() + bindings.size() )
+		{
+			return uint32_t( &layoutBinding - bindings.data() );
+		}
+
+		auto it = std::find_if( bindings.begin()
+			, bindings.end()
+			, [&layoutBinding]( renderer::DescriptorSetLayoutBinding const & lookup )
+			{
+				return lookup.getBindingPoint() == layoutBinding.getBindingPoint();
+			} );
+
+		if ( it == bindings.end() )
+		{
+			throw std::runtime_error{ "The layout binding doesn't belong to the descriptor set layout" };
+		}
+
+		return uint32_t( std::distance( bindings.begin(), it ) );
+	}
+
+	renderer::DescriptorSetLayoutBinding const & DescriptorSet::doGetInnerBinding( uint32_t bindingIndex )const
+	{
+		return m_layout.getInner().getBindings()[bindingIndex];
+	}
+
+	template< typename BindingT, typename ... ParamsT >
+	BindingT const & DescriptorSet::doCreateBinding( ParamsT && ... params )
+	{
+		auto binding = std::make_unique< BindingT >( std::forward< ParamsT >( params )... );
+		auto & result = *binding;
+		m_bindings.emplace_back( std::move( binding ) );
+		return result;
+	}
+}
@@ -0,0 +1,156 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "Miscellaneous/CaptureObject.hpp"
+
+#include <Descriptor/DescriptorSet.hpp>
+#include <Descriptor/DescriptorSetBinding.hpp>
+
+#include <vector>
+
+namespace capture_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Set de descripteurs enveloppant celui du renderer capturé.
+	*\remarks
+	*	Les attaches sont créées sur le set capturé, avec les attaches du layout capturé.
+	*\~english
+	*\brief
+	*	Descriptor set wrapping the captured renderer's one.
+	*\remarks
+	*	The bindings are created on the captured set, with the captured layout's bindings.
+	*/
+	class DescriptorSet
+		: public renderer::DescriptorSet
+		, public Object
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] pool
+		*	Le pool parent.
+		*\param[in] inner
+		*	Le set capturé.
+		*\param[in] bindingPoint
+		*	Le point d'attache du set.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] pool
+		*	The parent pool.
+		*\param[in] inner
+		*	The captured set.
+		*\param[in] bindingPoint
+		*	The binding point for the set.
+		*/
+		DescriptorSet( Device const & device
+			, DescriptorSetPool const & pool
+			, renderer::DescriptorSetPtr && inner
+			, uint32_t bindingPoint );
+		/**
+		*\copydoc	renderer::DescriptorSet::createBinding
+		*/
+		renderer::CombinedTextureSamplerBinding const & createBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+			, renderer::TextureView const & view
+			, renderer::Sampler const & sampler
+			, renderer::ImageLayout layout
+			, uint32_t index )override;
+		/**
+		*\copydoc	renderer::DescriptorSet::createBinding
+		*/
+		renderer::SamplerBinding const & createBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+			, renderer::Sampler const & sampler
+			, uint32_t index )override;
+		/**
+		*\copydoc	renderer::DescriptorSet::createBinding
+		*/
+		renderer::SampledTextureBinding const & createBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+			, renderer::TextureView const & view
+			, renderer::ImageLayout layout
+			, uint32_t index )override;
+		/**
+		*\copydoc	renderer::DescriptorSet::createBinding
+		*/
+		renderer::StorageTextureBinding const & createBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+			, renderer::TextureView const & view
+			, uint32_t index )override;
+		/**
+		*\copydoc	renderer::DescriptorSet::createBinding
+		*/
+		renderer::UniformBufferBinding const & createBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+			, renderer::UniformBufferBase const & uniformBuffer
+			, uint32_t offset
+			, uint32_t range
+			, uint32_t index )override;
+		/**
+		*\copydoc	renderer::DescriptorSet::createBinding
+		*/
+		renderer::StorageBufferBinding const & createBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+			, renderer::BufferBase const & storageBuffer
+			, uint32_t offset
+			, uint32_t range
+			, uint32_t index )override;
+		/**
+		*\copydoc	renderer::DescriptorSet::createBinding
+		*/
+		renderer::TexelBufferBinding const & createBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+			, renderer::BufferBase const & buffer
+			, renderer::BufferView const & view
+			, uint32_t index )override;
+		/**
+		*\copydoc	renderer::DescriptorSet::createDynamicBinding
+		*/
+		renderer::DynamicUniformBufferBinding const & createDynamicBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+			, renderer::UniformBufferBase const & uniformBuffer
+			, uint32_t offset
+			, uint32_t range
+			, uint32_t index )override;
+		/**
+		*\copydoc	renderer::DescriptorSet::createDynamicBinding
+		*/
+		renderer::DynamicStorageBufferBinding const & createDynamicBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+			, renderer::BufferBase const & storageBuffer
+			, uint32_t offset
+			, uint32_t range
+			, uint32_t index )override;
+		/**
+		*\copydoc	renderer::DescriptorSet::update
+		*/
+		void update()const override;
+		/**
+		*\~french
+		*\return
+		*	Le set capturé.
+		*\~english
+		*\return
+		*	The captured set.
+		*/
+		inline renderer::DescriptorSet const & getInner()const
+		{
+			return *m_inner;
+		}
+
+	private:
+		uint32_t doGetBindingIndex( renderer::DescriptorSetLayoutBinding const & layoutBinding )const;
+		renderer::DescriptorSetLayoutBinding const & doGetInnerBinding( uint32_t bindingIndex )const;
+
+		template< typename BindingT, typename ... ParamsT >
+		BindingT const & doCreateBinding( ParamsT && ... params );
+
+	private:
+		renderer::DescriptorSetPtr m_inner;
+		DescriptorSetLayout const & m_layout;
+		std::vector< std::unique_ptr< renderer::DescriptorSetBinding > > m_bindings;
+	};
+}
@@ -0,0 +1,36 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Descriptor/CaptureDescriptorSetLayout.hpp"
+
+#include "Core/CaptureDevice.hpp"
+#include "Descriptor/CaptureDescriptorSetPool.hpp"
+
+namespace capture_renderer
+{
+	DescriptorSetLayout::DescriptorSetLayout( Device const & device
+		, renderer::DescriptorSetLayoutPtr && inner
+		, renderer::DescriptorSetLayoutBindingArray && bindings )
+		: renderer::DescriptorSetLayout{ device, std::move( bindings ) }
+		, Object{ device.getWriter() }
+		, m_device{ device }
+		, m_inner{ std::move( inner ) }
+	{
+	}
+
+	renderer::DescriptorSetPoolPtr DescriptorSetLayout::createPool( uint32_t maxSets
+		, bool automaticFree )const
+	{
+		auto result = std::make_unique< DescriptorSetPool >( m_device
+			, *this
+			, m_inner->createPool( maxSets, automaticFree )
+			, maxSets );
+		m_writer.writeChunk( ChunkType::eCreateDescriptorSetPool
+			, result->getObjectId()
+			, getObjectId()
+			, maxSets
+			, automaticFree );
+		return result;
+	}
+}
@@ -0,0 +1,71 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "Miscellaneous/CaptureObject.hpp"
+
+#include <Descriptor/DescriptorSetLayout.hpp>
+
+namespace capture_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Layout de descripteurs enveloppant celui du renderer capturé.
+	*\~english
+	*\brief
+	*	Descriptors layout wrapping the captured renderer's one.
+	*/
+	class DescriptorSetLayout
+		: public renderer::DescriptorSetLayout
+		, public Object
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] inner
+		*	Le layout capturé.
+		*\param[in] bindings
+		*	Les attaches du layout.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] inner
+		*	The captured layout.
+		*\param[in] bindings
+		*	The layout bindings.
+		*/
+		DescriptorSetLayout( Device const & device
+			, renderer::DescriptorSetLayoutPtr && inner
+			, renderer::DescriptorSetLayoutBindingArray && bindings );
+		/**
+		*\copydoc	renderer::DescriptorSetLayout::createPool
+		*/
+		renderer::DescriptorSetPoolPtr createPool( uint32_t maxSets
+			, bool automaticFree )const override;
+		/**
+		*\~french
+		*\return
+		*	Le layout capturé.
+		*\~english
+		*\return
+		*	The captured layout.
+		*/
+		inline renderer::DescriptorSetLayout const & getInner()const
+		{
+			return *m_inner;
+		}
+
+	private:
+		Device const & m_device;
+		renderer::DescriptorSetLayoutPtr m_inner;
+	};
+}
@@ -0,0 +1,36 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Descriptor/CaptureDescriptorSetPool.hpp"
+
+#include "Core/CaptureDevice.hpp"
+#include "Descriptor/CaptureDescriptorSet.hpp"
+#include "Descriptor/CaptureDescriptorSetLayout.hpp"
+
+namespace capture_renderer
+{
+	DescriptorSetPool::DescriptorSetPool( Device const & device
+		, DescriptorSetLayout const & layout
+		, renderer::DescriptorSetPoolPtr && inner
+		, uint32_t maxSets )
+		: renderer::DescriptorSetPool{ layout, maxSets }
+		, Object{ device.getWriter() }
+		, m_device{ device }
+		, m_inner{ std::move( inner ) }
+	{
+	}
+
+	renderer::DescriptorSetPtr DescriptorSetPool::createDescriptorSet( uint32_t bindingPoint )const
+	{
+		auto result = std::make_unique< DescriptorSet >( m_device
+			, *this
+			, m_inner->createDescriptorSet( bindingPoint )
+			, bindingPoint );
+		m_writer.writeChunk( ChunkType::eCreateDescriptorSet
+			, result->getObjectId()
+			, getObjectId()
+			, bindingPoint );
+		return result;
+	}
+}
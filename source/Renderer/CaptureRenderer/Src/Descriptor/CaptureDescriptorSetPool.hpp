@@ -0,0 +1,75 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "Miscellaneous/CaptureObject.hpp"
+
+#include <Descriptor/DescriptorSetPool.hpp>
+
+namespace capture_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Pool de descripteurs enveloppant celui du renderer capturé.
+	*\~english
+	*\brief
+	*	Descriptors pool wrapping the captured renderer's one.
+	*/
+	class DescriptorSetPool
+		: public renderer::DescriptorSetPool
+		, public Object
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] layout
+		*	Le layout à partir duquel le pool est créé.
+		*\param[in] inner
+		*	Le pool capturé.
+		*\param[in] maxSets
+		*	Le nombre maximum de sets que le pool peut créer.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] layout
+		*	The layout from which the pool is created.
+		*\param[in] inner
+		*	The captured pool.
+		*\param[in] maxSets
+		*	The maximum sets count the pool can create.
+		*/
+		DescriptorSetPool( Device const & device
+			, DescriptorSetLayout const & layout
+			, renderer::DescriptorSetPoolPtr && inner
+			, uint32_t maxSets );
+		/**
+		*\copydoc	renderer::DescriptorSetPool::createDescriptorSet
+		*/
+		renderer::DescriptorSetPtr createDescriptorSet( uint32_t bindingPoint )const override;
+		/**
+		*\~french
+		*\return
+		*	Le pool capturé.
+		*\~english
+		*\return
+		*	The captured pool.
+		*/
+		inline renderer::DescriptorSetPool const & getInner()const
+		{
+			return *m_inner;
+		}
+
+	private:
+		Device const & m_device;
+		renderer::DescriptorSetPoolPtr m_inner;
+	};
+}
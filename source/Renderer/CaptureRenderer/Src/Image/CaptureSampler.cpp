@@ -0,0 +1,30 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Image/CaptureSampler.hpp"
+
+#include "Core/CaptureDevice.hpp"
+
+namespace capture_renderer
+{
+	Sampler::Sampler( Device const & device
+		, renderer::SamplerPtr && inner )
+		: renderer::Sampler{ device
+			, inner->getWrapS()
+			, inner->getWrapT()
+			, inner->getWrapR()
+			, inner->getMinFilter()
+			, inner->getMagFilter()
+			, inner->getMipFilter()
+			, inner->getMinLod()
+			, inner->getMaxLod()
+			, inner->getLodBias()
+			, inner->getBorderColour()
+			, inner->getMaxAnisotropy()
+			, inner->getCompareOp() }
+		, Object{ device.getWriter() }
+		, m_inner{ std::move( inner ) }
+	{
+	}
+}
@@ -0,0 +1,60 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "Miscellaneous/CaptureObject.hpp"
+
+#include <Image/Sampler.hpp>
+
+namespace capture_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Echantillonneur enveloppant celui du renderer capturé.
+	*\~english
+	*\brief
+	*	Sampler wrapping the captured renderer's one.
+	*/
+	class Sampler
+		: public renderer::Sampler
+		, public Object
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur, reprend les paramètres de l'échantillonneur capturé.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] inner
+		*	L'échantillonneur capturé.
+		*\~english
+		*\brief
+		*	Constructor, copies the captured sampler's parameters.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] inner
+		*	The captured sampler.
+		*/
+		Sampler( Device const & device
+			, renderer::SamplerPtr && inner );
+		/**
+		*\~french
+		*\return
+		*	L'échantillonneur capturé.
+		*\~english
+		*\return
+		*	The captured sampler.
+		*/
+		inline renderer::Sampler const & getInner()const
+		{
+			return *m_inner;
+		}
+
+	private:
+		renderer::SamplerPtr m_inner;
+	};
+}
@@ -0,0 +1,182 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Image/CaptureTexture.hpp"
+
+#include "Core/CaptureDevice.hpp"
+#include "Image/CaptureTextureView.hpp"
+
+namespace capture_renderer
+{
+	void setImage( renderer::Texture & texture
+		, renderer::TextureType type
+		, renderer::PixelFormat format
+		, renderer::UIVec3 const & dimensions
+		, uint32_t layerCount
+		, uint32_t mipmapLevels
+		, renderer::SampleCountFlag samples
+		, renderer::ImageUsageFlags usageFlags
+		, renderer::ImageTiling tiling
+		, renderer::MemoryPropertyFlags memoryFlags )
+	{
+		switch ( type )
+		{
+		case renderer::TextureType::e1D:
+			texture.setImage( format
+				, dimensions[0]
+				, mipmapLevels
+				, usageFlags
+				, tiling
+				, memoryFlags );
+			break;
+
+		case renderer::TextureType::e1DArray:
+			texture.setImageArray( format
+				, dimensions[0]
+				, layerCount
+				, mipmapLevels
+				, usageFlags
+				, tiling
+				, memoryFlags );
+			break;
+
+		case renderer::TextureType::e2D:
+			texture.setImage( format
+				, renderer::UIVec2{ dimensions[0], dimensions[1] }
+				, mipmapLevels
+				, usageFlags
+				, tiling
+				, samples
+				, memoryFlags );
+			break;
+
+		case renderer::TextureType::e2DArray:
+			texture.setImageArray( format
+				, renderer::UIVec2{ dimensions[0], dimensions[1] }
+				, layerCount
+				, mipmapLevels
+				, usageFlags
+				, tiling
+				, memoryFlags );
+			break;
+
+		case renderer::TextureType::e3D:
+			texture.setImage( format
+				, dimensions
+				, mipmapLevels
+				, usageFlags
+				, tiling
+				, samples
+				, memoryFlags );
+			break;
+
+		default:
+			throw std::runtime_error{ "Unsupported texture type" };
+		}
+	}
+
+	Texture::Texture( Device const & device
+		, renderer::TexturePtr && inner )
+		: Texture{ device, *inner }
+	{
+		m_ownInner = std::move( inner );
+	}
+
+	Texture::Texture( Device const & device
+		, renderer::Texture const & inner )
+		: renderer::Texture{ device }
+		, Object{ device.getWriter() }
+		, m_inner{ inner }
+	{
+		m_size = inner.getDimensions();
+		m_type = inner.getType();
+		m_layerCount = inner.getLayerCount();
+		m_mipmapLevels = inner.getMipmapLevels();
+		m_format = inner.getFormat();
+	}
+
+	renderer::TextureViewPtr Texture::createView( renderer::TextureType type
+		, renderer::PixelFormat format
+		, uint32_t baseMipLevel
+		, uint32_t levelCount
+		, uint32_t baseArrayLayer
+		, uint32_t layerCount
+		, renderer::ComponentMapping const & mapping )const
+	{
+		auto result = std::make_shared< TextureView >( static_cast< Device const & >( m_device )
+			, *this
+			, m_inner.createView( type
+				, format
+				, baseMipLevel
+				, levelCount
+				, baseArrayLayer
+				, layerCount
+				, mapping )
+			, mapping );
+		m_writer.writeChunk( ChunkType::eCreateTextureView
+			, result->getObjectId()
+			, getObjectId()
+			, type
+			, format
+			, baseMipLevel
+			, levelCount
+			, baseArrayLayer
+			, layerCount
+			, mapping );
+		return result;
+	}
+
+	void Texture::doSetImage1D( renderer::ImageUsageFlags usageFlags
+		, renderer::ImageTiling tiling
+		, renderer::MemoryPropertyFlags memoryFlags )
+	{
+		doSetImage( usageFlags, tiling, memoryFlags );
+	}
+
+	void Texture::doSetImage2D( renderer::ImageUsageFlags usageFlags
+		, renderer::ImageTiling tiling
+		, renderer::MemoryPropertyFlags memoryFlags )
+	{
+		doSetImage( usageFlags, tiling, memoryFlags );
+	}
+
+	void Texture::doSetImage3D( renderer::ImageUsageFlags usageFlags
+		, renderer::ImageTiling tiling
+		, renderer::MemoryPropertyFlags memoryFlags )
+	{
+		doSetImage( usageFlags, tiling, memoryFlags );
+	}
+
+	void Texture::doSetImage( renderer::ImageUsageFlags usageFlags
+		, renderer::ImageTiling tiling
+		, renderer::MemoryPropertyFlags memoryFlags )
+	{
+		if ( !m_ownInner )
+		{
+			throw std::runtime_error{ "Can't set the image of a swap chain texture" };
+		}
+
+		capture_renderer::setImage( *m_ownInner
+			, m_type
+			, m_format
+			, m_size
+			, m_layerCount
+			, m_mipmapLevels
+			, m_samples
+			, usageFlags
+			, tiling
+			, memoryFlags );
+		m_writer.writeChunk( ChunkType::eSetImage
+			, getObjectId()
+			, m_type
+			, m_format
+			, m_size
+			, m_layerCount
+			, m_mipmapLevels
+			, m_samples
+			, usageFlags
+			, tiling
+			, memoryFlags );
+	}
+}
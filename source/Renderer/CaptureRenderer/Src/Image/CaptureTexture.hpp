@@ -0,0 +1,134 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "Miscellaneous/CaptureObject.hpp"
+
+#include <Image/Texture.hpp>
+
+namespace capture_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Texture enveloppant celle du renderer capturé.
+	*\~english
+	*\brief
+	*	Texture wrapping the captured renderer's one.
+	*/
+	class Texture
+		: public renderer::Texture
+		, public Object
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] inner
+		*	La texture capturée.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] inner
+		*	The captured texture.
+		*/
+		Texture( Device const & device
+			, renderer::TexturePtr && inner );
+		/**
+		*\~french
+		*\brief
+		*	Constructeur, pour une texture capturée possédée par une swap chain.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] inner
+		*	La texture capturée, dont les dimensions et le format sont repris.
+		*\~english
+		*\brief
+		*	Constructor, for a captured texture owned by a swap chain.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] inner
+		*	The captured texture, which dimensions and format are copied.
+		*/
+		Texture( Device const & device
+			, renderer::Texture const & inner );
+		/**
+		*\copydoc	renderer::Texture::createView
+		*/
+		renderer::TextureViewPtr createView( renderer::TextureType type
+			, renderer::PixelFormat format
+			, uint32_t baseMipLevel
+			, uint32_t levelCount
+			, uint32_t baseArrayLayer
+			, uint32_t layerCount
+			, renderer::ComponentMapping const & mapping )const override;
+		/**
+		*\~french
+		*\return
+		*	La texture capturée.
+		*\~english
+		*\return
+		*	The captured texture.
+		*/
+		inline renderer::Texture const & getInner()const
+		{
+			return m_inner;
+		}
+
+	private:
+		/**
+		*\copydoc	renderer::Texture::doSetImage1D
+		*/
+		void doSetImage1D( renderer::ImageUsageFlags usageFlags
+			, renderer::ImageTiling tiling
+			, renderer::MemoryPropertyFlags memoryFlags )override;
+		/**
+		*\copydoc	renderer::Texture::doSetImage2D
+		*/
+		void doSetImage2D( renderer::ImageUsageFlags usageFlags
+			, renderer::ImageTiling tiling
+			, renderer::MemoryPropertyFlags memoryFlags )override;
+		/**
+		*\copydoc	renderer::Texture::doSetImage3D
+		*/
+		void doSetImage3D( renderer::ImageUsageFlags usageFlags
+			, renderer::ImageTiling tiling
+			, renderer::MemoryPropertyFlags memoryFlags )override;
+		void doSetImage( renderer::ImageUsageFlags usageFlags
+			, renderer::ImageTiling tiling
+			, renderer::MemoryPropertyFlags memoryFlags );
+
+	private:
+		renderer::TexturePtr m_ownInner;
+		renderer::Texture const & m_inner;
+	};
+	/**
+	*\~french
+	*\brief
+	*	Crée l'image d'une texture, via la fonction setImage correspondant à son type.
+	*\remarks
+	*	Utilisée pour reproduire, sur la texture capturée ou lors du rejeu, un appel à setImage.
+	*\~english
+	*\brief
+	*	Creates a texture's image, through the setImage function matching its type.
+	*\remarks
+	*	Used to reproduce, on the captured texture or during the replay, a call to setImage.
+	*/
+	void setImage( renderer::Texture & texture
+		, renderer::TextureType type
+		, renderer::PixelFormat format
+		, renderer::UIVec3 const & dimensions
+		, uint32_t layerCount
+		, uint32_t mipmapLevels
+		, renderer::SampleCountFlag samples
+		, renderer::ImageUsageFlags usageFlags
+		, renderer::ImageTiling tiling
+		, renderer::MemoryPropertyFlags memoryFlags );
+}
@@ -0,0 +1,66 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Image/CaptureTextureView.hpp"
+
+#include "Core/CaptureDevice.hpp"
+#include "Image/CaptureTexture.hpp"
+
+#include <Sync/ImageMemoryBarrier.hpp>
+
+namespace capture_renderer
+{
+	TextureView::TextureView( Device const & device
+		, Texture const & image
+		, renderer::TextureViewPtr && inner
+		, renderer::ComponentMapping const & mapping )
+		: renderer::TextureView{ device
+			, image
+			, inner->getType()
+			, inner->getFormat()
+			, inner->getSubResourceRange().getBaseMipLevel()
+			, inner->getSubResourceRange().getLevelCount()
+			, inner->getSubResourceRange().getBaseArrayLayer()
+			, inner->getSubResourceRange().getLayerCount()
+			, mapping }
+		, Object{ device.getWriter() }
+		, m_ownInner{ std::move( inner ) }
+		, m_inner{ *m_ownInner }
+	{
+	}
+
+	TextureView::TextureView( Device const & device
+		, Texture const & image
+		, renderer::TextureView const & inner )
+		: renderer::TextureView{ device
+			, image
+			, inner.getType()
+			, inner.getFormat()
+			, inner.getSubResourceRange().getBaseMipLevel()
+			, inner.getSubResourceRange().getLevelCount()
+			, inner.getSubResourceRange().getBaseArrayLayer()
+			, inner.getSubResourceRange().getLayerCount()
+			, renderer::ComponentMapping{} }
+		, Object{ device.getWriter() }
+		, m_inner{ inner }
+	{
+	}
+
+	renderer::ImageMemoryBarrier TextureView::doMakeLayoutTransition( renderer::ImageLayout srcLayout
+		, renderer::ImageLayout dstLayout
+		, renderer::AccessFlags srcAccessFlags
+		, renderer::AccessFlags dstAccessMask
+		, uint32_t srcQueueFamily
+		, uint32_t dstQueueFamily )const
+	{
+		return renderer::ImageMemoryBarrier{ srcAccessFlags
+			, dstAccessMask
+			, srcLayout
+			, dstLayout
+			, srcQueueFamily
+			, dstQueueFamily
+			, getTexture()
+			, getSubResourceRange() };
+	}
+}
@@ -0,0 +1,105 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "Miscellaneous/CaptureObject.hpp"
+
+#include <Image/TextureView.hpp>
+
+namespace capture_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Vue sur une texture, enveloppant celle du renderer capturé.
+	*\~english
+	*\brief
+	*	Texture view wrapping the captured renderer's one.
+	*/
+	class TextureView
+		: public renderer::TextureView
+		, public Object
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] image
+		*	La texture sur laquelle la vue est créée.
+		*\param[in] inner
+		*	La vue capturée.
+		*\param[in] mapping
+		*	Le mappage des composantes.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] image
+		*	The texture from which the view is created.
+		*\param[in] inner
+		*	The captured view.
+		*\param[in] mapping
+		*	The components mapping.
+		*/
+		TextureView( Device const & device
+			, Texture const & image
+			, renderer::TextureViewPtr && inner
+			, renderer::ComponentMapping const & mapping );
+		/**
+		*\~french
+		*\brief
+		*	Constructeur, pour une vue capturée possédée par une swap chain.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] image
+		*	La texture sur laquelle la vue est créée.
+		*\param[in] inner
+		*	La vue capturée.
+		*\~english
+		*\brief
+		*	Constructor, for a captured view owned by a swap chain.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] image
+		*	The texture from which the view is created.
+		*\param[in] inner
+		*	The captured view.
+		*/
+		TextureView( Device const & device
+			, Texture const & image
+			, renderer::TextureView const & inner );
+		/**
+		*\~french
+		*\return
+		*	La vue capturée.
+		*\~english
+		*\return
+		*	The captured view.
+		*/
+		inline renderer::TextureView const & getInner()const
+		{
+			return m_inner;
+		}
+
+	private:
+		/**
+		*\copydoc	renderer::TextureView::doMakeLayoutTransition
+		*/
+		renderer::ImageMemoryBarrier doMakeLayoutTransition( renderer::ImageLayout srcLayout
+			, renderer::ImageLayout dstLayout
+			, renderer::AccessFlags srcAccessFlags
+			, renderer::AccessFlags dstAccessMask
+			, uint32_t srcQueueFamily
+			, uint32_t dstQueueFamily )const override;
+
+	private:
+		renderer::TextureViewPtr m_ownInner;
+		renderer::TextureView const & m_inner;
+	};
+}
@@ -0,0 +1,188 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#pragma once
+
+#include <cstdint>
+
+namespace capture_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Le format binaire des captures, partagé entre le Writer et le Player.
+	*\remarks
+	*	Un fichier de capture contient :
+	*	- un CaptureHeader, suivi du nom du renderer capturé (uint32_t taille, caractères) ;
+	*	- des chunks, chacun étant un ChunkHeader suivi de ChunkHeader::size octets.
+	*	Les objets sont désignés par leur ObjectId, ExternalObject désignant un objet non capturé.
+	*	Le contenu de chaque chunk est décrit avec son ChunkType, et est écrit via OutputStream.
+	*\~english
+	*\brief
+	*	The binary format of the captures, shared between the Writer and the Player.
+	*\remarks
+	*	A capture file contains:
+	*	- a CaptureHeader, followed by the captured renderer's name (uint32_t size, characters);
+	*	- chunks, each one being a ChunkHeader followed by ChunkHeader::size bytes.
+	*	The objects are referred to by their ObjectId, ExternalObject referring to a non captured object.
+	*	The content of each chunk is described with its ChunkType, and is written through OutputStream.
+	*/
+	static uint32_t constexpr CaptureMagic = 0x50434C52u; // "RLCP"
+	static uint32_t constexpr CaptureVersion = 2u;
+
+	//!\~french		Les indices des files, dans les chunks ChunkType::eSubmit.
+	//!\~english	The queues indices, in the ChunkType::eSubmit chunks.
+	static uint32_t constexpr GraphicsQueueIndex = 0u;
+	static uint32_t constexpr PresentQueueIndex = 1u;
+	static uint32_t constexpr ComputeQueueIndex = 2u;
+
+	struct CaptureHeader
+	{
+		uint32_t magic;
+		uint32_t version;
+		//!\~french		La première frame de la plage capturée, les précédentes ne servant qu'à créer les ressources.
+		//!\~english	The first frame of the captured range, the previous ones only serve to create the resources.
+		uint32_t firstFrame;
+		//!\~french		Le nombre de frames de la plage capturée.
+		//!\~english	The frames count of the captured range.
+		uint32_t frameCount;
+	};
+
+	enum class ChunkType
+		: uint16_t
+	{
+		//! id, size, targets, memory flags.
+		eCreateBuffer,
+		//! id, buffer id, count, size, targets, memory flags.
+		eCreateUniformBuffer,
+		//! id, buffer id, format, offset, range.
+		eCreateBufferView,
+		//! id, initial layout.
+		eCreateTexture,
+		//! texture id, type, format, dimensions, layers, mip levels, samples, usage, tiling, memory flags.
+		eSetImage,
+		//! id, texture id, type, format, base mip level, level count, base array layer, layer count, mapping.
+		eCreateTextureView,
+		//! id, wrap S, T, R, min, mag and mip filters, min, max LOD and bias, border colour, max anisotropy, compare op.
+		eCreateSampler,
+		//! id, attaches, subpasses (RenderSubpass::write), initial state, final state.
+		eCreateRenderPass,
+		//! id, render pass id, dimensions, render pass attaches indices, views ids.
+		eCreateFrameBuffer,
+		//! id, dimensions, format.
+		eCreateSwapChain,
+		//! swap chain id, render pass id, frame buffers count, then for each frame buffer:
+		//! id, dimensions, attaches count, (render pass attach index, texture id, view id, format) for each attach.
+		eCreateSwapChainFrameBuffers,
+		//! id, bindings.
+		eCreateDescriptorSetLayout,
+		//! id, layout id, max sets, automatic free.
+		eCreateDescriptorSetPool,
+		//! id, pool id, binding point.
+		eCreateDescriptorSet,
+		//! set id, BindingType, layout binding index, then the binding's parameters.
+		eCreateBinding,
+		//! set id.
+		eUpdateDescriptorSet,
+		//! id, descriptor set layouts ids, push constant ranges.
+		eCreatePipelineLayout,
+		//! id, stage.
+		eCreateShaderModule,
+		//! module id, is SPIR-V, source or binary.
+		eLoadShader,
+		//! id, layout id, GraphicsPipelineCreateInfo.
+		eCreatePipeline,
+		//! id, layout id, shader stage.
+		eCreateComputePipeline,
+		//! id, queue family index, flags.
+		eCreateCommandPool,
+		//! id, pool id, primary.
+		eCreateCommandBuffer,
+		//! id, type, count, pipeline statistics.
+		eCreateQueryPool,
+		//! id.
+		eDestroy,
+		//! buffer id, offset, data.
+		eBufferData,
+		//! command buffer id, usage flags, inheritance info (empty for a primary command buffer),
+		//! commands count, commands (CommandType followed by the parameters).
+		eRecord,
+		//! queue index, command buffers ids.
+		eSubmit,
+		//! frame index.
+		eFrame,
+	};
+
+	struct ChunkHeader
+	{
+		ChunkType type;
+		uint16_t padding;
+		uint32_t size;
+	};
+
+	enum class CommandType
+		: uint16_t
+	{
+		eBeginRenderPass,
+		eNextSubpass,
+		eEndRenderPass,
+		eExecuteCommands,
+		eClearColour,
+		eClearDepthStencil,
+		eClearAttachments,
+		eBufferMemoryBarrier,
+		eImageMemoryBarrier,
+		eBindPipeline,
+		eBindComputePipeline,
+		eBindVertexBuffers,
+		eBindIndexBuffer,
+		eBindDescriptorSets,
+		eSetViewport,
+		eSetScissor,
+		eDraw,
+		eDrawIndexed,
+		eDrawIndirect,
+		eDrawIndexedIndirect,
+		eDrawIndirectCount,
+		eDrawIndexedIndirectCount,
+		eCopyToImage,
+		eCopyToBuffer,
+		eCopyBuffer,
+		eCopyImage,
+		eBlitImage,
+		eResetQueryPool,
+		eBeginQuery,
+		eEndQuery,
+		eWriteTimestamp,
+		eCopyQueryPoolResults,
+		ePushConstants,
+		eDispatch,
+		eDispatchIndirect,
+		eSetLineWidth,
+		eGenerateMipmaps,
+	};
+
+	enum class BindingType
+		: uint16_t
+	{
+		//! view id, sampler id, layout, index.
+		eCombinedTextureSampler,
+		//! sampler id, index.
+		eSampler,
+		//! view id, layout, index.
+		eSampledTexture,
+		//! view id, index.
+		eStorageTexture,
+		//! uniform buffer id, offset, range, index.
+		eUniformBuffer,
+		//! buffer id, offset, range, index.
+		eStorageBuffer,
+		//! buffer id, view id, index.
+		eTexelBuffer,
+		//! uniform buffer id, offset, range, index.
+		eDynamicUniformBuffer,
+		//! buffer id, offset, range, index.
+		eDynamicStorageBuffer,
+	};
+}
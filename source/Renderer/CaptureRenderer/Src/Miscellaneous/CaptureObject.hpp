@@ -0,0 +1,99 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#pragma once
+
+#include "Miscellaneous/CaptureWriter.hpp"
+
+namespace capture_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Classe de base des objets du renderer de capture, leur donnant un identifiant.
+	*\remarks
+	*	La destruction de l'objet est enregistrée.
+	*\~english
+	*\brief
+	*	Base class of the capture renderer's objects, giving them an identifier.
+	*\remarks
+	*	The object's destruction is recorded.
+	*/
+	class Object
+	{
+	protected:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] writer
+		*	L'écrivain de la capture.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] writer
+		*	The capture writer.
+		*/
+		Object( Writer & writer )
+			: m_writer{ writer }
+			, m_objectId{ writer.registerObject() }
+		{
+		}
+
+	public:
+		virtual ~Object()
+		{
+			m_writer.writeChunk( ChunkType::eDestroy, m_objectId );
+		}
+		/**
+		*\~french
+		*\return
+		*	L'identifiant de l'objet.
+		*\~english
+		*\return
+		*	The object identifier.
+		*/
+		inline ObjectId getObjectId()const
+		{
+			return m_objectId;
+		}
+
+	protected:
+		Writer & m_writer;
+
+	private:
+		ObjectId m_objectId;
+	};
+	/**
+	*\~french
+	*\return
+	*	L'identifiant de l'objet donné, ExternalObject s'il n'a pas été créé via le renderer de capture.
+	*\~english
+	*\return
+	*	The given object's identifier, ExternalObject if it wasn't created through the capture renderer.
+	*/
+	template< typename RendererT >
+	inline ObjectId getObjectId( RendererT const & object )
+	{
+		auto capture = dynamic_cast< Object const * >( &object );
+		return capture
+			? capture->getObjectId()
+			: ExternalObject;
+	}
+	/**
+	*\~french
+	*\return
+	*	L'identifiant de l'objet donné, ExternalObject s'il est nul.
+	*\~english
+	*\return
+	*	The given object's identifier, ExternalObject if it is null.
+	*/
+	template< typename RendererT >
+	inline ObjectId getObjectId( RendererT const * object )
+	{
+		return object
+			? getObjectId( *object )
+			: ExternalObject;
+	}
+}
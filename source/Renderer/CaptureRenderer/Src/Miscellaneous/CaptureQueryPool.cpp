@@ -0,0 +1,47 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Miscellaneous/CaptureQueryPool.hpp"
+
+#include "Core/CaptureDevice.hpp"
+
+namespace capture_renderer
+{
+	QueryPool::QueryPool( Device const & device
+		, renderer::QueryPoolPtr && inner
+		, renderer::QueryType type
+		, uint32_t count
+		, renderer::QueryPipelineStatisticFlags pipelineStatistics )
+		: renderer::QueryPool{ device, type, count, pipelineStatistics }
+		, Object{ device.getWriter() }
+		, m_inner{ std::move( inner ) }
+	{
+	}
+
+	bool QueryPool::getResults( uint32_t firstQuery
+		, uint32_t queryCount
+		, uint32_t stride
+		, renderer::QueryResultFlags flags
+		, renderer::UInt32Array & data )const
+	{
+		return m_inner->getResults( firstQuery
+			, queryCount
+			, stride
+			, flags
+			, data );
+	}
+
+	bool QueryPool::getResults( uint32_t firstQuery
+		, uint32_t queryCount
+		, uint32_t stride
+		, renderer::QueryResultFlags flags
+		, renderer::UInt64Array & data )const
+	{
+		return m_inner->getResults( firstQuery
+			, queryCount
+			, stride
+			, flags
+			, data );
+	}
+}
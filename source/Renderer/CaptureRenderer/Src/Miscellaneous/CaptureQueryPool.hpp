@@ -0,0 +1,91 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "Miscellaneous/CaptureObject.hpp"
+
+#include <Miscellaneous/QueryPool.hpp>
+
+namespace capture_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Pool de requêtes enveloppant celui du renderer capturé.
+	*\~english
+	*\brief
+	*	Query pool wrapping the captured renderer's one.
+	*/
+	class QueryPool
+		: public renderer::QueryPool
+		, public Object
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] inner
+		*	Le pool capturé.
+		*\param[in] type
+		*	Le type de requête.
+		*\param[in] count
+		*	Le nombre de requêtes.
+		*\param[in] pipelineStatistics
+		*	Les statistiques de pipeline voulues.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] inner
+		*	The captured pool.
+		*\param[in] type
+		*	The query type.
+		*\param[in] count
+		*	The queries count.
+		*\param[in] pipelineStatistics
+		*	The wanted pipeline statistics.
+		*/
+		QueryPool( Device const & device
+			, renderer::QueryPoolPtr && inner
+			, renderer::QueryType type
+			, uint32_t count
+			, renderer::QueryPipelineStatisticFlags pipelineStatistics );
+		/**
+		*\copydoc	renderer::QueryPool::getResults
+		*/
+		bool getResults( uint32_t firstQuery
+			, uint32_t queryCount
+			, uint32_t stride
+			, renderer::QueryResultFlags flags
+			, renderer::UInt32Array & data )const override;
+		/**
+		*\copydoc	renderer::QueryPool::getResults
+		*/
+		bool getResults( uint32_t firstQuery
+			, uint32_t queryCount
+			, uint32_t stride
+			, renderer::QueryResultFlags flags
+			, renderer::UInt64Array & data )const override;
+		/**
+		*\~french
+		*\return
+		*	Le pool capturé.
+		*\~english
+		*\return
+		*	The captured pool.
+		*/
+		inline renderer::QueryPool const & getInner()const
+		{
+			return *m_inner;
+		}
+
+	private:
+		renderer::QueryPoolPtr m_inner;
+	};
+}
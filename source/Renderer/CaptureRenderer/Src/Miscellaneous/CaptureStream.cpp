@@ -0,0 +1,156 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Miscellaneous/CaptureStream.hpp"
+
+namespace capture_renderer
+{
+	void OutputStream::write( std::string const & value )
+	{
+		write( uint32_t( value.size() ) );
+		writeBytes( value.data(), value.size() );
+	}
+
+	void OutputStream::write( renderer::RasterisationState const & value )
+	{
+		write( value.getFlags() );
+		write( value.isDepthClampEnabled() );
+		write( value.isRasteriserDiscardEnabled() );
+		write( value.getPolygonMode() );
+		write( value.getCullMode() );
+		write( value.getFrontFace() );
+		write( value.isDepthBiasEnabled() );
+		write( value.getDepthBiasConstantFactor() );
+		write( value.getDepthBiasClamp() );
+		write( value.getDepthBiasSlopeFactor() );
+		write( value.hasLineWidth() );
+
+		if ( value.hasLineWidth() )
+		{
+			write( value.getLineWidth() );
+		}
+	}
+
+	void OutputStream::write( renderer::ColourBlendState const & value )
+	{
+		write( value.isLogicOpEnabled() );
+		write( value.getLogicOp() );
+		write( value.getBlendConstants() );
+		write( uint32_t( std::distance( value.begin(), value.end() ) ) );
+
+		for ( auto & attach : value )
+		{
+			write( attach );
+		}
+	}
+
+	void OutputStream::write( renderer::VertexInputState const & value )
+	{
+		write( value.vertexBindingDescriptions );
+		write( value.vertexAttributeDescriptions );
+	}
+
+	void OutputStream::writeBytes( void const * data
+		, size_t size )
+	{
+		auto bytes = reinterpret_cast< uint8_t const * >( data );
+		m_data.insert( m_data.end(), bytes, bytes + size );
+	}
+
+	void OutputStream::clear()
+	{
+		m_data.clear();
+	}
+
+	InputStream::InputStream( uint8_t const * data
+		, size_t size )
+		: m_current{ data }
+		, m_end{ data + size }
+	{
+	}
+
+	std::string InputStream::readString()
+	{
+		auto size = read< uint32_t >();
+		auto data = reinterpret_cast< char const * >( readBytes( size ) );
+		return std::string( data, data + size );
+	}
+
+	renderer::RasterisationState InputStream::readRasterisationState()
+	{
+		auto flags = read< renderer::RasterisationStateFlags >();
+		auto depthClampEnable = read< bool >();
+		auto rasteriserDiscardEnable = read< bool >();
+		auto polygonMode = read< renderer::PolygonMode >();
+		auto cullMode = read< renderer::CullModeFlags >();
+		auto frontFace = read< renderer::FrontFace >();
+		auto depthBiasEnable = read< bool >();
+		auto depthBiasConstantFactor = read< float >();
+		auto depthBiasClamp = read< float >();
+		auto depthBiasSlopeFactor = read< float >();
+
+		if ( read< bool >() )
+		{
+			return renderer::RasterisationState{ read< float >()
+				, flags
+				, depthClampEnable
+				, rasteriserDiscardEnable
+				, polygonMode
+				, cullMode
+				, frontFace
+				, depthBiasEnable
+				, depthBiasConstantFactor
+				, depthBiasClamp
+				, depthBiasSlopeFactor };
+		}
+
+		return renderer::RasterisationState{ flags
+			, depthClampEnable
+			, rasteriserDiscardEnable
+			, polygonMode
+			, cullMode
+			, frontFace
+			, depthBiasEnable
+			, depthBiasConstantFactor
+			, depthBiasClamp
+			, depthBiasSlopeFactor };
+	}
+
+	renderer::ColourBlendState InputStream::readColourBlendState()
+	{
+		auto logicOpEnable = read< bool >();
+		auto logicOp = read< renderer::LogicOp >();
+		auto blendConstants = read< renderer::Vec4 >();
+		renderer::ColourBlendState result{ logicOpEnable
+			, logicOp
+			, blendConstants };
+
+		for ( auto & attach : readArray< renderer::ColourBlendStateAttachment >() )
+		{
+			result.addAttachment( attach );
+		}
+
+		return result;
+	}
+
+	renderer::VertexInputState InputStream::readVertexInputState()
+	{
+		renderer::VertexInputState result;
+		result.vertexBindingDescriptions = readArray< renderer::VertexInputBindingDescription >();
+		result.vertexAttributeDescriptions = readArray< renderer::VertexInputAttributeDescription >();
+		return result;
+	}
+
+	uint8_t const * InputStream::readBytes( size_t size )
+	{
+		if ( size_t( m_end - m_current ) < size )
+		{
+			throw std::runtime_error{ "Truncated capture chunk" };
+		}
+
+		auto result = m_current;
+		m_current += size;
+		return result;
+	}
+}
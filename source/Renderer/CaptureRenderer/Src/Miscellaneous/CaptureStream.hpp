@@ -0,0 +1,153 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#pragma once
+
+#include "CaptureRendererPrerequisites.hpp"
+
+#include <Pipeline/ColourBlendState.hpp>
+#include <Pipeline/RasterisationState.hpp>
+#include <Pipeline/VertexInputState.hpp>
+
+#include <stdexcept>
+#include <type_traits>
+
+namespace capture_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Sérialise des valeurs dans un tampon d'octets.
+	*\remarks
+	*	Les types trivialement copiables sont écrits tels quels,
+	*	les tableaux et chaînes sont précédés de leur taille (uint32_t).
+	*\~english
+	*\brief
+	*	Serialises values into a bytes buffer.
+	*\remarks
+	*	The trivially copyable types are written as is,
+	*	the arrays and strings are preceded by their size (uint32_t).
+	*/
+	class OutputStream
+	{
+	public:
+		template< typename T >
+		inline void write( T const & value )
+		{
+			static_assert( std::is_trivially_copyable< T >::value
+				, "Only trivially copyable types can be written as is" );
+			writeBytes( &value, sizeof( T ) );
+		}
+
+		template< typename T >
+		inline void write( std::vector< T > const & values )
+		{
+			write( uint32_t( values.size() ) );
+
+			for ( auto & value : values )
+			{
+				write( value );
+			}
+		}
+
+		template< typename T >
+		inline void write( std::optional< T > const & value )
+		{
+			write( bool( value ) );
+
+			if ( value )
+			{
+				write( *value );
+			}
+		}
+
+		void write( std::string const & value );
+		void write( renderer::RasterisationState const & value );
+		void write( renderer::ColourBlendState const & value );
+		void write( renderer::VertexInputState const & value );
+		void writeBytes( void const * data
+			, size_t size );
+		void clear();
+
+		inline renderer::ByteArray const & getData()const
+		{
+			return m_data;
+		}
+
+	private:
+		renderer::ByteArray m_data;
+	};
+	/**
+	*\~french
+	*\brief
+	*	Désérialise les valeurs écrites par un OutputStream.
+	*\remarks
+	*	Lance une std::runtime_error si le tampon est trop court.
+	*\~english
+	*\brief
+	*	Deserialises the values written by an OutputStream.
+	*\remarks
+	*	Throws a std::runtime_error if the buffer is too short.
+	*/
+	class InputStream
+	{
+	public:
+		InputStream( uint8_t const * data
+			, size_t size );
+
+		template< typename T >
+		inline T read()
+		{
+			static_assert( std::is_trivially_copyable< T >::value
+				, "Only trivially copyable types can be read as is" );
+			// Some of the read types have no default constructor.
+			typename std::aligned_storage< sizeof( T ), alignof( T ) >::type storage;
+			std::memcpy( &storage, readBytes( sizeof( T ) ), sizeof( T ) );
+			return *reinterpret_cast< T const * >( &storage );
+		}
+
+		template< typename T >
+		inline std::vector< T > readArray()
+		{
+			auto count = read< uint32_t >();
+			std::vector< T > result;
+			result.reserve( count );
+
+			for ( uint32_t i = 0u; i < count; ++i )
+			{
+				result.push_back( read< T >() );
+			}
+
+			return result;
+		}
+
+		template< typename T >
+		inline std::optional< T > readOptional()
+		{
+			std::optional< T > result;
+
+			if ( read< bool >() )
+			{
+				result = read< T >();
+			}
+
+			return result;
+		}
+
+		std::string readString();
+		renderer::RasterisationState readRasterisationState();
+		renderer::ColourBlendState readColourBlendState();
+		renderer::VertexInputState readVertexInputState();
+		uint8_t const * readBytes( size_t size );
+
+		inline bool isEnd()const
+		{
+			return m_current == m_end;
+		}
+
+	private:
+		uint8_t const * m_current;
+		uint8_t const * m_end;
+	};
+}
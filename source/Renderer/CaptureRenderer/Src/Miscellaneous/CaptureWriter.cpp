@@ -0,0 +1,74 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Miscellaneous/CaptureWriter.hpp"
+
+#include <iostream>
+
+namespace capture_renderer
+{
+	Writer::Writer( CaptureOptions const & options
+		, std::string const & rendererName )
+		: m_options{ options }
+		, m_file{ options.fileName, std::ios::binary }
+	{
+		if ( !m_file )
+		{
+			throw std::runtime_error{ "Couldn't open the capture file " + options.fileName };
+		}
+
+		CaptureHeader header
+		{
+			CaptureMagic,
+			CaptureVersion,
+			m_options.firstFrame,
+			m_options.frameCount,
+		};
+		OutputStream stream;
+		stream.write( header );
+		stream.write( rendererName );
+		m_file.write( reinterpret_cast< char const * >( stream.getData().data() )
+			, std::streamsize( stream.getData().size() ) );
+		m_capturing = true;
+	}
+
+	ObjectId Writer::registerObject()
+	{
+		return m_nextId++;
+	}
+
+	void Writer::write( ChunkType type
+		, OutputStream const & payload )
+	{
+		std::lock_guard< std::mutex > lock{ m_mutex };
+
+		if ( m_capturing )
+		{
+			ChunkHeader header
+			{
+				type,
+				0u,
+				uint32_t( payload.getData().size() ),
+			};
+			m_file.write( reinterpret_cast< char const * >( &header ), sizeof( header ) );
+			m_file.write( reinterpret_cast< char const * >( payload.getData().data() )
+				, std::streamsize( payload.getData().size() ) );
+		}
+	}
+
+	void Writer::endFrame()
+	{
+		writeChunk( ChunkType::eFrame, m_frame );
+		++m_frame;
+
+		if ( m_capturing
+			&& m_frame >= m_options.firstFrame + m_options.frameCount )
+		{
+			std::lock_guard< std::mutex > lock{ m_mutex };
+			m_capturing = false;
+			m_file.close();
+			std::cout << "Capture written to " << m_options.fileName << std::endl;
+		}
+	}
+}
@@ -0,0 +1,145 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#pragma once
+
+#include "Miscellaneous/CaptureFormat.hpp"
+#include "Miscellaneous/CaptureStream.hpp"
+
+#include <atomic>
+#include <fstream>
+#include <mutex>
+
+namespace capture_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Les options d'une capture.
+	*\~english
+	*\brief
+	*	A capture's options.
+	*/
+	struct CaptureOptions
+	{
+		//!\~french		Le fichier de capture.
+		//!\~english	The capture file.
+		std::string fileName;
+		//!\~french		La première frame capturée, les précédentes ne servant qu'à créer les ressources.
+		//!\~english	The first captured frame, the previous ones only serve to create the resources.
+		uint32_t firstFrame{ 0u };
+		//!\~french		Le nombre de frames capturées, le fichier est fermé après la dernière.
+		//!\~english	The captured frames count, the file is closed after the last one.
+		uint32_t frameCount{ 1u };
+	};
+	/**
+	*\~french
+	*\brief
+	*	Ecrit les chunks d'une capture dans son fichier.
+	*\remarks
+	*	Les chunks sont écrits depuis la création du périphérique, jusqu'à la fin de la dernière frame capturée.
+	*\~english
+	*\brief
+	*	Writes a capture's chunks into its file.
+	*\remarks
+	*	The chunks are written from the device creation, up to the end of the last captured frame.
+	*/
+	class Writer
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur, ouvre le fichier et écrit l'en-tête.
+		*\param[in] options
+		*	Les options de la capture.
+		*\param[in] rendererName
+		*	Le nom du renderer capturé.
+		*\~english
+		*\brief
+		*	Constructor, opens the file and writes the header.
+		*\param[in] options
+		*	The capture options.
+		*\param[in] rendererName
+		*	The captured renderer's name.
+		*/
+		Writer( CaptureOptions const & options
+			, std::string const & rendererName );
+		/**
+		*\~french
+		*\return
+		*	Un nouvel identifiant d'objet.
+		*\~english
+		*\return
+		*	A new object identifier.
+		*/
+		ObjectId registerObject();
+		/**
+		*\~french
+		*\brief
+		*	Ecrit un chunk.
+		*\param[in] type
+		*	Le type du chunk.
+		*\param[in] payload
+		*	Son contenu.
+		*\~english
+		*\brief
+		*	Writes a chunk.
+		*\param[in] type
+		*	The chunk type.
+		*\param[in] payload
+		*	Its content.
+		*/
+		void write( ChunkType type
+			, OutputStream const & payload );
+		/**
+		*\~french
+		*\brief
+		*	Termine la frame courante, et ferme le fichier si c'était la dernière capturée.
+		*\~english
+		*\brief
+		*	Ends the current frame, and closes the file if it was the last captured one.
+		*/
+		void endFrame();
+		/**
+		*\~french
+		*\brief
+		*	Ecrit un chunk dont le contenu est donné par les paramètres.
+		*\~english
+		*\brief
+		*	Writes a chunk which content is given by the parameters.
+		*/
+		template< typename ... ParamsT >
+		inline void writeChunk( ChunkType type
+			, ParamsT const & ... params )
+		{
+			if ( isCapturing() )
+			{
+				OutputStream stream;
+				( stream.write( params ), ... );
+				write( type, stream );
+			}
+		}
+		/**
+		*\~french
+		*\return
+		*	\p true si le fichier est encore ouvert.
+		*\~english
+		*\return
+		*	\p true if the file is still opened.
+		*/
+		inline bool isCapturing()const
+		{
+			return m_capturing;
+		}
+
+	private:
+		CaptureOptions m_options;
+		std::ofstream m_file;
+		std::mutex m_mutex;
+		std::atomic< bool > m_capturing{ false };
+		std::atomic< ObjectId > m_nextId{ ExternalObject + 1u };
+		uint32_t m_frame{ 0u };
+	};
+}
@@ -0,0 +1,23 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Pipeline/CaptureComputePipeline.hpp"
+
+#include "Core/CaptureDevice.hpp"
+#include "Pipeline/CapturePipelineLayout.hpp"
+
+namespace capture_renderer
+{
+	ComputePipeline::ComputePipeline( Device const & device
+		, PipelineLayout const & layout
+		, renderer::ComputePipelineCreateInfo && createInfo
+		, renderer::ComputePipelinePtr && inner )
+		: renderer::ComputePipeline{ device
+			, layout
+			, std::move( createInfo ) }
+		, Object{ device.getWriter() }
+		, m_inner{ std::move( inner ) }
+	{
+	}
+}
@@ -0,0 +1,70 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "Miscellaneous/CaptureObject.hpp"
+
+#include <Pipeline/ComputePipeline.hpp>
+
+namespace capture_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Pipeline de calcul enveloppant celui du renderer capturé.
+	*\~english
+	*\brief
+	*	Compute pipeline wrapping the captured renderer's one.
+	*/
+	class ComputePipeline
+		: public renderer::ComputePipeline
+		, public Object
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] layout
+		*	Le layout du pipeline.
+		*\param[in] createInfo
+		*	Les informations de création.
+		*\param[in] inner
+		*	Le pipeline capturé.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] layout
+		*	The pipeline layout.
+		*\param[in] createInfo
+		*	The creation informations.
+		*\param[in] inner
+		*	The captured pipeline.
+		*/
+		ComputePipeline( Device const & device
+			, PipelineLayout const & layout
+			, renderer::ComputePipelineCreateInfo && createInfo
+			, renderer::ComputePipelinePtr && inner );
+		/**
+		*\~french
+		*\return
+		*	Le pipeline capturé.
+		*\~english
+		*\return
+		*	The captured pipeline.
+		*/
+		inline renderer::ComputePipeline const & getInner()const
+		{
+			return *m_inner;
+		}
+
+	private:
+		renderer::ComputePipelinePtr m_inner;
+	};
+}
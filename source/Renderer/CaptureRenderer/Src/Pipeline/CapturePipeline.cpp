@@ -0,0 +1,23 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Pipeline/CapturePipeline.hpp"
+
+#include "Core/CaptureDevice.hpp"
+#include "Pipeline/CapturePipelineLayout.hpp"
+
+namespace capture_renderer
+{
+	Pipeline::Pipeline( Device const & device
+		, PipelineLayout const & layout
+		, renderer::GraphicsPipelineCreateInfo && createInfo
+		, renderer::PipelinePtr && inner )
+		: renderer::Pipeline{ device
+			, layout
+			, std::move( createInfo ) }
+		, Object{ device.getWriter() }
+		, m_inner{ std::move( inner ) }
+	{
+	}
+}
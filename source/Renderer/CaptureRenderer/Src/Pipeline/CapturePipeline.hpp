@@ -0,0 +1,70 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "Miscellaneous/CaptureObject.hpp"
+
+#include <Pipeline/Pipeline.hpp>
+
+namespace capture_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Pipeline graphique enveloppant celui du renderer capturé.
+	*\~english
+	*\brief
+	*	Graphics pipeline wrapping the captured renderer's one.
+	*/
+	class Pipeline
+		: public renderer::Pipeline
+		, public Object
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] layout
+		*	Le layout du pipeline.
+		*\param[in] createInfo
+		*	Les informations de création.
+		*\param[in] inner
+		*	Le pipeline capturé.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] layout
+		*	The pipeline layout.
+		*\param[in] createInfo
+		*	The creation informations.
+		*\param[in] inner
+		*	The captured pipeline.
+		*/
+		Pipeline( Device const & device
+			, PipelineLayout const & layout
+			, renderer::GraphicsPipelineCreateInfo && createInfo
+			, renderer::PipelinePtr && inner );
+		/**
+		*\~french
+		*\return
+		*	Le pipeline capturé.
+		*\~english
+		*\return
+		*	The captured pipeline.
+		*/
+		inline renderer::Pipeline const & getInner()const
+		{
+			return *m_inner;
+		}
+
+	private:
+		renderer::PipelinePtr m_inner;
+	};
+}
@@ -0,0 +1,138 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Pipeline/CapturePipelineLayout.hpp"
+
+#include "Core/CaptureDevice.hpp"
+#include "Pipeline/CaptureComputePipeline.hpp"
+#include "Pipeline/CapturePipeline.hpp"
+#include "RenderPass/CaptureRenderPass.hpp"
+#include "Shader/CaptureShaderModule.hpp"
+
+#include <Miscellaneous/ComputePipelineCreateInfo.hpp>
+#include <Miscellaneous/GraphicsPipelineCreateInfo.hpp>
+
+#include <cstring>
+
+namespace capture_renderer
+{
+	namespace
+	{
+		void writeStage( OutputStream & stream
+			, renderer::ShaderStageState const & stage )
+		{
+			stream.write( capture_renderer::getObjectId( stage.getModule() ) );
+			stream.write( stage.getEntryPoint() );
+			stream.write( stage.hasSpecialisationInfo() );
+
+			if ( stage.hasSpecialisationInfo() )
+			{
+				auto & info = stage.getSpecialisationInfo();
+				stream.write( renderer::SpecialisationMapEntryArray{ info.begin(), info.end() } );
+				stream.write( renderer::ByteArray{ info.getData(), info.getData() + info.getSize() } );
+			}
+		}
+
+		renderer::ShaderStageState unwrapStage( renderer::ShaderStageState & stage )
+		{
+			renderer::SpecialisationInfoBasePtr specialisationInfo;
+
+			if ( stage.hasSpecialisationInfo() )
+			{
+				auto & info = stage.getSpecialisationInfo();
+				specialisationInfo = std::make_unique< renderer::SpecialisationInfoBase >( renderer::SpecialisationMapEntryArray{ info.begin(), info.end() } );
+				std::memcpy( specialisationInfo->getData(), info.getData(), info.getSize() );
+			}
+
+			// The captured pipeline owns the captured module, the wrapper module stays in this pipeline.
+			return renderer::ShaderStageState
+			{
+				static_cast< ShaderModule & >( stage.getModule() ).releaseInner(),
+				std::move( specialisationInfo ),
+				stage.getEntryPoint(),
+			};
+		}
+	}
+
+	PipelineLayout::PipelineLayout( Device const & device
+		, renderer::PipelineLayoutPtr && inner
+		, renderer::DescriptorSetLayoutCRefArray const & setLayouts
+		, renderer::PushConstantRangeCRefArray const & pushConstantRanges )
+		: renderer::PipelineLayout{ device, setLayouts, pushConstantRanges }
+		, Object{ device.getWriter() }
+		, m_device{ device }
+		, m_inner{ std::move( inner ) }
+	{
+	}
+
+	renderer::PipelinePtr PipelineLayout::createPipeline( renderer::GraphicsPipelineCreateInfo && createInfo )const
+	{
+		std::vector< renderer::ShaderStageState > innerStages;
+		OutputStream stream;
+		stream.write( uint32_t( createInfo.stages.size() ) );
+
+		for ( auto & stage : createInfo.stages )
+		{
+			writeStage( stream, stage );
+			innerStages.push_back( unwrapStage( stage ) );
+		}
+
+		auto inner = m_inner->createPipeline( renderer::GraphicsPipelineCreateInfo
+		{
+			std::move( innerStages ),
+			unwrap< RenderPass >( createInfo.renderPass.get() ),
+			createInfo.vertexInputState,
+			createInfo.inputAssemblyState,
+			createInfo.rasterisationState,
+			createInfo.multisampleState,
+			createInfo.colourBlendState,
+			createInfo.depthStencilState,
+			createInfo.tessellationState,
+			createInfo.viewport,
+			createInfo.scissor,
+			createInfo.subpass,
+		} );
+		stream.write( capture_renderer::getObjectId( createInfo.renderPass.get() ) );
+		stream.write( createInfo.vertexInputState );
+		stream.write( createInfo.inputAssemblyState );
+		stream.write( createInfo.rasterisationState );
+		stream.write( createInfo.multisampleState );
+		stream.write( createInfo.colourBlendState );
+		stream.write( createInfo.depthStencilState );
+		stream.write( createInfo.tessellationState );
+		stream.write( createInfo.viewport );
+		stream.write( createInfo.scissor );
+		stream.write( createInfo.subpass );
+		auto result = std::make_unique< Pipeline >( m_device
+			, *this
+			, std::move( createInfo )
+			, std::move( inner ) );
+		OutputStream chunk;
+		chunk.write( result->getObjectId() );
+		chunk.write( getObjectId() );
+		chunk.writeBytes( stream.getData().data(), stream.getData().size() );
+		m_writer.write( ChunkType::eCreatePipeline, chunk );
+		return result;
+	}
+
+	renderer::ComputePipelinePtr PipelineLayout::createPipeline( renderer::ComputePipelineCreateInfo && createInfo )const
+	{
+		OutputStream stream;
+		writeStage( stream, createInfo.stage );
+		auto inner = m_inner->createPipeline( renderer::ComputePipelineCreateInfo
+		{
+			unwrapStage( createInfo.stage ),
+		} );
+		auto result = std::make_unique< ComputePipeline >( m_device
+			, *this
+			, std::move( createInfo )
+			, std::move( inner ) );
+		OutputStream chunk;
+		chunk.write( result->getObjectId() );
+		chunk.write( getObjectId() );
+		chunk.writeBytes( stream.getData().data(), stream.getData().size() );
+		m_writer.write( ChunkType::eCreateComputePipeline, chunk );
+		return result;
+	}
+}
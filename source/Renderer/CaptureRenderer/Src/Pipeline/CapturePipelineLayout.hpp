@@ -0,0 +1,79 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "Miscellaneous/CaptureObject.hpp"
+
+#include <Pipeline/PipelineLayout.hpp>
+
+namespace capture_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Layout de pipeline enveloppant celui du renderer capturé.
+	*\~english
+	*\brief
+	*	Pipeline layout wrapping the captured renderer's one.
+	*/
+	class PipelineLayout
+		: public renderer::PipelineLayout
+		, public Object
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] inner
+		*	Le layout capturé.
+		*\param[in] setLayouts
+		*	Les layouts des descripteurs du pipeline.
+		*\param[in] pushConstantRanges
+		*	Les intervalles de push constants.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] inner
+		*	The captured layout.
+		*\param[in] setLayouts
+		*	The pipeline's descriptor sets layouts.
+		*\param[in] pushConstantRanges
+		*	The push constants ranges.
+		*/
+		PipelineLayout( Device const & device
+			, renderer::PipelineLayoutPtr && inner
+			, renderer::DescriptorSetLayoutCRefArray const & setLayouts
+			, renderer::PushConstantRangeCRefArray const & pushConstantRanges );
+		/**
+		*\copydoc	renderer::PipelineLayout::createPipeline
+		*/
+		renderer::PipelinePtr createPipeline( renderer::GraphicsPipelineCreateInfo && createInfo )const override;
+		/**
+		*\copydoc	renderer::PipelineLayout::createPipeline
+		*/
+		renderer::ComputePipelinePtr createPipeline( renderer::ComputePipelineCreateInfo && createInfo )const override;
+		/**
+		*\~french
+		*\return
+		*	Le layout capturé.
+		*\~english
+		*\return
+		*	The captured layout.
+		*/
+		inline renderer::PipelineLayout const & getInner()const
+		{
+			return *m_inner;
+		}
+
+	private:
+		Device const & m_device;
+		renderer::PipelineLayoutPtr m_inner;
+	};
+}
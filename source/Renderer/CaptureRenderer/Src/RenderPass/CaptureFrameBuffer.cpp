@@ -0,0 +1,31 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "RenderPass/CaptureFrameBuffer.hpp"
+
+#include "Core/CaptureDevice.hpp"
+#include "RenderPass/CaptureRenderPass.hpp"
+
+#include <Image/Texture.hpp>
+#include <Image/TextureView.hpp>
+
+namespace capture_renderer
+{
+	FrameBuffer::FrameBuffer( Device const & device
+		, RenderPass const & renderPass
+		, renderer::UIVec2 const & dimensions
+		, renderer::FrameBufferAttachmentArray && attaches
+		, renderer::FrameBufferPtr && inner
+		, std::vector< renderer::TexturePtr > && textures
+		, std::vector< renderer::TextureViewPtr > && views )
+		: renderer::FrameBuffer{ renderPass
+			, dimensions
+			, std::move( attaches ) }
+		, Object{ device.getWriter() }
+		, m_inner{ std::move( inner ) }
+		, m_textures{ std::move( textures ) }
+		, m_views{ std::move( views ) }
+	{
+	}
+}
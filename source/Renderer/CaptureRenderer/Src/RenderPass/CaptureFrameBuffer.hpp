@@ -0,0 +1,83 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "Miscellaneous/CaptureObject.hpp"
+
+#include <RenderPass/FrameBuffer.hpp>
+
+namespace capture_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Tampon d'images enveloppant celui du renderer capturé.
+	*\~english
+	*\brief
+	*	Frame buffer wrapping the captured renderer's one.
+	*/
+	class FrameBuffer
+		: public renderer::FrameBuffer
+		, public Object
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] renderPass
+		*	La passe de rendu avec laquelle le tampon est compatible.
+		*\param[in] dimensions
+		*	Les dimensions du tampon.
+		*\param[in] attaches
+		*	Les attaches du tampon.
+		*\param[in] inner
+		*	Le tampon capturé.
+		*\param[in] textures, views
+		*	Les enveloppes des images d'une swap chain capturée, utilisées par les attaches.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] renderPass
+		*	The render pass with which the buffer is compatible.
+		*\param[in] dimensions
+		*	The buffer dimensions.
+		*\param[in] attaches
+		*	The buffer attachments.
+		*\param[in] inner
+		*	The captured buffer.
+		*\param[in] textures, views
+		*	The wrappers of a captured swap chain's images, used by the attaches.
+		*/
+		FrameBuffer( Device const & device
+			, RenderPass const & renderPass
+			, renderer::UIVec2 const & dimensions
+			, renderer::FrameBufferAttachmentArray && attaches
+			, renderer::FrameBufferPtr && inner
+			, std::vector< renderer::TexturePtr > && textures = {}
+			, std::vector< renderer::TextureViewPtr > && views = {} );
+		/**
+		*\~french
+		*\return
+		*	Le tampon capturé.
+		*\~english
+		*\return
+		*	The captured buffer.
+		*/
+		inline renderer::FrameBuffer const & getInner()const
+		{
+			return *m_inner;
+		}
+
+	private:
+		renderer::FrameBufferPtr m_inner;
+		std::vector< renderer::TexturePtr > m_textures;
+		std::vector< renderer::TextureViewPtr > m_views;
+	};
+}
@@ -0,0 +1,70 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "RenderPass/CaptureRenderPass.hpp"
+
+#include "Core/CaptureDevice.hpp"
+#include "Image/CaptureTextureView.hpp"
+#include "RenderPass/CaptureFrameBuffer.hpp"
+#include "RenderPass/CaptureRenderSubpass.hpp"
+
+#include <RenderPass/FrameBufferAttachment.hpp>
+
+namespace capture_renderer
+{
+	RenderPass::RenderPass( Device const & device
+		, renderer::RenderPassPtr && inner
+		, renderer::RenderPassAttachmentArray const & attaches
+		, renderer::RenderSubpassPtrArray && subpasses
+		, renderer::RenderSubpassState const & initialState
+		, renderer::RenderSubpassState const & finalState )
+		: renderer::RenderPass{ device
+			, attaches
+			, std::move( subpasses )
+			, initialState
+			, finalState }
+		, Object{ device.getWriter() }
+		, m_device{ device }
+		, m_inner{ std::move( inner ) }
+	{
+	}
+
+	renderer::FrameBufferPtr RenderPass::createFrameBuffer( renderer::UIVec2 const & dimensions
+		, renderer::FrameBufferAttachmentArray && attaches )const
+	{
+		renderer::FrameBufferAttachmentArray innerAttaches;
+		renderer::UInt32Array indices;
+		std::vector< ObjectId > views;
+
+		for ( auto & attach : attaches )
+		{
+			// The attaches refer to this pass' ones, the captured pass' ones are at the same index.
+			auto index = size_t( &attach.getAttachment() - getAttaches().data() );
+
+			if ( index >= getSize() )
+			{
+				throw std::runtime_error{ "The frame buffer attach doesn't belong to the render pass" };
+			}
+
+			innerAttaches.emplace_back( m_inner->getAttaches()[index]
+				, unwrap< TextureView >( attach.getView() ) );
+			indices.push_back( uint32_t( index ) );
+			views.push_back( capture_renderer::getObjectId( attach.getView() ) );
+		}
+
+		auto result = std::make_unique< FrameBuffer >( m_device
+			, *this
+			, dimensions
+			, std::move( attaches )
+			, m_inner->createFrameBuffer( dimensions
+				, std::move( innerAttaches ) ) );
+		m_writer.writeChunk( ChunkType::eCreateFrameBuffer
+			, result->getObjectId()
+			, getObjectId()
+			, dimensions
+			, indices
+			, views );
+		return result;
+	}
+}
@@ -0,0 +1,86 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "Miscellaneous/CaptureObject.hpp"
+
+#include <RenderPass/RenderPass.hpp>
+
+namespace capture_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Passe de rendu enveloppant celle du renderer capturé.
+	*\~english
+	*\brief
+	*	Render pass wrapping the captured renderer's one.
+	*/
+	class RenderPass
+		: public renderer::RenderPass
+		, public Object
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] inner
+		*	La passe capturée.
+		*\param[in] attaches
+		*	Les attaches de la passe.
+		*\param[in] subpasses
+		*	Les sous-passes, dont les sous-passes capturées ont été cédées.
+		*\param[in] initialState
+		*	L'état voulu en début de passe.
+		*\param[in] finalState
+		*	L'état attendu en fin de passe.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] inner
+		*	The captured pass.
+		*\param[in] attaches
+		*	The pass attachments.
+		*\param[in] subpasses
+		*	The subpasses, which captured subpasses have been given away.
+		*\param[in] initialState
+		*	The state wanted at the beginning of the pass.
+		*\param[in] finalState
+		*	The state attained at the end of the pass.
+		*/
+		RenderPass( Device const & device
+			, renderer::RenderPassPtr && inner
+			, renderer::RenderPassAttachmentArray const & attaches
+			, renderer::RenderSubpassPtrArray && subpasses
+			, renderer::RenderSubpassState const & initialState
+			, renderer::RenderSubpassState const & finalState );
+		/**
+		*\copydoc	renderer::RenderPass::createFrameBuffer
+		*/
+		renderer::FrameBufferPtr createFrameBuffer( renderer::UIVec2 const & dimensions
+			, renderer::FrameBufferAttachmentArray && attaches )const override;
+		/**
+		*\~french
+		*\return
+		*	La passe capturée.
+		*\~english
+		*\return
+		*	The captured pass.
+		*/
+		inline renderer::RenderPass const & getInner()const
+		{
+			return *m_inner;
+		}
+
+	private:
+		Device const & m_device;
+		renderer::RenderPassPtr m_inner;
+	};
+}
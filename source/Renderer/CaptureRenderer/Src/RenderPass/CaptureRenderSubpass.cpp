@@ -0,0 +1,50 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "RenderPass/CaptureRenderSubpass.hpp"
+
+#include "Core/CaptureDevice.hpp"
+
+namespace capture_renderer
+{
+	RenderSubpass::RenderSubpass( Device const & device
+		, renderer::RenderSubpassPtr && inner
+		, renderer::PipelineBindPoint pipelineBindPoint
+		, renderer::RenderSubpassState const & state
+		, renderer::RenderSubpassAttachmentArray const & inputAttaches
+		, renderer::RenderSubpassAttachmentArray const & colourAttaches
+		, renderer::RenderSubpassAttachmentArray const & resolveAttaches
+		, renderer::RenderSubpassAttachment const * depthAttach
+		, renderer::UInt32Array const & preserveAttaches )
+		: renderer::RenderSubpass{ device
+			, pipelineBindPoint
+			, state
+			, inputAttaches
+			, colourAttaches
+			, resolveAttaches
+			, depthAttach
+			, preserveAttaches }
+		, m_inner{ std::move( inner ) }
+		, m_pipelineBindPoint{ pipelineBindPoint }
+		, m_state{ state }
+		, m_resolveAttaches{ resolveAttaches }
+		, m_preserveAttaches{ preserveAttaches }
+	{
+		if ( depthAttach )
+		{
+			m_depthAttach = *depthAttach;
+		}
+	}
+
+	void RenderSubpass::write( OutputStream & stream )const
+	{
+		stream.write( m_pipelineBindPoint );
+		stream.write( m_state );
+		stream.write( getInputAttaches() );
+		stream.write( getColourAttaches() );
+		stream.write( m_resolveAttaches );
+		stream.write( m_depthAttach );
+		stream.write( m_preserveAttaches );
+	}
+}
@@ -0,0 +1,118 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "CaptureRendererPrerequisites.hpp"
+
+#include <RenderPass/RenderSubpass.hpp>
+#include <RenderPass/RenderSubpassAttachment.hpp>
+#include <RenderPass/RenderSubpassState.hpp>
+
+namespace capture_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Sous-passe de rendu enveloppant celle du renderer capturé.
+	*\remarks
+	*	La sous-passe capturée est cédée à la passe de rendu capturée, lors de la création de celle-ci.
+	*\~english
+	*\brief
+	*	Render subpass wrapping the captured renderer's one.
+	*\remarks
+	*	The captured subpass is given to the captured render pass, when the latter is created.
+	*/
+	class RenderSubpass
+		: public renderer::RenderSubpass
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] inner
+		*	La sous-passe capturée.
+		*\param[in] pipelineBindPoint
+		*	Le point d'attache du pipeline.
+		*\param[in] state
+		*	L'état voulu en début de sous-passe.
+		*\param[in] inputAttaches
+		*	Les attaches en entrée.
+		*\param[in] colourAttaches
+		*	Les attaches couleur.
+		*\param[in] resolveAttaches
+		*	Les attaches de résolution.
+		*\param[in] depthAttach
+		*	L'attache profondeur et/ou stencil.
+		*\param[in] preserveAttaches
+		*	Les indices des attaches à préserver.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] inner
+		*	The captured subpass.
+		*\param[in] pipelineBindPoint
+		*	The pipeline bind point.
+		*\param[in] state
+		*	The state wanted at the beginning of the subpass.
+		*\param[in] inputAttaches
+		*	The input attachments.
+		*\param[in] colourAttaches
+		*	The colour attachments.
+		*\param[in] resolveAttaches
+		*	The resolve attachments.
+		*\param[in] depthAttach
+		*	The depth and/or stencil attachment.
+		*\param[in] preserveAttaches
+		*	The indices of the attachments to preserve.
+		*/
+		RenderSubpass( Device const & device
+			, renderer::RenderSubpassPtr && inner
+			, renderer::PipelineBindPoint pipelineBindPoint
+			, renderer::RenderSubpassState const & state
+			, renderer::RenderSubpassAttachmentArray const & inputAttaches
+			, renderer::RenderSubpassAttachmentArray const & colourAttaches
+			, renderer::RenderSubpassAttachmentArray const & resolveAttaches
+			, renderer::RenderSubpassAttachment const * depthAttach
+			, renderer::UInt32Array const & preserveAttaches );
+		/**
+		*\~french
+		*\brief
+		*	Ecrit les paramètres de création de la sous-passe.
+		*\param[in,out] stream
+		*	Le flux recevant les paramètres.
+		*\~english
+		*\brief
+		*	Writes the subpass creation parameters.
+		*\param[in,out] stream
+		*	The stream receiving the parameters.
+		*/
+		void write( OutputStream & stream )const;
+		/**
+		*\~french
+		*\brief
+		*	Cède la sous-passe capturée.
+		*\~english
+		*\brief
+		*	Gives the captured subpass away.
+		*/
+		inline renderer::RenderSubpassPtr releaseInner()
+		{
+			return std::move( m_inner );
+		}
+
+	private:
+		renderer::RenderSubpassPtr m_inner;
+		renderer::PipelineBindPoint m_pipelineBindPoint;
+		renderer::RenderSubpassState m_state;
+		renderer::RenderSubpassAttachmentArray m_resolveAttaches;
+		std::optional< renderer::RenderSubpassAttachment > m_depthAttach;
+		renderer::UInt32Array m_preserveAttaches;
+	};
+}
@@ -0,0 +1,1397 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Replay/CapturePlayer.hpp"
+
+#include "Image/CaptureTexture.hpp"
+
+#include <Buffer/Buffer.hpp>
+#include <Buffer/BufferView.hpp>
+#include <Buffer/PushConstantsBuffer.hpp>
+#include <Buffer/UniformBuffer.hpp>
+#include <Command/CommandBuffer.hpp>
+#include <Command/CommandBufferInheritanceInfo.hpp>
+#include <Command/CommandPool.hpp>
+#include <Command/Queue.hpp>
+#include <Core/Device.hpp>
+#include <Descriptor/DescriptorSet.hpp>
+#include <Descriptor/DescriptorSetLayout.hpp>
+#include <Descriptor/DescriptorSetLayoutBinding.hpp>
+#include <Descriptor/DescriptorSetPool.hpp>
+#include <Image/Sampler.hpp>
+#include <Image/Texture.hpp>
+#include <Image/TextureView.hpp>
+#include <Miscellaneous/ComputePipelineCreateInfo.hpp>
+#include <Miscellaneous/GraphicsPipelineCreateInfo.hpp>
+#include <Miscellaneous/PushConstantRange.hpp>
+#include <Miscellaneous/QueryPool.hpp>
+#include <Pipeline/ComputePipeline.hpp>
+#include <Pipeline/Pipeline.hpp>
+#include <Pipeline/PipelineLayout.hpp>
+#include <RenderPass/FrameBuffer.hpp>
+#include <RenderPass/FrameBufferAttachment.hpp>
+#include <RenderPass/RenderPass.hpp>
+#include <RenderPass/ClearAttachment.hpp>
+#include <RenderPass/ClearRect.hpp>
+#include <RenderPass/RenderSubpass.hpp>
+#include <RenderPass/RenderSubpassState.hpp>
+#include <Shader/ShaderModule.hpp>
+#include <Sync/BufferMemoryBarrier.hpp>
+#include <Sync/ImageMemoryBarrier.hpp>
+
+#include <cstring>
+#include <fstream>
+
+namespace capture_renderer
+{
+	namespace
+	{
+		// Thrown when a chunk or a command uses an object that wasn't captured.
+		struct UnknownObject
+			: std::runtime_error
+		{
+			using std::runtime_error::runtime_error;
+		};
+
+		InputStream readSubStream( InputStream & stream )
+		{
+			auto size = stream.read< uint32_t >();
+			return InputStream{ stream.readBytes( size ), size };
+		}
+	}
+
+	Player::Player( renderer::Device const & device
+		, std::string const & fileName )
+		: m_device{ device }
+	{
+		doReadFile( fileName );
+	}
+
+	Player::~Player()
+	{
+		m_device.waitIdle();
+		m_shaderModules.clear();
+
+		while ( !m_owners.empty() )
+		{
+			m_owners.erase( std::prev( m_owners.end() ) );
+		}
+	}
+
+	Player::FrameTimes Player::play( uint32_t loops )
+	{
+		FrameTimes result;
+
+		if ( !m_created )
+		{
+			// The first pass creates the objects.
+			for ( auto & chunk : m_setup )
+			{
+				doPlayChunk( chunk, true, true );
+			}
+
+			for ( auto & chunk : m_frames )
+			{
+				doPlayChunk( chunk, true, false );
+			}
+
+			m_created = true;
+		}
+
+		m_frameTimes = &result;
+
+		for ( uint32_t loop = 0u; loop < loops; ++loop )
+		{
+			m_frameStart = Clock::now();
+
+			for ( auto & chunk : m_frames )
+			{
+				doPlayChunk( chunk, false, false );
+			}
+		}
+
+		m_frameTimes = nullptr;
+		doWaitIdle();
+		return result;
+	}
+
+	void Player::doReadFile( std::string const & fileName )
+	{
+		std::ifstream file{ fileName, std::ios::binary };
+
+		if ( !file )
+		{
+			throw std::runtime_error{ "Couldn't open the capture file " + fileName };
+		}
+
+		m_data.assign( std::istreambuf_iterator< char >{ file }
+			, std::istreambuf_iterator< char >{} );
+		InputStream stream{ m_data.data(), m_data.size() };
+		m_header = stream.read< CaptureHeader >();
+
+		if ( m_header.magic != CaptureMagic )
+		{
+			throw std::runtime_error{ fileName + " is not a capture file" };
+		}
+
+		if ( m_header.version != CaptureVersion )
+		{
+			throw std::runtime_error{ "Unsupported capture version " + std::to_string( m_header.version ) };
+		}
+
+		m_rendererName = stream.readString();
+		auto setup = m_header.firstFrame > 0u;
+
+		while ( !stream.isEnd() )
+		{
+			auto header = stream.read< ChunkHeader >();
+			Chunk chunk{ header.type, stream.readBytes( header.size ), header.size };
+
+			if ( setup )
+			{
+				m_setup.push_back( chunk );
+
+				if ( chunk.type == ChunkType::eFrame )
+				{
+					InputStream frame{ chunk.data, chunk.size };
+					setup = frame.read< uint32_t >() + 1u < m_header.firstFrame;
+				}
+			}
+			else
+			{
+				m_frames.push_back( chunk );
+			}
+		}
+
+		if ( m_frames.empty() )
+		{
+			throw std::runtime_error{ "The capture doesn't contain any frame of the captured range" };
+		}
+	}
+
+	void Player::doPlayChunk( Chunk const & chunk
+		, bool create
+		, bool setup )
+	{
+		InputStream stream{ chunk.data, chunk.size };
+
+		try
+		{
+			switch ( chunk.type )
+			{
+			case ChunkType::eDestroy:
+				// The objects destroyed during the frames range are needed by the next passes.
+				if ( setup )
+				{
+					doDestroy( stream.read< ObjectId >() );
+				}
+				break;
+
+			case ChunkType::eBufferData:
+				doBufferData( stream );
+				break;
+
+			case ChunkType::eRecord:
+				doRecord( stream );
+				break;
+
+			case ChunkType::eSubmit:
+				doSubmit( stream );
+				break;
+
+			case ChunkType::eFrame:
+				doWaitIdle();
+
+				if ( !setup && m_frameTimes )
+				{
+					auto end = Clock::now();
+					m_frameTimes->push_back( std::chrono::duration_cast< std::chrono::nanoseconds >( end - m_frameStart ) );
+					m_frameStart = end;
+				}
+				break;
+
+			default:
+				if ( create )
+				{
+					doCreate( chunk.type, stream );
+				}
+				break;
+			}
+		}
+		catch ( UnknownObject & )
+		{
+			++m_skipped;
+		}
+	}
+
+	void Player::doCreate( ChunkType type
+		, InputStream & stream )
+	{
+		switch ( type )
+		{
+		case ChunkType::eCreateBuffer:
+			{
+				auto id = stream.read< ObjectId >();
+				auto size = stream.read< uint32_t >();
+				auto targets = stream.read< renderer::BufferTargets >();
+				auto memoryFlags = stream.read< renderer::MemoryPropertyFlags >();
+				doRegister( m_buffers
+					, id
+					, m_device.createBuffer( size, targets, memoryFlags ) );
+			}
+			break;
+
+		case ChunkType::eCreateUniformBuffer:
+			{
+				auto id = stream.read< ObjectId >();
+				auto bufferId = stream.read< ObjectId >();
+				auto count = stream.read< uint32_t >();
+				auto size = stream.read< uint32_t >();
+				auto targets = stream.read< renderer::BufferTargets >();
+				auto memoryFlags = stream.read< renderer::MemoryPropertyFlags >();
+				auto & uniformBuffer = doRegister( m_uniformBuffers
+					, id
+					, m_device.createUniformBuffer( count, size, targets, memoryFlags ) );
+				m_buffers[bufferId] = &uniformBuffer.getBuffer();
+			}
+			break;
+
+		case ChunkType::eCreateBufferView:
+			{
+				auto id = stream.read< ObjectId >();
+				auto bufferId = stream.read< ObjectId >();
+				auto format = stream.read< renderer::PixelFormat >();
+				auto offset = stream.read< uint32_t >();
+				auto range = stream.read< uint32_t >();
+				doRegister( m_bufferViews
+					, id
+					, m_device.createBufferView( doGet( m_buffers, bufferId ), format, offset, range ) );
+			}
+			break;
+
+		case ChunkType::eCreateTexture:
+			{
+				auto id = stream.read< ObjectId >();
+				auto initialLayout = stream.read< renderer::ImageLayout >();
+				doRegister( m_textures
+					, id
+					, m_device.createTexture( initialLayout ) );
+			}
+			break;
+
+		case ChunkType::eSetImage:
+			{
+				auto id = stream.read< ObjectId >();
+				auto textureType = stream.read< renderer::TextureType >();
+				auto format = stream.read< renderer::PixelFormat >();
+				auto dimensions = stream.read< renderer::UIVec3 >();
+				auto layerCount = stream.read< uint32_t >();
+				auto mipmapLevels = stream.read< uint32_t >();
+				auto samples = stream.read< renderer::SampleCountFlag >();
+				auto usageFlags = stream.read< renderer::ImageUsageFlags >();
+				auto tiling = stream.read< renderer::ImageTiling >();
+				auto memoryFlags = stream.read< renderer::MemoryPropertyFlags >();
+				setImage( doGet( m_textures, id )
+					, textureType
+					, format
+					, dimensions
+					, layerCount
+					, mipmapLevels
+					, samples
+					, usageFlags
+					, tiling
+					, memoryFlags );
+			}
+			break;
+
+		case ChunkType::eCreateTextureView:
+			{
+				auto id = stream.read< ObjectId >();
+				auto textureId = stream.read< ObjectId >();
+				auto textureType = stream.read< renderer::TextureType >();
+				auto format = stream.read< renderer::PixelFormat >();
+				auto baseMipLevel = stream.read< uint32_t >();
+				auto levelCount = stream.read< uint32_t >();
+				auto baseArrayLayer = stream.read< uint32_t >();
+				auto layerCount = stream.read< uint32_t >();
+				auto mapping = stream.read< renderer::ComponentMapping >();
+				doRegister( m_views
+					, id
+					, doGet( m_textures, textureId ).createView( textureType
+						, format
+						, baseMipLevel
+						, levelCount
+						, baseArrayLayer
+						, layerCount
+						, mapping ) );
+			}
+			break;
+
+		case ChunkType::eCreateSampler:
+			{
+				auto id = stream.read< ObjectId >();
+				auto wrapS = stream.read< renderer::WrapMode >();
+				auto wrapT = stream.read< renderer::WrapMode >();
+				auto wrapR = stream.read< renderer::WrapMode >();
+				auto minFilter = stream.read< renderer::Filter >();
+				auto magFilter = stream.read< renderer::Filter >();
+				auto mipFilter = stream.read< renderer::MipmapMode >();
+				auto minLod = stream.read< float >();
+				auto maxLod = stream.read< float >();
+				auto lodBias = stream.read< float >();
+				auto borderColour = stream.read< renderer::BorderColour >();
+				auto maxAnisotropy = stream.read< float >();
+				auto compareOp = stream.read< renderer::CompareOp >();
+				doRegister( m_samplers
+					, id
+					, m_device.createSampler( wrapS
+						, wrapT
+						, wrapR
+						, minFilter
+						, magFilter
+						, mipFilter
+						, minLod
+						, maxLod
+						, lodBias
+						, borderColour
+						, maxAnisotropy
+						, compareOp ) );
+			}
+			break;
+
+		case ChunkType::eCreateRenderPass:
+			doCreateRenderPass( stream );
+			break;
+
+		case ChunkType::eCreateFrameBuffer:
+			doCreateFrameBuffer( stream );
+			break;
+
+		case ChunkType::eCreateSwapChain:
+			// The swap chains images are replaced by offscreen textures.
+			break;
+
+		case ChunkType::eCreateSwapChainFrameBuffers:
+			doCreateSwapChainFrameBuffers( stream );
+			break;
+
+		case ChunkType::eCreateDescriptorSetLayout:
+			{
+				auto id = stream.read< ObjectId >();
+				auto bindings = stream.readArray< renderer::DescriptorSetLayoutBinding >();
+				doRegister( m_setLayouts
+					, id
+					, m_device.createDescriptorSetLayout( std::move( bindings ) ) );
+			}
+			break;
+
+		case ChunkType::eCreateDescriptorSetPool:
+			{
+				auto id = stream.read< ObjectId >();
+				auto layoutId = stream.read< ObjectId >();
+				auto maxSets = stream.read< uint32_t >();
+				auto automaticFree = stream.read< bool >();
+				doRegister( m_setPools
+					, id
+					, doGet( m_setLayouts, layoutId ).createPool( maxSets, automaticFree ) );
+			}
+			break;
+
+		case ChunkType::eCreateDescriptorSet:
+			{
+				auto id = stream.read< ObjectId >();
+				auto poolId = stream.read< ObjectId >();
+				auto bindingPoint = stream.read< uint32_t >();
+				auto & pool = doGet( m_setPools, poolId );
+				doRegister( m_sets
+					, id
+					, pool.createDescriptorSet( bindingPoint ) );
+				m_setsLayouts[id] = &pool.getLayout();
+			}
+			break;
+
+		case ChunkType::eCreateBinding:
+			doCreateBinding( stream );
+			break;
+
+		case ChunkType::eUpdateDescriptorSet:
+			doGet( m_sets, stream.read< ObjectId >() ).update();
+			break;
+
+		case ChunkType::eCreatePipelineLayout:
+			doCreatePipelineLayout( stream );
+			break;
+
+		case ChunkType::eCreateShaderModule:
+			{
+				auto id = stream.read< ObjectId >();
+				auto stage = stream.read< renderer::ShaderStageFlag >();
+				m_shaderModules.emplace( id, m_device.createShaderModule( stage ) );
+			}
+			break;
+
+		case ChunkType::eLoadShader:
+			{
+				auto id = stream.read< ObjectId >();
+				auto isSpirV = stream.read< bool >();
+				auto it = m_shaderModules.find( id );
+
+				if ( it == m_shaderModules.end() )
+				{
+					throw UnknownObject{ "Unknown shader module" };
+				}
+
+				if ( isSpirV )
+				{
+					it->second->loadShader( stream.readArray< uint8_t >() );
+				}
+				else
+				{
+					it->second->loadShader( stream.readString() );
+				}
+			}
+			break;
+
+		case ChunkType::eCreatePipeline:
+			doCreatePipeline( stream );
+			break;
+
+		case ChunkType::eCreateComputePipeline:
+			doCreateComputePipeline( stream );
+			break;
+
+		case ChunkType::eCreateCommandPool:
+			{
+				auto id = stream.read< ObjectId >();
+				stream.read< uint32_t >();
+				auto flags = stream.read< renderer::CommandPoolCreateFlags >();
+				// The queue families differ between the renderers, and the command buffers are recorded again on each pass.
+				doRegister( m_commandPools
+					, id
+					, m_device.createCommandPool( m_device.getGraphicsQueue().getFamilyIndex()
+						, flags | renderer::CommandPoolCreateFlag::eResetCommandBuffer ) );
+			}
+			break;
+
+		case ChunkType::eCreateCommandBuffer:
+			{
+				auto id = stream.read< ObjectId >();
+				auto poolId = stream.read< ObjectId >();
+				auto primary = stream.read< bool >();
+				doRegister( m_commandBuffers
+					, id
+					, doGet( m_commandPools, poolId ).createCommandBuffer( primary ) );
+			}
+			break;
+
+		case ChunkType::eCreateQueryPool:
+			{
+				auto id = stream.read< ObjectId >();
+				auto queryType = stream.read< renderer::QueryType >();
+				auto count = stream.read< uint32_t >();
+				auto pipelineStatistics = stream.read< renderer::QueryPipelineStatisticFlags >();
+				doRegister( m_queryPools
+					, id
+					, m_device.createQueryPool( queryType, count, pipelineStatistics ) );
+			}
+			break;
+
+		default:
+			throw std::runtime_error{ "Unsupported chunk type " + std::to_string( uint32_t( type ) ) };
+		}
+	}
+
+	void Player::doCreateRenderPass( InputStream & stream )
+	{
+		auto id = stream.read< ObjectId >();
+		auto attaches = stream.readArray< renderer::RenderPassAttachment >();
+		auto subpassesStream = readSubStream( stream );
+		auto initialState = stream.read< renderer::RenderSubpassState >();
+		auto finalState = stream.read< renderer::RenderSubpassState >();
+		renderer::RenderSubpassPtrArray subpasses;
+
+		while ( !subpassesStream.isEnd() )
+		{
+			auto pipelineBindPoint = subpassesStream.read< renderer::PipelineBindPoint >();
+			auto state = subpassesStream.read< renderer::RenderSubpassState >();
+			auto inputAttaches = subpassesStream.readArray< renderer::RenderSubpassAttachment >();
+			auto colourAttaches = subpassesStream.readArray< renderer::RenderSubpassAttachment >();
+			auto resolveAttaches = subpassesStream.readArray< renderer::RenderSubpassAttachment >();
+			auto depthAttach = subpassesStream.readOptional< renderer::RenderSubpassAttachment >();
+			auto preserveAttaches = subpassesStream.readArray< uint32_t >();
+			subpasses.push_back( m_device.createRenderSubpass( pipelineBindPoint
+				, state
+				, inputAttaches
+				, colourAttaches
+				, resolveAttaches
+				, depthAttach
+					? &*depthAttach
+					: nullptr
+				, preserveAttaches ) );
+		}
+
+		doRegister( m_renderPasses
+			, id
+			, m_device.createRenderPass( attaches
+				, std::move( subpasses )
+				, initialState
+				, finalState ) );
+	}
+
+	void Player::doCreateFrameBuffer( InputStream & stream )
+	{
+		auto id = stream.read< ObjectId >();
+		auto renderPassId = stream.read< ObjectId >();
+		auto dimensions = stream.read< renderer::UIVec2 >();
+		auto indices = stream.readArray< uint32_t >();
+		auto views = stream.readArray< ObjectId >();
+		auto & renderPass = doGet( m_renderPasses, renderPassId );
+		renderer::FrameBufferAttachmentArray attaches;
+
+		for ( size_t i = 0u; i < indices.size(); ++i )
+		{
+			attaches.emplace_back( renderPass.getAttaches()[indices[i]]
+				, doGet( m_views, views[i] ) );
+		}
+
+		doRegister( m_frameBuffers
+			, id
+			, renderPass.createFrameBuffer( dimensions, std::move( attaches ) ) );
+	}
+
+	void Player::doCreateSwapChainFrameBuffers( InputStream & stream )
+	{
+		stream.read< ObjectId >();
+		auto & renderPass = doGet( m_renderPasses, stream.read< ObjectId >() );
+		auto count = stream.read< uint32_t >();
+
+		for ( uint32_t i = 0u; i < count; ++i )
+		{
+			auto id = stream.read< ObjectId >();
+			auto dimensions = stream.read< renderer::UIVec2 >();
+			auto attachCount = stream.read< uint32_t >();
+			renderer::FrameBufferAttachmentArray attaches;
+
+			for ( uint32_t j = 0u; j < attachCount; ++j )
+			{
+				auto index = stream.read< uint32_t >();
+				auto textureId = stream.read< ObjectId >();
+				auto viewId = stream.read< ObjectId >();
+				auto format = stream.read< renderer::PixelFormat >();
+				auto & texture = doRegister( m_textures
+					, textureId
+					, m_device.createTexture() );
+				setImage( texture
+					, renderer::TextureType::e2D
+					, format
+					, renderer::UIVec3{ dimensions[0], dimensions[1], 1u }
+					, 1u
+					, 1u
+					, renderer::SampleCountFlag::e1
+					, ( renderer::isDepthOrStencilFormat( format )
+						? renderer::ImageUsageFlags( renderer::ImageUsageFlag::eDepthStencilAttachment )
+						: renderer::ImageUsageFlag::eColourAttachment | renderer::ImageUsageFlag::eSampled | renderer::ImageUsageFlag::eTransferSrc )
+					, renderer::ImageTiling::eOptimal
+					, renderer::MemoryPropertyFlag::eDeviceLocal );
+				auto & view = doRegister( m_views
+					, viewId
+					, texture.createView( renderer::TextureType::e2D, format ) );
+				attaches.emplace_back( renderPass.getAttaches()[index], view );
+			}
+
+			doRegister( m_frameBuffers
+				, id
+				, renderPass.createFrameBuffer( dimensions, std::move( attaches ) ) );
+		}
+	}
+
+	void Player::doCreateBinding( InputStream & stream )
+	{
+		auto setId = stream.read< ObjectId >();
+		auto bindingType = stream.read< BindingType >();
+		auto bindingIndex = stream.read< uint32_t >();
+		auto & descriptorSet = doGet( m_sets, setId );
+		auto & layoutBinding = doGet( m_setsLayouts, setId ).getBindings()[bindingIndex];
+
+		switch ( bindingType )
+		{
+		case BindingType::eCombinedTextureSampler:
+			{
+				auto viewId = stream.read< ObjectId >();
+				auto samplerId = stream.read< ObjectId >();
+				auto layout = stream.read< renderer::ImageLayout >();
+				auto index = stream.read< uint32_t >();
+				descriptorSet.createBinding( layoutBinding
+					, doGet( m_views, viewId )
+					, doGet( m_samplers, samplerId )
+					, layout
+					, index );
+			}
+			break;
+
+		case BindingType::eSampler:
+			{
+				auto samplerId = stream.read< ObjectId >();
+				auto index = stream.read< uint32_t >();
+				descriptorSet.createBinding( layoutBinding
+					, doGet( m_samplers, samplerId )
+					, index );
+			}
+			break;
+
+		case BindingType::eSampledTexture:
+			{
+				auto viewId = stream.read< ObjectId >();
+				auto layout = stream.read< renderer::ImageLayout >();
+				auto index = stream.read< uint32_t >();
+				descriptorSet.createBinding( layoutBinding
+					, doGet( m_views, viewId )
+					, layout
+					, index );
+			}
+			break;
+
+		case BindingType::eStorageTexture:
+			{
+				auto viewId = stream.read< ObjectId >();
+				auto index = stream.read< uint32_t >();
+				descriptorSet.createBinding( layoutBinding
+					, doGet( m_views, viewId )
+					, index );
+			}
+			break;
+
+		case BindingType::eUniformBuffer:
+		case BindingType::eDynamicUniformBuffer:
+			{
+				auto uniformBufferId = stream.read< ObjectId >();
+				auto offset = stream.read< uint32_t >();
+				auto range = stream.read< uint32_t >();
+				auto index = stream.read< uint32_t >();
+
+				if ( bindingType == BindingType::eUniformBuffer )
+				{
+					descriptorSet.createBinding( layoutBinding
+						, doGet( m_uniformBuffers, uniformBufferId )
+						, offset
+						, range
+						, index );
+				}
+				else
+				{
+					descriptorSet.createDynamicBinding( layoutBinding
+						, doGet( m_uniformBuffers, uniformBufferId )
+						, offset
+						, range
+						, index );
+				}
+			}
+			break;
+
+		case BindingType::eStorageBuffer:
+		case BindingType::eDynamicStorageBuffer:
+			{
+				auto bufferId = stream.read< ObjectId >();
+				auto offset = stream.read< uint32_t >();
+				auto range = stream.read< uint32_t >();
+				auto index = stream.read< uint32_t >();
+
+				if ( bindingType == BindingType::eStorageBuffer )
+				{
+					descriptorSet.createBinding( layoutBinding
+						, doGet( m_buffers, bufferId )
+						, offset
+						, range
+						, index );
+				}
+				else
+				{
+					descriptorSet.createDynamicBinding( layoutBinding
+						, doGet( m_buffers, bufferId )
+						, offset
+						, range
+						, index );
+				}
+			}
+			break;
+
+		case BindingType::eTexelBuffer:
+			{
+				auto bufferId = stream.read< ObjectId >();
+				auto viewId = stream.read< ObjectId >();
+				auto index = stream.read< uint32_t >();
+				descriptorSet.createBinding( layoutBinding
+					, doGet( m_buffers, bufferId )
+					, doGet( m_bufferViews, viewId )
+					, index );
+			}
+			break;
+		}
+	}
+
+	void Player::doCreatePipelineLayout( InputStream & stream )
+	{
+		auto id = stream.read< ObjectId >();
+		auto layoutIds = stream.readArray< ObjectId >();
+		auto ranges = stream.readArray< renderer::PushConstantRange >();
+		renderer::DescriptorSetLayoutCRefArray setLayouts;
+		renderer::PushConstantRangeCRefArray pushConstantRanges;
+
+		for ( auto layoutId : layoutIds )
+		{
+			setLayouts.emplace_back( doGet( m_setLayouts, layoutId ) );
+		}
+
+		for ( auto & range : ranges )
+		{
+			pushConstantRanges.emplace_back( range );
+		}
+
+		doRegister( m_pipelineLayouts
+			, id
+			, m_device.createPipelineLayout( setLayouts, pushConstantRanges ) );
+	}
+
+	void Player::doCreatePipeline( InputStream & stream )
+	{
+		auto id = stream.read< ObjectId >();
+		auto & layout = doGet( m_pipelineLayouts, stream.read< ObjectId >() );
+		auto stageCount = stream.read< uint32_t >();
+		std::vector< renderer::ShaderStageState > stages;
+
+		for ( uint32_t i = 0u; i < stageCount; ++i )
+		{
+			stages.push_back( doReadStage( stream ) );
+		}
+
+		auto & renderPass = doGet( m_renderPasses, stream.read< ObjectId >() );
+		auto vertexInputState = stream.readVertexInputState();
+		auto inputAssemblyState = stream.read< renderer::InputAssemblyState >();
+		auto rasterisationState = stream.readRasterisationState();
+		auto multisampleState = stream.read< renderer::MultisampleState >();
+		auto colourBlendState = stream.readColourBlendState();
+		auto depthStencilState = stream.readOptional< renderer::DepthStencilState >();
+		auto tessellationState = stream.readOptional< renderer::TessellationState >();
+		auto viewport = stream.readOptional< renderer::Viewport >();
+		auto scissor = stream.readOptional< renderer::Scissor >();
+		auto subpass = stream.read< uint32_t >();
+		doRegister( m_pipelines
+			, id
+			, layout.createPipeline( renderer::GraphicsPipelineCreateInfo
+			{
+				std::move( stages ),
+				renderPass,
+				std::move( vertexInputState ),
+				inputAssemblyState,
+				std::move( rasterisationState ),
+				multisampleState,
+				std::move( colourBlendState ),
+				depthStencilState,
+				tessellationState,
+				viewport,
+				scissor,
+				subpass,
+			} ) );
+	}
+
+	void Player::doCreateComputePipeline( InputStream & stream )
+	{
+		auto id = stream.read< ObjectId >();
+		auto & layout = doGet( m_pipelineLayouts, stream.read< ObjectId >() );
+		doRegister( m_computePipelines
+			, id
+			, layout.createPipeline( renderer::ComputePipelineCreateInfo
+			{
+				doReadStage( stream ),
+			} ) );
+	}
+
+	renderer::ShaderStageState Player::doReadStage( InputStream & stream )
+	{
+		auto moduleId = stream.read< ObjectId >();
+		auto entryPoint = stream.readString();
+		renderer::SpecialisationInfoBasePtr specialisationInfo;
+
+		if ( stream.read< bool >() )
+		{
+			auto entries = stream.readArray< renderer::SpecialisationMapEntry >();
+			auto data = stream.readArray< uint8_t >();
+			specialisationInfo = std::make_unique< renderer::SpecialisationInfoBase >( entries );
+			std::memcpy( specialisationInfo->getData()
+				, data.data()
+				, std::min( data.size(), size_t( specialisationInfo->getSize() ) ) );
+		}
+
+		auto it = m_shaderModules.find( moduleId );
+
+		if ( it == m_shaderModules.end() )
+		{
+			throw UnknownObject{ "Unknown shader module" };
+		}
+
+		auto module = std::move( it->second );
+		m_shaderModules.erase( it );
+		return renderer::ShaderStageState
+		{
+			std::move( module ),
+			std::move( specialisationInfo ),
+			entryPoint,
+		};
+	}
+
+	void Player::doDestroy( ObjectId id )
+	{
+		m_shaderModules.erase( id );
+		m_owners.erase( id );
+	}
+
+	void Player::doBufferData( InputStream & stream )
+	{
+		auto id = stream.read< ObjectId >();
+		auto offset = stream.read< uint32_t >();
+		auto size = stream.read< uint32_t >();
+		auto data = stream.readBytes( size );
+		auto & buffer = doGet( m_buffers, id );
+		// The buffer may still be used by the submitted command buffers.
+		doWaitIdle();
+
+		if ( auto mapped = buffer.lock( offset
+			, size
+			, renderer::MemoryMapFlag::eWrite | renderer::MemoryMapFlag::eInvalidateRange ) )
+		{
+			std::memcpy( mapped, data, size );
+			buffer.flush( offset, size );
+			buffer.unlock();
+		}
+	}
+
+	void Player::doRecord( InputStream & stream )
+	{
+		auto & commandBuffer = doGet( m_commandBuffers, stream.read< ObjectId >() );
+		auto flags = stream.read< renderer::CommandBufferUsageFlags >();
+		auto inheritance = readSubStream( stream );
+		auto count = stream.read< uint32_t >();
+		auto commands = readSubStream( stream );
+		// The command buffer may still be used by the submitted work.
+		doWaitIdle();
+
+		if ( inheritance.isEnd() )
+		{
+			commandBuffer.begin( flags );
+		}
+		else
+		{
+			auto renderPassId = inheritance.read< ObjectId >();
+			auto subpass = inheritance.read< uint32_t >();
+			auto frameBufferId = inheritance.read< ObjectId >();
+			auto occlusionQueryEnable = inheritance.read< bool >();
+			auto queryFlags = inheritance.read< renderer::QueryControlFlags >();
+			auto pipelineStatistics = inheritance.read< renderer::QueryPipelineStatisticFlags >();
+			auto renderPass = m_renderPasses.find( renderPassId );
+			auto frameBuffer = m_frameBuffers.find( frameBufferId );
+			commandBuffer.begin( flags
+				, renderer::CommandBufferInheritanceInfo
+				{
+					renderPass != m_renderPasses.end()
+						? renderPass->second
+						: nullptr,
+					subpass,
+					frameBuffer != m_frameBuffers.end()
+						? frameBuffer->second
+						: nullptr,
+					occlusionQueryEnable,
+					queryFlags,
+					pipelineStatistics,
+				} );
+		}
+
+		for ( uint32_t i = 0u; i < count; ++i )
+		{
+			auto type = commands.read< CommandType >();
+
+			try
+			{
+				doRecordCommand( commandBuffer, type, commands );
+			}
+			catch ( UnknownObject & )
+			{
+				++m_skipped;
+			}
+		}
+
+		commandBuffer.end();
+	}
+
+	void Player::doRecordCommand( renderer::CommandBuffer & commandBuffer
+		, CommandType type
+		, InputStream & stream )
+	{
+		// Each command reads all its parameters before looking its objects up,
+		// so that the stream stays consistent when one of them is unknown.
+		switch ( type )
+		{
+		case CommandType::eBeginRenderPass:
+			{
+				auto renderPassId = stream.read< ObjectId >();
+				auto frameBufferId = stream.read< ObjectId >();
+				auto clearValues = stream.readArray< renderer::ClearValue >();
+				auto contents = stream.read< renderer::SubpassContents >();
+				commandBuffer.beginRenderPass( doGet( m_renderPasses, renderPassId )
+					, doGet( m_frameBuffers, frameBufferId )
+					, clearValues
+					, contents );
+			}
+			break;
+
+		case CommandType::eNextSubpass:
+			commandBuffer.nextSubpass( stream.read< renderer::SubpassContents >() );
+			break;
+
+		case CommandType::eEndRenderPass:
+			commandBuffer.endRenderPass();
+			break;
+
+		case CommandType::eExecuteCommands:
+			{
+				auto ids = stream.readArray< ObjectId >();
+				renderer::CommandBufferCRefArray commands;
+
+				for ( auto id : ids )
+				{
+					commands.emplace_back( doGet( m_commandBuffers, id ) );
+				}
+
+				commandBuffer.executeCommands( commands );
+			}
+			break;
+
+		case CommandType::eClearColour:
+			{
+				auto viewId = stream.read< ObjectId >();
+				auto colour = stream.read< renderer::RgbaColour >();
+				commandBuffer.clear( doGet( m_views, viewId ), colour );
+			}
+			break;
+
+		case CommandType::eClearDepthStencil:
+			{
+				auto viewId = stream.read< ObjectId >();
+				auto value = stream.read< renderer::DepthStencilClearValue >();
+				commandBuffer.clear( doGet( m_views, viewId ), value );
+			}
+			break;
+
+		case CommandType::eClearAttachments:
+			{
+				auto clearAttachments = stream.readArray< renderer::ClearAttachment >();
+				auto clearRects = stream.readArray< renderer::ClearRect >();
+				commandBuffer.clearAttachments( clearAttachments, clearRects );
+			}
+			break;
+
+		case CommandType::eBufferMemoryBarrier:
+			{
+				auto after = stream.read< renderer::PipelineStageFlags >();
+				auto before = stream.read< renderer::PipelineStageFlags >();
+				auto srcAccessMask = stream.read< renderer::AccessFlags >();
+				auto dstAccessMask = stream.read< renderer::AccessFlags >();
+				auto srcQueueFamilyIndex = stream.read< uint32_t >();
+				auto dstQueueFamilyIndex = stream.read< uint32_t >();
+				auto bufferId = stream.read< ObjectId >();
+				auto offset = stream.read< uint64_t >();
+				auto size = stream.read< uint64_t >();
+				commandBuffer.memoryBarrier( after
+					, before
+					, renderer::BufferMemoryBarrier
+					{
+						srcAccessMask,
+						dstAccessMask,
+						srcQueueFamilyIndex,
+						dstQueueFamilyIndex,
+						doGet( m_buffers, bufferId ),
+						offset,
+						size
+					} );
+			}
+			break;
+
+		case CommandType::eImageMemoryBarrier:
+			{
+				auto after = stream.read< renderer::PipelineStageFlags >();
+				auto before = stream.read< renderer::PipelineStageFlags >();
+				auto srcAccessMask = stream.read< renderer::AccessFlags >();
+				auto dstAccessMask = stream.read< renderer::AccessFlags >();
+				auto oldLayout = stream.read< renderer::ImageLayout >();
+				auto newLayout = stream.read< renderer::ImageLayout >();
+				auto srcQueueFamilyIndex = stream.read< uint32_t >();
+				auto dstQueueFamilyIndex = stream.read< uint32_t >();
+				auto textureId = stream.read< ObjectId >();
+				auto range = stream.read< renderer::ImageSubresourceRange >();
+				commandBuffer.memoryBarrier( after
+					, before
+					, renderer::ImageMemoryBarrier
+					{
+						srcAccessMask,
+						dstAccessMask,
+						oldLayout,
+						newLayout,
+						srcQueueFamilyIndex,
+						dstQueueFamilyIndex,
+						doGet( m_textures, textureId ),
+						range
+					} );
+			}
+			break;
+
+		case CommandType::eBindPipeline:
+			{
+				auto pipelineId = stream.read< ObjectId >();
+				auto bindingPoint = stream.read< renderer::PipelineBindPoint >();
+				commandBuffer.bindPipeline( doGet( m_pipelines, pipelineId ), bindingPoint );
+			}
+			break;
+
+		case CommandType::eBindComputePipeline:
+			{
+				auto pipelineId = stream.read< ObjectId >();
+				auto bindingPoint = stream.read< renderer::PipelineBindPoint >();
+				commandBuffer.bindPipeline( doGet( m_computePipelines, pipelineId ), bindingPoint );
+			}
+			break;
+
+		case CommandType::eBindVertexBuffers:
+			{
+				auto firstBinding = stream.read< uint32_t >();
+				auto ids = stream.readArray< ObjectId >();
+				auto offsets = stream.readArray< uint64_t >();
+				renderer::BufferCRefArray buffers;
+
+				for ( auto id : ids )
+				{
+					buffers.emplace_back( doGet( m_buffers, id ) );
+				}
+
+				commandBuffer.bindVertexBuffers( firstBinding, buffers, offsets );
+			}
+			break;
+
+		case CommandType::eBindIndexBuffer:
+			{
+				auto bufferId = stream.read< ObjectId >();
+				auto offset = stream.read< uint64_t >();
+				auto indexType = stream.read< renderer::IndexType >();
+				commandBuffer.bindIndexBuffer( doGet( m_buffers, bufferId ), offset, indexType );
+			}
+			break;
+
+		case CommandType::eBindDescriptorSets:
+			{
+				auto ids = stream.readArray< ObjectId >();
+				auto layoutId = stream.read< ObjectId >();
+				auto dynamicOffsets = stream.readArray< uint32_t >();
+				auto bindingPoint = stream.read< renderer::PipelineBindPoint >();
+				renderer::DescriptorSetCRefArray descriptorSets;
+
+				for ( auto id : ids )
+				{
+					descriptorSets.emplace_back( doGet( m_sets, id ) );
+				}
+
+				commandBuffer.bindDescriptorSets( descriptorSets
+					, doGet( m_pipelineLayouts, layoutId )
+					, dynamicOffsets
+					, bindingPoint );
+			}
+			break;
+
+		case CommandType::eSetViewport:
+			commandBuffer.setViewport( stream.read< renderer::Viewport >() );
+			break;
+
+		case CommandType::eSetScissor:
+			commandBuffer.setScissor( stream.read< renderer::Scissor >() );
+			break;
+
+		case CommandType::eDraw:
+			{
+				auto vtxCount = stream.read< uint32_t >();
+				auto instCount = stream.read< uint32_t >();
+				auto firstVertex = stream.read< uint32_t >();
+				auto firstInstance = stream.read< uint32_t >();
+				commandBuffer.draw( vtxCount, instCount, firstVertex, firstInstance );
+			}
+			break;
+
+		case CommandType::eDrawIndexed:
+			{
+				auto indexCount = stream.read< uint32_t >();
+				auto instCount = stream.read< uint32_t >();
+				auto firstIndex = stream.read< uint32_t >();
+				auto vertexOffset = stream.read< uint32_t >();
+				auto firstInstance = stream.read< uint32_t >();
+				commandBuffer.drawIndexed( indexCount, instCount, firstIndex, vertexOffset, firstInstance );
+			}
+			break;
+
+		case CommandType::eDrawIndirect:
+		case CommandType::eDrawIndexedIndirect:
+			{
+				auto bufferId = stream.read< ObjectId >();
+				auto offset = stream.read< uint32_t >();
+				auto drawCount = stream.read< uint32_t >();
+				auto stride = stream.read< uint32_t >();
+				auto & buffer = doGet( m_buffers, bufferId );
+
+				if ( type == CommandType::eDrawIndirect )
+				{
+					commandBuffer.drawIndirect( buffer, offset, drawCount, stride );
+				}
+				else
+				{
+					commandBuffer.drawIndexedIndirect( buffer, offset, drawCount, stride );
+				}
+			}
+			break;
+
+		case CommandType::eDrawIndirectCount:
+		case CommandType::eDrawIndexedIndirectCount:
+			{
+				auto bufferId = stream.read< ObjectId >();
+				auto offset = stream.read< uint32_t >();
+				auto countBufferId = stream.read< ObjectId >();
+				auto countBufferOffset = stream.read< uint32_t >();
+				auto maxDrawCount = stream.read< uint32_t >();
+				auto stride = stream.read< uint32_t >();
+				auto & buffer = doGet( m_buffers, bufferId );
+				auto & countBuffer = doGet( m_buffers, countBufferId );
+
+				if ( type == CommandType::eDrawIndirectCount )
+				{
+					commandBuffer.drawIndirectCount( buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride );
+				}
+				else
+				{
+					commandBuffer.drawIndexedIndirectCount( buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride );
+				}
+			}
+			break;
+
+		case CommandType::eCopyToImage:
+			{
+				auto copyInfo = stream.readArray< renderer::BufferImageCopy >();
+				auto srcId = stream.read< ObjectId >();
+				auto dstId = stream.read< ObjectId >();
+				commandBuffer.copyToImage( copyInfo
+					, doGet( m_buffers, srcId )
+					, doGet( m_textures, dstId ) );
+			}
+			break;
+
+		case CommandType::eCopyToBuffer:
+			{
+				auto copyInfo = stream.readArray< renderer::BufferImageCopy >();
+				auto srcId = stream.read< ObjectId >();
+				auto dstId = stream.read< ObjectId >();
+				commandBuffer.copyToBuffer( copyInfo
+					, doGet( m_textures, srcId )
+					, doGet( m_buffers, dstId ) );
+			}
+			break;
+
+		case CommandType::eCopyBuffer:
+			{
+				auto copyInfo = stream.read< renderer::BufferCopy >();
+				auto srcId = stream.read< ObjectId >();
+				auto dstId = stream.read< ObjectId >();
+				commandBuffer.copyBuffer( copyInfo
+					, doGet( m_buffers, srcId )
+					, doGet( m_buffers, dstId ) );
+			}
+			break;
+
+		case CommandType::eCopyImage:
+			{
+				auto copyInfo = stream.read< renderer::ImageCopy >();
+				auto srcId = stream.read< ObjectId >();
+				auto dstId = stream.read< ObjectId >();
+				commandBuffer.copyImage( copyInfo
+					, doGet( m_views, srcId )
+					, doGet( m_views, dstId ) );
+			}
+			break;
+
+		case CommandType::eBlitImage:
+			{
+				auto srcId = stream.read< ObjectId >();
+				auto srcLayout = stream.read< renderer::ImageLayout >();
+				auto dstId = stream.read< ObjectId >();
+				auto dstLayout = stream.read< renderer::ImageLayout >();
+				auto regions = stream.readArray< renderer::ImageBlit >();
+				auto filter = stream.read< renderer::Filter >();
+				commandBuffer.blitImage( doGet( m_textures, srcId )
+					, srcLayout
+					, doGet( m_textures, dstId )
+					, dstLayout
+					, regions
+					, filter );
+			}
+			break;
+
+		case CommandType::eGenerateMipmaps:
+			{
+				auto textureId = stream.read< ObjectId >();
+				commandBuffer.generateMipmaps( doGet( m_textures, textureId ) );
+			}
+			break;
+
+		case CommandType::eResetQueryPool:
+			{
+				auto poolId = stream.read< ObjectId >();
+				auto firstQuery = stream.read< uint32_t >();
+				auto queryCount = stream.read< uint32_t >();
+				commandBuffer.resetQueryPool( doGet( m_queryPools, poolId ), firstQuery, queryCount );
+			}
+			break;
+
+		case CommandType::eBeginQuery:
+			{
+				auto poolId = stream.read< ObjectId >();
+				auto query = stream.read< uint32_t >();
+				auto flags = stream.read< renderer::QueryControlFlags >();
+				commandBuffer.beginQuery( doGet( m_queryPools, poolId ), query, flags );
+			}
+			break;
+
+		case CommandType::eEndQuery:
+			{
+				auto poolId = stream.read< ObjectId >();
+				auto query = stream.read< uint32_t >();
+				commandBuffer.endQuery( doGet( m_queryPools, poolId ), query );
+			}
+			break;
+
+		case CommandType::eWriteTimestamp:
+			{
+				auto pipelineStage = stream.read< renderer::PipelineStageFlag >();
+				auto poolId = stream.read< ObjectId >();
+				auto query = stream.read< uint32_t >();
+				commandBuffer.writeTimestamp( pipelineStage, doGet( m_queryPools, poolId ), query );
+			}
+			break;
+
+		case CommandType::eCopyQueryPoolResults:
+			{
+				auto poolId = stream.read< ObjectId >();
+				auto firstQuery = stream.read< uint32_t >();
+				auto queryCount = stream.read< uint32_t >();
+				auto bufferId = stream.read< ObjectId >();
+				auto dstOffset = stream.read< uint32_t >();
+				auto stride = stream.read< uint32_t >();
+				auto flags = stream.read< renderer::QueryResultFlags >();
+				commandBuffer.copyQueryPoolResults( doGet( m_queryPools, poolId )
+					, firstQuery
+					, queryCount
+					, doGet( m_buffers, bufferId )
+					, dstOffset
+					, stride
+					, flags );
+			}
+			break;
+
+		case CommandType::ePushConstants:
+			{
+				auto layoutId = stream.read< ObjectId >();
+				auto stageFlags = stream.read< renderer::ShaderStageFlags >();
+				auto variables = stream.readArray< renderer::PushConstant >();
+				auto data = stream.readArray< uint8_t >();
+				renderer::PushConstantsBufferBase pcb{ stageFlags, variables };
+				std::memcpy( pcb.getData()
+					, data.data()
+					, std::min( data.size(), size_t( pcb.getSize() ) ) );
+				commandBuffer.pushConstants( doGet( m_pipelineLayouts, layoutId ), pcb );
+			}
+			break;
+
+		case CommandType::eDispatch:
+			{
+				auto groupCountX = stream.read< uint32_t >();
+				auto groupCountY = stream.read< uint32_t >();
+				auto groupCountZ = stream.read< uint32_t >();
+				commandBuffer.dispatch( groupCountX, groupCountY, groupCountZ );
+			}
+			break;
+
+		case CommandType::eDispatchIndirect:
+			{
+				auto bufferId = stream.read< ObjectId >();
+				auto offset = stream.read< uint32_t >();
+				commandBuffer.dispatchIndirect( doGet( m_buffers, bufferId ), offset );
+			}
+			break;
+
+		case CommandType::eSetLineWidth:
+			commandBuffer.setLineWidth( stream.read< float >() );
+			break;
+
+		default:
+			throw std::runtime_error{ "Unsupported command type " + std::to_string( uint32_t( type ) ) };
+		}
+	}
+
+	void Player::doSubmit( InputStream & stream )
+	{
+		auto queueIndex = stream.read< uint32_t >();
+		auto ids = stream.readArray< ObjectId >();
+		renderer::CommandBufferCRefArray commandBuffers;
+
+		for ( auto id : ids )
+		{
+			commandBuffers.emplace_back( doGet( m_commandBuffers, id ) );
+		}
+
+		auto & queue = queueIndex == ComputeQueueIndex
+			? m_device.getComputeQueue()
+			: m_device.getGraphicsQueue();
+		queue.submit( commandBuffers
+			, renderer::SemaphoreCRefArray{}
+			, renderer::PipelineStageFlagsArray{}
+			, renderer::SemaphoreCRefArray{}
+			, nullptr );
+		m_pending = true;
+	}
+
+	void Player::doWaitIdle()
+	{
+		if ( m_pending )
+		{
+			m_device.waitIdle();
+			m_pending = false;
+		}
+	}
+
+	template< typename T >
+	T & Player::doGet( std::map< ObjectId, T * > const & objects
+		, ObjectId id )const
+	{
+		auto it = objects.find( id );
+
+		if ( it == objects.end() )
+		{
+			throw UnknownObject{ "Unknown object " + std::to_string( id ) };
+		}
+
+		return *it->second;
+	}
+
+	template< typename T, typename PtrT >
+	T & Player::doRegister( std::map< ObjectId, T * > & objects
+		, ObjectId id
+		, PtrT && object )
+	{
+		auto & result = *object;
+		objects[id] = &result;
+		m_owners[id] = std::shared_ptr< void >{ std::move( object ) };
+		return result;
+	}
+}
@@ -0,0 +1,201 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "Miscellaneous/CaptureFormat.hpp"
+#include "Miscellaneous/CaptureStream.hpp"
+
+#include <chrono>
+#include <map>
+
+namespace capture_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Rejoue une capture sur un périphérique logique, quel que soit son renderer.
+	*\remarks
+	*	Les chunks précédant la plage de frames capturée sont joués une fois, puis la plage est jouée en boucle.
+	*	Les créations d'objets ne sont jouées que lors du premier passage, et les destructions sont différées
+	*	jusqu'à la destruction du Player, afin que chaque passage retrouve les mêmes objets.
+	*	Les fences et sémaphores ne sont pas capturés, le Player attend donc la fin du travail du GPU
+	*	avant de remplir un tampon ou d'enregistrer un tampon de commandes, et à la fin de chaque frame.
+	*\~english
+	*\brief
+	*	Replays a capture on a logical device, whatever its renderer.
+	*\remarks
+	*	The chunks preceding the captured frames range are played once, then the range is played in a loop.
+	*	The objects creations are only played during the first pass, and the destructions are deferred
+	*	until the Player's destruction, so that each pass finds the same objects.
+	*	The fences and semaphores are not captured, hence the Player waits for the GPU work's end
+	*	before filling a buffer or recording a command buffer, and at the end of each frame.
+	*/
+	class Player
+	{
+	public:
+		using Clock = std::chrono::high_resolution_clock;
+		using FrameTimes = std::vector< std::chrono::nanoseconds >;
+
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur, lit le fichier de capture.
+		*\param[in] device
+		*	Le périphérique sur lequel la capture est rejouée.
+		*\param[in] fileName
+		*	Le fichier de capture.
+		*\~english
+		*\brief
+		*	Constructor, reads the capture file.
+		*\param[in] device
+		*	The device on which the capture is replayed.
+		*\param[in] fileName
+		*	The capture file.
+		*/
+		Player( renderer::Device const & device
+			, std::string const & fileName );
+		/**
+		*\~french
+		*\brief
+		*	Destructeur, détruit les objets créés, dans l'ordre inverse de leur création.
+		*\~english
+		*\brief
+		*	Destructor, destroys the created objects, in their creation's reverse order.
+		*/
+		~Player();
+		/**
+		*\~french
+		*\brief
+		*	Joue la préparation, puis la plage de frames capturée.
+		*\remarks
+		*	Le premier passage sur la plage crée les objets et n'est pas mesuré.
+		*\param[in] loops
+		*	Le nombre de passages mesurés sur la plage de frames.
+		*\return
+		*	Les temps des frames mesurées.
+		*\~english
+		*\brief
+		*	Plays the setup, then the captured frames range.
+		*\remarks
+		*	The first pass on the range creates the objects, and isn't measured.
+		*\param[in] loops
+		*	The measured passes count on the frames range.
+		*\return
+		*	The measured frames times.
+		*/
+		FrameTimes play( uint32_t loops );
+		/**
+		*\~french
+		*\return
+		*	Le nom du renderer capturé.
+		*\~english
+		*\return
+		*	The captured renderer's name.
+		*/
+		inline std::string const & getRendererName()const
+		{
+			return m_rendererName;
+		}
+		/**
+		*\~french
+		*\return
+		*	L'en-tête de la capture.
+		*\~english
+		*\return
+		*	The capture header.
+		*/
+		inline CaptureHeader const & getHeader()const
+		{
+			return m_header;
+		}
+		/**
+		*\~french
+		*\return
+		*	Le nombre de commandes ou chunks ignorés car utilisant des objets inconnus.
+		*\~english
+		*\return
+		*	The count of commands or chunks ignored because they use unknown objects.
+		*/
+		inline uint32_t getSkippedCount()const
+		{
+			return m_skipped;
+		}
+
+	private:
+		struct Chunk
+		{
+			ChunkType type;
+			uint8_t const * data;
+			uint32_t size;
+		};
+
+		void doReadFile( std::string const & fileName );
+		void doPlayChunk( Chunk const & chunk
+			, bool create
+			, bool setup );
+		void doCreate( ChunkType type
+			, InputStream & stream );
+		void doCreateRenderPass( InputStream & stream );
+		void doCreateFrameBuffer( InputStream & stream );
+		void doCreateSwapChainFrameBuffers( InputStream & stream );
+		void doCreateBinding( InputStream & stream );
+		void doCreatePipelineLayout( InputStream & stream );
+		void doCreatePipeline( InputStream & stream );
+		void doCreateComputePipeline( InputStream & stream );
+		renderer::ShaderStageState doReadStage( InputStream & stream );
+		void doDestroy( ObjectId id );
+		void doBufferData( InputStream & stream );
+		void doRecord( InputStream & stream );
+		void doRecordCommand( renderer::CommandBuffer & commandBuffer
+			, CommandType type
+			, InputStream & stream );
+		void doSubmit( InputStream & stream );
+		void doWaitIdle();
+
+		template< typename T >
+		T & doGet( std::map< ObjectId, T * > const & objects
+			, ObjectId id )const;
+
+		template< typename T, typename PtrT >
+		T & doRegister( std::map< ObjectId, T * > & objects
+			, ObjectId id
+			, PtrT && object );
+
+	private:
+		renderer::Device const & m_device;
+		CaptureHeader m_header;
+		std::string m_rendererName;
+		renderer::ByteArray m_data;
+		std::vector< Chunk > m_setup;
+		std::vector< Chunk > m_frames;
+		// The owners of the created objects, the identifiers order being the creation order.
+		std::map< ObjectId, std::shared_ptr< void > > m_owners;
+		std::map< ObjectId, renderer::BufferBase const * > m_buffers;
+		std::map< ObjectId, renderer::UniformBufferBase const * > m_uniformBuffers;
+		std::map< ObjectId, renderer::BufferView const * > m_bufferViews;
+		std::map< ObjectId, renderer::Texture * > m_textures;
+		std::map< ObjectId, renderer::TextureView const * > m_views;
+		std::map< ObjectId, renderer::Sampler const * > m_samplers;
+		std::map< ObjectId, renderer::RenderPass const * > m_renderPasses;
+		std::map< ObjectId, renderer::FrameBuffer const * > m_frameBuffers;
+		std::map< ObjectId, renderer::DescriptorSetLayout const * > m_setLayouts;
+		std::map< ObjectId, renderer::DescriptorSetPool const * > m_setPools;
+		std::map< ObjectId, renderer::DescriptorSet * > m_sets;
+		std::map< ObjectId, renderer::DescriptorSetLayout const * > m_setsLayouts;
+		std::map< ObjectId, renderer::PipelineLayout const * > m_pipelineLayouts;
+		std::map< ObjectId, renderer::ShaderModulePtr > m_shaderModules;
+		std::map< ObjectId, renderer::Pipeline const * > m_pipelines;
+		std::map< ObjectId, renderer::ComputePipeline const * > m_computePipelines;
+		std::map< ObjectId, renderer::CommandPool const * > m_commandPools;
+		std::map< ObjectId, renderer::CommandBuffer * > m_commandBuffers;
+		std::map< ObjectId, renderer::QueryPool const * > m_queryPools;
+		bool m_created{ false };
+		bool m_pending{ false };
+		uint32_t m_skipped{ 0u };
+		Clock::time_point m_frameStart;
+		FrameTimes * m_frameTimes{ nullptr };
+	};
+}
@@ -0,0 +1,47 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Shader/CaptureShaderModule.hpp"
+
+#include "Core/CaptureDevice.hpp"
+
+namespace capture_renderer
+{
+	ShaderModule::ShaderModule( Device const & device
+		, renderer::ShaderModulePtr && inner
+		, renderer::ShaderStageFlag stage )
+		: renderer::ShaderModule{ stage }
+		, Object{ device.getWriter() }
+		, m_inner{ std::move( inner ) }
+	{
+	}
+
+	void ShaderModule::loadShader( std::string const & shader )
+	{
+		if ( !m_inner )
+		{
+			throw std::runtime_error{ "The shader module has already been given to a pipeline" };
+		}
+
+		m_inner->loadShader( shader );
+		m_writer.writeChunk( ChunkType::eLoadShader
+			, getObjectId()
+			, false
+			, shader );
+	}
+
+	void ShaderModule::loadShader( renderer::ByteArray const & shader )
+	{
+		if ( !m_inner )
+		{
+			throw std::runtime_error{ "The shader module has already been given to a pipeline" };
+		}
+
+		m_inner->loadShader( shader );
+		m_writer.writeChunk( ChunkType::eLoadShader
+			, getObjectId()
+			, true
+			, shader );
+	}
+}
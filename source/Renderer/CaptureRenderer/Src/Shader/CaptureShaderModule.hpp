@@ -0,0 +1,77 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "Miscellaneous/CaptureObject.hpp"
+
+#include <Shader/ShaderModule.hpp>
+
+namespace capture_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Module shader enveloppant celui du renderer capturé.
+	*\remarks
+	*	Le module capturé est cédé au pipeline capturé, lors de la création de celui-ci.
+	*\~english
+	*\brief
+	*	Shader module wrapping the captured renderer's one.
+	*\remarks
+	*	The captured module is given to the captured pipeline, when the latter is created.
+	*/
+	class ShaderModule
+		: public renderer::ShaderModule
+		, public Object
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] inner
+		*	Le module capturé.
+		*\param[in] stage
+		*	L'étape du pipeline du module.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] inner
+		*	The captured module.
+		*\param[in] stage
+		*	The module's pipeline stage.
+		*/
+		ShaderModule( Device const & device
+			, renderer::ShaderModulePtr && inner
+			, renderer::ShaderStageFlag stage );
+		/**
+		*\copydoc	renderer::ShaderModule::loadShader
+		*/
+		void loadShader( std::string const & shader )override;
+		/**
+		*\copydoc	renderer::ShaderModule::loadShader
+		*/
+		void loadShader( renderer::ByteArray const & shader )override;
+		/**
+		*\~french
+		*\brief
+		*	Cède le module capturé.
+		*\~english
+		*\brief
+		*	Gives the captured module away.
+		*/
+		inline renderer::ShaderModulePtr releaseInner()
+		{
+			return std::move( m_inner );
+		}
+
+	private:
+		renderer::ShaderModulePtr m_inner;
+	};
+}
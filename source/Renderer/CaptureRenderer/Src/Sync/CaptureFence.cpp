@@ -0,0 +1,36 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Sync/CaptureFence.hpp"
+
+#include "Core/CaptureDevice.hpp"
+
+namespace capture_renderer
+{
+	Fence::Fence( Device const & device
+		, renderer::FencePtr && inner
+		, renderer::FenceCreateFlags flags )
+		: renderer::Fence{ device, flags }
+		, m_ownInner{ std::move( inner ) }
+		, m_inner{ *m_ownInner }
+	{
+	}
+
+	Fence::Fence( Device const & device
+		, renderer::Fence const & inner )
+		: renderer::Fence{ device, 0u }
+		, m_inner{ inner }
+	{
+	}
+
+	renderer::WaitResult Fence::wait( uint32_t timeout )const
+	{
+		return m_inner.wait( timeout );
+	}
+
+	void Fence::reset()const
+	{
+		m_inner.reset();
+	}
+}
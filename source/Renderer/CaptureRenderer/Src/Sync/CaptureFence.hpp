@@ -0,0 +1,91 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "CaptureRendererPrerequisites.hpp"
+
+#include <Sync/Fence.hpp>
+
+namespace capture_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Barrière enveloppant celle du renderer capturé, non enregistrée.
+	*\~english
+	*\brief
+	*	Fence wrapping the captured renderer's one, not recorded.
+	*/
+	class Fence
+		: public renderer::Fence
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] inner
+		*	La barrière capturée.
+		*\param[in] flags
+		*	Les indicateurs de création de la barrière.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] inner
+		*	The captured fence.
+		*\param[in] flags
+		*	The fence creation flags.
+		*/
+		Fence( Device const & device
+			, renderer::FencePtr && inner
+			, renderer::FenceCreateFlags flags );
+		/**
+		*\~french
+		*\brief
+		*	Constructeur, pour une barrière capturée possédée par une swap chain.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] inner
+		*	La barrière capturée.
+		*\~english
+		*\brief
+		*	Constructor, for a captured fence owned by a swap chain.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] inner
+		*	The captured fence.
+		*/
+		Fence( Device const & device
+			, renderer::Fence const & inner );
+		/**
+		*\copydoc	renderer::Fence::wait
+		*/
+		renderer::WaitResult wait( uint32_t timeout )const override;
+		/**
+		*\copydoc	renderer::Fence::reset
+		*/
+		void reset()const override;
+		/**
+		*\~french
+		*\return
+		*	La barrière capturée.
+		*\~english
+		*\return
+		*	The captured fence.
+		*/
+		inline renderer::Fence const & getInner()const
+		{
+			return m_inner;
+		}
+
+	private:
+		renderer::FencePtr m_ownInner;
+		renderer::Fence const & m_inner;
+	};
+}
@@ -0,0 +1,24 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Sync/CaptureSemaphore.hpp"
+
+#include "Core/CaptureDevice.hpp"
+
+namespace capture_renderer
+{
+	Semaphore::Semaphore( Device const & device
+		, renderer::SemaphorePtr && inner )
+		: Semaphore{ device, *inner }
+	{
+		m_ownInner = std::move( inner );
+	}
+
+	Semaphore::Semaphore( Device const & device
+		, renderer::Semaphore const & inner )
+		: renderer::Semaphore{ device }
+		, m_inner{ inner }
+	{
+	}
+}
@@ -0,0 +1,78 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "CaptureRendererPrerequisites.hpp"
+
+#include <Sync/Semaphore.hpp>
+
+namespace capture_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Sémaphore enveloppant celui du renderer capturé, non enregistré.
+	*\~english
+	*\brief
+	*	Semaphore wrapping the captured renderer's one, not recorded.
+	*/
+	class Semaphore
+		: public renderer::Semaphore
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] inner
+		*	Le sémaphore capturé.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] inner
+		*	The captured semaphore.
+		*/
+		Semaphore( Device const & device
+			, renderer::SemaphorePtr && inner );
+		/**
+		*\~french
+		*\brief
+		*	Constructeur, pour un sémaphore capturé possédé par une swap chain.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] inner
+		*	Le sémaphore capturé.
+		*\~english
+		*\brief
+		*	Constructor, for a captured semaphore owned by a swap chain.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] inner
+		*	The captured semaphore.
+		*/
+		Semaphore( Device const & device
+			, renderer::Semaphore const & inner );
+		/**
+		*\~french
+		*\return
+		*	Le sémaphore capturé.
+		*\~english
+		*\return
+		*	The captured semaphore.
+		*/
+		inline renderer::Semaphore const & getInner()const
+		{
+			return m_inner;
+		}
+
+	private:
+		renderer::SemaphorePtr m_ownInner;
+		renderer::Semaphore const & m_inner;
+	};
+}
@@ -0,0 +1,183 @@
+#include "FileUtils.hpp"
+#include "RendererPlugin.hpp"
+
+#include <Replay/CapturePlayer.hpp>
+
+#include <Core/Connection.hpp>
+#include <Core/Device.hpp>
+#include <Core/PlatformWindowHandle.hpp>
+#include <Core/Renderer.hpp>
+
+#include <algorithm>
+#include <iostream>
+
+namespace
+{
+	struct Options
+	{
+		std::string fileName;
+		std::string renderer;
+		uint32_t loops{ 10u };
+		std::string pluginsDir{ common::getExecutableDirectory() };
+	};
+
+	bool doProcessCommandLine( int argc, char ** argv, Options & options )
+	{
+		static std::string const RendererOption = "--renderer=";
+		static std::string const LoopsOption = "--loops=";
+		static std::string const PluginsOption = "--plugins-dir=";
+
+		for ( int i = 1; i < argc; ++i )
+		{
+			std::string arg = argv[i];
+
+			if ( arg.find( RendererOption ) == 0u )
+			{
+				options.renderer = arg.substr( RendererOption.size() );
+			}
+			else if ( arg.find( LoopsOption ) == 0u )
+			{
+				options.loops = uint32_t( std::max( 1, std::stoi( arg.substr( LoopsOption.size() ) ) ) );
+			}
+			else if ( arg.find( PluginsOption ) == 0u )
+			{
+				options.pluginsDir = arg.substr( PluginsOption.size() );
+			}
+			else if ( arg.find( "--" ) != 0u && options.fileName.empty() )
+			{
+				options.fileName = arg;
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		return !options.fileName.empty();
+	}
+
+	std::vector< common::RendererPlugin > doListPlugins( std::string const & folder
+		, common::RendererFactory & factory )
+	{
+		common::StringArray files;
+		std::vector< common::RendererPlugin > result;
+
+		if ( common::listDirectoryFiles( folder, files, false ) )
+		{
+			for ( auto file : files )
+			{
+				if ( file.find( ".dll" ) != std::string::npos
+					|| file.find( ".so" ) != std::string::npos )
+				try
+				{
+					renderer::DynamicLibrary lib{ file };
+					result.emplace_back( std::move( lib )
+						, factory );
+				}
+				catch ( std::exception & exc )
+				{
+					std::clog << exc.what() << std::endl;
+				}
+			}
+		}
+
+		return result;
+	}
+
+	double doGetMilliseconds( std::chrono::nanoseconds value )
+	{
+		return double( value.count() ) / 1000000.0;
+	}
+
+	void doPrintTimes( capture_renderer::Player::FrameTimes const & times )
+	{
+		if ( times.empty() )
+		{
+			std::cout << "No frame was measured" << std::endl;
+			return;
+		}
+
+		auto minmax = std::minmax_element( times.begin(), times.end() );
+		std::chrono::nanoseconds total{ 0 };
+
+		for ( auto & time : times )
+		{
+			total += time;
+		}
+
+		std::cout << "Frames: " << times.size() << std::endl;
+		std::cout << "  min:  " << doGetMilliseconds( *minmax.first ) << " ms" << std::endl;
+		std::cout << "  mean: " << doGetMilliseconds( total / times.size() ) << " ms" << std::endl;
+		std::cout << "  max:  " << doGetMilliseconds( *minmax.second ) << " ms" << std::endl;
+	}
+}
+
+int main( int argc, char * argv[] )
+{
+	Options options;
+
+	if ( !doProcessCommandLine( argc, argv, options ) )
+	{
+		std::cerr << "Usage: CaptureReplay <capture file> [--renderer=<null|gl|vk>] [--loops=<count>] [--plugins-dir=<folder>]" << std::endl;
+		return 1;
+	}
+
+	try
+	{
+		common::RendererFactory factory;
+		auto plugins = doListPlugins( options.pluginsDir, factory );
+		renderer::Renderer::Configuration config
+		{
+			"CaptureReplay",
+			"RendererLib",
+			false,
+		};
+		auto name = options.renderer;
+
+		if ( name.empty() )
+		{
+			// Replay on the captured renderer by default.
+			std::ifstream file{ options.fileName, std::ios::binary };
+			capture_renderer::CaptureHeader header{};
+			uint32_t size{ 0u };
+			file.read( reinterpret_cast< char * >( &header ), sizeof( header ) );
+			file.read( reinterpret_cast< char * >( &size ), sizeof( size ) );
+			name.resize( size );
+			file.read( &name[0], size );
+		}
+
+		auto instance = factory.create( name, config );
+		auto device = instance->createDevice( instance->createConnection( 0u
+			, renderer::WindowHandle{} ) );
+		device->enable();
+		auto player = std::make_unique< capture_renderer::Player >( *device, options.fileName );
+
+		if ( player->getRendererName() != name )
+		{
+			// The shaders are stored as given to the captured renderer.
+			std::clog << "Warning: captured with the " << player->getRendererName()
+				<< " renderer, replayed with the " << name
+				<< " one, the shaders may not be supported" << std::endl;
+		}
+
+		auto times = player->play( options.loops );
+		doPrintTimes( times );
+
+		if ( player->getSkippedCount() )
+		{
+			std::cout << "Skipped: " << player->getSkippedCount() << " commands or chunks using unknown objects" << std::endl;
+		}
+
+		player.reset();
+		device->disable();
+		device.reset();
+		instance.reset();
+	}
+	catch ( std::exception & exc )
+	{
+		std::cerr << exc.what() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,71 @@
+project "CaptureRenderer"
+
+currentSourceDir = path.join( sourceDir, "Renderer", "CaptureRenderer" )
+currentBinaryDir = path.join( binaryDir, "Renderer", "CaptureRenderer" )
+
+kind( "StaticLib" )
+targetdir( path.join( outputDir, "%{cfg.architecture}", "%{cfg.buildcfg}", staticLibDir ) )
+location( currentBinaryDir )
+cppdialect( "C++17" )
+
+includedirs{
+	path.join( sourceDir, "Core" ),
+	path.join( sourceDir, "Renderer", "Renderer", "Src" ),
+	path.join( binaryDir, "Renderer", "Renderer", "Src" ),
+	path.join( currentBinaryDir, "Src" ),
+	path.join( currentSourceDir, "Src" )
+}
+
+links{
+	"Utils",
+	"Renderer"
+}
+
+forceincludes( "CaptureRendererPch.hpp" )
+
+pchheader( "CaptureRendererPch.hpp" )
+pchsource( "./Src/CaptureRendererPch.cpp" )
+
+files{ "./Src/**.hpp",
+	"./Src/**.inl",
+	"./Src/**.cpp"
+}
+
+vpaths{ ["Header Files"] = "**.hpp" }
+vpaths{ ["Header Files"] = "**.inl" }
+vpaths{ ["Source Files"] = "**.cpp" }
+
+
+project "CaptureReplay"
+
+kind( "ConsoleApp" )
+targetdir( path.join( outputDir, "%{cfg.architecture}", "%{cfg.buildcfg}", executableDir ) )
+location( currentBinaryDir )
+cppdialect( "C++17" )
+
+includedirs{
+	path.join( sourceDir, "Core" ),
+	path.join( sourceDir, "Renderer", "Renderer", "Src" ),
+	path.join( binaryDir, "Renderer", "Renderer", "Src" ),
+	path.join( currentSourceDir, "Src" )
+}
+
+links{
+	"CaptureRenderer",
+	"Utils",
+	"Renderer"
+}
+
+-- The replayed renderers are loaded as plugins.
+dependson{
+	"GlRenderer",
+	"VkRenderer",
+	"NullRenderer"
+}
+
+files{ "./Tools/**.hpp",
+	"./Tools/**.cpp"
+}
+
+vpaths{ ["Header Files"] = "**.hpp" }
+vpaths{ ["Source Files"] = "**.cpp" }
\ No newline at end of file
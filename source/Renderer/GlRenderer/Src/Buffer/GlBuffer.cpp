@@ -15,11 +15,20 @@ namespace gl_renderer
 			, target
 			, flags }
 		, m_target{ convert( target ) }
+		, m_directStateAccess{ static_cast< Device const & >( device ).hasDirectStateAccess() }
 	{
-		glLogCall( gl::GenBuffers, 1, &m_name );
-		glLogCall( gl::BindBuffer, m_target, m_name );
-		glLogCall( gl::BufferStorage, m_target, size, nullptr, GLbitfield( convert( flags ) ) );
-		glLogCall( gl::BindBuffer, m_target, 0u );
+		if ( m_directStateAccess )
+		{
+			glLogCall( gl::CreateBuffers, 1, &m_name );
+			glLogCall( gl::NamedBufferStorage, m_name, size, nullptr, GLbitfield( convert( flags ) ) );
+		}
+		else
+		{
+			glLogCall( gl::GenBuffers, 1, &m_name );
+			glLogCall( gl::BindBuffer, m_target, m_name );
+			glLogCall( gl::BufferStorage, m_target, size, nullptr, GLbitfield( convert( flags ) ) );
+			glLogCall( gl::BindBuffer, m_target, 0u );
+		}
 	}
 
 	Buffer::~Buffer()
@@ -32,6 +41,14 @@ namespace gl_renderer
 		, uint32_t size
 		, renderer::MemoryMapFlags flags )const
 	{
+		renderer::countStatistic( renderer::Statistic::eBufferMap );
+
+		if ( m_directStateAccess )
+		{
+			auto result = glLogCall( gl::MapNamedBufferRange, m_name, offset, size, GLbitfield( convert( flags ) ) );
+			return reinterpret_cast< uint8_t * >( result );
+		}
+
 		m_copyTarget = checkFlag( flags, renderer::MemoryMapFlag::eWrite )
 			? GL_BUFFER_TARGET_COPY_WRITE
 			: GL_BUFFER_TARGET_COPY_READ;
@@ -43,19 +60,36 @@ namespace gl_renderer
 	void Buffer::flush( uint32_t offset
 		, uint32_t size )const
 	{
-		glLogCall( gl::FlushMappedBufferRange, m_copyTarget, offset, size );
+		renderer::countStatistic( renderer::Statistic::eUpload );
+		renderer::countStatistic( renderer::Statistic::eUploadedBytes, size );
+
+		if ( m_directStateAccess )
+		{
+			glLogCall( gl::FlushMappedNamedBufferRange, m_name, offset, size );
+		}
+		else
+		{
+			glLogCall( gl::FlushMappedBufferRange, m_copyTarget, offset, size );
+		}
 	}
 
 	void Buffer::invalidate( uint32_t offset
 		, uint32_t size )const
 	{
-		glLogCall( gl::InvalidateBufferSubData, m_copyTarget, offset, size );
+		glLogCall( gl::InvalidateBufferSubData, m_name, offset, size );
 	}
 
 	void Buffer::unlock()const
 	{
-		glLogCall( gl::UnmapBuffer, m_copyTarget );
-		glLogCall( gl::BindBuffer, m_copyTarget, 0u );
+		if ( m_directStateAccess )
+		{
+			glLogCall( gl::UnmapNamedBuffer, m_name );
+		}
+		else
+		{
+			glLogCall( gl::UnmapBuffer, m_copyTarget );
+			glLogCall( gl::BindBuffer, m_copyTarget, 0u );
+		}
 	}
 
 	renderer::BufferMemoryBarrier Buffer::makeTransferDestination()const
@@ -107,6 +107,7 @@ namespace gl_renderer
 	private:
 		GLuint m_name{ GL_INVALID_INDEX };
 		GlBufferTarget m_target;
+		bool m_directStateAccess;
 		mutable GlBufferTarget m_copyTarget;
 	};
 }
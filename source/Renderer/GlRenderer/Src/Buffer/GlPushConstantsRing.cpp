@@ -0,0 +1,91 @@
+/*
+This file belongs to GlRenderer.
+See LICENSE file in root folder.
+*/
+#include "Buffer/GlPushConstantsRing.hpp"
+
+#include "Buffer/GlBuffer.hpp"
+#include "Core/GlDevice.hpp"
+
+namespace gl_renderer
+{
+	PushConstantsRing::PushConstantsRing( Device const & device )
+		: m_buffer{ renderer::makeBuffer< uint8_t >( device
+			, FrameCount * FrameSize
+			, renderer::BufferTarget::eUniformBuffer
+			, renderer::MemoryPropertyFlag::eHostVisible | renderer::MemoryPropertyFlag::eHostCoherent ) }
+		, m_name{ static_cast< Buffer const & >( m_buffer->getBuffer() ).getBuffer() }
+		, m_data{ m_buffer->lock( 0u
+			, FrameCount * FrameSize
+			, renderer::MemoryMapFlag::eWrite | renderer::MemoryMapFlag::ePersistent | renderer::MemoryMapFlag::eCoherent ) }
+		, m_alignment{ uint32_t( device.getPhysicalDevice().getProperties().limits.minUniformBufferOffsetAlignment ) }
+	{
+		if ( !m_data )
+		{
+			throw std::runtime_error{ "Couldn't map the push constants ring." };
+		}
+
+		GLint bindings = 0;
+		glLogCall( gl::GetIntegerv, GL_MAX_UNIFORM_BUFFER_BINDINGS, &bindings );
+		m_binding = GLuint( bindings - 1 );
+		m_fences.fill( nullptr );
+	}
+
+	PushConstantsRing::~PushConstantsRing()
+	{
+		for ( auto & fence : m_fences )
+		{
+			if ( fence )
+			{
+				glLogCall( gl::DeleteSync, fence );
+			}
+		}
+
+		m_buffer->unlock();
+	}
+
+	void PushConstantsRing::upload( renderer::ByteArray const & data )
+	{
+		auto size = uint32_t( data.size() );
+		assert( size <= FrameSize );
+		m_offset = m_alignment * ( ( m_offset + m_alignment - 1u ) / m_alignment );
+
+		if ( m_offset + size > FrameSize )
+		{
+			// The frame's zone is exhausted, the next one is used earlier.
+			nextFrame();
+		}
+
+		auto offset = m_frame * FrameSize + m_offset;
+		std::memcpy( m_data + offset, data.data(), size );
+		glLogCall( gl::BindBufferRange
+			, GL_BUFFER_TARGET_UNIFORM
+			, m_binding
+			, m_name
+			, offset
+			, size );
+		m_offset += size;
+	}
+
+	void PushConstantsRing::nextFrame()
+	{
+		if ( !m_offset )
+		{
+			return;
+		}
+
+		m_fences[m_frame] = glLogCall( gl::FenceSync, GL_WAIT_FLAG_SYNC_GPU_COMMANDS_COMPLETE, 0u );
+		m_frame = ( m_frame + 1u ) % FrameCount;
+		m_offset = 0u;
+
+		if ( auto & fence = m_fences[m_frame] )
+		{
+			glLogCall( gl::ClientWaitSync
+				, fence
+				, GL_WAIT_FLAG_SYNC_FLUSH_COMMANDS_BIT
+				, std::numeric_limits< GLuint64 >::max() );
+			glLogCall( gl::DeleteSync, fence );
+			fence = nullptr;
+		}
+	}
+}
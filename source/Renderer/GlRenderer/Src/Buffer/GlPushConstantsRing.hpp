@@ -0,0 +1,70 @@
+/*
+This file belongs to GlRenderer.
+See LICENSE file in root folder.
+*/
+#pragma once
+
+#include "GlRendererPrerequisites.hpp"
+
+#include <Buffer/Buffer.hpp>
+
+#include <array>
+
+namespace gl_renderer
+{
+	/**
+	*\brief
+	*	Anneau de tampons uniformes, mappé de manière persistante, recevant les blocs de push constants.
+	*\remarks
+	*	Le tampon est découpé en une zone par frame, une zone n'étant réutilisée
+	*	qu'une fois que le GPU a fini de lire les données qui y ont été écrites.
+	*/
+	class PushConstantsRing
+	{
+	public:
+		//! Le nombre de frames pouvant être en vol.
+		static uint32_t constexpr FrameCount = 3u;
+		//! La taille de la zone d'une frame.
+		static uint32_t constexpr FrameSize = 1024u * 1024u;
+
+	public:
+		/**
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique, son contexte doit être actif.
+		*/
+		explicit PushConstantsRing( Device const & device );
+		~PushConstantsRing();
+		/**
+		*\brief
+		*	Ecrit un bloc dans la zone de la frame courante, et le lie au point d'attache réservé.
+		*\param[in] data
+		*	Le bloc.
+		*/
+		void upload( renderer::ByteArray const & data );
+		/**
+		*\brief
+		*	Passe à la zone suivante, en attendant que le GPU ait fini de la lire.
+		*/
+		void nextFrame();
+		/**
+		*\return
+		*	Le point d'attache de tampon uniforme réservé aux push constants.
+		*/
+		inline GLuint getBinding()const
+		{
+			return m_binding;
+		}
+
+	private:
+		renderer::BufferPtr< uint8_t > m_buffer;
+		GLuint m_name;
+		uint8_t * m_data;
+		uint32_t m_alignment;
+		GLuint m_binding;
+		uint32_t m_frame{ 0u };
+		uint32_t m_offset{ 0u };
+		std::array< GLsync, FrameCount > m_fences;
+	};
+}
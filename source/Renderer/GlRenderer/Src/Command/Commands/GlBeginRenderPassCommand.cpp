@@ -10,6 +10,8 @@ See LICENSE file in root folder.
 
 #include <RenderPass/ClearValue.hpp>
 
+#include <algorithm>
+
 namespace gl_renderer
 {
 	namespace
@@ -91,6 +93,16 @@ namespace gl_renderer
 
 			return result;
 		}
+
+		bool hasSRGBAttach( RenderPass const & renderPass )
+		{
+			return renderPass.end() != std::find_if( renderPass.begin()
+				, renderPass.end()
+				, []( renderer::RenderPassAttachment const & attach )
+				{
+					return attach.format == renderer::PixelFormat::eR8G8B8A8_SRGB;
+				} );
+		}
 	}
 
 	BeginRenderPassCommand::BeginRenderPassCommand( renderer::RenderPass const & renderPass
@@ -102,6 +114,7 @@ namespace gl_renderer
 		, m_subpass{ static_cast< RenderSubpass const & >( *renderPass.getSubpasses()[index] ) }
 		, m_frameBuffer{ static_cast< FrameBuffer const & >( frameBuffer ) }
 		, m_clearValues{ clearValues }
+		, m_srgb{ hasSRGBAttach( m_renderPass ) }
 	{
 		assert( ( m_frameBuffer.getFrameBuffer() && m_frameBuffer.getSize() == m_clearValues.size() )
 			|| !m_frameBuffer.getFrameBuffer() );
@@ -112,6 +125,16 @@ namespace gl_renderer
 		glLogCommand( "BeginRenderPassCommand" );
 		glLogCall( gl::BindFramebuffer, GL_FRAMEBUFFER, m_frameBuffer.getFrameBuffer() );
 
+		// Like in Vulkan, the writes to sRGB attachments are encoded.
+		if ( m_srgb )
+		{
+			glLogCall( gl::Enable, GL_FRAMEBUFFER_SRGB );
+		}
+		else
+		{
+			glLogCall( gl::Disable, GL_FRAMEBUFFER_SRGB );
+		}
+
 		GLint colourIndex = 0u;
 		GLint depthStencilIndex = 0u;
 
@@ -42,5 +42,6 @@ namespace gl_renderer
 		RenderSubpass const & m_subpass;
 		FrameBuffer const & m_frameBuffer;
 		renderer::ClearValueArray m_clearValues;
+		bool m_srgb;
 	};
 }
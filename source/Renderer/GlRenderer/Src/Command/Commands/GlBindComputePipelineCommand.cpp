@@ -4,6 +4,7 @@ See LICENSE file in root folder.
 */
 #include "GlBindComputePipelineCommand.hpp"
 
+#include "Buffer/GlPushConstantsRing.hpp"
 #include "Core/GlDevice.hpp"
 #include "Pipeline/GlComputePipeline.hpp"
 #include "Pipeline/GlPipelineLayout.hpp"
@@ -31,6 +32,11 @@ namespace gl_renderer
 			glLogCall( gl::UseProgram, m_program );
 			save = m_program;
 		}
+
+		if ( m_pipeline.getShaderProgram().hasPushConstantsBlock() )
+		{
+			m_device.getPushConstantsRing()->upload( m_pipeline.getShaderProgram().getPushConstantsBlock() );
+		}
 	}
 
 	CommandPtr BindComputePipelineCommand::clone()const
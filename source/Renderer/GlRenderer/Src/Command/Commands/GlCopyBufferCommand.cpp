@@ -5,15 +5,18 @@ See LICENSE file in root folder.
 #include "GlCopyBufferCommand.hpp"
 
 #include "Buffer/GlBuffer.hpp"
+#include "Core/GlDevice.hpp"
 
 #include <Miscellaneous/BufferCopy.hpp>
 
 namespace gl_renderer
 {
-	CopyBufferCommand::CopyBufferCommand( renderer::BufferCopy const & copyInfo
+	CopyBufferCommand::CopyBufferCommand( Device const & device
+		, renderer::BufferCopy const & copyInfo
 		, renderer::BufferBase const & src
 		, renderer::BufferBase const & dst )
-		: m_src{ static_cast< Buffer const & >( src ) }
+		: m_device{ device }
+		, m_src{ static_cast< Buffer const & >( src ) }
 		, m_dst{ static_cast< Buffer const & >( dst ) }
 		, m_copyInfo{ copyInfo }
 	{
@@ -22,7 +25,17 @@ namespace gl_renderer
 	void CopyBufferCommand::apply()const
 	{
 		glLogCommand( "CopyBufferCommand" );
-		if ( m_src.getTarget() == m_dst.getTarget() )
+
+		if ( m_device.hasDirectStateAccess() )
+		{
+			glLogCall( gl::CopyNamedBufferSubData
+				, m_src.getBuffer()
+				, m_dst.getBuffer()
+				, m_copyInfo.srcOffset
+				, m_copyInfo.dstOffset
+				, m_copyInfo.size );
+		}
+		else if ( m_src.getTarget() == m_dst.getTarget() )
 		{
 			glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_COPY_READ, m_src.getBuffer() );
 			glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_COPY_WRITE, m_dst.getBuffer() );
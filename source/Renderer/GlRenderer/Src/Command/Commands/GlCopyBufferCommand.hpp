@@ -21,6 +21,8 @@ namespace gl_renderer
 		/**
 		*\brief
 		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
 		*\param[in] copyInfo
 		*	Les informations de copie.
 		*\param[in] src
@@ -28,7 +30,8 @@ namespace gl_renderer
 		*\param[in] dst
 		*	Le tampon destination.
 		*/
-		CopyBufferCommand( renderer::BufferCopy const & copyInfo
+		CopyBufferCommand( Device const & device
+			, renderer::BufferCopy const & copyInfo
 			, renderer::BufferBase const & src
 			, renderer::BufferBase const & dst );
 
@@ -36,6 +39,7 @@ namespace gl_renderer
 		CommandPtr clone()const override;
 
 	private:
+		Device const & m_device;
 		Buffer const & m_src;
 		Buffer const & m_dst;
 		renderer::BufferCopy m_copyInfo;
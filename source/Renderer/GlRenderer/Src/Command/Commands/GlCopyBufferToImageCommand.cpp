@@ -5,6 +5,7 @@ See LICENSE file in root folder.
 #include "GlCopyBufferToImageCommand.hpp"
 
 #include "Buffer/GlBuffer.hpp"
+#include "Core/GlDevice.hpp"
 #include "Image/GlTexture.hpp"
 #include "Image/GlTextureView.hpp"
 
@@ -36,10 +37,12 @@ namespace gl_renderer
 		}
 	}
 
-	CopyBufferToImageCommand::CopyBufferToImageCommand( renderer::BufferImageCopyArray const & copyInfo
+	CopyBufferToImageCommand::CopyBufferToImageCommand( Device const & device
+		, renderer::BufferImageCopyArray const & copyInfo
 		, renderer::BufferBase const & src
 		, renderer::Texture const & dst )
-		: m_copyInfo{ copyInfo }
+		: m_device{ device }
+		, m_copyInfo{ copyInfo }
 		, m_src{ static_cast< Buffer const & >( src ) }
 		, m_dst{ static_cast< Texture const & >( dst ) }
 		, m_format{ getFormat( m_dst.getFormat() ) }
@@ -53,6 +56,19 @@ namespace gl_renderer
 	{
 		glLogCommand( "CopyBufferToImageCommand" );
 
+		if ( m_device.hasDirectStateAccess() )
+		{
+			glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_PIXEL_UNPACK, m_src.getBuffer() );
+
+			for ( auto & copyInfo : m_copyInfo )
+			{
+				applyOneDirect( copyInfo );
+			}
+
+			glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_PIXEL_UNPACK, 0u );
+			return;
+		}
+
 		for ( size_t i = 0; i < m_copyInfo.size(); ++i )
 		{
 			applyOne( m_copyInfo[i] );
@@ -192,4 +208,125 @@ namespace gl_renderer
 		glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_PIXEL_UNPACK, 0u );
 		glLogCall( gl::BindTexture, m_copyTarget, 0u );
 	}
+
+	void CopyBufferToImageCommand::applyOneDirect( renderer::BufferImageCopy const & copyInfo )const
+	{
+		// The texture is edited through its name, its array layers being addressed
+		// as the next dimension, cube maps included.
+		auto level = GLint( copyInfo.imageSubresource.mipLevel );
+		auto layer = GLint( copyInfo.imageSubresource.baseArrayLayer );
+		auto layers = GLsizei( copyInfo.imageSubresource.layerCount );
+		auto data = BufferOffset( copyInfo.bufferOffset );
+		bool compressed = renderer::isCompressedFormat( m_dst.getFormat() );
+
+		switch ( m_dst.getTarget() )
+		{
+		case GL_TEXTURE_1D:
+			if ( compressed )
+			{
+				glLogCall( gl::CompressedTextureSubImage1D
+					, m_dst.getImage()
+					, level
+					, copyInfo.imageOffset[0]
+					, copyInfo.imageExtent[0]
+					, m_internal
+					, copyInfo.levelSize
+					, data );
+			}
+			else
+			{
+				glLogCall( gl::TextureSubImage1D
+					, m_dst.getImage()
+					, level
+					, copyInfo.imageOffset[0]
+					, copyInfo.imageExtent[0]
+					, m_format
+					, m_type
+					, data );
+			}
+			break;
+
+		case GL_TEXTURE_1D_ARRAY:
+		case GL_TEXTURE_2D:
+			{
+				bool array = m_dst.getTarget() == GL_TEXTURE_1D_ARRAY;
+				GLint y = array ? layer : copyInfo.imageOffset[1];
+				GLsizei height = array ? layers : GLsizei( copyInfo.imageExtent[1] );
+
+				if ( compressed )
+				{
+					glLogCall( gl::CompressedTextureSubImage2D
+						, m_dst.getImage()
+						, level
+						, copyInfo.imageOffset[0]
+						, y
+						, copyInfo.imageExtent[0]
+						, height
+						, m_internal
+						, copyInfo.levelSize
+						, data );
+				}
+				else
+				{
+					glLogCall( gl::TextureSubImage2D
+						, m_dst.getImage()
+						, level
+						, copyInfo.imageOffset[0]
+						, y
+						, copyInfo.imageExtent[0]
+						, height
+						, m_format
+						, m_type
+						, data );
+				}
+			}
+			break;
+
+		case GL_TEXTURE_2D_ARRAY:
+		case GL_TEXTURE_CUBE_MAP:
+		case GL_TEXTURE_CUBE_MAP_ARRAY:
+		case GL_TEXTURE_3D:
+			{
+				bool array = m_dst.getTarget() != GL_TEXTURE_3D;
+				GLint z = array ? layer : copyInfo.imageOffset[2];
+				GLsizei depth = array ? layers : GLsizei( copyInfo.imageExtent[2] );
+
+				if ( compressed )
+				{
+					glLogCall( gl::CompressedTextureSubImage3D
+						, m_dst.getImage()
+						, level
+						, copyInfo.imageOffset[0]
+						, copyInfo.imageOffset[1]
+						, z
+						, copyInfo.imageExtent[0]
+						, copyInfo.imageExtent[1]
+						, depth
+						, m_internal
+						, copyInfo.levelSize
+						, data );
+				}
+				else
+				{
+					glLogCall( gl::TextureSubImage3D
+						, m_dst.getImage()
+						, level
+						, copyInfo.imageOffset[0]
+						, copyInfo.imageOffset[1]
+						, z
+						, copyInfo.imageExtent[0]
+						, copyInfo.imageExtent[1]
+						, depth
+						, m_format
+						, m_type
+						, data );
+				}
+			}
+			break;
+
+		default:
+			assert( false && "Unsupported texture target for a buffer to image copy" );
+			break;
+		}
+	}
 }
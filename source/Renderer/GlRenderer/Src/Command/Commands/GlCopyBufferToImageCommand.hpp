@@ -21,6 +21,8 @@ namespace gl_renderer
 		/**
 		*\brief
 		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
 		*\param[in] copyInfo
 		*	Les informations de copie.
 		*\param[in] src
@@ -28,7 +30,8 @@ namespace gl_renderer
 		*\param[in] dst
 		*	L'image destination.
 		*/
-		CopyBufferToImageCommand( renderer::BufferImageCopyArray const & copyInfo
+		CopyBufferToImageCommand( Device const & device
+			, renderer::BufferImageCopyArray const & copyInfo
 			, renderer::BufferBase const & src
 			, renderer::Texture const & dst );
 
@@ -37,8 +40,10 @@ namespace gl_renderer
 
 	private:
 		void applyOne( renderer::BufferImageCopy const & copyInfo )const;
+		void applyOneDirect( renderer::BufferImageCopy const & copyInfo )const;
 
 	private:
+		Device const & m_device;
 		Buffer const & m_src;
 		Texture const & m_dst;
 		renderer::BufferImageCopyArray m_copyInfo;
@@ -49,7 +49,6 @@ namespace gl_renderer
 			, m_copyInfo.extent[2] );
 		glLogCall( gl::BindTexture, m_dstTarget, 0u );
 		glLogCall( gl::BindTexture, m_srcTarget, 0u );
-		m_dst.getTexture().generateMipmaps();
 	}
 
 	CommandPtr CopyImageCommand::clone()const
@@ -5,12 +5,15 @@ See LICENSE file in root folder.
 #include "GlCopyImageToBufferCommand.hpp"
 
 #include "Buffer/GlBuffer.hpp"
+#include "Core/GlDevice.hpp"
 #include "Image/GlTexture.hpp"
 #include "Image/GlTextureView.hpp"
 
 #include <Image/ImageSubresourceRange.hpp>
 #include <Miscellaneous/BufferImageCopy.hpp>
 
+#include <algorithm>
+
 namespace gl_renderer
 {
 	namespace
@@ -69,10 +72,12 @@ namespace gl_renderer
 		}
 	}
 
-	CopyImageToBufferCommand::CopyImageToBufferCommand( renderer::BufferImageCopyArray const & copyInfo
+	CopyImageToBufferCommand::CopyImageToBufferCommand( Device const & device
+		, renderer::BufferImageCopyArray const & copyInfo
 		, renderer::Texture const & src
 		, renderer::BufferBase const & dst )
-		: m_src{ static_cast< Texture const & >( src ) }
+		: m_device{ device }
+		, m_src{ static_cast< Texture const & >( src ) }
 		, m_dst{ static_cast< Buffer const & >( dst ) }
 		, m_copyInfo{ copyInfo }
 		, m_format{ getFormat( m_src.getFormat() ) }
@@ -86,6 +91,18 @@ namespace gl_renderer
 	{
 		glLogCommand( "CopyImageToBufferCommand" );
 		glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_PIXEL_PACK, m_dst.getBuffer() );
+
+		if ( m_device.hasDirectStateAccess() )
+		{
+			for ( auto & copyInfo : m_copyInfo )
+			{
+				applyOneDirect( copyInfo );
+			}
+
+			glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_PIXEL_PACK, 0u );
+			return;
+		}
+
 		glLogCall( gl::BindTexture, m_target, m_src.getImage() );
 
 		for ( size_t i = 0; i < m_views.size(); ++i )
@@ -109,6 +126,31 @@ namespace gl_renderer
 			, nullptr );
 	}
 
+	void CopyImageToBufferCommand::applyOneDirect( renderer::BufferImageCopy const & copyInfo )const
+	{
+		// The array layers are addressed as the dimension following the texture's ones.
+		auto target = m_src.getTarget();
+		bool layersInY = target == GL_TEXTURE_1D_ARRAY;
+		bool layersInZ = target == GL_TEXTURE_2D_ARRAY
+			|| target == GL_TEXTURE_CUBE_MAP
+			|| target == GL_TEXTURE_CUBE_MAP_ARRAY;
+		auto layer = GLint( copyInfo.imageSubresource.baseArrayLayer );
+		auto layers = GLsizei( copyInfo.imageSubresource.layerCount );
+		glLogCall( gl::GetTextureSubImage
+			, m_src.getImage()
+			, GLint( copyInfo.imageSubresource.mipLevel )
+			, copyInfo.imageOffset[0]
+			, layersInY ? layer : copyInfo.imageOffset[1]
+			, layersInZ ? layer : copyInfo.imageOffset[2]
+			, GLsizei( copyInfo.imageExtent[0] )
+			, layersInY ? layers : GLsizei( std::max( 1u, copyInfo.imageExtent[1] ) )
+			, layersInZ ? layers : GLsizei( std::max( 1u, copyInfo.imageExtent[2] ) )
+			, m_format
+			, m_type
+			, GLsizei( m_dst.getSize() - copyInfo.bufferOffset )
+			, BufferOffset( copyInfo.bufferOffset ) );
+	}
+
 	CommandPtr CopyImageToBufferCommand::clone()const
 	{
 		return std::make_unique< CopyImageToBufferCommand >( *this );
@@ -21,6 +21,8 @@ namespace gl_renderer
 		/**
 		*\brief
 		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
 		*\param[in] copyInfo
 		*	Les informations de copie.
 		*\param[in] src
@@ -28,7 +30,8 @@ namespace gl_renderer
 		*\param[in] dst
 		*	Le tampon destination.
 		*/
-		CopyImageToBufferCommand( renderer::BufferImageCopyArray const & copyInfo
+		CopyImageToBufferCommand( Device const & device
+			, renderer::BufferImageCopyArray const & copyInfo
 			, renderer::Texture const & src
 			, renderer::BufferBase const & dst );
 
@@ -38,8 +41,10 @@ namespace gl_renderer
 	private:
 		void applyOne( renderer::BufferImageCopy const & copyInfo
 			, renderer::TextureView const & view )const;
+		void applyOneDirect( renderer::BufferImageCopy const & copyInfo )const;
 
 	private:
+		Device const & m_device;
 		Texture const & m_src;
 		Buffer const & m_dst;
 		renderer::BufferImageCopyArray m_copyInfo;
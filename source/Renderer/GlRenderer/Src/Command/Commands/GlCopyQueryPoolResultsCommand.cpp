@@ -0,0 +1,130 @@
+/*
+This file belongs to GlRenderer.
+See LICENSE file in root folder.
+*/
+#include "GlCopyQueryPoolResultsCommand.hpp"
+
+#include "Buffer/GlBuffer.hpp"
+#include "Core/GlDevice.hpp"
+#include "Miscellaneous/GlQueryPool.hpp"
+
+#include <cstring>
+
+namespace gl_renderer
+{
+	CopyQueryPoolResultsCommand::CopyQueryPoolResultsCommand( Device const & device
+		, renderer::QueryPool const & pool
+		, uint32_t firstQuery
+		, uint32_t queryCount
+		, renderer::BufferBase const & dstBuffer
+		, uint32_t dstOffset
+		, uint32_t stride
+		, renderer::QueryResultFlags flags )
+		: m_device{ device }
+		, m_pool{ static_cast< QueryPool const & >( pool ) }
+		, m_firstQuery{ firstQuery }
+		, m_queryCount{ queryCount }
+		, m_dstBuffer{ static_cast< Buffer const & >( dstBuffer ) }
+		, m_dstOffset{ dstOffset }
+		, m_stride{ stride }
+		, m_flags{ flags }
+	{
+	}
+
+	void CopyQueryPoolResultsCommand::apply()const
+	{
+		glLogCommand( "CopyQueryPoolResultsCommand" );
+
+		if ( m_device.hasQueryBuffer() )
+		{
+			doApplyQueryBuffer();
+		}
+		else
+		{
+			doApplyFallback();
+		}
+	}
+
+	CommandPtr CopyQueryPoolResultsCommand::clone()const
+	{
+		return std::make_unique< CopyQueryPoolResultsCommand >( *this );
+	}
+
+	void CopyQueryPoolResultsCommand::doApplyQueryBuffer()const
+	{
+		auto is64 = checkFlag( m_flags, renderer::QueryResultFlag::e64 );
+		auto withAvailability = checkFlag( m_flags, renderer::QueryResultFlag::eWithAvailability );
+		auto resultSize = is64 ? sizeof( GLuint64 ) : sizeof( GLuint );
+		auto pname = convert( m_flags );
+		glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_QUERY, m_dstBuffer.getBuffer() );
+
+		for ( uint32_t i = 0u; i < m_queryCount; ++i )
+		{
+			auto name = *( m_pool.begin() + m_firstQuery + i );
+			auto offset = m_dstOffset + i * m_stride;
+
+			// Le résultat n'est pas écrit si la requête n'est pas disponible, avec GL_QUERY_RESULT_NO_WAIT.
+			if ( is64 )
+			{
+				glLogCall( gl::GetQueryObjectui64v, name, pname, reinterpret_cast< GLuint64 * >( BufferOffset( offset ) ) );
+			}
+			else
+			{
+				glLogCall( gl::GetQueryObjectuiv, name, pname, reinterpret_cast< GLuint * >( BufferOffset( offset ) ) );
+			}
+
+			if ( withAvailability )
+			{
+				if ( is64 )
+				{
+					glLogCall( gl::GetQueryObjectui64v, name, GL_QUERY_RESULT_AVAILABLE, reinterpret_cast< GLuint64 * >( BufferOffset( offset + resultSize ) ) );
+				}
+				else
+				{
+					glLogCall( gl::GetQueryObjectuiv, name, GL_QUERY_RESULT_AVAILABLE, reinterpret_cast< GLuint * >( BufferOffset( offset + resultSize ) ) );
+				}
+			}
+		}
+
+		glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_QUERY, 0u );
+	}
+
+	void CopyQueryPoolResultsCommand::doApplyFallback()const
+	{
+		if ( !m_queryCount )
+		{
+			return;
+		}
+
+		auto is64 = checkFlag( m_flags, renderer::QueryResultFlag::e64 );
+		auto withAvailability = checkFlag( m_flags, renderer::QueryResultFlag::eWithAvailability );
+		auto resultSize = uint32_t( is64 ? sizeof( uint64_t ) : sizeof( uint32_t ) );
+		auto size = ( m_queryCount - 1u ) * m_stride + resultSize * ( withAvailability ? 2u : 1u );
+		// Le tampon est relu, pour que les résultats non disponibles y restent inchangés.
+		auto buffer = m_dstBuffer.lock( m_dstOffset
+			, size
+			, renderer::MemoryMapFlag::eRead | renderer::MemoryMapFlag::eWrite );
+
+		if ( !buffer )
+		{
+			return;
+		}
+
+		if ( is64 )
+		{
+			renderer::UInt64Array data( ( size + resultSize - 1u ) / resultSize );
+			std::memcpy( data.data(), buffer, size );
+			m_pool.getResults( m_firstQuery, m_queryCount, m_stride, m_flags, data );
+			std::memcpy( buffer, data.data(), size );
+		}
+		else
+		{
+			renderer::UInt32Array data( ( size + resultSize - 1u ) / resultSize );
+			std::memcpy( data.data(), buffer, size );
+			m_pool.getResults( m_firstQuery, m_queryCount, m_stride, m_flags, data );
+			std::memcpy( buffer, data.data(), size );
+		}
+
+		m_dstBuffer.unlock();
+	}
+}
@@ -0,0 +1,68 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "GlCommandBase.hpp"
+
+namespace gl_renderer
+{
+	/**
+	*\brief
+	*	Commande de copie des résultats de requêtes dans un tampon.
+	*\remarks
+	*	Avec GL_ARB_query_buffer_object, les résultats sont écrits par le GPU dans le tampon, lié à GL_QUERY_BUFFER.
+	*	Sinon, ils sont lus côté CPU puis écrits dans le tampon mappé, ce qui peut bloquer avec QueryResultFlag::eWait.
+	*/
+	class CopyQueryPoolResultsCommand
+		: public CommandBase
+	{
+	public:
+		/**
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] pool
+		*	Le pool de requêtes.
+		*\param[in] firstQuery
+		*	L'index de la première requête.
+		*\param[in] queryCount
+		*	Le nombre de requêtes (à partir de \p firstQuery).
+		*\param[in] dstBuffer
+		*	Le tampon recevant les résultats.
+		*\param[in] dstOffset
+		*	L'offset en octets dans \p dstBuffer.
+		*\param[in] stride
+		*	L'intervalle en octets entre les résultats pour chaque requête, dans \p dstBuffer.
+		*\param[in] flags
+		*	Définit quand et comment les résultats sont récupérés.
+		*/
+		CopyQueryPoolResultsCommand( Device const & device
+			, renderer::QueryPool const & pool
+			, uint32_t firstQuery
+			, uint32_t queryCount
+			, renderer::BufferBase const & dstBuffer
+			, uint32_t dstOffset
+			, uint32_t stride
+			, renderer::QueryResultFlags flags );
+
+		void apply()const override;
+		CommandPtr clone()const override;
+
+	private:
+		void doApplyQueryBuffer()const;
+		void doApplyFallback()const;
+
+	private:
+		Device const & m_device;
+		QueryPool const & m_pool;
+		uint32_t m_firstQuery;
+		uint32_t m_queryCount;
+		Buffer const & m_dstBuffer;
+		uint32_t m_dstOffset;
+		uint32_t m_stride;
+		renderer::QueryResultFlags m_flags;
+	};
+}
@@ -0,0 +1,67 @@
+/*
+This file belongs to GlRenderer.
+See LICENSE file in root folder.
+*/
+#include "GlDrawIndexedIndirectCountCommand.hpp"
+
+#include "Buffer/GlBuffer.hpp"
+
+namespace gl_renderer
+{
+	DrawIndexedIndirectCountCommand::DrawIndexedIndirectCountCommand( renderer::BufferBase const & buffer
+		, uint32_t offset
+		, renderer::BufferBase const & countBuffer
+		, uint32_t countBufferOffset
+		, uint32_t maxDrawCount
+		, uint32_t stride
+		, renderer::PrimitiveTopology mode
+		, renderer::IndexType type
+		, bool native )
+		: m_buffer{ static_cast< Buffer const & >( buffer ) }
+		, m_offset{ offset }
+		, m_countBuffer{ static_cast< Buffer const & >( countBuffer ) }
+		, m_countBufferOffset{ countBufferOffset }
+		, m_maxDrawCount{ maxDrawCount }
+		, m_stride{ stride }
+		, m_mode{ convert( mode ) }
+		, m_type{ convert( type ) }
+		, m_native{ native }
+	{
+	}
+
+	void DrawIndexedIndirectCountCommand::apply()const
+	{
+		glLogCommand( "DrawIndexedIndirectCountCommand" );
+		glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_DRAW_INDIRECT, m_buffer.getBuffer() );
+
+		if ( m_native )
+		{
+			glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_PARAMETER, m_countBuffer.getBuffer() );
+			glLogCall( gl::MultiDrawElementsIndirectCountARB
+				, m_mode
+				, m_type
+				, BufferOffset( m_offset )
+				, GLintptr( m_countBufferOffset )
+				, m_maxDrawCount
+				, m_stride );
+			glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_PARAMETER, 0 );
+		}
+		else
+		{
+			// Emulation: the unused draws are expected to have a zero instance count.
+			glLogCall( gl::MultiDrawElementsIndirect
+				, m_mode
+				, m_type
+				, BufferOffset( m_offset )
+				, m_maxDrawCount
+				, m_stride );
+		}
+
+		glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_DRAW_INDIRECT, 0 );
+	}
+
+	CommandPtr DrawIndexedIndirectCountCommand::clone()const
+	{
+		return std::make_unique< DrawIndexedIndirectCountCommand >( *this );
+	}
+}
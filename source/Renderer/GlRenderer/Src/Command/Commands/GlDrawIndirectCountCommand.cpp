@@ -0,0 +1,63 @@
+/*
+This file belongs to GlRenderer.
+See LICENSE file in root folder.
+*/
+#include "GlDrawIndirectCountCommand.hpp"
+
+#include "Buffer/GlBuffer.hpp"
+
+namespace gl_renderer
+{
+	DrawIndirectCountCommand::DrawIndirectCountCommand( renderer::BufferBase const & buffer
+		, uint32_t offset
+		, renderer::BufferBase const & countBuffer
+		, uint32_t countBufferOffset
+		, uint32_t maxDrawCount
+		, uint32_t stride
+		, renderer::PrimitiveTopology mode
+		, bool native )
+		: m_buffer{ static_cast< Buffer const & >( buffer ) }
+		, m_offset{ offset }
+		, m_countBuffer{ static_cast< Buffer const & >( countBuffer ) }
+		, m_countBufferOffset{ countBufferOffset }
+		, m_maxDrawCount{ maxDrawCount }
+		, m_stride{ stride }
+		, m_mode{ convert( mode ) }
+		, m_native{ native }
+	{
+	}
+
+	void DrawIndirectCountCommand::apply()const
+	{
+		glLogCommand( "DrawIndirectCountCommand" );
+		glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_DRAW_INDIRECT, m_buffer.getBuffer() );
+
+		if ( m_native )
+		{
+			glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_PARAMETER, m_countBuffer.getBuffer() );
+			glLogCall( gl::MultiDrawArraysIndirectCountARB
+				, m_mode
+				, BufferOffset( m_offset )
+				, GLintptr( m_countBufferOffset )
+				, m_maxDrawCount
+				, m_stride );
+			glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_PARAMETER, 0 );
+		}
+		else
+		{
+			// Emulation: the unused draws are expected to have a zero instance count.
+			glLogCall( gl::MultiDrawArraysIndirect
+				, m_mode
+				, BufferOffset( m_offset )
+				, m_maxDrawCount
+				, m_stride );
+		}
+
+		glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_DRAW_INDIRECT, 0 );
+	}
+
+	CommandPtr DrawIndirectCountCommand::clone()const
+	{
+		return std::make_unique< DrawIndirectCountCommand >( *this );
+	}
+}
@@ -0,0 +1,37 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "GlCommandBase.hpp"
+
+namespace gl_renderer
+{
+	class DrawIndirectCountCommand
+		: public CommandBase
+	{
+	public:
+		DrawIndirectCountCommand( renderer::BufferBase const & buffer
+			, uint32_t offset
+			, renderer::BufferBase const & countBuffer
+			, uint32_t countBufferOffset
+			, uint32_t maxDrawCount
+			, uint32_t stride
+			, renderer::PrimitiveTopology mode
+			, bool native );
+
+		void apply()const override;
+		CommandPtr clone()const override;
+
+	private:
+		Buffer const & m_buffer;
+		uint32_t m_offset;
+		Buffer const & m_countBuffer;
+		uint32_t m_countBufferOffset;
+		uint32_t m_maxDrawCount;
+		uint32_t m_stride;
+		GlPrimitiveTopology m_mode;
+		bool m_native;
+	};
+}
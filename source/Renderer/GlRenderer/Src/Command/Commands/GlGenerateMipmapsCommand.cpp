@@ -0,0 +1,66 @@
+/*
+This file belongs to GlRenderer.
+See LICENSE file in root folder.
+*/
+#include "GlGenerateMipmapsCommand.hpp"
+
+#include "Core/GlDevice.hpp"
+#include "Image/GlTexture.hpp"
+
+namespace gl_renderer
+{
+	GenerateMipmapsCommand::GenerateMipmapsCommand( Device const & device
+		, renderer::Texture const & texture
+		, uint32_t baseMipLevel )
+		: m_device{ device }
+		, m_texture{ static_cast< Texture const & >( texture ) }
+		, m_baseMipLevel{ baseMipLevel }
+	{
+	}
+
+	void GenerateMipmapsCommand::apply()const
+	{
+		glLogCommand( "GenerateMipmapsCommand" );
+
+		if ( m_device.hasDirectStateAccess() )
+		{
+			if ( m_baseMipLevel )
+			{
+				// Only the levels following the modified one are regenerated.
+				glLogCall( gl::TextureParameteri, m_texture.getImage(), GL_TEXTURE_BASE_LEVEL, GLint( m_baseMipLevel ) );
+			}
+
+			glLogCall( gl::GenerateTextureMipmap, m_texture.getImage() );
+
+			if ( m_baseMipLevel )
+			{
+				glLogCall( gl::TextureParameteri, m_texture.getImage(), GL_TEXTURE_BASE_LEVEL, 0 );
+			}
+
+			return;
+		}
+
+		auto target = m_texture.getTarget();
+		glLogCall( gl::BindTexture, target, m_texture.getImage() );
+
+		if ( m_baseMipLevel )
+		{
+			// Only the levels following the modified one are regenerated.
+			glLogCall( gl::TexParameteri, target, GL_TEXTURE_BASE_LEVEL, GLint( m_baseMipLevel ) );
+		}
+
+		glLogCall( gl::GenerateMipmap, target );
+
+		if ( m_baseMipLevel )
+		{
+			glLogCall( gl::TexParameteri, target, GL_TEXTURE_BASE_LEVEL, 0 );
+		}
+
+		glLogCall( gl::BindTexture, target, 0 );
+	}
+
+	CommandPtr GenerateMipmapsCommand::clone()const
+	{
+		return std::make_unique< GenerateMipmapsCommand >( *this );
+	}
+}
@@ -0,0 +1,41 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "GlCommandBase.hpp"
+
+namespace gl_renderer
+{
+	/**
+	*\brief
+	*	Commande de génération des mipmaps d'une texture.
+	*/
+	class GenerateMipmapsCommand
+		: public CommandBase
+	{
+	public:
+		/**
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] texture
+		*	La texture.
+		*\param[in] baseMipLevel
+		*	Le niveau source, les niveaux suivants sont régénérés.
+		*/
+		GenerateMipmapsCommand( Device const & device
+			, renderer::Texture const & texture
+			, uint32_t baseMipLevel );
+
+		void apply()const override;
+		CommandPtr clone()const override;
+
+	private:
+		Device const & m_device;
+		Texture const & m_texture;
+		uint32_t m_baseMipLevel;
+	};
+}
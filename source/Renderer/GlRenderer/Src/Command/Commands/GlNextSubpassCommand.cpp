@@ -29,6 +29,24 @@ namespace gl_renderer
 		{
 			m_frameBuffer.setDrawBuffers( m_subpass.getAttaches() );
 		}
+
+		// The input attachments are sampled from the bound frame buffer's textures,
+		// the texture barrier makes the previous subpasses writes visible to these reads.
+		if ( !m_subpass.getInputAttaches().empty() )
+		{
+			if ( gl::TextureBarrier )
+			{
+				glLogCall( gl::TextureBarrier );
+			}
+			else if ( gl::TextureBarrierNV )
+			{
+				glLogCall( gl::TextureBarrierNV );
+			}
+			else
+			{
+				glLogCall( gl::Finish );
+			}
+		}
 	}
 
 	CommandPtr NextSubpassCommand::clone()const
@@ -4,23 +4,19 @@ See LICENSE file in root folder.
 */
 #include "GlPushConstantsCommand.hpp"
 
-#include "Buffer/PushConstantsBuffer.hpp"
+#include "Buffer/GlPushConstantsRing.hpp"
+#include "Core/GlDevice.hpp"
+#include "Shader/GlShaderModule.hpp"
+#include "Shader/GlShaderProgram.hpp"
+
+#include <Buffer/PushConstantsBuffer.hpp>
 
 namespace gl_renderer
 {
-	PushConstantsCommand::PushConstantsCommand( renderer::PipelineLayout const & layout
-		, renderer::PushConstantsBufferBase const & pcb )
-		: m_pcb{ pcb }
-		, m_data{ pcb.getData(), pcb.getData() + pcb.getSize() }
-	{
-	}
-
-	void PushConstantsCommand::apply()const
+	namespace
 	{
-		glLogCommand( "PushConstantsCommand" );
-		auto buffer = m_data.data();
-
-		for ( auto & constant : m_pcb )
+		void doApplyUniform( renderer::PushConstant const & constant
+			, uint8_t const * buffer )
 		{
 			switch ( constant.format )
 			{
@@ -92,8 +88,87 @@ namespace gl_renderer
 				assert( false && "Unsupported constant format" );
 				break;
 			}
+		}
+
+		void doWriteBlock( renderer::PushConstant const & constant
+			, uint8_t const * buffer
+			, renderer::ByteArray & block )
+		{
+			// std140: matrices columns and arrays elements are aligned on a vec4.
+			uint32_t columns = 1u;
+
+			switch ( constant.format )
+			{
+			case renderer::AttributeFormat::eMat2f:
+				columns = 2u;
+				break;
+
+			case renderer::AttributeFormat::eMat3f:
+				columns = 3u;
+				break;
+
+			case renderer::AttributeFormat::eMat4f:
+				columns = 4u;
+				break;
+
+			default:
+				break;
+			}
+
+			auto columnSize = getSize( constant.format ) / columns;
+			auto offset = constant.location * ShaderModule::PushConstantSlotSize;
+			assert( offset + ( constant.arraySize * columns - 1u ) * 16u + columnSize <= block.size() );
+			auto dst = block.data() + offset;
+
+			for ( auto element = 0u; element < constant.arraySize; ++element )
+			{
+				for ( auto column = 0u; column < columns; ++column )
+				{
+					std::memcpy( dst, buffer, columnSize );
+					dst += 16u;
+					buffer += columnSize;
+				}
+			}
+		}
+	}
 
-			buffer += getSize( constant.format );
+	PushConstantsCommand::PushConstantsCommand( Device const & device
+		, ShaderProgram const & program
+		, renderer::PipelineLayout const & layout
+		, renderer::PushConstantsBufferBase const & pcb )
+		: m_device{ device }
+		, m_program{ program }
+		, m_pcb{ pcb }
+		, m_data{ pcb.getData(), pcb.getData() + pcb.getSize() }
+	{
+	}
+
+	void PushConstantsCommand::apply()const
+	{
+		glLogCommand( "PushConstantsCommand" );
+		bool block = false;
+
+		for ( auto & constant : m_pcb )
+		{
+			auto buffer = m_data.data() + constant.offset - m_pcb.getOffset();
+
+			if ( m_program.isInPushConstantsBlock( constant.location ) )
+			{
+				doWriteBlock( constant, buffer, m_program.getPushConstantsBlock() );
+				block = true;
+			}
+
+			// A stage may have kept the constant as a uniform variable, while another one reads it from the block.
+			if ( !m_program.isInPushConstantsBlock( constant.location )
+				|| m_program.isUniformPushConstant( constant.location ) )
+			{
+				doApplyUniform( constant, buffer );
+			}
+		}
+
+		if ( block )
+		{
+			m_device.getPushConstantsRing()->upload( m_program.getPushConstantsBlock() );
 		}
 	}
 
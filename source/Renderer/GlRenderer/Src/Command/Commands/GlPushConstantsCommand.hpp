@@ -16,12 +16,29 @@ namespace gl_renderer
 		: public CommandBase
 	{
 	public:
-		PushConstantsCommand( renderer::PipelineLayout const & layout
+		/**
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] program
+		*	Le programme recevant les push constants, les constantes qu'il lit depuis
+		*	son bloc uniforme sont envoyées via l'anneau du périphérique.
+		*\param[in] layout
+		*	Le layout du pipeline.
+		*\param[in] pcb
+		*	Le tampon de push constants.
+		*/
+		PushConstantsCommand( Device const & device
+			, ShaderProgram const & program
+			, renderer::PipelineLayout const & layout
 			, renderer::PushConstantsBufferBase const & pcb );
 		void apply()const override;
 		CommandPtr clone()const override;
 
 	private:
+		Device const & m_device;
+		ShaderProgram const & m_program;
 		renderer::PushConstantsBufferBase const & m_pcb;
 		renderer::ByteArray m_data;
 	};
@@ -27,6 +27,7 @@ namespace gl_renderer
 				, m_scissor.getOffset()[1]
 				, m_scissor.getSize()[0]
 				, m_scissor.getSize()[1] );
+			m_device.addStateCalls( 1u );
 			save = m_scissor;
 		}
 	}
@@ -4,17 +4,28 @@ See LICENSE file in root folder.
 */
 #include "GlSetLineWidthCommand.hpp"
 
+#include "Core/GlDevice.hpp"
+
 namespace gl_renderer
 {
-	SetLineWidthCommand::SetLineWidthCommand( float width )
-		: m_width{ width }
+	SetLineWidthCommand::SetLineWidthCommand( Device const & device
+		, float width )
+		: m_device{ device }
+		, m_width{ width }
 	{
 	}
 
 	void SetLineWidthCommand::apply()const
 	{
-		glLogCommand( "SetLineWidthCommand" );
-		glLogCall( gl::LineWidth, m_width );
+		auto & save = m_device.getCurrentStateBlock();
+
+		if ( m_width != save.lineWidth )
+		{
+			glLogCommand( "SetLineWidthCommand" );
+			glLogCall( gl::LineWidth, m_width );
+			m_device.addStateCalls( 1u );
+			save.lineWidth = m_width;
+		}
 	}
 
 	CommandPtr SetLineWidthCommand::clone()const
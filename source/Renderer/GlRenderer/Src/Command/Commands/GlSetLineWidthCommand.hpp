@@ -6,13 +6,11 @@ See LICENSE file in root folder
 
 #include "GlCommandBase.hpp"
 
-#include <Pipeline/Scissor.hpp>
-
 namespace gl_renderer
 {
 	/**
 	*\brief
-	*	Commande d'application d'un scissor.
+	*	Commande de définition de la largeur des lignes.
 	*/
 	class SetLineWidthCommand
 		: public CommandBase
@@ -21,15 +19,17 @@ namespace gl_renderer
 		/**
 		*\brief
 		*	Constructeur.
-		*\param[in] scissor
-		*	Le scissor.
+		*\param[in] width
+		*	La largeur des lignes.
 		*/
-		SetLineWidthCommand( float width );
+		SetLineWidthCommand( Device const & device
+			, float width );
 
 		void apply()const override;
 		CommandPtr clone()const override;
 
 	private:
+		Device const & m_device;
 		float m_width;
 	};
 }
@@ -30,6 +30,10 @@ namespace gl_renderer
 			glLogCall( gl::DepthRange
 				, m_viewport.getDepthBounds()[0]
 				, m_viewport.getDepthBounds()[1] );
+			auto & stateBlock = m_device.getCurrentStateBlock();
+			stateBlock.minDepthBounds = m_viewport.getDepthBounds()[0];
+			stateBlock.maxDepthBounds = m_viewport.getDepthBounds()[1];
+			m_device.addStateCalls( 2u );
 			save = m_viewport;
 		}
 	}
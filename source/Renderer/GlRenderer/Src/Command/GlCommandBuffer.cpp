@@ -35,14 +35,18 @@ See LICENSE file in root folder.
 #include "Commands/GlCopyBufferToImageCommand.hpp"
 #include "Commands/GlCopyImageCommand.hpp"
 #include "Commands/GlCopyImageToBufferCommand.hpp"
+#include "Commands/GlCopyQueryPoolResultsCommand.hpp"
 #include "Commands/GlDispatchCommand.hpp"
 #include "Commands/GlDispatchIndirectCommand.hpp"
 #include "Commands/GlDrawCommand.hpp"
 #include "Commands/GlDrawIndexedCommand.hpp"
 #include "Commands/GlDrawIndexedIndirectCommand.hpp"
+#include "Commands/GlDrawIndexedIndirectCountCommand.hpp"
 #include "Commands/GlDrawIndirectCommand.hpp"
+#include "Commands/GlDrawIndirectCountCommand.hpp"
 #include "Commands/GlEndQueryCommand.hpp"
 #include "Commands/GlEndRenderPassCommand.hpp"
+#include "Commands/GlGenerateMipmapsCommand.hpp"
 #include "Commands/GlImageMemoryBarrierCommand.hpp"
 #include "Commands/GlNextSubpassCommand.hpp"
 #include "Commands/GlPushConstantsCommand.hpp"
@@ -70,6 +74,7 @@ namespace gl_renderer
 	bool CommandBuffer::begin( renderer::CommandBufferUsageFlags flags )const
 	{
 		m_commands.clear();
+		doResetStatistics();
 		m_state = State{};
 		m_state.m_beginFlags = flags;
 		return true;
@@ -79,6 +84,7 @@ namespace gl_renderer
 		, renderer::CommandBufferInheritanceInfo const & inheritanceInfo )const
 	{
 		m_commands.clear();
+		doResetStatistics();
 		m_state = State{};
 		m_state.m_beginFlags = flags;
 		return true;
@@ -93,10 +99,11 @@ namespace gl_renderer
 	bool CommandBuffer::reset( renderer::CommandBufferResetFlags flags )const
 	{
 		m_commands.clear();
+		doResetStatistics();
 		return true;
 	}
 
-	void CommandBuffer::beginRenderPass( renderer::RenderPass const & renderPass
+	void CommandBuffer::doBeginRenderPass( renderer::RenderPass const & renderPass
 		, renderer::FrameBuffer const & frameBuffer
 		, renderer::ClearValueArray const & clearValues
 		, renderer::SubpassContents contents )const
@@ -127,6 +134,8 @@ namespace gl_renderer
 
 	void CommandBuffer::executeCommands( renderer::CommandBufferCRefArray const & commands )const
 	{
+		doCountStatistics( commands );
+
 		for ( auto & commandBuffer : commands )
 		{
 			static_cast< CommandBuffer const & >( commandBuffer.get() ).initialiseGeometryBuffers();
@@ -159,6 +168,8 @@ namespace gl_renderer
 	void CommandBuffer::bindPipeline( renderer::Pipeline const & pipeline
 		, renderer::PipelineBindPoint bindingPoint )const
 	{
+		doCountStatistic( renderer::Statistic::ePipelineBind );
+
 		if ( m_state.m_currentPipeline )
 		{
 			auto src = m_state.m_currentPipeline->getVertexInputStateHash();
@@ -177,13 +188,17 @@ namespace gl_renderer
 
 		for ( auto & pcb : m_state.m_pushConstantBuffers )
 		{
-			m_commands.emplace_back( std::make_unique< PushConstantsCommand >( *pcb.first
+			m_commands.emplace_back( std::make_unique< PushConstantsCommand >( m_device
+				, m_state.m_currentPipeline->getShaderProgram()
+				, *pcb.first
 				, *pcb.second ) );
 		}
 
 		for ( auto & pcb : m_state.m_currentPipeline->getConstantsPcbs() )
 		{
-			m_commands.emplace_back( std::make_unique< PushConstantsCommand >( m_state.m_currentPipeline->getLayout()
+			m_commands.emplace_back( std::make_unique< PushConstantsCommand >( m_device
+				, m_state.m_currentPipeline->getShaderProgram()
+				, m_state.m_currentPipeline->getLayout()
 				, pcb ) );
 		}
 
@@ -193,18 +208,23 @@ namespace gl_renderer
 	void CommandBuffer::bindPipeline( renderer::ComputePipeline const & pipeline
 		, renderer::PipelineBindPoint bindingPoint )const
 	{
+		doCountStatistic( renderer::Statistic::ePipelineBind );
 		m_state.m_currentComputePipeline = &static_cast< ComputePipeline const & >( pipeline );
 		m_commands.emplace_back( std::make_unique< BindComputePipelineCommand >( m_device, pipeline, bindingPoint ) );
 
 		for ( auto & pcb : m_state.m_pushConstantBuffers )
 		{
-			m_commands.emplace_back( std::make_unique< PushConstantsCommand >( *pcb.first
+			m_commands.emplace_back( std::make_unique< PushConstantsCommand >( m_device
+				, m_state.m_currentComputePipeline->getShaderProgram()
+				, *pcb.first
 				, *pcb.second ) );
 		}
 
 		for ( auto & pcb : m_state.m_currentComputePipeline->getConstantsPcbs() )
 		{
-			m_commands.emplace_back( std::make_unique< PushConstantsCommand >( m_state.m_currentComputePipeline->getLayout()
+			m_commands.emplace_back( std::make_unique< PushConstantsCommand >( m_device
+				, m_state.m_currentComputePipeline->getShaderProgram()
+				, m_state.m_currentComputePipeline->getLayout()
 				, pcb ) );
 		}
 
@@ -238,7 +258,7 @@ namespace gl_renderer
 		m_state.m_boundVao = nullptr;
 	}
 
-	void CommandBuffer::memoryBarrier( renderer::PipelineStageFlags after
+	void CommandBuffer::doMemoryBarrier( renderer::PipelineStageFlags after
 		, renderer::PipelineStageFlags before
 		, renderer::BufferMemoryBarrier const & transitionBarrier )const
 	{
@@ -247,7 +267,7 @@ namespace gl_renderer
 			, transitionBarrier ) );
 	}
 
-	void CommandBuffer::memoryBarrier( renderer::PipelineStageFlags after
+	void CommandBuffer::doMemoryBarrier( renderer::PipelineStageFlags after
 		, renderer::PipelineStageFlags before
 		, renderer::ImageMemoryBarrier const & transitionBarrier )const
 	{
@@ -261,6 +281,8 @@ namespace gl_renderer
 		, renderer::UInt32Array const & dynamicOffsets
 		, renderer::PipelineBindPoint bindingPoint )const
 	{
+		doCountStatistic( renderer::Statistic::eDescriptorSetBind, descriptorSets.size() );
+
 		for ( auto & descriptorSet : descriptorSets )
 		{
 			m_commands.emplace_back( std::make_unique< BindDescriptorSetCommand >( descriptorSet.get()
@@ -285,6 +307,8 @@ namespace gl_renderer
 		, uint32_t firstVertex
 		, uint32_t firstInstance )const
 	{
+		doCountStatistic( renderer::Statistic::eDrawCall );
+
 		if ( !m_state.m_currentPipeline->hasVertexLayout() )
 		{
 			bindIndexBuffer( m_device.getEmptyIndexedVaoIdx(), 0u, renderer::IndexType::eUInt32 );
@@ -319,6 +343,8 @@ namespace gl_renderer
 		, uint32_t vertexOffset
 		, uint32_t firstInstance )const
 	{
+		doCountStatistic( renderer::Statistic::eDrawCall );
+
 		if ( !m_state.m_currentPipeline->hasVertexLayout() )
 		{
 			bindIndexBuffer( m_device.getEmptyIndexedVaoIdx(), 0u, renderer::IndexType::eUInt32 );
@@ -344,6 +370,8 @@ namespace gl_renderer
 		, uint32_t drawCount
 		, uint32_t stride )const
 	{
+		doCountStatistic( renderer::Statistic::eDrawCall );
+
 		if ( !m_state.m_boundVao )
 		{
 			doBindVao();
@@ -361,6 +389,8 @@ namespace gl_renderer
 		, uint32_t drawCount
 		, uint32_t stride )const
 	{
+		doCountStatistic( renderer::Statistic::eDrawCall );
+
 		if ( !m_state.m_currentPipeline->hasVertexLayout() )
 		{
 			bindIndexBuffer( m_device.getEmptyIndexedVaoIdx(), 0u, renderer::IndexType::eUInt32 );
@@ -380,11 +410,67 @@ namespace gl_renderer
 			, m_state.m_indexType ) );
 	}
 
-	void CommandBuffer::copyToImage( renderer::BufferImageCopyArray const & copyInfo
+	void CommandBuffer::drawIndirectCount( renderer::BufferBase const & buffer
+		, uint32_t offset
+		, renderer::BufferBase const & countBuffer
+		, uint32_t countBufferOffset
+		, uint32_t maxDrawCount
+		, uint32_t stride )const
+	{
+		doCountStatistic( renderer::Statistic::eDrawCall );
+
+		if ( !m_state.m_boundVao )
+		{
+			doBindVao();
+		}
+
+		m_commands.emplace_back( std::make_unique< DrawIndirectCountCommand >( buffer
+			, offset
+			, countBuffer
+			, countBufferOffset
+			, maxDrawCount
+			, stride
+			, m_state.m_currentPipeline->getInputAssemblyState().getTopology()
+			, m_device.getPhysicalDevice().isDrawIndirectCountSupported() ) );
+	}
+
+	void CommandBuffer::drawIndexedIndirectCount( renderer::BufferBase const & buffer
+		, uint32_t offset
+		, renderer::BufferBase const & countBuffer
+		, uint32_t countBufferOffset
+		, uint32_t maxDrawCount
+		, uint32_t stride )const
+	{
+		doCountStatistic( renderer::Statistic::eDrawCall );
+
+		if ( !m_state.m_currentPipeline->hasVertexLayout() )
+		{
+			bindIndexBuffer( m_device.getEmptyIndexedVaoIdx(), 0u, renderer::IndexType::eUInt32 );
+			m_state.m_boundVao = &m_device.getEmptyIndexedVao();
+			m_commands.emplace_back( std::make_unique< BindGeometryBuffersCommand >( *m_state.m_boundVao ) );
+		}
+		else if ( !m_state.m_boundVao )
+		{
+			doBindVao();
+		}
+
+		m_commands.emplace_back( std::make_unique< DrawIndexedIndirectCountCommand >( buffer
+			, offset
+			, countBuffer
+			, countBufferOffset
+			, maxDrawCount
+			, stride
+			, m_state.m_currentPipeline->getInputAssemblyState().getTopology()
+			, m_state.m_indexType
+			, m_device.getPhysicalDevice().isDrawIndirectCountSupported() ) );
+	}
+
+	void CommandBuffer::doCopyToImage( renderer::BufferImageCopyArray const & copyInfo
 		, renderer::BufferBase const & src
 		, renderer::Texture const & dst )const
 	{
-		m_commands.emplace_back( std::make_unique< CopyBufferToImageCommand >( copyInfo
+		m_commands.emplace_back( std::make_unique< CopyBufferToImageCommand >( m_device
+			, copyInfo
 			, src
 			, dst ) );
 	}
@@ -393,7 +479,8 @@ namespace gl_renderer
 		, renderer::Texture const & src
 		, renderer::BufferBase const & dst )const
 	{
-		m_commands.emplace_back( std::make_unique< CopyImageToBufferCommand >( copyInfo
+		m_commands.emplace_back( std::make_unique< CopyImageToBufferCommand >( m_device
+			, copyInfo
 			, src
 			, dst ) );
 	}
@@ -402,12 +489,13 @@ namespace gl_renderer
 		, renderer::BufferBase const & src
 		, renderer::BufferBase const & dst )const
 	{
-		m_commands.emplace_back( std::make_unique< CopyBufferCommand >( copyInfo
+		m_commands.emplace_back( std::make_unique< CopyBufferCommand >( m_device
+			, copyInfo
 			, src
 			, dst ) );
 	}
 
-	void CommandBuffer::copyImage( renderer::ImageCopy const & copyInfo
+	void CommandBuffer::doCopyImage( renderer::ImageCopy const & copyInfo
 		, renderer::TextureView const & src
 		, renderer::TextureView const & dst )const
 	{
@@ -416,7 +504,7 @@ namespace gl_renderer
 			, dst ) );
 	}
 
-	void CommandBuffer::blitImage( renderer::Texture const & srcImage
+	void CommandBuffer::doBlitImage( renderer::Texture const & srcImage
 		, renderer::ImageLayout srcLayout
 		, renderer::Texture const & dstImage
 		, renderer::ImageLayout dstLayout
@@ -430,6 +518,16 @@ namespace gl_renderer
 			, filter ) );
 	}
 
+	void CommandBuffer::doGenerateMipmaps( renderer::Texture const & texture
+		, uint32_t baseMipLevel
+		, renderer::ResourceState const & finalState )const
+	{
+		// OpenGL has no layouts, only the generation itself is deferred to the submission.
+		m_commands.emplace_back( std::make_unique< GenerateMipmapsCommand >( m_device
+			, texture
+			, baseMipLevel ) );
+	}
+
 	void CommandBuffer::resetQueryPool( renderer::QueryPool const & pool
 		, uint32_t firstQuery
 		, uint32_t queryCount )const
@@ -464,12 +562,36 @@ namespace gl_renderer
 			, query ) );
 	}
 
+	void CommandBuffer::copyQueryPoolResults( renderer::QueryPool const & pool
+		, uint32_t firstQuery
+		, uint32_t queryCount
+		, renderer::BufferBase const & dstBuffer
+		, uint32_t dstOffset
+		, uint32_t stride
+		, renderer::QueryResultFlags flags )const
+	{
+		m_commands.emplace_back( std::make_unique< CopyQueryPoolResultsCommand >( m_device
+			, pool
+			, firstQuery
+			, queryCount
+			, dstBuffer
+			, dstOffset
+			, stride
+			, flags ) );
+	}
+
 	void CommandBuffer::pushConstants( renderer::PipelineLayout const & layout
 		, renderer::PushConstantsBufferBase const & pcb )const
 	{
 		if ( m_state.m_currentPipeline || m_state.m_currentComputePipeline )
 		{
-			m_commands.emplace_back( std::make_unique< PushConstantsCommand >( layout
+			auto & program = ( !m_state.m_currentPipeline
+					|| ( m_state.m_currentComputePipeline && checkFlag( pcb.getStageFlags(), renderer::ShaderStageFlag::eCompute ) ) )
+				? m_state.m_currentComputePipeline->getShaderProgram()
+				: m_state.m_currentPipeline->getShaderProgram();
+			m_commands.emplace_back( std::make_unique< PushConstantsCommand >( m_device
+				, program
+				, layout
 				, pcb ) );
 		}
 		else
@@ -482,6 +604,7 @@ namespace gl_renderer
 		, uint32_t groupCountY
 		, uint32_t groupCountZ )const
 	{
+		doCountStatistic( renderer::Statistic::eDispatch );
 		m_commands.emplace_back( std::make_unique< DispatchCommand >( groupCountX
 			, groupCountY 
 			, groupCountZ ) );
@@ -490,13 +613,14 @@ namespace gl_renderer
 	void CommandBuffer::dispatchIndirect( renderer::BufferBase const & buffer
 		, uint32_t offset )const
 	{
+		doCountStatistic( renderer::Statistic::eDispatch );
 		m_commands.emplace_back( std::make_unique< DispatchIndirectCommand >( buffer
 			, offset ) );
 	}
 
 	void CommandBuffer::setLineWidth( float width )const
 	{
-		m_commands.emplace_back( std::make_unique< SetLineWidthCommand >( width ) );
+		m_commands.emplace_back( std::make_unique< SetLineWidthCommand >( m_device, width ) );
 	}
 
 	void CommandBuffer::initialiseGeometryBuffers()const
@@ -49,13 +49,6 @@ namespace gl_renderer
 		*/
 		bool reset( renderer::CommandBufferResetFlags flags )const override;
 		/**
-		*\copydoc	renderer::CommandBuffer::beginRenderPass
-		*/
-		void beginRenderPass( renderer::RenderPass const & renderPass
-			, renderer::FrameBuffer const & frameBuffer
-			, renderer::ClearValueArray const & clearValues
-			, renderer::SubpassContents contents )const override;
-		/**
 		*\copydoc	renderer::CommandBuffer::nextSubpass
 		*/
 		void nextSubpass( renderer::SubpassContents contents )const override;
@@ -83,18 +76,6 @@ namespace gl_renderer
 		void clearAttachments( renderer::ClearAttachmentArray const & clearAttachments
 			, renderer::ClearRectArray const & clearRects )override;
 		/**
-		*\copydoc	renderer::CommandBuffer::memoryBarrier
-		*/
-		void memoryBarrier( renderer::PipelineStageFlags after
-			, renderer::PipelineStageFlags before
-			, renderer::BufferMemoryBarrier const & transitionBarrier )const override;
-		/**
-		*\copydoc	renderer::CommandBuffer::memoryBarrier
-		*/
-		void memoryBarrier( renderer::PipelineStageFlags after
-			, renderer::PipelineStageFlags before
-			, renderer::ImageMemoryBarrier const & transitionBarrier )const override;
-		/**
 		*\copydoc	renderer::CommandBuffer::bindPipeline
 		*/
 		void bindPipeline( renderer::Pipeline const & pipeline
@@ -161,11 +142,23 @@ namespace gl_renderer
 			, uint32_t drawCount
 			, uint32_t stride )const override;
 		/**
-		*\copydoc	renderer::CommandBuffer::copyToImage
+		*\copydoc	renderer::CommandBuffer::drawIndirectCount
 		*/
-		void copyToImage( renderer::BufferImageCopyArray const & copyInfo
-			, renderer::BufferBase const & src
-			, renderer::Texture const & dst )const override;
+		void drawIndirectCount( renderer::BufferBase const & buffer
+			, uint32_t offset
+			, renderer::BufferBase const & countBuffer
+			, uint32_t countBufferOffset
+			, uint32_t maxDrawCount
+			, uint32_t stride )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::drawIndexedIndirectCount
+		*/
+		void drawIndexedIndirectCount( renderer::BufferBase const & buffer
+			, uint32_t offset
+			, renderer::BufferBase const & countBuffer
+			, uint32_t countBufferOffset
+			, uint32_t maxDrawCount
+			, uint32_t stride )const override;
 		/**
 		*\copydoc	renderer::CommandBuffer::copyToBuffer
 		*/
@@ -179,21 +172,6 @@ namespace gl_renderer
 			, renderer::BufferBase const & src
 			, renderer::BufferBase const & dst )const override;
 		/**
-		*\copydoc	renderer::CommandBuffer::copyImage
-		*/
-		void copyImage( renderer::ImageCopy const & copyInfo
-			, renderer::TextureView const & src
-			, renderer::TextureView const & dst )const override;
-		/**
-		*\copydoc	renderer::CommandBuffer::blitImage
-		*/
-		void blitImage( renderer::Texture const & srcImage
-			, renderer::ImageLayout srcLayout
-			, renderer::Texture const & dstImage
-			, renderer::ImageLayout dstLayout
-			, std::vector< renderer::ImageBlit > const & regions
-			, renderer::Filter filter )const override;
-		/**
 		*\copydoc	renderer::CommandBuffer::resetQueryPool
 		*/
 		void resetQueryPool( renderer::QueryPool const & pool
@@ -217,6 +195,16 @@ namespace gl_renderer
 			, renderer::QueryPool const & pool
 			, uint32_t query )const override;
 		/**
+		*\copydoc	renderer::CommandBuffer::copyQueryPoolResults
+		*/
+		void copyQueryPoolResults( renderer::QueryPool const & pool
+			, uint32_t firstQuery
+			, uint32_t queryCount
+			, renderer::BufferBase const & dstBuffer
+			, uint32_t dstOffset
+			, uint32_t stride
+			, renderer::QueryResultFlags flags )const override;
+		/**
 		*\copydoc	renderer::CommandBuffer::pushConstants
 		*/
 		void pushConstants( renderer::PipelineLayout const & layout
@@ -248,6 +236,52 @@ namespace gl_renderer
 		void initialiseGeometryBuffers()const;
 
 	private:
+		/**
+		*\copydoc	renderer::CommandBuffer::doBeginRenderPass
+		*/
+		void doBeginRenderPass( renderer::RenderPass const & renderPass
+			, renderer::FrameBuffer const & frameBuffer
+			, renderer::ClearValueArray const & clearValues
+			, renderer::SubpassContents contents )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::doMemoryBarrier
+		*/
+		void doMemoryBarrier( renderer::PipelineStageFlags after
+			, renderer::PipelineStageFlags before
+			, renderer::BufferMemoryBarrier const & transitionBarrier )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::doMemoryBarrier
+		*/
+		void doMemoryBarrier( renderer::PipelineStageFlags after
+			, renderer::PipelineStageFlags before
+			, renderer::ImageMemoryBarrier const & transitionBarrier )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::doCopyToImage
+		*/
+		void doCopyToImage( renderer::BufferImageCopyArray const & copyInfo
+			, renderer::BufferBase const & src
+			, renderer::Texture const & dst )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::doCopyImage
+		*/
+		void doCopyImage( renderer::ImageCopy const & copyInfo
+			, renderer::TextureView const & src
+			, renderer::TextureView const & dst )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::doBlitImage
+		*/
+		void doBlitImage( renderer::Texture const & srcImage
+			, renderer::ImageLayout srcLayout
+			, renderer::Texture const & dstImage
+			, renderer::ImageLayout dstLayout
+			, std::vector< renderer::ImageBlit > const & regions
+			, renderer::Filter filter )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::doGenerateMipmaps
+		*/
+		void doGenerateMipmaps( renderer::Texture const & texture
+			, uint32_t baseMipLevel
+			, renderer::ResourceState const & finalState )const override;
 		void doBindVao()const;
 
 	private:
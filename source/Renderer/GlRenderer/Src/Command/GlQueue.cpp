@@ -25,6 +25,7 @@ namespace gl_renderer
 	{
 		for ( auto & commandBuffer : commandBuffers )
 		{
+			renderer::countStatistics( commandBuffer.get().getRecordedStatistics() );
 			static_cast< CommandBuffer const & >( commandBuffer.get() ).initialiseGeometryBuffers();
 
 			for ( auto & command : static_cast< CommandBuffer const & >( commandBuffer.get() ).getCommands() )
@@ -33,6 +34,8 @@ namespace gl_renderer
 			}
 		}
 
+		renderer::countStatistic( renderer::Statistic::eSubmittedCommandBuffer, commandBuffers.size() );
+
 		return true;
 		//return fence
 		//	? fence->wait( ~( 0u ) ) == renderer::WaitResult::eSuccess
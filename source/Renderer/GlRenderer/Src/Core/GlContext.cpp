@@ -6,6 +6,8 @@
 #	include "GlX11Context.hpp"
 #endif
 
+#include "GlEglContext.hpp"
+
 namespace gl_renderer
 {
 	Context::Context( PhysicalDevice const & gpu
@@ -18,6 +20,15 @@ namespace gl_renderer
 	ContextPtr Context::create( PhysicalDevice const & gpu
 		, renderer::ConnectionPtr && connection )
 	{
+		if ( connection->isHeadless() )
+		{
+#if GLRENDERER_EGL
+			return std::make_unique< EglContext >( gpu, std::move( connection ) );
+#else
+			throw std::runtime_error{ "Headless rendering needs EGL support." };
+#endif
+		}
+
 #if defined( _WIN32 )
 		return std::make_unique< MswContext >( gpu, std::move( connection ) );
 #elif defined( __linux__ )
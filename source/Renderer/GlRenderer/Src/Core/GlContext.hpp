@@ -34,8 +34,18 @@ namespace gl_renderer
 		*/
 		virtual void swapBuffers()const = 0;
 		/**
+		*\return
+		*	\p true si le contexte n'est lié à aucune fenêtre, le rendu se faisant alors hors écran.
+		*/
+		inline bool isHeadless()const
+		{
+			return m_connection->isHeadless();
+		}
+		/**
 		*\brief
 		*	Crée un contexte.
+		*\remarks
+		*	Pour une connexion sans fenêtre, c'est un contexte EGL headless.
 		*/
 		static ContextPtr create( PhysicalDevice const & gpu
 			, renderer::ConnectionPtr && connection );
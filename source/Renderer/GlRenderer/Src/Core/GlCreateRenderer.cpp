@@ -1,5 +1,6 @@
 #include "Core/GlCreateRenderer.hpp"
 #include "Core/GlRenderer.hpp"
+#include "Miscellaneous/GlCallTracer.hpp"
 
 extern "C"
 {
@@ -7,4 +8,19 @@ extern "C"
 	{
 		return new gl_renderer::Renderer{ configuration };
 	}
+
+	GlRenderer_API void enableCallTrace( uint32_t capacity )
+	{
+		gl_renderer::CallTracer::enable( capacity );
+	}
+
+	GlRenderer_API void disableCallTrace()
+	{
+		gl_renderer::CallTracer::disable();
+	}
+
+	GlRenderer_API bool dumpCallTrace( char const * path )
+	{
+		return gl_renderer::CallTracer::dump( path );
+	}
 }
@@ -33,4 +33,43 @@ extern "C"
 	*	The creation options.
 	*/
 	GlRenderer_API renderer::Renderer * createRenderer( renderer::Renderer::Configuration const & configuration );
+	/**
+	*\~french
+	*\brief
+	*	Active la trace binaire des appels OpenGL.
+	*\param[in] capacity
+	*	Le nombre d'appels conservés, les plus anciens étant écrasés.
+	*\~english
+	*\brief
+	*	Enables the OpenGL calls binary trace.
+	*\param[in] capacity
+	*	The number of kept calls, the oldest ones being overwritten.
+	*/
+	GlRenderer_API void enableCallTrace( uint32_t capacity );
+	/**
+	*\~french
+	*\brief
+	*	Désactive la trace binaire des appels OpenGL.
+	*\~english
+	*\brief
+	*	Disables the OpenGL calls binary trace.
+	*/
+	GlRenderer_API void disableCallTrace();
+	/**
+	*\~french
+	*\brief
+	*	Ecrit la trace binaire des appels OpenGL dans un fichier, lisible par GlTraceTool.
+	*\param[in] path
+	*	Le chemin du fichier.
+	*\return
+	*	\p false si le fichier n'a pas pu être écrit.
+	*\~english
+	*\brief
+	*	Writes the OpenGL calls binary trace to a file, readable by GlTraceTool.
+	*\param[in] path
+	*	The file path.
+	*\return
+	*	\p false if the file could not be written.
+	*/
+	GlRenderer_API bool dumpCallTrace( char const * path );
 }
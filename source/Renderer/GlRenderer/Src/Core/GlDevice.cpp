@@ -7,6 +7,7 @@ See LICENSE file in root folder.
 #include "Buffer/GlBuffer.hpp"
 #include "Buffer/GlBufferView.hpp"
 #include "Buffer/GlGeometryBuffers.hpp"
+#include "Buffer/GlPushConstantsRing.hpp"
 #include "Buffer/GlUniformBuffer.hpp"
 #include "Command/GlCommandPool.hpp"
 #include "Command/GlQueue.hpp"
@@ -14,11 +15,13 @@ See LICENSE file in root folder.
 #include "Core/GlContext.hpp"
 #include "Core/GlDummyIndexBuffer.hpp"
 #include "Core/GlRenderer.hpp"
+#include "Core/GlOffscreenSwapChain.hpp"
 #include "Core/GlSwapChain.hpp"
 #include "Descriptor/GlDescriptorSetLayout.hpp"
 #include "Image/GlSampler.hpp"
 #include "Image/GlTexture.hpp"
 #include "Image/GlTextureView.hpp"
+#include "Miscellaneous/GlCallTracer.hpp"
 #include "Miscellaneous/GlQueryPool.hpp"
 #include "Pipeline/GlPipelineLayout.hpp"
 #include "RenderPass/GlRenderPass.hpp"
@@ -31,267 +34,28 @@ See LICENSE file in root folder.
 
 namespace gl_renderer
 {
-	namespace
-	{
-		void doApply( renderer::ColourBlendState const & state )
-		{
-			if ( state.isLogicOpEnabled() )
-			{
-				glLogCall( gl::LogicOp, convert( state.getLogicOp() ) );
-			}
-
-			auto & blendConstants = state.getBlendConstants();
-			glLogCall( gl::BlendColor
-				, blendConstants[0]
-				, blendConstants[1]
-				, blendConstants[2]
-				, blendConstants[3] );
-
-			bool blend = false;
-			GLuint buf = 0u;
-
-			for ( auto & blendState : state )
-			{
-				if ( blendState.isBlendEnabled() )
-				{
-					blend = true;
-					glLogCall( gl::BlendEquationSeparatei
-						, buf
-						, convert( blendState.getColourBlendOp() )
-						, convert( blendState.getAlphaBlendOp() ) );
-					glLogCall( gl::BlendFuncSeparatei
-						, buf
-						, convert( blendState.getSrcColourBlendFactor() )
-						, convert( blendState.getDstColourBlendFactor() )
-						, convert( blendState.getSrcAlphaBlendFactor() )
-						, convert( blendState.getDstAlphaBlendFactor() ) );
-				}
-
-				++buf;
-			}
-
-			if ( blend )
-			{
-				glLogCall( gl::Enable, GL_BLEND );
-			}
-			else
-			{
-				glLogCall( gl::Disable, GL_BLEND );
-			}
-		}
-
-		void doApply( renderer::RasterisationState const & state )
-		{
-			if ( state.getCullMode() != renderer::CullModeFlag::eNone )
-			{
-				glLogCall( gl::Enable, GL_CULL_FACE );
-				glLogCall( gl::CullFace, convert( state.getCullMode() ) );
-				glLogCall( gl::FrontFace, convert( state.getFrontFace() ) );
-			}
-			else
-			{
-				glLogCall( gl::Disable, GL_CULL_FACE );
-			}
-
-			glLogCall( gl::PolygonMode
-				, GL_CULL_MODE_FRONT_AND_BACK
-				, convert( state.getPolygonMode() ) );
-
-			if ( state.isDepthBiasEnabled() )
-			{
-				switch ( state.getPolygonMode() )
-				{
-				case renderer::PolygonMode::eFill:
-					glLogCall( gl::Enable, GL_POLYGON_OFFSET_FILL );
-					break;
-
-				case renderer::PolygonMode::eLine:
-					glLogCall( gl::Enable, GL_POLYGON_OFFSET_LINE );
-					break;
-
-				case renderer::PolygonMode::ePoint:
-					glLogCall( gl::Enable, GL_POLYGON_OFFSET_POINT );
-					break;
-				}
-
-				glLogCall( gl::PolygonOffsetClampEXT, state.getDepthBiasConstantFactor()
-					, state.getDepthBiasSlopeFactor()
-					, state.getDepthBiasClamp() );
-			}
-			else
-			{
-				switch ( state.getPolygonMode() )
-				{
-				case renderer::PolygonMode::eFill:
-					glLogCall( gl::Disable, GL_POLYGON_OFFSET_FILL );
-					break;
-
-				case renderer::PolygonMode::eLine:
-					glLogCall( gl::Disable, GL_POLYGON_OFFSET_LINE );
-					break;
-
-				case renderer::PolygonMode::ePoint:
-					glLogCall( gl::Disable, GL_POLYGON_OFFSET_POINT );
-					break;
-				}
-			}
-
-			if ( state.isDepthClampEnabled() )
-			{
-				glLogCall( gl::Enable, GL_DEPTH_CLAMP );
-			}
-			else
-			{
-				glLogCall( gl::Disable, GL_DEPTH_CLAMP );
-			}
-
-			if ( state.isRasteriserDiscardEnabled() )
-			{
-				glLogCall( gl::Enable, GL_RASTERIZER_DISCARD );
-			}
-			else
-			{
-				glLogCall( gl::Disable, GL_RASTERIZER_DISCARD );
-			}
-
-			glLogCall( gl::LineWidth, state.getLineWidth() );
-		}
-
-		void doApply( renderer::MultisampleState const & state )
-		{
-			if ( state.getRasterisationSamples() != renderer::SampleCountFlag::e1 )
-			{
-				glLogCall( gl::Enable, GL_MULTISAMPLE );
-
-				if ( state.isAlphaToCoverageEnabled() )
-				{
-					glLogCall( gl::Enable, GL_SAMPLE_ALPHA_TO_COVERAGE );
-				}
-				else
-				{
-					glLogCall( gl::Disable, GL_SAMPLE_ALPHA_TO_COVERAGE );
-				}
-
-				if ( state.isAlphaToOneEnabled() )
-				{
-					glLogCall( gl::Enable, GL_SAMPLE_ALPHA_TO_ONE );
-				}
-				else
-				{
-					glLogCall( gl::Disable, GL_SAMPLE_ALPHA_TO_ONE );
-				}
-			}
-			else
-			{
-				glLogCall( gl::Disable, GL_MULTISAMPLE );
-			}
-		}
-
-		void doApply( renderer::DepthStencilState const & state )
-		{
-			if ( state.isDepthWriteEnabled() )
-			{
-				glLogCall( gl::DepthMask, GL_TRUE );
-			}
-			else
-			{
-				glLogCall( gl::DepthMask, GL_FALSE );
-			}
-
-			if ( state.isDepthTestEnabled() )
-			{
-				glLogCall( gl::Enable, GL_DEPTH_TEST );
-				glLogCall( gl::DepthFunc, convert( state.getDepthCompareOp() ) );
-			}
-			else
-			{
-				glLogCall( gl::Disable, GL_DEPTH_TEST );
-			}
-
-			if ( state.isStencilTestEnabled() )
-			{
-				glLogCall( gl::Enable, GL_STENCIL_TEST );
-
-				glLogCall( gl::StencilMaskSeparate
-					, GL_CULL_MODE_BACK
-					, state.getBackStencilOp().getWriteMask() );
-				glLogCall( gl::StencilFuncSeparate
-					, GL_CULL_MODE_BACK
-					, convert( state.getBackStencilOp().getCompareOp() )
-					, state.getBackStencilOp().getReference()
-					, state.getBackStencilOp().getCompareMask() );
-				glLogCall( gl::StencilOpSeparate
-					, GL_CULL_MODE_BACK
-					, convert( state.getBackStencilOp().getFailOp() )
-					, convert( state.getBackStencilOp().getDepthFailOp() )
-					, convert( state.getBackStencilOp().getPassOp() ) );
-				glLogCall( gl::StencilMaskSeparate
-					, GL_CULL_MODE_FRONT
-					, state.getFrontStencilOp().getWriteMask() );
-				glLogCall( gl::StencilFuncSeparate
-					, GL_CULL_MODE_FRONT
-					, convert( state.getFrontStencilOp().getCompareOp() )
-					, state.getFrontStencilOp().getReference()
-					, state.getFrontStencilOp().getCompareMask() );
-				glLogCall( gl::StencilOpSeparate
-					, GL_CULL_MODE_FRONT
-					, convert( state.getFrontStencilOp().getFailOp() )
-					, convert( state.getFrontStencilOp().getDepthFailOp() )
-					, convert( state.getFrontStencilOp().getPassOp() ) );
-			}
-			else
-			{
-				glLogCall( gl::Disable, GL_STENCIL_TEST );
-			}
-
-			if ( state.isDepthBoundsTestEnabled() )
-			{
-				glLogCall( gl::Enable, GL_DEPTH_CLAMP );
-				glLogCall( gl::DepthRange, state.getMinDepthBounds(), state.getMaxDepthBounds() );
-			}
-			else
-			{
-				glLogCall( gl::Disable, GL_DEPTH_CLAMP );
-			}
-		}
-
-		void doApply( renderer::TessellationState const & state )
-		{
-			if ( state.getControlPoints() )
-			{
-				glLogCall( gl::PatchParameteri, GL_PATCH_VERTICES, int( state.getControlPoints() ) );
-			}
-		}
-
-		void doApply( renderer::InputAssemblyState const & state )
-		{
-			if ( state.getTopology() == renderer::PrimitiveTopology::ePointList )
-			{
-				glLogCall( gl::Enable, GL_PROGRAM_POINT_SIZE );
-			}
-			else
-			{
-				glLogCall( gl::Disable, GL_PROGRAM_POINT_SIZE );
-			}
-
-			if ( state.isPrimitiveRestartEnabled() )
-			{
-				glLogCall( gl::Enable, GL_PRIMITIVE_RESTART );
-			}
-			else
-			{
-				glLogCall( gl::Disable, GL_PRIMITIVE_RESTART );
-			}
-		}
-	}
-
 	Device::Device( renderer::Renderer const & renderer
 		, PhysicalDevice const & gpu
 		, renderer::ConnectionPtr && connection )
 		: renderer::Device{ renderer, gpu, *connection }
 		, m_context{ Context::create( gpu, std::move( connection ) ) }
-		, m_rsState{ 1.0f }
+		, m_directStateAccess{ gpu.isDirectStateAccessSupported() }
+		, m_queryBuffer{ gpu.isQueryBufferSupported() }
+		, m_stateBlock{ renderer::InputAssemblyState{}
+			, renderer::ColourBlendState{}
+			, renderer::RasterisationState{ 1.0f }
+			, renderer::DepthStencilState{}
+			, renderer::MultisampleState{}
+			, renderer::TessellationState{} }
 	{
+		if ( auto capacity = std::getenv( "GLRENDERER_TRACE" ) )
+		{
+			auto records = uint32_t( std::strtoul( capacity, nullptr, 10 ) );
+			CallTracer::enable( records > 1u
+				? records
+				: CallTracer::DefaultCapacity );
+		}
+
 		enable();
 		glLogCall( gl::ClipControl, GL_UPPER_LEFT, GL_ZERO_TO_ONE );
 		initialiseDebugFunctions();
@@ -306,12 +70,8 @@ namespace gl_renderer
 		m_graphicsCommandPool = std::make_unique< CommandPool >( *this, 0u );
 
 		enable();
-		doApply( m_cbState );
-		doApply( m_dsState );
-		doApply( m_msState );
-		doApply( m_rsState );
-		doApply( m_tsState );
-		doApply( m_iaState );
+		auto defaultState = m_stateBlock;
+		apply( defaultState, m_stateBlock, true );
 		m_dummyIndexed.indexBuffer = renderer::makeBuffer< uint32_t >( *this
 			, sizeof( dummyIndex ) / sizeof( dummyIndex[0] )
 			, renderer::BufferTarget::eIndexBuffer
@@ -333,6 +93,13 @@ namespace gl_renderer
 		m_dummyIndexed.geometryBuffers->initialise();
 
 		gl::GenFramebuffers( 2, m_blitFbos );
+
+		// The blocks rely on explicit offsets, hence GLSL 4.40.
+		if ( getGlslVersion() >= 440u )
+		{
+			m_pushConstantsRing = std::make_unique< PushConstantsRing >( *this );
+		}
+
 		disable();
 	}
 
@@ -340,9 +107,15 @@ namespace gl_renderer
 	{
 		enable();
 		gl::DeleteFramebuffers( 2, m_blitFbos );
+		m_pushConstantsRing.reset();
 		m_dummyIndexed.geometryBuffers.reset();
 		m_dummyIndexed.indexBuffer.reset();
 		disable();
+
+		if ( auto file = std::getenv( "GLRENDERER_TRACE_FILE" ) )
+		{
+			CallTracer::dump( file );
+		}
 	}
 
 	renderer::RenderPassPtr Device::createRenderPass( renderer::RenderPassAttachmentArray const & attaches
@@ -461,7 +234,14 @@ namespace gl_renderer
 
 		try
 		{
-			result = std::make_unique< SwapChain >( *this, size );
+			if ( m_context->isHeadless() )
+			{
+				result = std::make_unique< OffscreenSwapChain >( *this, size );
+			}
+			else
+			{
+				result = std::make_unique< SwapChain >( *this, size );
+			}
 		}
 		catch ( std::exception & exc )
 		{
@@ -570,6 +350,15 @@ namespace gl_renderer
 	void Device::swapBuffers()const
 	{
 		m_context->swapBuffers();
+
+		if ( m_pushConstantsRing )
+		{
+			m_pushConstantsRing->nextFrame();
+		}
+
+		CallTracer::frame();
+		m_frameStateCallsCount = m_stateCallsCount;
+		m_stateCallsCount = 0u;
 	}
 
 	void Device::doEnable()const
@@ -7,15 +7,11 @@ See LICENSE file in root folder
 #include "Core/GlContext.hpp"
 #include "Core/GlPhysicalDevice.hpp"
 
+#include "Pipeline/GlPipelineStateBlock.hpp"
+
 #include <Buffer/VertexBuffer.hpp>
 #include <Core/Device.hpp>
-#include <Pipeline/ColourBlendState.hpp>
-#include <Pipeline/DepthStencilState.hpp>
-#include <Pipeline/InputAssemblyState.hpp>
-#include <Pipeline/MultisampleState.hpp>
-#include <Pipeline/RasterisationState.hpp>
 #include <Pipeline/Scissor.hpp>
-#include <Pipeline/TessellationState.hpp>
 #include <Pipeline/Viewport.hpp>
 
 namespace gl_renderer
@@ -164,52 +160,79 @@ namespace gl_renderer
 		/**
 		*\brief
 		*	Echange les tampons.
+		*\remarks
+		*	Le nombre d'appels de changement d'état de la frame écoulée est alors enregistré,
+		*	et l'anneau de push constants passe à la frame suivante.
 		*/
 		void swapBuffers()const;
-
-		inline uint32_t getGlslVersion()const
+		/**
+		*\brief
+		*	Comptabilise des appels OpenGL de changement d'état.
+		*\param[in] count
+		*	Le nombre d'appels.
+		*/
+		inline void addStateCalls( uint32_t count )const
 		{
-			return static_cast< PhysicalDevice const & >( m_gpu ).getGlslVersion();
+			m_stateCallsCount += count;
 		}
-
-		inline renderer::Scissor & getCurrentScissor()const
+		/**
+		*\return
+		*	Le nombre d'appels OpenGL de changement d'état émis lors de la dernière frame.
+		*/
+		inline uint32_t getFrameStateCallsCount()const
 		{
-			return m_scissor;
+			return m_frameStateCallsCount;
 		}
 
-		inline renderer::Viewport & getCurrentViewport()const
+		inline uint32_t getGlslVersion()const
 		{
-			return m_viewport;
+			return static_cast< PhysicalDevice const & >( m_gpu ).getGlslVersion();
 		}
-
-		inline renderer::ColourBlendState & getCurrentBlendState()const
+		/**
+		*\return
+		*	\p true si les objets sont créés et modifiés via l'accès direct aux états,
+		*	plutôt qu'en les attachant à une cible.
+		*/
+		inline bool hasDirectStateAccess()const
 		{
-			return m_cbState;
+			return m_directStateAccess;
 		}
-
-		inline renderer::DepthStencilState & getCurrentDepthStencilState()const
+		/**
+		*\return
+		*	\p true si les résultats de requêtes peuvent être écrits dans un tampon, côté GPU.
+		*/
+		inline bool hasQueryBuffer()const
 		{
-			return m_dsState;
+			return m_queryBuffer;
 		}
 
-		inline renderer::MultisampleState & getCurrentMultisampleState()const
+		/**
+		*\return
+		*	L'anneau recevant les blocs de push constants, \p nullptr si les push constants
+		*	ne peuvent être émulées que via des variables uniformes.
+		*/
+		inline PushConstantsRing * getPushConstantsRing()const
 		{
-			return m_msState;
+			return m_pushConstantsRing.get();
 		}
 
-		inline renderer::RasterisationState & getCurrentRasterisationState()const
+		inline renderer::Scissor & getCurrentScissor()const
 		{
-			return m_rsState;
+			return m_scissor;
 		}
 
-		inline renderer::TessellationState & getCurrentTessellationState()const
+		inline renderer::Viewport & getCurrentViewport()const
 		{
-			return m_tsState;
+			return m_viewport;
 		}
 
-		inline renderer::InputAssemblyState & getCurrentInputAssemblyState()const
+		/**
+		*\return
+		*	Les états de pipeline actuellement appliqués sur le contexte.
+		*/
+		inline PipelineStateBlock & getCurrentStateBlock()const
 		{
-			return m_iaState;
+			return m_stateBlock;
 		}
 
 		inline GLuint & getCurrentProgram()const
@@ -249,6 +272,8 @@ namespace gl_renderer
 
 	private:
 		ContextPtr m_context;
+		bool m_directStateAccess;
+		bool m_queryBuffer;
 		// Mimic the behavior in Vulkan, when no IBO nor VBO is bound.
 		mutable struct
 		{
@@ -258,13 +283,11 @@ namespace gl_renderer
 		} m_dummyIndexed;
 		mutable renderer::Scissor m_scissor{ 0, 0, 0, 0 };
 		mutable renderer::Viewport m_viewport{ 0, 0, 0, 0 };
-		mutable renderer::ColourBlendState m_cbState;
-		mutable renderer::DepthStencilState m_dsState;
-		mutable renderer::MultisampleState m_msState;
-		mutable renderer::RasterisationState m_rsState;
-		mutable renderer::TessellationState m_tsState;
-		mutable renderer::InputAssemblyState m_iaState;
+		mutable PipelineStateBlock m_stateBlock;
+		PushConstantsRingPtr m_pushConstantsRing;
 		mutable GLuint m_currentProgram;
+		mutable uint32_t m_stateCallsCount{ 0u };
+		mutable uint32_t m_frameStateCallsCount{ 0u };
 		GLuint m_blitFbos[2];
 	};
 }
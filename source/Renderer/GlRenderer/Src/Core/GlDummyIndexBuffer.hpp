@@ -1,6 +1,6 @@
 namespace gl_renderer
 {
-	unsigned long dummyIndex[]
+	uint32_t dummyIndex[]
 	{
 		   2,    1,    0,    5,    4,    3,    8,    7,    6,   11,   10,    9,   14,   13,   12,   17,   16,   15,   20,   19,   18,   23,   22,   21,   26,   25,   24,
 		  29,   28,   27,   32,   31,   30,   35,   34,   33,   38,   37,   36,   41,   40,   39,   44,   43,   42,   47,   46,   45,   50,   49,   48,   53,   52,   51,
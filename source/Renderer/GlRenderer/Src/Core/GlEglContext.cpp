@@ -0,0 +1,220 @@
+#include "Core/GlEglContext.hpp"
+
+#if GLRENDERER_EGL
+#include "Core/GlPhysicalDevice.hpp"
+
+#include "Miscellaneous/GlDebug.hpp"
+
+#include <EGL/eglext.h>
+
+#include <iostream>
+#include <sstream>
+
+#ifndef EGL_PLATFORM_SURFACELESS_MESA
+#	define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+#endif
+
+namespace gl_renderer
+{
+	namespace
+	{
+#if !defined( NDEBUG )
+
+		static const EGLint GL_CONTEXT_CREATION_DEFAULT_FLAGS = EGL_CONTEXT_OPENGL_FORWARD_COMPATIBLE_BIT_KHR | EGL_CONTEXT_OPENGL_DEBUG_BIT_KHR;
+
+#else
+
+		static const EGLint GL_CONTEXT_CREATION_DEFAULT_FLAGS = EGL_CONTEXT_OPENGL_FORWARD_COMPATIBLE_BIT_KHR;
+
+#endif
+
+		bool hasExtension( char const * extensions
+			, std::string const & name )
+		{
+			if ( !extensions )
+			{
+				return false;
+			}
+
+			std::stringstream stream{ extensions };
+			std::string extension;
+
+			while ( stream >> extension )
+			{
+				if ( extension == name )
+				{
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		EGLDisplay getDisplay()
+		{
+			EGLDisplay result = EGL_NO_DISPLAY;
+			// Les extensions client se récupèrent sans affichage.
+			auto clientExtensions = eglQueryString( EGL_NO_DISPLAY, EGL_EXTENSIONS );
+
+			if ( hasExtension( clientExtensions, "EGL_EXT_platform_base" )
+				&& hasExtension( clientExtensions, "EGL_MESA_platform_surfaceless" ) )
+			{
+				auto getPlatformDisplay = reinterpret_cast< PFNEGLGETPLATFORMDISPLAYEXTPROC >( eglGetProcAddress( "eglGetPlatformDisplayEXT" ) );
+
+				if ( getPlatformDisplay )
+				{
+					result = getPlatformDisplay( EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr );
+				}
+			}
+
+			if ( result == EGL_NO_DISPLAY )
+			{
+				result = eglGetDisplay( EGL_DEFAULT_DISPLAY );
+			}
+
+			if ( result == EGL_NO_DISPLAY )
+			{
+				throw std::runtime_error{ "Couldn't get an EGL display." };
+			}
+
+			return result;
+		}
+	}
+
+	EglDisplay::EglDisplay()
+		: m_display{ getDisplay() }
+	{
+		EGLint major{ 0 };
+		EGLint minor{ 0 };
+
+		if ( !eglInitialize( m_display, &major, &minor ) )
+		{
+			throw std::runtime_error{ "Couldn't initialise the EGL display." };
+		}
+
+		if ( !eglBindAPI( EGL_OPENGL_API ) )
+		{
+			throw std::runtime_error{ "The EGL display doesn't support OpenGL." };
+		}
+
+		EGLint const configAttribs[]
+		{
+			EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+			EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+			EGL_RED_SIZE, 8,
+			EGL_GREEN_SIZE, 8,
+			EGL_BLUE_SIZE, 8,
+			EGL_ALPHA_SIZE, 8,
+			EGL_NONE
+		};
+		EGLint count{ 0 };
+
+		if ( !eglChooseConfig( m_display, configAttribs, &m_config, 1, &count )
+			|| !count )
+		{
+			throw std::runtime_error{ "Couldn't find an appropriate EGL config." };
+		}
+
+		if ( !hasExtension( eglQueryString( m_display, EGL_EXTENSIONS ), "EGL_KHR_surfaceless_context" ) )
+		{
+			EGLint const pbufferAttribs[]
+			{
+				EGL_WIDTH, 1,
+				EGL_HEIGHT, 1,
+				EGL_NONE
+			};
+			m_surface = eglCreatePbufferSurface( m_display, m_config, pbufferAttribs );
+
+			if ( m_surface == EGL_NO_SURFACE )
+			{
+				throw std::runtime_error{ "Couldn't create an EGL pbuffer surface." };
+			}
+		}
+
+		std::clog << "EglDisplay - EGL " << major << "." << minor
+			<< ( m_surface == EGL_NO_SURFACE ? ", surfaceless." : ", pbuffer." ) << std::endl;
+	}
+
+	EglDisplay::~EglDisplay()
+	{
+		if ( m_surface != EGL_NO_SURFACE )
+		{
+			eglDestroySurface( m_display, m_surface );
+		}
+
+		// L'affichage n'est pas terminé : les affichages EGL ne sont pas comptés en références,
+		// eglTerminate détruirait donc les contextes des autres périphériques.
+	}
+
+	EGLContext EglDisplay::createContext( EGLint const * attribs )const
+	{
+		return eglCreateContext( m_display, m_config, EGL_NO_CONTEXT, attribs );
+	}
+
+	void EglDisplay::destroyContext( EGLContext context )const
+	{
+		eglDestroyContext( m_display, context );
+	}
+
+	void EglDisplay::makeCurrent( EGLContext context )const
+	{
+		auto surface = context == EGL_NO_CONTEXT
+			? EGL_NO_SURFACE
+			: m_surface;
+		eglMakeCurrent( m_display, surface, surface, context );
+	}
+
+	EglContext::EglContext( PhysicalDevice const & gpu
+		, renderer::ConnectionPtr && connection )
+		: Context{ gpu, std::move( connection ) }
+	{
+		if ( m_gpu.getMajor() < 4 )
+		{
+			throw std::runtime_error{ "The supported OpenGL version is insufficient." };
+		}
+
+		EGLint const attribList[]
+		{
+			EGL_CONTEXT_MAJOR_VERSION_KHR, m_gpu.getMajor(),
+			EGL_CONTEXT_MINOR_VERSION_KHR, m_gpu.getMinor(),
+			EGL_CONTEXT_FLAGS_KHR, GL_CONTEXT_CREATION_DEFAULT_FLAGS,
+			EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR,
+			EGL_NONE
+		};
+		m_context = m_display.createContext( attribList );
+
+		if ( m_context == EGL_NO_CONTEXT )
+		{
+			std::cerr << "GlContext::create - Failed to create a " << m_gpu.getMajor() << "." << m_gpu.getMinor() << " headless OpenGL context." << std::endl;
+			throw std::runtime_error{ "Could not create a rendering context." };
+		}
+
+		std::cout << "GlContext::create - " << m_gpu.getMajor() << "." << m_gpu.getMinor() << " headless OpenGL context created." << std::endl;
+		setCurrent();
+		m_opengl = std::make_unique< OpenGLLibrary >();
+		loadDebugFunctions();
+		endCurrent();
+	}
+
+	EglContext::~EglContext()
+	{
+		m_display.destroyContext( m_context );
+	}
+
+	void EglContext::setCurrent()const
+	{
+		m_display.makeCurrent( m_context );
+	}
+
+	void EglContext::endCurrent()const
+	{
+		m_display.makeCurrent( EGL_NO_CONTEXT );
+	}
+
+	void EglContext::swapBuffers()const
+	{
+		glLogCall( gl::Flush );
+	}
+}
+
+#endif
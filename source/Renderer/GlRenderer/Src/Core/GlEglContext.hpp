@@ -0,0 +1,73 @@
+/*
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "Core/GlContext.hpp"
+
+#if GLRENDERER_EGL
+#	include "Miscellaneous/OpenGLLibrary.hpp"
+
+#	include <EGL/egl.h>
+
+namespace gl_renderer
+{
+	/**
+	*\brief
+	*	Un affichage EGL initialisé, sans serveur d'affichage quand la plateforme surfaceless de Mesa est disponible.
+	*\remarks
+	*	Si EGL_KHR_surfaceless_context n'est pas supporté, les contextes sont rendus courants sur un pbuffer de 1x1,
+	*	le rendu se faisant de toute façon dans des FBO.
+	*/
+	class EglDisplay
+	{
+	public:
+		EglDisplay();
+		~EglDisplay();
+		/**
+		*\brief
+		*	Crée un contexte OpenGL.
+		*\param[in] attribs
+		*	Les attributs du contexte, terminés par EGL_NONE.
+		*/
+		EGLContext createContext( EGLint const * attribs )const;
+		void destroyContext( EGLContext context )const;
+		/**
+		*\brief
+		*	Rend le contexte donné courant, EGL_NO_CONTEXT le désactive.
+		*/
+		void makeCurrent( EGLContext context )const;
+
+	private:
+		EGLDisplay m_display{ EGL_NO_DISPLAY };
+		EGLConfig m_config{ nullptr };
+		EGLSurface m_surface{ EGL_NO_SURFACE };
+	};
+	/**
+	*\brief
+	*	Contexte OpenGL headless, créé via EGL pour les connexions sans fenêtre.
+	*/
+	class EglContext
+		: public Context
+	{
+	public:
+		EglContext( PhysicalDevice const & gpu
+			, renderer::ConnectionPtr && connection );
+		~EglContext();
+
+		void setCurrent()const override;
+		void endCurrent()const override;
+		/**
+		*\brief
+		*	Il n'y a pas de tampons à échanger, les commandes en attente sont juste envoyées au GPU.
+		*/
+		void swapBuffers()const override;
+
+	protected:
+		EglDisplay m_display;
+		EGLContext m_context{ EGL_NO_CONTEXT };
+		std::unique_ptr< OpenGLLibrary > m_opengl;
+	};
+}
+
+#endif
@@ -0,0 +1,78 @@
+#include "Core/GlOffscreenSwapChain.hpp"
+
+#include "Core/GlDevice.hpp"
+#include "RenderPass/GlRenderPass.hpp"
+
+#include <RenderPass/FrameBufferAttachment.hpp>
+
+namespace gl_renderer
+{
+	OffscreenSwapChain::OffscreenSwapChain( renderer::Device const & device
+		, renderer::UIVec2 const & size )
+		: SwapChain{ device, size }
+	{
+		doCreateImages();
+	}
+
+	void OffscreenSwapChain::reset( renderer::UIVec2 const & size )
+	{
+		m_device.waitIdle();
+		m_dimensions = size;
+		doCreateImages();
+		SwapChain::reset( size );
+	}
+
+	renderer::FrameBufferPtrArray OffscreenSwapChain::createFrameBuffers( renderer::RenderPass const & renderPass )const
+	{
+		return renderer::FrameBufferPtrArray
+		{
+			static_cast< RenderPass const & >( renderPass ).createFrameBuffer( m_dimensions
+				, doPrepareAttaches( renderPass.getAttaches() ) )
+		};
+	}
+
+	void OffscreenSwapChain::doCreateImages()
+	{
+		m_depthView.reset();
+		m_depth.reset();
+		m_colourView.reset();
+		m_colour = m_device.createTexture( renderer::ImageLayout::eUndefined );
+		m_colour->setImage( getFormat()
+			, m_dimensions
+			, renderer::ImageUsageFlag::eColourAttachment
+				| renderer::ImageUsageFlag::eTransferSrc
+				| renderer::ImageUsageFlag::eSampled );
+		m_colourView = m_colour->createView( renderer::TextureType::e2D
+			, getFormat() );
+	}
+
+	renderer::FrameBufferAttachmentArray OffscreenSwapChain::doPrepareAttaches( renderer::RenderPassAttachmentArray const & attaches )const
+	{
+		renderer::FrameBufferAttachmentArray result;
+
+		for ( auto & attach : attaches )
+		{
+			if ( !renderer::isDepthOrStencilFormat( attach.format ) )
+			{
+				result.emplace_back( attach, *m_colourView );
+			}
+			else
+			{
+				// Comme pour les swap chains Vulkan, la texture de profondeur est créée à la première demande.
+				if ( !m_depth )
+				{
+					m_depth = m_device.createTexture( renderer::ImageLayout::eUndefined );
+					m_depth->setImage( attach.format
+						, m_dimensions
+						, renderer::ImageUsageFlag::eDepthStencilAttachment );
+					m_depthView = m_depth->createView( renderer::TextureType::e2D
+						, attach.format );
+				}
+
+				result.emplace_back( attach, *m_depthView );
+			}
+		}
+
+		return result;
+	}
+}
@@ -0,0 +1,60 @@
+/*
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "Core/GlSwapChain.hpp"
+
+#include <Image/Texture.hpp>
+#include <Image/TextureView.hpp>
+
+namespace gl_renderer
+{
+	/**
+	*\brief
+	*	Swap chain des connexions sans fenêtre : le rendu est fait dans une texture, récupérable via getOffscreenImage().
+	*/
+	class OffscreenSwapChain
+		: public SwapChain
+	{
+	public:
+		/**
+		*\brief
+		*	Constructeur.
+		*/
+		OffscreenSwapChain( renderer::Device const & device
+			, renderer::UIVec2 const & size );
+		/**
+		*\brief
+		*	Réinitialise la swap chain, en recréant ses textures.
+		*/
+		void reset( renderer::UIVec2 const & size )override;
+		/**
+		*\brief
+		*	Crée le tampon d'image rendant dans la texture, compatible avec la passe de rendu donnée.
+		*\param[in] renderPass
+		*	La passe de rendu.
+		*\return
+		*	Les tampons d'images.
+		*/
+		renderer::FrameBufferPtrArray createFrameBuffers( renderer::RenderPass const & renderPass )const override;
+		/**
+		*\return
+		*	La texture dans laquelle le rendu est fait.
+		*/
+		inline renderer::Texture const * getOffscreenImage()const override
+		{
+			return m_colour.get();
+		}
+
+	private:
+		void doCreateImages();
+		renderer::FrameBufferAttachmentArray doPrepareAttaches( renderer::RenderPassAttachmentArray const & attaches )const;
+
+	private:
+		renderer::TexturePtr m_colour;
+		renderer::TextureViewPtr m_colourView;
+		mutable renderer::TexturePtr m_depth;
+		mutable renderer::TextureViewPtr m_depthView;
+	};
+}
@@ -14,6 +14,10 @@ See LICENSE file in root folder.
 
 #include <GL/gl.h>
 
+#if GLRENDERER_EGL
+#	include <EGL/egl.h>
+#endif
+
 #include <algorithm>
 #include <iterator>
 
@@ -193,6 +197,14 @@ namespace gl_renderer
 		template< typename FuncT >
 		bool getFunction( char const * const name, FuncT & function )
 		{
+#	if GLRENDERER_EGL
+			// Avec un contexte EGL (headless) courant, les fonctions sont récupérées via EGL.
+			if ( eglGetCurrentContext() != EGL_NO_CONTEXT )
+			{
+				function = reinterpret_cast< FuncT >( eglGetProcAddress( name ) );
+				return function != nullptr;
+			}
+#	endif
 			function = reinterpret_cast< FuncT >( glXGetProcAddressARB( reinterpret_cast< GLubyte const * >( name ) ) );
 			return function != nullptr;
 		}
@@ -421,7 +433,7 @@ namespace gl_renderer
 		m_features.fullDrawIndexUint32 = false;
 		m_features.imageCubeArray = find( "GL_ARB_texture_cube_map_array" );
 		m_features.independentBlend = findAny( { "GL_ARB_draw_buffers_blend", "GL_EXT_draw_buffers2" } );
-		m_features.geometryShader = find( "GL_ARB_geometry_shader4" );
+		m_features.geometryShader = m_glslVersion >= 150u || find( "GL_ARB_geometry_shader4" );
 		m_features.tessellationShader = find( "GL_ARB_tessellation_shader" );
 		m_features.sampleRateShading = find( "GL_ARB_sample_shading" );
 		m_features.dualSrcBlend = find( "GL_ARB_blend_func_extended" );
@@ -499,6 +511,30 @@ namespace gl_renderer
 		return true;
 	}
 
+	bool PhysicalDevice::isDrawIndirectCountSupported()const
+	{
+		return find( "GL_ARB_indirect_parameters" )
+			&& gl::MultiDrawArraysIndirectCountARB
+			&& gl::MultiDrawElementsIndirectCountARB;
+	}
+
+	bool PhysicalDevice::isDirectStateAccessSupported()const
+	{
+		return ( m_major > 4
+				|| ( m_major == 4 && m_minor >= 5 )
+				|| find( "GL_ARB_direct_state_access" ) )
+			&& gl::CreateBuffers
+			&& gl::CreateFramebuffers
+			&& gl::CreateTextures;
+	}
+
+	bool PhysicalDevice::isQueryBufferSupported()const
+	{
+		return m_major > 4
+			|| ( m_major == 4 && m_minor >= 4 )
+			|| find( "GL_ARB_query_buffer_object" );
+	}
+
 	bool PhysicalDevice::isSPIRVSupported()const
 	{
 		static bool isSupported = find( "GL_ARB_gl_spirv" )
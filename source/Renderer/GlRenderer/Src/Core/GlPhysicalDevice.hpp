@@ -47,6 +47,33 @@ namespace gl_renderer
 		*\copydoc	renderer::PhysicalDevice::isGLSLSupported
 		*/
 		bool isGLSLSupported()const override;
+		/**
+		*\copydoc	renderer::PhysicalDevice::isDrawIndirectCountSupported
+		*/
+		bool isDrawIndirectCountSupported()const override;
+
+		/**
+		*\~french
+		*\brief
+		*	Dit si l'accès direct aux états (GL 4.5 ou GL_ARB_direct_state_access) est supporté.
+		*\remarks
+		*	Les fonctions OpenGL doivent avoir été chargées.
+		*\~english
+		*\brief
+		*	Tells if direct state access (GL 4.5 or GL_ARB_direct_state_access) is supported.
+		*\remarks
+		*	The OpenGL functions must have been loaded.
+		*/
+		bool isDirectStateAccessSupported()const;
+		/**
+		*\~french
+		*\brief
+		*	Dit si les tampons de requêtes (GL 4.4 ou GL_ARB_query_buffer_object) sont supportés.
+		*\~english
+		*\brief
+		*	Tells if query buffer objects (GL 4.4 or GL_ARB_query_buffer_object) are supported.
+		*/
+		bool isQueryBufferSupported()const;
 
 		bool find( std::string const & name )const;
 		bool findAny( renderer::StringArray const & names )const;
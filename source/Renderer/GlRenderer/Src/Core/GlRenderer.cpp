@@ -3,6 +3,7 @@
 #include "Core/GlConnection.hpp"
 #include "Core/GlContext.hpp"
 #include "Core/GlDevice.hpp"
+#include "Core/GlEglContext.hpp"
 #include "Core/GlPhysicalDevice.hpp"
 
 #include <iostream>
@@ -309,14 +310,60 @@ namespace gl_renderer
 			GLXContext m_glxContext;
 		};
 
+#endif
+#if GLRENDERER_EGL
+
+		/**
+		*\brief
+		*	Remplace RenderWindow lorsqu'il n'y a pas de serveur d'affichage.
+		*/
+		class HeadlessRenderWindow
+		{
+		public:
+			HeadlessRenderWindow()
+				: m_context{ m_display.createContext( ContextAttribs ) }
+			{
+				if ( m_context == EGL_NO_CONTEXT )
+				{
+					throw std::runtime_error{ "Could not create a headless rendering context." };
+				}
+
+				m_display.makeCurrent( m_context );
+			}
+
+			~HeadlessRenderWindow()
+			{
+				m_display.makeCurrent( EGL_NO_CONTEXT );
+				m_display.destroyContext( m_context );
+			}
+
+		private:
+			static EGLint constexpr ContextAttribs[]{ EGL_NONE };
+			EglDisplay m_display;
+			EGLContext m_context;
+		};
+
 #endif
 	}
 
 	Renderer::Renderer( Configuration const & configuration )
 		: renderer::Renderer{ renderer::ClipDirection::eBottomUp, "gl", configuration }
 	{
-		RenderWindow dummyWindow;
-		m_gpus.push_back( std::make_unique< PhysicalDevice >( *this ) );
+		try
+		{
+			RenderWindow dummyWindow;
+			m_gpus.push_back( std::make_unique< PhysicalDevice >( *this ) );
+		}
+		catch ( std::exception & exc )
+		{
+#if GLRENDERER_EGL
+			std::cerr << "Could not create a windowed context (" << exc.what() << "), falling back to EGL." << std::endl;
+			HeadlessRenderWindow dummyWindow;
+			m_gpus.push_back( std::make_unique< PhysicalDevice >( *this ) );
+#else
+			throw;
+#endif
+		}
 	}
 
 	renderer::DevicePtr Renderer::createDevice( renderer::ConnectionPtr && connection )const
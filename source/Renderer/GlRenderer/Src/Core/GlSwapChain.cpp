@@ -60,6 +60,7 @@ namespace gl_renderer
 	void SwapChain::present( renderer::RenderingResources & resources )
 	{
 		static_cast< Device const & >( m_device ).swapBuffers();
+		m_device.endFrameStatistics();
 		resources.setBackBuffer( ~0u );
 	}
 
@@ -6,6 +6,9 @@ namespace gl_renderer
 	{
 		switch ( value )
 		{
+		case gl_renderer::GL_BUFFER_TARGET_PARAMETER:
+			return "GL_PARAMETER_BUFFER";
+
 		case gl_renderer::GL_BUFFER_TARGET_ARRAY:
 			return "GL_ARRAY_BUFFER";
 
@@ -39,6 +42,9 @@ namespace gl_renderer
 		case gl_renderer::GL_BUFFER_TARGET_DISPATCH_INDIRECT:
 			return "GL_DISPATCH_INDIRECT_BUFFER";
 
+		case gl_renderer::GL_BUFFER_TARGET_QUERY:
+			return "GL_QUERY_BUFFER";
+
 		default:
 			assert( false && "Unsupported GlBufferTarget" );
 			return "GlBufferTarget_UNKNOWN";
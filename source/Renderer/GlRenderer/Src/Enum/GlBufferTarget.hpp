@@ -11,6 +11,7 @@ namespace gl_renderer
 	enum GlBufferTarget
 		: GLenum
 	{
+		GL_BUFFER_TARGET_PARAMETER = 0x80EE,
 		GL_BUFFER_TARGET_ARRAY = 0x8892,
 		GL_BUFFER_TARGET_ELEMENT_ARRAY = 0x8893,
 		GL_BUFFER_TARGET_PIXEL_PACK = 0x88EB,
@@ -22,6 +23,7 @@ namespace gl_renderer
 		GL_BUFFER_TARGET_DRAW_INDIRECT = 0x8F3F,
 		GL_BUFFER_TARGET_SHADER_STORAGE = 0x90D2,
 		GL_BUFFER_TARGET_DISPATCH_INDIRECT = 0x90EE,
+		GL_BUFFER_TARGET_QUERY = 0x9192,
 	};
 	std::string getName( GlBufferTarget value );
 
@@ -10,6 +10,7 @@ namespace gl_renderer
 	{
 		GL_SMOOTH_LINE_WIDTH_RANGE = 0x0B22,
 		GL_ALIASED_LINE_WIDTH_RANGE = 0x846E,
+		GL_MAX_UNIFORM_BUFFER_BINDINGS = 0x8A2F,
 		GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT = 0x8A34,
 	};
 	std::string getName( GlGetParameter value );
@@ -12,6 +12,9 @@ namespace gl_renderer
 		case gl_renderer::GL_QUERY_RESULT:
 			return "GL_QUERY_RESULT";
 
+		case gl_renderer::GL_QUERY_RESULT_AVAILABLE:
+			return "GL_QUERY_RESULT_AVAILABLE";
+
 		case gl_renderer::GL_QUERY_RESULT_NO_WAIT:
 			return "GL_QUERY_RESULT_NO_WAIT";
 
@@ -23,18 +26,12 @@ namespace gl_renderer
 
 	GLuint convert( renderer::QueryResultFlags const & flags )
 	{
-		GLuint result{ 0 };
-
+		// La disponibilité est récupérée séparément, via GL_QUERY_RESULT_AVAILABLE.
 		if ( checkFlag( flags, renderer::QueryResultFlag::eWait ) )
 		{
 			return GL_QUERY_RESULT;
 		}
 
-		if ( checkFlag( flags, renderer::QueryResultFlag::eWithAvailability ) )
-		{
-			return GL_QUERY_RESULT_NO_WAIT;
-		}
-
-		return result;
+		return GL_QUERY_RESULT_NO_WAIT;
 	}
 }
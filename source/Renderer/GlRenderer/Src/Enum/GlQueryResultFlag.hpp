@@ -11,6 +11,7 @@ namespace gl_renderer
 	enum GlQueryResultFlag
 	{
 		GL_QUERY_RESULT = 0x8866,
+		GL_QUERY_RESULT_AVAILABLE = 0x8867,
 		GL_QUERY_RESULT_NO_WAIT = 0x9194,
 	};
 	Utils_ImplementFlag( GlQueryResultFlag );
@@ -10,6 +10,7 @@ namespace gl_renderer
 {
 	enum GlTexParameter
 	{
+		GL_TEXTURE_BASE_LEVEL = 0x813C,
 		GL_TEXTURE_VIEW_MIN_LEVEL = 0x82DB,
 		GL_TEXTURE_VIEW_NUM_LEVELS = 0x82DC,
 		GL_TEXTURE_VIEW_MIN_LAYER = 0x82DD,
@@ -21,6 +22,9 @@ namespace gl_renderer
 	{
 		switch ( value )
 		{
+		case GL_TEXTURE_BASE_LEVEL:
+			return "GL_TEXTURE_BASE_LEVEL";
+
 		case GL_TEXTURE_VIEW_MIN_LEVEL:
 			return "GL_TEXTURE_VIEW_MIN_LEVEL";
 
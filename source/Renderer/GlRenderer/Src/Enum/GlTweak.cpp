@@ -18,6 +18,9 @@ namespace gl_renderer
 		case gl_renderer::GL_BLEND:
 			return "GL_BLEND";
 
+		case gl_renderer::GL_COLOR_LOGIC_OP:
+			return "GL_COLOR_LOGIC_OP";
+
 		case gl_renderer::GL_POLYGON_OFFSET_POINT:
 			return "GL_POLYGON_OFFSET_POINT";
 
@@ -42,6 +45,9 @@ namespace gl_renderer
 		case gl_renderer::GL_RASTERIZER_DISCARD:
 			return "GL_RASTERIZER_DISCARD";
 
+		case gl_renderer::GL_FRAMEBUFFER_SRGB:
+			return "GL_FRAMEBUFFER_SRGB";
+
 		default:
 			assert( false && "Unsupported GlTweak" );
 			return "GlTweak_UNKNOWN";
@@ -22,6 +22,7 @@ namespace gl_renderer
 		GL_STENCIL_FRONT_REF = 0x0B97,
 		GL_STENCIL_FRONT_WRITEMASK = 0x0B98,
 		GL_BLEND = 0x0BE2,
+		GL_COLOR_LOGIC_OP = 0x0BF2,
 		GL_POLYGON_OFFSET_POINT = 0x2A01,
 		GL_POLYGON_OFFSET_LINE = 0x2A02,
 		GL_MULTISAMPLE = 0x809D,
@@ -38,6 +39,7 @@ namespace gl_renderer
 		GL_STENCIL_BACK_REF = 0x8CA3,
 		GL_STENCIL_BACK_VALUE_MASK = 0x8CA4,
 		GL_STENCIL_BACK_WRITEMASK = 0x8CA5,
+		GL_FRAMEBUFFER_SRGB = 0x8DB9,
 		GL_PRIMITIVE_RESTART = 0x8F9D,
 	};
 	std::string getName( GlTweak value );
@@ -18,6 +18,9 @@ namespace gl_renderer
 		case GL_INTERNAL_R5G5B5A1:
 			return "GL_RGB5_A1";
 
+		case GL_INTERNAL_R10G10B10A2:
+			return "GL_RGB10_A2";
+
 		case GL_INTERNAL_D16:
 			return "GL_DEPTH_COMPONENT16";
 
@@ -309,6 +312,9 @@ namespace gl_renderer
 		case GL_TYPE_UI24_8:
 			return "GL_UNSIGNED_INT_24_8";
 
+		case GL_TYPE_UI2101010_REV:
+			return "GL_UNSIGNED_INT_2_10_10_10_REV";
+
 		default:
 			assert( false && "Unupported GlType" );
 			return "GlType_UNKNOWN";
@@ -349,6 +355,12 @@ namespace gl_renderer
 		case renderer::PixelFormat::eRGBA32F:
 			return GL_INTERNAL_RGBA32F;
 
+		case renderer::PixelFormat::eR8G8B8A8_SRGB:
+			return GL_INTERNAL_R8G8B8A8_SRGB;
+
+		case renderer::PixelFormat::eR10G10B10A2:
+			return GL_INTERNAL_R10G10B10A2;
+
 		case renderer::PixelFormat::eD16:
 			return GL_INTERNAL_D16;
 
@@ -581,6 +593,7 @@ namespace gl_renderer
 			return GL_FORMAT_RGBA;
 
 		case renderer::PixelFormat::eR8G8B8A8:
+		case renderer::PixelFormat::eR8G8B8A8_SRGB:
 #if defined( _WIN32 ) || defined( __linux__ )
 			return GL_FORMAT_ABGR;
 #else
@@ -592,6 +605,7 @@ namespace gl_renderer
 
 		case renderer::PixelFormat::eRGBA16F:
 		case renderer::PixelFormat::eRGBA32F:
+		case renderer::PixelFormat::eR10G10B10A2:
 			return GL_FORMAT_RGBA;
 
 		case renderer::PixelFormat::eD16:
@@ -628,8 +642,12 @@ namespace gl_renderer
 			return GL_TYPE_UI8;
 
 		case renderer::PixelFormat::eR8G8B8A8:
+		case renderer::PixelFormat::eR8G8B8A8_SRGB:
 			return GL_TYPE_UI8888;
 
+		case renderer::PixelFormat::eR10G10B10A2:
+			return GL_TYPE_UI2101010_REV;
+
 		case renderer::PixelFormat::eB8G8R8A8:
 			return GL_TYPE_UI8888;
 
@@ -738,6 +756,12 @@ namespace gl_renderer
 		case GL_INTERNAL_RGBA32F:
 			return renderer::PixelFormat::eRGBA32F;
 
+		case GL_INTERNAL_R8G8B8A8_SRGB:
+			return renderer::PixelFormat::eR8G8B8A8_SRGB;
+
+		case GL_INTERNAL_R10G10B10A2:
+			return renderer::PixelFormat::eR10G10B10A2;
+
 		case GL_INTERNAL_D16:
 			return renderer::PixelFormat::eD16;
 
@@ -15,6 +15,7 @@ namespace gl_renderer
 		GL_INTERNAL_R8G8B8A8 = 0x8058,
 		GL_INTERNAL_R4G4B4A4 = 0x8056,
 		GL_INTERNAL_R5G5B5A1 = 0x8057,
+		GL_INTERNAL_R10G10B10A2 = 0x8059,
 		GL_INTERNAL_D16 = 0x81A5,
 		GL_INTERNAL_D24 = 0x81A6,
 		GL_INTERNAL_D32 = 0x81A7,
@@ -117,6 +118,7 @@ namespace gl_renderer
 		GL_TYPE_US5551 = 0x8034,
 		GL_TYPE_UI8888 = 0x8035,
 		GL_TYPE_UI565 = 0x8363,
+		GL_TYPE_UI2101010_REV = 0x8368,
 		GL_TYPE_UI24_8 = 0x84FA,
 		GL_TYPE_32F_UI24_8 = 0x8DAD
 	};
@@ -78,6 +78,7 @@ namespace gl_renderer
 	class PhysicalDevice;
 	class Pipeline;
 	class PipelineLayout;
+	class PushConstantsRing;
 	class QueryPool;
 	class Renderer;
 	class RenderPass;
@@ -90,6 +91,7 @@ namespace gl_renderer
 	using ContextPtr = std::unique_ptr< Context >;
 	using CommandPtr = std::unique_ptr< CommandBase >;
 	using GeometryBuffersPtr = std::unique_ptr< GeometryBuffers >;
+	using PushConstantsRingPtr = std::unique_ptr< PushConstantsRing >;
 	using TextureViewPtr = std::unique_ptr< TextureView >;
 
 	using GeometryBuffersRef = std::reference_wrapper< GeometryBuffers >;
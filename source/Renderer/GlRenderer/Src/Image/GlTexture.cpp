@@ -17,12 +17,19 @@ namespace gl_renderer
 		: renderer::Texture{ device }
 		, m_device{ device }
 	{
-		glLogCall( gl::GenTextures, 1, &m_texture );
+		if ( !m_device.hasDirectStateAccess() )
+		{
+			// With direct state access, the texture is created once its target is known.
+			glLogCall( gl::GenTextures, 1, &m_texture );
+		}
 	}
 
 	Texture::~Texture()
 	{
-		glLogCall( gl::DeleteTextures, 1, &m_texture );
+		if ( m_texture != GL_INVALID_INDEX )
+		{
+			glLogCall( gl::DeleteTextures, 1, &m_texture );
+		}
 	}
 
 	renderer::TextureViewPtr Texture::createView( renderer::TextureType type
@@ -44,13 +51,6 @@ namespace gl_renderer
 			, mapping );
 	}
 
-	void Texture::generateMipmaps()const
-	{
-		glLogCall( gl::BindTexture, m_target, m_texture );
-		glLogCall( gl::GenerateMipmap, m_target );
-		glLogCall( gl::BindTexture, m_target, 0 );
-	}
-
 	void Texture::doSetImage1D( renderer::ImageUsageFlags usageFlags
 		, renderer::ImageTiling tiling
 		, renderer::MemoryPropertyFlags memoryFlags )
@@ -64,6 +64,32 @@ namespace gl_renderer
 			m_target = GL_TEXTURE_1D;
 		}
 
+		if ( m_device.hasDirectStateAccess() )
+		{
+			doCreateTexture();
+
+			if ( m_layerCount > 1 )
+			{
+				glLogCall( gl::TextureStorage2D
+					, m_texture
+					, GLsizei( m_mipmapLevels )
+					, gl_renderer::getInternal( m_format )
+					, m_size[0]
+					, m_layerCount );
+			}
+			else
+			{
+				glLogCall( gl::TextureStorage1D
+					, m_texture
+					, GLsizei( m_mipmapLevels )
+					, gl_renderer::getInternal( m_format )
+					, m_size[0] );
+			}
+
+			doCheckStorage();
+			return;
+		}
+
 		glLogCall( gl::BindTexture, m_target, m_texture );
 
 		if ( m_layerCount > 1 )
@@ -84,12 +110,7 @@ namespace gl_renderer
 				, m_size[0] );
 		}
 
-		int levels = 0;
-		gl::GetTexParameteriv( m_target, GL_TEXTURE_IMMUTABLE_LEVELS, &levels );
-		assert( levels == m_mipmapLevels );
-		int format = 0;
-		gl::GetTexParameteriv( m_target, GL_TEXTURE_IMMUTABLE_FORMAT, &format );
-		assert( format != 0 );
+		doCheckStorage();
 		glLogCall( gl::BindTexture, m_target, 0 );
 	}
 
@@ -117,6 +138,58 @@ namespace gl_renderer
 			m_target = GL_TEXTURE_2D;
 		}
 
+		if ( m_device.hasDirectStateAccess() )
+		{
+			doCreateTexture();
+
+			if ( m_layerCount > 1 )
+			{
+				if ( m_samples > renderer::SampleCountFlag::e1 )
+				{
+					glLogCall( gl::TextureStorage3DMultisample
+						, m_texture
+						, GLsizei( m_samples )
+						, gl_renderer::getInternal( m_format )
+						, m_size[0]
+						, m_size[1]
+						, m_layerCount
+						, GL_TRUE );
+				}
+				else
+				{
+					glLogCall( gl::TextureStorage3D
+						, m_texture
+						, GLsizei( m_mipmapLevels )
+						, gl_renderer::getInternal( m_format )
+						, m_size[0]
+						, m_size[1]
+						, m_layerCount );
+				}
+			}
+			else if ( m_samples != renderer::SampleCountFlag::e1 )
+			{
+				glLogCall( gl::TextureStorage2DMultisample
+					, m_texture
+					, GLsizei( m_samples )
+					, gl_renderer::getInternal( m_format )
+					, m_size[0]
+					, m_size[1]
+					, GL_TRUE );
+			}
+			else
+			{
+				glLogCall( gl::TextureStorage2D
+					, m_texture
+					, GLsizei( m_mipmapLevels )
+					, gl_renderer::getInternal( m_format )
+					, m_size[0]
+					, m_size[1] );
+			}
+
+			doCheckStorage();
+			return;
+		}
+
 		glLogCall( gl::BindTexture, m_target, m_texture );
 
 		if ( m_layerCount > 1 )
@@ -163,12 +236,7 @@ namespace gl_renderer
 				, m_size[1] );
 		}
 
-		int levels = 0;
-		gl::GetTexParameteriv( m_target, GL_TEXTURE_IMMUTABLE_LEVELS, &levels );
-		assert( levels == m_mipmapLevels );
-		int format = 0;
-		gl::GetTexParameteriv( m_target, GL_TEXTURE_IMMUTABLE_FORMAT, &format );
-		assert( format != 0 );
+		doCheckStorage();
 		glLogCall( gl::BindTexture, m_target, 0 );
 	}
 
@@ -177,6 +245,21 @@ namespace gl_renderer
 		, renderer::MemoryPropertyFlags memoryFlags )
 	{
 		m_target = GL_TEXTURE_3D;
+
+		if ( m_device.hasDirectStateAccess() )
+		{
+			doCreateTexture();
+			glLogCall( gl::TextureStorage3D
+				, m_texture
+				, GLsizei( m_mipmapLevels )
+				, gl_renderer::getInternal( m_format )
+				, m_size[0]
+				, m_size[1]
+				, m_size[2] );
+			doCheckStorage();
+			return;
+		}
+
 		glLogCall( gl::BindTexture, m_target, m_texture );
 		glLogCall( gl::TexStorage3D
 			, m_target
@@ -185,13 +268,37 @@ namespace gl_renderer
 			, m_size[0]
 			, m_size[1]
 			, m_size[2] );
+		doCheckStorage();
+		glLogCall( gl::BindTexture, m_target, 0 );
+	}
+
+	void Texture::doCreateTexture()
+	{
+		if ( m_texture != GL_INVALID_INDEX )
+		{
+			glLogCall( gl::DeleteTextures, 1, &m_texture );
+		}
+
+		glLogCall( gl::CreateTextures, m_target, 1, &m_texture );
+	}
+
+	void Texture::doCheckStorage()const
+	{
 		int levels = 0;
-		gl::GetTexParameteriv( m_target, GL_TEXTURE_IMMUTABLE_LEVELS, &levels );
-		assert( levels == m_mipmapLevels );
 		int format = 0;
-		gl::GetTexParameteriv( m_target, GL_TEXTURE_IMMUTABLE_FORMAT, &format );
+
+		if ( m_device.hasDirectStateAccess() )
+		{
+			gl::GetTextureParameteriv( m_texture, GL_TEXTURE_IMMUTABLE_LEVELS, &levels );
+			gl::GetTextureParameteriv( m_texture, GL_TEXTURE_IMMUTABLE_FORMAT, &format );
+		}
+		else
+		{
+			gl::GetTexParameteriv( m_target, GL_TEXTURE_IMMUTABLE_LEVELS, &levels );
+			gl::GetTexParameteriv( m_target, GL_TEXTURE_IMMUTABLE_FORMAT, &format );
+		}
+
+		assert( levels == m_mipmapLevels );
 		assert( format != 0 );
-		glLogCall( gl::BindTexture, m_target, 0 );
-		glLogCall( gl::BindTexture, m_target, 0 );
 	}
 }
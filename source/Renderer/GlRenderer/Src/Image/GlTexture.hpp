@@ -45,10 +45,6 @@ namespace gl_renderer
 			, uint32_t layerCount
 			, renderer::ComponentMapping const & mapping )const override;
 		/**
-		*\copydoc	renderer::Texture::generateMipmaps
-		*/
-		void generateMipmaps()const override;
-		/**
 		*\return
 		*	L'image OpenGL.
 		*/
@@ -57,6 +53,14 @@ namespace gl_renderer
 			assert( m_texture != GL_INVALID_INDEX );
 			return m_texture;
 		}
+		/**
+		*\return
+		*	La cible OpenGL de la texture.
+		*/
+		inline GlTextureType getTarget()const noexcept
+		{
+			return m_target;
+		}
 
 	private:
 		/**
@@ -77,6 +81,16 @@ namespace gl_renderer
 		void doSetImage3D( renderer::ImageUsageFlags usageFlags
 			, renderer::ImageTiling tiling
 			, renderer::MemoryPropertyFlags memoryFlags )override;
+		/**
+		*\brief
+		*	Crée la texture OpenGL, pour le chemin d'accès direct aux états.
+		*/
+		void doCreateTexture();
+		/**
+		*\brief
+		*	Vérifie que le stockage immuable de la texture est conforme.
+		*/
+		void doCheckStorage()const;
 
 	private:
 		Device const & m_device;
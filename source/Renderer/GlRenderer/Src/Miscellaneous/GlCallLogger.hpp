@@ -4,6 +4,8 @@ See LICENSE file in root folder
 */
 #pragma once
 
+#include "Miscellaneous/GlCallTracer.hpp"
+
 #include <iostream>
 
 #define GL_LOG_CALLS 0
@@ -365,12 +367,14 @@ namespace gl_renderer
 	std::cout << "Command: " << Name << std::endl
 #elif defined( NDEBUG )
 #	define glLogCall( Name, ... )\
-	( Name( __VA_ARGS__ ) )
-#	define glLogCommand( Name )
+	( gl_renderer::traceFunction( Name, glTraceSite( #Name ), ##__VA_ARGS__ ) )
+#	define glLogCommand( Name )\
+	gl_renderer::traceCommand( glTraceSite( Name ) )
 #	else
 #	define glLogCall( Name, ... )\
-	( Name( __VA_ARGS__ ) );\
+	( gl_renderer::traceFunction( Name, glTraceSite( #Name ), ##__VA_ARGS__ ) );\
 	glCheckError( #Name )
-#	define glLogCommand( Name )
+#	define glLogCommand( Name )\
+	gl_renderer::traceCommand( glTraceSite( Name ) )
 #endif
 }
@@ -0,0 +1,74 @@
+/*
+This file belongs to GlRenderer.
+See LICENSE file in root folder.
+*/
+#pragma once
+
+#include <cstdint>
+
+namespace gl_renderer
+{
+	/**
+	*\brief
+	*	Le format binaire des traces d'appels OpenGL, partagé entre CallTracer et l'outil les lisant.
+	*\remarks
+	*	Un fichier de trace contient :
+	*	- un CallTraceHeader ;
+	*	- CallTraceHeader::siteCount sites : uint32_t ligne, uint32_t taille du nom, nom, uint32_t taille du fichier, fichier ;
+	*	- CallTraceHeader::recordCount enregistrements : les champs fixes d'un CallTraceRecord,
+	*	suivis de ses CallTraceRecord::count arguments.
+	*/
+	static uint32_t constexpr CallTraceMagic = 0x52544C47u; // "GLTR"
+	static uint32_t constexpr CallTraceVersion = 1u;
+	//! Le nombre maximal d'arguments enregistrés pour un appel (glCopyImageSubData en a 15).
+	static uint32_t constexpr CallTraceMaxArgs = 15u;
+	//! Le nombre de bits utilisés pour le type d'un argument, dans CallTraceRecord::types.
+	static uint32_t constexpr CallTraceArgTypeBits = 4u;
+
+	enum class CallTraceArgType
+		: uint8_t
+	{
+		eInt,
+		eUInt,
+		eFloat,
+		ePointer,
+	};
+
+	enum class CallTraceRecordKind
+		: uint8_t
+	{
+		//! Un appel OpenGL, via glLogCall.
+		eCall,
+		//! Le début de l'exécution d'une commande, via glLogCommand.
+		eCommand,
+		//! La fin d'une frame, le site est alors invalide.
+		eFrame,
+	};
+
+	struct CallTraceHeader
+	{
+		uint32_t magic;
+		uint32_t version;
+		uint32_t siteCount;
+		uint32_t recordCount;
+	};
+
+	struct CallTraceRecord
+	{
+		//! Le temps écoulé depuis l'activation de la trace, en nanosecondes.
+		uint64_t time;
+		//! L'indice du site d'appel.
+		uint32_t site;
+		CallTraceRecordKind kind;
+		//! Le nombre d'arguments.
+		uint8_t count;
+		uint16_t padding;
+		//! Les types des arguments, CallTraceArgTypeBits bits par argument.
+		uint64_t types;
+		//! Les arguments, les flottants étant stockés en double.
+		uint64_t args[CallTraceMaxArgs];
+	};
+	//! La taille des champs d'un CallTraceRecord précédant ses arguments.
+	static uint32_t constexpr CallTraceRecordHeaderSize = uint32_t( sizeof( CallTraceRecord ) - sizeof( uint64_t ) * CallTraceMaxArgs );
+	static uint32_t constexpr CallTraceInvalidSite = 0xFFFFFFFFu;
+}
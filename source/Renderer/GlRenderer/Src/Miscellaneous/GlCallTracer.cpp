@@ -0,0 +1,151 @@
+/*
+This file belongs to GlRenderer.
+See LICENSE file in root folder.
+*/
+#include "Miscellaneous/GlCallTracer.hpp"
+
+#include <fstream>
+#include <mutex>
+
+namespace gl_renderer
+{
+	namespace
+	{
+		struct CallSite
+		{
+			std::string name;
+			std::string file;
+			uint32_t line;
+		};
+
+		struct TraceState
+		{
+			std::mutex mutex;
+			std::vector< CallSite > sites;
+			std::vector< CallTraceRecord > records;
+			uint64_t next{ 0u };
+			std::chrono::high_resolution_clock::time_point start;
+		};
+
+		TraceState & getState()
+		{
+			static TraceState result;
+			return result;
+		}
+
+		template< typename T >
+		void doWrite( std::ofstream & file, T const & value )
+		{
+			file.write( reinterpret_cast< char const * >( &value ), sizeof( value ) );
+		}
+
+		void doWrite( std::ofstream & file, std::string const & value )
+		{
+			doWrite( file, uint32_t( value.size() ) );
+			file.write( value.data(), value.size() );
+		}
+	}
+
+	std::atomic< bool > CallTracer::m_enabled{ false };
+
+	void CallTracer::enable( uint32_t capacity )
+	{
+		auto & state = getState();
+		std::lock_guard< std::mutex > lock{ state.mutex };
+		m_enabled = false;
+		state.records.clear();
+		state.records.resize( std::max( capacity, 1u ) );
+		state.next = 0u;
+		state.start = std::chrono::high_resolution_clock::now();
+		m_enabled = true;
+	}
+
+	void CallTracer::disable()
+	{
+		m_enabled = false;
+	}
+
+	bool CallTracer::dump( std::string const & path )
+	{
+		auto & state = getState();
+		std::vector< CallSite > sites;
+		std::vector< CallTraceRecord > records;
+
+		{
+			// The snapshot is copied under the lock, oldest record first, the file is written outside.
+			std::lock_guard< std::mutex > lock{ state.mutex };
+			auto capacity = uint64_t( state.records.size() );
+			auto count = std::min( state.next, capacity );
+			sites = state.sites;
+			records.reserve( size_t( count ) );
+
+			for ( auto index = state.next - count; index < state.next; ++index )
+			{
+				records.push_back( state.records[index % capacity] );
+			}
+		}
+
+		std::ofstream file{ path, std::ios::binary };
+
+		if ( !file )
+		{
+			return false;
+		}
+
+		doWrite( file, CallTraceHeader
+			{
+				CallTraceMagic,
+				CallTraceVersion,
+				uint32_t( sites.size() ),
+				uint32_t( records.size() ),
+			} );
+
+		for ( auto & site : sites )
+		{
+			doWrite( file, site.line );
+			doWrite( file, site.name );
+			doWrite( file, site.file );
+		}
+
+		for ( auto & record : records )
+		{
+			file.write( reinterpret_cast< char const * >( &record ), CallTraceRecordHeaderSize );
+			file.write( reinterpret_cast< char const * >( record.args ), record.count * sizeof( uint64_t ) );
+		}
+
+		return bool( file );
+	}
+
+	uint32_t CallTracer::registerSite( char const * name
+		, char const * file
+		, uint32_t line )
+	{
+		auto & state = getState();
+		std::lock_guard< std::mutex > lock{ state.mutex };
+		state.sites.push_back( { name, file, line } );
+		return uint32_t( state.sites.size() - 1u );
+	}
+
+	void CallTracer::frame()
+	{
+		if ( isEnabled() )
+		{
+			record( CallTraceRecordKind::eFrame, CallTraceInvalidSite );
+		}
+	}
+
+	void CallTracer::doPush( CallTraceRecord & record )
+	{
+		auto & state = getState();
+		std::lock_guard< std::mutex > lock{ state.mutex };
+
+		// The trace may have been disabled, or enabled again with another capacity, since isEnabled() was checked.
+		if ( !m_enabled || state.records.empty() )
+		{
+			return;
+		}
+
+		record.time = uint64_t( std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::high_resolution_clock::now() - state.start ).count() );
+		state.records[state.next++ % state.records.size()] = record;
+	}
+}
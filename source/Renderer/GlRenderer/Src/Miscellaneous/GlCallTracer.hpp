@@ -0,0 +1,177 @@
+/*
+This file belongs to GlRenderer.
+See LICENSE file in root folder.
+*/
+#pragma once
+
+#include "Miscellaneous/GlCallTraceFormat.hpp"
+
+#include <Core/DeviceStatistics.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace gl_renderer
+{
+	/**
+	*\brief
+	*	Enregistre les appels OpenGL faits via glLogCall dans un anneau binaire, activable à l'exécution.
+	*\remarks
+	*	Chaque enregistrement est construit sur la pile puis copié dans l'anneau sous le verrou de la trace,
+	*	pour que enable() et dump() puissent être appelées depuis un autre thread que celui du contexte.
+	*	Lorsque l'anneau est plein, les enregistrements les plus anciens sont écrasés.
+	*	La trace est activée au démarrage si la variable d'environnement GLRENDERER_TRACE
+	*	est définie (sa valeur étant la capacité de l'anneau, en enregistrements), et est écrite
+	*	à la destruction du périphérique dans le fichier désigné par GLRENDERER_TRACE_FILE.
+	*/
+	class CallTracer
+	{
+	public:
+		//! La capacité par défaut de l'anneau.
+		static uint32_t constexpr DefaultCapacity = 65536u;
+		/**
+		*\brief
+		*	Active la trace, en vidant l'anneau.
+		*\param[in] capacity
+		*	Le nombre d'enregistrements de l'anneau.
+		*/
+		static void enable( uint32_t capacity = DefaultCapacity );
+		/**
+		*\brief
+		*	Désactive la trace, l'anneau reste disponible pour dump().
+		*/
+		static void disable();
+		/**
+		*\brief
+		*	Ecrit le contenu de l'anneau dans un fichier.
+		*\param[in] path
+		*	Le chemin du fichier.
+		*\return
+		*	\p false si le fichier n'a pas pu être écrit.
+		*/
+		static bool dump( std::string const & path );
+		/**
+		*\brief
+		*	Enregistre un site d'appel.
+		*\return
+		*	L'indice du site.
+		*/
+		static uint32_t registerSite( char const * name
+			, char const * file
+			, uint32_t line );
+		/**
+		*\brief
+		*	Marque la fin d'une frame.
+		*/
+		static void frame();
+
+		static inline bool isEnabled()
+		{
+			return m_enabled.load( std::memory_order_relaxed );
+		}
+
+		template< typename ... ParamsT >
+		static inline void record( CallTraceRecordKind kind
+			, uint32_t site
+			, ParamsT ... params )
+		{
+			static_assert( sizeof...( ParamsT ) <= CallTraceMaxArgs, "Too many arguments to trace" );
+			CallTraceRecord record;
+			record.site = site;
+			record.kind = kind;
+			record.count = uint8_t( sizeof...( ParamsT ) );
+			record.types = 0u;
+			uint32_t index = 0u;
+			int dummy[] = { 0, ( doEncode( record, index++, params ), 0 )... };
+			( void )dummy;
+			doPush( record );
+		}
+
+	private:
+		static void doPush( CallTraceRecord & record );
+
+		static inline void doSetArg( CallTraceRecord & record
+			, uint32_t index
+			, CallTraceArgType type
+			, uint64_t value )
+		{
+			record.types |= uint64_t( type ) << ( index * CallTraceArgTypeBits );
+			record.args[index] = value;
+		}
+
+		template< typename T >
+		static inline void doEncode( CallTraceRecord & record
+			, uint32_t index
+			, T value )
+		{
+			if constexpr ( std::is_pointer< T >::value )
+			{
+				doSetArg( record, index, CallTraceArgType::ePointer, uint64_t( reinterpret_cast< uintptr_t >( value ) ) );
+			}
+			else if constexpr ( std::is_same< T, std::nullptr_t >::value )
+			{
+				doSetArg( record, index, CallTraceArgType::ePointer, 0u );
+			}
+			else if constexpr ( std::is_floating_point< T >::value )
+			{
+				double converted = double( value );
+				uint64_t bits;
+				std::memcpy( &bits, &converted, sizeof( bits ) );
+				doSetArg( record, index, CallTraceArgType::eFloat, bits );
+			}
+			else if constexpr ( std::is_enum< T >::value )
+			{
+				doEncode( record, index, typename std::underlying_type< T >::type( value ) );
+			}
+			else if constexpr ( std::is_signed< T >::value )
+			{
+				doSetArg( record, index, CallTraceArgType::eInt, uint64_t( int64_t( value ) ) );
+			}
+			else
+			{
+				doSetArg( record, index, CallTraceArgType::eUInt, uint64_t( value ) );
+			}
+		}
+
+	private:
+		static std::atomic< bool > m_enabled;
+	};
+
+	template< typename FuncT, typename ... ParamsT >
+	inline auto traceFunction( FuncT function
+		, uint32_t site
+		, ParamsT ... params )
+	{
+		renderer::countStatistic( renderer::Statistic::eApiCall );
+
+		if ( CallTracer::isEnabled() )
+		{
+			CallTracer::record( CallTraceRecordKind::eCall, site, params... );
+		}
+
+		return function( params... );
+	}
+
+	inline void traceCommand( uint32_t site )
+	{
+		if ( CallTracer::isEnabled() )
+		{
+			CallTracer::record( CallTraceRecordKind::eCommand, site );
+		}
+	}
+}
+
+/**
+*\brief
+*	L'indice du site d'appel courant, enregistré lors du premier passage.
+*/
+#define glTraceSite( Name )\
+	[]()\
+	{\
+		static uint32_t const site = gl_renderer::CallTracer::registerSite( Name, __FILE__, __LINE__ );\
+		return site;\
+	}()
@@ -13,6 +13,10 @@
 
 #include <GL/gl.h>
 
+#if GLRENDERER_EGL
+#	include <EGL/egl.h>
+#endif
+
 //*************************************************************************************************
 
 namespace gl_api
@@ -33,6 +37,13 @@ namespace gl_api
 #if RENDERLIB_WIN32
 		p_func = reinterpret_cast< Func >( wglGetProcAddress( p_strName.c_str() ) );
 #elif RENDERLIB_XLIB
+#	if GLRENDERER_EGL
+		if ( eglGetCurrentContext() != EGL_NO_CONTEXT )
+		{
+			p_func = reinterpret_cast< Func >( eglGetProcAddress( p_strName.c_str() ) );
+			return p_func != NULL;
+		}
+#	endif
 		p_func = reinterpret_cast< Func >( glXGetProcAddress( ( GLubyte const * )p_strName.c_str() ) );
 #endif
 		return p_func != NULL;
@@ -20,48 +20,77 @@ namespace gl_renderer
 		glLogCall( gl::DeleteQueries, GLsizei( m_names.size() ), m_names.data() );
 	}
 
-	void QueryPool::getResults( uint32_t firstQuery
+	bool QueryPool::getResults( uint32_t firstQuery
 		, uint32_t queryCount
 		, uint32_t stride
 		, renderer::QueryResultFlags flags
 		, renderer::UInt32Array & data )const
 	{
-		assert( firstQuery + queryCount <= m_names.size() );
-		assert( queryCount == data.size() );
-		renderer::UInt64Array data64;
-		data64.resize( data.size() );
-		auto begin = m_names.begin() + firstQuery;
-		auto end = begin + queryCount;
-		auto * buffer = data64.data();
-
-		for ( auto it = begin; it != end; ++it )
-		{
-			glLogCall( gl::GetQueryObjectui64v, *it, convert( flags ), buffer );
-			++buffer;
-		}
-
-		for ( uint32_t i = 0; i < data64.size(); ++i )
-		{
-			data[i] = uint32_t( data64[i] );
-		}
+		return doGetResults( firstQuery
+			, queryCount
+			, stride
+			, flags
+			, data.data()
+			, data.size() );
 	}
 
-	void QueryPool::getResults( uint32_t firstQuery
+	bool QueryPool::getResults( uint32_t firstQuery
 		, uint32_t queryCount
 		, uint32_t stride
 		, renderer::QueryResultFlags flags
 		, renderer::UInt64Array & data )const
 	{
-		assert( firstQuery + queryCount < m_names.size() );
-		assert( queryCount == data.size() );
-		auto begin = m_names.begin() + firstQuery;
-		auto end = begin + queryCount;
-		auto * buffer = data.data();
+		return doGetResults( firstQuery
+			, queryCount
+			, stride
+			, flags
+			, data.data()
+			, data.size() );
+	}
 
-		for ( auto it = begin; it != end; ++it )
+	template< typename T >
+	bool QueryPool::doGetResults( uint32_t firstQuery
+		, uint32_t queryCount
+		, uint32_t stride
+		, renderer::QueryResultFlags flags
+		, T * data
+		, size_t size )const
+	{
+		auto wait = checkFlag( flags, renderer::QueryResultFlag::eWait );
+		auto withAvailability = checkFlag( flags, renderer::QueryResultFlag::eWithAvailability );
+		size_t step = stride
+			? stride / sizeof( T )
+			: ( withAvailability ? 2u : 1u );
+		assert( firstQuery + queryCount <= m_names.size() );
+		assert( !queryCount || ( queryCount - 1u ) * step + ( withAvailability ? 2u : 1u ) <= size );
+		auto result = true;
+
+		for ( uint32_t i = 0u; i < queryCount; ++i )
 		{
-			glLogCall( gl::GetQueryObjectui64v, *it, convert( flags ), buffer );
-			++buffer;
+			auto name = m_names[firstQuery + i];
+			GLuint64 available = GL_TRUE;
+
+			// Sans attente, la disponibilité est testée avant de lire le résultat, qui n'est alors jamais bloquant.
+			if ( !wait )
+			{
+				glLogCall( gl::GetQueryObjectui64v, name, GL_QUERY_RESULT_AVAILABLE, &available );
+			}
+
+			if ( available )
+			{
+				GLuint64 value = 0u;
+				glLogCall( gl::GetQueryObjectui64v, name, GL_QUERY_RESULT, &value );
+				data[i * step] = T( value );
+			}
+
+			if ( withAvailability )
+			{
+				data[i * step + 1u] = T( available );
+			}
+
+			result = result && available;
 		}
+
+		return result;
 	}
 }
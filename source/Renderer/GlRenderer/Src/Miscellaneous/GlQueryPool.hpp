@@ -62,7 +62,7 @@ namespace gl_renderer
 		/**
 		*\copydoc	renderer::QueryPool:getResults
 		*/
-		void getResults( uint32_t firstQuery
+		bool getResults( uint32_t firstQuery
 			, uint32_t queryCount
 			, uint32_t stride
 			, renderer::QueryResultFlags flags
@@ -70,7 +70,7 @@ namespace gl_renderer
 		/**
 		*\copydoc	renderer::QueryPool:getResults
 		*/
-		void getResults( uint32_t firstQuery
+		bool getResults( uint32_t firstQuery
 			, uint32_t queryCount
 			, uint32_t stride
 			, renderer::QueryResultFlags flags
@@ -92,6 +92,15 @@ namespace gl_renderer
 			return m_names.end();
 		}
 
+	private:
+		template< typename T >
+		bool doGetResults( uint32_t firstQuery
+			, uint32_t queryCount
+			, uint32_t stride
+			, renderer::QueryResultFlags flags
+			, T * data
+			, size_t size )const;
+
 	protected:
 		Device const & m_device;
 		std::vector< GLuint > m_names;
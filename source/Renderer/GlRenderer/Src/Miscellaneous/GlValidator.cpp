@@ -283,10 +283,14 @@ namespace gl_renderer
 			case renderer::PixelFormat::eRGBA32F:
 			case renderer::PixelFormat::eR8G8B8A8:
 			case renderer::PixelFormat::eB8G8R8A8:
+			case renderer::PixelFormat::eR8G8B8A8_SRGB:
+			case renderer::PixelFormat::eR10G10B10A2:
 				return rhs == renderer::PixelFormat::eRGBA16F
 					|| rhs == renderer::PixelFormat::eRGBA32F
 					|| rhs == renderer::PixelFormat::eR8G8B8A8
-					|| rhs == renderer::PixelFormat::eB8G8R8A8;
+					|| rhs == renderer::PixelFormat::eB8G8R8A8
+					|| rhs == renderer::PixelFormat::eR8G8B8A8_SRGB
+					|| rhs == renderer::PixelFormat::eR10G10B10A2;
 			default:
 				assert( false );
 				return false;
@@ -156,6 +156,7 @@ namespace gl_renderer
 	using PFN_glBlitFramebuffer = void ( GLAPIENTRY * )( GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter );
 	using PFN_glBufferStorage = void ( GLAPIENTRY * )( GLenum target, GLsizeiptr size, const void * data, GLbitfield flags );
 	using PFN_glCheckFramebufferStatus = GLenum( GLAPIENTRY * )( GLenum target );
+	using PFN_glCheckNamedFramebufferStatus = GLenum( GLAPIENTRY * )( GLuint framebuffer, GLenum target );
 	using PFN_glClear = void ( GLAPIENTRY * )( GLbitfield mask );
 	using PFN_glClearDepth = void ( GLAPIENTRY * )( GLdouble depth );
 	using PFN_glClearStencil = void ( GLAPIENTRY * )( GLint stencil );
@@ -171,11 +172,18 @@ namespace gl_renderer
 	using PFN_glCompressedTexSubImage1D = void ( GLAPIENTRY * )( GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const GLvoid * data );
 	using PFN_glCompressedTexSubImage2D = void ( GLAPIENTRY * )( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const GLvoid * data );
 	using PFN_glCompressedTexSubImage3D = void ( GLAPIENTRY * )( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const GLvoid * data );
+	using PFN_glCompressedTextureSubImage1D = void ( GLAPIENTRY * )( GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const GLvoid * data );
+	using PFN_glCompressedTextureSubImage2D = void ( GLAPIENTRY * )( GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const GLvoid * data );
+	using PFN_glCompressedTextureSubImage3D = void ( GLAPIENTRY * )( GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const GLvoid * data );
 	using PFN_glCopyBufferSubData = void ( GLAPIENTRY * )( GLenum readtarget, GLenum writetarget, GLintptr readoffset, GLintptr writeoffset, GLsizeiptr size );
 	using PFN_glCopyImageSubData = void ( GLAPIENTRY * )( GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth );
+	using PFN_glCopyNamedBufferSubData = void ( GLAPIENTRY * )( GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size );
+	using PFN_glCreateBuffers = void ( GLAPIENTRY * )( GLsizei n, GLuint * buffers );
+	using PFN_glCreateFramebuffers = void ( GLAPIENTRY * )( GLsizei n, GLuint * framebuffers );
 	using PFN_glCreateProgram = GLuint( GLAPIENTRY * )( void );
 	using PFN_glCreateShader = GLuint( GLAPIENTRY * )( GLenum type );
 	using PFN_glCreateShaderProgramv = GLuint( GLAPIENTRY * )( GLenum type, GLsizei count, const char ** strings );
+	using PFN_glCreateTextures = void ( GLAPIENTRY * )( GLenum target, GLsizei n, GLuint * textures );
 	using PFN_glCullFace = void ( GLAPIENTRY * )( GLenum mode );
 	using PFN_glDeleteBuffers = void ( GLAPIENTRY * )( GLsizei n, const GLuint * buffers );
 	using PFN_glDeleteFramebuffers = void ( GLAPIENTRY * )( GLsizei n, const GLuint* framebuffers );
@@ -204,7 +212,10 @@ namespace gl_renderer
 	using PFN_glEndQuery = void ( GLAPIENTRY * )( GLenum target );
 	using PFN_glFenceSync = GLsync( GLAPIENTRY * )( GLenum condition, GLbitfield flags );
 	using PFN_glFinish = void ( GLAPIENTRY * )();
+	using PFN_glFlush = void ( GLAPIENTRY * )();
 	using PFN_glFlushMappedBufferRange = void ( GLAPIENTRY * )( GLenum target, GLintptr offset, GLsizeiptr length );
+	using PFN_glFlushMappedNamedBufferRange = void ( GLAPIENTRY * )( GLuint buffer, GLintptr offset, GLsizeiptr length );
+	using PFN_glFramebufferTexture = void ( GLAPIENTRY * )( GLenum target, GLenum attachment, GLuint texture, GLint level );
 	using PFN_glFramebufferTexture1D = void ( GLAPIENTRY * )( GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level );
 	using PFN_glFramebufferTexture2D = void ( GLAPIENTRY * )( GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level );
 	using PFN_glFramebufferTexture3D = void ( GLAPIENTRY * )( GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint layer );
@@ -216,6 +227,7 @@ namespace gl_renderer
 	using PFN_glGenSamplers = void ( GLAPIENTRY * )( GLsizei count, GLuint * samplers );
 	using PFN_glGenTextures = void ( GLAPIENTRY * )( GLsizei n, GLuint * textures );
 	using PFN_glGenerateMipmap = void ( GLAPIENTRY * )( GLenum target );
+	using PFN_glGenerateTextureMipmap = void ( GLAPIENTRY * )( GLuint texture );
 	using PFN_glGenVertexArrays = void ( GLAPIENTRY * )( GLsizei n, GLuint * arrays );
 	using PFN_glGetError = GLenum( GLAPIENTRY * )( void );
 	using PFN_glGetFloatv = void ( GLAPIENTRY * )( GLenum pname, GLfloat * data );
@@ -236,14 +248,21 @@ namespace gl_renderer
 	using PFN_glGetTexLevelParameteriv = void ( GLAPIENTRY * )( GLenum target, GLint level, GLenum pname, GLint * params );
 	using PFN_glGetTexParameterfv = void ( GLAPIENTRY * )( GLenum target, GLenum pname, GLfloat * params );
 	using PFN_glGetTexParameteriv = void ( GLAPIENTRY * )( GLenum target, GLenum pname, GLint * params );
+	using PFN_glGetTextureParameteriv = void ( GLAPIENTRY * )( GLuint texture, GLenum pname, GLint * params );
+	using PFN_glGetTextureSubImage = void ( GLAPIENTRY * )( GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void * pixels );
 	using PFN_glInvalidateBufferSubData = void ( GLAPIENTRY * )( GLuint buffer, GLintptr offset, GLsizeiptr length );
 	using PFN_glLineWidth = void ( GLAPIENTRY * )( GLfloat width );
 	using PFN_glLinkProgram = void ( GLAPIENTRY * )( GLuint program );
 	using PFN_glLogicOp = void ( GLAPIENTRY * )( GLenum opcode );
 	using PFN_glMapBufferRange = void * ( GLAPIENTRY * )( GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access );
+	using PFN_glMapNamedBufferRange = void * ( GLAPIENTRY * )( GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access );
 	using PFN_glMemoryBarrier = void ( GLAPIENTRY * )( GLbitfield barriers );
 	using PFN_glMultiDrawArraysIndirect = void ( GLAPIENTRY * )( GLenum mode, const void * indirect, GLsizei drawcount, GLsizei stride );
+	using PFN_glMultiDrawArraysIndirectCountARB = void ( GLAPIENTRY * )( GLenum mode, const void * indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride );
 	using PFN_glMultiDrawElementsIndirect = void ( GLAPIENTRY * )( GLenum mode, GLenum type, const void * indirect, GLsizei drawcount, GLsizei stride );
+	using PFN_glMultiDrawElementsIndirectCountARB = void ( GLAPIENTRY * )( GLenum mode, GLenum type, const void * indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride );
+	using PFN_glNamedBufferStorage = void ( GLAPIENTRY * )( GLuint buffer, GLsizeiptr size, const void * data, GLbitfield flags );
+	using PFN_glNamedFramebufferTexture = void ( GLAPIENTRY * )( GLuint framebuffer, GLenum attachment, GLuint texture, GLint level );
 	using PFN_glPatchParameteri = void ( GLAPIENTRY * )( GLenum pname, GLint value );
 	using PFN_glPolygonMode = void ( GLAPIENTRY * )( GLenum face, GLenum mode );
 	using PFN_glPolygonOffsetClampEXT = void ( GLAPIENTRY * )( GLfloat factor, GLfloat units, GLfloat clamp );
@@ -271,11 +290,22 @@ namespace gl_renderer
 	using PFN_glTexSubImage1D = void ( GLAPIENTRY * )( GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels );
 	using PFN_glTexSubImage2D = void ( GLAPIENTRY * )( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels );
 	using PFN_glTexSubImage3D = void ( GLAPIENTRY * )( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels );
+	using PFN_glTextureBarrier = void ( GLAPIENTRY * )();
+	using PFN_glTextureBarrierNV = void ( GLAPIENTRY * )();
 	using PFN_glTexStorage1D = void ( GLAPIENTRY * )( GLenum target, GLsizei levels, GLenum internalformat, GLsizei width );
 	using PFN_glTexStorage2D = void ( GLAPIENTRY * )( GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height );
 	using PFN_glTexStorage2DMultisample = void ( GLAPIENTRY * )( GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations );
 	using PFN_glTexStorage3D = void ( GLAPIENTRY * )( GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth );
 	using PFN_glTexStorage3DMultisample = void ( GLAPIENTRY * )( GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations );
+	using PFN_glTextureParameteri = void ( GLAPIENTRY * )( GLuint texture, GLenum pname, GLint param );
+	using PFN_glTextureStorage1D = void ( GLAPIENTRY * )( GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width );
+	using PFN_glTextureStorage2D = void ( GLAPIENTRY * )( GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height );
+	using PFN_glTextureStorage2DMultisample = void ( GLAPIENTRY * )( GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations );
+	using PFN_glTextureStorage3D = void ( GLAPIENTRY * )( GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth );
+	using PFN_glTextureStorage3DMultisample = void ( GLAPIENTRY * )( GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations );
+	using PFN_glTextureSubImage1D = void ( GLAPIENTRY * )( GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void * pixels );
+	using PFN_glTextureSubImage2D = void ( GLAPIENTRY * )( GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void * pixels );
+	using PFN_glTextureSubImage3D = void ( GLAPIENTRY * )( GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void * pixels );
 	using PFN_glTextureView = void ( GLAPIENTRY * )( GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers );
 	using PFN_glUniform1fv = void ( GLAPIENTRY * )( GLint location, GLsizei count, const GLfloat* value );
 	using PFN_glUniform1iv = void ( GLAPIENTRY * )( GLint location, GLsizei count, const GLint* value );
@@ -293,6 +323,7 @@ namespace gl_renderer
 	using PFN_glUniformMatrix3fv = void ( GLAPIENTRY * )( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value );
 	using PFN_glUniformMatrix4fv = void ( GLAPIENTRY * )( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value );
 	using PFN_glUnmapBuffer = GLboolean( GLAPIENTRY * )( GLenum target );
+	using PFN_glUnmapNamedBuffer = GLboolean( GLAPIENTRY * )( GLuint buffer );
 	using PFN_glUseProgram = void ( GLAPIENTRY * )( GLuint program );
 	using PFN_glVertexAttribDivisor = void ( GLAPIENTRY * )( GLuint index, GLuint divisor );
 	using PFN_glVertexAttribIPointer = void ( GLAPIENTRY * )( GLuint index, GLint size, GLenum type, GLsizei stride, const void* pointer );
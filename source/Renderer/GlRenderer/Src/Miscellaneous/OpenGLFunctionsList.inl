@@ -22,6 +22,7 @@ GL_LIB_BASE_FUNCTION( Disable )
 GL_LIB_BASE_FUNCTION( DrawArrays )
 GL_LIB_BASE_FUNCTION( Enable )
 GL_LIB_BASE_FUNCTION( Finish )
+GL_LIB_BASE_FUNCTION( Flush )
 GL_LIB_BASE_FUNCTION( FrontFace )
 GL_LIB_BASE_FUNCTION( GenTextures )
 GL_LIB_BASE_FUNCTION( GetError )
@@ -101,6 +102,7 @@ GL_LIB_FUNCTION( EnableVertexAttribArray )
 GL_LIB_FUNCTION( EndQuery )
 GL_LIB_FUNCTION( FenceSync )
 GL_LIB_FUNCTION( FlushMappedBufferRange )
+GL_LIB_FUNCTION( FramebufferTexture )
 GL_LIB_FUNCTION( FramebufferTexture1D )
 GL_LIB_FUNCTION( FramebufferTexture2D )
 GL_LIB_FUNCTION( FramebufferTexture3D )
@@ -174,12 +176,41 @@ GL_LIB_FUNCTION( VertexAttribIPointer )
 #	define GL_LIB_FUNCTION_OPT( x )
 #endif
 
+GL_LIB_FUNCTION_OPT( CheckNamedFramebufferStatus )
 GL_LIB_FUNCTION_OPT( ClearTexImage )
+GL_LIB_FUNCTION_OPT( CompressedTextureSubImage1D )
+GL_LIB_FUNCTION_OPT( CompressedTextureSubImage2D )
+GL_LIB_FUNCTION_OPT( CompressedTextureSubImage3D )
+GL_LIB_FUNCTION_OPT( CopyNamedBufferSubData )
+GL_LIB_FUNCTION_OPT( CreateBuffers )
+GL_LIB_FUNCTION_OPT( CreateFramebuffers )
+GL_LIB_FUNCTION_OPT( CreateTextures )
 GL_LIB_FUNCTION_OPT( DispatchComputeIndirect )
+GL_LIB_FUNCTION_OPT( FlushMappedNamedBufferRange )
+GL_LIB_FUNCTION_OPT( GenerateTextureMipmap )
+GL_LIB_FUNCTION_OPT( GetTextureParameteriv )
+GL_LIB_FUNCTION_OPT( GetTextureSubImage )
+GL_LIB_FUNCTION_OPT( MapNamedBufferRange )
 GL_LIB_FUNCTION_OPT( MultiDrawArraysIndirect )
+GL_LIB_FUNCTION_OPT( MultiDrawArraysIndirectCountARB )
 GL_LIB_FUNCTION_OPT( MultiDrawElementsIndirect )
+GL_LIB_FUNCTION_OPT( MultiDrawElementsIndirectCountARB )
+GL_LIB_FUNCTION_OPT( NamedBufferStorage )
+GL_LIB_FUNCTION_OPT( NamedFramebufferTexture )
 GL_LIB_FUNCTION_OPT( ShaderBinary )
 GL_LIB_FUNCTION_OPT( SpecializeShader )
+GL_LIB_FUNCTION_OPT( TextureBarrier )
+GL_LIB_FUNCTION_OPT( TextureBarrierNV )
+GL_LIB_FUNCTION_OPT( TextureParameteri )
+GL_LIB_FUNCTION_OPT( TextureStorage1D )
+GL_LIB_FUNCTION_OPT( TextureStorage2D )
+GL_LIB_FUNCTION_OPT( TextureStorage2DMultisample )
+GL_LIB_FUNCTION_OPT( TextureStorage3D )
+GL_LIB_FUNCTION_OPT( TextureStorage3DMultisample )
+GL_LIB_FUNCTION_OPT( TextureSubImage1D )
+GL_LIB_FUNCTION_OPT( TextureSubImage2D )
+GL_LIB_FUNCTION_OPT( TextureSubImage3D )
+GL_LIB_FUNCTION_OPT( UnmapNamedBuffer )
 
 #undef GL_LIB_FUNCTION_OPT
 
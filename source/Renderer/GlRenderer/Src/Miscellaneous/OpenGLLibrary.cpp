@@ -20,6 +20,10 @@ See LICENSE file in root folder.
 
 #include <GL/gl.h>
 
+#if GLRENDERER_EGL
+#	include <EGL/egl.h>
+#endif
+
 #include <iostream>
 #include <stdexcept>
 
@@ -38,6 +42,14 @@ namespace gl_renderer
 		template< typename FuncT >
 		bool getFunction( char const * const name, FuncT & function )
 		{
+#	if GLRENDERER_EGL
+			// Avec un contexte EGL (headless) courant, les fonctions sont récupérées via EGL.
+			if ( eglGetCurrentContext() != EGL_NO_CONTEXT )
+			{
+				function = reinterpret_cast< FuncT >( eglGetProcAddress( name ) );
+				return function != nullptr;
+			}
+#	endif
 			function = reinterpret_cast< FuncT >( glXGetProcAddressARB( reinterpret_cast< GLubyte const * >( name ) ) );
 			return function != nullptr;
 		}
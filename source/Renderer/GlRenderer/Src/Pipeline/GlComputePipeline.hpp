@@ -54,6 +54,14 @@ namespace gl_renderer
 		}
 		/**
 		*\return
+		*	Le ShaderProgram.
+		*/
+		inline ShaderProgram const & getShaderProgram()const
+		{
+			return m_program;
+		}
+		/**
+		*\return
 		*	Le tampon de push constants correspondant aux constantes de spécialisation.
 		*/
 		inline std::vector< renderer::PushConstantsBufferBase > const & getConstantsPcbs()const
@@ -1,7 +1,6 @@
 #include "Pipeline/GlPipeline.hpp"
 
 #include "Buffer/GlBuffer.hpp"
-#include "Command/Commands/GlBindPipelineCommand.hpp"
 #include "Core/GlDevice.hpp"
 #include "Core/GlRenderer.hpp"
 #include "Core/GlRenderingResources.hpp"
@@ -107,22 +106,19 @@ namespace gl_renderer
 		, m_iaState{ m_createInfo.inputAssemblyState }
 		, m_cbState{ m_createInfo.colourBlendState }
 		, m_rsState{ m_createInfo.rasterisationState }
-		, m_dsState{ 0u, false, true, renderer::CompareOp::eLess,  }
+		, m_dsState{ m_createInfo.depthStencilState
+			? m_createInfo.depthStencilState.value()
+			: renderer::DepthStencilState{ 0u, false, true, renderer::CompareOp::eLess } }
+		, m_msState{ m_createInfo.multisampleState }
+		, m_tsState{ m_createInfo.tessellationState
+			? m_createInfo.tessellationState.value()
+			: renderer::TessellationState{} }
+		, m_stateBlock{ m_iaState, m_cbState, m_rsState, m_dsState, m_msState, m_tsState }
 		, m_viewport{ m_createInfo.viewport }
 		, m_scissor{ m_createInfo.scissor }
 		, m_vertexInputStateHash{ doHash( m_vertexInputState ) }
 		, m_program{ m_ssState }
 	{
-		if ( m_createInfo.depthStencilState )
-		{
-			m_dsState = m_createInfo.depthStencilState.value();
-		}
-
-		if ( m_createInfo.tessellationState )
-		{
-			m_tsState = m_createInfo.tessellationState.value();
-		}
-
 		for ( auto & stage : m_ssState )
 		{
 			if ( !static_cast< ShaderModule const & >( stage.getModule() ).isSpirV()
@@ -132,11 +128,6 @@ namespace gl_renderer
 			}
 		}
 
-		apply( m_device, m_cbState );
-		apply( m_device, m_rsState );
-		apply( m_device, m_dsState );
-		apply( m_device, m_msState );
-		apply( m_device, m_tsState );
 		m_program.link();
 
 		if ( m_device.getRenderer().isValidationEnabled() )
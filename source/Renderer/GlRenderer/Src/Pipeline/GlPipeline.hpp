@@ -9,6 +9,7 @@
 #pragma once
 
 #include "Buffer/GlGeometryBuffers.hpp"
+#include "Pipeline/GlPipelineStateBlock.hpp"
 #include "Shader/GlShaderProgram.hpp"
 
 #include <Buffer/PushConstantsBuffer.hpp>
@@ -124,6 +125,14 @@ namespace gl_renderer
 		}
 		/**
 		*\return
+		*	Les états fixes, convertis pour OpenGL.
+		*/
+		inline PipelineStateBlock const & getStateBlock()const
+		{
+			return m_stateBlock;
+		}
+		/**
+		*\return
 		*	Le VertexInputState.
 		*/
 		inline renderer::VertexInputState const & getVertexInputState()const
@@ -166,6 +175,14 @@ namespace gl_renderer
 		}
 		/**
 		*\return
+		*	Le ShaderProgram.
+		*/
+		inline ShaderProgram const & getShaderProgram()const
+		{
+			return m_program;
+		}
+		/**
+		*\return
 		*	Dit si le pipeline a des sommets.
 		*/
 		inline bool hasVertexLayout()const
@@ -202,6 +219,7 @@ namespace gl_renderer
 		renderer::DepthStencilState m_dsState;
 		renderer::MultisampleState m_msState;
 		renderer::TessellationState m_tsState;
+		PipelineStateBlock m_stateBlock;
 		std::optional< renderer::Viewport > m_viewport;
 		std::optional< renderer::Scissor > m_scissor;
 		std::vector< renderer::PushConstantsBufferBase > m_constantsPcbs;
@@ -0,0 +1,402 @@
+/*
+This file belongs to GlRenderer.
+See LICENSE file in root folder.
+*/
+#include "Pipeline/GlPipelineStateBlock.hpp"
+
+namespace gl_renderer
+{
+	namespace
+	{
+		struct CapabilityTweak
+		{
+			PipelineStateBlock::Capability capability;
+			GlTweak tweak;
+		};
+
+		static CapabilityTweak const CapabilityTweaks[]
+		{
+			{ PipelineStateBlock::eBlend, GL_BLEND },
+			{ PipelineStateBlock::eColourLogicOp, GL_COLOR_LOGIC_OP },
+			{ PipelineStateBlock::eCullFace, GL_CULL_FACE },
+			{ PipelineStateBlock::ePolygonOffsetFill, GL_POLYGON_OFFSET_FILL },
+			{ PipelineStateBlock::ePolygonOffsetLine, GL_POLYGON_OFFSET_LINE },
+			{ PipelineStateBlock::ePolygonOffsetPoint, GL_POLYGON_OFFSET_POINT },
+			{ PipelineStateBlock::eDepthClamp, GL_DEPTH_CLAMP },
+			{ PipelineStateBlock::eRasteriserDiscard, GL_RASTERIZER_DISCARD },
+			{ PipelineStateBlock::eDepthTest, GL_DEPTH_TEST },
+			{ PipelineStateBlock::eStencilTest, GL_STENCIL_TEST },
+			{ PipelineStateBlock::eMultisample, GL_MULTISAMPLE },
+			{ PipelineStateBlock::eSampleAlphaToCoverage, GL_SAMPLE_ALPHA_TO_COVERAGE },
+			{ PipelineStateBlock::eSampleAlphaToOne, GL_SAMPLE_ALPHA_TO_ONE },
+			{ PipelineStateBlock::ePrimitiveRestart, GL_PRIMITIVE_RESTART },
+			{ PipelineStateBlock::eProgramPointSize, GL_PROGRAM_POINT_SIZE },
+		};
+
+		PipelineStateBlock::StencilFace doConvert( renderer::StencilOpState const & state )
+		{
+			return PipelineStateBlock::StencilFace
+			{
+				convert( state.getCompareOp() ),
+				state.getReference(),
+				state.getCompareMask(),
+				state.getWriteMask(),
+				convert( state.getFailOp() ),
+				convert( state.getDepthFailOp() ),
+				convert( state.getPassOp() ),
+			};
+		}
+
+		uint32_t doApply( GlCullMode face
+			, PipelineStateBlock::StencilFace const & state )
+		{
+			glLogCall( gl::StencilMaskSeparate
+				, face
+				, state.writeMask );
+			glLogCall( gl::StencilFuncSeparate
+				, face
+				, state.compareOp
+				, state.reference
+				, state.compareMask );
+			glLogCall( gl::StencilOpSeparate
+				, face
+				, state.failOp
+				, state.depthFailOp
+				, state.passOp );
+			return 3u;
+		}
+	}
+
+	PipelineStateBlock::PipelineStateBlock( renderer::InputAssemblyState const & iaState
+		, renderer::ColourBlendState const & cbState
+		, renderer::RasterisationState const & rsState
+		, renderer::DepthStencilState const & dsState
+		, renderer::MultisampleState const & msState
+		, renderer::TessellationState const & tsState )
+		: capabilities{ 0u }
+		, blendAttachments{ 0u }
+		, attachments{}
+		, blendConstants{ cbState.getBlendConstants() }
+		, logicOp{ convert( cbState.getLogicOp() ) }
+		, cullMode{ convert( rsState.getCullMode() ) }
+		, frontFace{ convert( rsState.getFrontFace() ) }
+		, polygonMode{ convert( rsState.getPolygonMode() ) }
+		, depthBiasConstantFactor{ rsState.getDepthBiasConstantFactor() }
+		, depthBiasSlopeFactor{ rsState.getDepthBiasSlopeFactor() }
+		, depthBiasClamp{ rsState.getDepthBiasClamp() }
+		, lineWidth{ rsState.hasLineWidth() ? rsState.getLineWidth() : 0.0f }
+		, depthCompareOp{ convert( dsState.getDepthCompareOp() ) }
+		, stencilFront{ doConvert( dsState.getFrontStencilOp() ) }
+		, stencilBack{ doConvert( dsState.getBackStencilOp() ) }
+		, minDepthBounds{ dsState.getMinDepthBounds() }
+		, maxDepthBounds{ dsState.getMaxDepthBounds() }
+		, patchControlPoints{ tsState.getControlPoints() }
+	{
+		uint32_t index = 0u;
+
+		for ( auto & blendState : cbState )
+		{
+			if ( index < MaxBlendAttachments
+				&& blendState.isBlendEnabled() )
+			{
+				blendAttachments |= 1u << index;
+				attachments[index] = BlendAttachment
+				{
+					convert( blendState.getColourBlendOp() ),
+					convert( blendState.getAlphaBlendOp() ),
+					convert( blendState.getSrcColourBlendFactor() ),
+					convert( blendState.getDstColourBlendFactor() ),
+					convert( blendState.getSrcAlphaBlendFactor() ),
+					convert( blendState.getDstAlphaBlendFactor() ),
+				};
+			}
+
+			++index;
+		}
+
+		if ( blendAttachments )
+		{
+			capabilities |= eBlend;
+		}
+
+		if ( cbState.isLogicOpEnabled() )
+		{
+			capabilities |= eColourLogicOp;
+		}
+
+		if ( rsState.getCullMode() != renderer::CullModeFlag::eNone )
+		{
+			capabilities |= eCullFace;
+		}
+
+		if ( rsState.isDepthBiasEnabled() )
+		{
+			switch ( rsState.getPolygonMode() )
+			{
+			case renderer::PolygonMode::eFill:
+				capabilities |= ePolygonOffsetFill;
+				break;
+
+			case renderer::PolygonMode::eLine:
+				capabilities |= ePolygonOffsetLine;
+				break;
+
+			case renderer::PolygonMode::ePoint:
+				capabilities |= ePolygonOffsetPoint;
+				break;
+			}
+		}
+
+		if ( rsState.isDepthClampEnabled()
+			|| dsState.isDepthBoundsTestEnabled() )
+		{
+			capabilities |= eDepthClamp;
+		}
+
+		if ( dsState.isDepthBoundsTestEnabled() )
+		{
+			capabilities |= eDepthBounds;
+		}
+
+		if ( rsState.isRasteriserDiscardEnabled() )
+		{
+			capabilities |= eRasteriserDiscard;
+		}
+
+		if ( dsState.isDepthTestEnabled() )
+		{
+			capabilities |= eDepthTest;
+		}
+
+		if ( dsState.isDepthWriteEnabled() )
+		{
+			capabilities |= eDepthWrite;
+		}
+
+		if ( dsState.isStencilTestEnabled() )
+		{
+			capabilities |= eStencilTest;
+		}
+
+		if ( msState.getRasterisationSamples() != renderer::SampleCountFlag::e1 )
+		{
+			capabilities |= eMultisample;
+
+			if ( msState.isAlphaToCoverageEnabled() )
+			{
+				capabilities |= eSampleAlphaToCoverage;
+			}
+
+			if ( msState.isAlphaToOneEnabled() )
+			{
+				capabilities |= eSampleAlphaToOne;
+			}
+		}
+
+		if ( iaState.isPrimitiveRestartEnabled() )
+		{
+			capabilities |= ePrimitiveRestart;
+		}
+
+		if ( iaState.getTopology() == renderer::PrimitiveTopology::ePointList )
+		{
+			capabilities |= eProgramPointSize;
+		}
+	}
+
+	uint32_t apply( PipelineStateBlock const & state
+		, PipelineStateBlock & current
+		, bool force )
+	{
+		uint32_t result = 0u;
+		uint32_t changed = force
+			? uint32_t( PipelineStateBlock::eAllCapabilities )
+			: state.capabilities ^ current.capabilities;
+
+		if ( changed )
+		{
+			for ( auto & capabilityTweak : CapabilityTweaks )
+			{
+				if ( changed & capabilityTweak.capability )
+				{
+					if ( state.capabilities & capabilityTweak.capability )
+					{
+						glLogCall( gl::Enable, capabilityTweak.tweak );
+					}
+					else
+					{
+						glLogCall( gl::Disable, capabilityTweak.tweak );
+					}
+
+					++result;
+				}
+			}
+
+			if ( changed & PipelineStateBlock::eDepthWrite )
+			{
+				if ( state.capabilities & PipelineStateBlock::eDepthWrite )
+				{
+					glLogCall( gl::DepthMask, GL_TRUE );
+				}
+				else
+				{
+					glLogCall( gl::DepthMask, GL_FALSE );
+				}
+
+				++result;
+			}
+
+			current.capabilities = state.capabilities;
+		}
+
+		// The values are only emitted when their capability is enabled,
+		// the current ones are thus kept for the next pipeline enabling it.
+		if ( state.capabilities & PipelineStateBlock::eBlend )
+		{
+			if ( force || state.blendConstants != current.blendConstants )
+			{
+				glLogCall( gl::BlendColor
+					, state.blendConstants[0]
+					, state.blendConstants[1]
+					, state.blendConstants[2]
+					, state.blendConstants[3] );
+				current.blendConstants = state.blendConstants;
+				++result;
+			}
+
+			for ( GLuint buf = 0u; buf < PipelineStateBlock::MaxBlendAttachments; ++buf )
+			{
+				uint32_t bit = 1u << buf;
+
+				if ( ( state.blendAttachments & bit )
+					&& ( force
+						|| !( current.blendAttachments & bit )
+						|| state.attachments[buf] != current.attachments[buf] ) )
+				{
+					auto & attachment = state.attachments[buf];
+					glLogCall( gl::BlendEquationSeparatei
+						, buf
+						, attachment.colourOp
+						, attachment.alphaOp );
+					glLogCall( gl::BlendFuncSeparatei
+						, buf
+						, attachment.srcColour
+						, attachment.dstColour
+						, attachment.srcAlpha
+						, attachment.dstAlpha );
+					current.blendAttachments |= bit;
+					current.attachments[buf] = attachment;
+					result += 2u;
+				}
+			}
+		}
+
+		if ( ( state.capabilities & PipelineStateBlock::eColourLogicOp )
+			&& ( force || state.logicOp != current.logicOp ) )
+		{
+			glLogCall( gl::LogicOp, state.logicOp );
+			current.logicOp = state.logicOp;
+			++result;
+		}
+
+		if ( state.capabilities & PipelineStateBlock::eCullFace )
+		{
+			if ( force || state.cullMode != current.cullMode )
+			{
+				glLogCall( gl::CullFace, state.cullMode );
+				current.cullMode = state.cullMode;
+				++result;
+			}
+
+			if ( force || state.frontFace != current.frontFace )
+			{
+				glLogCall( gl::FrontFace, state.frontFace );
+				current.frontFace = state.frontFace;
+				++result;
+			}
+		}
+
+		if ( force || state.polygonMode != current.polygonMode )
+		{
+			glLogCall( gl::PolygonMode
+				, GL_CULL_MODE_FRONT_AND_BACK
+				, state.polygonMode );
+			current.polygonMode = state.polygonMode;
+			++result;
+		}
+
+		if ( ( state.capabilities & ( PipelineStateBlock::ePolygonOffsetFill
+				| PipelineStateBlock::ePolygonOffsetLine
+				| PipelineStateBlock::ePolygonOffsetPoint ) )
+			&& ( force
+				|| state.depthBiasConstantFactor != current.depthBiasConstantFactor
+				|| state.depthBiasSlopeFactor != current.depthBiasSlopeFactor
+				|| state.depthBiasClamp != current.depthBiasClamp ) )
+		{
+			glLogCall( gl::PolygonOffsetClampEXT
+				, state.depthBiasConstantFactor
+				, state.depthBiasSlopeFactor
+				, state.depthBiasClamp );
+			current.depthBiasConstantFactor = state.depthBiasConstantFactor;
+			current.depthBiasSlopeFactor = state.depthBiasSlopeFactor;
+			current.depthBiasClamp = state.depthBiasClamp;
+			++result;
+		}
+
+		if ( state.lineWidth != 0.0f
+			&& ( force || state.lineWidth != current.lineWidth ) )
+		{
+			glLogCall( gl::LineWidth, state.lineWidth );
+			current.lineWidth = state.lineWidth;
+			++result;
+		}
+
+		if ( ( state.capabilities & PipelineStateBlock::eDepthTest )
+			&& ( force || state.depthCompareOp != current.depthCompareOp ) )
+		{
+			glLogCall( gl::DepthFunc, state.depthCompareOp );
+			current.depthCompareOp = state.depthCompareOp;
+			++result;
+		}
+
+		if ( state.capabilities & PipelineStateBlock::eStencilTest )
+		{
+			if ( force || state.stencilBack != current.stencilBack )
+			{
+				result += doApply( GL_CULL_MODE_BACK, state.stencilBack );
+				current.stencilBack = state.stencilBack;
+			}
+
+			if ( force || state.stencilFront != current.stencilFront )
+			{
+				result += doApply( GL_CULL_MODE_FRONT, state.stencilFront );
+				current.stencilFront = state.stencilFront;
+			}
+		}
+
+		if ( ( state.capabilities & PipelineStateBlock::eDepthBounds )
+			&& ( force
+				|| state.minDepthBounds != current.minDepthBounds
+				|| state.maxDepthBounds != current.maxDepthBounds ) )
+		{
+			glLogCall( gl::DepthRange
+				, state.minDepthBounds
+				, state.maxDepthBounds );
+			current.minDepthBounds = state.minDepthBounds;
+			current.maxDepthBounds = state.maxDepthBounds;
+			++result;
+		}
+
+		if ( state.patchControlPoints
+			&& ( force || state.patchControlPoints != current.patchControlPoints ) )
+		{
+			glLogCall( gl::PatchParameteri
+				, GL_PATCH_VERTICES
+				, int( state.patchControlPoints ) );
+			current.patchControlPoints = state.patchControlPoints;
+			++result;
+		}
+
+		return result;
+	}
+}
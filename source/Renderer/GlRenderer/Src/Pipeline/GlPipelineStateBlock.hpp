@@ -0,0 +1,154 @@
+/*
+This file belongs to GlRenderer.
+See LICENSE file in root folder.
+*/
+#pragma once
+
+#include "GlRendererPrerequisites.hpp"
+
+#include <Pipeline/ColourBlendState.hpp>
+#include <Pipeline/DepthStencilState.hpp>
+#include <Pipeline/InputAssemblyState.hpp>
+#include <Pipeline/MultisampleState.hpp>
+#include <Pipeline/RasterisationState.hpp>
+#include <Pipeline/TessellationState.hpp>
+
+#include <array>
+
+namespace gl_renderer
+{
+	/**
+	*\brief
+	*	Les états fixes d'un pipeline, convertis une fois pour toutes en valeurs OpenGL.
+	*\remarks
+	*	Les capacités activées (glEnable/glDisable) sont regroupées dans un masque de bits,
+	*	afin que l'activation d'un pipeline puisse trouver celles qui changent via un simple XOR.
+	*/
+	struct PipelineStateBlock
+	{
+		enum Capability
+			: uint32_t
+		{
+			eBlend = 0x00000001,
+			eColourLogicOp = 0x00000002,
+			eCullFace = 0x00000004,
+			ePolygonOffsetFill = 0x00000008,
+			ePolygonOffsetLine = 0x00000010,
+			ePolygonOffsetPoint = 0x00000020,
+			eDepthClamp = 0x00000040,
+			eRasteriserDiscard = 0x00000080,
+			eDepthTest = 0x00000100,
+			eDepthWrite = 0x00000200,
+			eStencilTest = 0x00000400,
+			eMultisample = 0x00000800,
+			eSampleAlphaToCoverage = 0x00001000,
+			eSampleAlphaToOne = 0x00002000,
+			ePrimitiveRestart = 0x00004000,
+			eProgramPointSize = 0x00008000,
+			//! Pas une capacité OpenGL, dit si DepthRange doit recevoir les bornes du test de profondeur.
+			eDepthBounds = 0x00010000,
+			eAllCapabilities = 0x0001FFFF,
+		};
+		//! Le nombre maximal d'attaches couleur dont le mélange est suivi.
+		static uint32_t constexpr MaxBlendAttachments = 8u;
+
+		struct BlendAttachment
+		{
+			GlBlendOp colourOp;
+			GlBlendOp alphaOp;
+			GlBlendFactor srcColour;
+			GlBlendFactor dstColour;
+			GlBlendFactor srcAlpha;
+			GlBlendFactor dstAlpha;
+		};
+
+		struct StencilFace
+		{
+			GlCompareOp compareOp;
+			uint32_t reference;
+			uint32_t compareMask;
+			uint32_t writeMask;
+			GlStencilOp failOp;
+			GlStencilOp depthFailOp;
+			GlStencilOp passOp;
+		};
+		/**
+		*\brief
+		*	Constructeur, convertit les états donnés.
+		*/
+		PipelineStateBlock( renderer::InputAssemblyState const & iaState
+			, renderer::ColourBlendState const & cbState
+			, renderer::RasterisationState const & rsState
+			, renderer::DepthStencilState const & dsState
+			, renderer::MultisampleState const & msState
+			, renderer::TessellationState const & tsState );
+
+		//! Les capacités activées, combinaison de Capability.
+		uint32_t capabilities;
+		//! Les attaches ayant le mélange activé, un bit par attache.
+		uint32_t blendAttachments;
+		std::array< BlendAttachment, MaxBlendAttachments > attachments;
+		renderer::Vec4 blendConstants;
+		GlLogicOp logicOp;
+		GlCullMode cullMode;
+		GlFrontFace frontFace;
+		GlPolygonMode polygonMode;
+		float depthBiasConstantFactor;
+		float depthBiasSlopeFactor;
+		float depthBiasClamp;
+		//! 0 si la largeur des lignes est dynamique.
+		float lineWidth;
+		GlCompareOp depthCompareOp;
+		StencilFace stencilFront;
+		StencilFace stencilBack;
+		float minDepthBounds;
+		float maxDepthBounds;
+		uint32_t patchControlPoints;
+	};
+
+	inline bool operator==( PipelineStateBlock::BlendAttachment const & lhs, PipelineStateBlock::BlendAttachment const & rhs )
+	{
+		return lhs.colourOp == rhs.colourOp
+			&& lhs.alphaOp == rhs.alphaOp
+			&& lhs.srcColour == rhs.srcColour
+			&& lhs.dstColour == rhs.dstColour
+			&& lhs.srcAlpha == rhs.srcAlpha
+			&& lhs.dstAlpha == rhs.dstAlpha;
+	}
+
+	inline bool operator!=( PipelineStateBlock::BlendAttachment const & lhs, PipelineStateBlock::BlendAttachment const & rhs )
+	{
+		return !( lhs == rhs );
+	}
+
+	inline bool operator==( PipelineStateBlock::StencilFace const & lhs, PipelineStateBlock::StencilFace const & rhs )
+	{
+		return lhs.compareOp == rhs.compareOp
+			&& lhs.reference == rhs.reference
+			&& lhs.compareMask == rhs.compareMask
+			&& lhs.writeMask == rhs.writeMask
+			&& lhs.failOp == rhs.failOp
+			&& lhs.depthFailOp == rhs.depthFailOp
+			&& lhs.passOp == rhs.passOp;
+	}
+
+	inline bool operator!=( PipelineStateBlock::StencilFace const & lhs, PipelineStateBlock::StencilFace const & rhs )
+	{
+		return !( lhs == rhs );
+	}
+	/**
+	*\brief
+	*	Applique les états d'un pipeline, en n'émettant que les appels OpenGL pour ce qui diffère des états courants.
+	*\param[in] state
+	*	Les états à appliquer.
+	*\param[in,out] current
+	*	Les états courants du contexte, mis à jour.
+	*\param[in] force
+	*	\p true pour émettre tous les appels, quels que soient les états courants.
+	*\return
+	*	Le nombre d'appels OpenGL émis.
+	*/
+	uint32_t apply( PipelineStateBlock const & state
+		, PipelineStateBlock & current
+		, bool force );
+}
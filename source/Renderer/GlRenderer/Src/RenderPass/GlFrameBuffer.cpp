@@ -5,6 +5,7 @@ See LICENSE file in root folder.
 #include "RenderPass/GlFrameBuffer.hpp"
 
 #include "Command/GlQueue.hpp"
+#include "Core/GlDevice.hpp"
 #include "RenderPass/GlRenderPass.hpp"
 #include "Image/GlTexture.hpp"
 #include "Image/GlTextureView.hpp"
@@ -153,8 +154,17 @@ namespace gl_renderer
 		, renderer::FrameBufferAttachmentArray && views )
 		: renderer::FrameBuffer{ renderPass, dimensions, std::move( views ) }
 	{
-		glLogCall( gl::GenFramebuffers, 1, &m_frameBuffer );
-		glLogCall( gl::BindFramebuffer, GL_FRAMEBUFFER, m_frameBuffer );
+		bool directStateAccess = static_cast< RenderPass const & >( renderPass ).getDevice().hasDirectStateAccess();
+
+		if ( directStateAccess )
+		{
+			glLogCall( gl::CreateFramebuffers, 1, &m_frameBuffer );
+		}
+		else
+		{
+			glLogCall( gl::GenFramebuffers, 1, &m_frameBuffer );
+			glLogCall( gl::BindFramebuffer, GL_FRAMEBUFFER, m_frameBuffer );
+		}
 
 		for ( auto & attach : m_attachments )
 		{
@@ -181,17 +191,48 @@ namespace gl_renderer
 				m_colourAttaches.push_back( attachment );
 			}
 
-			glLogCall( gl::FramebufferTexture2D
-				, GL_FRAMEBUFFER
-				, GlAttachmentPoint( attachment.point + index )
-				, GL_TEXTURE_2D
-				, attachment.object
-				, attach.getView().getSubResourceRange().getBaseMipLevel() );
-			doCheck( gl::CheckFramebufferStatus( GL_FRAMEBUFFER ) );
+			// Layered attachments select their layer through gl_Layer.
+			bool layered = attach.getView().getSubResourceRange().getLayerCount() > 1u;
+			GLint level = layered
+				? 0
+				: GLint( attach.getView().getSubResourceRange().getBaseMipLevel() );
+
+			if ( directStateAccess )
+			{
+				glLogCall( gl::NamedFramebufferTexture
+					, m_frameBuffer
+					, GlAttachmentPoint( attachment.point + index )
+					, attachment.object
+					, level );
+			}
+			else if ( layered )
+			{
+				glLogCall( gl::FramebufferTexture
+					, GL_FRAMEBUFFER
+					, GlAttachmentPoint( attachment.point + index )
+					, attachment.object
+					, level );
+			}
+			else
+			{
+				glLogCall( gl::FramebufferTexture2D
+					, GL_FRAMEBUFFER
+					, GlAttachmentPoint( attachment.point + index )
+					, GL_TEXTURE_2D
+					, attachment.object
+					, level );
+			}
 		}
 
-		doCheck( gl::CheckFramebufferStatus( GL_FRAMEBUFFER ) );
-		glLogCall( gl::BindFramebuffer, GL_FRAMEBUFFER, 0 );
+		if ( directStateAccess )
+		{
+			doCheck( gl::CheckNamedFramebufferStatus( m_frameBuffer, GL_FRAMEBUFFER ) );
+		}
+		else
+		{
+			doCheck( gl::CheckFramebufferStatus( GL_FRAMEBUFFER ) );
+			glLogCall( gl::BindFramebuffer, GL_FRAMEBUFFER, 0 );
+		}
 	}
 
 	FrameBuffer::~FrameBuffer()
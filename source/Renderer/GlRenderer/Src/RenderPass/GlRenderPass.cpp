@@ -37,6 +37,7 @@ namespace gl_renderer
 			, std::move( subpasses )
 			, initialState
 			, finalState }
+		, m_device{ static_cast< Device const & >( device ) }
 		, m_subpasses{ doConvert( renderer::RenderPass::getSubpasses() ) }
 	{
 	}
@@ -30,7 +30,13 @@ namespace gl_renderer
 			return m_subpasses;
 		}
 
+		inline Device const & getDevice()const
+		{
+			return m_device;
+		}
+
 	private:
+		Device const & m_device;
 		RenderSubpassCRefArray m_subpasses;
 	};
 }
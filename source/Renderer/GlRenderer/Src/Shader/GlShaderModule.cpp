@@ -5,9 +5,14 @@ See LICENSE file in root folder.
 #include "Shader/GlShaderModule.hpp"
 
 #include "Core/GlDevice.hpp"
+#include "Buffer/GlPushConstantsRing.hpp"
 #include "Core/GlPhysicalDevice.hpp"
 
+#include <cctype>
 #include <iostream>
+#include <regex>
+#include <set>
+#include <sstream>
 
 namespace gl_renderer
 {
@@ -58,6 +63,210 @@ namespace gl_renderer
 
 			return compiled;
 		}
+
+		struct UniformPushConstant
+		{
+			size_t begin;
+			size_t end;
+			uint32_t location;
+			std::string type;
+			std::string name;
+			uint32_t arraySize;
+		};
+
+		std::vector< UniformPushConstant > doListUniformPushConstants( std::string const & shader )
+		{
+			static std::regex const regex{ R"(layout\s*\(\s*location\s*=\s*(\d+)\s*\)\s*uniform\s+(float|int|uint|[iu]?vec[234]|mat[234])\s+(\w+)\s*(?:\[\s*(\d+)\s*\])?\s*;)" };
+			std::vector< UniformPushConstant > result;
+
+			for ( auto it = std::sregex_iterator{ shader.begin(), shader.end(), regex }; it != std::sregex_iterator{}; ++it )
+			{
+				auto & match = *it;
+				result.push_back( UniformPushConstant
+					{
+						size_t( match.position( 0 ) ),
+						size_t( match.position( 0 ) + match.length( 0 ) ),
+						uint32_t( std::stoul( match[1].str() ) ),
+						match[2].str(),
+						match[3].str(),
+						match[4].matched
+							? uint32_t( std::stoul( match[4].str() ) )
+							: 1u,
+					} );
+			}
+
+			return result;
+		}
+
+		uint32_t doGetShaderVersion( std::string const & shader )
+		{
+			static std::regex const regex{ R"(#\s*version\s+(\d+))" };
+			std::smatch match;
+
+			if ( std::regex_search( shader, match, regex ) )
+			{
+				return uint32_t( std::stoul( match[1].str() ) );
+			}
+
+			return 110u;
+		}
+
+		bool doHasDirective( std::string::const_iterator begin
+			, std::string::const_iterator end )
+		{
+			static std::regex const regex{ R"(\n[ \t]*#)" };
+			return std::regex_search( begin, end, regex );
+		}
+
+		bool isIdentifierStart( char c )
+		{
+			return std::isalpha( static_cast< unsigned char >( c ) ) || c == '_';
+		}
+
+		bool isIdentifierPart( char c )
+		{
+			return std::isalnum( static_cast< unsigned char >( c ) ) || c == '_';
+		}
+
+		// Replaces the uses of the push constants with the block's members, token by token.
+		// The members accesses, the structures members and the comments are left untouched.
+		// Returns false if another declaration, or a macro, uses one of the push constants names:
+		// it would shadow the push constant, so that the rename would break the shader.
+		bool doRenamePushConstants( std::string const & source
+			, std::set< std::string > const & names
+			, std::string const & instance
+			, std::string & result )
+		{
+			static std::set< std::string > const keywords{ "return", "else", "case" };
+			// The previous significant token, and for each opened brace, if it opens a structure.
+			std::string previous;
+			std::vector< bool > structScopes;
+			bool structPending = false;
+			// In a preprocessor directive, its name, once read.
+			bool directive = false;
+			std::string directiveName;
+			size_t index = 0u;
+
+			while ( index < source.size() )
+			{
+				auto c = source[index];
+				auto next = index + 1u < source.size()
+					? source[index + 1u]
+					: '\0';
+				size_t end = index + 1u;
+
+				if ( c == '/' && next == '/' )
+				{
+					end = std::min( source.find( '\n', index ), source.size() );
+				}
+				else if ( c == '/' && next == '*' )
+				{
+					end = source.find( "*/", index + 2u );
+					end = end == std::string::npos
+						? source.size()
+						: end + 2u;
+				}
+				else if ( isIdentifierStart( c ) )
+				{
+					while ( end < source.size() && isIdentifierPart( source[end] ) )
+					{
+						++end;
+					}
+
+					auto token = source.substr( index, end - index );
+
+					if ( directive && directiveName.empty() )
+					{
+						directiveName = token;
+						result += token;
+					}
+					else if ( names.find( token ) == names.end()
+						|| previous == "." )
+					{
+						result += token;
+					}
+					else if ( directive )
+					{
+						// Only the macros bodies can use the push constants, not the macros names
+						// or the conditions, which test macros.
+						if ( directiveName != "define"
+							|| previous == "define" )
+						{
+							return false;
+						}
+
+						result += instance + "." + token;
+					}
+					else if ( isIdentifierStart( previous.empty() ? '\0' : previous[0] )
+						&& keywords.find( previous ) == keywords.end() )
+					{
+						// A declaration, following its type or qualifier.
+						if ( structScopes.empty() || !structScopes.back() )
+						{
+							return false;
+						}
+
+						result += token;
+					}
+					else
+					{
+						result += instance + "." + token;
+					}
+
+					structPending = structPending || token == "struct";
+					previous = token;
+					index = end;
+					continue;
+				}
+				else if ( std::isdigit( static_cast< unsigned char >( c ) ) )
+				{
+					while ( end < source.size() && ( isIdentifierPart( source[end] ) || source[end] == '.' ) )
+					{
+						++end;
+					}
+
+					previous = source.substr( index, end - index );
+				}
+				else if ( c == '\n' )
+				{
+					// A directive goes on after a line continuation.
+					directive = directive && index > 0u && source[index - 1u] == '\\';
+
+					if ( !directive )
+					{
+						previous.clear();
+						directiveName.clear();
+					}
+				}
+				else if ( c == '#' && previous.empty() && !directive )
+				{
+					directive = true;
+				}
+				else if ( !std::isspace( static_cast< unsigned char >( c ) ) )
+				{
+					if ( c == '{' )
+					{
+						structScopes.push_back( structPending );
+						structPending = false;
+					}
+					else if ( c == '}' && !structScopes.empty() )
+					{
+						structScopes.pop_back();
+					}
+					else if ( c == ';' )
+					{
+						structPending = false;
+					}
+
+					previous = std::string( 1u, c );
+				}
+
+				result.append( source, index, end - index );
+				index = end;
+			}
+
+			return true;
+		}
 	}
 
 	ShaderModule::ShaderModule( Device const & device
@@ -74,8 +283,9 @@ namespace gl_renderer
 		// Shader object is destroyed by the ShaderProgram.
 	}
 
-	void ShaderModule::loadShader( std::string const & shader )
+	void ShaderModule::loadShader( std::string const & source )
 	{
+		auto shader = doRewritePushConstants( source );
 		auto length = int( shader.size() );
 		auto data = shader.data();
 		glLogCall( gl::ShaderSource, m_shader, 1, &data, &length );
@@ -99,4 +309,91 @@ namespace gl_renderer
 		gl::ShaderBinary( 1u, &m_shader, GL_SHADER_BINARY_FORMAT_SPIR_V, fileData.data(), GLsizei( fileData.size() ) );
 		m_isSpirV = true;
 	}
+
+	std::string ShaderModule::doRewritePushConstants( std::string const & shader )
+	{
+		auto constants = doListUniformPushConstants( shader );
+		m_blockPushConstants.clear();
+		m_uniformPushConstants.clear();
+		m_pushConstantsBlockSize = 0u;
+
+		for ( auto & constant : constants )
+		{
+			m_uniformPushConstants.push_back( constant.location );
+		}
+
+		auto ring = m_device.getPushConstantsRing();
+
+		// The declarations are gathered in one block, hence they must lie in the same preprocessor branch.
+		if ( !ring
+			|| constants.size() < MinBlockPushConstants
+			|| doGetShaderVersion( shader ) < 440u
+			|| doHasDirective( shader.begin() + constants.front().begin, shader.begin() + constants.back().end ) )
+		{
+			return shader;
+		}
+
+		uint32_t size = 0u;
+		std::set< std::string > names;
+
+		for ( auto & constant : constants )
+		{
+			size = std::max( size, ( constant.location + constant.arraySize ) * PushConstantSlotSize );
+			names.insert( constant.name );
+		}
+
+		if ( size > MaxPushConstantsBlockSize
+			|| size > m_device.getPhysicalDevice().getProperties().limits.maxUniformBufferRange )
+		{
+			return shader;
+		}
+
+		// The block has an instance name, so that the members of the different stages' blocks don't clash,
+		// the uses of the push constants are renamed accordingly.
+		auto stage = std::to_string( uint32_t( getStage() ) );
+		auto instance = "rendererPushConstants" + stage;
+		// The code following the block, without the push constants declarations.
+		std::string code;
+		auto end = constants.front().end;
+
+		for ( auto it = constants.begin() + 1u; it != constants.end(); ++it )
+		{
+			code += shader.substr( end, it->begin - end );
+			end = it->end;
+		}
+
+		code += shader.substr( end );
+		std::string prefix;
+		std::string suffix;
+
+		if ( !doRenamePushConstants( shader.substr( 0u, constants.front().begin ), names, instance, prefix )
+			|| !doRenamePushConstants( code, names, instance, suffix ) )
+		{
+			return shader;
+		}
+
+		std::stringstream block;
+		block << "layout( std140, binding = " << ring->getBinding() << " ) uniform RendererPushConstants" << stage << "\n";
+		block << "{\n";
+
+		for ( auto & constant : constants )
+		{
+			block << "\tlayout( offset = " << constant.location * PushConstantSlotSize << " ) "
+				<< constant.type << " " << constant.name;
+
+			if ( constant.arraySize > 1u )
+			{
+				block << "[" << constant.arraySize << "]";
+			}
+
+			block << ";\n";
+		}
+
+		block << "} " << instance << ";\n";
+
+		std::string result = prefix + block.str() + suffix;
+		m_blockPushConstants.swap( m_uniformPushConstants );
+		m_pushConstantsBlockSize = size;
+		return result;
+	}
 }
@@ -10,9 +10,35 @@ See LICENSE file in root folder.
 
 namespace gl_renderer
 {
+	/**
+	*\brief
+	*	Module de shader.
+	*\remarks
+	*	Lorsqu'un shader GLSL déclare suffisamment de push constants sous forme de variables
+	*	uniformes ( layout( location = N ) uniform ), celles-ci sont réécrites en un bloc uniforme
+	*	alimenté par l'anneau de push constants du périphérique, afin qu'un seul appel OpenGL les mette à jour.
+	*	Chaque constante y occupe l'emplacement PushConstantSlotSize * N, pour que les blocs de tous
+	*	les niveaux d'un programme puissent lire le même intervalle de tampon.
+	*	Les utilisations des constantes sont renommées lexème par lexème, les accès aux membres et les commentaires
+	*	sont conservés, et le shader garde ses variables uniformes si une déclaration ou une macro masque une constante.
+	*/
 	class ShaderModule
 		: public renderer::ShaderModule
 	{
+	public:
+		//! La taille d'un emplacement de push constant dans le bloc, suffisante pour une mat4.
+		static uint32_t constexpr PushConstantSlotSize = 64u;
+		/**
+		*\brief
+		*	Le nombre minimal de push constants pour que le bloc soit plus économique que les variables uniformes.
+		*\remarks
+		*	Le bloc coûte une copie dans l'anneau et un glBindBufferRange, chaque variable uniforme un appel glUniform*,
+		*	le bloc économise donc des appels dès deux constantes.
+		*/
+		static uint32_t constexpr MinBlockPushConstants = 2u;
+		//! La taille maximale du bloc, pour qu'une zone de l'anneau (PushConstantsRing::FrameSize) reçoive au moins 1024 mises à jour.
+		static uint32_t constexpr MaxPushConstantsBlockSize = 1024u;
+
 	public:
 		ShaderModule( Device const & device
 			, renderer::ShaderStageFlag stage );
@@ -35,10 +61,40 @@ namespace gl_renderer
 		{
 			return m_isSpirV;
 		}
+		/**
+		*\return
+		*	Les positions des push constants réécrites dans le bloc.
+		*/
+		inline renderer::UInt32Array const & getBlockPushConstants()const
+		{
+			return m_blockPushConstants;
+		}
+		/**
+		*\return
+		*	Les positions des push constants restées des variables uniformes.
+		*/
+		inline renderer::UInt32Array const & getUniformPushConstants()const
+		{
+			return m_uniformPushConstants;
+		}
+		/**
+		*\return
+		*	La taille du bloc de push constants, 0 s'il n'y en a pas.
+		*/
+		inline uint32_t getPushConstantsBlockSize()const
+		{
+			return m_pushConstantsBlockSize;
+		}
+
+	private:
+		std::string doRewritePushConstants( std::string const & shader );
 
 	private:
 		Device const & m_device;
 		GLuint m_shader;
 		bool m_isSpirV;
+		renderer::UInt32Array m_blockPushConstants;
+		renderer::UInt32Array m_uniformPushConstants;
+		uint32_t m_pushConstantsBlockSize{ 0u };
 	};
 }
@@ -144,6 +144,7 @@ namespace gl_renderer
 			auto & module = static_cast< ShaderModule const & >( stage.getModule() );
 			m_shaders.push_back( module.getShader() );
 			doInitialiseState( stage );
+			doAddPushConstants( module );
 			glLogCall( gl::AttachShader, m_program, m_shaders.back() );
 		}
 	}
@@ -154,6 +155,7 @@ namespace gl_renderer
 		auto & module = static_cast< ShaderModule const & >( stage.getModule() );
 		m_shaders.push_back( module.getShader() );
 		doInitialiseState( stage );
+		doAddPushConstants( module );
 		glLogCall( gl::AttachShader, m_program, m_shaders.back() );
 	}
 
@@ -206,4 +208,17 @@ namespace gl_renderer
 			}
 		}
 	}
+
+	void ShaderProgram::doAddPushConstants( ShaderModule const & module )
+	{
+		m_blockPushConstants.insert( module.getBlockPushConstants().begin()
+			, module.getBlockPushConstants().end() );
+		m_uniformPushConstants.insert( module.getUniformPushConstants().begin()
+			, module.getUniformPushConstants().end() );
+
+		if ( module.getPushConstantsBlockSize() > m_pushConstantsBlock.size() )
+		{
+			m_pushConstantsBlock.resize( module.getPushConstantsBlockSize(), 0u );
+		}
+	}
 }
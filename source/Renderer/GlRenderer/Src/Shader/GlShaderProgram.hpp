@@ -6,6 +6,8 @@ See LICENSE file in root folder.
 
 #include "GlRendererPrerequisites.hpp"
 
+#include <set>
+
 namespace gl_renderer
 {
 	class ShaderProgram
@@ -20,9 +22,47 @@ namespace gl_renderer
 		{
 			return m_program;
 		}
+		/**
+		*\return
+		*	\p true si des push constants d'un des niveaux ont été réécrites en bloc uniforme.
+		*/
+		inline bool hasPushConstantsBlock()const
+		{
+			return !m_pushConstantsBlock.empty();
+		}
+		/**
+		*\return
+		*	\p true si la push constant à la position donnée est lue depuis le bloc par au moins un niveau.
+		*/
+		inline bool isInPushConstantsBlock( uint32_t location )const
+		{
+			return m_blockPushConstants.find( location ) != m_blockPushConstants.end();
+		}
+		/**
+		*\return
+		*	\p true si la push constant à la position donnée est une variable uniforme pour au moins un niveau.
+		*/
+		inline bool isUniformPushConstant( uint32_t location )const
+		{
+			return m_uniformPushConstants.find( location ) != m_uniformPushConstants.end();
+		}
+		/**
+		*\return
+		*	Les dernières valeurs du bloc de push constants, envoyées à l'anneau à chaque mise à jour.
+		*/
+		inline renderer::ByteArray & getPushConstantsBlock()const
+		{
+			return m_pushConstantsBlock;
+		}
+
+	private:
+		void doAddPushConstants( ShaderModule const & module );
 
 	private:
 		GLuint m_program;
 		renderer::UInt32Array m_shaders;
+		std::set< uint32_t > m_blockPushConstants;
+		std::set< uint32_t > m_uniformPushConstants;
+		mutable renderer::ByteArray m_pushConstantsBlock;
 	};
 }
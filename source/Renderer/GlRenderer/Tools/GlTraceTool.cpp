@@ -0,0 +1,366 @@
+/*
+This file belongs to GlRenderer.
+See LICENSE file in root folder.
+*/
+#include <Miscellaneous/GlCallTraceFormat.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/*
+*	Reads an OpenGL calls trace, written by GlRenderer's CallTracer.
+*	Usage: GlTraceTool <trace file> [--list]
+*	--list prints the calls, frame by frame, in their recording order.
+*	Without it, a summary is printed: calls per frame, top call sites,
+*	and redundant state calls (the same state function called twice in a row
+*	with the same arguments).
+*/
+namespace
+{
+	using gl_renderer::CallTraceArgType;
+	using gl_renderer::CallTraceRecord;
+	using gl_renderer::CallTraceRecordKind;
+
+	struct Site
+	{
+		uint32_t line;
+		std::string name;
+		std::string file;
+	};
+
+	struct Trace
+	{
+		std::vector< Site > sites;
+		std::vector< CallTraceRecord > records;
+	};
+
+	template< typename T >
+	bool doRead( std::ifstream & file, T & value )
+	{
+		return bool( file.read( reinterpret_cast< char * >( &value ), sizeof( value ) ) );
+	}
+
+	bool doRead( std::ifstream & file, std::string & value )
+	{
+		uint32_t size = 0u;
+
+		if ( !doRead( file, size ) )
+		{
+			return false;
+		}
+
+		value.resize( size );
+		return bool( file.read( &value[0], size ) );
+	}
+
+	bool doLoad( std::string const & path, Trace & trace )
+	{
+		std::ifstream file{ path, std::ios::binary };
+		gl_renderer::CallTraceHeader header;
+
+		if ( !file
+			|| !doRead( file, header )
+			|| header.magic != gl_renderer::CallTraceMagic
+			|| header.version != gl_renderer::CallTraceVersion )
+		{
+			std::cerr << "Not a GL calls trace: " << path << std::endl;
+			return false;
+		}
+
+		trace.sites.resize( header.siteCount );
+
+		for ( auto & site : trace.sites )
+		{
+			if ( !doRead( file, site.line )
+				|| !doRead( file, site.name )
+				|| !doRead( file, site.file ) )
+			{
+				std::cerr << "Truncated sites table." << std::endl;
+				return false;
+			}
+		}
+
+		trace.records.resize( header.recordCount );
+
+		for ( auto & record : trace.records )
+		{
+			if ( !file.read( reinterpret_cast< char * >( &record ), gl_renderer::CallTraceRecordHeaderSize )
+				|| record.count > gl_renderer::CallTraceMaxArgs
+				|| !file.read( reinterpret_cast< char * >( record.args ), record.count * sizeof( uint64_t ) ) )
+			{
+				std::cerr << "Truncated records." << std::endl;
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	CallTraceArgType doGetType( CallTraceRecord const & record, uint32_t index )
+	{
+		auto mask = ( 1u << gl_renderer::CallTraceArgTypeBits ) - 1u;
+		return CallTraceArgType( ( record.types >> ( index * gl_renderer::CallTraceArgTypeBits ) ) & mask );
+	}
+
+	std::string doGetArg( CallTraceRecord const & record, uint32_t index )
+	{
+		auto value = record.args[index];
+
+		switch ( doGetType( record, index ) )
+		{
+		case CallTraceArgType::eInt:
+			return std::to_string( int64_t( value ) );
+
+		case CallTraceArgType::eUInt:
+			{
+				std::stringstream stream;
+				stream << value;
+
+				// GL enums are easier to find in hexadecimal.
+				if ( value >= 0x0100u && value <= 0xFFFFu )
+				{
+					stream << " (0x" << std::hex << value << ")";
+				}
+
+				return stream.str();
+			}
+
+		case CallTraceArgType::eFloat:
+			{
+				double converted;
+				std::memcpy( &converted, &value, sizeof( converted ) );
+				return std::to_string( converted );
+			}
+
+		case CallTraceArgType::ePointer:
+			{
+				if ( !value )
+				{
+					return "nullptr";
+				}
+
+				std::stringstream stream;
+				stream << "0x" << std::hex << value;
+				return stream.str();
+			}
+
+		default:
+			return "?";
+		}
+	}
+
+	bool doIsStateCall( std::string const & name )
+	{
+		static std::vector< std::string > const prefixes
+		{
+			"gl::Active",
+			"gl::Bind",
+			"gl::Blend",
+			"gl::ColorMask",
+			"gl::CullFace",
+			"gl::Depth",
+			"gl::Disable",
+			"gl::Enable",
+			"gl::FrontFace",
+			"gl::LineWidth",
+			"gl::LogicOp",
+			"gl::PolygonMode",
+			"gl::PolygonOffset",
+			"gl::Scissor",
+			"gl::Stencil",
+			"gl::UseProgram",
+			"gl::Viewport",
+		};
+		return std::any_of( prefixes.begin()
+			, prefixes.end()
+			, [&name]( std::string const & prefix )
+			{
+				return name.compare( 0u, prefix.size(), prefix ) == 0;
+			} );
+	}
+
+	bool doHasSameArgs( CallTraceRecord const & lhs, CallTraceRecord const & rhs )
+	{
+		// The pointed data isn't traced, so calls taking pointers can't be compared.
+		for ( auto index = 0u; index < lhs.count; ++index )
+		{
+			if ( doGetType( lhs, index ) == CallTraceArgType::ePointer )
+			{
+				return false;
+			}
+		}
+
+		return lhs.count == rhs.count
+			&& lhs.types == rhs.types
+			&& std::equal( lhs.args, lhs.args + lhs.count, rhs.args );
+	}
+
+	void doList( Trace const & trace )
+	{
+		uint32_t frame = 0u;
+		std::cout << "Frame " << frame << std::endl;
+
+		for ( auto & record : trace.records )
+		{
+			std::cout << std::setw( 14 ) << record.time << " ns  ";
+
+			switch ( record.kind )
+			{
+			case CallTraceRecordKind::eFrame:
+				std::cout << "SwapBuffers" << std::endl;
+				std::cout << "Frame " << ++frame << std::endl;
+				break;
+
+			case CallTraceRecordKind::eCommand:
+				std::cout << "Command: " << trace.sites[record.site].name << std::endl;
+				break;
+
+			case CallTraceRecordKind::eCall:
+				{
+					std::cout << "  " << trace.sites[record.site].name << "(";
+					std::string sep = " ";
+
+					for ( auto index = 0u; index < record.count; ++index )
+					{
+						std::cout << sep << doGetArg( record, index );
+						sep = ", ";
+					}
+
+					std::cout << ( record.count ? " )" : ")" ) << std::endl;
+					break;
+				}
+
+			default:
+				std::cout << "Unknown record kind" << std::endl;
+				break;
+			}
+		}
+	}
+
+	void doSummarise( Trace const & trace )
+	{
+		std::vector< uint32_t > siteCalls( trace.sites.size(), 0u );
+		std::map< std::string, uint32_t > redundantCalls;
+		std::map< std::string, CallTraceRecord const * > lastCalls;
+		std::vector< uint32_t > frameCalls;
+		uint32_t calls = 0u;
+		uint32_t redundant = 0u;
+
+		for ( auto & record : trace.records )
+		{
+			if ( record.kind == CallTraceRecordKind::eFrame )
+			{
+				frameCalls.push_back( calls );
+				calls = 0u;
+				continue;
+			}
+
+			if ( record.kind != CallTraceRecordKind::eCall )
+			{
+				continue;
+			}
+
+			++calls;
+			++siteCalls[record.site];
+			auto & name = trace.sites[record.site].name;
+
+			if ( doIsStateCall( name ) )
+			{
+				auto & last = lastCalls[name];
+
+				if ( last && doHasSameArgs( *last, record ) )
+				{
+					++redundantCalls[name];
+					++redundant;
+				}
+
+				last = &record;
+			}
+		}
+
+		std::cout << "Records: " << trace.records.size() << std::endl;
+
+		// The first and last frames are usually partial, the ring having wrapped, or the trace being dumped mid-frame.
+		if ( frameCalls.size() > 2u )
+		{
+			std::vector< uint32_t > complete{ frameCalls.begin() + 1u, frameCalls.end() };
+			std::sort( complete.begin(), complete.end() );
+			uint64_t total = 0u;
+
+			for ( auto count : complete )
+			{
+				total += count;
+			}
+
+			std::cout << "Complete frames: " << complete.size() << std::endl;
+			std::cout << "GL calls per frame: min " << complete.front()
+				<< ", median " << complete[complete.size() / 2u]
+				<< ", mean " << ( total / complete.size() )
+				<< ", max " << complete.back() << std::endl;
+		}
+
+		std::vector< uint32_t > order( trace.sites.size() );
+
+		for ( auto index = 0u; index < order.size(); ++index )
+		{
+			order[index] = index;
+		}
+
+		std::sort( order.begin()
+			, order.end()
+			, [&siteCalls]( uint32_t lhs, uint32_t rhs )
+			{
+				return siteCalls[lhs] > siteCalls[rhs];
+			} );
+		std::cout << std::endl << "Top call sites:" << std::endl;
+
+		for ( auto index = 0u; index < std::min< size_t >( 20u, order.size() ) && siteCalls[order[index]]; ++index )
+		{
+			auto & site = trace.sites[order[index]];
+			std::cout << std::setw( 10 ) << siteCalls[order[index]] << "  "
+				<< site.name << "  " << site.file << ":" << site.line << std::endl;
+		}
+
+		std::cout << std::endl << "Redundant state calls: " << redundant << std::endl;
+
+		for ( auto & call : redundantCalls )
+		{
+			std::cout << std::setw( 10 ) << call.second << "  " << call.first << std::endl;
+		}
+	}
+}
+
+int main( int argc, char ** argv )
+{
+	if ( argc < 2 )
+	{
+		std::cerr << "Usage: GlTraceTool <trace file> [--list]" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	Trace trace;
+
+	if ( !doLoad( argv[1], trace ) )
+	{
+		return EXIT_FAILURE;
+	}
+
+	if ( argc > 2 && std::string{ argv[2] } == "--list" )
+	{
+		doList( trace );
+	}
+	else
+	{
+		doSummarise( trace );
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -28,8 +28,10 @@ then
 		"opengl32"
 	}
 else
+	defines( "GLRENDERER_EGL=1" )
 	links{
-		"GL"
+		"GL",
+		"EGL"
 	}
 end
 
@@ -46,3 +48,20 @@ files{ "./Src/**.hpp",
 vpaths{ ["Header Files"] = "**.hpp" }
 vpaths{ ["Header Files"] = "**.inl" }
 vpaths{ ["Source Files"] = "**.cpp" }
+
+
+project "GlTraceTool"
+
+kind( "ConsoleApp" )
+targetdir( path.join( outputDir, "%{cfg.architecture}", "%{cfg.buildcfg}", executableDir ) )
+location( currentBinaryDir )
+cppdialect( "C++17" )
+
+includedirs{
+	path.join( currentSourceDir, "Src" )
+}
+
+files{
+	path.join( currentSourceDir, "Tools", "GlTraceTool.cpp" ),
+	path.join( currentSourceDir, "Src", "Miscellaneous", "GlCallTraceFormat.hpp" )
+}
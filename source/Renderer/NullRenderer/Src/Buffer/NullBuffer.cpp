@@ -0,0 +1,85 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Buffer/NullBuffer.hpp"
+
+#include <Core/Device.hpp>
+#include <Sync/BufferMemoryBarrier.hpp>
+
+namespace null_renderer
+{
+	Buffer::Buffer( renderer::Device const & device
+		, uint32_t size
+		, renderer::BufferTargets target
+		, renderer::MemoryPropertyFlags flags )
+		: renderer::BufferBase{ device
+			, size
+			, target
+			, flags }
+		, m_data( size_t( size ), uint8_t( 0u ) )
+	{
+	}
+
+	uint8_t * Buffer::lock( uint32_t offset
+		, uint32_t size
+		, renderer::MemoryMapFlags flags )const
+	{
+		assert( !m_mapped && "The buffer is already mapped." );
+		assert( offset + size <= m_data.size() );
+		renderer::countStatistic( renderer::Statistic::eBufferMap );
+		m_mapped = true;
+		return m_data.data() + offset;
+	}
+
+	void Buffer::flush( uint32_t offset
+		, uint32_t size )const
+	{
+		assert( m_mapped && "The buffer isn't mapped." );
+		renderer::countStatistic( renderer::Statistic::eUpload );
+		renderer::countStatistic( renderer::Statistic::eUploadedBytes, size );
+	}
+
+	void Buffer::invalidate( uint32_t offset
+		, uint32_t size )const
+	{
+		assert( m_mapped && "The buffer isn't mapped." );
+	}
+
+	void Buffer::unlock()const
+	{
+		assert( m_mapped && "The buffer isn't mapped." );
+		m_mapped = false;
+	}
+
+	renderer::BufferMemoryBarrier Buffer::makeTransferDestination()const
+	{
+		return makeMemoryTransitionBarrier( renderer::AccessFlag::eTransferWrite );
+	}
+
+	renderer::BufferMemoryBarrier Buffer::makeTransferSource()const
+	{
+		return makeMemoryTransitionBarrier( renderer::AccessFlag::eTransferRead );
+	}
+
+	renderer::BufferMemoryBarrier Buffer::makeVertexShaderInputResource()const
+	{
+		return makeMemoryTransitionBarrier( renderer::AccessFlag::eVertexAttributeRead );
+	}
+
+	renderer::BufferMemoryBarrier Buffer::makeUniformBufferInput()const
+	{
+		return makeMemoryTransitionBarrier( renderer::AccessFlag::eUniformRead );
+	}
+
+	renderer::BufferMemoryBarrier Buffer::makeMemoryTransitionBarrier( renderer::AccessFlags dstAccess )const
+	{
+		return renderer::BufferMemoryBarrier{ getState().access
+			, dstAccess
+			, ~( 0u )
+			, ~( 0u )
+			, *this
+			, 0u
+			, getSize() };
+	}
+}
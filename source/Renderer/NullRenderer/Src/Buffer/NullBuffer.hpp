@@ -0,0 +1,114 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "NullRendererPrerequisites.hpp"
+
+#include <Buffer/Buffer.hpp>
+
+namespace null_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Tampon dont la mémoire est allouée en RAM.
+	*\remarks
+	*	Le contenu est réellement stocké, les copies entre tampons et les mappings le lisent et l'écrivent.
+	*\~english
+	*\brief
+	*	Buffer whose memory is allocated in RAM.
+	*\remarks
+	*	The content is really stored, the copies between buffers and the mappings read and write it.
+	*/
+	class Buffer
+		: public renderer::BufferBase
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] size
+		*	La taille du tampon.
+		*\param[in] target
+		*	Les indicateurs d'utilisation du tampon.
+		*\param[in] flags
+		*	Les indicateurs de mémoire du tampon.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] size
+		*	The buffer size.
+		*\param[in] target
+		*	The buffer usage flags.
+		*\param[in] flags
+		*	The buffer memory flags.
+		*/
+		Buffer( renderer::Device const & device
+			, uint32_t size
+			, renderer::BufferTargets target
+			, renderer::MemoryPropertyFlags flags );
+		/**
+		*\copydoc	renderer::BufferBase::lock
+		*/
+		uint8_t * lock( uint32_t offset
+			, uint32_t size
+			, renderer::MemoryMapFlags flags )const override;
+		/**
+		*\copydoc	renderer::BufferBase::flush
+		*/
+		void flush( uint32_t offset
+			, uint32_t size )const override;
+		/**
+		*\copydoc	renderer::BufferBase::invalidate
+		*/
+		void invalidate( uint32_t offset
+			, uint32_t size )const override;
+		/**
+		*\copydoc	renderer::BufferBase::unlock
+		*/
+		void unlock()const override;
+		/**
+		*\copydoc	renderer::BufferBase::makeTransferDestination
+		*/
+		renderer::BufferMemoryBarrier makeTransferDestination()const override;
+		/**
+		*\copydoc	renderer::BufferBase::makeTransferSource
+		*/
+		renderer::BufferMemoryBarrier makeTransferSource()const override;
+		/**
+		*\copydoc	renderer::BufferBase::makeVertexShaderInputResource
+		*/
+		renderer::BufferMemoryBarrier makeVertexShaderInputResource()const override;
+		/**
+		*\copydoc	renderer::BufferBase::makeUniformBufferInput
+		*/
+		renderer::BufferMemoryBarrier makeUniformBufferInput()const override;
+		/**
+		*\copydoc	renderer::BufferBase::makeMemoryTransitionBarrier
+		*/
+		renderer::BufferMemoryBarrier makeMemoryTransitionBarrier( renderer::AccessFlags dstAccess )const override;
+		/**
+		*\~french
+		*\return
+		*	La mémoire du tampon.
+		*\~english
+		*\return
+		*	The buffer memory.
+		*/
+		inline uint8_t * getData()const
+		{
+			return m_data.data();
+		}
+
+	private:
+		mutable std::vector< uint8_t > m_data;
+		mutable bool m_mapped{ false };
+	};
+}
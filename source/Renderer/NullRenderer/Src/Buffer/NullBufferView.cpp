@@ -0,0 +1,21 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Buffer/NullBufferView.hpp"
+
+namespace null_renderer
+{
+	BufferView::BufferView( renderer::Device const & device
+		, renderer::BufferBase const & buffer
+		, renderer::PixelFormat format
+		, uint32_t offset
+		, uint32_t range )
+		: renderer::BufferView{ device
+			, buffer
+			, format
+			, offset
+			, range }
+	{
+	}
+}
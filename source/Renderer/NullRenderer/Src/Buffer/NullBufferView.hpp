@@ -0,0 +1,59 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "NullRendererPrerequisites.hpp"
+
+#include <Buffer/BufferView.hpp>
+
+namespace null_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Vue sur un tampon, qui ne fait que garder ses paramètres.
+	*\~english
+	*\brief
+	*	View on a buffer, which only keeps its parameters.
+	*/
+	class BufferView
+		: public renderer::BufferView
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] buffer
+		*	Le tampon sur lequel la vue est créée.
+		*\param[in] format
+		*	Le format des pixels de la vue.
+		*\param[in] offset
+		*	Le décalage dans le tampon.
+		*\param[in] range
+		*	Le nombre d'éléments dans le tampon.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] buffer
+		*	The buffer from which the view is created.
+		*\param[in] format
+		*	The view's pixels format.
+		*\param[in] offset
+		*	The offset in the buffer.
+		*\param[in] range
+		*	The number of elements from the buffer.
+		*/
+		BufferView( renderer::Device const & device
+			, renderer::BufferBase const & buffer
+			, renderer::PixelFormat format
+			, uint32_t offset
+			, uint32_t range );
+	};
+}
@@ -0,0 +1,40 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Buffer/NullUniformBuffer.hpp"
+
+#include <Core/Device.hpp>
+
+namespace null_renderer
+{
+	namespace
+	{
+		uint32_t doGetAlignedSize( uint32_t size, uint32_t align )
+		{
+			return ( ( size + align - 1u ) / align ) * align;
+		}
+	}
+
+	UniformBuffer::UniformBuffer( renderer::Device const & device
+		, uint32_t count
+		, uint32_t size
+		, renderer::BufferTargets target
+		, renderer::MemoryPropertyFlags flags )
+		: renderer::UniformBufferBase{ device
+			, count
+			, size
+			, target
+			, flags }
+	{
+		m_buffer = m_device.createBuffer( count * getAlignedSize( getElementSize() )
+			, target | renderer::BufferTarget::eUniformBuffer
+			, flags );
+	}
+
+	uint32_t UniformBuffer::getAlignedSize( uint32_t size )const
+	{
+		return doGetAlignedSize( size
+			, uint32_t( m_device.getProperties().limits.minUniformBufferOffsetAlignment ) );
+	}
+}
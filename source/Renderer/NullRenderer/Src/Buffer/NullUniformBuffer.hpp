@@ -0,0 +1,63 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "NullRendererPrerequisites.hpp"
+
+#include <Buffer/UniformBuffer.hpp>
+
+namespace null_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Tampon de variables uniformes.
+	*\~english
+	*\brief
+	*	Uniform variables buffer.
+	*/
+	class UniformBuffer
+		: public renderer::UniformBufferBase
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] count
+		*	Le nombre d'instance des données.
+		*\param[in] size
+		*	La taille d'une instance des données, en octets.
+		*\param[in] target
+		*	Les indicateurs d'utilisation du tampon.
+		*\param[in] flags
+		*	Les indicateurs de mémoire du tampon.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] count
+		*	The data instances count.
+		*\param[in] size
+		*	The size of a data instance, in bytes.
+		*\param[in] target
+		*	The buffer usage flags.
+		*\param[in] flags
+		*	The buffer memory flags.
+		*/
+		UniformBuffer( renderer::Device const & device
+			, uint32_t count
+			, uint32_t size
+			, renderer::BufferTargets target
+			, renderer::MemoryPropertyFlags flags );
+		/**
+		*\copydoc	renderer::UniformBufferBase::getAlignedSize
+		*/
+		uint32_t getAlignedSize( uint32_t size )const override;
+	};
+}
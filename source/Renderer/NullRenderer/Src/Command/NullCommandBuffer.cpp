@@ -0,0 +1,532 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Command/NullCommandBuffer.hpp"
+
+#include "Buffer/NullBuffer.hpp"
+#include "Descriptor/NullDescriptorSet.hpp"
+#include "Miscellaneous/NullQueryPool.hpp"
+#include "Pipeline/NullComputePipeline.hpp"
+#include "Pipeline/NullPipeline.hpp"
+#include "Pipeline/NullPipelineLayout.hpp"
+
+#include <Command/CommandBufferInheritanceInfo.hpp>
+#include <Miscellaneous/BufferCopy.hpp>
+#include <RenderPass/FrameBuffer.hpp>
+#include <RenderPass/RenderPass.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace null_renderer
+{
+	namespace
+	{
+		uint64_t getTimestamp()
+		{
+			return uint64_t( std::chrono::duration_cast< std::chrono::nanoseconds >( renderer::Clock::now().time_since_epoch() ).count() );
+		}
+
+		void doBindDescriptorSets( std::vector< renderer::DescriptorSet const * > & bound
+			, renderer::DescriptorSetCRefArray const & descriptorSets )
+		{
+			auto index = descriptorSets.begin()->get().getBindingPoint();
+
+			for ( auto & descriptorSet : descriptorSets )
+			{
+				if ( bound.size() <= index )
+				{
+					bound.resize( index + 1u, nullptr );
+				}
+
+				bound[index++] = &descriptorSet.get();
+			}
+		}
+
+#if !defined( NDEBUG )
+
+		bool areDescriptorSetsBound( std::vector< renderer::DescriptorSet const * > const & bound
+			, renderer::PipelineLayout const & layout )
+		{
+			auto count = static_cast< PipelineLayout const & >( layout ).getDescriptorSetLayouts().size();
+
+			if ( bound.size() < count )
+			{
+				return false;
+			}
+
+			return std::all_of( bound.begin()
+				, bound.begin() + count
+				, []( renderer::DescriptorSet const * descriptorSet )
+				{
+					return descriptorSet != nullptr;
+				} );
+		}
+
+#endif
+	}
+
+	CommandBuffer::CommandBuffer( renderer::Device const & device
+		, renderer::CommandPool const & pool
+		, bool primary )
+		: renderer::CommandBuffer{ device, pool, primary }
+	{
+	}
+
+	bool CommandBuffer::begin( renderer::CommandBufferUsageFlags flags )const
+	{
+		m_commands.clear();
+		doResetStatistics();
+		m_state = State{};
+		m_state.recording = true;
+		return true;
+	}
+
+	bool CommandBuffer::begin( renderer::CommandBufferUsageFlags flags
+		, renderer::CommandBufferInheritanceInfo const & inheritanceInfo )const
+	{
+		m_commands.clear();
+		doResetStatistics();
+		m_state = State{};
+		m_state.recording = true;
+		// Un tampon secondaire peut continuer la passe de rendu du tampon primaire qui l'exécute.
+		m_state.renderPass = inheritanceInfo.renderPass;
+		m_state.subpass = inheritanceInfo.subpass;
+		return true;
+	}
+
+	bool CommandBuffer::end()const
+	{
+		assert( m_state.recording && "The command buffer isn't being recorded." );
+		m_state.recording = false;
+		return true;
+	}
+
+	bool CommandBuffer::reset( renderer::CommandBufferResetFlags flags )const
+	{
+		m_commands.clear();
+		doResetStatistics();
+		m_state = State{};
+		return true;
+	}
+
+	void CommandBuffer::nextSubpass( renderer::SubpassContents contents )const
+	{
+		assert( m_state.renderPass && "No render pass is begun." );
+		assert( m_state.subpass + 1u < m_state.renderPass->getSubpasses().size()
+			&& "The render pass has no more subpasses." );
+		++m_state.subpass;
+		doRecord( CommandType::eNextSubpass );
+	}
+
+	void CommandBuffer::endRenderPass()const
+	{
+		assert( m_state.renderPass && "No render pass is begun." );
+		m_state.renderPass = nullptr;
+		m_state.subpass = 0u;
+		doRecord( CommandType::eEndRenderPass );
+	}
+
+	void CommandBuffer::executeCommands( renderer::CommandBufferCRefArray const & commands )const
+	{
+		doCountStatistics( commands );
+		std::vector< CommandBuffer const * > secondaries;
+
+		for ( auto & commandBuffer : commands )
+		{
+			secondaries.push_back( &static_cast< CommandBuffer const & >( commandBuffer.get() ) );
+		}
+
+		doRecord( CommandType::eExecuteCommands
+			, [secondaries]()
+			{
+				for ( auto commandBuffer : secondaries )
+				{
+					commandBuffer->execute();
+				}
+			} );
+	}
+
+	void CommandBuffer::clear( renderer::TextureView const & image
+		, renderer::RgbaColour const & colour )const
+	{
+		assert( !m_state.renderPass && "Images can't be cleared inside a render pass." );
+		doRecord( CommandType::eClearColour );
+	}
+
+	void CommandBuffer::clear( renderer::TextureView const & image
+		, renderer::DepthStencilClearValue const & value )const
+	{
+		assert( !m_state.renderPass && "Images can't be cleared inside a render pass." );
+		doRecord( CommandType::eClearDepthStencil );
+	}
+
+	void CommandBuffer::clearAttachments( renderer::ClearAttachmentArray const & clearAttachments
+		, renderer::ClearRectArray const & clearRects )
+	{
+		assert( m_state.renderPass && "Attachments can only be cleared inside a render pass." );
+		doRecord( CommandType::eClearAttachments );
+	}
+
+	void CommandBuffer::bindPipeline( renderer::Pipeline const & pipeline
+		, renderer::PipelineBindPoint bindingPoint )const
+	{
+		doCountStatistic( renderer::Statistic::ePipelineBind );
+		m_state.pipeline = &static_cast< Pipeline const & >( pipeline );
+		doRecord( CommandType::eBindPipeline );
+	}
+
+	void CommandBuffer::bindPipeline( renderer::ComputePipeline const & pipeline
+		, renderer::PipelineBindPoint bindingPoint )const
+	{
+		doCountStatistic( renderer::Statistic::ePipelineBind );
+		m_state.computePipeline = &static_cast< ComputePipeline const & >( pipeline );
+		doRecord( CommandType::eBindComputePipeline );
+	}
+
+	void CommandBuffer::bindVertexBuffers( uint32_t firstBinding
+		, renderer::BufferCRefArray const & buffers
+		, renderer::UInt64Array offsets )const
+	{
+		assert( buffers.size() == offsets.size() );
+
+		if ( m_state.vertexBuffers.size() < firstBinding + buffers.size() )
+		{
+			m_state.vertexBuffers.resize( firstBinding + buffers.size(), nullptr );
+		}
+
+		for ( auto & buffer : buffers )
+		{
+			m_state.vertexBuffers[firstBinding++] = &buffer.get();
+		}
+
+		doRecord( CommandType::eBindVertexBuffers );
+	}
+
+	void CommandBuffer::bindIndexBuffer( renderer::BufferBase const & buffer
+		, uint64_t offset
+		, renderer::IndexType indexType )const
+	{
+		m_state.indexBuffer = &buffer;
+		doRecord( CommandType::eBindIndexBuffer );
+	}
+
+	void CommandBuffer::bindDescriptorSets( renderer::DescriptorSetCRefArray const & descriptorSets
+		, renderer::PipelineLayout const & layout
+		, renderer::UInt32Array const & dynamicOffsets
+		, renderer::PipelineBindPoint bindingPoint )const
+	{
+		assert( !descriptorSets.empty() );
+		doCountStatistic( renderer::Statistic::eDescriptorSetBind, descriptorSets.size() );
+		size_t dynamicCount = 0u;
+
+		for ( auto & descriptorSet : descriptorSets )
+		{
+			dynamicCount += static_cast< DescriptorSet const & >( descriptorSet.get() ).getDynamicBuffers().size();
+		}
+
+		assert( dynamicCount == dynamicOffsets.size()
+			&& "There must be one dynamic offset per dynamic buffer." );
+		doBindDescriptorSets( bindingPoint == renderer::PipelineBindPoint::eCompute
+				? m_state.computeDescriptorSets
+				: m_state.graphicsDescriptorSets
+			, descriptorSets );
+		doRecord( CommandType::eBindDescriptorSets );
+	}
+
+	void CommandBuffer::setViewport( renderer::Viewport const & viewport )const
+	{
+		doRecord( CommandType::eSetViewport );
+	}
+
+	void CommandBuffer::setScissor( renderer::Scissor const & scissor )const
+	{
+		doRecord( CommandType::eSetScissor );
+	}
+
+	void CommandBuffer::draw( uint32_t vtxCount
+		, uint32_t instCount
+		, uint32_t firstVertex
+		, uint32_t firstInstance )const
+	{
+		doCheckDraw( false );
+		doCountStatistic( renderer::Statistic::eDrawCall );
+		doRecord( CommandType::eDraw );
+	}
+
+	void CommandBuffer::drawIndexed( uint32_t indexCount
+		, uint32_t instCount
+		, uint32_t firstIndex
+		, uint32_t vertexOffset
+		, uint32_t firstInstance )const
+	{
+		doCheckDraw( true );
+		doCountStatistic( renderer::Statistic::eDrawCall );
+		doRecord( CommandType::eDrawIndexed );
+	}
+
+	void CommandBuffer::drawIndirect( renderer::BufferBase const & buffer
+		, uint32_t offset
+		, uint32_t drawCount
+		, uint32_t stride )const
+	{
+		doCheckDraw( false );
+		doCountStatistic( renderer::Statistic::eDrawCall );
+		doRecord( CommandType::eDrawIndirect );
+	}
+
+	void CommandBuffer::drawIndexedIndirect( renderer::BufferBase const & buffer
+		, uint32_t offset
+		, uint32_t drawCount
+		, uint32_t stride )const
+	{
+		doCheckDraw( true );
+		doCountStatistic( renderer::Statistic::eDrawCall );
+		doRecord( CommandType::eDrawIndexedIndirect );
+	}
+
+	void CommandBuffer::drawIndirectCount( renderer::BufferBase const & buffer
+		, uint32_t offset
+		, renderer::BufferBase const & countBuffer
+		, uint32_t countBufferOffset
+		, uint32_t maxDrawCount
+		, uint32_t stride )const
+	{
+		doCheckDraw( false );
+		doCountStatistic( renderer::Statistic::eDrawCall );
+		doRecord( CommandType::eDrawIndirectCount );
+	}
+
+	void CommandBuffer::drawIndexedIndirectCount( renderer::BufferBase const & buffer
+		, uint32_t offset
+		, renderer::BufferBase const & countBuffer
+		, uint32_t countBufferOffset
+		, uint32_t maxDrawCount
+		, uint32_t stride )const
+	{
+		doCheckDraw( true );
+		doCountStatistic( renderer::Statistic::eDrawCall );
+		doRecord( CommandType::eDrawIndexedIndirectCount );
+	}
+
+	void CommandBuffer::copyToBuffer( renderer::BufferImageCopyArray const & copyInfo
+		, renderer::Texture const & src
+		, renderer::BufferBase const & dst )const
+	{
+		// Les textures n'ont pas de mémoire, le tampon n'est donc pas modifié.
+		doRecord( CommandType::eCopyImageToBuffer );
+	}
+
+	void CommandBuffer::copyBuffer( renderer::BufferCopy const & copyInfo
+		, renderer::BufferBase const & src
+		, renderer::BufferBase const & dst )const
+	{
+		assert( copyInfo.srcOffset + copyInfo.size <= src.getSize() );
+		assert( copyInfo.dstOffset + copyInfo.size <= dst.getSize() );
+		auto & source = static_cast< Buffer const & >( src );
+		auto & destination = static_cast< Buffer const & >( dst );
+		doRecord( CommandType::eCopyBuffer
+			, [copyInfo, &source, &destination]()
+			{
+				std::memmove( destination.getData() + copyInfo.dstOffset
+					, source.getData() + copyInfo.srcOffset
+					, copyInfo.size );
+			} );
+	}
+
+	void CommandBuffer::resetQueryPool( renderer::QueryPool const & pool
+		, uint32_t firstQuery
+		, uint32_t queryCount )const
+	{
+		auto & queryPool = static_cast< QueryPool const & >( pool );
+		doRecord( CommandType::eResetQueryPool
+			, [&queryPool, firstQuery, queryCount]()
+			{
+				queryPool.reset( firstQuery, queryCount );
+			} );
+	}
+
+	void CommandBuffer::beginQuery( renderer::QueryPool const & pool
+		, uint32_t query
+		, renderer::QueryControlFlags flags )const
+	{
+		doRecord( CommandType::eBeginQuery );
+	}
+
+	void CommandBuffer::endQuery( renderer::QueryPool const & pool
+		, uint32_t query )const
+	{
+		// Rien n'est rendu, les requêtes d'occlusion et de statistiques donnent donc 0.
+		auto & queryPool = static_cast< QueryPool const & >( pool );
+		doRecord( CommandType::eEndQuery
+			, [&queryPool, query]()
+			{
+				queryPool.setResult( query, 0u );
+			} );
+	}
+
+	void CommandBuffer::writeTimestamp( renderer::PipelineStageFlag pipelineStage
+		, renderer::QueryPool const & pool
+		, uint32_t query )const
+	{
+		auto & queryPool = static_cast< QueryPool const & >( pool );
+		doRecord( CommandType::eWriteTimestamp
+			, [&queryPool, query]()
+			{
+				queryPool.setResult( query, getTimestamp() );
+			} );
+	}
+
+	void CommandBuffer::copyQueryPoolResults( renderer::QueryPool const & pool
+		, uint32_t firstQuery
+		, uint32_t queryCount
+		, renderer::BufferBase const & dstBuffer
+		, uint32_t dstOffset
+		, uint32_t stride
+		, renderer::QueryResultFlags flags )const
+	{
+		auto & queryPool = static_cast< QueryPool const & >( pool );
+		auto & destination = static_cast< Buffer const & >( dstBuffer );
+		doRecord( CommandType::eCopyQueryPoolResults
+			, [&queryPool, &destination, firstQuery, queryCount, dstOffset, stride, flags]()
+			{
+				queryPool.copyResults( firstQuery
+					, queryCount
+					, destination.getData() + dstOffset
+					, stride
+					, flags );
+			} );
+	}
+
+	void CommandBuffer::pushConstants( renderer::PipelineLayout const & layout
+		, renderer::PushConstantsBufferBase const & pcb )const
+	{
+		doRecord( CommandType::ePushConstants );
+	}
+
+	void CommandBuffer::dispatch( uint32_t groupCountX
+		, uint32_t groupCountY
+		, uint32_t groupCountZ )const
+	{
+		doCheckDispatch();
+		doCountStatistic( renderer::Statistic::eDispatch );
+		doRecord( CommandType::eDispatch );
+	}
+
+	void CommandBuffer::dispatchIndirect( renderer::BufferBase const & buffer
+		, uint32_t offset )const
+	{
+		doCheckDispatch();
+		doCountStatistic( renderer::Statistic::eDispatch );
+		doRecord( CommandType::eDispatchIndirect );
+	}
+
+	void CommandBuffer::setLineWidth( float width )const
+	{
+		doRecord( CommandType::eSetLineWidth );
+	}
+
+	void CommandBuffer::execute()const
+	{
+		assert( !m_state.recording && "The command buffer is still being recorded." );
+
+		for ( auto & command : m_commands )
+		{
+			if ( command.action )
+			{
+				command.action();
+			}
+		}
+	}
+
+	void CommandBuffer::doBeginRenderPass( renderer::RenderPass const & renderPass
+		, renderer::FrameBuffer const & frameBuffer
+		, renderer::ClearValueArray const & clearValues
+		, renderer::SubpassContents contents )const
+	{
+		assert( !m_state.renderPass && "A render pass is already begun." );
+		assert( frameBuffer.getSize() == renderPass.getSize()
+			&& "The frame buffer doesn't match the render pass attachments." );
+		m_state.renderPass = &renderPass;
+		m_state.subpass = 0u;
+		doRecord( CommandType::eBeginRenderPass );
+	}
+
+	void CommandBuffer::doMemoryBarrier( renderer::PipelineStageFlags after
+		, renderer::PipelineStageFlags before
+		, renderer::BufferMemoryBarrier const & transitionBarrier )const
+	{
+		doRecord( CommandType::eBufferMemoryBarrier );
+	}
+
+	void CommandBuffer::doMemoryBarrier( renderer::PipelineStageFlags after
+		, renderer::PipelineStageFlags before
+		, renderer::ImageMemoryBarrier const & transitionBarrier )const
+	{
+		doRecord( CommandType::eImageMemoryBarrier );
+	}
+
+	void CommandBuffer::doCopyToImage( renderer::BufferImageCopyArray const & copyInfo
+		, renderer::BufferBase const & src
+		, renderer::Texture const & dst )const
+	{
+		doRecord( CommandType::eCopyBufferToImage );
+	}
+
+	void CommandBuffer::doCopyImage( renderer::ImageCopy const & copyInfo
+		, renderer::TextureView const & src
+		, renderer::TextureView const & dst )const
+	{
+		doRecord( CommandType::eCopyImage );
+	}
+
+	void CommandBuffer::doBlitImage( renderer::Texture const & srcImage
+		, renderer::ImageLayout srcLayout
+		, renderer::Texture const & dstImage
+		, renderer::ImageLayout dstLayout
+		, std::vector< renderer::ImageBlit > const & regions
+		, renderer::Filter filter )const
+	{
+		doRecord( CommandType::eBlitImage );
+	}
+
+	void CommandBuffer::doGenerateMipmaps( renderer::Texture const & texture
+		, uint32_t baseMipLevel
+		, renderer::ResourceState const & finalState )const
+	{
+		doRecord( CommandType::eGenerateMipmaps );
+	}
+
+	void CommandBuffer::doRecord( CommandType type
+		, std::function< void() > action )const
+	{
+		assert( m_state.recording && "The command buffer isn't being recorded." );
+		m_commands.push_back( { type, std::move( action ) } );
+	}
+
+	void CommandBuffer::doCheckDraw( bool indexed )const
+	{
+		assert( m_state.renderPass && "Draws must happen inside a render pass." );
+		assert( m_state.pipeline && "No graphics pipeline is bound." );
+		assert( ( !indexed || m_state.indexBuffer ) && "No index buffer is bound." );
+		assert( std::all_of( m_state.pipeline->getCreateInfo().vertexInputState.vertexBindingDescriptions.begin()
+				, m_state.pipeline->getCreateInfo().vertexInputState.vertexBindingDescriptions.end()
+				, [this]( renderer::VertexInputBindingDescription const & binding )
+				{
+					return binding.binding < m_state.vertexBuffers.size()
+						&& m_state.vertexBuffers[binding.binding] != nullptr;
+				} )
+			&& "A vertex buffer used by the pipeline isn't bound." );
+		assert( areDescriptorSetsBound( m_state.graphicsDescriptorSets, m_state.pipeline->getLayout() )
+			&& "A descriptor set used by the pipeline isn't bound." );
+	}
+
+	void CommandBuffer::doCheckDispatch()const
+	{
+		assert( !m_state.renderPass && "Dispatches can't happen inside a render pass." );
+		assert( m_state.computePipeline && "No compute pipeline is bound." );
+		assert( areDescriptorSetsBound( m_state.computeDescriptorSets, m_state.computePipeline->getLayout() )
+			&& "A descriptor set used by the pipeline isn't bound." );
+	}
+}
@@ -0,0 +1,382 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "NullRendererPrerequisites.hpp"
+
+#include <Command/CommandBuffer.hpp>
+
+namespace null_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Les types de commandes enregistrées.
+	*\~english
+	*\brief
+	*	The recorded commands types.
+	*/
+	enum class CommandType
+	{
+		eBeginRenderPass,
+		eNextSubpass,
+		eEndRenderPass,
+		eExecuteCommands,
+		eClearColour,
+		eClearDepthStencil,
+		eClearAttachments,
+		eBindPipeline,
+		eBindComputePipeline,
+		eBindVertexBuffers,
+		eBindIndexBuffer,
+		eBindDescriptorSets,
+		eSetViewport,
+		eSetScissor,
+		eSetLineWidth,
+		eDraw,
+		eDrawIndexed,
+		eDrawIndirect,
+		eDrawIndexedIndirect,
+		eDrawIndirectCount,
+		eDrawIndexedIndirectCount,
+		eDispatch,
+		eDispatchIndirect,
+		ePushConstants,
+		eCopyBuffer,
+		eCopyBufferToImage,
+		eCopyImageToBuffer,
+		eCopyImage,
+		eBlitImage,
+		eGenerateMipmaps,
+		eBufferMemoryBarrier,
+		eImageMemoryBarrier,
+		eResetQueryPool,
+		eBeginQuery,
+		eEndQuery,
+		eWriteTimestamp,
+		eCopyQueryPoolResults,
+	};
+	/**
+	*\~french
+	*\brief
+	*	Une commande enregistrée.
+	*\~english
+	*\brief
+	*	A recorded command.
+	*/
+	struct Command
+	{
+		CommandType type;
+		//! L'effet de la commande à son exécution, vide si elle n'en a pas.
+		//! The command's effect when it is executed, empty if it has none.
+		std::function< void() > action;
+	};
+	using CommandArray = std::vector< Command >;
+	/**
+	*\~french
+	*\brief
+	*	Tampon de commandes qui enregistre les commandes sans appel à une API graphique.
+	*\remarks
+	*	L'état lié (pipelines, passe de rendu, tampons, descripteurs) est suivi,
+	*	et vérifié par des assertions lors des dessins et des dispatchs.
+	*	Seules les commandes ayant un effet visible côté CPU ont une action, jouée par la file à la soumission.
+	*\~english
+	*\brief
+	*	Command buffer which records the commands without calls to a graphics API.
+	*\remarks
+	*	The bound state (pipelines, render pass, buffers, descriptors) is tracked,
+	*	and checked through assertions on draws and dispatches.
+	*	Only the commands with a CPU visible effect have an action, played by the queue at submission.
+	*/
+	class CommandBuffer
+		: public renderer::CommandBuffer
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] pool
+		*	Le pool de tampons de commandes.
+		*\param[in] primary
+		*	Dit si le tampon est un tampon de commandes primaire (\p true) ou secondaire (\p false).
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] pool
+		*	The command buffers pool.
+		*\param[in] primary
+		*	Tells if the buffer is a primary command buffer (\p true) or a secondary one (\p false).
+		*/
+		CommandBuffer( renderer::Device const & device
+			, renderer::CommandPool const & pool
+			, bool primary );
+		/**
+		*\copydoc	renderer::CommandBuffer::begin
+		*/
+		bool begin( renderer::CommandBufferUsageFlags flags )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::begin
+		*/
+		bool begin( renderer::CommandBufferUsageFlags flags
+			, renderer::CommandBufferInheritanceInfo const & inheritanceInfo )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::end
+		*/
+		bool end()const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::reset
+		*/
+		bool reset( renderer::CommandBufferResetFlags flags )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::nextSubpass
+		*/
+		void nextSubpass( renderer::SubpassContents contents )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::endRenderPass
+		*/
+		void endRenderPass()const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::executeCommands
+		*/
+		void executeCommands( renderer::CommandBufferCRefArray const & commands )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::clear
+		*/
+		void clear( renderer::TextureView const & image
+			, renderer::RgbaColour const & colour )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::clear
+		*/
+		void clear( renderer::TextureView const & image
+			, renderer::DepthStencilClearValue const & value )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::clearAttachments
+		*/
+		void clearAttachments( renderer::ClearAttachmentArray const & clearAttachments
+			, renderer::ClearRectArray const & clearRects )override;
+		/**
+		*\copydoc	renderer::CommandBuffer::bindPipeline
+		*/
+		void bindPipeline( renderer::Pipeline const & pipeline
+			, renderer::PipelineBindPoint bindingPoint )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::bindPipeline
+		*/
+		void bindPipeline( renderer::ComputePipeline const & pipeline
+			, renderer::PipelineBindPoint bindingPoint )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::bindVertexBuffers
+		*/
+		void bindVertexBuffers( uint32_t firstBinding
+			, renderer::BufferCRefArray const & buffers
+			, renderer::UInt64Array offsets )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::bindIndexBuffer
+		*/
+		void bindIndexBuffer( renderer::BufferBase const & buffer
+			, uint64_t offset
+			, renderer::IndexType indexType )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::bindDescriptorSets
+		*/
+		void bindDescriptorSets( renderer::DescriptorSetCRefArray const & descriptorSets
+			, renderer::PipelineLayout const & layout
+			, renderer::UInt32Array const & dynamicOffsets
+			, renderer::PipelineBindPoint bindingPoint )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::setViewport
+		*/
+		void setViewport( renderer::Viewport const & viewport )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::setScissor
+		*/
+		void setScissor( renderer::Scissor const & scissor )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::draw
+		*/
+		void draw( uint32_t vtxCount
+			, uint32_t instCount
+			, uint32_t firstVertex
+			, uint32_t firstInstance )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::drawIndexed
+		*/
+		void drawIndexed( uint32_t indexCount
+			, uint32_t instCount
+			, uint32_t firstIndex
+			, uint32_t vertexOffset
+			, uint32_t firstInstance )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::drawIndirect
+		*/
+		void drawIndirect( renderer::BufferBase const & buffer
+			, uint32_t offset
+			, uint32_t drawCount
+			, uint32_t stride )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::drawIndexedIndirect
+		*/
+		void drawIndexedIndirect( renderer::BufferBase const & buffer
+			, uint32_t offset
+			, uint32_t drawCount
+			, uint32_t stride )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::drawIndirectCount
+		*/
+		void drawIndirectCount( renderer::BufferBase const & buffer
+			, uint32_t offset
+			, renderer::BufferBase const & countBuffer
+			, uint32_t countBufferOffset
+			, uint32_t maxDrawCount
+			, uint32_t stride )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::drawIndexedIndirectCount
+		*/
+		void drawIndexedIndirectCount( renderer::BufferBase const & buffer
+			, uint32_t offset
+			, renderer::BufferBase const & countBuffer
+			, uint32_t countBufferOffset
+			, uint32_t maxDrawCount
+			, uint32_t stride )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::copyToBuffer
+		*/
+		void copyToBuffer( renderer::BufferImageCopyArray const & copyInfo
+			, renderer::Texture const & src
+			, renderer::BufferBase const & dst )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::copyBuffer
+		*/
+		void copyBuffer( renderer::BufferCopy const & copyInfo
+			, renderer::BufferBase const & src
+			, renderer::BufferBase const & dst )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::resetQueryPool
+		*/
+		void resetQueryPool( renderer::QueryPool const & pool
+			, uint32_t firstQuery
+			, uint32_t queryCount )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::beginQuery
+		*/
+		void beginQuery( renderer::QueryPool const & pool
+			, uint32_t query
+			, renderer::QueryControlFlags flags )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::endQuery
+		*/
+		void endQuery( renderer::QueryPool const & pool
+			, uint32_t query )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::writeTimestamp
+		*/
+		void writeTimestamp( renderer::PipelineStageFlag pipelineStage
+			, renderer::QueryPool const & pool
+			, uint32_t query )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::copyQueryPoolResults
+		*/
+		void copyQueryPoolResults( renderer::QueryPool const & pool
+			, uint32_t firstQuery
+			, uint32_t queryCount
+			, renderer::BufferBase const & dstBuffer
+			, uint32_t dstOffset
+			, uint32_t stride
+			, renderer::QueryResultFlags flags )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::pushConstants
+		*/
+		void pushConstants( renderer::PipelineLayout const & layout
+			, renderer::PushConstantsBufferBase const & pcb )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::dispatch
+		*/
+		void dispatch( uint32_t groupCountX
+			, uint32_t groupCountY
+			, uint32_t groupCountZ )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::dispatchIndirect
+		*/
+		void dispatchIndirect( renderer::BufferBase const & buffer
+			, uint32_t offset )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::setLineWidth
+		*/
+		void setLineWidth( float width )const override;
+		/**
+		*\~french
+		*\brief
+		*	Joue les actions des commandes enregistrées.
+		*\~english
+		*\brief
+		*	Plays the recorded commands actions.
+		*/
+		void execute()const;
+		/**
+		*\~french
+		*\return
+		*	Les commandes enregistrées.
+		*\~english
+		*\return
+		*	The recorded commands.
+		*/
+		inline CommandArray const & getCommands()const
+		{
+			return m_commands;
+		}
+
+	private:
+		void doBeginRenderPass( renderer::RenderPass const & renderPass
+			, renderer::FrameBuffer const & frameBuffer
+			, renderer::ClearValueArray const & clearValues
+			, renderer::SubpassContents contents )const override;
+		void doMemoryBarrier( renderer::PipelineStageFlags after
+			, renderer::PipelineStageFlags before
+			, renderer::BufferMemoryBarrier const & transitionBarrier )const override;
+		void doMemoryBarrier( renderer::PipelineStageFlags after
+			, renderer::PipelineStageFlags before
+			, renderer::ImageMemoryBarrier const & transitionBarrier )const override;
+		void doCopyToImage( renderer::BufferImageCopyArray const & copyInfo
+			, renderer::BufferBase const & src
+			, renderer::Texture const & dst )const override;
+		void doCopyImage( renderer::ImageCopy const & copyInfo
+			, renderer::TextureView const & src
+			, renderer::TextureView const & dst )const override;
+		void doBlitImage( renderer::Texture const & srcImage
+			, renderer::ImageLayout srcLayout
+			, renderer::Texture const & dstImage
+			, renderer::ImageLayout dstLayout
+			, std::vector< renderer::ImageBlit > const & regions
+			, renderer::Filter filter )const override;
+		void doGenerateMipmaps( renderer::Texture const & texture
+			, uint32_t baseMipLevel
+			, renderer::ResourceState const & finalState )const override;
+		void doRecord( CommandType type
+			, std::function< void() > action = nullptr )const;
+		void doCheckDraw( bool indexed )const;
+		void doCheckDispatch()const;
+
+	private:
+		struct State
+		{
+			bool recording{ false };
+			renderer::RenderPass const * renderPass{ nullptr };
+			uint32_t subpass{ 0u };
+			Pipeline const * pipeline{ nullptr };
+			ComputePipeline const * computePipeline{ nullptr };
+			std::vector< renderer::BufferBase const * > vertexBuffers;
+			renderer::BufferBase const * indexBuffer{ nullptr };
+			std::vector< renderer::DescriptorSet const * > graphicsDescriptorSets;
+			std::vector< renderer::DescriptorSet const * > computeDescriptorSets;
+		};
+		mutable CommandArray m_commands;
+		mutable State m_state;
+	};
+}
@@ -0,0 +1,24 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Command/NullCommandPool.hpp"
+
+#include "Command/NullCommandBuffer.hpp"
+
+namespace null_renderer
+{
+	CommandPool::CommandPool( renderer::Device const & device
+		, uint32_t queueFamilyIndex
+		, renderer::CommandPoolCreateFlags flags )
+		: renderer::CommandPool{ device, queueFamilyIndex, flags }
+	{
+	}
+
+	renderer::CommandBufferPtr CommandPool::createCommandBuffer( bool primary )const
+	{
+		return std::make_unique< CommandBuffer >( m_device
+			, *this
+			, primary );
+	}
+}
@@ -0,0 +1,53 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "NullRendererPrerequisites.hpp"
+
+#include <Command/CommandPool.hpp>
+
+namespace null_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Pool de tampons de commandes.
+	*\~english
+	*\brief
+	*	Command buffers pool.
+	*/
+	class CommandPool
+		: public renderer::CommandPool
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] queueFamilyIndex
+		*	L'index de la famille à laquelle appartient le pool.
+		*\param[in] flags
+		*	Combinaison binaire de CommandPoolCreateFlag.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] queueFamilyIndex
+		*	The index of the family the pool belongs to.
+		*\param[in] flags
+		*	Bitwise OR of CommandPoolCreateFlag.
+		*/
+		CommandPool( renderer::Device const & device
+			, uint32_t queueFamilyIndex
+			, renderer::CommandPoolCreateFlags flags = 0 );
+		/**
+		*\copydoc	renderer::CommandPool::createCommandBuffer
+		*/
+		renderer::CommandBufferPtr createCommandBuffer( bool primary )const override;
+	};
+}
@@ -0,0 +1,49 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Command/NullQueue.hpp"
+
+#include "Command/NullCommandBuffer.hpp"
+#include "Sync/NullFence.hpp"
+
+namespace null_renderer
+{
+	Queue::Queue()
+	{
+	}
+
+	bool Queue::submit( renderer::CommandBufferCRefArray const & commandBuffers
+		, renderer::SemaphoreCRefArray const & semaphoresToWait
+		, renderer::PipelineStageFlagsArray const & semaphoresStage
+		, renderer::SemaphoreCRefArray const & semaphoresToSignal
+		, renderer::Fence const * fence )const
+	{
+		for ( auto & commandBuffer : commandBuffers )
+		{
+			renderer::countStatistics( commandBuffer.get().getRecordedStatistics() );
+			static_cast< CommandBuffer const & >( commandBuffer.get() ).execute();
+		}
+
+		renderer::countStatistic( renderer::Statistic::eSubmittedCommandBuffer, commandBuffers.size() );
+
+		if ( fence )
+		{
+			static_cast< Fence const * >( fence )->signal();
+		}
+
+		return true;
+	}
+
+	bool Queue::present( renderer::SwapChainCRefArray const & swapChains
+		, renderer::UInt32Array const & imagesIndex
+		, renderer::SemaphoreCRefArray const & semaphoresToWait )const
+	{
+		return true;
+	}
+
+	bool Queue::waitIdle()const
+	{
+		return true;
+	}
+}
@@ -0,0 +1,64 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "NullRendererPrerequisites.hpp"
+
+#include <Command/Queue.hpp>
+
+namespace null_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	File exécutant les tampons de commandes pendant leur soumission.
+	*\remarks
+	*	Seules les commandes ayant un effet visible côté CPU (copies de tampons, requêtes) font quelque chose.
+	*\~english
+	*\brief
+	*	Queue executing the command buffers during their submission.
+	*\remarks
+	*	Only the commands with a CPU visible effect (buffer copies, queries) do something.
+	*/
+	class Queue
+		: public renderer::Queue
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\~english
+		*\brief
+		*	Constructor.
+		*/
+		Queue();
+		/**
+		*\copydoc	renderer::Queue::submit
+		*/
+		bool submit( renderer::CommandBufferCRefArray const & commandBuffers
+			, renderer::SemaphoreCRefArray const & semaphoresToWait
+			, renderer::PipelineStageFlagsArray const & semaphoresStage
+			, renderer::SemaphoreCRefArray const & semaphoresToSignal
+			, renderer::Fence const * fence )const override;
+		/**
+		*\copydoc	renderer::Queue::present
+		*/
+		bool present( renderer::SwapChainCRefArray const & swapChains
+			, renderer::UInt32Array const & imagesIndex
+			, renderer::SemaphoreCRefArray const & semaphoresToWait )const override;
+		/**
+		*\copydoc	renderer::Queue::waitIdle
+		*/
+		bool waitIdle()const override;
+		/**
+		*\copydoc	renderer::Queue::getFamilyIndex
+		*/
+		inline uint32_t getFamilyIndex()const override
+		{
+			return 0u;
+		}
+	};
+}
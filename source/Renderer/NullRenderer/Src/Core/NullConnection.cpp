@@ -0,0 +1,17 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Core/NullConnection.hpp"
+
+namespace null_renderer
+{
+	Connection::Connection( renderer::Renderer const & renderer
+		, uint32_t deviceIndex
+		, renderer::WindowHandle && handle )
+		: renderer::Connection{ renderer
+			, deviceIndex
+			, std::move( handle ) }
+	{
+	}
+}
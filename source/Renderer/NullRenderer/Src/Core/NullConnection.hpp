@@ -0,0 +1,49 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "NullRendererPrerequisites.hpp"
+
+#include <Core/Connection.hpp>
+
+namespace null_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Connexion à une fenêtre, qui n'est jamais utilisée.
+	*\~english
+	*\brief
+	*	Connection to a window, which is never used.
+	*/
+	class Connection
+		: public renderer::Connection
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] renderer
+		*	L'instance de Renderer.
+		*\param[in] deviceIndex
+		*	L'indice du périphérique physique.
+		*\param[in] handle
+		*	Le descripteur de la fenêtre.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] renderer
+		*	The Renderer instance.
+		*\param[in] deviceIndex
+		*	The physical device index.
+		*\param[in] handle
+		*	The window handle.
+		*/
+		Connection( renderer::Renderer const & renderer
+			, uint32_t deviceIndex
+			, renderer::WindowHandle && handle );
+	};
+}
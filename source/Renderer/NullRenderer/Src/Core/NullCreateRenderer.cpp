@@ -0,0 +1,10 @@
+#include "NullCreateRenderer.hpp"
+#include "Core/NullRenderer.hpp"
+
+extern "C"
+{
+	NullRenderer_API renderer::Renderer * createRenderer( renderer::Renderer::Configuration const & configuration )
+	{
+		return new null_renderer::Renderer{ configuration };
+	}
+}
@@ -0,0 +1,36 @@
+/**
+*\file
+*	NullCreateRenderer.h
+*\author
+*	Sylvain Doremus
+*/
+#pragma once
+
+#include <Core/Renderer.hpp>
+
+#if defined( _WIN32 ) && !defined( NullRenderer_STATIC_LIB )
+#	ifdef NullRenderer_EXPORTS
+#		define NullRenderer_API __declspec( dllexport )
+#	else
+#		define NullRenderer_API __declspec( dllimport )
+#	endif
+#else
+#	define NullRenderer_API
+#endif
+
+extern "C"
+{
+	/**
+	*\~french
+	*\brief
+	*	Crée un renderer sans API graphique.
+	*\param[in] configuration
+	*	La configuration de création.
+	*\~english
+	*\brief
+	*	Creates a renderer without graphics API.
+	*\param[in] configuration
+	*	The creation options.
+	*/
+	NullRenderer_API renderer::Renderer * createRenderer( renderer::Renderer::Configuration const & configuration );
+}
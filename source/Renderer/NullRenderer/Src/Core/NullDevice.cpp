@@ -0,0 +1,256 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Core/NullDevice.hpp"
+
+#include "Buffer/NullBuffer.hpp"
+#include "Buffer/NullBufferView.hpp"
+#include "Buffer/NullUniformBuffer.hpp"
+#include "Command/NullCommandPool.hpp"
+#include "Command/NullQueue.hpp"
+#include "Core/NullPhysicalDevice.hpp"
+#include "Core/NullSwapChain.hpp"
+#include "Descriptor/NullDescriptorSetLayout.hpp"
+#include "Image/NullSampler.hpp"
+#include "Image/NullTexture.hpp"
+#include "Miscellaneous/NullQueryPool.hpp"
+#include "Pipeline/NullPipelineLayout.hpp"
+#include "RenderPass/NullRenderPass.hpp"
+#include "RenderPass/NullRenderSubpass.hpp"
+#include "Shader/NullShaderModule.hpp"
+#include "Sync/NullFence.hpp"
+#include "Sync/NullSemaphore.hpp"
+
+namespace null_renderer
+{
+	Device::Device( renderer::Renderer const & renderer
+		, PhysicalDevice const & gpu
+		, renderer::ConnectionPtr && connection )
+		: renderer::Device{ renderer, gpu, *connection }
+		, m_connection{ std::move( connection ) }
+	{
+		m_timestampPeriod = gpu.getProperties().limits.timestampPeriod;
+		m_presentQueue = std::make_unique< Queue >();
+		m_computeQueue = std::make_unique< Queue >();
+		m_graphicsQueue = std::make_unique< Queue >();
+		m_presentCommandPool = std::make_unique< CommandPool >( *this, 0u );
+		m_computeCommandPool = std::make_unique< CommandPool >( *this, 0u );
+		m_graphicsCommandPool = std::make_unique< CommandPool >( *this, 0u );
+	}
+
+	renderer::RenderPassPtr Device::createRenderPass( renderer::RenderPassAttachmentArray const & attaches
+		, renderer::RenderSubpassPtrArray && subpasses
+		, renderer::RenderSubpassState const & initialState
+		, renderer::RenderSubpassState const & finalState )const
+	{
+		return std::make_unique< RenderPass >( *this
+			, attaches
+			, std::move( subpasses )
+			, initialState
+			, finalState );
+	}
+
+	renderer::RenderSubpassPtr Device::createRenderSubpass( renderer::PipelineBindPoint pipelineBindPoint
+		, renderer::RenderSubpassState const & state
+		, renderer::RenderSubpassAttachmentArray const & inputAttaches
+		, renderer::RenderSubpassAttachmentArray const & colourAttaches
+		, renderer::RenderSubpassAttachmentArray const & resolveAttaches
+		, renderer::RenderSubpassAttachment const * depthAttach
+		, renderer::UInt32Array const & preserveAttaches )const
+	{
+		return std::make_unique< RenderSubpass >( *this
+			, pipelineBindPoint
+			, state
+			, inputAttaches
+			, colourAttaches
+			, resolveAttaches
+			, depthAttach
+			, preserveAttaches );
+	}
+
+	renderer::PipelineLayoutPtr Device::createPipelineLayout( renderer::DescriptorSetLayoutCRefArray const & setLayouts
+		, renderer::PushConstantRangeCRefArray const & pushConstantRanges )const
+	{
+		return std::make_unique< PipelineLayout >( *this
+			, setLayouts
+			, pushConstantRanges );
+	}
+
+	renderer::DescriptorSetLayoutPtr Device::createDescriptorSetLayout( renderer::DescriptorSetLayoutBindingArray && bindings )const
+	{
+		return std::make_unique< DescriptorSetLayout >( *this, std::move( bindings ) );
+	}
+
+	renderer::TexturePtr Device::createTexture( renderer::ImageLayout initialLayout )const
+	{
+		return std::make_unique< Texture >( *this );
+	}
+
+	renderer::SamplerPtr Device::createSampler( renderer::WrapMode wrapS
+		, renderer::WrapMode wrapT
+		, renderer::WrapMode wrapR
+		, renderer::Filter minFilter
+		, renderer::Filter magFilter
+		, renderer::MipmapMode mipFilter
+		, float minLod
+		, float maxLod
+		, float lodBias
+		, renderer::BorderColour borderColour
+		, float maxAnisotropy
+		, renderer::CompareOp compareOp )const
+	{
+		return std::make_unique< Sampler >( *this
+			, wrapS
+			, wrapT
+			, wrapR
+			, minFilter
+			, magFilter
+			, mipFilter
+			, minLod
+			, maxLod
+			, lodBias
+			, borderColour
+			, maxAnisotropy
+			, compareOp );
+	}
+
+	renderer::BufferBasePtr Device::createBuffer( uint32_t size
+		, renderer::BufferTargets target
+		, renderer::MemoryPropertyFlags memoryFlags )const
+	{
+		return std::make_unique< Buffer >( *this
+			, size
+			, target
+			, memoryFlags );
+	}
+
+	renderer::BufferViewPtr Device::createBufferView( renderer::BufferBase const & buffer
+		, renderer::PixelFormat format
+		, uint32_t offset
+		, uint32_t range )const
+	{
+		return std::make_unique< BufferView >( *this
+			, buffer
+			, format
+			, offset
+			, range );
+	}
+
+	renderer::UniformBufferBasePtr Device::createUniformBuffer( uint32_t count
+		, uint32_t size
+		, renderer::BufferTargets target
+		, renderer::MemoryPropertyFlags memoryFlags )const
+	{
+		return std::make_unique< UniformBuffer >( *this
+			, count
+			, size
+			, target
+			, memoryFlags );
+	}
+
+	renderer::SwapChainPtr Device::createSwapChain( renderer::UIVec2 const & size )const
+	{
+		return std::make_unique< SwapChain >( *this, size );
+	}
+
+	renderer::SemaphorePtr Device::createSemaphore()const
+	{
+		return std::make_unique< Semaphore >( *this );
+	}
+
+	renderer::FencePtr Device::createFence( renderer::FenceCreateFlags flags )const
+	{
+		return std::make_unique< Fence >( *this, flags );
+	}
+
+	renderer::CommandPoolPtr Device::createCommandPool( uint32_t queueFamilyIndex
+		, renderer::CommandPoolCreateFlags const & flags )const
+	{
+		return std::make_unique< CommandPool >( *this
+			, queueFamilyIndex
+			, flags );
+	}
+
+	renderer::ShaderModulePtr Device::createShaderModule( renderer::ShaderStageFlag stage )const
+	{
+		return std::make_unique< ShaderModule >( stage );
+	}
+
+	renderer::QueryPoolPtr Device::createQueryPool( renderer::QueryType type
+		, uint32_t count
+		, renderer::QueryPipelineStatisticFlags pipelineStatistics )const
+	{
+		return std::make_unique< QueryPool >( *this
+			, type
+			, count
+			, pipelineStatistics );
+	}
+
+	void Device::waitIdle()const
+	{
+		// Les soumissions sont exécutées immédiatement, il n'y a jamais rien à attendre.
+	}
+
+	renderer::Mat4 Device::frustum( float left
+		, float right
+		, float bottom
+		, float top
+		, float zNear
+		, float zFar )const
+	{
+		renderer::Mat4 result( float( 0 ) );
+		result[0][0] = ( float( 2 ) * zNear ) / ( right - left );
+		result[1][1] = ( float( 2 ) * zNear ) / ( top - bottom );
+		result[2][0] = ( right + left ) / ( right - left );
+		result[2][1] = ( top + bottom ) / ( top - bottom );
+		result[2][3] = float( -1 );
+		result[2][2] = zFar / ( zNear - zFar );
+		result[3][2] = -( zFar * zNear ) / ( zFar - zNear );
+
+		return result;
+	}
+
+	renderer::Mat4 Device::perspective( renderer::Angle fovy
+		, float aspect
+		, float zNear
+		, float zFar )const
+	{
+		float const tanHalfFovy = tan( float( fovy ) / float( 2 ) );
+
+		renderer::Mat4 result( float( 0 ) );
+		result[0][0] = float( 1 ) / ( aspect * tanHalfFovy );
+		result[1][1] = float( 1 ) / ( tanHalfFovy );
+		result[2][3] = -float( 1 );
+		result[2][2] = zFar / ( zNear - zFar );
+		result[3][2] = -( zFar * zNear ) / ( zFar - zNear );
+
+		return result;
+	}
+
+	renderer::Mat4 Device::ortho( float left
+		, float right
+		, float bottom
+		, float top
+		, float zNear
+		, float zFar )const
+	{
+		renderer::Mat4 result{ 1 };
+		result[0][0] = float( 2 ) / ( right - left );
+		result[1][1] = float( 2 ) / ( top - bottom );
+		result[3][0] = -( right + left ) / ( right - left );
+		result[3][1] = -( top + bottom ) / ( top - bottom );
+		result[2][2] = -float( 1 ) / ( zFar - zNear );
+		result[3][2] = -zNear / ( zFar - zNear );
+
+		return result;
+	}
+
+	void Device::doEnable()const
+	{
+	}
+
+	void Device::doDisable()const
+	{
+	}
+}
@@ -0,0 +1,214 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Core/NullPhysicalDevice.hpp"
+
+#include "Core/NullRenderer.hpp"
+
+#include <cstring>
+
+namespace null_renderer
+{
+	PhysicalDevice::PhysicalDevice( Renderer & renderer )
+		: renderer::PhysicalDevice{ renderer }
+	{
+		initialise();
+	}
+
+	void PhysicalDevice::initialise()
+	{
+		m_properties.apiVersion = ( 1u << 22 );
+		m_properties.driverVersion = 0u;
+		m_properties.vendorID = 0u;
+		m_properties.deviceID = 0u;
+		m_properties.deviceType = renderer::PhysicalDeviceType::eCpu;
+		m_properties.deviceName = "Null";
+		std::memset( m_properties.pipelineCacheUUID, 0u, sizeof( m_properties.pipelineCacheUUID ) );
+
+		auto & limits = m_properties.limits;
+		limits.maxImageDimension1D = 16384u;
+		limits.maxImageDimension2D = 16384u;
+		limits.maxImageDimension3D = 2048u;
+		limits.maxImageDimensionCube = 16384u;
+		limits.maxImageArrayLayers = 2048u;
+		limits.maxTexelBufferElements = 128u * 1024u * 1024u;
+		limits.maxUniformBufferRange = 65536u;
+		limits.maxStorageBufferRange = renderer::NonAvailable< uint32_t >;
+		limits.maxPushConstantsSize = 256u;
+		limits.maxMemoryAllocationCount = renderer::NonAvailable< uint32_t >;
+		limits.maxSamplerAllocationCount = renderer::NonAvailable< uint32_t >;
+		limits.bufferImageGranularity = 1u;
+		limits.sparseAddressSpaceSize = renderer::NonAvailable< uint64_t >;
+		limits.maxBoundDescriptorSets = 32u;
+		limits.maxPerStageDescriptorSamplers = 1024u;
+		limits.maxPerStageDescriptorUniformBuffers = 1024u;
+		limits.maxPerStageDescriptorStorageBuffers = 1024u;
+		limits.maxPerStageDescriptorSampledImages = 1024u;
+		limits.maxPerStageDescriptorStorageImages = 1024u;
+		limits.maxPerStageDescriptorInputAttachments = 1024u;
+		limits.maxPerStageResources = 4096u;
+		limits.maxDescriptorSetSamplers = 4096u;
+		limits.maxDescriptorSetUniformBuffers = 4096u;
+		limits.maxDescriptorSetUniformBuffersDynamic = 64u;
+		limits.maxDescriptorSetStorageBuffers = 4096u;
+		limits.maxDescriptorSetStorageBuffersDynamic = 64u;
+		limits.maxDescriptorSetSampledImages = 4096u;
+		limits.maxDescriptorSetStorageImages = 4096u;
+		limits.maxDescriptorSetInputAttachments = 4096u;
+		limits.maxVertexInputAttributes = 32u;
+		limits.maxVertexInputBindings = 32u;
+		limits.maxVertexInputAttributeOffset = 2047u;
+		limits.maxVertexInputBindingStride = 2048u;
+		limits.maxVertexOutputComponents = 128u;
+		limits.maxTessellationGenerationLevel = 64u;
+		limits.maxTessellationPatchSize = 32u;
+		limits.maxTessellationControlPerVertexInputComponents = 128u;
+		limits.maxTessellationControlPerVertexOutputComponents = 128u;
+		limits.maxTessellationControlPerPatchOutputComponents = 120u;
+		limits.maxTessellationControlTotalOutputComponents = 4096u;
+		limits.maxTessellationEvaluationInputComponents = 128u;
+		limits.maxTessellationEvaluationOutputComponents = 128u;
+		limits.maxGeometryShaderInvocations = 32u;
+		limits.maxGeometryInputComponents = 128u;
+		limits.maxGeometryOutputComponents = 128u;
+		limits.maxGeometryOutputVertices = 256u;
+		limits.maxGeometryTotalOutputComponents = 1024u;
+		limits.maxFragmentInputComponents = 128u;
+		limits.maxFragmentOutputAttachments = 8u;
+		limits.maxFragmentDualSrcAttachments = 1u;
+		limits.maxFragmentCombinedOutputResources = 8u;
+		limits.maxComputeSharedMemorySize = 32768u;
+		limits.maxComputeWorkGroupCount[0] = 65535u;
+		limits.maxComputeWorkGroupCount[1] = 65535u;
+		limits.maxComputeWorkGroupCount[2] = 65535u;
+		limits.maxComputeWorkGroupInvocations = 1024u;
+		limits.maxComputeWorkGroupSize[0] = 1024u;
+		limits.maxComputeWorkGroupSize[1] = 1024u;
+		limits.maxComputeWorkGroupSize[2] = 64u;
+		limits.subPixelPrecisionBits = 8u;
+		limits.subTexelPrecisionBits = 8u;
+		limits.mipmapPrecisionBits = 8u;
+		limits.maxDrawIndexedIndexValue = renderer::NonAvailable< uint32_t >;
+		limits.maxDrawIndirectCount = renderer::NonAvailable< uint32_t >;
+		limits.maxSamplerLodBias = 16.0f;
+		limits.maxSamplerAnisotropy = 16.0f;
+		limits.maxViewports = 16u;
+		limits.maxViewportDimensions[0] = 16384u;
+		limits.maxViewportDimensions[1] = 16384u;
+		limits.viewportBoundsRange[0] = -32768.0f;
+		limits.viewportBoundsRange[1] = 32767.0f;
+		limits.viewportSubPixelBits = 8u;
+		limits.minMemoryMapAlignment = 64u;
+		limits.minTexelBufferOffsetAlignment = 16u;
+		limits.minUniformBufferOffsetAlignment = 256u;
+		limits.minStorageBufferOffsetAlignment = 16u;
+		limits.minTexelOffset = -8;
+		limits.maxTexelOffset = 7u;
+		limits.minTexelGatherOffset = -32;
+		limits.maxTexelGatherOffset = 31u;
+		limits.minInterpolationOffset = -0.5f;
+		limits.maxInterpolationOffset = 0.5f;
+		limits.subPixelInterpolationOffsetBits = 4u;
+		limits.maxFramebufferWidth = 16384u;
+		limits.maxFramebufferHeight = 16384u;
+		limits.maxFramebufferLayers = 2048u;
+		limits.framebufferColorSampleCounts = renderer::SampleCountFlag::e1
+			| renderer::SampleCountFlag::e2
+			| renderer::SampleCountFlag::e4
+			| renderer::SampleCountFlag::e8;
+		limits.framebufferDepthSampleCounts = limits.framebufferColorSampleCounts;
+		limits.framebufferStencilSampleCounts = limits.framebufferColorSampleCounts;
+		limits.framebufferNoAttachmentsSampleCounts = limits.framebufferColorSampleCounts;
+		limits.maxColorAttachments = 8u;
+		limits.sampledImageColorSampleCounts = limits.framebufferColorSampleCounts;
+		limits.sampledImageIntegerSampleCounts = renderer::SampleCountFlag::e1;
+		limits.sampledImageDepthSampleCounts = limits.framebufferColorSampleCounts;
+		limits.sampledImageStencilSampleCounts = limits.framebufferColorSampleCounts;
+		limits.storageImageSampleCounts = renderer::SampleCountFlag::e1;
+		limits.maxSampleMaskWords = 1u;
+		// Les timestamps sont lus sur l'horloge CPU, en nanosecondes.
+		limits.timestampComputeAndGraphics = true;
+		limits.timestampPeriod = 1.0f;
+		limits.maxClipDistances = 8u;
+		limits.maxCullDistances = 8u;
+		limits.maxCombinedClipAndCullDistances = 8u;
+		limits.discreteQueuePriorities = 2u;
+		limits.pointSizeRange[0] = 1.0f;
+		limits.pointSizeRange[1] = 64.0f;
+		limits.lineWidthRange[0] = 1.0f;
+		limits.lineWidthRange[1] = 8.0f;
+		limits.pointSizeGranularity = 1.0f;
+		limits.lineWidthGranularity = 1.0f;
+		limits.strictLines = true;
+		limits.standardSampleLocations = true;
+		limits.optimalBufferCopyOffsetAlignment = 1u;
+		limits.optimalBufferCopyRowPitchAlignment = 1u;
+		limits.nonCoherentAtomSize = 1u;
+
+		m_features.fullDrawIndexUint32 = true;
+		m_features.imageCubeArray = true;
+		m_features.independentBlend = true;
+		m_features.geometryShader = true;
+		m_features.tessellationShader = true;
+		m_features.sampleRateShading = true;
+		m_features.dualSrcBlend = true;
+		m_features.logicOp = true;
+		m_features.multiDrawIndirect = true;
+		m_features.drawIndirectFirstInstance = true;
+		m_features.depthClamp = true;
+		m_features.depthBiasClamp = true;
+		m_features.fillModeNonSolid = true;
+		m_features.depthBounds = true;
+		m_features.wideLines = true;
+		m_features.largePoints = true;
+		m_features.multiViewport = true;
+		m_features.samplerAnisotropy = true;
+		m_features.textureCompressionBC = true;
+		m_features.occlusionQueryPrecise = true;
+		m_features.pipelineStatisticsQuery = true;
+		m_features.vertexPipelineStoresAndAtomics = true;
+		m_features.fragmentStoresAndAtomics = true;
+		m_features.shaderImageGatherExtended = true;
+		m_features.shaderStorageImageExtendedFormats = true;
+		m_features.shaderUniformBufferArrayDynamicIndexing = true;
+		m_features.shaderSampledImageArrayDynamicIndexing = true;
+		m_features.shaderStorageBufferArrayDynamicIndexing = true;
+		m_features.shaderStorageImageArrayDynamicIndexing = true;
+		m_features.shaderClipDistance = true;
+		m_features.shaderCullDistance = true;
+		m_features.inheritedQueries = true;
+
+		// Une seule mémoire, visible par l'hôte, les tampons étant gardés en RAM.
+		m_memoryProperties.memoryHeaps.push_back( { 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF } );
+		m_memoryProperties.memoryTypes.push_back( { 0xFF, 0u } );
+
+		// Une seule famille de files, qui fait tout.
+		m_queueProperties.push_back(
+		{
+			0xFF,
+			1u,
+			64u,
+			{
+				1u,
+				1u,
+				1u,
+			}
+		} );
+	}
+
+	bool PhysicalDevice::isSPIRVSupported()const
+	{
+		return true;
+	}
+
+	bool PhysicalDevice::isGLSLSupported()const
+	{
+		return true;
+	}
+
+	bool PhysicalDevice::isDrawIndirectCountSupported()const
+	{
+		return true;
+	}
+}
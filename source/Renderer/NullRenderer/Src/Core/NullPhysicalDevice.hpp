@@ -0,0 +1,55 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "NullRendererPrerequisites.hpp"
+
+#include <Core/PhysicalDevice.hpp>
+
+namespace null_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Un GPU fictif, aux limites suffisamment larges pour toutes les applications.
+	*\~english
+	*\brief
+	*	A fake GPU, with limits wide enough for all the applications.
+	*/
+	class PhysicalDevice
+		: public renderer::PhysicalDevice
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] renderer
+		*	L'instance de rendu.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] renderer
+		*	The rendering instance.
+		*/
+		PhysicalDevice( Renderer & renderer );
+		/**
+		*\copydoc	renderer::PhysicalDevice::initialise
+		*/
+		void initialise()override;
+		/**
+		*\copydoc	renderer::PhysicalDevice::isSPIRVSupported
+		*/
+		bool isSPIRVSupported()const override;
+		/**
+		*\copydoc	renderer::PhysicalDevice::isGLSLSupported
+		*/
+		bool isGLSLSupported()const override;
+		/**
+		*\copydoc	renderer::PhysicalDevice::isDrawIndirectCountSupported
+		*/
+		bool isDrawIndirectCountSupported()const override;
+	};
+}
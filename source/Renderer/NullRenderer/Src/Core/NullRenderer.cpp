@@ -0,0 +1,29 @@
+#include "Core/NullRenderer.hpp"
+
+#include "Core/NullConnection.hpp"
+#include "Core/NullDevice.hpp"
+#include "Core/NullPhysicalDevice.hpp"
+
+namespace null_renderer
+{
+	Renderer::Renderer( Configuration const & configuration )
+		: renderer::Renderer{ renderer::ClipDirection::eTopDown, "null", configuration }
+	{
+		m_gpus.push_back( std::make_unique< PhysicalDevice >( *this ) );
+	}
+
+	renderer::DevicePtr Renderer::createDevice( renderer::ConnectionPtr && connection )const
+	{
+		return std::make_unique< Device >( *this
+			, static_cast< PhysicalDevice const & >( connection->getGpu() )
+			, std::move( connection ) );
+	}
+
+	renderer::ConnectionPtr Renderer::createConnection( uint32_t deviceIndex
+		, renderer::WindowHandle && handle )const
+	{
+		return std::make_unique< Connection >( *this
+			, deviceIndex
+			, std::move( handle ) );
+	}
+}
@@ -0,0 +1,56 @@
+/**
+*\file
+*	NullRenderer.h
+*\author
+*	Sylvain Doremus
+*/
+#pragma once
+
+#include "NullRendererPrerequisites.hpp"
+
+#include <Core/Renderer.hpp>
+
+namespace null_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Renderer n'appelant aucune API graphique.
+	*\remarks
+	*	Les ressources et les tampons de commandes sont gérés comme par les autres renderers,
+	*	sans rien envoyer à un GPU, ce qui permet de mesurer le coût CPU de l'application et de RendererLib.
+	*\~english
+	*\brief
+	*	Renderer calling no graphics API.
+	*\remarks
+	*	The resources and command buffers are managed as by the other renderers,
+	*	without sending anything to a GPU, which allows measuring the CPU cost of the application and RendererLib.
+	*/
+	class Renderer
+		: public renderer::Renderer
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] configuration
+		*	La configuration de création.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] configuration
+		*	The creation options.
+		*/
+		Renderer( Configuration const & configuration );
+		/**
+		*\copydoc	renderer::Renderer::createDevice
+		*/
+		renderer::DevicePtr createDevice( renderer::ConnectionPtr && connection )const override;
+		/**
+		*\copydoc	renderer::Renderer::createConnection
+		*/
+		renderer::ConnectionPtr createConnection( uint32_t deviceIndex
+			, renderer::WindowHandle && handle )const override;
+	};
+}
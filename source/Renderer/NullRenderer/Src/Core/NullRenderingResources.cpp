@@ -0,0 +1,34 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Core/NullRenderingResources.hpp"
+
+#include "Command/NullCommandBuffer.hpp"
+#include "Core/NullDevice.hpp"
+#include "Sync/NullFence.hpp"
+#include "Sync/NullSemaphore.hpp"
+
+namespace null_renderer
+{
+	RenderingResources::RenderingResources( Device const & device )
+		: renderer::RenderingResources{ device }
+	{
+		m_commandBuffer = m_device.getGraphicsCommandPool().createCommandBuffer();
+		m_imageAvailableSemaphore = std::make_unique< Semaphore >( m_device );
+		m_finishedRenderingSemaphore = std::make_unique< Semaphore >( m_device );
+		m_fence = std::make_unique< Fence >( m_device, renderer::FenceCreateFlag::eSignaled );
+	}
+
+	bool RenderingResources::waitRecord( uint32_t timeout )
+	{
+		bool res = m_fence->wait( timeout ) == renderer::WaitResult::eSuccess;
+
+		if ( res )
+		{
+			m_fence->reset();
+		}
+
+		return res;
+	}
+}
@@ -0,0 +1,43 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "NullRendererPrerequisites.hpp"
+
+#include <Core/RenderingResources.hpp>
+
+namespace null_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Classe regroupant les ressources de rendu nécessaires au dessin d'une image.
+	*\~english
+	*\brief
+	*	Gathers the rendering resources needed to draw an image.
+	*/
+	class RenderingResources
+		: public renderer::RenderingResources
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le Device parent.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The parent Device.
+		*/
+		RenderingResources( Device const & device );
+		/**
+		*\copydoc	renderer::RenderingResources::waitRecord
+		*/
+		bool waitRecord( uint32_t timeout )override;
+	};
+}
@@ -0,0 +1,143 @@
+#include "Core/NullSwapChain.hpp"
+
+#include "Command/NullCommandPool.hpp"
+#include "Core/NullDevice.hpp"
+#include "Core/NullRenderingResources.hpp"
+
+#include <RenderPass/FrameBufferAttachment.hpp>
+#include <RenderPass/RenderPass.hpp>
+
+#include <iostream>
+
+namespace null_renderer
+{
+	namespace
+	{
+		// Autant d'images que de ressources de rendu, comme pour les swap chains des autres renderers.
+		static uint32_t constexpr ImageCount = 3u;
+	}
+
+	SwapChain::SwapChain( Device const & device
+		, renderer::UIVec2 const & size )
+		: renderer::SwapChain{ device, size }
+		, m_device{ device }
+	{
+		doCreateImages();
+		m_renderingResources.resize( ImageCount );
+
+		for ( auto & resource : m_renderingResources )
+		{
+			resource = std::make_unique< RenderingResources >( device );
+		}
+	}
+
+	void SwapChain::reset( renderer::UIVec2 const & size )
+	{
+		m_dimensions = size;
+		doCreateImages();
+		onReset();
+	}
+
+	renderer::FrameBufferPtrArray SwapChain::createFrameBuffers( renderer::RenderPass const & renderPass )const
+	{
+		renderer::FrameBufferPtrArray result;
+		result.resize( m_images.size() );
+
+		for ( size_t i = 0u; i < result.size(); ++i )
+		{
+			result[i] = renderPass.createFrameBuffer( m_dimensions
+				, doPrepareAttaches( uint32_t( i ), renderPass.getAttaches() ) );
+		}
+
+		return result;
+	}
+
+	renderer::CommandBufferPtrArray SwapChain::createCommandBuffers()const
+	{
+		renderer::CommandBufferPtrArray result;
+		result.resize( m_images.size() );
+
+		for ( auto & commandBuffer : result )
+		{
+			commandBuffer = m_device.getGraphicsCommandPool().createCommandBuffer( true );
+		}
+
+		return result;
+	}
+
+	renderer::RenderingResources * SwapChain::getResources()
+	{
+		auto & resources = *m_renderingResources[m_resourceIndex];
+		m_resourceIndex = ( m_resourceIndex + 1 ) % m_renderingResources.size();
+
+		if ( resources.waitRecord( renderer::FenceTimeout ) )
+		{
+			resources.setBackBuffer( m_currentBuffer );
+			m_currentBuffer = ( m_currentBuffer + 1u ) % uint32_t( m_images.size() );
+			return &resources;
+		}
+
+		std::cerr << "Can't render: the rendering resources fence was never signaled" << std::endl;
+		return nullptr;
+	}
+
+	void SwapChain::present( renderer::RenderingResources & resources )
+	{
+		m_presented = resources.getBackBuffer();
+		resources.setBackBuffer( ~0u );
+		m_device.endFrameStatistics();
+	}
+
+	void SwapChain::doCreateImages()
+	{
+		m_depthView.reset();
+		m_depth.reset();
+		m_views.clear();
+		m_images.clear();
+		m_currentBuffer = 0u;
+		m_presented = 0u;
+
+		for ( uint32_t i = 0u; i < ImageCount; ++i )
+		{
+			auto image = m_device.createTexture( renderer::ImageLayout::eUndefined );
+			image->setImage( m_format
+				, m_dimensions
+				, renderer::ImageUsageFlag::eColourAttachment
+					| renderer::ImageUsageFlag::eTransferSrc
+					| renderer::ImageUsageFlag::eSampled );
+			m_views.push_back( image->createView( renderer::TextureType::e2D
+				, m_format ) );
+			m_images.push_back( std::move( image ) );
+		}
+	}
+
+	renderer::FrameBufferAttachmentArray SwapChain::doPrepareAttaches( uint32_t backBuffer
+		, renderer::RenderPassAttachmentArray const & attaches )const
+	{
+		renderer::FrameBufferAttachmentArray result;
+
+		for ( auto & attach : attaches )
+		{
+			if ( !renderer::isDepthOrStencilFormat( attach.format ) )
+			{
+				result.emplace_back( attach, *m_views[backBuffer] );
+			}
+			else
+			{
+				if ( !m_depth )
+				{
+					m_depth = m_device.createTexture( renderer::ImageLayout::eUndefined );
+					m_depth->setImage( attach.format
+						, getDimensions()
+						, renderer::ImageUsageFlag::eDepthStencilAttachment );
+					m_depthView = m_depth->createView( renderer::TextureType::e2D
+						, attach.format );
+				}
+
+				result.emplace_back( attach, *m_depthView );
+			}
+		}
+
+		return result;
+	}
+}
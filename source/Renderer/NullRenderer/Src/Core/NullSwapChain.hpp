@@ -0,0 +1,113 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#pragma once
+
+#include "NullRendererPrerequisites.hpp"
+
+#include <Core/SwapChain.hpp>
+#include <Image/Texture.hpp>
+#include <Image/TextureView.hpp>
+
+namespace null_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Swap chain rendant dans des textures, qu'elle ait une fenêtre ou non.
+	*\remarks
+	*	La présentation ne fait que retenir la dernière image rendue.
+	*\~english
+	*\brief
+	*	Swap chain rendering into textures, whether it has a window or not.
+	*\remarks
+	*	The presentation only keeps track of the last rendered image.
+	*/
+	class SwapChain
+		: public renderer::SwapChain
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	La connexion logique au GPU.
+		*\param[in] size
+		*	Les dimensions des images.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical connection to the GPU.
+		*\param[in] size
+		*	The images dimensions.
+		*/
+		SwapChain( Device const & device
+			, renderer::UIVec2 const & size );
+		/**
+		*\copydoc	renderer::SwapChain::reset
+		*/
+		void reset( renderer::UIVec2 const & size )override;
+		/**
+		*\copydoc	renderer::SwapChain::createFrameBuffers
+		*/
+		renderer::FrameBufferPtrArray createFrameBuffers( renderer::RenderPass const & renderPass )const override;
+		/**
+		*\copydoc	renderer::SwapChain::createCommandBuffers
+		*/
+		renderer::CommandBufferPtrArray createCommandBuffers()const override;
+		/**
+		*\copydoc	renderer::SwapChain::getResources
+		*/
+		renderer::RenderingResources * getResources()override;
+		/**
+		*\copydoc	renderer::SwapChain::present
+		*/
+		void present( renderer::RenderingResources & resources )override;
+		/**
+		*\copydoc	renderer::SwapChain::getOffscreenImage
+		*/
+		inline renderer::Texture const * getOffscreenImage()const override
+		{
+			return m_images[m_presented].get();
+		}
+
+		inline void setClearColour( renderer::RgbaColour const & value )override
+		{
+			m_clearColour = value;
+		}
+
+		inline renderer::RgbaColour getClearColour()const override
+		{
+			return m_clearColour;
+		}
+
+		inline renderer::UIVec2 getDimensions()const override
+		{
+			return m_dimensions;
+		}
+
+		inline renderer::PixelFormat getFormat()const override
+		{
+			return m_format;
+		}
+
+	private:
+		void doCreateImages();
+		renderer::FrameBufferAttachmentArray doPrepareAttaches( uint32_t backBuffer
+			, renderer::RenderPassAttachmentArray const & attaches )const;
+
+	private:
+		Device const & m_device;
+		renderer::PixelFormat m_format{ renderer::PixelFormat::eR8G8B8A8 };
+		renderer::RgbaColour m_clearColour{};
+		std::vector< renderer::TexturePtr > m_images;
+		std::vector< renderer::TextureViewPtr > m_views;
+		uint32_t m_currentBuffer{ 0u };
+		uint32_t m_presented{ 0u };
+		mutable renderer::TexturePtr m_depth;
+		mutable renderer::TextureViewPtr m_depthView;
+	};
+}
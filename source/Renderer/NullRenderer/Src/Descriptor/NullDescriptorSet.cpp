@@ -0,0 +1,147 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Descriptor/NullDescriptorSet.hpp"
+
+#include <Descriptor/DescriptorSetLayoutBinding.hpp>
+
+#include <algorithm>
+
+namespace null_renderer
+{
+	DescriptorSet::DescriptorSet( renderer::DescriptorSetPool const & pool
+		, uint32_t bindingPoint )
+		: renderer::DescriptorSet{ pool, bindingPoint }
+	{
+	}
+
+	renderer::CombinedTextureSamplerBinding const & DescriptorSet::createBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+		, renderer::TextureView const & view
+		, renderer::Sampler const & sampler
+		, renderer::ImageLayout layout
+		, uint32_t index )
+	{
+		return doCreateBinding< renderer::CombinedTextureSamplerBinding >( layoutBinding
+			, view
+			, sampler
+			, layout
+			, index );
+	}
+
+	renderer::SamplerBinding const & DescriptorSet::createBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+		, renderer::Sampler const & sampler
+		, uint32_t index )
+	{
+		return doCreateBinding< renderer::SamplerBinding >( layoutBinding
+			, sampler
+			, index );
+	}
+
+	renderer::SampledTextureBinding const & DescriptorSet::createBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+		, renderer::TextureView const & view
+		, renderer::ImageLayout layout
+		, uint32_t index )
+	{
+		return doCreateBinding< renderer::SampledTextureBinding >( layoutBinding
+			, view
+			, layout
+			, index );
+	}
+
+	renderer::StorageTextureBinding const & DescriptorSet::createBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+		, renderer::TextureView const & view
+		, uint32_t index )
+	{
+		return doCreateBinding< renderer::StorageTextureBinding >( layoutBinding
+			, view
+			, index );
+	}
+
+	renderer::UniformBufferBinding const & DescriptorSet::createBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+		, renderer::UniformBufferBase const & uniformBuffer
+		, uint32_t offset
+		, uint32_t range
+		, uint32_t index )
+	{
+		return doCreateBinding< renderer::UniformBufferBinding >( layoutBinding
+			, uniformBuffer
+			, offset
+			, range
+			, index );
+	}
+
+	renderer::StorageBufferBinding const & DescriptorSet::createBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+		, renderer::BufferBase const & storageBuffer
+		, uint32_t offset
+		, uint32_t range
+		, uint32_t index )
+	{
+		return doCreateBinding< renderer::StorageBufferBinding >( layoutBinding
+			, storageBuffer
+			, offset
+			, range
+			, index );
+	}
+
+	renderer::TexelBufferBinding const & DescriptorSet::createBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+		, renderer::BufferBase const & buffer
+		, renderer::BufferView const & view
+		, uint32_t index )
+	{
+		return doCreateBinding< renderer::TexelBufferBinding >( layoutBinding
+			, buffer
+			, view
+			, index );
+	}
+
+	renderer::DynamicUniformBufferBinding const & DescriptorSet::createDynamicBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+		, renderer::UniformBufferBase const & uniformBuffer
+		, uint32_t offset
+		, uint32_t range
+		, uint32_t index )
+	{
+		auto & result = doCreateBinding< renderer::DynamicUniformBufferBinding >( layoutBinding
+			, uniformBuffer
+			, offset
+			, range
+			, index );
+		m_dynamicBuffers.emplace_back( *m_bindings.back() );
+		return result;
+	}
+
+	renderer::DynamicStorageBufferBinding const & DescriptorSet::createDynamicBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+		, renderer::BufferBase const & storageBuffer
+		, uint32_t offset
+		, uint32_t range
+		, uint32_t index )
+	{
+		auto & result = doCreateBinding< renderer::DynamicStorageBufferBinding >( layoutBinding
+			, storageBuffer
+			, offset
+			, range
+			, index );
+		m_dynamicBuffers.emplace_back( *m_bindings.back() );
+		return result;
+	}
+
+	void DescriptorSet::update()const
+	{
+		std::sort( m_dynamicBuffers.begin()
+			, m_dynamicBuffers.end()
+			, []( std::reference_wrapper< renderer::DescriptorSetBinding > const & lhs
+				, std::reference_wrapper< renderer::DescriptorSetBinding > const & rhs )
+			{
+				return lhs.get().getBinding().getBindingPoint() < rhs.get().getBinding().getBindingPoint();
+			} );
+	}
+
+	template< typename BindingT, typename ... ParamsT >
+	BindingT const & DescriptorSet::doCreateBinding( ParamsT && ... params )
+	{
+		auto binding = std::make_unique< BindingT >( std::forward< ParamsT >( params )... );
+		auto & result = *binding;
+		m_bindings.emplace_back( std::move( binding ) );
+		return result;
+	}
+}
@@ -0,0 +1,148 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "NullRendererPrerequisites.hpp"
+
+#include <Descriptor/DescriptorSet.hpp>
+
+#include <vector>
+
+namespace null_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Set de descripteurs, qui garde ses attaches.
+	*\~english
+	*\brief
+	*	Descriptor set, which keeps its bindings.
+	*/
+	class DescriptorSet
+		: public renderer::DescriptorSet
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] pool
+		*	Le pool parent.
+		*\param[in] bindingPoint
+		*	Le point d'attache du set.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] pool
+		*	The parent pool.
+		*\param[in] bindingPoint
+		*	The set's binding point.
+		*/
+		DescriptorSet( renderer::DescriptorSetPool const & pool
+			, uint32_t bindingPoint );
+		/**
+		*\copydoc	renderer::DescriptorSet::createBinding
+		*/
+		renderer::CombinedTextureSamplerBinding const & createBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+			, renderer::TextureView const & view
+			, renderer::Sampler const & sampler
+			, renderer::ImageLayout layout
+			, uint32_t index )override;
+		/**
+		*\copydoc	renderer::DescriptorSet::createBinding
+		*/
+		renderer::SamplerBinding const & createBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+			, renderer::Sampler const & sampler
+			, uint32_t index )override;
+		/**
+		*\copydoc	renderer::DescriptorSet::createBinding
+		*/
+		renderer::SampledTextureBinding const & createBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+			, renderer::TextureView const & view
+			, renderer::ImageLayout layout
+			, uint32_t index )override;
+		/**
+		*\copydoc	renderer::DescriptorSet::createBinding
+		*/
+		renderer::StorageTextureBinding const & createBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+			, renderer::TextureView const & view
+			, uint32_t index )override;
+		/**
+		*\copydoc	renderer::DescriptorSet::createBinding
+		*/
+		renderer::UniformBufferBinding const & createBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+			, renderer::UniformBufferBase const & uniformBuffer
+			, uint32_t offset
+			, uint32_t range
+			, uint32_t index )override;
+		/**
+		*\copydoc	renderer::DescriptorSet::createBinding
+		*/
+		renderer::StorageBufferBinding const & createBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+			, renderer::BufferBase const & storageBuffer
+			, uint32_t offset
+			, uint32_t range
+			, uint32_t index )override;
+		/**
+		*\copydoc	renderer::DescriptorSet::createBinding
+		*/
+		renderer::TexelBufferBinding const & createBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+			, renderer::BufferBase const & buffer
+			, renderer::BufferView const & view
+			, uint32_t index )override;
+		/**
+		*\copydoc	renderer::DescriptorSet::createDynamicBinding
+		*/
+		renderer::DynamicUniformBufferBinding const & createDynamicBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+			, renderer::UniformBufferBase const & uniformBuffer
+			, uint32_t offset
+			, uint32_t range
+			, uint32_t index )override;
+		/**
+		*\copydoc	renderer::DescriptorSet::createDynamicBinding
+		*/
+		renderer::DynamicStorageBufferBinding const & createDynamicBinding( renderer::DescriptorSetLayoutBinding const & layoutBinding
+			, renderer::BufferBase const & storageBuffer
+			, uint32_t offset
+			, uint32_t range
+			, uint32_t index )override;
+		/**
+		*\copydoc	renderer::DescriptorSet::update
+		*/
+		void update()const override;
+		/**
+		*\~french
+		*\return
+		*	Les attaches du set, dynamiques comprises.
+		*\~english
+		*\return
+		*	The set's bindings, dynamic ones included.
+		*/
+		inline std::vector< std::unique_ptr< renderer::DescriptorSetBinding > > const & getBindings()const
+		{
+			return m_bindings;
+		}
+		/**
+		*\~french
+		*\return
+		*	Les attaches dynamiques, triées par point d'attache par update().
+		*\~english
+		*\return
+		*	The dynamic bindings, sorted by binding point by update().
+		*/
+		inline std::vector< std::reference_wrapper< renderer::DescriptorSetBinding > > const & getDynamicBuffers()const
+		{
+			return m_dynamicBuffers;
+		}
+
+	private:
+		template< typename BindingT, typename ... ParamsT >
+		BindingT const & doCreateBinding( ParamsT && ... params );
+
+	private:
+		std::vector< std::unique_ptr< renderer::DescriptorSetBinding > > m_bindings;
+		mutable std::vector< std::reference_wrapper< renderer::DescriptorSetBinding > > m_dynamicBuffers;
+	};
+}
@@ -0,0 +1,22 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Descriptor/NullDescriptorSetLayout.hpp"
+
+#include "Descriptor/NullDescriptorSetPool.hpp"
+
+namespace null_renderer
+{
+	DescriptorSetLayout::DescriptorSetLayout( renderer::Device const & device
+		, renderer::DescriptorSetLayoutBindingArray && bindings )
+		: renderer::DescriptorSetLayout{ device, std::move( bindings ) }
+	{
+	}
+
+	renderer::DescriptorSetPoolPtr DescriptorSetLayout::createPool( uint32_t maxSets
+		, bool automaticFree )const
+	{
+		return std::make_unique< DescriptorSetPool >( *this, maxSets, automaticFree );
+	}
+}
@@ -0,0 +1,49 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "NullRendererPrerequisites.hpp"
+
+#include <Descriptor/DescriptorSetLayout.hpp>
+
+namespace null_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Layout de set de descripteurs.
+	*\~english
+	*\brief
+	*	Descriptor set layout.
+	*/
+	class DescriptorSetLayout
+		: public renderer::DescriptorSetLayout
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] bindings
+		*	Les attaches du layout.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] bindings
+		*	The layout bindings.
+		*/
+		DescriptorSetLayout( renderer::Device const & device
+			, renderer::DescriptorSetLayoutBindingArray && bindings );
+		/**
+		*\copydoc	renderer::DescriptorSetLayout::createPool
+		*/
+		renderer::DescriptorSetPoolPtr createPool( uint32_t maxSets
+			, bool automaticFree )const override;
+	};
+}
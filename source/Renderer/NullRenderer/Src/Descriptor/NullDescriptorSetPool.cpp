@@ -0,0 +1,22 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Descriptor/NullDescriptorSetPool.hpp"
+
+#include "Descriptor/NullDescriptorSet.hpp"
+
+namespace null_renderer
+{
+	DescriptorSetPool::DescriptorSetPool( renderer::DescriptorSetLayout const & layout
+		, uint32_t maxSets
+		, bool automaticFree )
+		: renderer::DescriptorSetPool{ layout, maxSets }
+	{
+	}
+
+	renderer::DescriptorSetPtr DescriptorSetPool::createDescriptorSet( uint32_t bindingPoint )const
+	{
+		return std::make_unique< DescriptorSet >( *this, bindingPoint );
+	}
+}
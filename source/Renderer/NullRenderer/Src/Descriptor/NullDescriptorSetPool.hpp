@@ -0,0 +1,53 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "NullRendererPrerequisites.hpp"
+
+#include <Descriptor/DescriptorSetPool.hpp>
+
+namespace null_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Pool de sets de descripteurs.
+	*\~english
+	*\brief
+	*	Descriptor sets pool.
+	*/
+	class DescriptorSetPool
+		: public renderer::DescriptorSetPool
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] layout
+		*	Le layout à partir duquel sera créé le pool.
+		*\param[in] maxSets
+		*	Le nombre maximum de sets que le pool peut créer.
+		*\param[in] automaticFree
+		*	Dit si le pool libère automatiquement les sets qu'il a créés.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] layout
+		*	The layout from which the pool will be created.
+		*\param[in] maxSets
+		*	The maximum sets count the pool can create.
+		*\param[in] automaticFree
+		*	Tells if the pool automatically frees the sets it has created.
+		*/
+		DescriptorSetPool( renderer::DescriptorSetLayout const & layout
+			, uint32_t maxSets
+			, bool automaticFree );
+		/**
+		*\copydoc	renderer::DescriptorSetPool::createDescriptorSet
+		*/
+		renderer::DescriptorSetPtr createDescriptorSet( uint32_t bindingPoint )const override;
+	};
+}
@@ -0,0 +1,37 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Image/NullSampler.hpp"
+
+namespace null_renderer
+{
+	Sampler::Sampler( renderer::Device const & device
+		, renderer::WrapMode wrapS
+		, renderer::WrapMode wrapT
+		, renderer::WrapMode wrapR
+		, renderer::Filter minFilter
+		, renderer::Filter magFilter
+		, renderer::MipmapMode mipFilter
+		, float minLod
+		, float maxLod
+		, float lodBias
+		, renderer::BorderColour borderColour
+		, float maxAnisotropy
+		, renderer::CompareOp compareOp )
+		: renderer::Sampler{ device
+			, wrapS
+			, wrapT
+			, wrapR
+			, minFilter
+			, magFilter
+			, mipFilter
+			, minLod
+			, maxLod
+			, lodBias
+			, borderColour
+			, maxAnisotropy
+			, compareOp }
+	{
+	}
+}
@@ -0,0 +1,83 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "NullRendererPrerequisites.hpp"
+
+#include <Image/Sampler.hpp>
+
+namespace null_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Echantillonneur, qui ne fait que garder ses paramètres.
+	*\~english
+	*\brief
+	*	Sampler, which only keeps its parameters.
+	*/
+	class Sampler
+		: public renderer::Sampler
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] wrapS, wrapT, wrapR
+		*	Les modes de wrap de texture.
+		*\param[in] minFilter, magFilter
+		*	Les filtres de minification et magnification.
+		*\param[in] mipFilter
+		*	Le filtre de mipmap.
+		*\param[in] minLod, maxLod
+		*	Les bornes du niveau de détail.
+		*\param[in] lodBias
+		*	Le décalage de niveau de détail.
+		*\param[in] borderColour
+		*	La couleur de bordure.
+		*\param[in] maxAnisotropy
+		*	L'anisotropie maximale.
+		*\param[in] compareOp
+		*	L'opérateur de comparaison.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] wrapS, wrapT, wrapR
+		*	The texture wrap modes.
+		*\param[in] minFilter, magFilter
+		*	The minification and magnification filters.
+		*\param[in] mipFilter
+		*	The mipmap filter.
+		*\param[in] minLod, maxLod
+		*	The level of detail bounds.
+		*\param[in] lodBias
+		*	The level of detail bias.
+		*\param[in] borderColour
+		*	The border colour.
+		*\param[in] maxAnisotropy
+		*	The maximal anisotropy.
+		*\param[in] compareOp
+		*	The comparison operator.
+		*/
+		Sampler( renderer::Device const & device
+			, renderer::WrapMode wrapS
+			, renderer::WrapMode wrapT
+			, renderer::WrapMode wrapR
+			, renderer::Filter minFilter
+			, renderer::Filter magFilter
+			, renderer::MipmapMode mipFilter
+			, float minLod
+			, float maxLod
+			, float lodBias
+			, renderer::BorderColour borderColour
+			, float maxAnisotropy
+			, renderer::CompareOp compareOp );
+	};
+}
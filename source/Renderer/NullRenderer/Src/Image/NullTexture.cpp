@@ -0,0 +1,52 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Image/NullTexture.hpp"
+
+#include "Image/NullTextureView.hpp"
+
+namespace null_renderer
+{
+	Texture::Texture( renderer::Device const & device )
+		: renderer::Texture{ device }
+	{
+	}
+
+	renderer::TextureViewPtr Texture::createView( renderer::TextureType type
+		, renderer::PixelFormat format
+		, uint32_t baseMipLevel
+		, uint32_t levelCount
+		, uint32_t baseArrayLayer
+		, uint32_t layerCount
+		, renderer::ComponentMapping const & mapping )const
+	{
+		return std::make_shared< TextureView >( m_device
+			, *this
+			, type
+			, format
+			, baseMipLevel
+			, levelCount
+			, baseArrayLayer
+			, layerCount
+			, mapping );
+	}
+
+	void Texture::doSetImage1D( renderer::ImageUsageFlags usageFlags
+		, renderer::ImageTiling tiling
+		, renderer::MemoryPropertyFlags memoryFlags )
+	{
+	}
+
+	void Texture::doSetImage2D( renderer::ImageUsageFlags usageFlags
+		, renderer::ImageTiling tiling
+		, renderer::MemoryPropertyFlags memoryFlags )
+	{
+	}
+
+	void Texture::doSetImage3D( renderer::ImageUsageFlags usageFlags
+		, renderer::ImageTiling tiling
+		, renderer::MemoryPropertyFlags memoryFlags )
+	{
+	}
+}
@@ -0,0 +1,60 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "NullRendererPrerequisites.hpp"
+
+#include <Image/Texture.hpp>
+
+namespace null_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Texture, sans mémoire, les copies et mises à jour de ses images n'ont donc aucun effet.
+	*\~english
+	*\brief
+	*	Texture, without memory, the copies and updates of its images hence have no effect.
+	*/
+	class Texture
+		: public renderer::Texture
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*/
+		Texture( renderer::Device const & device );
+		/**
+		*\copydoc	renderer::Texture::createView
+		*/
+		renderer::TextureViewPtr createView( renderer::TextureType type
+			, renderer::PixelFormat format
+			, uint32_t baseMipLevel
+			, uint32_t levelCount
+			, uint32_t baseArrayLayer
+			, uint32_t layerCount
+			, renderer::ComponentMapping const & mapping )const override;
+
+	private:
+		void doSetImage1D( renderer::ImageUsageFlags usageFlags
+			, renderer::ImageTiling tiling
+			, renderer::MemoryPropertyFlags memoryFlags )override;
+		void doSetImage2D( renderer::ImageUsageFlags usageFlags
+			, renderer::ImageTiling tiling
+			, renderer::MemoryPropertyFlags memoryFlags )override;
+		void doSetImage3D( renderer::ImageUsageFlags usageFlags
+			, renderer::ImageTiling tiling
+			, renderer::MemoryPropertyFlags memoryFlags )override;
+	};
+}
@@ -0,0 +1,53 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Image/NullTextureView.hpp"
+
+#include "Image/NullTexture.hpp"
+
+#include <Sync/ImageMemoryBarrier.hpp>
+
+namespace null_renderer
+{
+	TextureView::TextureView( renderer::Device const & device
+		, Texture const & image
+		, renderer::TextureType type
+		, renderer::PixelFormat format
+		, uint32_t baseMipLevel
+		, uint32_t levelCount
+		, uint32_t baseArrayLayer
+		, uint32_t layerCount
+		, renderer::ComponentMapping const & mapping )
+		: renderer::TextureView{ device
+			, image
+			, type
+			, format
+			, baseMipLevel
+			, levelCount
+			, baseArrayLayer
+			, layerCount
+			, mapping }
+	{
+	}
+
+	renderer::ImageMemoryBarrier TextureView::doMakeLayoutTransition( renderer::ImageLayout srcLayout
+		, renderer::ImageLayout dstLayout
+		, renderer::AccessFlags srcAccessFlags
+		, renderer::AccessFlags dstAccessMask
+		, uint32_t srcQueueFamily
+		, uint32_t dstQueueFamily )const
+	{
+		return renderer::ImageMemoryBarrier
+		{
+			srcAccessFlags,
+			dstAccessMask,
+			srcLayout,
+			dstLayout,
+			srcQueueFamily,
+			dstQueueFamily,
+			getTexture(),
+			getSubResourceRange()
+		};
+	}
+}
@@ -0,0 +1,87 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "NullRendererPrerequisites.hpp"
+
+#include <Image/TextureView.hpp>
+
+namespace null_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Vue sur une texture, qui ne fait que garder ses paramètres.
+	*\~english
+	*\brief
+	*	View on a texture, which only keeps its parameters.
+	*/
+	class TextureView
+		: public renderer::TextureView
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] image
+		*	L'image sur laquelle la vue est créée.
+		*\param[in] type
+		*	Le type de texture de la vue.
+		*\param[in] format
+		*	Le format des pixels de la vue.
+		*\param[in] baseMipLevel
+		*	Le premier niveau de mipmap accessible à la vue.
+		*\param[in] levelCount
+		*	Le nombre de niveaux de mipmap (à partir de \p baseMipLevel) accessibles à la vue.
+		*\param[in] baseArrayLayer
+		*	La première couche de tableau accessible à la vue.
+		*\param[in] layerCount
+		*	Le nombre de couches de tableau (à partir de \p baseArrayLayer) accessibles à la vue.
+		*\param[in] mapping
+		*	Le mapping des composantes couleur.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] image
+		*	The image from which the view is created.
+		*\param[in] type
+		*	The view's texture type.
+		*\param[in] format
+		*	The view's pixels format.
+		*\param[in] baseMipLevel
+		*	The first mipmap level accessible to the view.
+		*\param[in] levelCount
+		*	The number of mipmap levels (starting from \p baseMipLevel) accessible to the view.
+		*\param[in] baseArrayLayer
+		*	The first array layer accessible to the view.
+		*\param[in] layerCount
+		*	The number of array layers (starting from \p baseArrayLayer) accessible to the view.
+		*\param[in] mapping
+		*	The colours component mapping.
+		*/
+		TextureView( renderer::Device const & device
+			, Texture const & image
+			, renderer::TextureType type
+			, renderer::PixelFormat format
+			, uint32_t baseMipLevel
+			, uint32_t levelCount
+			, uint32_t baseArrayLayer
+			, uint32_t layerCount
+			, renderer::ComponentMapping const & mapping );
+
+	private:
+		renderer::ImageMemoryBarrier doMakeLayoutTransition( renderer::ImageLayout srcLayout
+			, renderer::ImageLayout dstLayout
+			, renderer::AccessFlags srcAccessFlags
+			, renderer::AccessFlags dstAccessMask
+			, uint32_t srcQueueFamily
+			, uint32_t dstQueueFamily )const override;
+	};
+}
@@ -0,0 +1,132 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Miscellaneous/NullQueryPool.hpp"
+
+#include <algorithm>
+
+namespace null_renderer
+{
+	QueryPool::QueryPool( renderer::Device const & device
+		, renderer::QueryType type
+		, uint32_t count
+		, renderer::QueryPipelineStatisticFlags pipelineStatistics )
+		: renderer::QueryPool{ device, type, count, pipelineStatistics }
+		, m_values( count, 0u )
+		, m_available( count, false )
+	{
+	}
+
+	bool QueryPool::getResults( uint32_t firstQuery
+		, uint32_t queryCount
+		, uint32_t stride
+		, renderer::QueryResultFlags flags
+		, renderer::UInt32Array & data )const
+	{
+		return doGetResults( firstQuery
+			, queryCount
+			, stride
+			, flags
+			, data.data()
+			, data.size() );
+	}
+
+	bool QueryPool::getResults( uint32_t firstQuery
+		, uint32_t queryCount
+		, uint32_t stride
+		, renderer::QueryResultFlags flags
+		, renderer::UInt64Array & data )const
+	{
+		return doGetResults( firstQuery
+			, queryCount
+			, stride
+			, flags
+			, data.data()
+			, data.size() );
+	}
+
+	void QueryPool::copyResults( uint32_t firstQuery
+		, uint32_t queryCount
+		, uint8_t * dst
+		, uint32_t stride
+		, renderer::QueryResultFlags flags )const
+	{
+		auto withAvailability = checkFlag( flags, renderer::QueryResultFlag::eWithAvailability );
+		auto is64 = checkFlag( flags, renderer::QueryResultFlag::e64 );
+		auto count = withAvailability ? 2u : 1u;
+
+		if ( is64 )
+		{
+			doGetResults( firstQuery
+				, queryCount
+				, stride
+				, flags
+				, reinterpret_cast< uint64_t * >( dst )
+				, ( queryCount ? ( queryCount - 1u ) * ( stride / sizeof( uint64_t ) ) + count : 0u ) );
+		}
+		else
+		{
+			doGetResults( firstQuery
+				, queryCount
+				, stride
+				, flags
+				, reinterpret_cast< uint32_t * >( dst )
+				, ( queryCount ? ( queryCount - 1u ) * ( stride / sizeof( uint32_t ) ) + count : 0u ) );
+		}
+	}
+
+	void QueryPool::reset( uint32_t firstQuery
+		, uint32_t queryCount )const
+	{
+		assert( firstQuery + queryCount <= m_available.size() );
+		std::fill_n( m_values.begin() + firstQuery, queryCount, 0u );
+		std::fill_n( m_available.begin() + firstQuery, queryCount, false );
+	}
+
+	void QueryPool::setResult( uint32_t query
+		, uint64_t value )const
+	{
+		assert( query < m_available.size() );
+		m_values[query] = value;
+		m_available[query] = true;
+	}
+
+	template< typename T >
+	bool QueryPool::doGetResults( uint32_t firstQuery
+		, uint32_t queryCount
+		, uint32_t stride
+		, renderer::QueryResultFlags flags
+		, T * data
+		, size_t size )const
+	{
+		auto withAvailability = checkFlag( flags, renderer::QueryResultFlag::eWithAvailability );
+		size_t step = stride
+			? stride / sizeof( T )
+			: ( withAvailability ? 2u : 1u );
+		assert( firstQuery + queryCount <= m_available.size() );
+		assert( !queryCount || ( queryCount - 1u ) * step + ( withAvailability ? 2u : 1u ) <= size );
+		auto result = true;
+
+		// Les requêtes ne sont exécutées qu'à la soumission, sans GPU, eWait ne peut donc pas attendre.
+		for ( uint32_t i = 0u; i < queryCount; ++i )
+		{
+			bool available = m_available[firstQuery + i];
+
+			if ( available
+				|| checkFlag( flags, renderer::QueryResultFlag::ePartial ) )
+			{
+				data[i * step] = T( m_values[firstQuery + i] );
+			}
+
+			if ( withAvailability )
+			{
+				data[i * step + 1u] = T( available ? 1u : 0u );
+			}
+
+			result = result && available;
+		}
+
+		return result;
+	}
+}
@@ -0,0 +1,124 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "NullRendererPrerequisites.hpp"
+
+#include <Miscellaneous/QueryPool.hpp>
+
+namespace null_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Pool de requêtes dont les résultats sont écrits par les commandes à leur exécution.
+	*\remarks
+	*	Les timestamps sont pris sur renderer::Clock, en nanosecondes, les autres requêtes donnent 0.
+	*\~english
+	*\brief
+	*	Query pool whose results are written by the commands when they are executed.
+	*\remarks
+	*	The timestamps are taken from renderer::Clock, in nanoseconds, the other queries give 0.
+	*/
+	class QueryPool
+		: public renderer::QueryPool
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] type
+		*	Le type de requête.
+		*\param[in] count
+		*	Le nombre de requêtes gérées par le pool.
+		*\param[in] pipelineStatistics
+		*	Définit les compteurs que les requêtes retournent.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] type
+		*	The query type.
+		*\param[in] count
+		*	The number of queries managed by the pool.
+		*\param[in] pipelineStatistics
+		*	Specifies the counters to be returned in queries.
+		*/
+		QueryPool( renderer::Device const & device
+			, renderer::QueryType type
+			, uint32_t count
+			, renderer::QueryPipelineStatisticFlags pipelineStatistics );
+		/**
+		*\copydoc	renderer::QueryPool::getResults
+		*/
+		bool getResults( uint32_t firstQuery
+			, uint32_t queryCount
+			, uint32_t stride
+			, renderer::QueryResultFlags flags
+			, renderer::UInt32Array & data )const override;
+		/**
+		*\copydoc	renderer::QueryPool::getResults
+		*/
+		bool getResults( uint32_t firstQuery
+			, uint32_t queryCount
+			, uint32_t stride
+			, renderer::QueryResultFlags flags
+			, renderer::UInt64Array & data )const override;
+		/**
+		*\~french
+		*\brief
+		*	Ecrit les résultats de requêtes dans une mémoire, comme le fait CommandBuffer::copyQueryPoolResults.
+		*\param[in] stride
+		*	L'intervalle en octets entre les résultats de chaque requête.
+		*\~english
+		*\brief
+		*	Writes queries results into a memory, as CommandBuffer::copyQueryPoolResults does.
+		*\param[in] stride
+		*	The stride in bytes between each query's results.
+		*/
+		void copyResults( uint32_t firstQuery
+			, uint32_t queryCount
+			, uint8_t * dst
+			, uint32_t stride
+			, renderer::QueryResultFlags flags )const;
+		/**
+		*\~french
+		*\brief
+		*	Rend des requêtes indisponibles.
+		*\~english
+		*\brief
+		*	Makes queries unavailable.
+		*/
+		void reset( uint32_t firstQuery
+			, uint32_t queryCount )const;
+		/**
+		*\~french
+		*\brief
+		*	Définit le résultat d'une requête, qui devient disponible.
+		*\~english
+		*\brief
+		*	Sets a query's result, which becomes available.
+		*/
+		void setResult( uint32_t query
+			, uint64_t value )const;
+
+	private:
+		template< typename T >
+		bool doGetResults( uint32_t firstQuery
+			, uint32_t queryCount
+			, uint32_t stride
+			, renderer::QueryResultFlags flags
+			, T * data
+			, size_t size )const;
+
+	private:
+		mutable std::vector< uint64_t > m_values;
+		mutable std::vector< bool > m_available;
+	};
+}
@@ -0,0 +1 @@
+#include "NullRendererPch.hpp"
@@ -0,0 +1 @@
+#include "NullRendererPrerequisites.hpp"
@@ -0,0 +1,43 @@
+/**
+*\file
+*	NullRendererPrerequisites.h
+*\author
+*	Sylvain Doremus
+*/
+#pragma once
+
+#include <RendererPrerequisites.hpp>
+
+#include <functional>
+
+namespace null_renderer
+{
+	class Buffer;
+	class BufferView;
+	class CommandBuffer;
+	class CommandPool;
+	class ComputePipeline;
+	class Connection;
+	class DescriptorSet;
+	class DescriptorSetLayout;
+	class DescriptorSetPool;
+	class Device;
+	class Fence;
+	class FrameBuffer;
+	class PhysicalDevice;
+	class Pipeline;
+	class PipelineLayout;
+	class QueryPool;
+	class Queue;
+	class Renderer;
+	class RenderingResources;
+	class RenderPass;
+	class RenderSubpass;
+	class Sampler;
+	class Semaphore;
+	class ShaderModule;
+	class SwapChain;
+	class Texture;
+	class TextureView;
+	class UniformBuffer;
+}
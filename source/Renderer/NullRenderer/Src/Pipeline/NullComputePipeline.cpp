@@ -0,0 +1,17 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Pipeline/NullComputePipeline.hpp"
+
+namespace null_renderer
+{
+	ComputePipeline::ComputePipeline( renderer::Device const & device
+		, renderer::PipelineLayout const & layout
+		, renderer::ComputePipelineCreateInfo && createInfo )
+		: renderer::ComputePipeline{ device
+			, layout
+			, std::move( createInfo ) }
+	{
+	}
+}
@@ -0,0 +1,61 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "NullRendererPrerequisites.hpp"
+
+#include <Pipeline/ComputePipeline.hpp>
+
+namespace null_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Pipeline de calcul, qui garde ses informations de création.
+	*\~english
+	*\brief
+	*	Compute pipeline, which keeps its creation informations.
+	*/
+	class ComputePipeline
+		: public renderer::ComputePipeline
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le LogicalDevice parent.
+		*\param[in] layout
+		*	Le layout du pipeline.
+		*\param[in] createInfo
+		*	Les informations de création.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The parent LogicalDevice.
+		*\param[in] layout
+		*	The pipeline layout.
+		*\param[in] createInfo
+		*	The creation informations.
+		*/
+		ComputePipeline( renderer::Device const & device
+			, renderer::PipelineLayout const & layout
+			, renderer::ComputePipelineCreateInfo && createInfo );
+		/**
+		*\~french
+		*\return
+		*	Les informations de création.
+		*\~english
+		*\return
+		*	The creation informations.
+		*/
+		inline renderer::ComputePipelineCreateInfo const & getCreateInfo()const
+		{
+			return m_createInfo;
+		}
+	};
+}
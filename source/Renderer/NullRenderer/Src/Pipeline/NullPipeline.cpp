@@ -0,0 +1,17 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Pipeline/NullPipeline.hpp"
+
+namespace null_renderer
+{
+	Pipeline::Pipeline( renderer::Device const & device
+		, renderer::PipelineLayout const & layout
+		, renderer::GraphicsPipelineCreateInfo && createInfo )
+		: renderer::Pipeline{ device
+			, layout
+			, std::move( createInfo ) }
+	{
+	}
+}
@@ -0,0 +1,61 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "NullRendererPrerequisites.hpp"
+
+#include <Pipeline/Pipeline.hpp>
+
+namespace null_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Pipeline de rendu, qui garde ses informations de création.
+	*\~english
+	*\brief
+	*	Graphics pipeline, which keeps its creation informations.
+	*/
+	class Pipeline
+		: public renderer::Pipeline
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le LogicalDevice parent.
+		*\param[in] layout
+		*	Le layout du pipeline.
+		*\param[in] createInfo
+		*	Les informations de création.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The parent LogicalDevice.
+		*\param[in] layout
+		*	The pipeline layout.
+		*\param[in] createInfo
+		*	The creation informations.
+		*/
+		Pipeline( renderer::Device const & device
+			, renderer::PipelineLayout const & layout
+			, renderer::GraphicsPipelineCreateInfo && createInfo );
+		/**
+		*\~french
+		*\return
+		*	Les informations de création.
+		*\~english
+		*\return
+		*	The creation informations.
+		*/
+		inline renderer::GraphicsPipelineCreateInfo const & getCreateInfo()const
+		{
+			return m_createInfo;
+		}
+	};
+}
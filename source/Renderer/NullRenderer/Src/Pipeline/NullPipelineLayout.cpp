@@ -0,0 +1,34 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Pipeline/NullPipelineLayout.hpp"
+
+#include "Pipeline/NullComputePipeline.hpp"
+#include "Pipeline/NullPipeline.hpp"
+
+namespace null_renderer
+{
+	PipelineLayout::PipelineLayout( renderer::Device const & device
+		, renderer::DescriptorSetLayoutCRefArray const & setLayouts
+		, renderer::PushConstantRangeCRefArray const & pushConstantRanges )
+		: renderer::PipelineLayout{ device, setLayouts, pushConstantRanges }
+		, m_device{ device }
+		, m_setLayouts{ setLayouts }
+	{
+	}
+
+	renderer::PipelinePtr PipelineLayout::createPipeline( renderer::GraphicsPipelineCreateInfo && createInfo )const
+	{
+		return std::make_unique< Pipeline >( m_device
+			, *this
+			, std::move( createInfo ) );
+	}
+
+	renderer::ComputePipelinePtr PipelineLayout::createPipeline( renderer::ComputePipelineCreateInfo && createInfo )const
+	{
+		return std::make_unique< ComputePipeline >( m_device
+			, *this
+			, std::move( createInfo ) );
+	}
+}
@@ -0,0 +1,73 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "NullRendererPrerequisites.hpp"
+
+#include <Pipeline/PipelineLayout.hpp>
+
+namespace null_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Layout de pipeline, qui garde ses layouts d'ensembles de descripteurs.
+	*\~english
+	*\brief
+	*	Pipeline layout, which keeps its descriptor sets layouts.
+	*/
+	class PipelineLayout
+		: public renderer::PipelineLayout
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le LogicalDevice parent.
+		*\param[in] setLayouts
+		*	Les layouts des descripteurs du pipeline.
+		*\param[in] pushConstantRanges
+		*	Les intervalles de push constants.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The parent LogicalDevice.
+		*\param[in] setLayouts
+		*	The descriptor sets layouts.
+		*\param[in] pushConstantRanges
+		*	The push constants ranges.
+		*/
+		PipelineLayout( renderer::Device const & device
+			, renderer::DescriptorSetLayoutCRefArray const & setLayouts
+			, renderer::PushConstantRangeCRefArray const & pushConstantRanges );
+		/**
+		*\copydoc	renderer::PipelineLayout::createPipeline
+		*/
+		renderer::PipelinePtr createPipeline( renderer::GraphicsPipelineCreateInfo && createInfo )const override;
+		/**
+		*\copydoc	renderer::PipelineLayout::createPipeline
+		*/
+		renderer::ComputePipelinePtr createPipeline( renderer::ComputePipelineCreateInfo && createInfo )const override;
+		/**
+		*\~french
+		*\return
+		*	Les layouts des descripteurs du pipeline.
+		*\~english
+		*\return
+		*	The descriptor sets layouts.
+		*/
+		inline renderer::DescriptorSetLayoutCRefArray const & getDescriptorSetLayouts()const
+		{
+			return m_setLayouts;
+		}
+
+	private:
+		renderer::Device const & m_device;
+		renderer::DescriptorSetLayoutCRefArray m_setLayouts;
+	};
+}
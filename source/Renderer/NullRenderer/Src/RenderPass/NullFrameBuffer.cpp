@@ -0,0 +1,19 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "RenderPass/NullFrameBuffer.hpp"
+
+#include "RenderPass/NullRenderPass.hpp"
+
+namespace null_renderer
+{
+	FrameBuffer::FrameBuffer( RenderPass const & renderPass
+		, renderer::UIVec2 const & dimensions
+		, renderer::FrameBufferAttachmentArray && textures )
+		: renderer::FrameBuffer{ renderPass
+			, dimensions
+			, std::move( textures ) }
+	{
+	}
+}
@@ -0,0 +1,49 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "NullRendererPrerequisites.hpp"
+
+#include <RenderPass/FrameBuffer.hpp>
+
+namespace null_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Tampon d'images, qui ne fait que garder ses attaches.
+	*\~english
+	*\brief
+	*	Frame buffer, which only keeps its attachments.
+	*/
+	class FrameBuffer
+		: public renderer::FrameBuffer
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] renderPass
+		*	La passe de rendu.
+		*\param[in] dimensions
+		*	Les dimensions du tampon.
+		*\param[in] textures
+		*	Les textures attachées au tampon.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] renderPass
+		*	The render pass.
+		*\param[in] dimensions
+		*	The buffer dimensions.
+		*\param[in] textures
+		*	The textures attached to the buffer.
+		*/
+		FrameBuffer( RenderPass const & renderPass
+			, renderer::UIVec2 const & dimensions
+			, renderer::FrameBufferAttachmentArray && textures );
+	};
+}
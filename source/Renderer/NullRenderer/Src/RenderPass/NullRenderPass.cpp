@@ -0,0 +1,32 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "RenderPass/NullRenderPass.hpp"
+
+#include "RenderPass/NullFrameBuffer.hpp"
+#include "RenderPass/NullRenderSubpass.hpp"
+
+namespace null_renderer
+{
+	RenderPass::RenderPass( renderer::Device const & device
+		, renderer::RenderPassAttachmentArray const & attaches
+		, renderer::RenderSubpassPtrArray && subpasses
+		, renderer::RenderSubpassState const & initialState
+		, renderer::RenderSubpassState const & finalState )
+		: renderer::RenderPass{ device
+			, attaches
+			, std::move( subpasses )
+			, initialState
+			, finalState }
+	{
+	}
+
+	renderer::FrameBufferPtr RenderPass::createFrameBuffer( renderer::UIVec2 const & dimensions
+		, renderer::FrameBufferAttachmentArray && attaches )const
+	{
+		return std::make_unique< FrameBuffer >( *this
+			, dimensions
+			, std::move( attaches ) );
+	}
+}
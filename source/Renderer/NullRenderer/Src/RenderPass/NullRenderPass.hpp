@@ -0,0 +1,64 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "NullRendererPrerequisites.hpp"
+
+#include <RenderPass/RenderPass.hpp>
+
+namespace null_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Passe de rendu, qui ne fait que garder ses attaches et ses sous-passes.
+	*\~english
+	*\brief
+	*	Render pass, which only keeps its attachments and subpasses.
+	*/
+	class RenderPass
+		: public renderer::RenderPass
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	La connexion logique au GPU.
+		*\param[in] attaches
+		*	Les attaches de la passe.
+		*\param[in] subpasses
+		*	Les sous-passes (au moins 1 nécessaire).
+		*\param[in] initialState
+		*	L'état voulu en début de passe.
+		*\param[in] finalState
+		*	L'état voulu en fin de passe.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical connection to the GPU.
+		*\param[in] attaches
+		*	The pass attachments.
+		*\param[in] subpasses
+		*	The subpasses (at least one is needed).
+		*\param[in] initialState
+		*	The state wanted at the beginning of the pass.
+		*\param[in] finalState
+		*	The state attained at the end of the pass.
+		*/
+		RenderPass( renderer::Device const & device
+			, renderer::RenderPassAttachmentArray const & attaches
+			, renderer::RenderSubpassPtrArray && subpasses
+			, renderer::RenderSubpassState const & initialState
+			, renderer::RenderSubpassState const & finalState );
+		/**
+		*\copydoc	renderer::RenderPass::createFrameBuffer
+		*/
+		renderer::FrameBufferPtr createFrameBuffer( renderer::UIVec2 const & dimensions
+			, renderer::FrameBufferAttachmentArray && attaches )const override;
+	};
+}
@@ -0,0 +1,27 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "RenderPass/NullRenderSubpass.hpp"
+
+namespace null_renderer
+{
+	RenderSubpass::RenderSubpass( renderer::Device const & device
+		, renderer::PipelineBindPoint pipelineBindPoint
+		, renderer::RenderSubpassState const & state
+		, renderer::RenderSubpassAttachmentArray const & inputAttaches
+		, renderer::RenderSubpassAttachmentArray const & colourAttaches
+		, renderer::RenderSubpassAttachmentArray const & resolveAttaches
+		, renderer::RenderSubpassAttachment const * depthAttach
+		, renderer::UInt32Array const & preserveAttaches )
+		: renderer::RenderSubpass{ device
+			, pipelineBindPoint
+			, state
+			, inputAttaches
+			, colourAttaches
+			, resolveAttaches
+			, depthAttach
+			, preserveAttaches }
+	{
+	}
+}
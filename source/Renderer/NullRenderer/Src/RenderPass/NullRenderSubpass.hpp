@@ -0,0 +1,74 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "NullRendererPrerequisites.hpp"
+
+#include <RenderPass/RenderSubpass.hpp>
+
+namespace null_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Sous-passe de rendu, qui ne fait que garder ses attaches.
+	*\~english
+	*\brief
+	*	Render subpass, which only keeps its attachments.
+	*/
+	class RenderSubpass
+		: public renderer::RenderSubpass
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	La connexion logique au GPU.
+		*\param[in] pipelineBindPoint
+		*	Le point d'attache du pipeline.
+		*\param[in] state
+		*	L'état voulu en début de sous-passe.
+		*\param[in] inputAttaches
+		*	Les attaches en entrée.
+		*\param[in] colourAttaches
+		*	Les attaches couleur.
+		*\param[in] resolveAttaches
+		*	Les attaches de résolution.
+		*\param[in] depthAttach
+		*	L'attache profondeur et/ou stencil.
+		*\param[in] preserveAttaches
+		*	Les indices des attaches devant être préservées.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical connection to the GPU.
+		*\param[in] pipelineBindPoint
+		*	The pipeline bind point.
+		*\param[in] state
+		*	The state wanted at the beginning of the subpass.
+		*\param[in] inputAttaches
+		*	The input attachments.
+		*\param[in] colourAttaches
+		*	The colour attachments.
+		*\param[in] resolveAttaches
+		*	The resolve attachments.
+		*\param[in] depthAttach
+		*	The depth and/or stencil attachment.
+		*\param[in] preserveAttaches
+		*	The indices of attachments that must be preserved.
+		*/
+		RenderSubpass( renderer::Device const & device
+			, renderer::PipelineBindPoint pipelineBindPoint
+			, renderer::RenderSubpassState const & state
+			, renderer::RenderSubpassAttachmentArray const & inputAttaches
+			, renderer::RenderSubpassAttachmentArray const & colourAttaches
+			, renderer::RenderSubpassAttachmentArray const & resolveAttaches
+			, renderer::RenderSubpassAttachment const * depthAttach
+			, renderer::UInt32Array const & preserveAttaches );
+	};
+}
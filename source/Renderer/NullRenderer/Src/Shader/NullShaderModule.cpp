@@ -0,0 +1,25 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Shader/NullShaderModule.hpp"
+
+namespace null_renderer
+{
+	ShaderModule::ShaderModule( renderer::ShaderStageFlag stage )
+		: renderer::ShaderModule{ stage }
+	{
+	}
+
+	void ShaderModule::loadShader( std::string const & shader )
+	{
+		m_source = shader;
+		m_spirv.clear();
+	}
+
+	void ShaderModule::loadShader( renderer::ByteArray const & shader )
+	{
+		m_spirv = shader;
+		m_source.clear();
+	}
+}
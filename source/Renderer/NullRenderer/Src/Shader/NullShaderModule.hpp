@@ -0,0 +1,87 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "NullRendererPrerequisites.hpp"
+
+#include <Shader/ShaderModule.hpp>
+
+namespace null_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Module de shader, qui garde le code chargé sans le compiler.
+	*\~english
+	*\brief
+	*	Shader module, which keeps the loaded code without compiling it.
+	*/
+	class ShaderModule
+		: public renderer::ShaderModule
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] stage
+		*	Le niveau de shader utilisé pour le module.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] stage
+		*	The module's shader stage.
+		*/
+		ShaderModule( renderer::ShaderStageFlag stage );
+		/**
+		*\copydoc	renderer::ShaderModule::loadShader
+		*/
+		void loadShader( std::string const & shader )override;
+		/**
+		*\copydoc	renderer::ShaderModule::loadShader
+		*/
+		void loadShader( renderer::ByteArray const & shader )override;
+		/**
+		*\~french
+		*\return
+		*	\p true si le module a été chargé avec du SPIR-V.
+		*\~english
+		*\return
+		*	\p true if the module was loaded with SPIR-V.
+		*/
+		inline bool isSpirV()const
+		{
+			return !m_spirv.empty();
+		}
+		/**
+		*\~french
+		*\return
+		*	Le code GLSL chargé.
+		*\~english
+		*\return
+		*	The loaded GLSL code.
+		*/
+		inline std::string const & getSource()const
+		{
+			return m_source;
+		}
+		/**
+		*\~french
+		*\return
+		*	Le code SPIR-V chargé.
+		*\~english
+		*\return
+		*	The loaded SPIR-V code.
+		*/
+		inline renderer::ByteArray const & getSpirV()const
+		{
+			return m_spirv;
+		}
+
+	private:
+		std::string m_source;
+		renderer::ByteArray m_spirv;
+	};
+}
@@ -0,0 +1,32 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Sync/NullFence.hpp"
+
+namespace null_renderer
+{
+	Fence::Fence( renderer::Device const & device
+		, renderer::FenceCreateFlags flags )
+		: renderer::Fence{ device, flags }
+		, m_signaled{ checkFlag( flags, renderer::FenceCreateFlag::eSignaled ) }
+	{
+	}
+
+	renderer::WaitResult Fence::wait( uint32_t timeout )const
+	{
+		return m_signaled
+			? renderer::WaitResult::eSuccess
+			: renderer::WaitResult::eTimeOut;
+	}
+
+	void Fence::reset()const
+	{
+		m_signaled = false;
+	}
+
+	void Fence::signal()const
+	{
+		m_signaled = true;
+	}
+}
@@ -0,0 +1,68 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "NullRendererPrerequisites.hpp"
+
+#include <Sync/Fence.hpp>
+
+namespace null_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Barrière, signalée par la file lorsqu'elle a exécuté les commandes soumises.
+	*\remarks
+	*	La file exécute les commandes pendant la soumission, une barrière non signalée ne le sera donc jamais sans nouvelle soumission.
+	*\~english
+	*\brief
+	*	Fence, signaled by the queue when it has executed the submitted commands.
+	*\remarks
+	*	The queue executes the commands during the submission, an unsignaled fence will hence never be without a new submission.
+	*/
+	class Fence
+		: public renderer::Fence
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] flags
+		*	Les indicateurs de création de la barrière.
+		*\~english
+		*\brief
+		*	Constructor
+		*\param[in] device
+		*	The logical device.
+		*\param[in] flags
+		*	The fence creation flags.
+		*/
+		Fence( renderer::Device const & device
+			, renderer::FenceCreateFlags flags = 0 );
+		/**
+		*\copydoc	renderer::Fence::wait
+		*/
+		renderer::WaitResult wait( uint32_t timeout )const override;
+		/**
+		*\copydoc	renderer::Fence::reset
+		*/
+		void reset()const override;
+		/**
+		*\~french
+		*\brief
+		*	Signale la barrière.
+		*\~english
+		*\brief
+		*	Signals the fence.
+		*/
+		void signal()const;
+
+	private:
+		mutable bool m_signaled;
+	};
+}
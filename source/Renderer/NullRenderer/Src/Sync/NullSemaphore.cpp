@@ -0,0 +1,13 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Sync/NullSemaphore.hpp"
+
+namespace null_renderer
+{
+	Semaphore::Semaphore( renderer::Device const & device )
+		: renderer::Semaphore{ device }
+	{
+	}
+}
@@ -0,0 +1,39 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "NullRendererPrerequisites.hpp"
+
+#include <Sync/Semaphore.hpp>
+
+namespace null_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Sémaphore, inutile puisque les soumissions sont exécutées dans l'ordre, pendant l'appel.
+	*\~english
+	*\brief
+	*	Semaphore, useless since the submissions are executed in order, during the call.
+	*/
+	class Semaphore
+		: public renderer::Semaphore
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*/
+		explicit Semaphore( renderer::Device const & device );
+	};
+}
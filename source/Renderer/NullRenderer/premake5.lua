@@ -0,0 +1,37 @@
+project "NullRenderer"
+
+currentSourceDir = path.join( sourceDir, "Renderer", "NullRenderer" )
+currentBinaryDir = path.join( binaryDir, "Renderer", "NullRenderer" )
+
+kind( "SharedLib" )
+targetdir( path.join( outputDir, "%{cfg.architecture}", "%{cfg.buildcfg}", sharedLibDir ) )
+implibdir( path.join( outputDir, "%{cfg.architecture}", "%{cfg.buildcfg}", staticLibDir ) )
+location( currentBinaryDir )
+defines( "NullRenderer_EXPORTS" )
+
+includedirs{
+	path.join( sourceDir, "Core" ),
+	path.join( sourceDir, "Renderer", "Renderer", "Src" ),
+	path.join( binaryDir, "Renderer", "Renderer", "Src" ),
+	path.join( currentBinaryDir, "Src" ),
+	path.join( currentSourceDir, "Src" )
+}
+
+links{
+	"Utils",
+	"Renderer"
+}
+
+forceincludes( "NullRendererPch.hpp" )
+
+pchheader( "NullRendererPch.hpp" )
+pchsource( "./Src/NullRendererPch.cpp" )
+
+files{ "./Src/**.hpp",
+	"./Src/**.inl",
+	"./Src/**.cpp"
+}
+
+vpaths{ ["Header Files"] = "**.hpp" }
+vpaths{ ["Header Files"] = "**.inl" }
+vpaths{ ["Source Files"] = "**.cpp" }
@@ -7,6 +7,7 @@ See LICENSE file in root folder.
 #pragma once
 
 #include "Core/Device.hpp"
+#include "Sync/ResourceState.hpp"
 
 namespace renderer
 {
@@ -225,11 +226,51 @@ namespace renderer
 		{
 			return m_target;
 		}
+		/**
+		*\~english
+		*\return
+		*	The last access and stage recorded for the buffer.
+		*\~french
+		*\return
+		*	Le dernier accès et la dernière étape enregistrés pour le tampon.
+		*/
+		inline ResourceState const & getState()const
+		{
+			return m_state;
+		}
+		/**
+		*\~english
+		*\brief
+		*	Defines the tracked state of the buffer.
+		*\remarks
+		*	Called by command buffers when a barrier is recorded.
+		*\param[in] state
+		*	The new state.
+		*\~french
+		*\brief
+		*	Définit l'état suivi du tampon.
+		*\remarks
+		*	Appelée par les tampons de commandes lors de l'enregistrement d'une barrière.
+		*\param[in] state
+		*	Le nouvel état.
+		*/
+		inline void setState( ResourceState const & state )const
+		{
+			m_state = state;
+		}
 
 	protected:
 		Device const & m_device;
 		uint32_t m_size;
 		BufferTargets m_target;
+
+	private:
+		mutable ResourceState m_state
+		{
+			ImageLayout::eUndefined,
+			AccessFlag::eMemoryWrite,
+			PipelineStageFlag::eAllCommands
+		};
 	};
 	/**
 	*\~english
@@ -6,8 +6,6 @@ See LICENSE file in root folder.
 
 #include "Image/Texture.hpp"
 #include "Image/TextureView.hpp"
-#include "Sync/BufferMemoryBarrier.hpp"
-#include "Sync/ImageMemoryBarrier.hpp"
 
 namespace renderer
 {
@@ -34,10 +32,10 @@ namespace renderer
 
 		if ( commandBuffer.begin( CommandBufferUsageFlag::eOneTimeSubmit ) )
 		{
-			commandBuffer.memoryBarrier( PipelineStageFlag::eTopOfPipe
-				, PipelineStageFlag::eTransfer
-				, view.makeTransferDestination( ImageLayout::eUndefined
-					, 0u ) );
+			commandBuffer.transition( view
+				, ImageLayout::eTransferDstOptimal
+				, AccessFlag::eTransferWrite
+				, PipelineStageFlag::eTransfer );
 			commandBuffer.copyToImage( BufferImageCopy
 				{
 					0u,
@@ -53,10 +51,10 @@ namespace renderer
 				}
 				, getBuffer()
 				, view.getTexture() );
-			commandBuffer.memoryBarrier( PipelineStageFlag::eTransfer
-				, PipelineStageFlag::eFragmentShader
-				, view.makeShaderInputResource( ImageLayout::eTransferDstOptimal
-					, renderer::AccessFlag::eTransferWrite ) );
+			commandBuffer.transition( view
+				, ImageLayout::eShaderReadOnlyOptimal
+				, AccessFlag::eShaderRead
+				, PipelineStageFlag::eFragmentShader );
 			bool res = commandBuffer.end();
 
 			if ( !res )
@@ -109,10 +107,10 @@ namespace renderer
 
 		if ( commandBuffer.begin( CommandBufferUsageFlag::eOneTimeSubmit ) )
 		{
-			commandBuffer.memoryBarrier( PipelineStageFlag::eTopOfPipe
-				, PipelineStageFlag::eTransfer
-				, view.makeTransferSource( ImageLayout::eUndefined
-					, 0u ) );
+			commandBuffer.transition( view
+				, ImageLayout::eTransferSrcOptimal
+				, AccessFlag::eTransferRead
+				, PipelineStageFlag::eTransfer );
 			commandBuffer.copyToBuffer( BufferImageCopy
 				{
 					0u,
@@ -128,10 +126,10 @@ namespace renderer
 				}
 				, view.getTexture()
 				, getBuffer() );
-			commandBuffer.memoryBarrier( PipelineStageFlag::eTransfer
-				, PipelineStageFlag::eFragmentShader
-				, view.makeShaderInputResource( ImageLayout::eTransferSrcOptimal
-					, renderer::AccessFlag::eTransferRead ) );
+			commandBuffer.transition( view
+				, ImageLayout::eShaderReadOnlyOptimal
+				, AccessFlag::eShaderRead
+				, PipelineStageFlag::eFragmentShader );
 			bool res = commandBuffer.end();
 
 			if ( !res )
@@ -191,6 +189,9 @@ namespace renderer
 			, size );
 		getBuffer().flush( 0u, size );
 		getBuffer().unlock();
+		getBuffer().setState( { ImageLayout::eUndefined
+			, AccessFlag::eHostWrite
+			, PipelineStageFlag::eHost } );
 	}
 
 	void StagingBuffer::doCopyFromStagingBuffer( CommandBuffer const & commandBuffer
@@ -201,12 +202,12 @@ namespace renderer
 		assert( size <= getBuffer().getSize() );
 		if ( commandBuffer.begin( CommandBufferUsageFlag::eOneTimeSubmit ) )
 		{
-			commandBuffer.memoryBarrier( PipelineStageFlag::eTransfer
-				, PipelineStageFlag::eTransfer
-				, getBuffer().makeTransferSource() );
-			commandBuffer.memoryBarrier( PipelineStageFlag::eTransfer
-				, PipelineStageFlag::eTransfer
-				, buffer.makeTransferDestination() );
+			commandBuffer.transition( getBuffer()
+				, AccessFlag::eTransferRead
+				, PipelineStageFlag::eTransfer );
+			commandBuffer.transition( buffer
+				, AccessFlag::eTransferWrite
+				, PipelineStageFlag::eTransfer );
 			commandBuffer.copyBuffer( getBuffer()
 				, buffer
 				, size
@@ -241,19 +242,19 @@ namespace renderer
 		assert( size <= getBuffer().getSize() );
 		if ( commandBuffer.begin( CommandBufferUsageFlag::eOneTimeSubmit ) )
 		{
-			commandBuffer.memoryBarrier( PipelineStageFlag::eTransfer
-				, PipelineStageFlag::eTransfer
-				, getBuffer().makeTransferSource() );
-			commandBuffer.memoryBarrier( PipelineStageFlag::eTransfer
-				, PipelineStageFlag::eTransfer
-				, buffer.getBuffer().makeTransferDestination() );
+			commandBuffer.transition( getBuffer()
+				, AccessFlag::eTransferRead
+				, PipelineStageFlag::eTransfer );
+			commandBuffer.transition( buffer.getBuffer()
+				, AccessFlag::eTransferWrite
+				, PipelineStageFlag::eTransfer );
 			commandBuffer.copyBuffer( getBuffer()
 				, buffer.getBuffer()
 				, size
 				, offset );
-			commandBuffer.memoryBarrier( PipelineStageFlag::eTransfer
-				, flags
-				, buffer.getBuffer().makeVertexShaderInputResource() );
+			commandBuffer.transition( buffer.getBuffer()
+				, AccessFlag::eVertexAttributeRead
+				, flags );
 			bool res = commandBuffer.end();
 
 			if ( !res )
@@ -283,19 +284,19 @@ namespace renderer
 	{
 		if ( commandBuffer.begin( CommandBufferUsageFlag::eOneTimeSubmit ) )
 		{
-			commandBuffer.memoryBarrier( PipelineStageFlag::eTransfer
-				, PipelineStageFlag::eTransfer
-				, getBuffer().makeTransferSource() );
-			commandBuffer.memoryBarrier( PipelineStageFlag::eTransfer
-				, PipelineStageFlag::eTransfer
-				, buffer.getBuffer().makeTransferDestination() );
+			commandBuffer.transition( getBuffer()
+				, AccessFlag::eTransferRead
+				, PipelineStageFlag::eTransfer );
+			commandBuffer.transition( buffer.getBuffer()
+				, AccessFlag::eTransferWrite
+				, PipelineStageFlag::eTransfer );
 			commandBuffer.copyBuffer( getBuffer()
 				, buffer.getBuffer()
 				, size
 				, offset );
-			commandBuffer.memoryBarrier( PipelineStageFlag::eTransfer
-				, flags
-				, buffer.getBuffer().makeUniformBufferInput() );
+			commandBuffer.transition( buffer.getBuffer()
+				, AccessFlag::eUniformRead
+				, flags );
 			bool res = commandBuffer.end();
 
 			if ( !res )
@@ -345,12 +346,12 @@ namespace renderer
 		assert( size <= getBuffer().getSize() );
 		if ( commandBuffer.begin( CommandBufferUsageFlag::eOneTimeSubmit ) )
 		{
-			commandBuffer.memoryBarrier( PipelineStageFlag::eTransfer
-				, PipelineStageFlag::eTransfer
-				, buffer.makeTransferSource() );
-			commandBuffer.memoryBarrier( PipelineStageFlag::eTransfer
-				, PipelineStageFlag::eTransfer
-				, getBuffer().makeTransferDestination() );
+			commandBuffer.transition( buffer
+				, AccessFlag::eTransferRead
+				, PipelineStageFlag::eTransfer );
+			commandBuffer.transition( getBuffer()
+				, AccessFlag::eTransferWrite
+				, PipelineStageFlag::eTransfer );
 			commandBuffer.copyBuffer( buffer
 				, getBuffer()
 				, size
@@ -385,19 +386,19 @@ namespace renderer
 		assert( size <= getBuffer().getSize() );
 		if ( commandBuffer.begin( CommandBufferUsageFlag::eOneTimeSubmit ) )
 		{
-			commandBuffer.memoryBarrier( PipelineStageFlag::eTransfer
-				, PipelineStageFlag::eTransfer
-				, buffer.getBuffer().makeTransferSource() );
-			commandBuffer.memoryBarrier( PipelineStageFlag::eTransfer
-				, PipelineStageFlag::eTransfer
-				, getBuffer().makeTransferDestination() );
+			commandBuffer.transition( buffer.getBuffer()
+				, AccessFlag::eTransferRead
+				, PipelineStageFlag::eTransfer );
+			commandBuffer.transition( getBuffer()
+				, AccessFlag::eTransferWrite
+				, PipelineStageFlag::eTransfer );
 			commandBuffer.copyBuffer( buffer.getBuffer()
 				, getBuffer()
 				, size
 				, offset );
-			commandBuffer.memoryBarrier( PipelineStageFlag::eTransfer
-				, flags
-				, buffer.getBuffer().makeVertexShaderInputResource() );
+			commandBuffer.transition( buffer.getBuffer()
+				, AccessFlag::eVertexAttributeRead
+				, flags );
 			bool res = commandBuffer.end();
 
 			if ( !res )
@@ -427,19 +428,19 @@ namespace renderer
 	{
 		if ( commandBuffer.begin( CommandBufferUsageFlag::eOneTimeSubmit ) )
 		{
-			commandBuffer.memoryBarrier( PipelineStageFlag::eTransfer
-				, PipelineStageFlag::eTransfer
-				, buffer.getBuffer().makeTransferSource() );
-			commandBuffer.memoryBarrier( PipelineStageFlag::eTransfer
-				, PipelineStageFlag::eTransfer
-				, getBuffer().makeTransferDestination() );
+			commandBuffer.transition( buffer.getBuffer()
+				, AccessFlag::eTransferRead
+				, PipelineStageFlag::eTransfer );
+			commandBuffer.transition( getBuffer()
+				, AccessFlag::eTransferWrite
+				, PipelineStageFlag::eTransfer );
 			commandBuffer.copyBuffer( buffer.getBuffer()
 				, getBuffer()
 				, size
 				, offset );
-			commandBuffer.memoryBarrier( PipelineStageFlag::eTransfer
-				, flags
-				, buffer.getBuffer().makeUniformBufferInput() );
+			commandBuffer.transition( buffer.getBuffer()
+				, AccessFlag::eUniformRead
+				, flags );
 			bool res = commandBuffer.end();
 
 			if ( !res )
@@ -386,7 +386,6 @@ namespace renderer
 
 	protected:
 		Device const & m_device;
-		AccessFlags m_currentAccessMask{ AccessFlag::eMemoryWrite };
 		BufferBasePtr m_buffer;
 	};
 }
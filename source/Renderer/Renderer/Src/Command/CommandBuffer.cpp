@@ -9,15 +9,310 @@ See LICENSE file in root folder.
 #include "Image/ImageSubresourceRange.hpp"
 #include "Image/Texture.hpp"
 #include "Image/TextureView.hpp"
+#include "RenderPass/FrameBuffer.hpp"
+#include "RenderPass/RenderPassAttachment.hpp"
+#include "Sync/BufferMemoryBarrier.hpp"
+#include "Sync/ImageMemoryBarrier.hpp"
+
+#include <algorithm>
 
 namespace renderer
 {
+	namespace
+	{
+		struct SubresourceRun
+		{
+			uint32_t baseMipLevel;
+			uint32_t levelCount;
+			uint32_t baseArrayLayer;
+			uint32_t layerCount;
+			ResourceState state;
+		};
+
+		std::vector< SubresourceRun > listRuns( Texture const & texture
+			, ImageSubresourceRange const & range )
+		{
+			auto levels = std::max( 1u, texture.getMipmapLevels() );
+			auto layers = std::max( 1u, texture.getLayerCount() );
+			auto baseLevel = std::min( range.getBaseMipLevel(), levels - 1u );
+			auto baseLayer = std::min( range.getBaseArrayLayer(), layers - 1u );
+			auto endLevel = baseLevel + std::min( range.getLevelCount(), levels - baseLevel );
+			auto endLayer = baseLayer + std::min( range.getLayerCount(), layers - baseLayer );
+			std::vector< SubresourceRun > result;
+
+			for ( auto layer = baseLayer; layer < endLayer; ++layer )
+			{
+				auto level = baseLevel;
+
+				while ( level < endLevel )
+				{
+					auto & state = texture.getState( level, layer );
+					auto count = 1u;
+
+					while ( level + count < endLevel
+						&& texture.getState( level + count, layer ) == state )
+					{
+						++count;
+					}
+
+					// Merge with the run of the previous layer, if it covers the same levels with the same state.
+					auto it = std::find_if( result.begin()
+						, result.end()
+						, [&]( SubresourceRun const & lookup )
+						{
+							return lookup.baseMipLevel == level
+								&& lookup.levelCount == count
+								&& lookup.baseArrayLayer + lookup.layerCount == layer
+								&& lookup.state == state;
+						} );
+
+					if ( it != result.end() )
+					{
+						++it->layerCount;
+					}
+					else
+					{
+						result.push_back( { level, count, layer, 1u, state } );
+					}
+
+					level += count;
+				}
+			}
+
+			return result;
+		}
+
+		bool isCovered( ResourceState const & state
+			, AccessFlags access
+			, PipelineStageFlags stage )
+		{
+			return 0u == ( uint32_t( access ) & ~uint32_t( state.access ) )
+				&& 0u == ( uint32_t( stage ) & ~uint32_t( state.stage ) );
+		}
+
+		ResourceState makeBarrierState( ResourceState const & previous
+			, ImageLayout oldLayout
+			, ImageLayout newLayout
+			, PipelineStageFlags after
+			, PipelineStageFlags before
+			, AccessFlags srcAccess
+			, AccessFlags dstAccess )
+		{
+			if ( hasWriteAccess( srcAccess ) )
+			{
+				return { newLayout, dstAccess, before, srcAccess, after };
+			}
+
+			if ( oldLayout != newLayout )
+			{
+				// The layout transition writes the image, it is only visible to the barrier's destination.
+				return { newLayout, dstAccess, before, srcAccess, before };
+			}
+
+			return { newLayout, dstAccess, before, previous.lastWriteAccess, previous.lastWriteStage };
+		}
+	}
+
 	CommandBuffer::CommandBuffer( Device const & device
 		, CommandPool const & pool
 		, bool primary )
 	{
 	}
 
+	void CommandBuffer::beginRenderPass( RenderPass const & renderPass
+		, FrameBuffer const & frameBuffer
+		, ClearValueArray const & clearValues
+		, SubpassContents contents )const
+	{
+		doBeginRenderPass( renderPass
+			, frameBuffer
+			, clearValues
+			, contents );
+
+		for ( auto & attach : frameBuffer )
+		{
+			auto & view = attach.getView();
+			view.getTexture().setState( view.getSubResourceRange()
+				, isDepthOrStencilFormat( view.getFormat() )
+					? ResourceState{ attach.getAttachment().finalLayout, AccessFlag::eDepthStencilAttachmentWrite, PipelineStageFlag::eLateFragmentTests }
+					: ResourceState{ attach.getAttachment().finalLayout, AccessFlag::eColourAttachmentWrite, PipelineStageFlag::eColourAttachmentOutput } );
+			view.getTexture().invalidateMipmaps( view.getSubResourceRange().getBaseMipLevel() );
+		}
+	}
+
+	void CommandBuffer::memoryBarrier( PipelineStageFlags after
+		, PipelineStageFlags before
+		, BufferMemoryBarrier const & transitionBarrier )const
+	{
+		doCountStatistic( Statistic::eBarrier );
+		doMemoryBarrier( after
+			, before
+			, transitionBarrier );
+		auto & buffer = transitionBarrier.getBuffer();
+		buffer.setState( makeBarrierState( buffer.getState()
+			, ImageLayout::eUndefined
+			, ImageLayout::eUndefined
+			, after
+			, before
+			, transitionBarrier.getSrcAccessMask()
+			, transitionBarrier.getDstAccessMask() ) );
+	}
+
+	void CommandBuffer::memoryBarrier( PipelineStageFlags after
+		, PipelineStageFlags before
+		, ImageMemoryBarrier const & transitionBarrier )const
+	{
+		doCountStatistic( Statistic::eBarrier );
+		doMemoryBarrier( after
+			, before
+			, transitionBarrier );
+		auto & texture = transitionBarrier.getImage();
+		auto & range = transitionBarrier.getSubresourceRange();
+
+		for ( auto & run : listRuns( texture, range ) )
+		{
+			texture.setState( ImageSubresourceRange
+				{
+					range.getAspectMask(),
+					run.baseMipLevel,
+					run.levelCount,
+					run.baseArrayLayer,
+					run.layerCount
+				}
+				, makeBarrierState( run.state
+					, transitionBarrier.getOldLayout()
+					, transitionBarrier.getNewLayout()
+					, after
+					, before
+					, transitionBarrier.getSrcAccessMask()
+					, transitionBarrier.getDstAccessMask() ) );
+		}
+	}
+
+	void CommandBuffer::transition( BufferBase const & buffer
+		, AccessFlags access
+		, PipelineStageFlags stage )const
+	{
+		auto state = buffer.getState();
+
+		if ( hasWriteAccess( state.access )
+			|| hasWriteAccess( access ) )
+		{
+			memoryBarrier( state.stage
+				, stage
+				, BufferMemoryBarrier
+				{
+					state.access,
+					access,
+					~( 0u ),
+					~( 0u ),
+					buffer,
+					0u,
+					buffer.getSize()
+				} );
+		}
+		else if ( !isCovered( state, access, stage ) )
+		{
+			// Read after read, the last write still has to be made visible to the new access and stages.
+			if ( state.lastWriteStage )
+			{
+				doCountStatistic( Statistic::eBarrier );
+				doMemoryBarrier( state.lastWriteStage
+					, stage
+					, BufferMemoryBarrier
+					{
+						state.lastWriteAccess,
+						access,
+						~( 0u ),
+						~( 0u ),
+						buffer,
+						0u,
+						buffer.getSize()
+					} );
+			}
+
+			buffer.setState( { state.layout
+				, state.access | access
+				, state.stage | stage
+				, state.lastWriteAccess
+				, state.lastWriteStage } );
+		}
+	}
+
+	void CommandBuffer::transition( TextureView const & view
+		, ImageLayout layout
+		, AccessFlags access
+		, PipelineStageFlags stage )const
+	{
+		auto & texture = view.getTexture();
+		auto aspectMask = view.getSubResourceRange().getAspectMask();
+
+		for ( auto & run : listRuns( texture, view.getSubResourceRange() ) )
+		{
+			ImageSubresourceRange range
+			{
+				aspectMask,
+				run.baseMipLevel,
+				run.levelCount,
+				run.baseArrayLayer,
+				run.layerCount
+			};
+
+			if ( run.state.layout == layout
+				&& !hasWriteAccess( run.state.access )
+				&& !hasWriteAccess( access ) )
+			{
+				if ( isCovered( run.state, access, stage ) )
+				{
+					// Already in the wanted layout, and visible to the wanted access and stages.
+					continue;
+				}
+
+				// Read after read, the last write still has to be made visible to the new access and stages.
+				if ( run.state.lastWriteStage )
+				{
+					doCountStatistic( Statistic::eBarrier );
+					doMemoryBarrier( run.state.lastWriteStage
+						, stage
+						, ImageMemoryBarrier
+						{
+							run.state.lastWriteAccess,
+							access,
+							layout,
+							layout,
+							~( 0u ),
+							~( 0u ),
+							texture,
+							range
+						} );
+				}
+
+				texture.setState( range
+					, { layout
+						, run.state.access | access
+						, run.state.stage | stage
+						, run.state.lastWriteAccess
+						, run.state.lastWriteStage } );
+			}
+			else
+			{
+				memoryBarrier( run.state.stage
+					, stage
+					, ImageMemoryBarrier
+					{
+						run.state.access,
+						access,
+						run.state.layout,
+						layout,
+						~( 0u ),
+						~( 0u ),
+						texture,
+						range
+					} );
+			}
+		}
+	}
+
 	void CommandBuffer::bindVertexBuffer( uint32_t binding
 		, BufferBase const & buffer
 		, uint64_t offset )const
@@ -27,6 +322,95 @@ namespace renderer
 			, UInt64Array{ offset } );
 	}
 
+	void CommandBuffer::copyToImage( BufferImageCopyArray const & copyInfo
+		, BufferBase const & src
+		, Texture const & dst )const
+	{
+		doCopyToImage( copyInfo
+			, src
+			, dst );
+
+		for ( auto & copy : copyInfo )
+		{
+			dst.invalidateMipmaps( copy.imageSubresource.mipLevel );
+		}
+	}
+
+	void CommandBuffer::copyImage( ImageCopy const & copyInfo
+		, TextureView const & src
+		, TextureView const & dst )const
+	{
+		doCopyImage( copyInfo
+			, src
+			, dst );
+		dst.getTexture().invalidateMipmaps( copyInfo.dstSubresource.mipLevel );
+	}
+
+	void CommandBuffer::blitImage( Texture const & srcImage
+		, ImageLayout srcLayout
+		, Texture const & dstImage
+		, ImageLayout dstLayout
+		, std::vector< ImageBlit > const & regions
+		, Filter filter )const
+	{
+		doBlitImage( srcImage
+			, srcLayout
+			, dstImage
+			, dstLayout
+			, regions
+			, filter );
+
+		for ( auto & region : regions )
+		{
+			dstImage.invalidateMipmaps( region.dstSubresource.mipLevel );
+		}
+	}
+
+	void CommandBuffer::generateMipmaps( Texture const & texture )const
+	{
+		auto baseMipLevel = texture.hasStaleMipmaps()
+			? texture.getModifiedMipLevel()
+			: 0u;
+
+		if ( baseMipLevel + 1u < texture.getMipmapLevels() )
+		{
+			auto state = texture.getState( baseMipLevel, 0u );
+			ResourceState finalState = state.layout == ImageLayout::eUndefined
+					|| state.layout == ImageLayout::ePreinitialised
+				? ResourceState{ ImageLayout::eShaderReadOnlyOptimal
+					, AccessFlag::eShaderRead
+					, PipelineStageFlag::eFragmentShader }
+				: ResourceState{ state.layout
+					, state.access
+					, state.stage };
+			// The generation is the last write to all the levels.
+			finalState.lastWriteAccess = AccessFlag::eTransferWrite;
+			finalState.lastWriteStage = PipelineStageFlag::eTransfer;
+			doGenerateMipmaps( texture
+				, baseMipLevel
+				, finalState );
+			texture.setState( ImageSubresourceRange
+				{
+					getAspectMask( texture.getFormat() ),
+					baseMipLevel,
+					texture.getMipmapLevels() - baseMipLevel,
+					0u,
+					texture.getLayerCount(),
+				}
+				, finalState );
+		}
+
+		texture.validateMipmaps();
+	}
+
+	void CommandBuffer::updateMipmaps( Texture const & texture )const
+	{
+		if ( texture.hasStaleMipmaps() )
+		{
+			generateMipmaps( texture );
+		}
+	}
+
 	void CommandBuffer::copyToImage( BufferImageCopy const & copyInfo
 		, BufferBase const & src
 		, Texture const & dst )const
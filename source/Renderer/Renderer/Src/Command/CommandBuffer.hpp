@@ -7,6 +7,7 @@ See LICENSE file in root folder.
 #pragma once
 
 #include "Buffer/PushConstantsBuffer.hpp"
+#include "Core/DeviceStatistics.hpp"
 #include "Miscellaneous/BufferCopy.hpp"
 #include "Miscellaneous/BufferImageCopy.hpp"
 #include "Miscellaneous/ImageBlit.hpp"
@@ -156,10 +157,10 @@ namespace renderer
 		*\param[in] contents
 		*	Indique la manière dont les commandes de la première sous-passe sont fournies.
 		*/
-		virtual void beginRenderPass( RenderPass const & renderPass
+		void beginRenderPass( RenderPass const & renderPass
 			, FrameBuffer const & frameBuffer
 			, ClearValueArray const & clearValues
-			, SubpassContents contents )const = 0;
+			, SubpassContents contents )const;
 		/**
 		*\~english
 		*\brief
@@ -269,9 +270,9 @@ namespace renderer
 		*\param[in] transitionBarrier
 		*	La description de la transition.
 		*/
-		virtual void memoryBarrier( PipelineStageFlags after
+		void memoryBarrier( PipelineStageFlags after
 			, PipelineStageFlags before
-			, BufferMemoryBarrier const & transitionBarrier )const = 0;
+			, BufferMemoryBarrier const & transitionBarrier )const;
 		/**
 		*\~english
 		*\brief
@@ -292,9 +293,78 @@ namespace renderer
 		*\param[in] transitionBarrier
 		*	La description de la transition.
 		*/
-		virtual void memoryBarrier( PipelineStageFlags after
+		void memoryBarrier( PipelineStageFlags after
 			, PipelineStageFlags before
-			, ImageMemoryBarrier const & transitionBarrier )const = 0;
+			, ImageMemoryBarrier const & transitionBarrier )const;
+		/**
+		*\~english
+		*\brief
+		*	Prepares the given buffer for the wanted usage, from its tracked state.
+		*\remarks
+		*	No barrier is recorded if both the previous and the wanted usages only read the buffer,
+		*	and if the last write is already visible to the wanted access and stages.
+		*	The state is tracked at record time: the command buffers must be submitted in their recording order.
+		*\param[in] buffer
+		*	The buffer.
+		*\param[in] access
+		*	The wanted access flags.
+		*\param[in] stage
+		*	The pipeline stages that will use the buffer.
+		*\~french
+		*\brief
+		*	Prépare le tampon donné pour l'utilisation voulue, à partir de son état suivi.
+		*\remarks
+		*	Aucune barrière n'est enregistrée si l'utilisation précédente et l'utilisation voulue ne font que lire le tampon,
+		*	et si la dernière écriture est déjà visible pour les accès et étapes voulus.
+		*	L'état est suivi à l'enregistrement : les tampons de commandes doivent être soumis dans leur ordre d'enregistrement.
+		*\param[in] buffer
+		*	Le tampon.
+		*\param[in] access
+		*	Les indicateurs d'accès voulus.
+		*\param[in] stage
+		*	Les étapes du pipeline qui utiliseront le tampon.
+		*/
+		void transition( BufferBase const & buffer
+			, AccessFlags access
+			, PipelineStageFlags stage )const;
+		/**
+		*\~english
+		*\brief
+		*	Transitions the subresources of the given view to the wanted layout, from their tracked states.
+		*\remarks
+		*	Subresources already in the wanted layout, only read before and after, and whose last write
+		*	is already visible to the wanted access and stages, don't get a barrier.
+		*	The state is tracked at record time: the command buffers must be submitted in their recording order.
+		*	Adjacent subresources sharing the same state are transitioned through a single barrier.
+		*\param[in] view
+		*	The image view.
+		*\param[in] layout
+		*	The wanted layout.
+		*\param[in] access
+		*	The wanted access flags.
+		*\param[in] stage
+		*	The pipeline stages that will use the image.
+		*\~french
+		*\brief
+		*	Effectue la transition des sous-ressources de la vue donnée vers le layout voulu, à partir de leurs états suivis.
+		*\remarks
+		*	Les sous-ressources déjà dans le layout voulu, uniquement lues avant et après, et dont la dernière écriture
+		*	est déjà visible pour les accès et étapes voulus, n'ont pas de barrière.
+		*	L'état est suivi à l'enregistrement : les tampons de commandes doivent être soumis dans leur ordre d'enregistrement.
+		*	Les sous-ressources adjacentes partageant le même état sont traitées par une seule barrière.
+		*\param[in] view
+		*	La vue sur l'image.
+		*\param[in] layout
+		*	Le layout voulu.
+		*\param[in] access
+		*	Les indicateurs d'accès voulus.
+		*\param[in] stage
+		*	Les étapes du pipeline qui utiliseront l'image.
+		*/
+		void transition( TextureView const & view
+			, ImageLayout layout
+			, AccessFlags access
+			, PipelineStageFlags stage )const;
 		/**
 		*\~english
 		*\brief
@@ -555,9 +625,107 @@ namespace renderer
 			, uint32_t drawCount
 			, uint32_t stride )const = 0;
 		/**
+		*\~english
+		*\brief
+		*	Perform an indirect draw, the draw count being read from a buffer.
+		*\remarks
+		*	If PhysicalDevice::isDrawIndirectCountSupported returns \p false, this is emulated
+		*	by executing \p maxDrawCount draws, ignoring \p countBuffer.
+		*	The caller must then give a zero instance count to every draw parameters set
+		*	from the real draw count up to \p maxDrawCount, the emulation doesn't clear them.
+		*\param[in] buffer
+		*	The buffer containing draw parameters.
+		*\param[in] offset
+		*	The byte offset into \p buffer where parameters begin.
+		*\param[in] countBuffer
+		*	The buffer containing the draw count.
+		*\param[in] countBufferOffset
+		*	The byte offset into \p countBuffer where the draw count begins.
+		*\param[in] maxDrawCount
+		*	The maximum number of draws that will be executed.
+		*\param[in] stride
+		*	The byte stride between successive sets of draw parameters.
+		*\~french
+		*\brief
+		*	Effectue un dessin indirect, le nombre de dessins étant lu depuis un tampon.
+		*\remarks
+		*	Si PhysicalDevice::isDrawIndirectCountSupported retourne \p false, c'est émulé
+		*	en exécutant \p maxDrawCount dessins, en ignorant \p countBuffer.
+		*	L'appelant doit alors donner un nombre d'instances à zéro à chaque ensemble de paramètres de dessin
+		*	depuis le nombre réel de dessins jusqu'à \p maxDrawCount, l'émulation ne les vide pas.
+		*\param[in] buffer
+		*	Le tampon contenant les paramètres de dessin.
+		*\param[in] offset
+		*	L'offset en octets dans \p buffer, où les paramètres commencent.
+		*\param[in] countBuffer
+		*	Le tampon contenant le nombre de dessins.
+		*\param[in] countBufferOffset
+		*	L'offset en octets dans \p countBuffer, où le nombre de dessins commence.
+		*\param[in] maxDrawCount
+		*	Le nombre maximal de dessins qui seront effectués.
+		*\param[in] stride
+		*	Le stride en octets entre deux ensembles successifs de paramètres de dessin.
+		*/
+		virtual void drawIndirectCount( BufferBase const & buffer
+			, uint32_t offset
+			, BufferBase const & countBuffer
+			, uint32_t countBufferOffset
+			, uint32_t maxDrawCount
+			, uint32_t stride )const = 0;
+		/**
+		*\~english
+		*\brief
+		*	Perform an indexed indirect draw, the draw count being read from a buffer.
+		*\remarks
+		*	If PhysicalDevice::isDrawIndirectCountSupported returns \p false, this is emulated
+		*	by executing \p maxDrawCount draws, ignoring \p countBuffer.
+		*	The caller must then give a zero instance count to every draw parameters set
+		*	from the real draw count up to \p maxDrawCount, the emulation doesn't clear them.
+		*\param[in] buffer
+		*	The buffer containing draw parameters.
+		*\param[in] offset
+		*	The byte offset into \p buffer where parameters begin.
+		*\param[in] countBuffer
+		*	The buffer containing the draw count.
+		*\param[in] countBufferOffset
+		*	The byte offset into \p countBuffer where the draw count begins.
+		*\param[in] maxDrawCount
+		*	The maximum number of draws that will be executed.
+		*\param[in] stride
+		*	The byte stride between successive sets of draw parameters.
+		*\~french
+		*\brief
+		*	Effectue un dessin indirect indexé, le nombre de dessins étant lu depuis un tampon.
+		*\remarks
+		*	Si PhysicalDevice::isDrawIndirectCountSupported retourne \p false, c'est émulé
+		*	en exécutant \p maxDrawCount dessins, en ignorant \p countBuffer.
+		*	L'appelant doit alors donner un nombre d'instances à zéro à chaque ensemble de paramètres de dessin
+		*	depuis le nombre réel de dessins jusqu'à \p maxDrawCount, l'émulation ne les vide pas.
+		*\param[in] buffer
+		*	Le tampon contenant les paramètres de dessin.
+		*\param[in] offset
+		*	L'offset en octets dans \p buffer, où les paramètres commencent.
+		*\param[in] countBuffer
+		*	Le tampon contenant le nombre de dessins.
+		*\param[in] countBufferOffset
+		*	L'offset en octets dans \p countBuffer, où le nombre de dessins commence.
+		*\param[in] maxDrawCount
+		*	Le nombre maximal de dessins qui seront effectués.
+		*\param[in] stride
+		*	Le stride en octets entre deux ensembles successifs de paramètres de dessin.
+		*/
+		virtual void drawIndexedIndirectCount( BufferBase const & buffer
+			, uint32_t offset
+			, BufferBase const & countBuffer
+			, uint32_t countBufferOffset
+			, uint32_t maxDrawCount
+			, uint32_t stride )const = 0;
+		/**
 		*\~french
 		*\brief
 		*	Copie les données d'un tampon vers une image.
+		*\remarks
+		*	Les niveaux de mipmap suivant ceux écrits sont marqués comme obsolètes.
 		*\param[in] copyInfo
 		*	Les informations de la copie.
 		*\param[in] src
@@ -567,6 +735,8 @@ namespace renderer
 		*\~english
 		*\brief
 		*	Copies data from a buffer to an image.
+		*\remarks
+		*	The mipmap levels following the written ones are flagged as stale.
 		*\param[in] copyInfo
 		*	The copy informations.
 		*\param[in] src
@@ -574,9 +744,9 @@ namespace renderer
 		*\param[in] dst
 		*	The destination image.
 		*/
-		virtual void copyToImage( BufferImageCopyArray const & copyInfo
+		void copyToImage( BufferImageCopyArray const & copyInfo
 			, BufferBase const & src
-			, Texture const & dst )const = 0;
+			, Texture const & dst )const;
 		/**
 		*\~french
 		*\brief
@@ -627,6 +797,8 @@ namespace renderer
 		*\~french
 		*\brief
 		*	Copie les données d'une image vers une autre.
+		*\remarks
+		*	Les niveaux de mipmap suivant ceux écrits sont marqués comme obsolètes.
 		*\param[in] copyInfo
 		*	Les informations de la copie.
 		*\param[in] src
@@ -636,6 +808,8 @@ namespace renderer
 		*\~english
 		*\brief
 		*	Copies data from an image to another one.
+		*\remarks
+		*	The mipmap levels following the written ones are flagged as stale.
 		*\param[in] copyInfo
 		*	The copy informations.
 		*\param[in] src
@@ -643,13 +817,15 @@ namespace renderer
 		*\param[in] dst
 		*	The destination image.
 		*/
-		virtual void copyImage( ImageCopy const & copyInfo
+		void copyImage( ImageCopy const & copyInfo
 			, TextureView const & src
-			, TextureView const & dst )const = 0;
+			, TextureView const & dst )const;
 		/**
 		*\~french
 		*\brief
 		*	Copie des régions d'une image vers une autre.
+		*\remarks
+		*	Les niveaux de mipmap suivant ceux écrits sont marqués comme obsolètes.
 		*\param[in] regions
 		*	Les régions à blitter.
 		*\param[in] srcImage
@@ -665,6 +841,8 @@ namespace renderer
 		*\~english
 		*\brief
 		*	Copy regions of an image to another one.
+		*\remarks
+		*	The mipmap levels following the written ones are flagged as stale.
 		*\param[in] regions
 		*	The regions to blit.
 		*\param[in] srcImage
@@ -678,12 +856,50 @@ namespace renderer
 		*\param[in] filter
 		*	The filter applied if the blit requires scaling.
 		*/
-		virtual void blitImage( Texture const & srcImage
+		void blitImage( Texture const & srcImage
 			, ImageLayout srcLayout
 			, Texture const & dstImage
 			, ImageLayout dstLayout
 			, std::vector< ImageBlit > const & regions
-			, Filter filter )const = 0;
+			, Filter filter )const;
+		/**
+		*\~french
+		*\brief
+		*	Enregistre la génération des mipmaps d'une texture.
+		*\remarks
+		*	La chaîne est régénérée à partir du premier niveau écrit par les commandes enregistrées
+		*	depuis la dernière génération, ou à partir du premier niveau si aucune écriture n'a été enregistrée.
+		*	Les niveaux régénérés prennent ensuite l'état suivi du niveau source, ou
+		*	ImageLayout::eShaderReadOnlyOptimal si son layout était indéfini.
+		*	Doit être enregistrée en dehors d'une passe de rendu.
+		*\param[in] texture
+		*	La texture.
+		*\~english
+		*\brief
+		*	Records the generation of a texture mipmaps.
+		*\remarks
+		*	The chain is regenerated from the first level written by the commands recorded
+		*	since the last generation, or from the first level if no write was recorded.
+		*	The regenerated levels then take the tracked state of the source level, or
+		*	ImageLayout::eShaderReadOnlyOptimal if its layout was undefined.
+		*	Must be recorded outside of a render pass.
+		*\param[in] texture
+		*	The texture.
+		*/
+		void generateMipmaps( Texture const & texture )const;
+		/**
+		*\~french
+		*\brief
+		*	Enregistre la génération des mipmaps d'une texture, seulement si certains niveaux sont obsolètes.
+		*\param[in] texture
+		*	La texture.
+		*\~english
+		*\brief
+		*	Records the generation of a texture mipmaps, only if some levels are stale.
+		*\param[in] texture
+		*	The texture.
+		*/
+		void updateMipmaps( Texture const & texture )const;
 		/**
 		*\~english
 		*\brief
@@ -772,6 +988,57 @@ namespace renderer
 			, QueryPool const & pool
 			, uint32_t query )const = 0;
 		/**
+		*\~english
+		*\brief
+		*	Copies the status or result of a set of queries into a buffer, on the GPU.
+		*\remarks
+		*	The results layout is the one of QueryPool::getResults, the results of the unavailable
+		*	queries not being written without QueryResultFlag::eWait.
+		*	The results can hence be consumed by the device, or read back later, without stalling.
+		*\param[in] pool
+		*	The query pool.
+		*\param[in] firstQuery
+		*	The first query index.
+		*\param[in] queryCount
+		*	The number of queries (starting at \p firstQuery).
+		*\param[in] dstBuffer
+		*	The buffer receiving the results.
+		*\param[in] dstOffset
+		*	The byte offset into \p dstBuffer.
+		*\param[in] stride
+		*	The stride in bytes between results for individual queries, in \p dstBuffer.
+		*\param[in] flags
+		*	Specifies how and when results are returned.
+		*\~french
+		*\brief
+		*	Copie le statut ou le résultat d'un ensemble de requêtes dans un tampon, côté GPU.
+		*\remarks
+		*	La disposition des résultats est celle de QueryPool::getResults, les résultats des requêtes
+		*	non disponibles n'étant pas écrits sans QueryResultFlag::eWait.
+		*	Les résultats peuvent donc être consommés par le périphérique, ou relus plus tard, sans blocage.
+		*\param[in] pool
+		*	Le pool de requêtes.
+		*\param[in] firstQuery
+		*	L'index de la première requête.
+		*\param[in] queryCount
+		*	Le nombre de requêtes (à partir de \p firstQuery).
+		*\param[in] dstBuffer
+		*	Le tampon recevant les résultats.
+		*\param[in] dstOffset
+		*	L'offset en octets dans \p dstBuffer.
+		*\param[in] stride
+		*	L'intervalle en octets entre les résultats pour chaque requête, dans \p dstBuffer.
+		*\param[in] flags
+		*	Définit quand et comment les résultats sont récupérés.
+		*/
+		virtual void copyQueryPoolResults( QueryPool const & pool
+			, uint32_t firstQuery
+			, uint32_t queryCount
+			, BufferBase const & dstBuffer
+			, uint32_t dstOffset
+			, uint32_t stride
+			, QueryResultFlags flags )const = 0;
+		/**
 		*\~french
 		*\brief
 		*	Met à jour les valeurs de push constants.
@@ -1222,6 +1489,256 @@ namespace renderer
 		{
 			pushConstants( layout, pcb.getBuffer() );
 		}
+		/**
+		*\~english
+		*\return
+		*	The statistics of the recorded commands, counted by the queue on each submission.
+		*\~french
+		*\return
+		*	Les statistiques des commandes enregistrées, comptées par la file à chaque soumission.
+		*/
+		inline DeviceStatistics const & getRecordedStatistics()const
+		{
+			return m_recordedStatistics;
+		}
+
+	protected:
+		/**
+		*\~english
+		*\brief
+		*	Counts a recorded command, does nothing if RENDERLIB_STATISTICS is disabled.
+		*\~french
+		*\brief
+		*	Compte une commande enregistrée, ne fait rien si RENDERLIB_STATISTICS est désactivé.
+		*/
+		inline void doCountStatistic( Statistic statistic
+			, uint64_t value = 1u )const
+		{
+#if RENDERLIB_STATISTICS
+			m_recordedStatistics[statistic] += value;
+#endif
+		}
+		/**
+		*\~english
+		*\brief
+		*	Adds the statistics of executed secondary command buffers.
+		*\~french
+		*\brief
+		*	Ajoute les statistiques de tampons de commandes secondaires exécutés.
+		*/
+		inline void doCountStatistics( CommandBufferCRefArray const & commands )const
+		{
+#if RENDERLIB_STATISTICS
+			for ( auto & commandBuffer : commands )
+			{
+				m_recordedStatistics += commandBuffer.get().getRecordedStatistics();
+			}
+#endif
+		}
+		/**
+		*\~english
+		*\brief
+		*	Forgets the recorded commands statistics, when recording starts again.
+		*\~french
+		*\brief
+		*	Oublie les statistiques des commandes enregistrées, lorsque l'enregistrement recommence.
+		*/
+		inline void doResetStatistics()const
+		{
+			m_recordedStatistics = DeviceStatistics{};
+		}
+
+	private:
+		/**
+		*\~english
+		*\brief
+		*	Begins a new render pass.
+		*\param[in] renderPass
+		*	The render pass to begin.
+		*\param[in] frameBuffer
+		*	The framebuffer containing the attachments that are used with the render pass.
+		*\param[in] clearValues
+		*	The clear values for each attachment that needs to be cleared.
+		*\param[in] contents
+		*	Specifies how the commands in the first subpass will be provided.
+		*\~french
+		*\brief
+		*	Démarre une passe de rendu.
+		*\param[in] renderPass
+		*	La passe de rendu.
+		*\param[in] frameBuffer
+		*	Le tampon d'image affecté par le rendu.
+		*\param[in] clearValues
+		*	Les valeurs de vidage, une par attache de la passe de rendu.
+		*\param[in] contents
+		*	Indique la manière dont les commandes de la première sous-passe sont fournies.
+		*/
+		virtual void doBeginRenderPass( RenderPass const & renderPass
+			, FrameBuffer const & frameBuffer
+			, ClearValueArray const & clearValues
+			, SubpassContents contents )const = 0;
+		/**
+		*\~english
+		*\brief
+		*	Defines a memory dependency between commands that were submitted before it, and those submitted after it.
+		*\param[in] after
+		*	Specifies the pipeline stages that must be ended before the barrier.
+		*\param[in] before
+		*	Specifies the pipeline stages that can be started after the barrier.
+		*\param[in] transitionBarrier
+		*	Describes the transition.
+		*\~french
+		*\brief
+		*	Met en place une barrière de transition d'état de tampon.
+		*\param[in] after
+		*	Les étapes devant être terminées avant l'exécution de la barrière.
+		*\param[in] before
+		*	Les étapes pouvant être commencées après l'exécution de la barrière.
+		*\param[in] transitionBarrier
+		*	La description de la transition.
+		*/
+		virtual void doMemoryBarrier( PipelineStageFlags after
+			, PipelineStageFlags before
+			, BufferMemoryBarrier const & transitionBarrier )const = 0;
+		/**
+		*\~english
+		*\brief
+		*	Defines a memory dependency between commands that were submitted before it, and those submitted after it.
+		*\param[in] after
+		*	Specifies the pipeline stages that must be ended before the barrier.
+		*\param[in] before
+		*	Specifies the pipeline stages that can be started after the barrier.
+		*\param[in] transitionBarrier
+		*	Describes the transition.
+		*\~french
+		*\brief
+		*	Met en place une barrière de transition de layout d'image.
+		*\param[in] after
+		*	Les étapes devant être terminées avant l'exécution de la barrière.
+		*\param[in] before
+		*	Les étapes pouvant être commencées après l'exécution de la barrière.
+		*\param[in] transitionBarrier
+		*	La description de la transition.
+		*/
+		virtual void doMemoryBarrier( PipelineStageFlags after
+			, PipelineStageFlags before
+			, ImageMemoryBarrier const & transitionBarrier )const = 0;
+		/**
+		*\~french
+		*\brief
+		*	Copie les données d'un tampon vers une image.
+		*\param[in] copyInfo
+		*	Les informations de la copie.
+		*\param[in] src
+		*	Le tampon source.
+		*\param[in] dst
+		*	L'image destination.
+		*\~english
+		*\brief
+		*	Copies data from a buffer to an image.
+		*\param[in] copyInfo
+		*	The copy informations.
+		*\param[in] src
+		*	The source buffer.
+		*\param[in] dst
+		*	The destination image.
+		*/
+		virtual void doCopyToImage( BufferImageCopyArray const & copyInfo
+			, BufferBase const & src
+			, Texture const & dst )const = 0;
+		/**
+		*\~french
+		*\brief
+		*	Copie les données d'une image vers une autre.
+		*\param[in] copyInfo
+		*	Les informations de la copie.
+		*\param[in] src
+		*	L'image source.
+		*\param[in] dst
+		*	L'image destination.
+		*\~english
+		*\brief
+		*	Copies data from an image to another one.
+		*\param[in] copyInfo
+		*	The copy informations.
+		*\param[in] src
+		*	The source image.
+		*\param[in] dst
+		*	The destination image.
+		*/
+		virtual void doCopyImage( ImageCopy const & copyInfo
+			, TextureView const & src
+			, TextureView const & dst )const = 0;
+		/**
+		*\~french
+		*\brief
+		*	Copie des régions d'une image vers une autre.
+		*\param[in] regions
+		*	Les régions à blitter.
+		*\param[in] srcImage
+		*	L'image source.
+		*\param[in] srcLayout
+		*	Le layout de l'image source.
+		*\param[in] dstImage
+		*	L'image destination.
+		*\param[in] dstLayout
+		*	Le layout de l'image destination.
+		*\param[in] filter
+		*	Le filtre appliqué si la copie nécessite une mise à l'échelle.
+		*\~english
+		*\brief
+		*	Copy regions of an image to another one.
+		*\param[in] regions
+		*	The regions to blit.
+		*\param[in] srcImage
+		*	The source image.
+		*\param[in] srcLayout
+		*	The source image layout.
+		*\param[in] dstImage
+		*	The destination image.
+		*\param[in] dstLayout
+		*	The source image layout.
+		*\param[in] filter
+		*	The filter applied if the blit requires scaling.
+		*/
+		virtual void doBlitImage( Texture const & srcImage
+			, ImageLayout srcLayout
+			, Texture const & dstImage
+			, ImageLayout dstLayout
+			, std::vector< ImageBlit > const & regions
+			, Filter filter )const = 0;
+		/**
+		*\~french
+		*\brief
+		*	Enregistre la génération des mipmaps d'une texture, à partir du niveau donné.
+		*\remarks
+		*	Les barrières nécessaires sont à la charge de l'implémentation, qui laisse tous les niveaux
+		*	à partir de \p baseMipLevel dans \p finalState.
+		*\param[in] texture
+		*	La texture.
+		*\param[in] baseMipLevel
+		*	Le niveau source, les niveaux suivants sont régénérés.
+		*\param[in] finalState
+		*	L'état des niveaux une fois la génération terminée.
+		*\~english
+		*\brief
+		*	Records the generation of a texture mipmaps, from the given level.
+		*\remarks
+		*	The needed barriers are up to the implementation, which leaves all the levels
+		*	from \p baseMipLevel in \p finalState.
+		*\param[in] texture
+		*	The texture.
+		*\param[in] baseMipLevel
+		*	The source level, the following levels are regenerated.
+		*\param[in] finalState
+		*	The levels state once the generation is done.
+		*/
+		virtual void doGenerateMipmaps( Texture const & texture
+			, uint32_t baseMipLevel
+			, ResourceState const & finalState )const = 0;
+
+	private:
+		mutable DeviceStatistics m_recordedStatistics;
 	};
 }
 
@@ -83,6 +83,18 @@ namespace renderer
 		{
 			return m_gpu;
 		}
+		/**
+		*\~english
+		*\return
+		*	\p true if the connection has no window, the rendering is then done offscreen.
+		*\~french
+		*\return
+		*	\p true si la connexion n'a pas de fenêtre, le rendu se fait alors hors écran.
+		*/
+		inline bool isHeadless()const
+		{
+			return m_handle.isHeadless();
+		}
 
 	protected:
 		WindowHandle m_handle;
@@ -17,6 +17,9 @@ namespace renderer
 		, Connection const & connection )
 		: m_renderer{ renderer }
 		, m_gpu{ gpu }
+		, m_statistics{ StatisticsCounters::get() }
+		, m_creationStatistics{ m_statistics.snapshot() }
+		, m_frameStartStatistics{ m_creationStatistics }
 	{
 	}
 
@@ -32,6 +35,13 @@ namespace renderer
 		doDisable();
 	}
 
+	void Device::endFrameStatistics()const
+	{
+		auto statistics = m_statistics.snapshot();
+		m_frameStatistics = statistics - m_frameStartStatistics;
+		m_frameStartStatistics = statistics;
+	}
+
 	Mat4 Device::infinitePerspective( Angle fovy
 		, float aspect
 		, float zNear )const
@@ -9,6 +9,7 @@ See LICENSE file in root folder.
 #include "Command/CommandPool.hpp"
 #include "Command/Queue.hpp"
 #include "Core/Connection.hpp"
+#include "Core/DeviceStatistics.hpp"
 #include "Core/PhysicalDevice.hpp"
 #include "Pipeline/ColourBlendState.hpp"
 #include "Pipeline/RasterisationState.hpp"
@@ -796,6 +797,55 @@ namespace renderer
 		{
 			return m_timestampPeriod;
 		}
+		/**
+		*\~english
+		*\return
+		*	The statistics counted since the device creation.
+		*\~french
+		*\return
+		*	Les statistiques comptées depuis la création du périphérique.
+		*/
+		inline DeviceStatistics getStatistics()const
+		{
+			return m_statistics.snapshot() - m_creationStatistics;
+		}
+		/**
+		*\~english
+		*\return
+		*	The statistics counted since the end of the previous frame.
+		*\~french
+		*\return
+		*	Les statistiques comptées depuis la fin de la frame précédente.
+		*/
+		inline DeviceStatistics getCurrentFrameStatistics()const
+		{
+			return m_statistics.snapshot() - m_frameStartStatistics;
+		}
+		/**
+		*\~english
+		*\return
+		*	The statistics of the last complete frame.
+		*\~french
+		*\return
+		*	Les statistiques de la dernière frame complète.
+		*/
+		inline DeviceStatistics const & getFrameStatistics()const
+		{
+			return m_frameStatistics;
+		}
+		/**
+		*\~english
+		*\brief
+		*	Ends the current frame's statistics, and starts the next frame's ones.
+		*\remarks
+		*	Called by the swap chains, when presenting.
+		*\~french
+		*\brief
+		*	Termine les statistiques de la frame courante, et démarre celles de la suivante.
+		*\remarks
+		*	Appelée par les swap chains, lors de la présentation.
+		*/
+		void endFrameStatistics()const;
 
 	private:
 		/**
@@ -831,6 +881,12 @@ namespace renderer
 		CommandPoolPtr m_computeCommandPool;
 		CommandPoolPtr m_graphicsCommandPool;
 		float m_timestampPeriod;
+
+	private:
+		StatisticsCounters & m_statistics;
+		DeviceStatistics m_creationStatistics;
+		mutable DeviceStatistics m_frameStartStatistics;
+		mutable DeviceStatistics m_frameStatistics;
 	};
 }
 
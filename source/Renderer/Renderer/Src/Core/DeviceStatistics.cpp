@@ -0,0 +1,44 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Core/DeviceStatistics.hpp"
+
+namespace renderer
+{
+	StatisticsCounters & StatisticsCounters::get()
+	{
+		static StatisticsCounters result;
+		return result;
+	}
+
+	DeviceStatistics StatisticsCounters::snapshot()const
+	{
+		DeviceStatistics result;
+		std::lock_guard< std::mutex > lock{ m_mutex };
+
+		for ( auto & thread : m_threads )
+		{
+			for ( size_t i = 0u; i < result.values.size(); ++i )
+			{
+				result.values[i] += ( *thread )[i].load( std::memory_order_relaxed );
+			}
+		}
+
+		return result;
+	}
+
+	StatisticsCounters::ThreadCounters & StatisticsCounters::doRegisterThread()
+	{
+		auto counters = std::make_unique< ThreadCounters >();
+
+		for ( auto & counter : *counters )
+		{
+			counter.store( 0u, std::memory_order_relaxed );
+		}
+
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		m_threads.push_back( std::move( counters ) );
+		return *m_threads.back();
+	}
+}
@@ -0,0 +1,264 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#ifndef ___Renderer_DeviceStatistics_HPP___
+#define ___Renderer_DeviceStatistics_HPP___
+#pragma once
+
+#include "RendererPrerequisites.hpp"
+
+#include <array>
+#include <atomic>
+#include <mutex>
+
+namespace renderer
+{
+	/**
+	*\~english
+	*\brief
+	*	The statistics counted by the renderer.
+	*\~french
+	*\brief
+	*	Les statistiques comptées par le renderer.
+	*/
+	enum class Statistic
+		: uint32_t
+	{
+		//! Draw commands.
+		eDrawCall,
+		//! Dispatch commands.
+		eDispatch,
+		//! Pipeline binds, graphics and compute.
+		ePipelineBind,
+		//! Bound descriptor sets.
+		eDescriptorSetBind,
+		//! Pipeline barriers.
+		eBarrier,
+		//! Buffer memory mappings.
+		eBufferMap,
+		//! Host writes flushed to buffer memory.
+		eUpload,
+		//! Bytes flushed to buffer memory.
+		eUploadedBytes,
+		//! Submitted command buffers.
+		eSubmittedCommandBuffer,
+		//! Rendering API calls (OpenGL only).
+		eApiCall,
+		eCount,
+	};
+	/**
+	*\~english
+	*\brief
+	*	Gets the name of the given statistic.
+	*\param[in] value
+	*	The statistic.
+	*\return
+	*	The name.
+	*\~french
+	*\brief
+	*	Récupère le nom de la statistique donnée.
+	*\param[in] value
+	*	La statistique.
+	*\return
+	*	Le nom.
+	*/
+	inline std::string getName( Statistic value )
+	{
+		switch ( value )
+		{
+		case Statistic::eDrawCall:
+			return "draw calls";
+
+		case Statistic::eDispatch:
+			return "dispatches";
+
+		case Statistic::ePipelineBind:
+			return "pipeline binds";
+
+		case Statistic::eDescriptorSetBind:
+			return "descriptor set binds";
+
+		case Statistic::eBarrier:
+			return "barriers";
+
+		case Statistic::eBufferMap:
+			return "buffer maps";
+
+		case Statistic::eUpload:
+			return "uploads";
+
+		case Statistic::eUploadedBytes:
+			return "uploaded bytes";
+
+		case Statistic::eSubmittedCommandBuffer:
+			return "submitted command buffers";
+
+		case Statistic::eApiCall:
+			return "API calls";
+
+		default:
+			assert( false && "Unsupported Statistic." );
+			throw std::runtime_error{ "Unsupported Statistic" };
+		}
+
+		return 0;
+	}
+	/**
+	*\~english
+	*\brief
+	*	A value for each statistic.
+	*\~french
+	*\brief
+	*	Une valeur par statistique.
+	*/
+	struct DeviceStatistics
+	{
+		inline uint64_t & operator[]( Statistic statistic )
+		{
+			return values[size_t( statistic )];
+		}
+
+		inline uint64_t operator[]( Statistic statistic )const
+		{
+			return values[size_t( statistic )];
+		}
+
+		inline DeviceStatistics & operator+=( DeviceStatistics const & rhs )
+		{
+			for ( size_t i = 0u; i < values.size(); ++i )
+			{
+				values[i] += rhs.values[i];
+			}
+
+			return *this;
+		}
+
+		inline DeviceStatistics & operator-=( DeviceStatistics const & rhs )
+		{
+			for ( size_t i = 0u; i < values.size(); ++i )
+			{
+				values[i] -= rhs.values[i];
+			}
+
+			return *this;
+		}
+
+		std::array< uint64_t, size_t( Statistic::eCount ) > values{};
+	};
+
+	inline DeviceStatistics operator-( DeviceStatistics lhs
+		, DeviceStatistics const & rhs )
+	{
+		lhs -= rhs;
+		return lhs;
+	}
+	/**
+	*\~english
+	*\brief
+	*	The statistics counters, one block per counting thread.
+	*\remarks
+	*	Each thread only writes to its own block, without lock nor read-modify-write,
+	*	the blocks are only summed up when a snapshot is asked.
+	*	The counters are never reset, a frame's statistics are the difference between two snapshots.
+	*	A rendering plugin and the application each have their own counters, the statistics are
+	*	hence counted in the plugins only, and read through the Device.
+	*\~french
+	*\brief
+	*	Les compteurs de statistiques, un bloc par thread comptant.
+	*\remarks
+	*	Chaque thread n'écrit que dans son propre bloc, sans verrou ni lecture-modification-écriture,
+	*	les blocs ne sont additionnés que lorsqu'un instantané est demandé.
+	*	Les compteurs ne sont jamais remis à zéro, les statistiques d'une frame sont la différence entre deux instantanés.
+	*	Un plugin de rendu et l'application ont chacun leurs propres compteurs, les statistiques
+	*	ne sont donc comptées que dans les plugins, et lues via le Device.
+	*/
+	class StatisticsCounters
+	{
+	private:
+		using ThreadCounters = std::array< std::atomic< uint64_t >, size_t( Statistic::eCount ) >;
+
+	public:
+		/**
+		*\~english
+		*\return
+		*	The counters of this module.
+		*\~french
+		*\return
+		*	Les compteurs de ce module.
+		*/
+		static StatisticsCounters & get();
+		/**
+		*\~english
+		*\return
+		*	The sum of all threads' counters.
+		*\~french
+		*\return
+		*	La somme des compteurs de tous les threads.
+		*/
+		DeviceStatistics snapshot()const;
+		/**
+		*\~english
+		*\brief
+		*	Adds a value to a counter of the calling thread.
+		*\~french
+		*\brief
+		*	Ajoute une valeur à un compteur du thread appelant.
+		*/
+		inline void count( Statistic statistic
+			, uint64_t value )
+		{
+			thread_local ThreadCounters & counters = doRegisterThread();
+			auto & counter = counters[size_t( statistic )];
+			counter.store( counter.load( std::memory_order_relaxed ) + value
+				, std::memory_order_relaxed );
+		}
+
+	private:
+		ThreadCounters & doRegisterThread();
+
+	private:
+		mutable std::mutex m_mutex;
+		// The blocks outlive their thread, for the totals to stay consistent.
+		std::vector< std::unique_ptr< ThreadCounters > > m_threads;
+	};
+	/**
+	*\~english
+	*\brief
+	*	Counts a statistic, does nothing if RENDERLIB_STATISTICS is disabled.
+	*\~french
+	*\brief
+	*	Compte une statistique, ne fait rien si RENDERLIB_STATISTICS est désactivé.
+	*/
+	inline void countStatistic( Statistic statistic
+		, uint64_t value = 1u )
+	{
+#if RENDERLIB_STATISTICS
+		StatisticsCounters::get().count( statistic, value );
+#endif
+	}
+	/**
+	*\~english
+	*\brief
+	*	Counts every statistic of the given set.
+	*\~french
+	*\brief
+	*	Compte chaque statistique de l'ensemble donné.
+	*/
+	inline void countStatistics( DeviceStatistics const & statistics )
+	{
+#if RENDERLIB_STATISTICS
+		auto & counters = StatisticsCounters::get();
+
+		for ( size_t i = 0u; i < statistics.values.size(); ++i )
+		{
+			if ( statistics.values[i] )
+			{
+				counters.count( Statistic( i ), statistics.values[i] );
+			}
+		}
+#endif
+	}
+}
+
+#endif
@@ -105,6 +105,21 @@ namespace renderer
 		virtual bool isGLSLSupported()const = 0;
 		/**
 		*\~english
+		*\brief
+		*	Tells if the draw count of indirect draws can be read from a buffer, without emulation.
+		*\remarks
+		*	If not, CommandBuffer::drawIndirectCount and CommandBuffer::drawIndexedIndirectCount
+		*	execute all the draws up to their maximum count, the unused ones must have a zero instance count.
+		*\~french
+		*\brief
+		*	Dit si le nombre de dessins des dessins indirects peut être lu depuis un tampon, sans émulation.
+		*\remarks
+		*	Sinon, CommandBuffer::drawIndirectCount et CommandBuffer::drawIndexedIndirectCount
+		*	exécutent tous les dessins jusqu'à leur nombre maximal, ceux inutilisés doivent avoir un nombre d'instances à zéro.
+		*/
+		virtual bool isDrawIndirectCountSupported()const = 0;
+		/**
+		*\~english
 		*name
 		*	Getters.
 		*\~french
@@ -148,6 +148,20 @@ namespace renderer
 		*/
 		virtual PixelFormat getFormat()const = 0;
 		/**
+		*\~english
+		*\return
+		*	The last presented image, for an offscreen swap chain (headless connection), \p nullptr otherwise.
+		*	It is in the final layout of the render pass which wrote it, and can be copied out to read the results.
+		*\~french
+		*\return
+		*	La dernière image présentée, pour une swap chain hors écran (connexion sans fenêtre), \p nullptr sinon.
+		*	Elle est dans la disposition finale de la passe de rendu qui l'a écrite, et peut être copiée pour lire les résultats.
+		*/
+		virtual Texture const * getOffscreenImage()const
+		{
+			return nullptr;
+		}
+		/**
 		*\~french
 		*\return
 		*	Retrieves the default rendering resources.
@@ -59,6 +59,15 @@ namespace renderer
 		/**
 		*\~english
 		*\brief
+		*	Default constructor, for headless (offscreen) rendering.
+		*\~french
+		*\brief
+		*	Constructeur par défaut, pour le rendu sans fenêtre (hors écran).
+		*/
+		WindowHandle() = default;
+		/**
+		*\~english
+		*\brief
 		*	Constructor.
 		*\param[in] handle
 		*	The allocated handle.
@@ -90,6 +99,18 @@ namespace renderer
 		/**
 		*\~english
 		*\return
+		*	\p true if there is no window.
+		*\~french
+		*\return
+		*	\p true s'il n'y a pas de fenêtre.
+		*/
+		inline bool isHeadless()const
+		{
+			return m_handle == nullptr;
+		}
+		/**
+		*\~english
+		*\return
 		*	The window handle, cast in wanted format (IMswWindowHandle, IXWindowHandle, ...).
 		*\~french
 		*\return
@@ -126,7 +126,7 @@ namespace renderer
 		/**
 		*\~french
 		*\brief
-		*	Crée une attache de type image échantillonée.
+		*	Crée une attache de type image échantillonée, ou attache d'entrée, selon le type de l'attache de layout.
 		*\param[in] layoutBinding
 		*	L'attache de layout.
 		*\param[in] view
@@ -139,7 +139,7 @@ namespace renderer
 		*	L'attache créée.
 		*\~english
 		*\brief
-		*	Creates a sampled image binding.
+		*	Creates a sampled image, or input attachment, binding, depending on the layout binding type.
 		*\param[in] layoutBinding
 		*	The layout binding.
 		*\param[in] view
@@ -5,6 +5,11 @@ See LICENSE file in root folder.
 #include "Image/Texture.hpp"
 
 #include "Buffer/StagingBuffer.hpp"
+#include "Command/CommandBuffer.hpp"
+#include "Command/CommandPool.hpp"
+#include "Command/Queue.hpp"
+#include "Core/Device.hpp"
+#include "Image/ImageSubresourceRange.hpp"
 #include "Image/TextureView.hpp"
 
 namespace renderer
@@ -16,6 +21,8 @@ namespace renderer
 		, m_size{ rhs.m_size }
 		, m_layerCount{ rhs.m_layerCount }
 		, m_samples{ rhs.m_samples }
+		, m_states{ std::move( rhs.m_states ) }
+		, m_modifiedMipLevel{ rhs.m_modifiedMipLevel }
 	{
 	}
 
@@ -28,6 +35,8 @@ namespace renderer
 			m_size = rhs.m_size;
 			m_layerCount = rhs.m_layerCount;
 			m_samples = rhs.m_samples;
+			m_states = std::move( rhs.m_states );
+			m_modifiedMipLevel = rhs.m_modifiedMipLevel;
 		}
 
 		return *this;
@@ -50,6 +59,8 @@ namespace renderer
 		m_layerCount = 1u;
 		m_mipmapLevels = 1u;
 		m_samples = SampleCountFlag::e1;
+		m_states.clear();
+		m_modifiedMipLevel = InvalidMipLevel;
 		doSetImage1D( usageFlags
 			, tiling
 			, memoryFlags );
@@ -68,6 +79,8 @@ namespace renderer
 		m_layerCount = 1u;
 		m_mipmapLevels = 1u;
 		m_samples = samples;
+		m_states.clear();
+		m_modifiedMipLevel = InvalidMipLevel;
 		doSetImage2D( usageFlags
 			, tiling
 			, memoryFlags );
@@ -86,6 +99,8 @@ namespace renderer
 		m_layerCount = 1u;
 		m_mipmapLevels = 1u;
 		m_samples = samples;
+		m_states.clear();
+		m_modifiedMipLevel = InvalidMipLevel;
 		doSetImage3D( usageFlags
 			, tiling
 			, memoryFlags );
@@ -104,6 +119,8 @@ namespace renderer
 		m_layerCount = layerCount;
 		m_mipmapLevels = 1u;
 		m_samples = SampleCountFlag::e1;
+		m_states.clear();
+		m_modifiedMipLevel = InvalidMipLevel;
 		doSetImage1D( usageFlags
 			, tiling
 			, memoryFlags );
@@ -122,6 +139,8 @@ namespace renderer
 		m_layerCount = layerCount;
 		m_mipmapLevels = 1u;
 		m_samples = SampleCountFlag::e1;
+		m_states.clear();
+		m_modifiedMipLevel = InvalidMipLevel;
 		doSetImage2D( usageFlags
 			, tiling
 			, memoryFlags );
@@ -140,6 +159,8 @@ namespace renderer
 		m_layerCount = 1u;
 		m_mipmapLevels = mipmapLevels;
 		m_samples = SampleCountFlag::e1;
+		m_states.clear();
+		m_modifiedMipLevel = InvalidMipLevel;
 		doSetImage1D( usageFlags
 			, tiling
 			, memoryFlags );
@@ -159,6 +180,8 @@ namespace renderer
 		m_layerCount = 1u;
 		m_mipmapLevels = mipmapLevels;
 		m_samples = samples;
+		m_states.clear();
+		m_modifiedMipLevel = InvalidMipLevel;
 		doSetImage2D( usageFlags
 			, tiling
 			, memoryFlags );
@@ -178,6 +201,8 @@ namespace renderer
 		m_layerCount = 1u;
 		m_mipmapLevels = mipmapLevels;
 		m_samples = samples;
+		m_states.clear();
+		m_modifiedMipLevel = InvalidMipLevel;
 		doSetImage3D( usageFlags
 			, tiling
 			, memoryFlags );
@@ -197,6 +222,8 @@ namespace renderer
 		m_layerCount = layerCount;
 		m_mipmapLevels = mipmapLevels;
 		m_samples = SampleCountFlag::e1;
+		m_states.clear();
+		m_modifiedMipLevel = InvalidMipLevel;
 		doSetImage1D( usageFlags
 			, tiling
 			, memoryFlags );
@@ -216,8 +243,79 @@ namespace renderer
 		m_layerCount = layerCount;
 		m_mipmapLevels = mipmapLevels;
 		m_samples = SampleCountFlag::e1;
+		m_states.clear();
+		m_modifiedMipLevel = InvalidMipLevel;
 		doSetImage2D( usageFlags
 			, tiling
 			, memoryFlags );
 	}
+
+	void Texture::generateMipmaps()const
+	{
+		auto commandBuffer = m_device.getGraphicsCommandPool().createCommandBuffer();
+
+		if ( commandBuffer->begin( CommandBufferUsageFlag::eOneTimeSubmit ) )
+		{
+			commandBuffer->generateMipmaps( *this );
+			commandBuffer->end();
+			m_device.getGraphicsQueue().submit( *commandBuffer, nullptr );
+			m_device.getGraphicsQueue().waitIdle();
+		}
+	}
+
+	void Texture::invalidateMipmaps( uint32_t mipLevel )const
+	{
+		if ( mipLevel + 1u < m_mipmapLevels )
+		{
+			m_modifiedMipLevel = std::min( m_modifiedMipLevel, mipLevel );
+		}
+	}
+
+	ResourceState const & Texture::getState( uint32_t mipLevel
+		, uint32_t arrayLayer )const
+	{
+		auto & states = doGetStates();
+		auto levels = std::max( 1u, m_mipmapLevels );
+		auto index = std::min( arrayLayer * levels + mipLevel
+			, uint32_t( states.size() - 1u ) );
+		return states[index];
+	}
+
+	void Texture::setState( ImageSubresourceRange const & range
+		, ResourceState const & state )const
+	{
+		auto & states = doGetStates();
+		auto levels = std::max( 1u, m_mipmapLevels );
+		auto layers = uint32_t( states.size() ) / levels;
+		auto baseLevel = std::min( range.getBaseMipLevel(), levels - 1u );
+		auto baseLayer = std::min( range.getBaseArrayLayer(), layers - 1u );
+		auto levelCount = std::min( range.getLevelCount(), levels - baseLevel );
+		auto layerCount = std::min( range.getLayerCount(), layers - baseLayer );
+
+		for ( auto layer = baseLayer; layer < baseLayer + layerCount; ++layer )
+		{
+			for ( auto level = baseLevel; level < baseLevel + levelCount; ++level )
+			{
+				states[layer * levels + level] = state;
+			}
+		}
+	}
+
+	std::vector< ResourceState > & Texture::doGetStates()const
+	{
+		auto count = std::max( 1u, m_mipmapLevels ) * std::max( 1u, m_layerCount );
+
+		if ( m_states.size() != count )
+		{
+			m_states.resize( count
+				, ResourceState
+				{
+					ImageLayout::eUndefined,
+					0u,
+					PipelineStageFlag::eTopOfPipe
+				} );
+		}
+
+		return m_states;
+	}
 }
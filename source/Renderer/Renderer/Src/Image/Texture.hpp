@@ -7,6 +7,7 @@ See LICENSE file in root folder.
 #pragma once
 
 #include "ComponentMapping.hpp"
+#include "Sync/ResourceState.hpp"
 
 namespace renderer
 {
@@ -468,12 +469,77 @@ namespace renderer
 		/**
 		*\~french
 		*\brief
-		*	Génère les mipmaps de la texture.
+		*	Génère les mipmaps de la texture, immédiatement.
+		*\remarks
+		*	Enregistre CommandBuffer::generateMipmaps dans un tampon de commandes, le soumet et attend sa fin.
+		*	Les écritures dans l'image enregistrées dans d'autres tampons doivent donc avoir été soumises,
+		*	sinon CommandBuffer::generateMipmaps doit être enregistrée à leur suite.
 		*\~english
 		*\brief
-		*	Generates the texture mipmaps.
+		*	Generates the texture mipmaps, immediately.
+		*\remarks
+		*	Records CommandBuffer::generateMipmaps in a command buffer, submits it and waits for its completion.
+		*	The writes to the image recorded in other command buffers must hence have been submitted,
+		*	else CommandBuffer::generateMipmaps must be recorded after them.
 		*/
-		virtual void generateMipmaps()const = 0;
+		void generateMipmaps()const;
+		/**
+		*\~french
+		*\brief
+		*	Marque les niveaux de mipmap suivant celui donné comme obsolètes.
+		*\remarks
+		*	Appelée par les tampons de commandes lors de l'enregistrement d'une écriture dans l'image.
+		*\param[in] mipLevel
+		*	Le niveau modifié.
+		*\~english
+		*\brief
+		*	Flags the mipmap levels following the given one as stale.
+		*\remarks
+		*	Called by command buffers when a write to the image is recorded.
+		*\param[in] mipLevel
+		*	The modified level.
+		*/
+		void invalidateMipmaps( uint32_t mipLevel )const;
+		/**
+		*\~french
+		*\brief
+		*	Marque tous les niveaux de mipmap comme à jour.
+		*\remarks
+		*	Appelée par les tampons de commandes lors de l'enregistrement d'une génération des mipmaps.
+		*\~english
+		*\brief
+		*	Flags all the mipmap levels as up to date.
+		*\remarks
+		*	Called by command buffers when a mipmaps generation is recorded.
+		*/
+		inline void validateMipmaps()const noexcept
+		{
+			m_modifiedMipLevel = InvalidMipLevel;
+		}
+		/**
+		*\~french
+		*\return
+		*	\p true si des niveaux de mipmap doivent être régénérés.
+		*\~english
+		*\return
+		*	\p true if some mipmap levels need to be regenerated.
+		*/
+		inline bool hasStaleMipmaps()const noexcept
+		{
+			return m_modifiedMipLevel != InvalidMipLevel;
+		}
+		/**
+		*\~french
+		*\return
+		*	Le premier niveau de mipmap modifié, significatif seulement si hasStaleMipmaps() est vrai.
+		*\~english
+		*\return
+		*	The first modified mipmap level, only meaningful if hasStaleMipmaps() is true.
+		*/
+		inline uint32_t getModifiedMipLevel()const noexcept
+		{
+			return m_modifiedMipLevel;
+		}
 		/**
 		*\~french
 		*\return
@@ -534,8 +600,61 @@ namespace renderer
 		{
 			return m_type;
 		}
+		/**
+		*\~french
+		*\brief
+		*	Récupère l'état suivi d'une sous-ressource de l'image.
+		*\param[in] mipLevel
+		*	Le niveau de mipmap.
+		*\param[in] arrayLayer
+		*	La couche du tableau.
+		*\return
+		*	Le dernier état enregistré pour la sous-ressource.
+		*\~english
+		*\brief
+		*	Retrieves the tracked state of an image subresource.
+		*\param[in] mipLevel
+		*	The mipmap level.
+		*\param[in] arrayLayer
+		*	The array layer.
+		*\return
+		*	The last state recorded for the subresource.
+		*/
+		ResourceState const & getState( uint32_t mipLevel
+			, uint32_t arrayLayer )const;
+		/**
+		*\~french
+		*\brief
+		*	Définit l'état suivi des sous-ressources de l'image.
+		*\remarks
+		*	Appelée par les tampons de commandes lors de l'enregistrement d'une barrière ou d'une passe de rendu.
+		*\param[in] range
+		*	Les sous-ressources concernées.
+		*\param[in] state
+		*	Le nouvel état.
+		*\~english
+		*\brief
+		*	Defines the tracked state of the image subresources.
+		*\remarks
+		*	Called by command buffers when a barrier or a render pass is recorded.
+		*\param[in] range
+		*	The affected subresources.
+		*\param[in] state
+		*	The new state.
+		*/
+		void setState( ImageSubresourceRange const & range
+			, ResourceState const & state )const;
 
 	private:
+		/**
+		*\~french
+		*\return
+		*	Les états des sous-ressources, redimensionnés selon les niveaux de mipmap et les couches courants.
+		*\~english
+		*\return
+		*	The subresources states, resized to fit the current mipmap levels and layers.
+		*/
+		std::vector< ResourceState > & doGetStates()const;
 		/**
 		*\~french
 		*\brief
@@ -614,6 +733,11 @@ namespace renderer
 		uint32_t m_mipmapLevels{ 1u };
 		PixelFormat m_format{ PixelFormat::eR8G8B8 };
 		SampleCountFlag m_samples{ SampleCountFlag::e1 };
+
+	private:
+		static uint32_t constexpr InvalidMipLevel = ~( 0u );
+		mutable std::vector< ResourceState > m_states;
+		mutable uint32_t m_modifiedMipLevel{ InvalidMipLevel };
 	};
 }
 
@@ -42,6 +42,9 @@ namespace renderer
 		std::optional< TessellationState > tessellationState;
 		std::optional< Viewport > viewport;
 		std::optional< Scissor > scissor;
+		//!\~english	The index of the render pass subpass in which the pipeline is used.
+		//!\~french	L'indice de la sous-passe de la passe de rendu dans laquelle le pipeline est utilisé.
+		uint32_t subpass = 0u;
 	};
 }
 
@@ -62,6 +62,11 @@ namespace renderer
 		*\~english
 		*\brief
 		*	Rerieves the status or result of a set of queries.
+		*\remarks
+		*	Without QueryResultFlag::eWait, the call doesn't block, and the results of the unavailable
+		*	queries are not written (unless QueryResultFlag::ePartial is set, where supported).
+		*	With QueryResultFlag::eWithAvailability, each result is followed by its availability
+		*	(non zero if available), \p stride must hence leave room for it.
 		*\param[in] firstQuery
 		*	The first query index.
 		*\param[in] queryCount
@@ -72,9 +77,16 @@ namespace renderer
 		*	Specifies how and when results are returned.
 		*\param[out] data
 		*	Receives the results.
+		*\return
+		*	\p true if all the queries results were available.
 		*\~french
 		*\brief
 		*	Récupère le statut ou le résultat d'un ensemble de requêtes.
+		*\remarks
+		*	Sans QueryResultFlag::eWait, l'appel ne bloque pas, et les résultats des requêtes
+		*	non disponibles ne sont pas écrits (sauf si QueryResultFlag::ePartial est défini, là où c'est supporté).
+		*	Avec QueryResultFlag::eWithAvailability, chaque résultat est suivi de sa disponibilité
+		*	(non nulle si disponible), \p stride doit donc lui laisser de la place.
 		*\param[in] firstQuery
 		*	L'index de la première requête.
 		*\param[in] queryCount
@@ -85,8 +97,10 @@ namespace renderer
 		*	Définit quand et comment les résultats sont récupérés.
 		*\param[out] data
 		*	Reçoit les résultats.
+		*\return
+		*	\p true si les résultats de toutes les requêtes étaient disponibles.
 		*/
-		virtual void getResults( uint32_t firstQuery
+		virtual bool getResults( uint32_t firstQuery
 			, uint32_t queryCount
 			, uint32_t stride
 			, QueryResultFlags flags
@@ -95,6 +109,11 @@ namespace renderer
 		*\~english
 		*\brief
 		*	Rerieves the status or result of a set of queries.
+		*\remarks
+		*	Without QueryResultFlag::eWait, the call doesn't block, and the results of the unavailable
+		*	queries are not written (unless QueryResultFlag::ePartial is set, where supported).
+		*	With QueryResultFlag::eWithAvailability, each result is followed by its availability
+		*	(non zero if available), \p stride must hence leave room for it.
 		*\param[in] firstQuery
 		*	The first query index.
 		*\param[in] queryCount
@@ -105,9 +124,16 @@ namespace renderer
 		*	Specifies how and when results are returned.
 		*\param[out] data
 		*	Receives the results.
+		*\return
+		*	\p true if all the queries results were available.
 		*\~french
 		*\brief
 		*	Récupère le statut ou le résultat d'un ensemble de requêtes.
+		*\remarks
+		*	Sans QueryResultFlag::eWait, l'appel ne bloque pas, et les résultats des requêtes
+		*	non disponibles ne sont pas écrits (sauf si QueryResultFlag::ePartial est défini, là où c'est supporté).
+		*	Avec QueryResultFlag::eWithAvailability, chaque résultat est suivi de sa disponibilité
+		*	(non nulle si disponible), \p stride doit donc lui laisser de la place.
 		*\param[in] firstQuery
 		*	L'index de la première requête.
 		*\param[in] queryCount
@@ -118,8 +144,10 @@ namespace renderer
 		*	Définit quand et comment les résultats sont récupérés.
 		*\param[out] data
 		*	Reçoit les résultats.
+		*\return
+		*	\p true si les résultats de toutes les requêtes étaient disponibles.
 		*/
-		virtual void getResults( uint32_t firstQuery
+		virtual bool getResults( uint32_t firstQuery
 			, uint32_t queryCount
 			, uint32_t stride
 			, QueryResultFlags flags
@@ -59,6 +59,10 @@ namespace renderer
 			return "RGBA16F";
 		case PixelFormat::eRGBA32F:
 			return "RGBA32F";
+		case PixelFormat::eR8G8B8A8_SRGB:
+			return "R8G8B8A8_SRGB";
+		case PixelFormat::eR10G10B10A2:
+			return "R10G10B10A2";
 		case PixelFormat::eD16:
 			return "D16";
 		case PixelFormat::eD24S8:
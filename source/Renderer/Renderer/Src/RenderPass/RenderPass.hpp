@@ -72,6 +72,8 @@ namespace renderer
 		*\remarks
 		*	Si la compatibilité entre les textures voulues et les formats de la passe de rendu
 		*	n'est pas possible, une std::runtime_error est lancée.
+		*	Si toutes les vues ont plusieurs couches, le tampon d'images est en couches,
+		*	la couche dessinée étant choisie via gl_Layer.
 		*\param[in] dimensions
 		*	Les dimensions du tampon d'images.
 		*\param[in] attaches
@@ -84,6 +86,8 @@ namespace renderer
 		*\remarks
 		*	If the compatibility between wanted views and the render pass' formats
 		*	is not possible, a std::runtime_error will be thrown.
+		*	If all the views have multiple layers, the frame buffer is layered,
+		*	the drawn layer being selected through gl_Layer.
 		*\param[in] dimensions
 		*	The frame buffer's dimensions.
 		*\param[in] attaches
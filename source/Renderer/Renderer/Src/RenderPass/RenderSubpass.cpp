@@ -17,6 +17,8 @@ namespace renderer
 		, RenderSubpassAttachmentArray const & resolveAttaches
 		, RenderSubpassAttachment const * depthAttach
 		, UInt32Array const & preserveAttaches )
+		: m_inputAttaches{ inputAttaches }
+		, m_colourAttaches{ colourAttaches }
 	{
 	}
 }
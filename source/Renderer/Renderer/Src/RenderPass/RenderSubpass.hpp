@@ -96,6 +96,34 @@ namespace renderer
 		*	Destructeur.
 		*/
 		virtual ~RenderSubpass() = default;
+		/**
+		*\~english
+		*\return
+		*	The attaches read through subpass inputs.
+		*\~french
+		*\return
+		*	Les attaches lues via les entrées de sous-passe.
+		*/
+		inline RenderSubpassAttachmentArray const & getInputAttaches()const
+		{
+			return m_inputAttaches;
+		}
+		/**
+		*\~english
+		*\return
+		*	The colour attaches.
+		*\~french
+		*\return
+		*	Les attaches couleur.
+		*/
+		inline RenderSubpassAttachmentArray const & getColourAttaches()const
+		{
+			return m_colourAttaches;
+		}
+
+	private:
+		RenderSubpassAttachmentArray m_inputAttaches;
+		RenderSubpassAttachmentArray m_colourAttaches;
 	};
 }
 
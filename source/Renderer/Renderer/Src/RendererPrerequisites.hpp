@@ -120,6 +120,7 @@ namespace renderer
 	struct RenderPassAttachment;
 	struct RenderSubpassAttachment;
 	struct RenderSubpassState;
+	struct ResourceState;
 	struct SpecialisationMapEntry;
 	struct VertexInputAttributeDescription;
 	struct VertexInputBindingDescription;
@@ -0,0 +1,132 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#ifndef ___Renderer_ResourceState_HPP___
+#define ___Renderer_ResourceState_HPP___
+#pragma once
+
+#include "RendererPrerequisites.hpp"
+
+namespace renderer
+{
+	/**
+	*\~english
+	*\brief
+	*	The last known usage of a resource (or of an image subresource), as recorded in command buffers.
+	*\remarks
+	*	The layout is meaningless for buffers.
+	*	The state is updated when commands are recorded, it is only right if the command buffers
+	*	are submitted in their recording order, and recorded again when their resources usage changes.
+	*\~french
+	*\brief
+	*	La dernière utilisation connue d'une ressource (ou d'une sous-ressource d'image), telle qu'enregistrée dans les tampons de commandes.
+	*\remarks
+	*	Le layout n'a pas de sens pour les tampons.
+	*	L'état est mis à jour lors de l'enregistrement des commandes, il n'est juste que si les tampons de commandes
+	*	sont soumis dans leur ordre d'enregistrement, et réenregistrés quand l'utilisation de leurs ressources change.
+	*/
+	struct ResourceState
+	{
+		/**
+		*\~english
+		*\brief
+		*	The image layout.
+		*\~french
+		*\brief
+		*	Le layout de l'image.
+		*/
+		ImageLayout layout;
+		/**
+		*\~english
+		*\brief
+		*	The access flags.
+		*\~french
+		*\brief
+		*	Les indicateurs d'accès.
+		*/
+		AccessFlags access;
+		/**
+		*\~english
+		*\brief
+		*	The pipeline stage flags.
+		*\~french
+		*\brief
+		*	Les indicateurs d'état du pipeline.
+		*/
+		PipelineStageFlags stage;
+		/**
+		*\~english
+		*\brief
+		*	The access flags of the last write, made visible to \p access and \p stage only.
+		*\remarks
+		*	Meaningless when \p access contains a write access.
+		*\~french
+		*\brief
+		*	Les indicateurs d'accès de la dernière écriture, rendue visible à \p access et \p stage uniquement.
+		*\remarks
+		*	N'a pas de sens quand \p access contient un accès en écriture.
+		*/
+		AccessFlags lastWriteAccess;
+		/**
+		*\~english
+		*\brief
+		*	The pipeline stage flags of the last write (or layout transition), 0 if nothing was written yet.
+		*\~french
+		*\brief
+		*	Les indicateurs d'étape du pipeline de la dernière écriture (ou transition de layout), 0 si rien n'a encore été écrit.
+		*/
+		PipelineStageFlags lastWriteStage;
+	};
+	/**
+	*\~english
+	*\brief
+	*	Equality operator.
+	*\~french
+	*\brief
+	*	Opérateur d'égalité.
+	*/
+	inline bool operator==( ResourceState const & lhs, ResourceState const & rhs )
+	{
+		return lhs.layout == rhs.layout
+			&& lhs.access == rhs.access
+			&& lhs.stage == rhs.stage
+			&& lhs.lastWriteAccess == rhs.lastWriteAccess
+			&& lhs.lastWriteStage == rhs.lastWriteStage;
+	}
+	/**
+	*\~english
+	*\brief
+	*	Difference operator.
+	*\~french
+	*\brief
+	*	Opérateur de différence.
+	*/
+	inline bool operator!=( ResourceState const & lhs, ResourceState const & rhs )
+	{
+		return !( lhs == rhs );
+	}
+	/**
+	*\~english
+	*\param[in] access
+	*	The access flags.
+	*\return
+	*	\p true if the given access flags contain a write access.
+	*\~french
+	*\param[in] access
+	*	Les indicateurs d'accès.
+	*\return
+	*	\p true si les indicateurs d'accès donnés contiennent un accès en écriture.
+	*/
+	inline bool hasWriteAccess( AccessFlags access )
+	{
+		return 0u != ( access & ( AccessFlag::eShaderWrite
+			| AccessFlag::eColourAttachmentWrite
+			| AccessFlag::eDepthStencilAttachmentWrite
+			| AccessFlag::eTransferWrite
+			| AccessFlag::eHostWrite
+			| AccessFlag::eMemoryWrite ) );
+	}
+}
+
+#endif
@@ -25,6 +25,7 @@ content = string.gsub( content, "${RENDERLIB_XCB}", 0 )
 content = string.gsub( content, "${RENDERLIB_ANDROID}",0 )
 content = string.gsub( content, "${RENDERLIB_MIR}",0 )
 content = string.gsub( content, "${RENDERLIB_WAYLAND}",0 )
+content = string.gsub( content, "${RENDERLIB_STATISTICS}", 1 )
 io.writefile( configFile, content )
 
 forceincludes( "RendererPch.hpp" )
@@ -60,6 +60,7 @@ namespace vk_renderer
 		, uint32_t size
 		, renderer::MemoryMapFlags flags )const
 	{
+		renderer::countStatistic( renderer::Statistic::eBufferMap );
 		return m_storage->lock( offset
 			, size
 			, convert( flags ) );
@@ -68,6 +69,8 @@ namespace vk_renderer
 	void Buffer::flush( uint32_t offset
 		, uint32_t size )const
 	{
+		renderer::countStatistic( renderer::Statistic::eUpload );
+		renderer::countStatistic( renderer::Statistic::eUploadedBytes, size );
 		m_storage->flush( offset, size );
 	}
 
@@ -106,7 +109,7 @@ namespace vk_renderer
 	{
 		renderer::BufferMemoryBarrier memoryBarrier
 		{
-			m_currentAccessMask,                              // srcAccessMask
+			getState().access,                                // srcAccessMask
 			dstAccess,                                        // dstAccessMask
 			VK_QUEUE_FAMILY_IGNORED,                          // srcQueueFamilyIndex
 			VK_QUEUE_FAMILY_IGNORED,                          // dstQueueFamilyIndex
@@ -115,7 +118,6 @@ namespace vk_renderer
 			VK_WHOLE_SIZE                                     // size
 		};
 		DEBUG_DUMP( convert( memoryBarrier ) );
-		m_currentAccessMask = convert( dstAccess );
 		return memoryBarrier;
 	}
 }
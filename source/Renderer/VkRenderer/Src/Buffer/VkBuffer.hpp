@@ -118,7 +118,6 @@ namespace vk_renderer
 		uint32_t m_size{ 0u };
 		VkBuffer m_buffer{ VK_NULL_HANDLE };
 		BufferStoragePtr m_storage;
-		mutable VkAccessFlags m_currentAccessMask{ VK_ACCESS_MEMORY_WRITE_BIT };
 	};
 }
 
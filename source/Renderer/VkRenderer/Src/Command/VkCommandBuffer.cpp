@@ -33,6 +33,9 @@ See LICENSE file in root folder.
 #include <Buffer/StagingBuffer.hpp>
 #include <Buffer/VertexBuffer.hpp>
 #include <RenderPass/FrameBufferAttachment.hpp>
+#include <Sync/ResourceState.hpp>
+
+#include <algorithm>
 
 namespace vk_renderer
 {
@@ -73,6 +76,14 @@ namespace vk_renderer
 
 			return result;
 		}
+
+		renderer::PipelineStageFlags getAccessStages( renderer::ResourceState const & state )
+		{
+			renderer::PipelineStageFlags result = state.stage | state.lastWriteStage;
+			return result
+				? result
+				: renderer::PipelineStageFlags{ renderer::PipelineStageFlag::eTopOfPipe };
+		}
 	}
 
 	CommandBuffer::CommandBuffer( Device const & device
@@ -116,6 +127,7 @@ namespace vk_renderer
 		};
 		DEBUG_DUMP( cmdBufInfo );
 		auto res = m_device.vkBeginCommandBuffer( m_commandBuffer, &cmdBufInfo );
+		doResetStatistics();
 		m_currentPipeline = nullptr;
 		m_currentComputePipeline = nullptr;
 		return checkError( res );
@@ -134,6 +146,7 @@ namespace vk_renderer
 		};
 		DEBUG_DUMP( cmdBufInfo );
 		auto res = m_device.vkBeginCommandBuffer( m_commandBuffer, &cmdBufInfo );
+		doResetStatistics();
 		m_currentPipeline = nullptr;
 		m_currentComputePipeline = nullptr;
 		return checkError( res );
@@ -150,10 +163,11 @@ namespace vk_renderer
 	bool CommandBuffer::reset( renderer::CommandBufferResetFlags flags )const
 	{
 		auto res = m_device.vkResetCommandBuffer( m_commandBuffer, convert( flags ) );
+		doResetStatistics();
 		return checkError( res );
 	}
 
-	void CommandBuffer::beginRenderPass( renderer::RenderPass const & renderPass
+	void CommandBuffer::doBeginRenderPass( renderer::RenderPass const & renderPass
 		, renderer::FrameBuffer const & frameBuffer
 		, renderer::ClearValueArray const & clearValues
 		, renderer::SubpassContents contents )const
@@ -198,6 +212,7 @@ namespace vk_renderer
 
 	void CommandBuffer::executeCommands( renderer::CommandBufferCRefArray const & commands )const
 	{
+		doCountStatistics( commands );
 		auto vkCommands = makeVkArray< VkCommandBuffer >( convert( commands ) );
 		m_device.vkCmdExecuteCommands( m_commandBuffer
 			, uint32_t( vkCommands.size() )
@@ -245,6 +260,7 @@ namespace vk_renderer
 	void CommandBuffer::bindPipeline( renderer::Pipeline const & pipeline
 		, renderer::PipelineBindPoint bindingPoint )const
 	{
+		doCountStatistic( renderer::Statistic::ePipelineBind );
 		m_device.vkCmdBindPipeline( m_commandBuffer
 			, convert( bindingPoint )
 			, static_cast< Pipeline const & >( pipeline ) );
@@ -254,6 +270,7 @@ namespace vk_renderer
 	void CommandBuffer::bindPipeline( renderer::ComputePipeline const & pipeline
 		, renderer::PipelineBindPoint bindingPoint )const
 	{
+		doCountStatistic( renderer::Statistic::ePipelineBind );
 		m_device.vkCmdBindPipeline( m_commandBuffer
 			, convert( bindingPoint )
 			, static_cast< ComputePipeline const & >( pipeline ) );
@@ -288,7 +305,7 @@ namespace vk_renderer
 			, convert( indexType ) );
 	}
 
-	void CommandBuffer::memoryBarrier( renderer::PipelineStageFlags after
+	void CommandBuffer::doMemoryBarrier( renderer::PipelineStageFlags after
 		, renderer::PipelineStageFlags before
 		, renderer::BufferMemoryBarrier const & transitionBarrier )const
 	{
@@ -296,8 +313,8 @@ namespace vk_renderer
 		auto vkbefore = convert( before );
 		auto vktb = convert( transitionBarrier );
 		m_device.vkCmdPipelineBarrier( m_commandBuffer
-			, vkbefore
 			, vkafter
+			, vkbefore
 			, 0
 			, 0u
 			, nullptr
@@ -307,7 +324,7 @@ namespace vk_renderer
 			, nullptr );
 	}
 
-	void CommandBuffer::memoryBarrier( renderer::PipelineStageFlags after
+	void CommandBuffer::doMemoryBarrier( renderer::PipelineStageFlags after
 		, renderer::PipelineStageFlags before
 		, renderer::ImageMemoryBarrier const & transitionBarrier )const
 	{
@@ -315,8 +332,8 @@ namespace vk_renderer
 		auto vkbefore = convert( before );
 		auto vktb = convert( transitionBarrier );
 		m_device.vkCmdPipelineBarrier( m_commandBuffer
-			, vkbefore
 			, vkafter
+			, vkbefore
 			, 0
 			, 0u
 			, nullptr
@@ -331,6 +348,7 @@ namespace vk_renderer
 		, renderer::UInt32Array const & dynamicOffsets
 		, renderer::PipelineBindPoint bindingPoint )const
 	{
+		doCountStatistic( renderer::Statistic::eDescriptorSetBind, descriptorSets.size() );
 		auto vkDescriptors = makeVkArray< VkDescriptorSet >( convert( descriptorSets ) );
 		m_device.vkCmdBindDescriptorSets( m_commandBuffer
 			, convert( bindingPoint )
@@ -365,6 +383,7 @@ namespace vk_renderer
 		, uint32_t firstVertex
 		, uint32_t firstInstance )const
 	{
+		doCountStatistic( renderer::Statistic::eDrawCall );
 		assert( m_currentPipeline && "No pipeline bound." );
 		m_device.vkCmdDraw( m_commandBuffer
 			, vtxCount
@@ -379,6 +398,7 @@ namespace vk_renderer
 		, uint32_t vertexOffset
 		, uint32_t firstInstance )const
 	{
+		doCountStatistic( renderer::Statistic::eDrawCall );
 		assert( m_currentPipeline && "No pipeline bound." );
 		m_device.vkCmdDrawIndexed( m_commandBuffer
 			, indexCount
@@ -393,6 +413,7 @@ namespace vk_renderer
 		, uint32_t drawCount
 		, uint32_t stride )const
 	{
+		doCountStatistic( renderer::Statistic::eDrawCall );
 		assert( m_currentPipeline && "No pipeline bound." );
 		m_device.vkCmdDrawIndirect( m_commandBuffer
 			, static_cast< Buffer const & >( buffer )
@@ -406,6 +427,7 @@ namespace vk_renderer
 		, uint32_t drawCount
 		, uint32_t stride )const
 	{
+		doCountStatistic( renderer::Statistic::eDrawCall );
 		assert( m_currentPipeline && "No pipeline bound." );
 		m_device.vkCmdDrawIndexedIndirect( m_commandBuffer
 			, static_cast< Buffer const & >( buffer )
@@ -414,7 +436,68 @@ namespace vk_renderer
 			, stride );
 	}
 
-	void CommandBuffer::copyToImage( renderer::BufferImageCopyArray const & copyInfo
+	void CommandBuffer::drawIndirectCount( renderer::BufferBase const & buffer
+		, uint32_t offset
+		, renderer::BufferBase const & countBuffer
+		, uint32_t countBufferOffset
+		, uint32_t maxDrawCount
+		, uint32_t stride )const
+	{
+		doCountStatistic( renderer::Statistic::eDrawCall );
+		assert( m_currentPipeline && "No pipeline bound." );
+
+		// The function may be exposed by the loader without the extension being enabled on the device.
+		if ( m_device.getPhysicalDevice().isDrawIndirectCountSupported() )
+		{
+			m_device.vkCmdDrawIndirectCountKHR( m_commandBuffer
+				, static_cast< Buffer const & >( buffer )
+				, offset
+				, static_cast< Buffer const & >( countBuffer )
+				, countBufferOffset
+				, maxDrawCount
+				, stride );
+		}
+		else
+		{
+			m_device.vkCmdDrawIndirect( m_commandBuffer
+				, static_cast< Buffer const & >( buffer )
+				, offset
+				, maxDrawCount
+				, stride );
+		}
+	}
+
+	void CommandBuffer::drawIndexedIndirectCount( renderer::BufferBase const & buffer
+		, uint32_t offset
+		, renderer::BufferBase const & countBuffer
+		, uint32_t countBufferOffset
+		, uint32_t maxDrawCount
+		, uint32_t stride )const
+	{
+		doCountStatistic( renderer::Statistic::eDrawCall );
+		assert( m_currentPipeline && "No pipeline bound." );
+
+		if ( m_device.getPhysicalDevice().isDrawIndirectCountSupported() )
+		{
+			m_device.vkCmdDrawIndexedIndirectCountKHR( m_commandBuffer
+				, static_cast< Buffer const & >( buffer )
+				, offset
+				, static_cast< Buffer const & >( countBuffer )
+				, countBufferOffset
+				, maxDrawCount
+				, stride );
+		}
+		else
+		{
+			m_device.vkCmdDrawIndexedIndirect( m_commandBuffer
+				, static_cast< Buffer const & >( buffer )
+				, offset
+				, maxDrawCount
+				, stride );
+		}
+	}
+
+	void CommandBuffer::doCopyToImage( renderer::BufferImageCopyArray const & copyInfo
 		, renderer::BufferBase const & src
 		, renderer::Texture const & dst )const
 	{
@@ -455,7 +538,7 @@ namespace vk_renderer
 			, &vkcopyInfo );
 	}
 
-	void CommandBuffer::copyImage( renderer::ImageCopy const & copyInfo
+	void CommandBuffer::doCopyImage( renderer::ImageCopy const & copyInfo
 		, renderer::TextureView const & src
 		, renderer::TextureView const & dst )const
 	{
@@ -470,7 +553,7 @@ namespace vk_renderer
 			, &vkcopyInfo );
 	}
 
-	void CommandBuffer::blitImage( renderer::Texture const & srcImage
+	void CommandBuffer::doBlitImage( renderer::Texture const & srcImage
 		, renderer::ImageLayout srcLayout
 		, renderer::Texture const & dstImage
 		, renderer::ImageLayout dstLayout
@@ -489,6 +572,99 @@ namespace vk_renderer
 			, convert( filter ) );
 	}
 
+	void CommandBuffer::doGenerateMipmaps( renderer::Texture const & texture
+		, uint32_t baseMipLevel
+		, renderer::ResourceState const & finalState )const
+	{
+		auto aspectMask = renderer::getAspectMask( texture.getFormat() );
+		auto layerCount = texture.getLayerCount();
+		auto levelCount = texture.getMipmapLevels() - baseMipLevel - 1u;
+		renderer::ImageSubresourceRange srcRange{ aspectMask, baseMipLevel, 1u, 0u, layerCount };
+		renderer::ImageSubresourceRange dstRange{ aspectMask, baseMipLevel + 1u, levelCount, 0u, layerCount };
+		auto srcState = texture.getState( baseMipLevel, 0u );
+		auto dstState = texture.getState( baseMipLevel + 1u, 0u );
+		// The source level keeps its content, hence the transition from its tracked layout,
+		// once its last write is visible.
+		doMemoryBarrier( getAccessStages( srcState )
+			, renderer::PipelineStageFlag::eTransfer
+			, renderer::ImageMemoryBarrier{ srcState.lastWriteAccess
+				, renderer::AccessFlag::eTransferRead
+				, srcState.layout
+				, renderer::ImageLayout::eTransferSrcOptimal
+				, ~( 0u )
+				, ~( 0u )
+				, texture
+				, srcRange } );
+		// The other levels are overwritten, they only wait for their previous accesses.
+		doMemoryBarrier( getAccessStages( dstState )
+			, renderer::PipelineStageFlag::eTransfer
+			, renderer::ImageMemoryBarrier{ dstState.lastWriteAccess
+				, renderer::AccessFlag::eTransferWrite
+				, renderer::ImageLayout::eUndefined
+				, renderer::ImageLayout::eTransferDstOptimal
+				, ~( 0u )
+				, ~( 0u )
+				, texture
+				, dstRange } );
+
+		auto const width = int32_t( std::max( 1u, texture.getDimensions()[0] >> baseMipLevel ) );
+		auto const height = int32_t( std::max( 1u, texture.getDimensions()[1] >> baseMipLevel ) );
+
+		for ( uint32_t i = baseMipLevel + 1u; i < texture.getMipmapLevels(); ++i )
+		{
+			VkImageBlit imageBlit = {};
+			imageBlit.srcSubresource.aspectMask = getImageAspectFlags( texture.getFormat() );
+			imageBlit.srcSubresource.baseArrayLayer = 0;
+			imageBlit.srcSubresource.layerCount = layerCount;
+			imageBlit.srcSubresource.mipLevel = baseMipLevel;
+			imageBlit.srcOffsets[0] = { 0, 0, 0 };
+			imageBlit.srcOffsets[1] = { width, height, 1 };
+
+			imageBlit.dstSubresource.aspectMask = getImageAspectFlags( texture.getFormat() );
+			imageBlit.dstSubresource.baseArrayLayer = 0;
+			imageBlit.dstSubresource.layerCount = layerCount;
+			imageBlit.dstSubresource.mipLevel = i;
+			imageBlit.dstOffsets[0] = { 0, 0, 0 };
+			imageBlit.dstOffsets[1] = { std::max( 1, width >> ( i - baseMipLevel ) )
+				, std::max( 1, height >> ( i - baseMipLevel ) )
+				, 1 };
+
+			m_device.vkCmdBlitImage( m_commandBuffer
+				, static_cast< Texture const & >( texture )
+				, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL
+				, static_cast< Texture const & >( texture )
+				, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL
+				, 1
+				, &imageBlit
+				, VK_FILTER_LINEAR );
+		}
+
+		// All the levels then go to the final state, the one tracked from now on.
+		auto before = finalState.stage
+			? finalState.stage
+			: renderer::PipelineStageFlags{ renderer::PipelineStageFlag::eBottomOfPipe };
+		doMemoryBarrier( renderer::PipelineStageFlag::eTransfer
+			, before
+			, renderer::ImageMemoryBarrier{ renderer::AccessFlags{}
+				, finalState.access
+				, renderer::ImageLayout::eTransferSrcOptimal
+				, finalState.layout
+				, ~( 0u )
+				, ~( 0u )
+				, texture
+				, srcRange } );
+		doMemoryBarrier( renderer::PipelineStageFlag::eTransfer
+			, before
+			, renderer::ImageMemoryBarrier{ renderer::AccessFlag::eTransferWrite
+				, finalState.access
+				, renderer::ImageLayout::eTransferDstOptimal
+				, finalState.layout
+				, ~( 0u )
+				, ~( 0u )
+				, texture
+				, dstRange } );
+	}
+
 	void CommandBuffer::resetQueryPool( renderer::QueryPool const & pool
 		, uint32_t firstQuery
 		, uint32_t queryCount )const
@@ -527,6 +703,24 @@ namespace vk_renderer
 			, query );
 	}
 
+	void CommandBuffer::copyQueryPoolResults( renderer::QueryPool const & pool
+		, uint32_t firstQuery
+		, uint32_t queryCount
+		, renderer::BufferBase const & dstBuffer
+		, uint32_t dstOffset
+		, uint32_t stride
+		, renderer::QueryResultFlags flags )const
+	{
+		m_device.vkCmdCopyQueryPoolResults( m_commandBuffer
+			, static_cast< QueryPool const & >( pool )
+			, firstQuery
+			, queryCount
+			, static_cast< Buffer const & >( dstBuffer )
+			, dstOffset
+			, stride
+			, convert( flags ) );
+	}
+
 	void CommandBuffer::pushConstants( renderer::PipelineLayout const & layout
 		, renderer::PushConstantsBufferBase const & pcb )const
 	{
@@ -542,6 +736,7 @@ namespace vk_renderer
 		, uint32_t groupCountY
 		, uint32_t groupCountZ )const
 	{
+		doCountStatistic( renderer::Statistic::eDispatch );
 		assert( m_currentComputePipeline && "No compute pipeline bound." );
 		m_device.vkCmdDispatch( m_commandBuffer
 			, groupCountX
@@ -552,6 +747,7 @@ namespace vk_renderer
 	void CommandBuffer::dispatchIndirect( renderer::BufferBase const & buffer
 		, uint32_t offset )const
 	{
+		doCountStatistic( renderer::Statistic::eDispatch );
 		assert( m_currentComputePipeline && "No pipeline bound." );
 		m_device.vkCmdDispatchIndirect( m_commandBuffer
 			, static_cast< Buffer const & >( buffer )
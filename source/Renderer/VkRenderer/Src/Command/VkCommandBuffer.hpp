@@ -69,13 +69,6 @@ namespace vk_renderer
 		*/
 		bool reset( renderer::CommandBufferResetFlags flags )const override;
 		/**
-		*\copydoc	renderer::CommandBuffer:beginRenderPass
-		*/
-		void beginRenderPass( renderer::RenderPass const & renderPass
-			, renderer::FrameBuffer const & frameBuffer
-			, renderer::ClearValueArray const & clearValues
-			, renderer::SubpassContents contents )const override;
-		/**
 		*\copydoc	renderer::CommandBuffer:nextSubpass
 		*/
 		void nextSubpass( renderer::SubpassContents contents )const override;
@@ -103,18 +96,6 @@ namespace vk_renderer
 		void clearAttachments( renderer::ClearAttachmentArray const & clearAttachments
 			, renderer::ClearRectArray const & clearRects )override;
 		/**
-		*\copydoc	renderer::CommandBuffer:memoryBarrier
-		*/
-		void memoryBarrier( renderer::PipelineStageFlags after
-			, renderer::PipelineStageFlags before
-			, renderer::BufferMemoryBarrier const & transitionBarrier )const override;
-		/**
-		*\copydoc	renderer::CommandBuffer:memoryBarrier
-		*/
-		void memoryBarrier( renderer::PipelineStageFlags after
-			, renderer::PipelineStageFlags before
-			, renderer::ImageMemoryBarrier const & transitionBarrier )const override;
-		/**
 		*\copydoc	renderer::CommandBuffer:bindPipeline
 		*/
 		void bindPipeline( renderer::Pipeline const & pipeline
@@ -181,11 +162,23 @@ namespace vk_renderer
 			, uint32_t drawCount
 			, uint32_t stride )const override;
 		/**
-		*\copydoc	renderer::CommandBuffer::copyToImage
+		*\copydoc	renderer::CommandBuffer::drawIndirectCount
 		*/
-		void copyToImage( renderer::BufferImageCopyArray const & copyInfo
-			, renderer::BufferBase const & src
-			, renderer::Texture const & dst )const override;
+		void drawIndirectCount( renderer::BufferBase const & buffer
+			, uint32_t offset
+			, renderer::BufferBase const & countBuffer
+			, uint32_t countBufferOffset
+			, uint32_t maxDrawCount
+			, uint32_t stride )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::drawIndexedIndirectCount
+		*/
+		void drawIndexedIndirectCount( renderer::BufferBase const & buffer
+			, uint32_t offset
+			, renderer::BufferBase const & countBuffer
+			, uint32_t countBufferOffset
+			, uint32_t maxDrawCount
+			, uint32_t stride )const override;
 		/**
 		*\copydoc	renderer::CommandBuffer::copyToBuffer
 		*/
@@ -199,21 +192,6 @@ namespace vk_renderer
 			, renderer::BufferBase const & src
 			, renderer::BufferBase const & dst )const override;
 		/**
-		*\copydoc	renderer::CommandBuffer:copyImage
-		*/
-		void copyImage( renderer::ImageCopy const & copyInfo
-			, renderer::TextureView const & src
-			, renderer::TextureView const & dst )const override;
-		/**
-		*\copydoc	renderer::CommandBuffer:blitImage
-		*/
-		void blitImage( renderer::Texture const & srcImage
-			, renderer::ImageLayout srcLayout
-			, renderer::Texture const & dstImage
-			, renderer::ImageLayout dstLayout
-			, std::vector< renderer::ImageBlit > const & regions
-			, renderer::Filter filter )const override;
-		/**
 		*\copydoc	renderer::CommandBuffer:resetQueryPool
 		*/
 		void resetQueryPool( renderer::QueryPool const & pool
@@ -237,6 +215,16 @@ namespace vk_renderer
 			, renderer::QueryPool const & pool
 			, uint32_t query )const override;
 		/**
+		*\copydoc	renderer::CommandBuffer:copyQueryPoolResults
+		*/
+		void copyQueryPoolResults( renderer::QueryPool const & pool
+			, uint32_t firstQuery
+			, uint32_t queryCount
+			, renderer::BufferBase const & dstBuffer
+			, uint32_t dstOffset
+			, uint32_t stride
+			, renderer::QueryResultFlags flags )const override;
+		/**
 		*\copydoc	renderer::CommandBuffer:pushConstants
 		*/
 		void pushConstants( renderer::PipelineLayout const & layout
@@ -295,6 +283,52 @@ namespace vk_renderer
 		}
 
 	private:
+		/**
+		*\copydoc	renderer::CommandBuffer::doBeginRenderPass
+		*/
+		void doBeginRenderPass( renderer::RenderPass const & renderPass
+			, renderer::FrameBuffer const & frameBuffer
+			, renderer::ClearValueArray const & clearValues
+			, renderer::SubpassContents contents )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::doMemoryBarrier
+		*/
+		void doMemoryBarrier( renderer::PipelineStageFlags after
+			, renderer::PipelineStageFlags before
+			, renderer::BufferMemoryBarrier const & transitionBarrier )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::doMemoryBarrier
+		*/
+		void doMemoryBarrier( renderer::PipelineStageFlags after
+			, renderer::PipelineStageFlags before
+			, renderer::ImageMemoryBarrier const & transitionBarrier )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::doCopyToImage
+		*/
+		void doCopyToImage( renderer::BufferImageCopyArray const & copyInfo
+			, renderer::BufferBase const & src
+			, renderer::Texture const & dst )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::doCopyImage
+		*/
+		void doCopyImage( renderer::ImageCopy const & copyInfo
+			, renderer::TextureView const & src
+			, renderer::TextureView const & dst )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::doBlitImage
+		*/
+		void doBlitImage( renderer::Texture const & srcImage
+			, renderer::ImageLayout srcLayout
+			, renderer::Texture const & dstImage
+			, renderer::ImageLayout dstLayout
+			, std::vector< renderer::ImageBlit > const & regions
+			, renderer::Filter filter )const override;
+		/**
+		*\copydoc	renderer::CommandBuffer::doGenerateMipmaps
+		*/
+		void doGenerateMipmaps( renderer::Texture const & texture
+			, uint32_t baseMipLevel
+			, renderer::ResourceState const & finalState )const override;
 		Device const & m_device;
 		CommandPool const & m_pool;
 		VkCommandBuffer m_commandBuffer{};
@@ -122,6 +122,13 @@ namespace vk_renderer
 			, static_cast< uint32_t >( submitInfo.size() )
 			, submitInfo.data()
 			, fence ? static_cast< VkFence const & >( *static_cast< Fence const * >( fence ) ) : VK_NULL_HANDLE );
+
+		for ( auto & commandBuffer : commandBuffers )
+		{
+			renderer::countStatistics( commandBuffer.get().getRecordedStatistics() );
+		}
+
+		renderer::countStatistic( renderer::Statistic::eSubmittedCommandBuffer, commandBuffers.size() );
 		return checkError( res );
 	}
 
@@ -18,7 +18,13 @@ namespace vk_renderer
 		, m_renderer{ renderer }
 		, m_gpu{ static_cast< PhysicalDevice const & >( renderer.getPhysicalDevice( deviceIndex ) ) }
 	{
-		doCreatePresentSurface();
+		// Sans fenêtre, il n'y a pas de surface : le rendu est fait hors écran.
+		if ( !isHeadless() )
+		{
+			doCreatePresentSurface();
+		}
+
+
 		doRetrievePresentationInfos();
 	}
 
@@ -204,10 +210,13 @@ namespace vk_renderer
 
 		for ( auto & present : supportsPresent )
 		{
-			m_renderer.vkGetPhysicalDeviceSurfaceSupportKHR( m_gpu
-				, i
-				, m_presentSurface
-				, &present );
+			if ( m_presentSurface != VK_NULL_HANDLE )
+			{
+				m_renderer.vkGetPhysicalDeviceSurfaceSupportKHR( m_gpu
+					, i
+					, m_presentSurface
+					, &present );
+			}
 
 			if ( m_gpu.getQueueProperties()[i].queueCount > 0 )
 			{
@@ -245,6 +254,12 @@ namespace vk_renderer
 			++i;
 		}
 
+		if ( m_presentSurface == VK_NULL_HANDLE )
+		{
+			// Pas de présentation, la file graphique en tient lieu.
+			m_presentQueueFamilyIndex = m_graphicsQueueFamilyIndex;
+		}
+
 		if ( m_presentQueueFamilyIndex == std::numeric_limits< uint32_t >::max() )
 		{
 			// Pas de file supportant les deux, on a donc 2 files distinctes.
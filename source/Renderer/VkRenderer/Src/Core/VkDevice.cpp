@@ -12,6 +12,7 @@ See LICENSE file in root folder.
 #include "Core/VkConnection.hpp"
 #include "Core/VkPhysicalDevice.hpp"
 #include "Core/VkRenderer.hpp"
+#include "Core/VkOffscreenSwapChain.hpp"
 #include "Core/VkSwapChain.hpp"
 #include "Descriptor/VkDescriptorSetBinding.hpp"
 #include "Descriptor/VkDescriptorSetLayout.hpp"
@@ -76,6 +77,11 @@ namespace vk_renderer
 			} );
 		}
 
+		// Only the features needed by the optional shader stages are enabled.
+		VkPhysicalDeviceFeatures features{};
+		features.geometryShader = m_gpu.getFeatures().geometryShader;
+		features.tessellationShader = m_gpu.getFeatures().tessellationShader;
+
 		VkDeviceCreateInfo deviceInfo
 		{
 			VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
@@ -87,7 +93,7 @@ namespace vk_renderer
 			m_gpu.getLayerNames().empty() ? nullptr : m_gpu.getLayerNames().data(),          // ppEnabledLayerNames
 			static_cast< uint32_t >( m_gpu.getExtensionNames().size() ),                     // enabledExtensionCount
 			m_gpu.getExtensionNames().empty() ? nullptr : m_gpu.getExtensionNames().data(),  // ppEnabledExtensionNames
-			nullptr                                                                          // pEnabledFeatures
+			&features                                                                        // pEnabledFeatures
 		};
 		DEBUG_DUMP( deviceInfo );
 
@@ -260,7 +266,14 @@ namespace vk_renderer
 
 		try
 		{
-			result = std::make_unique< SwapChain >( *this, size );
+			if ( m_connection->isHeadless() )
+			{
+				result = std::make_unique< OffscreenSwapChain >( *this, size );
+			}
+			else
+			{
+				result = std::make_unique< SwapChain >( *this, size );
+			}
 		}
 		catch ( std::exception & exc )
 		{
@@ -0,0 +1,159 @@
+#include "Core/VkOffscreenSwapChain.hpp"
+
+#include "Command/VkCommandBuffer.hpp"
+#include "Command/VkCommandPool.hpp"
+#include "Core/VkDevice.hpp"
+#include "RenderPass/VkRenderPass.hpp"
+
+#include <RenderPass/FrameBufferAttachment.hpp>
+
+namespace vk_renderer
+{
+	namespace
+	{
+		// Autant d'images que de ressources de rendu, comme pour la swap chain classique.
+		static uint32_t constexpr ImageCount = 3u;
+	}
+
+	OffscreenSwapChain::OffscreenSwapChain( Device const & device
+		, renderer::UIVec2 const & size )
+		: renderer::SwapChain{ device, size }
+		, m_device{ device }
+	{
+		doCreateImages();
+		m_renderingResources.resize( ImageCount );
+
+		for ( auto & resource : m_renderingResources )
+		{
+			resource = std::make_unique< RenderingResources >( device );
+		}
+	}
+
+	void OffscreenSwapChain::reset( renderer::UIVec2 const & size )
+	{
+		m_device.waitIdle();
+		m_dimensions = size;
+		doCreateImages();
+		onReset();
+	}
+
+	renderer::FrameBufferPtrArray OffscreenSwapChain::createFrameBuffers( renderer::RenderPass const & renderPass )const
+	{
+		renderer::FrameBufferPtrArray result;
+		result.resize( m_images.size() );
+
+		for ( size_t i = 0u; i < result.size(); ++i )
+		{
+			auto attaches = doPrepareAttaches( uint32_t( i ), renderPass.getAttaches() );
+			result[i] = static_cast< RenderPass const & >( renderPass ).createFrameBuffer( m_dimensions
+				, std::move( attaches ) );
+		}
+
+		return result;
+	}
+
+	renderer::CommandBufferPtrArray OffscreenSwapChain::createCommandBuffers()const
+	{
+		renderer::CommandBufferPtrArray result;
+		result.resize( m_images.size() );
+
+		for ( auto & commandBuffer : result )
+		{
+			commandBuffer = std::make_unique< CommandBuffer >( m_device
+				, static_cast< CommandPool const & >( m_device.getGraphicsCommandPool() )
+				, true );
+		}
+
+		return result;
+	}
+
+	renderer::RenderingResources * OffscreenSwapChain::getResources()
+	{
+		auto & resources = *m_renderingResources[m_resourceIndex];
+		m_resourceIndex = ( m_resourceIndex + 1 ) % m_renderingResources.size();
+
+		if ( resources.waitRecord( renderer::FenceTimeout ) )
+		{
+			// Pas d'acquisition d'image, le sémaphore attendu par la soumission du rendu est signalé directement.
+			if ( m_device.getGraphicsQueue().submit( renderer::CommandBufferCRefArray{}
+				, renderer::SemaphoreCRefArray{}
+				, renderer::PipelineStageFlagsArray{}
+				, { resources.getImageAvailableSemaphore() }
+				, nullptr ) )
+			{
+				resources.setBackBuffer( m_currentBuffer );
+				m_currentBuffer = ( m_currentBuffer + 1u ) % uint32_t( m_images.size() );
+				return &resources;
+			}
+		}
+
+		std::cerr << "Can't render: " << getLastError() << std::endl;
+		return nullptr;
+	}
+
+	void OffscreenSwapChain::present( renderer::RenderingResources & resources )
+	{
+		// Le sémaphore de fin de rendu doit être consommé, pour pouvoir être signalé à nouveau.
+		m_device.getGraphicsQueue().submit( renderer::CommandBufferCRefArray{}
+			, { resources.getRenderingFinishedSemaphore() }
+			, { renderer::PipelineStageFlag::eBottomOfPipe }
+			, renderer::SemaphoreCRefArray{}
+			, nullptr );
+		m_presented = resources.getBackBuffer();
+		resources.setBackBuffer( ~0u );
+		m_device.endFrameStatistics();
+	}
+
+	void OffscreenSwapChain::doCreateImages()
+	{
+		m_depthView.reset();
+		m_depth.reset();
+		m_views.clear();
+		m_images.clear();
+		m_currentBuffer = 0u;
+		m_presented = 0u;
+
+		for ( uint32_t i = 0u; i < ImageCount; ++i )
+		{
+			auto image = m_device.createTexture( renderer::ImageLayout::eUndefined );
+			image->setImage( m_format
+				, m_dimensions
+				, renderer::ImageUsageFlag::eColourAttachment
+					| renderer::ImageUsageFlag::eTransferSrc
+					| renderer::ImageUsageFlag::eSampled );
+			m_views.push_back( image->createView( renderer::TextureType::e2D
+				, m_format ) );
+			m_images.push_back( std::move( image ) );
+		}
+	}
+
+	renderer::FrameBufferAttachmentArray OffscreenSwapChain::doPrepareAttaches( uint32_t backBuffer
+		, renderer::RenderPassAttachmentArray const & attaches )const
+	{
+		renderer::FrameBufferAttachmentArray result;
+
+		for ( auto & attach : attaches )
+		{
+			if ( !renderer::isDepthOrStencilFormat( attach.format ) )
+			{
+				result.emplace_back( attach, *m_views[backBuffer] );
+			}
+			else
+			{
+				if ( !m_depth )
+				{
+					m_depth = m_device.createTexture( renderer::ImageLayout::eUndefined );
+					m_depth->setImage( attach.format
+						, getDimensions()
+						, renderer::ImageUsageFlag::eDepthStencilAttachment );
+					m_depthView = m_depth->createView( renderer::TextureType::e2D
+						, attach.format );
+				}
+
+				result.emplace_back( attach, *m_depthView );
+			}
+		}
+
+		return result;
+	}
+}
@@ -0,0 +1,123 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#pragma once
+
+#include "VkRendererPrerequisites.hpp"
+#include "Core/VkRenderingResources.hpp"
+
+#include <Core/SwapChain.hpp>
+#include <Image/Texture.hpp>
+#include <Image/TextureView.hpp>
+
+namespace vk_renderer
+{
+	/**
+	*\~french
+	*\brief
+	*	Swap chain des connexions sans fenêtre : le rendu est fait dans des textures.
+	*\remarks
+	*	Il n'y a pas de présentation, le rythme des frames est donné par les fences des ressources de rendu.
+	*	Les sémaphores des ressources de rendu sont signalés et consommés par des soumissions vides,
+	*	les boucles de rendu fonctionnent donc comme avec une swap chain classique.
+	*\~english
+	*\brief
+	*	Swap chain of the connections without window: the rendering is done into textures.
+	*\remarks
+	*	There is no presentation, the frames pacing is given by the rendering resources fences.
+	*	The rendering resources semaphores are signaled and consumed by empty submits,
+	*	the render loops hence work as with a regular swap chain.
+	*/
+	class OffscreenSwapChain
+		: public renderer::SwapChain
+	{
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	La connexion logique au GPU.
+		*\param[in] size
+		*	Les dimensions des images.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical connection to the GPU.
+		*\param[in] size
+		*	The images dimensions.
+		*/
+		OffscreenSwapChain( Device const & device
+			, renderer::UIVec2 const & size );
+		/**
+		*\copydoc	renderer::SwapChain::reset
+		*/
+		void reset( renderer::UIVec2 const & size )override;
+		/**
+		*\copydoc	renderer::SwapChain::createFrameBuffers
+		*/
+		renderer::FrameBufferPtrArray createFrameBuffers( renderer::RenderPass const & renderPass )const override;
+		/**
+		*\copydoc	renderer::SwapChain::createCommandBuffers
+		*/
+		renderer::CommandBufferPtrArray createCommandBuffers()const override;
+		/**
+		*\copydoc	renderer::SwapChain::getResources
+		*/
+		renderer::RenderingResources * getResources()override;
+		/**
+		*\copydoc	renderer::SwapChain::present
+		*/
+		void present( renderer::RenderingResources & resources )override;
+		/**
+		*\~french
+		*\return
+		*	La dernière image présentée, dans la disposition finale de la passe de rendu.
+		*\~english
+		*\return
+		*	The last presented image, in the render pass final layout.
+		*/
+		inline renderer::Texture const * getOffscreenImage()const override
+		{
+			return m_images[m_presented].get();
+		}
+
+		inline void setClearColour( renderer::RgbaColour const & value )override
+		{
+			m_clearColour = value;
+		}
+
+		inline renderer::RgbaColour getClearColour()const override
+		{
+			return m_clearColour;
+		}
+
+		inline renderer::UIVec2 getDimensions()const override
+		{
+			return m_dimensions;
+		}
+
+		inline renderer::PixelFormat getFormat()const override
+		{
+			return m_format;
+		}
+
+	private:
+		void doCreateImages();
+		renderer::FrameBufferAttachmentArray doPrepareAttaches( uint32_t backBuffer
+			, renderer::RenderPassAttachmentArray const & attaches )const;
+
+	private:
+		Device const & m_device;
+		renderer::PixelFormat m_format{ renderer::PixelFormat::eR8G8B8A8 };
+		renderer::RgbaColour m_clearColour{};
+		std::vector< renderer::TexturePtr > m_images;
+		std::vector< renderer::TextureViewPtr > m_views;
+		uint32_t m_currentBuffer{ 0u };
+		uint32_t m_presented{ 0u };
+		mutable renderer::TexturePtr m_depth;
+		mutable renderer::TextureViewPtr m_depthView;
+	};
+}
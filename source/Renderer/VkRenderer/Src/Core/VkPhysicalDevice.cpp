@@ -7,6 +7,9 @@ See LICENSE file in root folder.
 #include "Core/VkRenderer.hpp"
 #include "Core/VkDevice.hpp"
 
+#include <algorithm>
+#include <cstring>
+
 namespace vk_renderer
 {
 	namespace
@@ -64,6 +67,19 @@ namespace vk_renderer
 		m_deviceExtensionNames.push_back( VK_KHR_SWAPCHAIN_EXTENSION_NAME );
 		checkExtensionsAvailability( extensions, m_deviceExtensionNames );
 
+		// Les extensions optionnelles sont activées si elles sont présentes.
+		m_drawIndirectCount = extensions.end() != std::find_if( extensions.begin()
+			, extensions.end()
+			, []( VkExtensionProperties const & extension )
+			{
+				return strcmp( extension.extensionName, VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME ) == 0;
+			} );
+
+		if ( m_drawIndirectCount )
+		{
+			m_deviceExtensionNames.push_back( VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME );
+		}
+
 		// Puis les capacités du GPU.
 		VkPhysicalDeviceMemoryProperties memoryProperties;
 		VkPhysicalDeviceProperties properties;
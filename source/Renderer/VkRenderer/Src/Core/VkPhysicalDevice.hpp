@@ -83,6 +83,13 @@ namespace vk_renderer
 			return VKRENDERER_GLSL_TO_SPV != 0;
 		}
 		/**
+		*\copydoc	renderer::PhysicalDevice::isDrawIndirectCountSupported
+		*/
+		inline bool isDrawIndirectCountSupported()const override
+		{
+			return m_drawIndirectCount;
+		}
+		/**
 		*\~french
 		*\brief
 		*	Conversion implicite vers VkPhysicalDevice.
@@ -100,5 +107,6 @@ namespace vk_renderer
 		VkPhysicalDevice m_gpu{ VK_NULL_HANDLE };
 		std::vector< char const * > m_deviceExtensionNames;
 		std::vector< char const * > m_deviceLayerNames;
+		bool m_drawIndirectCount{ false };
 	};
 }
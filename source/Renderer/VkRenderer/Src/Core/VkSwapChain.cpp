@@ -153,6 +153,7 @@ namespace vk_renderer
 		checkError( res );
 		doCheckNeedReset( res, false, "Image presentation" );
 		resources.setBackBuffer( ~0u );
+		m_device.endFrameStatistics();
 	}
 
 	uint32_t SwapChain::doGetImageCount()
@@ -102,7 +102,7 @@ namespace vk_renderer
 			layoutBinding.getBindingPoint(),                // dstBinding
 			index,                                          // dstArrayElement
 			1u,                                             // descriptorCount
-			VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,               // descriptorType
+			convert( layoutBinding.getDescriptorType() ),   // descriptorType
 			&m_info,                                        // pImageInfo
 			nullptr,                                        // pBufferInfo
 			nullptr                                         // pTexelBufferView
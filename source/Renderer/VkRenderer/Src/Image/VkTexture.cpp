@@ -216,77 +216,6 @@ namespace vk_renderer
 			, mapping );
 	}
 
-	void Texture::generateMipmaps()const
-	{
-		auto const width = int32_t( getDimensions()[0] );
-		auto const height = int32_t( getDimensions()[1] );
-		auto commandBuffer = m_device.getGraphicsCommandPool().createCommandBuffer();
-		auto & vkCommandBuffer = static_cast< CommandBuffer const & >( *commandBuffer );
-
-		if ( commandBuffer->begin( renderer::CommandBufferUsageFlag::eOneTimeSubmit ) )
-		{
-			TextureView srcView{ m_device
-				, *this
-				, getType()
-				, getFormat()
-				, 0
-				, 1u
-				, 0u
-				, 1u
-				, renderer::ComponentMapping{} };
-			vkCommandBuffer.memoryBarrier( convert( renderer::PipelineStageFlag::eFragmentShader )
-				, convert( renderer::PipelineStageFlag::eTopOfPipe )
-				, srcView.makeTransferSource( renderer::ImageLayout::eUndefined, 0u ) );
-
-			for ( uint32_t i = 1; i < m_mipmapLevels; ++i )
-			{
-				TextureView dstView{ m_device
-					, *this
-					, getType()
-					, getFormat()
-					, i
-					, 1u
-					, 0u
-					, 1u
-					, renderer::ComponentMapping{} };
-				vkCommandBuffer.memoryBarrier( convert( renderer::PipelineStageFlag::eFragmentShader )
-					, convert( renderer::PipelineStageFlag::eTopOfPipe )
-					, dstView.makeTransferDestination( renderer::ImageLayout::eUndefined, 0u ) );
-
-				int32_t const mipWidth = width >> i;
-				int32_t const mipHeight = height >> i;
-
-				VkImageBlit imageBlit = {};
-				imageBlit.srcSubresource.aspectMask = getImageAspectFlags( getFormat() );
-				imageBlit.srcSubresource.baseArrayLayer = 0;
-				imageBlit.srcSubresource.layerCount = 1;
-				imageBlit.srcSubresource.mipLevel = 0;
-				imageBlit.srcOffsets[0] = { 0, 0, 0 };
-				imageBlit.srcOffsets[1] = { width, height, 1 };
-
-				imageBlit.dstSubresource.aspectMask = getImageAspectFlags( getFormat() );
-				imageBlit.dstSubresource.baseArrayLayer = 0;
-				imageBlit.dstSubresource.layerCount = 1;
-				imageBlit.dstSubresource.mipLevel = i;
-				imageBlit.dstOffsets[0] = { 0, 0, 0 };
-				imageBlit.dstOffsets[1] = { mipWidth, mipHeight, 1 };
-
-				m_device.vkCmdBlitImage( vkCommandBuffer
-					, m_image
-					, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL
-					, m_image
-					, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL
-					, 1
-					, &imageBlit
-					, VK_FILTER_LINEAR );
-			}
-
-			commandBuffer->end();
-			m_device.getGraphicsQueue().submit( *commandBuffer, nullptr );
-			m_device.waitIdle();
-		}
-	}
-
 	void Texture::doSetImage1D( renderer::ImageUsageFlags usageFlags
 		, renderer::ImageTiling tiling
 		, renderer::MemoryPropertyFlags memoryFlags )
@@ -140,10 +140,6 @@ namespace vk_renderer
 			, uint32_t layerCount
 			, renderer::ComponentMapping const & mapping )const override;
 		/**
-		*\copydoc	renderer::Texture::generateMipmaps
-		*/
-		void generateMipmaps()const override;
-		/**
 		*\~french
 		*\brief
 		*	Opérateur de conversion implicite vers VkImage.
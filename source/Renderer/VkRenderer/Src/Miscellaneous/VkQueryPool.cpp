@@ -34,13 +34,13 @@ namespace vk_renderer
 			, nullptr );
 	}
 
-	void QueryPool::getResults( uint32_t firstQuery
+	bool QueryPool::getResults( uint32_t firstQuery
 		, uint32_t queryCount
 		, uint32_t stride
 		, renderer::QueryResultFlags flags
 		, renderer::UInt32Array & data )const
 	{
-		m_device.vkGetQueryPoolResults( m_device
+		auto res = m_device.vkGetQueryPoolResults( m_device
 			, m_pool
 			, firstQuery
 			, queryCount
@@ -48,15 +48,22 @@ namespace vk_renderer
 			, data.data()
 			, stride
 			, convert( flags ) );
+
+		if ( !checkError( res ) )
+		{
+			throw std::runtime_error{ "Query pool results retrieval failed: " + getLastError() };
+		}
+
+		return res == VK_SUCCESS;
 	}
 
-	void QueryPool::getResults( uint32_t firstQuery
+	bool QueryPool::getResults( uint32_t firstQuery
 		, uint32_t queryCount
 		, uint32_t stride
 		, renderer::QueryResultFlags flags
 		, renderer::UInt64Array & data )const
 	{
-		m_device.vkGetQueryPoolResults( m_device
+		auto res = m_device.vkGetQueryPoolResults( m_device
 			, m_pool
 			, firstQuery
 			, queryCount
@@ -64,5 +71,12 @@ namespace vk_renderer
 			, data.data()
 			, stride
 			, convert( flags ) | VK_QUERY_RESULT_64_BIT );
+
+		if ( !checkError( res ) )
+		{
+			throw std::runtime_error{ "Query pool results retrieval failed: " + getLastError() };
+		}
+
+		return res == VK_SUCCESS;
 	}
 }
@@ -62,7 +62,7 @@ namespace vk_renderer
 		/**
 		*\copydoc	renderer::QueryPool:getResults
 		*/
-		void getResults( uint32_t firstQuery
+		bool getResults( uint32_t firstQuery
 			, uint32_t queryCount
 			, uint32_t stride
 			, renderer::QueryResultFlags flags
@@ -70,7 +70,7 @@ namespace vk_renderer
 		/**
 		*\copydoc	renderer::QueryPool:getResults
 		*/
-		void getResults( uint32_t firstQuery
+		bool getResults( uint32_t firstQuery
 			, uint32_t queryCount
 			, uint32_t stride
 			, renderer::QueryResultFlags flags
@@ -125,6 +125,7 @@ VK_LIB_DEVICE_FUNCTION( vkCmdEndQuery )
 VK_LIB_DEVICE_FUNCTION( vkCmdEndRenderPass )
 VK_LIB_DEVICE_FUNCTION( vkCmdExecuteCommands )
 VK_LIB_DEVICE_FUNCTION( vkCmdCopyImageToBuffer )
+VK_LIB_DEVICE_FUNCTION( vkCmdCopyQueryPoolResults )
 VK_LIB_DEVICE_FUNCTION( vkCmdNextSubpass )
 VK_LIB_DEVICE_FUNCTION( vkCmdPipelineBarrier )
 VK_LIB_DEVICE_FUNCTION( vkCmdPushConstants )
@@ -193,4 +194,8 @@ VK_LIB_DEVICE_FUNCTION( vkUnmapMemory )
 VK_LIB_DEVICE_FUNCTION( vkUpdateDescriptorSets )
 VK_LIB_DEVICE_FUNCTION( vkWaitForFences )
 
+// VK_KHR_draw_indirect_count, null when the extension is not available.
+VK_LIB_DEVICE_FUNCTION( vkCmdDrawIndexedIndirectCountKHR )
+VK_LIB_DEVICE_FUNCTION( vkCmdDrawIndirectCountKHR )
+
 #undef VK_LIB_DEVICE_FUNCTION
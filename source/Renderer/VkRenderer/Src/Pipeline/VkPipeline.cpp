@@ -143,7 +143,7 @@ namespace vk_renderer
 			dynamicStates.empty() ? nullptr : &dynamicState,              // pDynamicState
 			m_layout,                                                     // layout
 			m_renderPass,                                                 // renderPass
-			0,                                                            // subpass
+			m_createInfo.subpass,                                         // subpass
 			VK_NULL_HANDLE,                                               // basePipelineHandle
 			-1                                                            // basePipelineIndex
 		};
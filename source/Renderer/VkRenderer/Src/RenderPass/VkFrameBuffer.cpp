@@ -17,6 +17,8 @@ See LICENSE file in root folder.
 
 #include <RenderPass/FrameBufferAttachment.hpp>
 
+#include <algorithm>
+
 namespace vk_renderer
 {
 	namespace
@@ -33,6 +35,20 @@ namespace vk_renderer
 
 			return result;
 		}
+
+		uint32_t getLayers( renderer::FrameBufferAttachmentArray const & attachs )
+		{
+			uint32_t result = ~( 0u );
+
+			for ( auto & attach : attachs )
+			{
+				result = std::min( result, attach.getView().getSubResourceRange().getLayerCount() );
+			}
+
+			return attachs.empty()
+				? 1u
+				: result;
+		}
 	}
 
 	FrameBuffer::FrameBuffer( Device const & device
@@ -56,7 +72,7 @@ namespace vk_renderer
 			vkattachments.data(),                               // pAttachments
 			uint32_t( dimensions[0] ),                          // width
 			uint32_t( dimensions[1] ),                          // height
-			1u                                                  // layers
+			getLayers( m_attachments )                          // layers
 		};
 		DEBUG_DUMP( createInfo );
 		auto res = m_device.vkCreateFramebuffer( device
@@ -36,6 +36,12 @@ namespace vk_renderer
 		case renderer::PixelFormat::eRGBA32F:
 			return VK_FORMAT_R32G32B32A32_SFLOAT;
 
+		case renderer::PixelFormat::eR8G8B8A8_SRGB:
+			return VK_FORMAT_R8G8B8A8_SRGB;
+
+		case renderer::PixelFormat::eR10G10B10A2:
+			return VK_FORMAT_A2B10G10R10_UNORM_PACK32;
+
 		case renderer::PixelFormat::eD16:
 			return VK_FORMAT_D16_UNORM;
 
@@ -229,6 +235,12 @@ namespace vk_renderer
 		case VK_FORMAT_R32G32B32A32_SFLOAT:
 			return renderer::PixelFormat::eRGBA32F;
 
+		case VK_FORMAT_R8G8B8A8_SRGB:
+			return renderer::PixelFormat::eR8G8B8A8_SRGB;
+
+		case VK_FORMAT_A2B10G10R10_UNORM_PACK32:
+			return renderer::PixelFormat::eR10G10B10A2;
+
 		case VK_FORMAT_D16_UNORM:
 			return renderer::PixelFormat::eD16;
 
@@ -26,6 +26,13 @@
 
 #include "vulkan/vulkan.h"
 
+#ifndef VK_KHR_draw_indirect_count
+#	define VK_KHR_draw_indirect_count 1
+#	define VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME "VK_KHR_draw_indirect_count"
+typedef void ( VKAPI_PTR * PFN_vkCmdDrawIndirectCountKHR )( VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride );
+typedef void ( VKAPI_PTR * PFN_vkCmdDrawIndexedIndirectCountKHR )( VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride );
+#endif
+
 #ifdef min
 #	undef min
 #	undef max
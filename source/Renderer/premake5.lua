@@ -1,3 +1,5 @@
 include( "Renderer/premake5.lua" )
 include( "VkRenderer/premake5.lua" )
-include( "GlRenderer/premake5.lua" )
\ No newline at end of file
+include( "GlRenderer/premake5.lua" )
+include( "NullRenderer/premake5.lua" )
+include( "CaptureRenderer/premake5.lua" )
\ No newline at end of file
@@ -1,9 +1,13 @@
 #include "Application.hpp"
 
+#include "AssimpLoader.hpp"
+#include "Bvh.hpp"
 #include "FileUtils.hpp"
+#include "FrustumCulling.hpp"
 #include "MainFrame.hpp"
 
 #include <wx/cmdline.h>
+#include <wx/filename.h>
 
 #include <fstream>
 
@@ -308,7 +312,11 @@ namespace common
 		parser.AddSwitch( wxT( "h" ), wxT( "help" ), _( "Displays this help" ) );
 		parser.AddSwitch( wxT( "gl" ), wxEmptyString, _( "Defines the renderer to OpenGl" ) );
 		parser.AddSwitch( wxT( "vk" ), wxEmptyString, _( "Defines the renderer to Vulkan" ) );
+		parser.AddSwitch( wxT( "null" ), wxEmptyString, _( "Defines the renderer to the null one, which draws nothing" ) );
+		parser.AddSwitch( wxT( "cullbench" ), wxEmptyString, _( "Runs the frustum culling microbenchmark, and exits" ) );
+		parser.AddOption( wxT( "bvhbench" ), wxEmptyString, _( "Runs the BVH benchmark on the given model file, and exits" ), wxCMD_LINE_VAL_STRING );
 		bool result = parser.Parse( false ) == 0;
+		wxString fileName;
 
 		// S'il y avait des erreurs ou "-h" ou "--help", on affiche l'aide et on sort
 		if ( !result || parser.Found( wxT( 'h' ) ) )
@@ -316,6 +324,21 @@ namespace common
 			parser.Usage();
 			result = false;
 		}
+		else if ( parser.Found( wxT( "cullbench" ) ) )
+		{
+			benchmarkCulling( std::cout );
+			result = false;
+		}
+		else if ( parser.Found( wxT( "bvhbench" ), &fileName ) )
+		{
+			wxFileName file{ fileName };
+			ImagePtrArray images;
+			benchmarkBvh( getBoundingBoxes( loadObject( file.GetPath().ToStdString()
+					, file.GetFullName().ToStdString()
+					, images ) )
+				, std::cout );
+			result = false;
+		}
 
 		if ( result )
 		{
@@ -329,6 +352,10 @@ namespace common
 			{
 				m_rendererName = wxT( "gl" );
 			}
+			else if ( parser.Found( wxT( "null" ) ) )
+			{
+				m_rendererName = wxT( "null" );
+			}
 		}
 
 		return result;
@@ -1,4 +1,6 @@
 #include "AssimpLoader.hpp"
+#include "ImageLoader.hpp"
+#include "MeshCache.hpp"
 
 #include <stdlib.h>
 #include <fstream>
@@ -15,67 +17,50 @@ namespace common
 {
 	namespace
 	{
-		bool doLoadTexture( std::string const & folder
-			, aiString const & name
-			, ImagePtr & data
-			, std::map< std::string, ImagePtr > & images )
+		struct MaterialTextures
+		{
+			std::shared_future< ImagePtr > diffuse;
+			std::shared_future< ImagePtr > specular;
+			std::shared_future< ImagePtr > emissive;
+			std::shared_future< ImagePtr > shininess;
+			std::shared_future< ImagePtr > opacity;
+			std::shared_future< ImagePtr > normal;
+		};
+
+		struct MeshData
 		{
-			bool result = false;
-			auto it = images.find( name.C_Str() );
+			bool valid{ false };
+			Submesh submesh;
+			renderer::Vec3 min{ std::numeric_limits< float >::max() };
+			renderer::Vec3 max{ std::numeric_limits< float >::lowest() };
+		};
 
-			if ( it != images.end() )
+		std::shared_future< ImagePtr > doLoadTexture( std::string const & folder
+			, aiString const & name
+			, ImageLoader & loader )
+		{
+			if ( name.length == 0 )
 			{
-				data = it->second;
-				return true;
+				return std::shared_future< ImagePtr >{};
 			}
 
-			if ( name.length > 0 )
-			{
-				folder;
-				std::string path = name.C_Str();
-				auto index = 0u;
-				utils::replace( path, R"(\)", "/" );
-
-				if ( path.find( '/' ) != std::string::npos )
-				{
-					index = path.find_last_of( '/' ) + 1;
-					path = path.substr( index );
-				}
-
-				std::clog << "  Loading texture " << path << std::endl;
-				path = folder / path;
-
-				try
-				{
-					data = std::make_shared< Image >( common::loadImage( path ) );
-					result = true;
-				}
-				catch ( std::runtime_error & )
-				{
-					utils::replace( path, ".tga", ".jpg" );
-					try
-					{
-						data = std::make_shared< Image >( common::loadImage( path ) );
-						result = true;
-					}
-					catch ( std::runtime_error & )
-					{
-						utils::replace( path, ".tga", ".png" );
-						try
-						{
-							data = std::make_shared< Image >( common::loadImage( path ) );
-							result = true;
-						}
-						catch ( std::runtime_error & )
-						{
-						}
-					}
-				}
+			std::string path = name.C_Str();
+			path = utils::replace( path, R"(\)", "/" );
 
-				images.insert( { std::string{ name.C_Str() }, data } );
+			if ( path.find( '/' ) != std::string::npos )
+			{
+				path = path.substr( path.find_last_of( '/' ) + 1 );
 			}
 
-			return result;
+			std::clog << "  Loading texture " << path << std::endl;
+			return loader.load( folder / path );
+		}
+
+		ImagePtr doGetTexture( std::shared_future< ImagePtr > const & texture )
+		{
+			return texture.valid()
+				? texture.get()
+				: nullptr;
 		}
 
 		template< typename aiMeshType >
@@ -194,13 +179,10 @@ namespace common
 			}
 		}
 
-		void doProcessPassTextures( std::string const & folder
-			, Material & material
+		MaterialTextures doLoadPassTextures( std::string const & folder
 			, aiMaterial const & aiMaterial
-			, std::map< std::string, ImagePtr > & images )
+			, ImageLoader & loader )
 		{
-			aiString ambTexName;
-			aiMaterial.Get( AI_MATKEY_TEXTURE( aiTextureType_AMBIENT, 0 ), ambTexName );
 			aiString difTexName;
 			aiMaterial.Get( AI_MATKEY_TEXTURE( aiTextureType_DIFFUSE, 0 ), difTexName );
 			aiString spcTexName;
@@ -209,17 +191,29 @@ namespace common
 			aiMaterial.Get( AI_MATKEY_TEXTURE( aiTextureType_EMISSIVE, 0 ), emiTexName );
 			aiString nmlTexName;
 			aiMaterial.Get( AI_MATKEY_TEXTURE( aiTextureType_NORMALS, 0 ), nmlTexName );
-			aiString hgtTexName;
-			aiMaterial.Get( AI_MATKEY_TEXTURE( aiTextureType_HEIGHT, 0 ), hgtTexName );
 			aiString opaTexName;
 			aiMaterial.Get( AI_MATKEY_TEXTURE( aiTextureType_OPACITY, 0 ), opaTexName );
 			aiString shnTexName;
 			aiMaterial.Get( AI_MATKEY_TEXTURE( aiTextureType_SHININESS, 0 ), shnTexName );
+			MaterialTextures result;
+			result.diffuse = doLoadTexture( folder, difTexName, loader );
+			result.specular = doLoadTexture( folder, spcTexName, loader );
+			result.emissive = doLoadTexture( folder, emiTexName, loader );
+			result.shininess = doLoadTexture( folder, shnTexName, loader );
+			result.opacity = doLoadTexture( folder, opaTexName, loader );
+			result.normal = doLoadTexture( folder, nmlTexName, loader );
+			return result;
+		}
+
+		void doProcessPassTextures( Material & material
+			, MaterialTextures const & textures )
+		{
 			ImagePtr image;
 			auto index = 0u;
-			auto it = images.find( difTexName.C_Str() );
 
-			if ( doLoadTexture( folder, difTexName, image, images ) )
+			image = doGetTexture( textures.diffuse );
+
+			if ( image )
 			{
 				material.textures.push_back( image );
 				material.data.textureOperators[index].diffuse = 1;
@@ -232,7 +226,9 @@ namespace common
 				++index;
 			}
 
-			if ( doLoadTexture( folder, spcTexName, image, images ) )
+			image = doGetTexture( textures.specular );
+
+			if ( image )
 			{
 				material.textures.push_back( image );
 				material.data.textureOperators[index].specular = 1;
@@ -245,21 +241,27 @@ namespace common
 				++index;
 			}
 
-			if ( doLoadTexture( folder, emiTexName, image, images ) )
+			image = doGetTexture( textures.emissive );
+
+			if ( image )
 			{
 				material.textures.push_back( image );
 				material.data.textureOperators[index].emissive = 1;
 				++index;
 			}
 
-			if ( doLoadTexture( folder, shnTexName, image, images ) )
+			image = doGetTexture( textures.shininess );
+
+			if ( image )
 			{
 				material.textures.push_back( image );
 				material.data.textureOperators[index].shininess = 1;
 				++index;
 			}
 
-			if ( doLoadTexture( folder, opaTexName, image, images ) )
+			image = doGetTexture( textures.opacity );
+
+			if ( image )
 			{
 				material.textures.push_back( image );
 				material.hasOpacity = true;
@@ -276,7 +278,9 @@ namespace common
 				++index;
 			}
 
-			if ( doLoadTexture( folder, nmlTexName, image, images ) )
+			image = doGetTexture( textures.normal );
+
+			if ( image )
 			{
 				material.textures.push_back( image );
 				material.data.textureOperators[index].normal = 1;
@@ -298,6 +302,15 @@ namespace common
 		, common::ImagePtrArray & images
 		, float rescale )
 	{
+		auto sourceFile = folder / fileName;
+		auto cacheFile = sourceFile + ".rlmesh";
+		Object result;
+
+		if ( loadMeshCache( cacheFile, sourceFile, rescale, result, images ) )
+		{
+			return result;
+		}
+
 		Assimp::Importer importer;
 		uint32_t flags = aiProcess_Triangulate
 			| aiProcess_JoinIdenticalVertices
@@ -308,8 +321,7 @@ namespace common
 			| aiProcess_CalcTangentSpace
 			| aiProcess_FlipWindingOrder
 			| aiProcess_FlipUVs;
-		aiScene const * aiScene = importer.ReadFile( folder / fileName, flags );
-		Object result;
+		aiScene const * aiScene = importer.ReadFile( sourceFile, flags );
 
 		if ( aiScene && aiScene->HasMeshes() )
 		{
@@ -324,47 +336,85 @@ namespace common
 				}
 			};
 
-			std::map< std::string, ImagePtr > uniqueImages;
+			ThreadPool pool;
+			ImageLoader loader{ pool };
+
+			// The textures are requested first, so that their decoding overlaps the meshes conversion.
+			std::vector< MaterialTextures > textures;
+			textures.reserve( aiScene->mNumMaterials );
+
+			for ( size_t materialIndex = 0; materialIndex < aiScene->mNumMaterials; ++materialIndex )
+			{
+				textures.push_back( doLoadPassTextures( folder
+					, *aiScene->mMaterials[materialIndex]
+					, loader ) );
+			}
+
+			std::vector< std::future< MeshData > > meshes;
+			meshes.reserve( aiScene->mNumMeshes );
+
+			for ( size_t meshIndex = 0; meshIndex < aiScene->mNumMeshes; ++meshIndex )
+			{
+				meshes.push_back( pool.submit( [&aiMesh = *aiScene->mMeshes[meshIndex]]()
+					{
+						MeshData result;
+
+						if ( aiMesh.HasFaces() && aiMesh.HasPositions() )
+						{
+							result.valid = true;
+							result.submesh.vbo.data = doCreateVertexBuffer( aiMesh, result.min, result.max );
+							result.submesh.ibo.data.reserve( aiMesh.mNumFaces );
+
+							for ( size_t faceIndex = 0u; faceIndex < aiMesh.mNumFaces; ++faceIndex )
+							{
+								auto & face = aiMesh.mFaces[faceIndex];
+
+								if ( face.mNumIndices == 3 )
+								{
+									result.submesh.ibo.data.push_back( Face
+									{
+										face.mIndices[0],
+										face.mIndices[1],
+										face.mIndices[2]
+									} );
+								}
+							}
+						}
+
+						return result;
+					} ) );
+			}
+
+			// The materials need the decoded images, to know if they hold an alpha channel.
+			std::vector< Material > materials;
+			materials.reserve( aiScene->mNumMaterials );
+
+			for ( size_t materialIndex = 0; materialIndex < aiScene->mNumMaterials; ++materialIndex )
+			{
+				Material material;
+				doProcessPassBaseComponents( material, *aiScene->mMaterials[materialIndex] );
+				doProcessPassTextures( material, textures[materialIndex] );
+				materials.push_back( material );
+			}
 
 			for ( size_t meshIndex = 0; meshIndex < aiScene->mNumMeshes; ++meshIndex )
 			{
 				auto & aiMesh = *aiScene->mMeshes[meshIndex];
-				Submesh submesh;
+				auto mesh = meshes[meshIndex].get();
 
-				if ( aiMesh.HasFaces() && aiMesh.HasPositions() )
+				if ( mesh.valid )
 				{
+					auto & submesh = mesh.submesh;
+
 					if ( aiMesh.mMaterialIndex < aiScene->mNumMaterials )
 					{
-						auto & aiMaterial = *aiScene->mMaterials[aiMesh.mMaterialIndex];
-						aiString mtlname;
-						aiMaterial.Get( AI_MATKEY_NAME, mtlname );
-						Material material;
-						doProcessPassBaseComponents( material, aiMaterial );
-						doProcessPassTextures( folder, material, aiMaterial, uniqueImages );
-						submesh.materials.push_back( material );
+						submesh.materials.push_back( materials[aiMesh.mMaterialIndex] );
 					}
 					else
 					{
 						submesh.materials.push_back( defaultMaterial );
 					}
 
-					submesh.vbo.data = doCreateVertexBuffer( aiMesh, min, max );
-
-					for ( size_t faceIndex = 0u; faceIndex < aiMesh.mNumFaces; ++faceIndex )
-					{
-						auto & face = aiMesh.mFaces[faceIndex];
-
-						if ( face.mNumIndices == 3 )
-						{
-							submesh.ibo.data.push_back( Face
-							{
-								face.mIndices[0],
-								face.mIndices[1],
-								face.mIndices[2]
-							} );
-						}
-					}
-
 					if ( submesh.materials[0].hasOpacity )
 					{
 						Material material = submesh.materials[0];
@@ -384,6 +434,12 @@ namespace common
 						submesh.materials.push_back( material );
 					}
 
+					min[0] = std::min( mesh.min[0], min[0] );
+					min[1] = std::min( mesh.min[1], min[1] );
+					min[2] = std::min( mesh.min[2], min[2] );
+					max[0] = std::max( mesh.max[0], max[0] );
+					max[1] = std::max( mesh.max[1], max[1] );
+					max[2] = std::max( mesh.max[2], max[2] );
 					result.emplace_back( std::move( submesh ) );
 				}
 			}
@@ -396,19 +452,28 @@ namespace common
 			renderer::Vec3 offset{ ( max - min ) / -2.0f };
 			offset[0] = 0.0;
 			offset[2] = 0.0;
+			std::vector< std::future< void > > rescales;
+			rescales.reserve( result.size() );
 
 			for ( auto & submesh : result )
 			{
-				for ( auto & vertex : submesh.vbo.data )
-				{
-					vertex.position = offset + ( vertex.position * scale );
-				}
+				rescales.push_back( pool.submit( [&submesh, offset, scale]()
+					{
+						for ( auto & vertex : submesh.vbo.data )
+						{
+							vertex.position = offset + ( vertex.position * scale );
+						}
+					} ) );
 			}
 
-			for ( auto & image : uniqueImages )
+			for ( auto & rescaled : rescales )
 			{
-				images.emplace_back( std::move( image.second ) );
+				rescaled.get();
 			}
+
+			auto objectImages = loader.waitAll();
+			saveMeshCache( cacheFile, sourceFile, rescale, result, objectImages );
+			images.insert( images.end(), objectImages.begin(), objectImages.end() );
 		}
 
 		return result;
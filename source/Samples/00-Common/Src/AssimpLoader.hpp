@@ -15,6 +15,10 @@ namespace common
 	/**
 	*\brief
 	*	Charge un objet.
+	*\remarks
+	*	L'objet est lu depuis son cache de maillage (<fichier>.rlmesh) s'il est à jour,
+	*	sinon il est chargé via Assimp, puis le cache est écrit.
+	*	Les textures (décodage, conversion RGBA et niveaux de mip) et les maillages sont traités sur un pool de threads.
 	*\param[in] filePath
 	*	Le chemin d'accès au fichier.
 	*\return
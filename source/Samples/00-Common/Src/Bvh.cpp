@@ -0,0 +1,581 @@
+#include "Bvh.hpp"
+
+#include <Utils/Transform.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+
+namespace common
+{
+	namespace
+	{
+		static uint32_t constexpr BinCount = 12u;
+		static uint32_t constexpr MaxLeafSize = 4u;
+		// Relative cost of a node traversal, compared to a primitive test.
+		static float constexpr TraversalCost = 1.0f;
+
+		struct Bin
+		{
+			BoundingBox box;
+			uint32_t count{ 0u };
+		};
+
+		struct PlanesSoA
+		{
+			std::array< float, 6u > nx;
+			std::array< float, 6u > ny;
+			std::array< float, 6u > nz;
+			std::array< float, 6u > d;
+		};
+
+		PlanesSoA getPlanes( Frustum const & frustum )
+		{
+			PlanesSoA result;
+			renderer::Vec3 const origin{ 0.0f, 0.0f, 0.0f };
+
+			for ( size_t i = 0u; i < 6u; ++i )
+			{
+				auto & plane = frustum.getPlanes()[i];
+				result.nx[i] = plane.normal()[0];
+				result.ny[i] = plane.normal()[1];
+				result.nz[i] = plane.normal()[2];
+				result.d[i] = plane.distance( origin );
+			}
+
+			return result;
+		}
+
+		enum class Intersection
+		{
+			eOutside,
+			eIntersect,
+			eInside,
+		};
+
+		// Tests the box against the planes of the mask, and removes from the mask
+		// the planes the box is fully inside of.
+		Intersection intersect( PlanesSoA const & planes
+			, renderer::Vec3 const & min
+			, renderer::Vec3 const & max
+			, uint32_t & mask )
+		{
+			for ( uint32_t i = 0u; i < 6u; ++i )
+			{
+				if ( mask & ( 1u << i ) )
+				{
+					// The box corner farthest along the plane normal, and the nearest one.
+					auto farthest = planes.nx[i] * ( planes.nx[i] >= 0.0f ? max[0] : min[0] )
+						+ planes.ny[i] * ( planes.ny[i] >= 0.0f ? max[1] : min[1] )
+						+ planes.nz[i] * ( planes.nz[i] >= 0.0f ? max[2] : min[2] )
+						+ planes.d[i];
+
+					if ( farthest < 0.0f )
+					{
+						return Intersection::eOutside;
+					}
+
+					auto nearest = planes.nx[i] * ( planes.nx[i] >= 0.0f ? min[0] : max[0] )
+						+ planes.ny[i] * ( planes.ny[i] >= 0.0f ? min[1] : max[1] )
+						+ planes.nz[i] * ( planes.nz[i] >= 0.0f ? min[2] : max[2] )
+						+ planes.d[i];
+
+					if ( nearest >= 0.0f )
+					{
+						mask &= ~( 1u << i );
+					}
+				}
+			}
+
+			return mask
+				? Intersection::eIntersect
+				: Intersection::eInside;
+		}
+
+		uint32_t getBin( float centre
+			, float min
+			, float scale )
+		{
+			return std::min( BinCount - 1u, uint32_t( ( centre - min ) * scale ) );
+		}
+	}
+
+	//*********************************************************************************************
+
+	void BoundingBox::merge( renderer::Vec3 const & point )
+	{
+		for ( size_t i = 0u; i < 3u; ++i )
+		{
+			min[i] = std::min( min[i], point[i] );
+			max[i] = std::max( max[i], point[i] );
+		}
+	}
+
+	void BoundingBox::merge( BoundingBox const & box )
+	{
+		for ( size_t i = 0u; i < 3u; ++i )
+		{
+			min[i] = std::min( min[i], box.min[i] );
+			max[i] = std::max( max[i], box.max[i] );
+		}
+	}
+
+	renderer::Vec3 BoundingBox::getCentre()const
+	{
+		return renderer::Vec3{ ( min[0] + max[0] ) / 2.0f
+			, ( min[1] + max[1] ) / 2.0f
+			, ( min[2] + max[2] ) / 2.0f };
+	}
+
+	float BoundingBox::getSurfaceArea()const
+	{
+		if ( !isValid() )
+		{
+			return 0.0f;
+		}
+
+		auto x = max[0] - min[0];
+		auto y = max[1] - min[1];
+		auto z = max[2] - min[2];
+		return 2.0f * ( x * y + y * z + z * x );
+	}
+
+	BoundingBox getBoundingBox( VertexBuffer const & vertices )
+	{
+		BoundingBox result;
+		auto data = vertices.getData();
+
+		for ( uint32_t i = 0u; i < vertices.getCount(); ++i )
+		{
+			result.merge( data[i].position );
+		}
+
+		if ( !result.isValid() )
+		{
+			result.min = renderer::Vec3{ 0.0f, 0.0f, 0.0f };
+			result.max = result.min;
+		}
+
+		return result;
+	}
+
+	std::vector< BoundingBox > getBoundingBoxes( Object const & object )
+	{
+		std::vector< BoundingBox > result;
+		result.reserve( object.size() );
+
+		for ( auto & submesh : object )
+		{
+			result.push_back( getBoundingBox( submesh.vbo ) );
+		}
+
+		return result;
+	}
+
+	//*********************************************************************************************
+
+	void Bvh::build( std::vector< BoundingBox > const & boxes )
+	{
+		m_nodes.clear();
+		m_indices.resize( boxes.size() );
+		m_boxes.clear();
+
+		if ( boxes.empty() )
+		{
+			return;
+		}
+
+		std::vector< renderer::Vec3 > centres;
+		centres.reserve( boxes.size() );
+
+		for ( uint32_t i = 0u; i < boxes.size(); ++i )
+		{
+			m_indices[i] = i;
+			centres.push_back( boxes[i].getCentre() );
+		}
+
+		// A binary tree with N leaves has 2N - 1 nodes.
+		m_nodes.reserve( 2u * boxes.size() - 1u );
+		doBuild( boxes, centres, 0u, uint32_t( boxes.size() ) );
+		m_nodes.shrink_to_fit();
+
+		m_boxes.reserve( boxes.size() );
+
+		for ( auto index : m_indices )
+		{
+			m_boxes.push_back( boxes[index] );
+		}
+	}
+
+	void Bvh::refit( std::vector< BoundingBox > const & boxes )
+	{
+		assert( boxes.size() == m_indices.size() );
+
+		for ( size_t i = 0u; i < m_indices.size(); ++i )
+		{
+			m_boxes[i] = boxes[m_indices[i]];
+		}
+
+		// The children are stored after their parent, so a reverse
+		// traversal updates them before it.
+		for ( auto it = m_nodes.rbegin(); it != m_nodes.rend(); ++it )
+		{
+			auto & node = *it;
+			BoundingBox box;
+
+			if ( node.isLeaf() )
+			{
+				for ( uint32_t i = node.offset; i < node.offset + node.count; ++i )
+				{
+					box.merge( m_boxes[i] );
+				}
+			}
+			else
+			{
+				auto index = uint32_t( std::distance( m_nodes.begin(), it.base() ) - 1 );
+				auto & left = m_nodes[index + 1u];
+				auto & right = m_nodes[node.offset];
+				box.merge( BoundingBox{ left.min, left.max } );
+				box.merge( BoundingBox{ right.min, right.max } );
+			}
+
+			node.min = box.min;
+			node.max = box.max;
+		}
+	}
+
+	uint32_t Bvh::query( Frustum const & frustum
+		, std::vector< uint8_t > & visible )const
+	{
+		return doQuery( frustum, nullptr, visible );
+	}
+
+	uint32_t Bvh::query( Frustum const & frustum
+		, OcclusionTest const & isOccluded
+		, std::vector< uint8_t > & visible )const
+	{
+		return doQuery( frustum, &isOccluded, visible );
+	}
+
+	uint32_t Bvh::doBuild( std::vector< BoundingBox > const & boxes
+		, std::vector< renderer::Vec3 > const & centres
+		, uint32_t begin
+		, uint32_t end )
+	{
+		auto nodeIndex = uint32_t( m_nodes.size() );
+		m_nodes.emplace_back();
+		BoundingBox box;
+		BoundingBox centresBox;
+
+		for ( auto i = begin; i < end; ++i )
+		{
+			box.merge( boxes[m_indices[i]] );
+			centresBox.merge( centres[m_indices[i]] );
+		}
+
+		auto count = end - begin;
+		auto leafCost = float( count );
+		auto bestCost = std::numeric_limits< float >::max();
+		uint32_t bestAxis = 0u;
+		uint32_t bestSplit = 0u;
+		auto area = box.getSurfaceArea();
+
+		if ( count > 1u && area > 0.0f )
+		{
+			// Binned SAH: evaluate the split planes between BinCount buckets on each axis.
+			for ( uint32_t axis = 0u; axis < 3u; ++axis )
+			{
+				auto extent = centresBox.max[axis] - centresBox.min[axis];
+
+				if ( extent <= 0.0f )
+				{
+					continue;
+				}
+
+				auto scale = float( BinCount ) / extent;
+				std::array< Bin, BinCount > bins;
+
+				for ( auto i = begin; i < end; ++i )
+				{
+					auto & bin = bins[getBin( centres[m_indices[i]][axis], centresBox.min[axis], scale )];
+					bin.box.merge( boxes[m_indices[i]] );
+					++bin.count;
+				}
+
+				std::array< float, BinCount - 1u > rightAreas;
+				std::array< uint32_t, BinCount - 1u > rightCounts;
+				BoundingBox right;
+				uint32_t rightCount = 0u;
+
+				for ( auto i = BinCount - 1u; i > 0u; --i )
+				{
+					right.merge( bins[i].box );
+					rightCount += bins[i].count;
+					rightAreas[i - 1u] = right.getSurfaceArea();
+					rightCounts[i - 1u] = rightCount;
+				}
+
+				BoundingBox left;
+				uint32_t leftCount = 0u;
+
+				for ( uint32_t i = 0u; i < BinCount - 1u; ++i )
+				{
+					left.merge( bins[i].box );
+					leftCount += bins[i].count;
+					auto cost = TraversalCost
+						+ ( leftCount * left.getSurfaceArea() + rightCounts[i] * rightAreas[i] ) / area;
+
+					if ( leftCount && rightCounts[i] && cost < bestCost )
+					{
+						bestCost = cost;
+						bestAxis = axis;
+						bestSplit = i + 1u;
+					}
+				}
+			}
+		}
+
+		uint32_t middle = begin;
+
+		if ( bestCost < leafCost || count > MaxLeafSize )
+		{
+			if ( bestSplit )
+			{
+				auto scale = float( BinCount ) / ( centresBox.max[bestAxis] - centresBox.min[bestAxis] );
+				auto min = centresBox.min[bestAxis];
+				middle = uint32_t( std::distance( m_indices.begin()
+					, std::partition( m_indices.begin() + begin
+						, m_indices.begin() + end
+						, [&centres, bestAxis, bestSplit, min, scale]( uint32_t index )
+						{
+							return getBin( centres[index][bestAxis], min, scale ) < bestSplit;
+						} ) ) );
+			}
+			else
+			{
+				// All the centres are the same, split at the middle.
+				middle = begin + count / 2u;
+			}
+		}
+
+		if ( middle == begin || middle == end )
+		{
+			auto & node = m_nodes[nodeIndex];
+			node.min = box.min;
+			node.max = box.max;
+			node.offset = begin;
+			node.count = count;
+		}
+		else
+		{
+			doBuild( boxes, centres, begin, middle );
+			auto right = doBuild( boxes, centres, middle, end );
+			auto & node = m_nodes[nodeIndex];
+			node.min = box.min;
+			node.max = box.max;
+			node.offset = right;
+			node.count = 0u;
+		}
+
+		return nodeIndex;
+	}
+
+	uint32_t Bvh::doQuery( Frustum const & frustum
+		, OcclusionTest const * isOccluded
+		, std::vector< uint8_t > & visible )const
+	{
+		visible.assign( m_indices.size(), 0u );
+
+		if ( m_nodes.empty() )
+		{
+			return 0u;
+		}
+
+		struct Entry
+		{
+			uint32_t node;
+			uint32_t mask;
+		};
+		auto planes = getPlanes( frustum );
+		uint32_t result = 0u;
+		std::vector< Entry > stack;
+		stack.reserve( 64u );
+		stack.push_back( { 0u, 0x3Fu } );
+
+		while ( !stack.empty() )
+		{
+			auto entry = stack.back();
+			stack.pop_back();
+			auto & node = m_nodes[entry.node];
+
+			if ( entry.mask
+				&& intersect( planes, node.min, node.max, entry.mask ) == Intersection::eOutside )
+			{
+				continue;
+			}
+
+			if ( isOccluded
+				&& ( *isOccluded )( BoundingBox{ node.min, node.max } ) )
+			{
+				continue;
+			}
+
+			if ( !node.isLeaf() )
+			{
+				// Push the right child first, to process the left one, stored next, first.
+				stack.push_back( { node.offset, entry.mask } );
+				stack.push_back( { entry.node + 1u, entry.mask } );
+				continue;
+			}
+
+			for ( auto i = node.offset; i < node.offset + node.count; ++i )
+			{
+				auto mask = entry.mask;
+
+				if ( node.count == 1u
+					|| !mask
+					|| intersect( planes, m_boxes[i].min, m_boxes[i].max, mask ) != Intersection::eOutside )
+				{
+					visible[m_indices[i]] = 1u;
+					++result;
+				}
+			}
+		}
+
+		return result;
+	}
+
+	//*********************************************************************************************
+
+	void benchmarkBvh( std::vector< BoundingBox > const & boxes
+		, std::ostream & stream )
+	{
+		static uint32_t constexpr Iterations = 20u;
+		static uint32_t constexpr ViewCount = 16u;
+		static std::array< size_t, 4u > const Targets{ 0u, 10000u, 100000u, 1000000u };
+
+		if ( boxes.empty() )
+		{
+			stream << "BVH benchmark: no primitive." << std::endl;
+			return;
+		}
+
+		BoundingBox sceneBox;
+
+		for ( auto & box : boxes )
+		{
+			sceneBox.merge( box );
+		}
+
+		auto sceneSize = std::max( sceneBox.max[0] - sceneBox.min[0]
+			, sceneBox.max[2] - sceneBox.min[2] ) * 1.5f;
+		stream << "BVH benchmark (" << boxes.size() << " primitives per copy):" << std::endl;
+
+		uint32_t previousSide = 0u;
+
+		for ( auto target : Targets )
+		{
+			auto side = std::max( 1u, uint32_t( std::ceil( std::sqrt( double( target ) / double( boxes.size() ) ) ) ) );
+
+			if ( side == previousSide )
+			{
+				continue;
+			}
+
+			previousSide = side;
+			// The scene is duplicated on a side x side grid, to get large primitive counts.
+			std::vector< BoundingBox > sceneBoxes;
+			sceneBoxes.reserve( boxes.size() * side * side );
+			BoundingBox gridBox;
+
+			for ( uint32_t z = 0u; z < side; ++z )
+			{
+				for ( uint32_t x = 0u; x < side; ++x )
+				{
+					renderer::Vec3 offset{ float( x ) * sceneSize, 0.0f, float( z ) * sceneSize };
+
+					for ( auto & box : boxes )
+					{
+						sceneBoxes.push_back( BoundingBox{ box.min + offset, box.max + offset } );
+						gridBox.merge( sceneBoxes.back() );
+					}
+				}
+			}
+
+			Bvh bvh;
+			auto begin = std::chrono::high_resolution_clock::now();
+
+			for ( auto i = 0u; i < Iterations; ++i )
+			{
+				bvh.build( sceneBoxes );
+			}
+
+			auto build = std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::high_resolution_clock::now() - begin ) / Iterations;
+			begin = std::chrono::high_resolution_clock::now();
+
+			for ( auto i = 0u; i < Iterations; ++i )
+			{
+				bvh.refit( sceneBoxes );
+			}
+
+			auto refit = std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::high_resolution_clock::now() - begin ) / Iterations;
+			BoundingSpheres spheres;
+
+			for ( auto & box : sceneBoxes )
+			{
+				spheres.add( box.getCentre(), utils::distance( box.getCentre(), box.max ) );
+			}
+
+			// The views orbit around the grid, inside it, looking outward.
+			auto centre = gridBox.getCentre();
+			auto radius = utils::distance( centre, gridBox.max ) / 2.0f;
+			auto projection = utils::perspective( utils::toRadians( 60.0_degrees ), 16.0f / 9.0f, 0.1f, radius * 2.0f );
+			std::chrono::nanoseconds bvhTime{ 0 };
+			std::chrono::nanoseconds linearTime{ 0 };
+			uint64_t bvhVisible = 0u;
+			uint64_t linearVisible = 0u;
+			std::vector< uint8_t > visible;
+
+			for ( auto view = 0u; view < ViewCount; ++view )
+			{
+				auto angle = float( view ) * 2.0f * float( utils::Pi ) / ViewCount;
+				renderer::Vec3 eye{ centre[0] + radius * std::cos( angle ) / 2.0f
+					, centre[1]
+					, centre[2] + radius * std::sin( angle ) / 2.0f };
+				renderer::Vec3 target{ centre[0] + radius * std::cos( angle )
+					, centre[1]
+					, centre[2] + radius * std::sin( angle ) };
+				Frustum frustum{ projection * utils::lookAt( eye, target, renderer::Vec3{ 0.0f, 1.0f, 0.0f } ) };
+
+				begin = std::chrono::high_resolution_clock::now();
+
+				for ( auto i = 0u; i < Iterations; ++i )
+				{
+					bvhVisible += bvh.query( frustum, visible );
+				}
+
+				bvhTime += std::chrono::high_resolution_clock::now() - begin;
+				begin = std::chrono::high_resolution_clock::now();
+
+				for ( auto i = 0u; i < Iterations; ++i )
+				{
+					linearVisible += cull( frustum, spheres, visible, false );
+				}
+
+				linearTime += std::chrono::high_resolution_clock::now() - begin;
+			}
+
+			auto queries = ViewCount * Iterations;
+			stream << "  " << std::setw( 8 ) << sceneBoxes.size() << " primitives, "
+				<< std::setw( 8 ) << bvh.getNodeCount() << " nodes"
+				<< ", build: " << std::setw( 8 ) << build.count() << " us"
+				<< ", refit: " << std::setw( 6 ) << refit.count() << " us"
+				<< ", BVH query: " << std::setw( 8 ) << std::chrono::duration_cast< std::chrono::microseconds >( bvhTime / queries ).count() << " us"
+				<< " (" << bvhVisible / queries << " visible)"
+				<< ", linear query: " << std::setw( 8 ) << std::chrono::duration_cast< std::chrono::microseconds >( linearTime / queries ).count() << " us"
+				<< " (" << linearVisible / queries << " visible)" << std::endl;
+		}
+	}
+}
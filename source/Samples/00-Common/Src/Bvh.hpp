@@ -0,0 +1,243 @@
+#pragma once
+
+#include "FrustumCulling.hpp"
+
+#include <functional>
+#include <limits>
+
+namespace common
+{
+	/**
+	*\~english
+	*\brief
+	*	An axis aligned bounding box.
+	*\~french
+	*\brief
+	*	Une boîte englobante alignée sur les axes.
+	*/
+	struct BoundingBox
+	{
+		renderer::Vec3 min{ std::numeric_limits< float >::max(), std::numeric_limits< float >::max(), std::numeric_limits< float >::max() };
+		renderer::Vec3 max{ std::numeric_limits< float >::lowest(), std::numeric_limits< float >::lowest(), std::numeric_limits< float >::lowest() };
+
+		void merge( renderer::Vec3 const & point );
+		void merge( BoundingBox const & box );
+		renderer::Vec3 getCentre()const;
+		float getSurfaceArea()const;
+
+		inline bool isValid()const
+		{
+			return min[0] <= max[0]
+				&& min[1] <= max[1]
+				&& min[2] <= max[2];
+		}
+	};
+	/**
+	*\~english
+	*\brief
+	*	Computes the bounding box of a vertex buffer.
+	*\~french
+	*\brief
+	*	Calcule la boîte englobante d'un tampon de sommets.
+	*/
+	BoundingBox getBoundingBox( VertexBuffer const & vertices );
+	/**
+	*\~english
+	*\brief
+	*	Computes the bounding box of each submesh of an object.
+	*\~french
+	*\brief
+	*	Calcule la boîte englobante de chaque sous-maillage d'un objet.
+	*/
+	std::vector< BoundingBox > getBoundingBoxes( Object const & object );
+	/**
+	*\~english
+	*\brief
+	*	Bounding volume hierarchy, built with the surface area heuristic.
+	*\remarks
+	*	The nodes are stored depth first in a single array: the left child of
+	*	an inner node directly follows it, so that a traversal mostly reads
+	*	contiguous memory.
+	*	The hierarchy can be refitted when the primitives move, without changing its topology.
+	*\~french
+	*\brief
+	*	Hiérarchie de volumes englobants, construite avec l'heuristique d'aire de surface.
+	*\remarks
+	*	Les noeuds sont stockés en profondeur d'abord dans un seul tableau : l'enfant
+	*	gauche d'un noeud interne le suit directement, afin qu'un parcours lise
+	*	principalement de la mémoire contigüe.
+	*	La hiérarchie peut être réajustée lorsque les primitives bougent, sans changer sa topologie.
+	*/
+	class Bvh
+	{
+	public:
+		/**
+		*\~english
+		*\brief
+		*	A node, fitting in half a cache line.
+		*\remarks
+		*	For a leaf, \p offset is the index of its first primitive in the primitive indices,
+		*	for an inner node, it is the index of its right child.
+		*\~french
+		*\brief
+		*	Un noeud, tenant dans une demi ligne de cache.
+		*\remarks
+		*	Pour une feuille, \p offset est l'indice de sa première primitive dans les indices de primitives,
+		*	pour un noeud interne, c'est l'indice de son enfant droit.
+		*/
+		struct Node
+		{
+			renderer::Vec3 min;
+			uint32_t offset;
+			renderer::Vec3 max;
+			uint32_t count;
+
+			inline bool isLeaf()const
+			{
+				return count != 0u;
+			}
+		};
+		/**
+		*\~english
+		*\brief
+		*	Tells if a box is hidden by occluders, the hidden nodes are not traversed.
+		*\~french
+		*\brief
+		*	Dit si une boîte est cachée par des occluders, les noeuds cachés ne sont pas parcourus.
+		*/
+		using OcclusionTest = std::function< bool( BoundingBox const & ) >;
+
+	public:
+		/**
+		*\~english
+		*\brief
+		*	Builds the hierarchy from the primitives bounding boxes.
+		*\~french
+		*\brief
+		*	Construit la hiérarchie à partir des boîtes englobantes des primitives.
+		*/
+		void build( std::vector< BoundingBox > const & boxes );
+		/**
+		*\~english
+		*\brief
+		*	Updates the nodes bounds after the primitives have moved.
+		*\remarks
+		*	The primitives count must be the one given to build().
+		*	The queries quality decreases with the displacement, a rebuild may then be preferable.
+		*\~french
+		*\brief
+		*	Met à jour les bornes des noeuds après que les primitives ont bougé.
+		*\remarks
+		*	Le nombre de primitives doit être celui donné à build().
+		*	La qualité des requêtes diminue avec le déplacement, une reconstruction peut alors être préférable.
+		*/
+		void refit( std::vector< BoundingBox > const & boxes );
+		/**
+		*\~english
+		*\brief
+		*	Retrieves the primitives intersecting the frustum.
+		*\remarks
+		*	The subtrees fully inside the frustum are accepted without further tests.
+		*\param[in] frustum
+		*	The frustum, in the primitives space.
+		*\param[out] visible
+		*	Receives 1 for each visible primitive, 0 for the others.
+		*\return
+		*	The number of visible primitives.
+		*\~french
+		*\brief
+		*	Récupère les primitives intersectant le frustum.
+		*\remarks
+		*	Les sous-arbres entièrement dans le frustum sont acceptés sans plus de tests.
+		*\param[in] frustum
+		*	Le frustum, dans l'espace des primitives.
+		*\param[out] visible
+		*	Reçoit 1 pour chaque primitive visible, 0 pour les autres.
+		*\return
+		*	Le nombre de primitives visibles.
+		*/
+		uint32_t query( Frustum const & frustum
+			, std::vector< uint8_t > & visible )const;
+		/**
+		*\~english
+		*\brief
+		*	Retrieves the primitives intersecting the frustum, and not occluded.
+		*\remarks
+		*	The occlusion test is run on the nodes passing the frustum test,
+		*	from the root, and the occluded ones are skipped with their subtree.
+		*\param[in] frustum
+		*	The frustum, in the primitives space.
+		*\param[in] isOccluded
+		*	The occlusion test.
+		*\param[out] visible
+		*	Receives 1 for each visible primitive, 0 for the others.
+		*\return
+		*	The number of visible primitives.
+		*\~french
+		*\brief
+		*	Récupère les primitives intersectant le frustum, et non cachées.
+		*\remarks
+		*	Le test d'occlusion est lancé sur les noeuds passant le test du frustum,
+		*	depuis la racine, et ceux qui sont cachés sont ignorés avec leur sous-arbre.
+		*\param[in] frustum
+		*	Le frustum, dans l'espace des primitives.
+		*\param[in] isOccluded
+		*	Le test d'occlusion.
+		*\param[out] visible
+		*	Reçoit 1 pour chaque primitive visible, 0 pour les autres.
+		*\return
+		*	Le nombre de primitives visibles.
+		*/
+		uint32_t query( Frustum const & frustum
+			, OcclusionTest const & isOccluded
+			, std::vector< uint8_t > & visible )const;
+
+		inline bool empty()const
+		{
+			return m_nodes.empty();
+		}
+
+		inline size_t getNodeCount()const
+		{
+			return m_nodes.size();
+		}
+
+		inline size_t getPrimitiveCount()const
+		{
+			return m_indices.size();
+		}
+
+		inline std::vector< Node > const & getNodes()const
+		{
+			return m_nodes;
+		}
+
+	private:
+		uint32_t doBuild( std::vector< BoundingBox > const & boxes
+			, std::vector< renderer::Vec3 > const & centres
+			, uint32_t begin
+			, uint32_t end );
+		uint32_t doQuery( Frustum const & frustum
+			, OcclusionTest const * isOccluded
+			, std::vector< uint8_t > & visible )const;
+
+	private:
+		std::vector< Node > m_nodes;
+		// The primitives indices, sorted by leaf.
+		std::vector< uint32_t > m_indices;
+		// The primitives boxes, in the same order as m_indices.
+		std::vector< BoundingBox > m_boxes;
+	};
+	/**
+	*\~english
+	*\brief
+	*	Runs the BVH benchmark on the given primitives, and writes the build, refit and query times,
+	*	compared to a linear culling of their bounding spheres.
+	*\~french
+	*\brief
+	*	Lance le benchmark de BVH sur les primitives données, et écrit les temps de construction,
+	*	de réajustement et de requête, comparés à un culling linéaire de leurs sphères englobantes.
+	*/
+	void benchmarkBvh( std::vector< BoundingBox > const & boxes
+		, std::ostream & stream );
+}
@@ -192,6 +192,7 @@ namespace common
 		uint32_t size = image.GetSize().x * image.GetSize().y;
 		result.data.resize( size * 4 );
 		result.opacity = image.HasAlpha();
+		result.source = path;
 		auto it = result.data.begin();
 
 		if ( result.opacity )
@@ -0,0 +1,379 @@
+#include "FrustumCulling.hpp"
+
+#include "ThreadPool.hpp"
+
+#include <Utils/Transform.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <random>
+
+#if defined( __AVX__ )
+#	include <immintrin.h>
+#	define Common_CullingAVX 1
+#	define Common_CullingSSE 0
+#elif defined( __SSE__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 1 )
+#	include <xmmintrin.h>
+#	define Common_CullingAVX 0
+#	define Common_CullingSSE 1
+#else
+#	define Common_CullingAVX 0
+#	define Common_CullingSSE 0
+#endif
+
+namespace common
+{
+	namespace
+	{
+		// Below this count, dispatching the ranges to the workers costs more than the culling.
+		static size_t constexpr ParallelThreshold = 16384u;
+
+		ThreadPool & getPool()
+		{
+			// Created on first use, the workers then live until the end of the program.
+			static ThreadPool pool;
+			return pool;
+		}
+
+		struct PlanesSoA
+		{
+			std::array< float, 6u > nx;
+			std::array< float, 6u > ny;
+			std::array< float, 6u > nz;
+			std::array< float, 6u > d;
+		};
+
+		PlanesSoA getPlanes( Frustum const & frustum )
+		{
+			PlanesSoA result;
+			renderer::Vec3 const origin{ 0.0f, 0.0f, 0.0f };
+
+			for ( size_t i = 0u; i < 6u; ++i )
+			{
+				auto & plane = frustum.getPlanes()[i];
+				result.nx[i] = plane.normal()[0];
+				result.ny[i] = plane.normal()[1];
+				result.nz[i] = plane.normal()[2];
+				result.d[i] = plane.distance( origin );
+			}
+
+			return result;
+		}
+
+		uint32_t cullScalar( PlanesSoA const & planes
+			, BoundingSpheres const & spheres
+			, size_t begin
+			, size_t end
+			, uint8_t * visible )
+		{
+			uint32_t result = 0u;
+
+			for ( size_t index = begin; index < end; ++index )
+			{
+				uint8_t inside = 1u;
+
+				for ( size_t i = 0u; i < 6u; ++i )
+				{
+					auto distance = planes.nx[i] * spheres.x[index]
+						+ planes.ny[i] * spheres.y[index]
+						+ planes.nz[i] * spheres.z[index]
+						+ planes.d[i];
+					inside &= uint8_t( distance >= -spheres.radius[index] );
+				}
+
+				visible[index] = inside;
+				result += inside;
+			}
+
+			return result;
+		}
+
+#if Common_CullingAVX
+
+		static size_t constexpr BatchSize = 8u;
+
+		uint32_t cullBatches( PlanesSoA const & planes
+			, BoundingSpheres const & spheres
+			, size_t begin
+			, size_t end
+			, uint8_t * visible )
+		{
+			uint32_t result = 0u;
+			auto const zero = _mm256_setzero_ps();
+			size_t index = begin;
+
+			for ( ; index + BatchSize <= end; index += BatchSize )
+			{
+				auto x = _mm256_loadu_ps( &spheres.x[index] );
+				auto y = _mm256_loadu_ps( &spheres.y[index] );
+				auto z = _mm256_loadu_ps( &spheres.z[index] );
+				auto r = _mm256_sub_ps( zero, _mm256_loadu_ps( &spheres.radius[index] ) );
+				auto inside = _mm256_castsi256_ps( _mm256_set1_epi32( -1 ) );
+
+				for ( size_t i = 0u; i < 6u; ++i )
+				{
+					auto distance = _mm256_add_ps( _mm256_add_ps( _mm256_mul_ps( x, _mm256_set1_ps( planes.nx[i] ) )
+							, _mm256_mul_ps( y, _mm256_set1_ps( planes.ny[i] ) ) )
+						, _mm256_add_ps( _mm256_mul_ps( z, _mm256_set1_ps( planes.nz[i] ) )
+							, _mm256_set1_ps( planes.d[i] ) ) );
+					inside = _mm256_and_ps( inside, _mm256_cmp_ps( distance, r, _CMP_GE_OQ ) );
+				}
+
+				auto mask = _mm256_movemask_ps( inside );
+
+				for ( size_t i = 0u; i < BatchSize; ++i )
+				{
+					visible[index + i] = uint8_t( ( mask >> i ) & 1 );
+					result += visible[index + i];
+				}
+			}
+
+			return result + cullScalar( planes, spheres, index, end, visible );
+		}
+
+#elif Common_CullingSSE
+
+		static size_t constexpr BatchSize = 4u;
+
+		uint32_t cullBatches( PlanesSoA const & planes
+			, BoundingSpheres const & spheres
+			, size_t begin
+			, size_t end
+			, uint8_t * visible )
+		{
+			uint32_t result = 0u;
+			auto const zero = _mm_setzero_ps();
+			size_t index = begin;
+
+			for ( ; index + BatchSize <= end; index += BatchSize )
+			{
+				auto x = _mm_loadu_ps( &spheres.x[index] );
+				auto y = _mm_loadu_ps( &spheres.y[index] );
+				auto z = _mm_loadu_ps( &spheres.z[index] );
+				auto r = _mm_sub_ps( zero, _mm_loadu_ps( &spheres.radius[index] ) );
+				auto inside = _mm_cmpeq_ps( zero, zero );
+
+				for ( size_t i = 0u; i < 6u; ++i )
+				{
+					auto distance = _mm_add_ps( _mm_add_ps( _mm_mul_ps( x, _mm_set1_ps( planes.nx[i] ) )
+							, _mm_mul_ps( y, _mm_set1_ps( planes.ny[i] ) ) )
+						, _mm_add_ps( _mm_mul_ps( z, _mm_set1_ps( planes.nz[i] ) )
+							, _mm_set1_ps( planes.d[i] ) ) );
+					inside = _mm_and_ps( inside, _mm_cmpge_ps( distance, r ) );
+				}
+
+				auto mask = _mm_movemask_ps( inside );
+
+				for ( size_t i = 0u; i < BatchSize; ++i )
+				{
+					visible[index + i] = uint8_t( ( mask >> i ) & 1 );
+					result += visible[index + i];
+				}
+			}
+
+			return result + cullScalar( planes, spheres, index, end, visible );
+		}
+
+#else
+
+		static size_t constexpr BatchSize = 1u;
+
+		uint32_t cullBatches( PlanesSoA const & planes
+			, BoundingSpheres const & spheres
+			, size_t begin
+			, size_t end
+			, uint8_t * visible )
+		{
+			return cullScalar( planes, spheres, begin, end, visible );
+		}
+
+#endif
+	}
+
+	void BoundingSpheres::add( renderer::Vec3 const & centre
+		, float radius )
+	{
+		x.push_back( centre[0] );
+		y.push_back( centre[1] );
+		z.push_back( centre[2] );
+		this->radius.push_back( radius );
+	}
+
+	void BoundingSpheres::add( std::vector< Vertex > const & vertices )
+	{
+		if ( vertices.empty() )
+		{
+			add( renderer::Vec3{ 0.0f, 0.0f, 0.0f }, 0.0f );
+			return;
+		}
+
+		// Sphere centred on the axis aligned bounding box.
+		auto min = vertices.front().position;
+		auto max = min;
+
+		for ( auto & vertex : vertices )
+		{
+			for ( size_t i = 0u; i < 3u; ++i )
+			{
+				min[i] = std::min( min[i], vertex.position[i] );
+				max[i] = std::max( max[i], vertex.position[i] );
+			}
+		}
+
+		renderer::Vec3 centre{ ( min[0] + max[0] ) / 2.0f
+			, ( min[1] + max[1] ) / 2.0f
+			, ( min[2] + max[2] ) / 2.0f };
+		float radius = 0.0f;
+
+		for ( auto & vertex : vertices )
+		{
+			radius = std::max( radius, utils::distance( centre, vertex.position ) );
+		}
+
+		add( centre, radius );
+	}
+
+	void BoundingSpheres::clear()
+	{
+		x.clear();
+		y.clear();
+		z.clear();
+		radius.clear();
+	}
+
+	Frustum::Frustum( renderer::Mat4 const & matrix )
+	{
+		// Gribb/Hartmann extraction, the near plane uses the [-w, w] clip range,
+		// which stays conservative for the [0, w] one.
+		auto row = [&matrix]( size_t index )
+		{
+			return renderer::Vec4{ matrix[0][index]
+				, matrix[1][index]
+				, matrix[2][index]
+				, matrix[3][index] };
+		};
+		auto toPlane = []( renderer::Vec4 const & plane )
+		{
+			renderer::Vec3 normal{ plane.x, plane.y, plane.z };
+			auto squaredLength = utils::dot( normal, normal );
+			return utils::PlaneEquation{ normal, normal * ( -plane.w / squaredLength ) };
+		};
+		auto r0 = row( 0u );
+		auto r1 = row( 1u );
+		auto r2 = row( 2u );
+		auto r3 = row( 3u );
+		m_planes =
+		{
+			toPlane( r3 + r0 ),
+			toPlane( r3 - r0 ),
+			toPlane( r3 + r1 ),
+			toPlane( r3 - r1 ),
+			toPlane( r3 + r2 ),
+			toPlane( r3 - r2 ),
+		};
+	}
+
+	uint32_t cull( Frustum const & frustum
+		, BoundingSpheres const & spheres
+		, std::vector< uint8_t > & visible
+		, bool multithreaded )
+	{
+		auto planes = getPlanes( frustum );
+		auto count = spheres.size();
+		visible.resize( count );
+		size_t threadCount = multithreaded && count >= ParallelThreshold
+			? std::min( size_t( getPool().getCount() ) + 1u
+				, count / ParallelThreshold )
+			: 1u;
+
+		if ( threadCount <= 1u )
+		{
+			return cullBatches( planes, spheres, 0u, count, visible.data() );
+		}
+
+		// Each worker processes a contiguous range, aligned on the SIMD batch size, the last one ending at count.
+		auto rangeSize = ( count + threadCount - 1u ) / threadCount;
+		rangeSize = ( ( rangeSize + BatchSize - 1u ) / BatchSize ) * BatchSize;
+		std::vector< std::future< uint32_t > > counts;
+		counts.reserve( threadCount - 1u );
+
+		for ( size_t i = 1u; i < threadCount; ++i )
+		{
+			auto begin = std::min( i * rangeSize, count );
+			auto end = i + 1u == threadCount
+				? count
+				: std::min( begin + rangeSize, count );
+			counts.push_back( getPool().submit( [&planes, &spheres, &visible, begin, end]()
+				{
+					return cullBatches( planes, spheres, begin, end, visible.data() );
+				} ) );
+		}
+
+		// The calling thread processes the first range.
+		auto result = cullBatches( planes, spheres, 0u, std::min( rangeSize, count ), visible.data() );
+
+		for ( auto & value : counts )
+		{
+			result += value.get();
+		}
+
+		return result;
+	}
+
+	void benchmarkCulling( std::ostream & stream )
+	{
+		static uint32_t constexpr Iterations = 20u;
+		static std::array< uint32_t, 4u > const Counts{ 1000u, 10000u, 100000u, 1000000u };
+		auto matrix = utils::perspective( utils::toRadians( 90.0_degrees ), 16.0f / 9.0f, 0.1f, 1000.0f )
+			* utils::lookAt( renderer::Vec3{ 0.0f, 0.0f, 0.0f }
+				, renderer::Vec3{ 0.0f, 0.0f, 1.0f }
+				, renderer::Vec3{ 0.0f, 1.0f, 0.0f } );
+		Frustum frustum{ matrix };
+		std::mt19937 engine;
+		std::uniform_real_distribution< float > position{ -500.0f, 500.0f };
+		std::uniform_real_distribution< float > radius{ 0.5f, 5.0f };
+		std::vector< uint8_t > visible;
+		stream << "Frustum culling ("
+#if Common_CullingAVX
+			<< "AVX"
+#elif Common_CullingSSE
+			<< "SSE"
+#else
+			<< "scalar"
+#endif
+			<< ", " << ( getPool().getCount() + 1u ) << " threads):" << std::endl;
+
+		for ( auto count : Counts )
+		{
+			BoundingSpheres spheres;
+
+			for ( auto i = 0u; i < count; ++i )
+			{
+				spheres.add( renderer::Vec3{ position( engine ), position( engine ), position( engine ) }
+					, radius( engine ) );
+			}
+
+			for ( auto multithreaded : { false, true } )
+			{
+				uint32_t visibleCount = 0u;
+				auto begin = std::chrono::high_resolution_clock::now();
+
+				for ( auto i = 0u; i < Iterations; ++i )
+				{
+					visibleCount = cull( frustum, spheres, visible, multithreaded );
+				}
+
+				auto elapsed = std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::high_resolution_clock::now() - begin );
+				auto perMs = elapsed.count()
+					? double( count ) * Iterations * 1000.0 / double( elapsed.count() )
+					: 0.0;
+				stream << "  " << std::setw( 8 ) << count << " objects"
+					<< ( multithreaded ? ", multithreaded" : ", single thread " )
+					<< ": " << std::setw( 8 ) << uint64_t( perMs ) << " objects/ms"
+					<< " (" << visibleCount << " visible)" << std::endl;
+			}
+		}
+	}
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "Prerequisites.hpp"
+
+#include <Utils/PlaneEquation.hpp>
+
+#include <array>
+#include <ostream>
+
+namespace common
+{
+	/**
+	*\~english
+	*\brief
+	*	Bounding spheres, stored as a structure of arrays to be processed in SIMD batches.
+	*\~french
+	*\brief
+	*	Des sphères englobantes, stockées en structure de tableaux pour être traitées par lots SIMD.
+	*/
+	struct BoundingSpheres
+	{
+		std::vector< float > x;
+		std::vector< float > y;
+		std::vector< float > z;
+		std::vector< float > radius;
+
+		void add( renderer::Vec3 const & centre
+			, float radius );
+		void add( std::vector< Vertex > const & vertices );
+		void clear();
+
+		inline size_t size()const
+		{
+			return radius.size();
+		}
+	};
+	/**
+	*\~english
+	*\brief
+	*	The six planes of a view frustum, oriented toward its inside.
+	*\~french
+	*\brief
+	*	Les six plans d'un frustum de vue, orientés vers son intérieur.
+	*/
+	class Frustum
+	{
+	public:
+		/**
+		*\~english
+		*\brief
+		*	Extracts the planes from a clip space matrix.
+		*\remarks
+		*	With a projection * view * model matrix, the planes are expressed in model space.
+		*\~french
+		*\brief
+		*	Extrait les plans d'une matrice vers l'espace de clipping.
+		*\remarks
+		*	Avec une matrice projection * vue * modèle, les plans sont exprimés dans l'espace du modèle.
+		*/
+		explicit Frustum( renderer::Mat4 const & matrix );
+
+		inline std::array< utils::PlaneEquation, 6u > const & getPlanes()const
+		{
+			return m_planes;
+		}
+
+	private:
+		std::array< utils::PlaneEquation, 6u > m_planes;
+	};
+	/**
+	*\~english
+	*\brief
+	*	Tests the given spheres against the frustum.
+	*\remarks
+	*	Uses AVX or SSE when available at compile time, and splits large sets over several threads.
+	*\param[in] frustum
+	*	The frustum.
+	*\param[in] spheres
+	*	The bounding spheres.
+	*\param[out] visible
+	*	Receives 1 for each visible sphere, 0 for the others.
+	*\param[in] multithreaded
+	*	Tells if large sets can be processed by several threads.
+	*\return
+	*	The number of visible spheres.
+	*\~french
+	*\brief
+	*	Teste les sphères données contre le frustum.
+	*\remarks
+	*	Utilise AVX ou SSE lorsqu'ils sont disponibles à la compilation, et répartit les grands ensembles sur plusieurs threads.
+	*\param[in] frustum
+	*	Le frustum.
+	*\param[in] spheres
+	*	Les sphères englobantes.
+	*\param[out] visible
+	*	Reçoit 1 pour chaque sphère visible, 0 pour les autres.
+	*\param[in] multithreaded
+	*	Dit si les grands ensembles peuvent être traités par plusieurs threads.
+	*\return
+	*	Le nombre de sphères visibles.
+	*/
+	uint32_t cull( Frustum const & frustum
+		, BoundingSpheres const & spheres
+		, std::vector< uint8_t > & visible
+		, bool multithreaded = true );
+	/**
+	*\~english
+	*\brief
+	*	Runs the culling microbenchmark and writes the culled objects per millisecond.
+	*\~french
+	*\brief
+	*	Lance le microbenchmark de culling et écrit le nombre d'objets traités par milliseconde.
+	*/
+	void benchmarkCulling( std::ostream & stream );
+}
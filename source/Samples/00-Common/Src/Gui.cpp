@@ -174,17 +174,17 @@ namespace common
 		m_fence->reset();
 	}
 
-	bool Gui::header( const char *caption )
+	bool Gui::header( const char *caption )const
 	{
 		return ImGui::CollapsingHeader( caption, ImGuiTreeNodeFlags_DefaultOpen );
 	}
 
-	bool Gui::checkBox( const char *caption, bool *value )
+	bool Gui::checkBox( const char *caption, bool *value )const
 	{
 		return ImGui::Checkbox( caption, value );
 	}
 
-	bool Gui::checkBox( const char *caption, int32_t *value )
+	bool Gui::checkBox( const char *caption, int32_t *value )const
 	{
 		bool val = ( *value == 1 );
 		bool res = ImGui::Checkbox( caption, &val );
@@ -192,22 +192,22 @@ namespace common
 		return res;
 	}
 
-	bool Gui::inputFloat( const char *caption, float *value, float step, uint32_t precision )
+	bool Gui::inputFloat( const char *caption, float *value, float step, uint32_t precision )const
 	{
 		return ImGui::InputFloat( caption, value, step, step * 10.0f, precision );
 	}
 
-	bool Gui::sliderFloat( char const * caption, float* value, float min, float max )
+	bool Gui::sliderFloat( char const * caption, float* value, float min, float max )const
 	{
 		return ImGui::SliderFloat( caption, value, min, max );
 	}
 
-	bool Gui::sliderInt( char const * caption, int32_t* value, int32_t min, int32_t max )
+	bool Gui::sliderInt( char const * caption, int32_t* value, int32_t min, int32_t max )const
 	{
 		return ImGui::SliderInt( caption, value, min, max );
 	}
 
-	bool Gui::comboBox( const char *caption, int32_t *itemindex, std::vector<std::string> items )
+	bool Gui::comboBox( const char *caption, int32_t *itemindex, std::vector<std::string> items )const
 	{
 		if ( items.empty() )
 		{
@@ -225,12 +225,12 @@ namespace common
 		return ImGui::Combo( caption, itemindex, &charitems[0], itemCount, itemCount );
 	}
 
-	bool Gui::button( const char *caption )
+	bool Gui::button( const char *caption )const
 	{
 		return ImGui::Button( caption );
 	}
 
-	void Gui::text( const char *formatstr, ... )
+	void Gui::text( const char *formatstr, ... )const
 	{
 		va_list args;
 		va_start( args, formatstr );
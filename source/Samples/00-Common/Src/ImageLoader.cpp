@@ -0,0 +1,137 @@
+#include "ImageLoader.hpp"
+
+#include "FileUtils.hpp"
+
+#include <Utils/StringUtils.hpp>
+
+#include <algorithm>
+
+namespace common
+{
+	namespace
+	{
+		ImagePtr doDecode( std::string path )
+		{
+			try
+			{
+				return std::make_shared< Image >( common::loadImage( path ) );
+			}
+			catch ( std::runtime_error & )
+			{
+			}
+
+			path = utils::replace( path, ".tga", ".jpg" );
+
+			try
+			{
+				return std::make_shared< Image >( common::loadImage( path ) );
+			}
+			catch ( std::runtime_error & )
+			{
+			}
+
+			path = utils::replace( path, ".jpg", ".png" );
+
+			try
+			{
+				return std::make_shared< Image >( common::loadImage( path ) );
+			}
+			catch ( std::runtime_error & )
+			{
+			}
+
+			return nullptr;
+		}
+
+		void doGenerateMipmaps( Image & image
+			, uint32_t levels )
+		{
+			// 2x2 box filter on RGBA8 pixels, the odd borders being clamped.
+			auto srcWidth = image.size[0];
+			auto srcHeight = image.size[1];
+			uint8_t const * src = image.data.data();
+			image.mips.resize( levels > 1u ? levels - 1u : 0u );
+
+			for ( auto & mip : image.mips )
+			{
+				auto width = std::max( 1u, srcWidth / 2u );
+				auto height = std::max( 1u, srcHeight / 2u );
+				mip.resize( width * height * 4u );
+				auto dst = mip.data();
+
+				for ( uint32_t y = 0u; y < height; ++y )
+				{
+					auto y0 = std::min( y * 2u, srcHeight - 1u );
+					auto y1 = std::min( y * 2u + 1u, srcHeight - 1u );
+
+					for ( uint32_t x = 0u; x < width; ++x )
+					{
+						auto x0 = std::min( x * 2u, srcWidth - 1u );
+						auto x1 = std::min( x * 2u + 1u, srcWidth - 1u );
+						auto p00 = src + ( y0 * srcWidth + x0 ) * 4u;
+						auto p01 = src + ( y0 * srcWidth + x1 ) * 4u;
+						auto p10 = src + ( y1 * srcWidth + x0 ) * 4u;
+						auto p11 = src + ( y1 * srcWidth + x1 ) * 4u;
+
+						for ( uint32_t c = 0u; c < 4u; ++c )
+						{
+							*dst++ = uint8_t( ( p00[c] + p01[c] + p10[c] + p11[c] + 2u ) / 4u );
+						}
+					}
+				}
+
+				srcWidth = width;
+				srcHeight = height;
+				src = mip.data();
+			}
+		}
+	}
+
+	ImageLoader::ImageLoader( ThreadPool & pool
+		, uint32_t mipLevels )
+		: m_pool{ pool }
+		, m_mipLevels{ mipLevels }
+	{
+	}
+
+	std::shared_future< ImagePtr > ImageLoader::load( std::string const & path )
+	{
+		std::unique_lock< std::mutex > lock{ m_mutex };
+		auto it = m_images.find( path );
+
+		if ( it == m_images.end() )
+		{
+			auto mipLevels = m_mipLevels;
+			it = m_images.emplace( path
+				, m_pool.submit( [path, mipLevels]()
+					{
+						auto result = doDecode( path );
+
+						if ( result )
+						{
+							doGenerateMipmaps( *result, mipLevels );
+						}
+
+						return result;
+					} ).share() ).first;
+		}
+
+		return it->second;
+	}
+
+	ImagePtrArray ImageLoader::waitAll()
+	{
+		std::unique_lock< std::mutex > lock{ m_mutex };
+		ImagePtrArray result;
+
+		for ( auto & image : m_images )
+		{
+			if ( auto loaded = image.second.get() )
+			{
+				result.emplace_back( std::move( loaded ) );
+			}
+		}
+
+		return result;
+	}
+}
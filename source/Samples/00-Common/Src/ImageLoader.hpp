@@ -0,0 +1,88 @@
+/*
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "ThreadPool.hpp"
+
+#include <map>
+
+namespace common
+{
+	/**
+	*\~english
+	*\brief
+	*	Loads images on a thread pool.
+	*\remarks
+	*	Each task decodes the file, converts it to RGBA and generates its mip levels.
+	*	The requests of a same path share a single load.
+	*\~french
+	*\brief
+	*	Charge des images sur un pool de threads.
+	*\remarks
+	*	Chaque tâche décode le fichier, le convertit en RGBA et génère ses niveaux de mip.
+	*	Les demandes d'un même chemin partagent un seul chargement.
+	*/
+	class ImageLoader
+	{
+	public:
+		/**
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] pool
+		*	The thread pool running the loads.
+		*\param[in] mipLevels
+		*	The mip levels count generated for each image, including the first one.
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] pool
+		*	Le pool de threads exécutant les chargements.
+		*\param[in] mipLevels
+		*	Le nombre de niveaux de mip générés pour chaque image, le premier inclus.
+		*/
+		ImageLoader( ThreadPool & pool
+			, uint32_t mipLevels = TEXTURES_MIP_LEVELS );
+		/**
+		*\~english
+		*\brief
+		*	Requests an image load.
+		*\remarks
+		*	When the file can't be loaded, its .jpg then .png variants are tried.
+		*\param[in] path
+		*	The image file path.
+		*\return
+		*	The future receiving the image, null if no variant could be loaded.
+		*\~french
+		*\brief
+		*	Demande le chargement d'une image.
+		*\remarks
+		*	Quand le fichier ne peut pas être chargé, ses variantes .jpg puis .png sont essayées.
+		*\param[in] path
+		*	Le chemin d'accès au fichier image.
+		*\return
+		*	Le future recevant l'image, nulle si aucune variante n'a pu être chargée.
+		*/
+		std::shared_future< ImagePtr > load( std::string const & path );
+		/**
+		*\~english
+		*\brief
+		*	Waits for all the requested loads' end.
+		*\return
+		*	The successfully loaded images, sorted by path.
+		*\~french
+		*\brief
+		*	Attend la fin de tous les chargements demandés.
+		*\return
+		*	Les images chargées avec succès, triées par chemin.
+		*/
+		ImagePtrArray waitAll();
+
+	private:
+		ThreadPool & m_pool;
+		uint32_t m_mipLevels;
+		std::mutex m_mutex;
+		std::map< std::string, std::shared_future< ImagePtr > > m_images;
+	};
+}
@@ -0,0 +1,623 @@
+#include "MeshCache.hpp"
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#if RENDERLIB_WIN32
+#	include <windows.h>
+#else
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <unistd.h>
+#endif
+
+namespace common
+{
+	namespace
+	{
+		// Increment it whenever the layout below, the loaded data or the Assimp post processing change.
+		static uint32_t constexpr CacheMagic = 0x484D4C52u; // "RLMH"
+		static uint32_t constexpr CacheVersion = 1u;
+		// The bulk data is aligned, so that it can be used in place from the mapping.
+		static size_t constexpr CacheAlignment = 16u;
+
+		struct CacheHeader
+		{
+			uint32_t magic;
+			uint32_t version;
+			uint64_t sourceSize;
+			int64_t sourceTime;
+			uint64_t sourceHash;
+			float rescale;
+			uint32_t imageCount;
+			uint32_t submeshCount;
+			uint32_t padding;
+		};
+
+		// Followed by sourceLength characters.
+		struct ImageRecord
+		{
+			uint64_t fileSize;
+			int64_t fileTime;
+			uint64_t dataOffset;
+			uint32_t width;
+			uint32_t height;
+			renderer::PixelFormat format;
+			uint32_t opacity;
+			uint32_t sourceLength;
+			uint32_t padding;
+		};
+
+		// Followed by materialCount MaterialRecord.
+		struct SubmeshRecord
+		{
+			uint64_t verticesOffset;
+			uint64_t facesOffset;
+			uint32_t vertexCount;
+			uint32_t faceCount;
+			uint32_t hasNormals;
+			uint32_t materialCount;
+		};
+
+		// Followed by textureCount image indices.
+		struct MaterialRecord
+		{
+			MaterialData data;
+			uint32_t hasOpacity;
+			uint32_t textureCount;
+		};
+
+		static_assert( std::is_trivially_copyable< Vertex >::value, "Vertex must be stored as is" );
+		static_assert( std::is_trivially_copyable< Face >::value, "Face must be stored as is" );
+		static_assert( std::is_trivially_copyable< MaterialData >::value, "MaterialData must be stored as is" );
+
+		inline uint64_t doGetAligned( uint64_t offset
+			, size_t alignment )
+		{
+			return ( offset + alignment - 1u ) / alignment * alignment;
+		}
+
+		struct FileStamp
+		{
+			uint64_t size{ 0u };
+			int64_t time{ 0 };
+		};
+
+		bool doGetFileStamp( std::string const & path
+			, FileStamp & stamp )
+		{
+#if RENDERLIB_WIN32
+			struct _stat64 info;
+
+			if ( _stat64( path.c_str(), &info ) != 0 )
+			{
+				return false;
+			}
+#else
+			struct stat info;
+
+			if ( stat( path.c_str(), &info ) != 0 )
+			{
+				return false;
+			}
+#endif
+
+			stamp.size = uint64_t( info.st_size );
+#if defined( __linux__ )
+			// Nanoseconds, to see the modifications made within the same second.
+			stamp.time = int64_t( info.st_mtim.tv_sec ) * 1000000000ll + int64_t( info.st_mtim.tv_nsec );
+#else
+			stamp.time = int64_t( info.st_mtime );
+#endif
+			return true;
+		}
+
+		// FNV-1a, enough to detect a changed asset.
+		uint64_t doHashFile( std::string const & path )
+		{
+			uint64_t result = 0xcbf29ce484222325ull;
+			MappedFile file{ path };
+			auto data = file.getData();
+
+			for ( size_t i = 0u; i < file.getSize(); ++i )
+			{
+				result ^= data[i];
+				result *= 0x100000001b3ull;
+			}
+
+			return result;
+		}
+
+		class CacheReader
+		{
+		public:
+			explicit CacheReader( MappedFile const & file )
+				: m_file{ file }
+			{
+			}
+
+			template< typename T >
+			T const & read()
+			{
+				return *read< T >( 1u );
+			}
+
+			// The records are aligned, as they are written by doWrite.
+			template< typename T >
+			T const * read( size_t count )
+			{
+				m_offset = doGetAligned( m_offset, alignof( T ) );
+				auto result = at< T >( m_offset, count );
+				m_offset += sizeof( T ) * count;
+				return result;
+			}
+
+			template< typename T >
+			T const * at( uint64_t offset
+				, size_t count )const
+			{
+				if ( offset > m_file.getSize()
+					|| sizeof( T ) * count > m_file.getSize() - offset )
+				{
+					throw std::runtime_error{ "Truncated mesh cache" };
+				}
+
+				return reinterpret_cast< T const * >( m_file.getData() + offset );
+			}
+
+		private:
+			MappedFile const & m_file;
+			uint64_t m_offset{ 0u };
+		};
+
+		template< typename T >
+		size_t doWrite( renderer::ByteArray & data
+			, T const * value
+			, size_t count )
+		{
+			data.resize( size_t( doGetAligned( data.size(), alignof( T ) ) ) );
+			auto result = data.size();
+			auto bytes = reinterpret_cast< uint8_t const * >( value );
+			data.insert( data.end(), bytes, bytes + sizeof( T ) * count );
+			return result;
+		}
+
+		template< typename T >
+		size_t doWrite( renderer::ByteArray & data
+			, T const & value )
+		{
+			return doWrite( data, &value, 1u );
+		}
+
+		template< typename T >
+		void doPatch( renderer::ByteArray & data
+			, size_t offset
+			, T const & value )
+		{
+			std::memcpy( data.data() + offset, &value, sizeof( T ) );
+		}
+
+		uint64_t doAlign( renderer::ByteArray & data )
+		{
+			data.resize( size_t( doGetAligned( data.size(), CacheAlignment ) ) );
+			return data.size();
+		}
+
+		bool doReadCache( std::shared_ptr< MappedFile > file
+			, std::string const & sourceFile
+			, FileStamp const & sourceStamp
+			, float rescale
+			, Object & object
+			, ImagePtrArray & images
+			, bool & timeChanged )
+		{
+			CacheReader reader{ *file };
+			auto & header = reader.read< CacheHeader >();
+
+			if ( header.magic != CacheMagic
+				|| header.version != CacheVersion
+				|| header.rescale != rescale
+				|| header.sourceSize != sourceStamp.size )
+			{
+				return false;
+			}
+
+			// A different timestamp alone doesn't mean that the asset changed (copies, checkouts...).
+			timeChanged = header.sourceTime != sourceStamp.time;
+
+			if ( timeChanged
+				&& header.sourceHash != doHashFile( sourceFile ) )
+			{
+				return false;
+			}
+
+			for ( uint32_t i = 0u; i < header.imageCount; ++i )
+			{
+				auto & record = reader.read< ImageRecord >();
+				auto source = reader.read< char >( record.sourceLength );
+				auto image = std::make_shared< Image >();
+				image->source.assign( source, source + record.sourceLength );
+				FileStamp stamp;
+
+				if ( !doGetFileStamp( image->source, stamp )
+					|| stamp.size != record.fileSize
+					|| stamp.time != record.fileTime )
+				{
+					return false;
+				}
+
+				image->size = { record.width, record.height };
+				image->format = record.format;
+				image->opacity = record.opacity != 0u;
+				image->mapped = reader.at< uint8_t >( record.dataOffset, size_t( record.width ) * record.height * 4u );
+				image->file = file;
+				images.push_back( image );
+			}
+
+			for ( uint32_t i = 0u; i < header.submeshCount; ++i )
+			{
+				auto & record = reader.read< SubmeshRecord >();
+				Submesh submesh;
+				submesh.vbo.hasNormals = record.hasNormals != 0u;
+				submesh.vbo.mapped = reader.at< Vertex >( record.verticesOffset, record.vertexCount );
+				submesh.vbo.mappedCount = record.vertexCount;
+				submesh.vbo.file = file;
+				submesh.ibo.mapped = reader.at< Face >( record.facesOffset, record.faceCount );
+				submesh.ibo.mappedCount = record.faceCount;
+				submesh.ibo.file = file;
+
+				for ( uint32_t j = 0u; j < record.materialCount; ++j )
+				{
+					auto & materialRecord = reader.read< MaterialRecord >();
+					auto indices = reader.read< uint32_t >( materialRecord.textureCount );
+					Material material;
+					material.data = materialRecord.data;
+					material.hasOpacity = materialRecord.hasOpacity != 0u;
+
+					for ( uint32_t k = 0u; k < materialRecord.textureCount; ++k )
+					{
+						if ( indices[k] >= images.size() )
+						{
+							throw std::runtime_error{ "Invalid mesh cache image index" };
+						}
+
+						material.textures.push_back( images[indices[k]] );
+					}
+
+					submesh.materials.push_back( std::move( material ) );
+				}
+
+				object.emplace_back( std::move( submesh ) );
+			}
+
+			return true;
+		}
+
+		// Stores the new source timestamp, so that the next loads don't hash the source again.
+		void doUpdateSourceTime( std::string const & cacheFile
+			, int64_t sourceTime )
+		{
+			std::fstream file{ cacheFile, std::ios::binary | std::ios::in | std::ios::out };
+
+			if ( file )
+			{
+				file.seekp( offsetof( CacheHeader, sourceTime ) );
+				file.write( reinterpret_cast< char const * >( &sourceTime ), sizeof( sourceTime ) );
+			}
+
+			if ( !file )
+			{
+				std::clog << "Couldn't update mesh cache " << cacheFile << std::endl;
+			}
+		}
+	}
+
+#if RENDERLIB_WIN32
+
+	MappedFile::MappedFile( std::string const & path )
+	{
+		m_file = ::CreateFileA( path.c_str()
+			, GENERIC_READ
+			// The mesh cache header is updated while its content is mapped.
+			, FILE_SHARE_READ | FILE_SHARE_WRITE
+			, nullptr
+			, OPEN_EXISTING
+			, FILE_ATTRIBUTE_NORMAL
+			, nullptr );
+
+		if ( m_file == INVALID_HANDLE_VALUE )
+		{
+			m_file = nullptr;
+			throw std::runtime_error{ "Couldn't open " + path };
+		}
+
+		LARGE_INTEGER size;
+		::GetFileSizeEx( m_file, &size );
+		m_size = size_t( size.QuadPart );
+
+		if ( m_size )
+		{
+			m_mapping = ::CreateFileMappingA( m_file, nullptr, PAGE_READONLY, 0, 0, nullptr );
+			m_data = m_mapping
+				? static_cast< uint8_t const * >( ::MapViewOfFile( m_mapping, FILE_MAP_READ, 0, 0, 0 ) )
+				: nullptr;
+
+			if ( !m_data )
+			{
+				if ( m_mapping )
+				{
+					::CloseHandle( m_mapping );
+				}
+
+				::CloseHandle( m_file );
+				throw std::runtime_error{ "Couldn't map " + path };
+			}
+		}
+	}
+
+	MappedFile::~MappedFile()
+	{
+		if ( m_data )
+		{
+			::UnmapViewOfFile( m_data );
+			m_data = nullptr;
+		}
+
+		if ( m_mapping )
+		{
+			::CloseHandle( m_mapping );
+			m_mapping = nullptr;
+		}
+
+		if ( m_file )
+		{
+			::CloseHandle( m_file );
+			m_file = nullptr;
+		}
+	}
+
+#else
+
+	MappedFile::MappedFile( std::string const & path )
+	{
+		m_file = ::open( path.c_str(), O_RDONLY );
+
+		if ( m_file == -1 )
+		{
+			throw std::runtime_error{ "Couldn't open " + path };
+		}
+
+		struct stat info;
+		::fstat( m_file, &info );
+		m_size = size_t( info.st_size );
+
+		if ( m_size )
+		{
+			auto data = ::mmap( nullptr, m_size, PROT_READ, MAP_PRIVATE, m_file, 0 );
+
+			if ( data == MAP_FAILED )
+			{
+				::close( m_file );
+				throw std::runtime_error{ "Couldn't map " + path };
+			}
+
+			m_data = static_cast< uint8_t const * >( data );
+		}
+	}
+
+	MappedFile::~MappedFile()
+	{
+		if ( m_data )
+		{
+			::munmap( const_cast< uint8_t * >( m_data ), m_size );
+		}
+
+		::close( m_file );
+	}
+
+#endif
+
+	bool loadMeshCache( std::string const & cacheFile
+		, std::string const & sourceFile
+		, float rescale
+		, Object & object
+		, ImagePtrArray & images )
+	{
+		FileStamp sourceStamp;
+		FileStamp cacheStamp;
+
+		if ( !doGetFileStamp( sourceFile, sourceStamp )
+			|| !doGetFileStamp( cacheFile, cacheStamp ) )
+		{
+			return false;
+		}
+
+		try
+		{
+			Object cachedObject;
+			ImagePtrArray cachedImages;
+			bool timeChanged{ false };
+
+			if ( !doReadCache( std::make_shared< MappedFile >( cacheFile )
+				, sourceFile
+				, sourceStamp
+				, rescale
+				, cachedObject
+				, cachedImages
+				, timeChanged ) )
+			{
+				std::clog << "Mesh cache " << cacheFile << " is outdated" << std::endl;
+				return false;
+			}
+
+			if ( timeChanged )
+			{
+				doUpdateSourceTime( cacheFile, sourceStamp.time );
+			}
+
+			object = std::move( cachedObject );
+			images.insert( images.end(), cachedImages.begin(), cachedImages.end() );
+			std::clog << "Loaded mesh cache " << cacheFile << std::endl;
+			return true;
+		}
+		catch ( std::exception & exc )
+		{
+			std::clog << "Invalid mesh cache " << cacheFile << ": " << exc.what() << std::endl;
+			return false;
+		}
+	}
+
+	bool saveMeshCache( std::string const & cacheFile
+		, std::string const & sourceFile
+		, float rescale
+		, Object const & object
+		, ImagePtrArray const & images )
+	{
+		FileStamp sourceStamp;
+
+		if ( !doGetFileStamp( sourceFile, sourceStamp ) )
+		{
+			return false;
+		}
+
+		CacheHeader header
+		{
+			CacheMagic,
+			CacheVersion,
+			sourceStamp.size,
+			sourceStamp.time,
+			doHashFile( sourceFile ),
+			rescale,
+			0u,
+			uint32_t( object.size() ),
+			0u,
+		};
+		renderer::ByteArray data;
+		doWrite( data, header );
+		std::vector< std::pair< size_t, ImagePtr > > imageRecords;
+		std::map< Image const *, uint32_t > imageIndices;
+
+		for ( auto & image : images )
+		{
+			FileStamp stamp;
+
+			// Images without a source file can't be checked, hence the cache can't be used.
+			if ( !image
+				|| image->source.empty()
+				|| !doGetFileStamp( image->source, stamp ) )
+			{
+				continue;
+			}
+
+			ImageRecord record
+			{
+				stamp.size,
+				stamp.time,
+				0u,
+				image->size[0],
+				image->size[1],
+				image->format,
+				image->opacity ? 1u : 0u,
+				uint32_t( image->source.size() ),
+				0u,
+			};
+			imageIndices.emplace( image.get(), uint32_t( imageRecords.size() ) );
+			imageRecords.emplace_back( doWrite( data, record ), image );
+			doWrite( data, image->source.data(), image->source.size() );
+		}
+
+		header.imageCount = uint32_t( imageRecords.size() );
+		doPatch( data, 0u, header );
+		std::vector< size_t > submeshRecords;
+
+		for ( auto & submesh : object )
+		{
+			SubmeshRecord record
+			{
+				0u,
+				0u,
+				submesh.vbo.getCount(),
+				submesh.ibo.getCount(),
+				submesh.vbo.hasNormals ? 1u : 0u,
+				uint32_t( submesh.materials.size() ),
+			};
+			submeshRecords.push_back( doWrite( data, record ) );
+
+			for ( auto & material : submesh.materials )
+			{
+				std::vector< uint32_t > indices;
+
+				for ( auto & texture : material.textures )
+				{
+					auto it = imageIndices.find( texture.get() );
+
+					if ( it == imageIndices.end() )
+					{
+						std::clog << "Mesh cache not written, an image has no source file" << std::endl;
+						return false;
+					}
+
+					indices.push_back( it->second );
+				}
+
+				MaterialRecord materialRecord
+				{
+					material.data,
+					material.hasOpacity ? 1u : 0u,
+					uint32_t( indices.size() ),
+				};
+				doWrite( data, materialRecord );
+				doWrite( data, indices.data(), indices.size() );
+			}
+		}
+
+		// Then the bulk data, patching the records offsets.
+		for ( auto & imageRecord : imageRecords )
+		{
+			auto offset = doAlign( data );
+			doWrite( data, imageRecord.second->getData(), imageRecord.second->getSize() );
+			doPatch( data, imageRecord.first + offsetof( ImageRecord, dataOffset ), offset );
+		}
+
+		for ( size_t i = 0u; i < object.size(); ++i )
+		{
+			auto & submesh = object[i];
+			auto offset = doAlign( data );
+			doWrite( data, submesh.vbo.getData(), submesh.vbo.getCount() );
+			doPatch( data, submeshRecords[i] + offsetof( SubmeshRecord, verticesOffset ), offset );
+			offset = doAlign( data );
+			doWrite( data, submesh.ibo.getData(), submesh.ibo.getCount() );
+			doPatch( data, submeshRecords[i] + offsetof( SubmeshRecord, facesOffset ), offset );
+		}
+
+		// Written aside then renamed, so that an interrupted write doesn't leave a truncated cache.
+		auto tmpFile = cacheFile + ".tmp";
+		{
+			std::ofstream file{ tmpFile, std::ios::binary | std::ios::trunc };
+
+			if ( !file
+				|| !file.write( reinterpret_cast< char const * >( data.data() ), std::streamsize( data.size() ) ) )
+			{
+				std::clog << "Couldn't write the mesh cache " << cacheFile << std::endl;
+				return false;
+			}
+		}
+
+		std::remove( cacheFile.c_str() );
+
+		if ( std::rename( tmpFile.c_str(), cacheFile.c_str() ) != 0 )
+		{
+			std::remove( tmpFile.c_str() );
+			return false;
+		}
+
+		std::clog << "Wrote mesh cache " << cacheFile << std::endl;
+		return true;
+	}
+}
@@ -0,0 +1,140 @@
+/*
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "Prerequisites.hpp"
+
+namespace common
+{
+	/**
+	*\~english
+	*\brief
+	*	A file mapped read only in memory.
+	*\~french
+	*\brief
+	*	Un fichier mappé en lecture seule en mémoire.
+	*/
+	class MappedFile
+	{
+	public:
+		MappedFile( MappedFile const & ) = delete;
+		MappedFile & operator=( MappedFile const & ) = delete;
+		/**
+		*\~english
+		*\brief
+		*	Maps the whole file.
+		*\param[in] path
+		*	The file path.
+		*\~french
+		*\brief
+		*	Mappe tout le fichier.
+		*\param[in] path
+		*	Le chemin d'accès au fichier.
+		*/
+		explicit MappedFile( std::string const & path );
+		~MappedFile();
+
+		inline uint8_t const * getData()const
+		{
+			return m_data;
+		}
+
+		inline size_t getSize()const
+		{
+			return m_size;
+		}
+
+	private:
+		uint8_t const * m_data{ nullptr };
+		size_t m_size{ 0u };
+#if RENDERLIB_WIN32
+		void * m_file{ nullptr };
+		void * m_mapping{ nullptr };
+#else
+		int m_file{ -1 };
+#endif
+	};
+	/**
+	*\~english
+	*\brief
+	*	Loads an object from its mesh cache.
+	*\remarks
+	*	The cache is rejected when its version, the rescale factor, the source file
+	*	(size and timestamp, else content hash) or one of the images files differ.
+	*	The vertices, faces and pixels stay in the cache file mapping.
+	*\param[in] cacheFile
+	*	The cache file path.
+	*\param[in] sourceFile
+	*	The source asset file path.
+	*\param[in] rescale
+	*	The rescale factor given to loadObject.
+	*\param[out] object
+	*	Receives the object.
+	*\param[out] images
+	*	Receives the object's images.
+	*\return
+	*	\p false if the cache is missing or outdated.
+	*\~french
+	*\brief
+	*	Charge un objet depuis son cache de maillage.
+	*\remarks
+	*	Le cache est rejeté quand sa version, le facteur de redimensionnement, le fichier source
+	*	(taille et date, sinon hash du contenu) ou l'un des fichiers des images diffèrent.
+	*	Les sommets, faces et pixels restent dans le mapping du fichier de cache.
+	*\param[in] cacheFile
+	*	Le chemin d'accès au fichier de cache.
+	*\param[in] sourceFile
+	*	Le chemin d'accès au fichier source.
+	*\param[in] rescale
+	*	Le facteur de redimensionnement donné à loadObject.
+	*\param[out] object
+	*	Reçoit l'objet.
+	*\param[out] images
+	*	Reçoit les images de l'objet.
+	*\return
+	*	\p false si le cache est absent ou périmé.
+	*/
+	bool loadMeshCache( std::string const & cacheFile
+		, std::string const & sourceFile
+		, float rescale
+		, Object & object
+		, ImagePtrArray & images );
+	/**
+	*\~english
+	*\brief
+	*	Writes an object's mesh cache.
+	*\param[in] cacheFile
+	*	The cache file path.
+	*\param[in] sourceFile
+	*	The source asset file path.
+	*\param[in] rescale
+	*	The rescale factor given to loadObject.
+	*\param[in] object
+	*	The object.
+	*\param[in] images
+	*	The object's images.
+	*\return
+	*	\p false if the cache couldn't be written.
+	*\~french
+	*\brief
+	*	Ecrit le cache de maillage d'un objet.
+	*\param[in] cacheFile
+	*	Le chemin d'accès au fichier de cache.
+	*\param[in] sourceFile
+	*	Le chemin d'accès au fichier source.
+	*\param[in] rescale
+	*	Le facteur de redimensionnement donné à loadObject.
+	*\param[in] object
+	*	L'objet.
+	*\param[in] images
+	*	Les images de l'objet.
+	*\return
+	*	\p false si le cache n'a pas pu être écrit.
+	*/
+	bool saveMeshCache( std::string const & cacheFile
+		, std::string const & sourceFile
+		, float rescale
+		, Object const & object
+		, ImagePtrArray const & images );
+}
@@ -1,6 +1,8 @@
 #include "NodesRenderer.hpp"
 
+#include "Bvh.hpp"
 #include "FileUtils.hpp"
+#include "Profiler.hpp"
 #include "RenderTarget.hpp"
 #include "Scene.hpp"
 
@@ -16,7 +18,6 @@
 #include <Descriptor/DescriptorSetPool.hpp>
 #include <Image/Texture.hpp>
 #include <Image/TextureView.hpp>
-#include <Miscellaneous/QueryPool.hpp>
 #include <Pipeline/DepthStencilState.hpp>
 #include <Pipeline/InputAssemblyState.hpp>
 #include <Pipeline/MultisampleState.hpp>
@@ -206,6 +207,38 @@ namespace common
 
 			return result;
 		}
+
+		void addBillboardBounds( Billboard const & billboard
+			, BoundingSpheres & bounds )
+		{
+			auto min = billboard.list.front().offset;
+			auto max = min;
+			float extent = 0.0f;
+
+			for ( auto & instance : billboard.list )
+			{
+				for ( size_t i = 0u; i < 3u; ++i )
+				{
+					min[i] = std::min( min[i], instance.offset[i] );
+					max[i] = std::max( max[i], instance.offset[i] );
+				}
+
+				extent = std::max( extent, std::max( instance.dimensions[0], instance.dimensions[1] ) );
+			}
+
+			renderer::Vec3 centre{ ( min[0] + max[0] ) / 2.0f
+				, ( min[1] + max[1] ) / 2.0f
+				, ( min[2] + max[2] ) / 2.0f };
+			float radius = 0.0f;
+
+			for ( auto & instance : billboard.list )
+			{
+				radius = std::max( radius, utils::distance( centre, instance.offset ) );
+			}
+
+			// A billboard quad fits in a sphere of half its diagonal.
+			bounds.add( centre, radius + extent * 0.5f * std::sqrt( 2.0f ) );
+		}
 	}
 
 	NodesRenderer::NodesRenderer( renderer::Device const & device
@@ -223,8 +256,27 @@ namespace common
 			, renderer::Filter::eLinear ) }
 		, m_updateCommandBuffer{ m_device.getGraphicsCommandPool().createCommandBuffer() }
 		, m_commandBuffer{ m_device.getGraphicsCommandPool().createCommandBuffer() }
+		, m_fence{ m_device.createFence( renderer::FenceCreateFlag::eSignaled ) }
 		, m_renderPass{ doCreateRenderPass( m_device, formats, clearViews ) }
-		, m_queryPool{ m_device.createQueryPool( renderer::QueryType::eTimestamp, 2u, 0u ) }
+	{
+	}
+
+	NodesRenderer::NodesRenderer( renderer::Device const & device
+		, std::string const & fragmentShaderFile
+		, renderer::RenderPassPtr && renderPass
+		, bool opaqueNodes )
+		: m_device{ device }
+		, m_opaqueNodes{ opaqueNodes }
+		, m_fragmentShaderFile{ fragmentShaderFile }
+		, m_sampler{ m_device.createSampler( renderer::WrapMode::eClampToEdge
+			, renderer::WrapMode::eClampToEdge
+			, renderer::WrapMode::eClampToEdge
+			, renderer::Filter::eLinear
+			, renderer::Filter::eLinear ) }
+		, m_updateCommandBuffer{ m_device.getGraphicsCommandPool().createCommandBuffer() }
+		, m_commandBuffer{ m_device.getGraphicsCommandPool().createCommandBuffer() }
+		, m_fence{ m_device.createFence( renderer::FenceCreateFlag::eSignaled ) }
+		, m_renderPass{ std::move( renderPass ) }
 	{
 	}
 
@@ -233,22 +285,42 @@ namespace common
 		doUpdate( { target.getDepthView(), target.getColourView() } );
 	}
 
-	bool NodesRenderer::draw( std::chrono::nanoseconds & gpu )const
+	void NodesRenderer::cull()
 	{
-		bool result = m_device.getGraphicsQueue().submit( *m_commandBuffer, nullptr );
+		renderer::Mat4 viewProjection;
+		renderer::Mat4 model;
 
-		if ( result )
+		if ( m_size == renderer::UIVec2{}
+			|| !doGetCullingMatrices( viewProjection, model ) )
 		{
-			renderer::UInt32Array values{ 0u, 0u };
-			m_queryPool->getResults( 0u
-				, 2u
-				, 0u
-				, renderer::QueryResultFlag::eWait
-				, values );
-			gpu = std::chrono::nanoseconds{ uint64_t( ( values[1] - values[0] ) / float( m_device.getTimestampPeriod() ) ) };
+			return;
 		}
 
-		return result;
+		auto submeshVisibility = m_submeshVisibility;
+		auto billboardVisibility = m_billboardVisibility;
+		// The submeshes are expressed in model space, the billboards in world space.
+		m_submeshBvh.query( Frustum{ viewProjection * model }
+			, m_submeshVisibility );
+		common::cull( Frustum{ viewProjection }
+			, m_billboardBounds
+			, m_billboardVisibility );
+
+		if ( submeshVisibility != m_submeshVisibility
+			|| billboardVisibility != m_billboardVisibility )
+		{
+			doRecordCommandBuffer();
+		}
+	}
+
+	bool NodesRenderer::draw( Profiler & profiler )const
+	{
+		// The fence can't be reset while the previous submission is pending.
+		m_fence->wait( renderer::FenceTimeout );
+		m_fence->reset();
+		return profiler.submit( m_device.getGraphicsQueue()
+			, *m_commandBuffer
+			, m_opaqueNodes ? "Opaque nodes" : "Transparent nodes"
+			, m_fence.get() );
 	}
 
 	void NodesRenderer::initialise( Scene const & scene
@@ -267,6 +339,7 @@ namespace common
 			, stagingBuffer
 			, textureNodes
 			, matIndex );
+		m_submeshBvh.build( m_submeshBounds );
 		doInitialiseBillboard( scene.billboard
 			, stagingBuffer
 			, textureNodes
@@ -294,7 +367,7 @@ namespace common
 			m_views.clear();
 			static renderer::RgbaColour const colour{ 1.0f, 0.8f, 0.4f, 0.0f };
 			static renderer::DepthStencilClearValue const depth{ 1.0, 0 };
-			renderer::ClearValueArray clearValues;
+			m_clearValues.clear();
 
 			for ( auto & view : views )
 			{
@@ -302,76 +375,90 @@ namespace common
 
 				if ( !renderer::isDepthOrStencilFormat( view.get().getFormat() ) )
 				{
-					clearValues.emplace_back( colour );
+					m_clearValues.emplace_back( colour );
 				}
 				else
 				{
-					clearValues.emplace_back( depth );
+					m_clearValues.emplace_back( depth );
 				}
 			}
 
 			m_frameBuffer = doCreateFrameBuffer( *m_renderPass, views );
-			m_commandBuffer->reset();
-			auto & commandBuffer = *m_commandBuffer;
+			doRecordCommandBuffer();
+		}
+	}
 
-			if ( commandBuffer.begin( renderer::CommandBufferUsageFlag::eSimultaneousUse ) )
+	void NodesRenderer::doRecordCommandBuffer()
+	{
+		auto & size = m_size;
+		// The command buffer may still be pending, from the previous draw().
+		m_fence->wait( renderer::FenceTimeout );
+		m_commandBuffer->reset();
+		auto & commandBuffer = *m_commandBuffer;
+
+		if ( commandBuffer.begin( renderer::CommandBufferUsageFlag::eSimultaneousUse ) )
+		{
+			commandBuffer.beginRenderPass( *m_renderPass
+				, *m_frameBuffer
+				, m_clearValues
+				, renderer::SubpassContents::eInline );
+
+			for ( size_t i = 0u; i < m_submeshRenderNodes.size(); ++i )
 			{
-				commandBuffer.resetQueryPool( *m_queryPool, 0u, 2u );
-				commandBuffer.writeTimestamp( renderer::PipelineStageFlag::eTopOfPipe
-					, *m_queryPool
-					, 0u );
-				commandBuffer.beginRenderPass( *m_renderPass
-					, *m_frameBuffer
-					, clearValues
-					, renderer::SubpassContents::eInline );
-
-				for ( auto & node : m_submeshRenderNodes )
+				if ( !m_submeshVisibility.empty() && !m_submeshVisibility[i] )
 				{
-					commandBuffer.bindPipeline( *node.pipeline );
-					commandBuffer.setViewport( { size[0]
-						, size[1]
-						, 0
-						, 0 } );
-					commandBuffer.setScissor( { 0
-						, 0
-						, size[0]
-						, size[1] } );
-					m_commandBuffer->bindVertexBuffer( 0u, node.instance->vbo->getBuffer(), 0u );
-					m_commandBuffer->bindIndexBuffer( node.instance->ibo->getBuffer(), 0u, renderer::IndexType::eUInt32 );
-					commandBuffer.bindDescriptorSet( *node.descriptorSetUbos
-						, *node.pipelineLayout );
-					commandBuffer.bindDescriptorSet( *node.descriptorSetTextures
-						, *node.pipelineLayout );
-					commandBuffer.drawIndexed( node.instance->ibo->getCount() * 3u );
+					continue;
 				}
 
-				for ( BillboardMaterialNode & node : m_billboardRenderNodes )
+				auto & node = m_submeshRenderNodes[i];
+				commandBuffer.bindPipeline( *node.pipeline );
+				commandBuffer.setViewport( { size[0]
+					, size[1]
+					, 0
+					, 0 } );
+				commandBuffer.setScissor( { 0
+					, 0
+					, size[0]
+					, size[1] } );
+				m_commandBuffer->bindVertexBuffer( 0u, node.instance->vbo->getBuffer(), 0u );
+				m_commandBuffer->bindIndexBuffer( node.instance->ibo->getBuffer(), 0u, renderer::IndexType::eUInt32 );
+				commandBuffer.bindDescriptorSet( *node.descriptorSetUbos
+					, *node.pipelineLayout );
+				commandBuffer.bindDescriptorSet( *node.descriptorSetTextures
+					, *node.pipelineLayout );
+				commandBuffer.drawIndexed( node.instance->ibo->getCount() * 3u );
+			}
+
+			for ( size_t i = 0u; i < m_billboardRenderNodes.size(); ++i )
+			{
+				if ( !m_billboardVisibility.empty() && !m_billboardVisibility[i] )
 				{
-					commandBuffer.bindPipeline( *node.pipeline );
-					commandBuffer.setViewport( { size[0]
-						, size[1]
-						, 0
-						, 0 } );
-					commandBuffer.setScissor( { 0
-						, 0
-						, size[0]
-						, size[1] } );
-					m_commandBuffer->bindVertexBuffers( 0u
-						, { node.instance->vbo->getBuffer(), node.instance->instance->getBuffer() }
-						, { 0u, 0u } );
-					commandBuffer.bindDescriptorSet( *node.descriptorSetUbos
-						, *node.pipelineLayout );
-					commandBuffer.bindDescriptorSet( *node.descriptorSetTextures
-						, *node.pipelineLayout );
-					commandBuffer.draw( 4u, node.instance->instance->getCount() );
+					continue;
 				}
 
-				commandBuffer.endRenderPass();
-				commandBuffer.writeTimestamp( renderer::PipelineStageFlag::eBottomOfPipe
-					, *m_queryPool
-					, 1u );
-				commandBuffer.end();
+				auto & node = m_billboardRenderNodes[i];
+				commandBuffer.bindPipeline( *node.pipeline );
+				commandBuffer.setViewport( { size[0]
+					, size[1]
+					, 0
+					, 0 } );
+				commandBuffer.setScissor( { 0
+					, 0
+					, size[0]
+					, size[1] } );
+				m_commandBuffer->bindVertexBuffers( 0u
+					, { node.instance->vbo->getBuffer(), node.instance->instance->getBuffer() }
+					, { 0u, 0u } );
+				commandBuffer.bindDescriptorSet( *node.descriptorSetUbos
+					, *node.pipelineLayout );
+				commandBuffer.bindDescriptorSet( *node.descriptorSetTextures
+					, *node.pipelineLayout );
+				commandBuffer.draw( 4u, node.instance->instance->getCount() );
 			}
+
+			doRecordNextSubpasses( commandBuffer );
+			commandBuffer.endRenderPass();
+			commandBuffer.end();
 		}
 	}
 
@@ -491,12 +578,9 @@ namespace common
 
 				renderer::ColourBlendState blendState;
 
-				for ( auto & attach : *m_renderPass )
+				for ( auto & attach : m_renderPass->getSubpasses()[0]->getColourAttaches() )
 				{
-					if ( !renderer::isDepthOrStencilFormat( attach.format ) )
-					{
-						blendState.addAttachment( renderer::ColourBlendStateAttachment{} );
-					}
+					blendState.addAttachment( renderer::ColourBlendStateAttachment{} );
 				}
 
 				materialNode.pipeline = materialNode.pipelineLayout->createPipeline( 
@@ -511,6 +595,7 @@ namespace common
 					renderer::DepthStencilState{}
 				} );
 				m_billboardRenderNodes.emplace_back( std::move( materialNode ) );
+				addBillboardBounds( billboard, m_billboardBounds );
 				++matIndex;
 			}
 		}
@@ -556,19 +641,21 @@ namespace common
 
 				// Initialise geometry buffers.
 				submeshNode->vbo = renderer::makeVertexBuffer< common::Vertex >( m_device
-					, uint32_t( submesh.vbo.data.size() )
+					, submesh.vbo.getCount()
 					, renderer::BufferTarget::eTransferDst
 					, renderer::MemoryPropertyFlag::eDeviceLocal );
 				stagingBuffer.uploadVertexData( *m_updateCommandBuffer
-					, submesh.vbo.data
+					, reinterpret_cast< uint8_t const * >( submesh.vbo.getData() )
+					, uint32_t( submesh.vbo.getCount() * sizeof( common::Vertex ) )
 					, *submeshNode->vbo
 					, renderer::PipelineStageFlag::eVertexInput );
 				submeshNode->ibo = renderer::makeBuffer< common::Face >( m_device
-					, uint32_t( submesh.ibo.data.size() )
+					, submesh.ibo.getCount()
 					, renderer::BufferTarget::eTransferDst
 					, renderer::MemoryPropertyFlag::eDeviceLocal );
 				stagingBuffer.uploadBufferData( *m_updateCommandBuffer
-					, submesh.ibo.data
+					, reinterpret_cast< uint8_t const * >( submesh.ibo.getData() )
+					, uint32_t( submesh.ibo.getCount() * sizeof( common::Face ) )
 					, *submeshNode->ibo );
 
 				for ( auto & material : compatibleMaterials )
@@ -641,12 +728,9 @@ namespace common
 
 					renderer::ColourBlendState blendState;
 
-					for ( auto & attach : *m_renderPass )
+					for ( auto & attach : m_renderPass->getSubpasses()[0]->getColourAttaches() )
 					{
-						if ( !renderer::isDepthOrStencilFormat( attach.format ) )
-						{
-							blendState.addAttachment( renderer::ColourBlendStateAttachment{} );
-						}
+						blendState.addAttachment( renderer::ColourBlendStateAttachment{} );
 					}
 
 					materialNode.pipeline = materialNode.pipelineLayout->createPipeline(
@@ -661,6 +745,7 @@ namespace common
 						renderer::DepthStencilState{}
 					} );
 					m_submeshRenderNodes.emplace_back( std::move( materialNode ) );
+					m_submeshBounds.push_back( getBoundingBox( submesh.vbo ) );
 					++matIndex;
 				}
 			}
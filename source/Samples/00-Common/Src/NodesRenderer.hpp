@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Prerequisites.hpp"
+#include "Bvh.hpp"
 
 #include <Buffer/UniformBuffer.hpp>
 #include <Command/CommandBuffer.hpp>
@@ -8,13 +9,13 @@
 #include <Descriptor/DescriptorSetLayout.hpp>
 #include <Descriptor/DescriptorSetPool.hpp>
 #include <Image/Sampler.hpp>
-#include <Miscellaneous/QueryPool.hpp>
 #include <Pipeline/Pipeline.hpp>
 #include <Pipeline/PipelineLayout.hpp>
 #include <RenderPass/RenderPass.hpp>
 #include <RenderPass/FrameBuffer.hpp>
 #include <RenderPass/RenderPass.hpp>
 #include <Shader/ShaderProgram.hpp>
+#include <Sync/Fence.hpp>
 
 namespace common
 {
@@ -26,9 +27,26 @@ namespace common
 			, std::vector< renderer::PixelFormat > const & formats
 			, bool clearViews
 			, bool opaqueNodes );
+		/**
+		*\~english
+		*\brief
+		*	Constructor from a render pass, where the nodes are drawn in the first subpass.
+		*\remarks
+		*	The following subpasses are recorded by doRecordNextSubpasses().
+		*\~french
+		*\brief
+		*	Constructeur à partir d'une passe de rendu, où les noeuds sont dessinés dans la première sous-passe.
+		*\remarks
+		*	Les sous-passes suivantes sont enregistrées par doRecordNextSubpasses().
+		*/
+		NodesRenderer( renderer::Device const & device
+			, std::string const & fragmentShaderFile
+			, renderer::RenderPassPtr && renderPass
+			, bool opaqueNodes );
 		virtual ~NodesRenderer() = default;
 		virtual void update( RenderTarget const & target );
-		bool draw( std::chrono::nanoseconds & gpu )const;
+		void cull();
+		bool draw( Profiler & profiler )const;
 		void initialise( Scene const & scene
 			, renderer::StagingBuffer & stagingBuffer
 			, renderer::TextureViewCRefArray const & views
@@ -41,6 +59,7 @@ namespace common
 
 	protected:
 		void doUpdate( renderer::TextureViewCRefArray const & views );
+		void doRecordCommandBuffer();
 
 	private:
 		void doInitialiseObject( Object const & object
@@ -69,6 +88,42 @@ namespace common
 			, renderer::DescriptorSet & descriptorSet )
 		{
 		}
+		/**
+		*\~english
+		*\brief
+		*	Retrieves the matrices used to cull the nodes.
+		*\param[out] viewProjection
+		*	Receives the view projection matrix, used for the billboards.
+		*\param[out] model
+		*	Receives the submeshes model matrix.
+		*\return
+		*	\p false if the nodes must not be culled.
+		*\~french
+		*\brief
+		*	Récupère les matrices utilisées pour le culling des noeuds.
+		*\param[out] viewProjection
+		*	Reçoit la matrice vue projection, utilisée pour les billboards.
+		*\param[out] model
+		*	Reçoit la matrice modèle des sous-maillages.
+		*\return
+		*	\p false si les noeuds ne doivent pas être cullés.
+		*/
+		virtual bool doGetCullingMatrices( renderer::Mat4 & viewProjection
+			, renderer::Mat4 & model )const
+		{
+			return false;
+		}
+		/**
+		*\~english
+		*\brief
+		*	Records the subpasses following the nodes one, before the render pass end.
+		*\~french
+		*\brief
+		*	Enregistre les sous-passes suivant celle des noeuds, avant la fin de la passe de rendu.
+		*/
+		virtual void doRecordNextSubpasses( renderer::CommandBuffer const & commandBuffer )const
+		{
+		}
 
 	protected:
 		renderer::Device const & m_device;
@@ -79,6 +134,8 @@ namespace common
 		renderer::SamplerPtr m_sampler;
 		renderer::CommandBufferPtr m_updateCommandBuffer;
 		renderer::CommandBufferPtr m_commandBuffer;
+		//! Signalled when the last submission of m_commandBuffer is executed.
+		renderer::FencePtr m_fence;
 		renderer::UniformBufferPtr< MaterialData > m_materialsUbo;
 
 		renderer::DescriptorSetLayoutPtr m_objectDescriptorLayout;
@@ -92,11 +149,16 @@ namespace common
 
 		renderer::RenderPassPtr m_renderPass;
 		renderer::FrameBufferPtr m_frameBuffer;
-		renderer::QueryPoolPtr m_queryPool;
+		renderer::ClearValueArray m_clearValues;
 		SubmeshNodes m_submeshNodes;
 		ObjectNodes m_submeshRenderNodes;
 		BillboardNodes m_billboardNodes;
 		BillboardListNodes m_billboardRenderNodes;
+		std::vector< BoundingBox > m_submeshBounds;
+		Bvh m_submeshBvh;
+		BoundingSpheres m_billboardBounds;
+		std::vector< uint8_t > m_submeshVisibility;
+		std::vector< uint8_t > m_billboardVisibility;
 		uint32_t m_objectsCount;
 		uint32_t m_billboardsCount;
 	};
@@ -25,8 +25,13 @@ namespace common
 		m_renderer->update( target );
 	}
 
-	bool OpaqueRendering::draw( std::chrono::nanoseconds & gpu )const
+	void OpaqueRendering::cull()
 	{
-		return m_renderer->draw( gpu );
+		m_renderer->cull();
+	}
+
+	bool OpaqueRendering::draw( Profiler & profiler )const
+	{
+		return m_renderer->draw( profiler );
 	}
 }
@@ -14,7 +14,8 @@ namespace common
 			, common::TextureNodePtrArray const & textureNodes );
 		virtual ~OpaqueRendering() = default;
 		virtual void update( RenderTarget const & target );
-		virtual bool draw( std::chrono::nanoseconds & gpu )const;
+		virtual void cull();
+		virtual bool draw( Profiler & profiler )const;
 
 	protected:
 		NodesRendererPtr m_renderer;
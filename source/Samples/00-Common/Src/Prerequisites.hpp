@@ -27,6 +27,7 @@ namespace common
 
 	static uint32_t constexpr MAX_TEXTURES = 6u;
 	static uint32_t constexpr MAX_LIGHTS = 10u;
+	static uint32_t constexpr TEXTURES_MIP_LEVELS = 4u;
 
 	struct NonTexturedVertex2DData
 	{
@@ -64,12 +65,37 @@ namespace common
 	*\name Données chargées.
 	*/
 	/**\{*/
+	class MappedFile;
+	using MappedFilePtr = std::shared_ptr< MappedFile >;
+
 	struct Image
 	{
 		renderer::UIVec2 size;
 		renderer::ByteArray data;
 		renderer::PixelFormat format;
 		bool opacity{ false };
+		// The file the image was loaded from.
+		std::string source;
+		// When read from a mesh cache, the pixels stay in the cache file mapping, and data is empty.
+		uint8_t const * mapped{ nullptr };
+		MappedFilePtr file;
+		// The levels following the first one, generated on the CPU by the ImageLoader.
+		// When empty, the GPU generates them.
+		std::vector< renderer::ByteArray > mips;
+
+		inline uint8_t const * getData()const
+		{
+			return mapped
+				? mapped
+				: data.data();
+		}
+
+		inline uint32_t getSize()const
+		{
+			return mapped
+				? size[0] * size[1] * 4u
+				: uint32_t( data.size() );
+		}
 	};
 
 	using ImagePtr = std::shared_ptr< Image >;
@@ -119,6 +145,24 @@ namespace common
 	{
 		std::vector< Vertex > data;
 		bool hasNormals{ false }; // true implies that it will also have tangents and bitangents
+		// When read from a mesh cache, the vertices stay in the cache file mapping, and data is empty.
+		Vertex const * mapped{ nullptr };
+		uint32_t mappedCount{ 0u };
+		MappedFilePtr file;
+
+		inline Vertex const * getData()const
+		{
+			return mapped
+				? mapped
+				: data.data();
+		}
+
+		inline uint32_t getCount()const
+		{
+			return mapped
+				? mappedCount
+				: uint32_t( data.size() );
+		}
 	};
 
 	struct Face
@@ -131,6 +175,24 @@ namespace common
 	struct IndexBuffer
 	{
 		std::vector< Face > data;
+		// When read from a mesh cache, the faces stay in the cache file mapping, and data is empty.
+		Face const * mapped{ nullptr };
+		uint32_t mappedCount{ 0u };
+		MappedFilePtr file;
+
+		inline Face const * getData()const
+		{
+			return mapped
+				? mapped
+				: data.data();
+		}
+
+		inline uint32_t getCount()const
+		{
+			return mapped
+				? mappedCount
+				: uint32_t( data.size() );
+		}
 	};
 
 	struct Submesh
@@ -254,6 +316,7 @@ namespace common
 	class MainFrame;
 	class NodesRenderer;
 	class OpaqueRendering;
+	class Profiler;
 	class RenderPanel;
 	class RenderTarget;
 	class TransparentRendering;
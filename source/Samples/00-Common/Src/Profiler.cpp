@@ -0,0 +1,406 @@
+#include "Profiler.hpp"
+
+#include <Command/CommandPool.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+namespace common
+{
+	namespace
+	{
+		std::string doEscape( std::string const & value )
+		{
+			std::string result;
+
+			for ( auto c : value )
+			{
+				if ( c == '"' || c == '\\' )
+				{
+					result += '\\';
+				}
+
+				result += c;
+			}
+
+			return result;
+		}
+
+		void doWriteEvent( std::ofstream & file
+			, ProfileFrame const & frame
+			, ProfileScope const & scope )
+		{
+			auto begin = std::chrono::duration< double, std::micro >( frame.start + scope.begin ).count();
+			auto duration = std::chrono::duration< double, std::micro >( scope.end - scope.begin ).count();
+			file << ",\n{\"name\":\"" << doEscape( scope.name ) << "\""
+				<< ",\"cat\":\"" << ( scope.gpu ? "gpu" : "cpu" ) << "\""
+				<< ",\"ph\":\"X\""
+				<< ",\"ts\":" << begin
+				<< ",\"dur\":" << duration
+				<< ",\"pid\":1"
+				<< ",\"tid\":" << ( scope.gpu ? 2 : 1 )
+				<< ",\"args\":{\"frame\":" << frame.index << "}}";
+		}
+	}
+
+	Profiler::Profiler( renderer::Device const & device
+		, uint32_t maxGpuScopes )
+		: m_device{ device }
+		, m_maxGpuScopes{ maxGpuScopes }
+		, m_start{ renderer::Clock::now() }
+	{
+		for ( auto & frame : m_frames )
+		{
+			frame.queryPool = m_device.createQueryPool( renderer::QueryType::eTimestamp
+				, 2u * m_maxGpuScopes
+				, 0u );
+			frame.resetCommandBuffer = m_device.getGraphicsCommandPool().createCommandBuffer();
+			auto & commandBuffer = *frame.resetCommandBuffer;
+
+			if ( !commandBuffer.begin( renderer::CommandBufferUsageFlag::eSimultaneousUse ) )
+			{
+				throw std::runtime_error{ "Couldn't record the profiler queries reset." };
+			}
+
+			commandBuffer.resetQueryPool( *frame.queryPool
+				, 0u
+				, 2u * m_maxGpuScopes );
+			commandBuffer.end();
+
+			// Empty, its submission only orders the fence signal after the frame's command buffers.
+			frame.endCommandBuffer = m_device.getGraphicsCommandPool().createCommandBuffer();
+
+			if ( !frame.endCommandBuffer->begin( renderer::CommandBufferUsageFlag::eSimultaneousUse ) )
+			{
+				throw std::runtime_error{ "Couldn't record the profiler frame end." };
+			}
+
+			frame.endCommandBuffer->end();
+			frame.fence = m_device.createFence();
+		}
+	}
+
+	void Profiler::beginFrame()
+	{
+		if ( m_inFrame )
+		{
+			endFrame();
+		}
+
+		m_frame = ( m_frame + 1u ) % FrameCount;
+		auto & frame = m_frames[m_frame];
+
+		if ( frame.pending )
+		{
+			// The frame was submitted FrameCount frames ago, the wait hence seldom blocks.
+			frame.fence->wait( renderer::FenceTimeout );
+			frame.fence->reset();
+			doResolve( frame );
+		}
+
+		m_device.getGraphicsQueue().submit( *frame.resetCommandBuffer, nullptr );
+		frame.scopes.clear();
+		frame.index = m_frameIndex++;
+		frame.start = renderer::Clock::now();
+		frame.gpuStart = std::chrono::nanoseconds{ 0 };
+		frame.gpuCount = 0u;
+		m_inFrame = true;
+		beginCpuScope( "Frame" );
+	}
+
+	void Profiler::endFrame()
+	{
+		if ( !m_inFrame )
+		{
+			return;
+		}
+
+		assert( m_openScopes.size() == 1u && "Unbalanced profiler scopes." );
+
+		while ( !m_openScopes.empty() )
+		{
+			endCpuScope();
+		}
+
+		auto & frame = m_frames[m_frame];
+		frame.pending = m_device.getGraphicsQueue().submit( *frame.endCommandBuffer
+			, frame.fence.get() );
+		m_inFrame = false;
+	}
+
+	void Profiler::beginCpuScope( std::string const & name )
+	{
+		if ( m_inFrame )
+		{
+			auto & frame = m_frames[m_frame];
+			doOpenScope( name, false );
+			frame.scopes.back().scope.begin = doGetTime( frame );
+		}
+	}
+
+	void Profiler::endCpuScope()
+	{
+		if ( m_inFrame )
+		{
+			auto & frame = m_frames[m_frame];
+			frame.scopes[m_openScopes.back()].scope.end = doGetTime( frame );
+			doCloseScope( false );
+		}
+	}
+
+	void Profiler::beginGpuScope( renderer::CommandBuffer const & commandBuffer
+		, std::string const & name )
+	{
+		if ( m_inFrame )
+		{
+			auto & frame = m_frames[m_frame];
+			auto query = doOpenScope( name, true );
+
+			if ( query != ~0u )
+			{
+				commandBuffer.writeTimestamp( renderer::PipelineStageFlag::eTopOfPipe
+					, *frame.queryPool
+					, 2u * query );
+			}
+		}
+	}
+
+	void Profiler::endGpuScope( renderer::CommandBuffer const & commandBuffer )
+	{
+		if ( m_inFrame )
+		{
+			auto & frame = m_frames[m_frame];
+			auto query = frame.scopes[m_openScopes.back()].query;
+
+			if ( query != ~0u )
+			{
+				commandBuffer.writeTimestamp( renderer::PipelineStageFlag::eBottomOfPipe
+					, *frame.queryPool
+					, 2u * query + 1u );
+			}
+
+			doCloseScope( true );
+		}
+	}
+
+	bool Profiler::submit( renderer::Queue const & queue
+		, renderer::CommandBuffer const & commandBuffer
+		, std::string const & name
+		, renderer::Fence const * fence )
+	{
+		if ( !m_inFrame )
+		{
+			return queue.submit( commandBuffer, fence );
+		}
+
+		auto & frame = m_frames[m_frame];
+		auto query = doOpenScope( name, true );
+
+		if ( query == ~0u )
+		{
+			doCloseScope( true );
+			return queue.submit( commandBuffer, fence );
+		}
+
+		if ( frame.submitCommandBuffers.size() <= query )
+		{
+			frame.submitCommandBuffers.resize( query + 1u );
+		}
+
+		auto & timestamps = frame.submitCommandBuffers[query];
+
+		if ( !timestamps.first )
+		{
+			// The query index of a slot never changes, the timestamps are hence recorded once.
+			timestamps.first = m_device.getGraphicsCommandPool().createCommandBuffer();
+			timestamps.second = m_device.getGraphicsCommandPool().createCommandBuffer();
+
+			if ( timestamps.first->begin( renderer::CommandBufferUsageFlag::eSimultaneousUse ) )
+			{
+				timestamps.first->writeTimestamp( renderer::PipelineStageFlag::eTopOfPipe
+					, *frame.queryPool
+					, 2u * query );
+				timestamps.first->end();
+			}
+
+			if ( timestamps.second->begin( renderer::CommandBufferUsageFlag::eSimultaneousUse ) )
+			{
+				timestamps.second->writeTimestamp( renderer::PipelineStageFlag::eBottomOfPipe
+					, *frame.queryPool
+					, 2u * query + 1u );
+				timestamps.second->end();
+			}
+		}
+
+		auto result = queue.submit( { *timestamps.first, commandBuffer, *timestamps.second }
+			, renderer::SemaphoreCRefArray{}
+			, renderer::PipelineStageFlagsArray{}
+			, renderer::SemaphoreCRefArray{}
+			, fence );
+		doCloseScope( true );
+		return result;
+	}
+
+	std::chrono::nanoseconds Profiler::getGpuTime( std::string const & name )const
+	{
+		std::chrono::nanoseconds result{ 0 };
+
+		if ( auto frame = getLastFrame() )
+		{
+			for ( auto & scope : frame->scopes )
+			{
+				if ( scope.gpu && scope.name == name )
+				{
+					result += scope.end - scope.begin;
+				}
+			}
+		}
+
+		return result;
+	}
+
+	bool Profiler::writeChromeTrace( std::string const & path )const
+	{
+		std::ofstream file{ path };
+
+		if ( !file )
+		{
+			return false;
+		}
+
+		file << std::fixed << std::setprecision( 3 );
+		file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":["
+			<< "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"CPU\"}}"
+			<< ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":2,\"args\":{\"name\":\"GPU\"}}";
+		for ( auto & frame : m_history )
+		{
+			for ( auto & scope : frame.scopes )
+			{
+				doWriteEvent( file, frame, scope );
+			}
+		}
+
+		file << "\n]}\n";
+		return bool( file );
+	}
+
+	std::chrono::nanoseconds Profiler::doGetTime( Frame const & frame )const
+	{
+		return std::chrono::duration_cast< std::chrono::nanoseconds >( renderer::Clock::now() - frame.start );
+	}
+
+	uint32_t Profiler::doOpenScope( std::string const & name
+		, bool gpu )
+	{
+		auto & frame = m_frames[m_frame];
+		PendingScope pending
+		{
+			{ name, uint32_t( m_openScopes.size() ), gpu, std::chrono::nanoseconds{ 0 }, std::chrono::nanoseconds{ 0 } },
+			~0u,
+		};
+
+		if ( gpu && frame.gpuCount < m_maxGpuScopes )
+		{
+			if ( !frame.gpuCount )
+			{
+				frame.gpuStart = doGetTime( frame );
+			}
+
+			pending.query = frame.gpuCount++;
+		}
+
+		m_openScopes.push_back( frame.scopes.size() );
+		frame.scopes.push_back( std::move( pending ) );
+		return frame.scopes.back().query;
+	}
+
+	void Profiler::doCloseScope( bool gpu )
+	{
+		assert( !m_openScopes.empty() && "No profiler scope to close." );
+		assert( m_frames[m_frame].scopes[m_openScopes.back()].scope.gpu == gpu && "Mismatched profiler scope." );
+		m_openScopes.pop_back();
+	}
+
+	void Profiler::doResolve( Frame & frame )
+	{
+		frame.pending = false;
+		ProfileFrame resolved
+		{
+			frame.index,
+			std::chrono::duration_cast< std::chrono::nanoseconds >( frame.start - m_start ),
+			std::chrono::nanoseconds{ 0 },
+			{},
+		};
+		// Each timestamp is followed by its availability, the read never blocks.
+		renderer::UInt64Array results( 4u * frame.gpuCount, 0u );
+
+		if ( frame.gpuCount )
+		{
+			frame.queryPool->getResults( 0u
+				, 2u * frame.gpuCount
+				, 2u * sizeof( uint64_t )
+				, renderer::QueryResultFlag::eWithAvailability
+				, results );
+		}
+
+		auto isAvailable = [&results]( uint32_t query )
+		{
+			return results[4u * query + 1u] != 0u
+				&& results[4u * query + 3u] != 0u;
+		};
+		auto gpuBase = ~uint64_t( 0u );
+
+		for ( uint32_t query = 0u; query < frame.gpuCount; ++query )
+		{
+			if ( isAvailable( query ) )
+			{
+				gpuBase = std::min( gpuBase, results[4u * query] );
+			}
+		}
+
+		auto period = double( m_device.getTimestampPeriod() );
+		auto toTime = [&frame, gpuBase, period]( uint64_t timestamp )
+		{
+			return frame.gpuStart + std::chrono::nanoseconds{ int64_t( double( timestamp - gpuBase ) * period ) };
+		};
+		// Tells, for each enclosing scope, if it is a GPU one, to sum the outer GPU scopes only.
+		std::vector< bool > gpuAncestors;
+
+		for ( auto & pending : frame.scopes )
+		{
+			auto scope = pending.scope;
+			gpuAncestors.resize( scope.depth );
+
+			if ( scope.gpu )
+			{
+				// The scopes beyond the queries count, or not yet executed by the GPU, are dropped.
+				if ( pending.query == ~0u
+					|| !isAvailable( pending.query ) )
+				{
+					continue;
+				}
+
+				auto begin = results[4u * pending.query];
+				auto end = results[4u * pending.query + 2u];
+				scope.begin = toTime( begin );
+				scope.end = toTime( std::max( begin, end ) );
+
+				if ( std::find( gpuAncestors.begin(), gpuAncestors.end(), true ) == gpuAncestors.end() )
+				{
+					resolved.gpuTime += scope.end - scope.begin;
+				}
+			}
+
+			gpuAncestors.push_back( scope.gpu );
+			resolved.scopes.push_back( std::move( scope ) );
+		}
+
+		m_history.push_back( std::move( resolved ) );
+
+		if ( m_history.size() > HistorySize )
+		{
+			m_history.pop_front();
+		}
+	}
+}
@@ -0,0 +1,268 @@
+#pragma once
+
+#include <Command/CommandBuffer.hpp>
+#include <Command/Queue.hpp>
+#include <Core/Device.hpp>
+#include <Miscellaneous/QueryPool.hpp>
+#include <Sync/Fence.hpp>
+
+#include <array>
+#include <chrono>
+#include <deque>
+
+namespace common
+{
+	/**
+	*\~english
+	*\brief
+	*	A timed scope, CPU or GPU.
+	*\~french
+	*\brief
+	*	Une portée chronométrée, CPU ou GPU.
+	*/
+	struct ProfileScope
+	{
+		std::string name;
+		//! The nesting level, CPU and GPU scopes nesting together.
+		uint32_t depth;
+		bool gpu;
+		//! The times, relative to the frame start.
+		std::chrono::nanoseconds begin;
+		std::chrono::nanoseconds end;
+	};
+	/**
+	*\~english
+	*\brief
+	*	The resolved scopes of a frame.
+	*\~french
+	*\brief
+	*	Les portées résolues d'une frame.
+	*/
+	struct ProfileFrame
+	{
+		uint64_t index;
+		//! The frame start, relative to the profiler creation.
+		std::chrono::nanoseconds start;
+		//! The time spent in the GPU scopes not nested in another GPU scope.
+		std::chrono::nanoseconds gpuTime;
+		//! The scopes, in opening order.
+		std::vector< ProfileScope > scopes;
+	};
+	/**
+	*\~english
+	*\brief
+	*	Hierarchical CPU and GPU profiler.
+	*\remarks
+	*	The GPU scopes allocate timestamp pairs from the query pool of the current frame,
+	*	there is one per in-flight frame, and are read back FrameCount frames later,
+	*	once the fence signalled at the end of that frame is, so that they are neither reset
+	*	nor read while the GPU still writes them.
+	*	A GPU scope recorded into a command buffer must be submitted during the same frame,
+	*	pre-recorded command buffers are hence profiled through submit().
+	*	The GPU timestamps don't share the CPU clock, the GPU scopes of a frame are aligned
+	*	on the moment their first scope was opened on the CPU.
+	*	The profiler must be used from the rendering thread only.
+	*\~french
+	*\brief
+	*	Profileur CPU et GPU hiérarchique.
+	*\remarks
+	*	Les portées GPU allouent des paires de timestamps dans le pool de requêtes de la frame courante,
+	*	il y en a un par frame en vol, et sont relues FrameCount frames plus tard,
+	*	une fois signalée la barrière de fin de cette frame, afin qu'elles ne soient ni réinitialisées
+	*	ni lues pendant que le GPU les écrit encore.
+	*	Une portée GPU enregistrée dans un tampon de commandes doit être soumise pendant la même frame,
+	*	les tampons de commandes pré-enregistrés sont donc profilés via submit().
+	*	Les timestamps GPU ne partagent pas l'horloge CPU, les portées GPU d'une frame sont alignées
+	*	sur le moment où leur première portée a été ouverte côté CPU.
+	*	Le profileur ne doit être utilisé que depuis le thread de rendu.
+	*/
+	class Profiler
+	{
+	public:
+		//! The frames in flight, hence the read back latency.
+		static uint32_t constexpr FrameCount = 3u;
+		//! The resolved frames kept for the trace file.
+		static size_t constexpr HistorySize = 256u;
+
+		class CpuScope
+		{
+		public:
+			inline CpuScope( Profiler & profiler
+				, std::string const & name )
+				: m_profiler{ profiler }
+			{
+				m_profiler.beginCpuScope( name );
+			}
+
+			inline ~CpuScope()
+			{
+				m_profiler.endCpuScope();
+			}
+
+		private:
+			Profiler & m_profiler;
+		};
+
+		class GpuScope
+		{
+		public:
+			inline GpuScope( Profiler & profiler
+				, renderer::CommandBuffer const & commandBuffer
+				, std::string const & name )
+				: m_profiler{ profiler }
+				, m_commandBuffer{ commandBuffer }
+			{
+				m_profiler.beginGpuScope( m_commandBuffer, name );
+			}
+
+			inline ~GpuScope()
+			{
+				m_profiler.endGpuScope( m_commandBuffer );
+			}
+
+		private:
+			Profiler & m_profiler;
+			renderer::CommandBuffer const & m_commandBuffer;
+		};
+
+	public:
+		/**
+		*\~english
+		*\param[in] device
+		*	The logical device.
+		*\param[in] maxGpuScopes
+		*	The maximum GPU scopes count per frame, the exceeding ones are ignored.
+		*\~french
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] maxGpuScopes
+		*	Le nombre maximal de portées GPU par frame, celles en trop sont ignorées.
+		*/
+		Profiler( renderer::Device const & device
+			, uint32_t maxGpuScopes = 64u );
+		/**
+		*\~english
+		*\brief
+		*	Starts a frame, resolving the one which previously used its queries.
+		*\~french
+		*\brief
+		*	Démarre une frame, en résolvant celle qui utilisait précédemment ses requêtes.
+		*/
+		void beginFrame();
+		/**
+		*\~english
+		*\brief
+		*	Ends a frame, submitting the signal of its fence after its command buffers.
+		*\~french
+		*\brief
+		*	Termine une frame, en soumettant le signal de sa barrière après ses tampons de commandes.
+		*/
+		void endFrame();
+		void beginCpuScope( std::string const & name );
+		void endCpuScope();
+		/**
+		*\~english
+		*\brief
+		*	Writes the begin timestamp of a GPU scope into a command buffer being recorded.
+		*\~french
+		*\brief
+		*	Ecrit le timestamp de début d'une portée GPU dans un tampon de commandes en cours d'enregistrement.
+		*/
+		void beginGpuScope( renderer::CommandBuffer const & commandBuffer
+			, std::string const & name );
+		void endGpuScope( renderer::CommandBuffer const & commandBuffer );
+		/**
+		*\~english
+		*\brief
+		*	Submits a command buffer, between the timestamps of a GPU scope.
+		*\remarks
+		*	The timestamps are written by command buffers submitted with the given one,
+		*	which can hence be pre-recorded.
+		*\param[in] fence
+		*	The fence signalled when the submission is executed, if any.
+		*\~french
+		*\brief
+		*	Soumet un tampon de commandes, entre les timestamps d'une portée GPU.
+		*\remarks
+		*	Les timestamps sont écrits par des tampons de commandes soumis avec celui donné,
+		*	qui peut donc être pré-enregistré.
+		*\param[in] fence
+		*	La barrière signalée lorsque la soumission est exécutée, s'il y en a une.
+		*/
+		bool submit( renderer::Queue const & queue
+			, renderer::CommandBuffer const & commandBuffer
+			, std::string const & name
+			, renderer::Fence const * fence = nullptr );
+		/**
+		*\~english
+		*\return
+		*	The total GPU time of the given scope, in the last resolved frame.
+		*\~french
+		*\return
+		*	Le temps GPU total de la portée donnée, dans la dernière frame résolue.
+		*/
+		std::chrono::nanoseconds getGpuTime( std::string const & name )const;
+		/**
+		*\~english
+		*\brief
+		*	Writes the resolved frames into a Chrome trace (JSON), readable by chrome://tracing and Perfetto.
+		*\~french
+		*\brief
+		*	Ecrit les frames résolues dans une trace Chrome (JSON), lisible par chrome://tracing et Perfetto.
+		*/
+		bool writeChromeTrace( std::string const & path )const;
+		/**
+		*\~english
+		*\return
+		*	The last resolved frame, \p nullptr if none is yet.
+		*\~french
+		*\return
+		*	La dernière frame résolue, \p nullptr s'il n'y en a pas encore.
+		*/
+		inline ProfileFrame const * getLastFrame()const
+		{
+			return m_history.empty()
+				? nullptr
+				: &m_history.back();
+		}
+
+	private:
+		struct PendingScope
+		{
+			ProfileScope scope;
+			uint32_t query;
+		};
+
+		struct Frame
+		{
+			renderer::QueryPoolPtr queryPool;
+			renderer::CommandBufferPtr resetCommandBuffer;
+			renderer::CommandBufferPtr endCommandBuffer;
+			renderer::FencePtr fence;
+			std::vector< std::pair< renderer::CommandBufferPtr, renderer::CommandBufferPtr > > submitCommandBuffers;
+			std::vector< PendingScope > scopes;
+			uint64_t index{ 0u };
+			renderer::Clock::time_point start;
+			std::chrono::nanoseconds gpuStart{ 0 };
+			uint32_t gpuCount{ 0u };
+			bool pending{ false };
+		};
+
+		std::chrono::nanoseconds doGetTime( Frame const & frame )const;
+		uint32_t doOpenScope( std::string const & name
+			, bool gpu );
+		void doCloseScope( bool gpu );
+		void doResolve( Frame & frame );
+
+	private:
+		renderer::Device const & m_device;
+		uint32_t m_maxGpuScopes;
+		renderer::Clock::time_point m_start;
+		std::array< Frame, FrameCount > m_frames;
+		uint32_t m_frame{ 0u };
+		uint64_t m_frameIndex{ 0u };
+		bool m_inFrame{ false };
+		std::vector< size_t > m_openScopes;
+		std::deque< ProfileFrame > m_history;
+	};
+}
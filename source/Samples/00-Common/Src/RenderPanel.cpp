@@ -85,6 +85,7 @@ namespace common
 			std::cout << "Logical device created." << std::endl;
 			doCreateSwapChain();
 			std::cout << "Swap chain created." << std::endl;
+			m_profiler = std::make_unique< Profiler >( *m_device );
 			m_stagingBuffer = std::make_unique< renderer::StagingBuffer >( *m_device
 				, 0u
 				, 1024u * 64u );
@@ -162,9 +163,16 @@ namespace common
 	{
 		static renderer::Clock::time_point save = renderer::Clock::now();
 		auto duration = std::chrono::duration_cast< std::chrono::microseconds >( renderer::Clock::now() - save );
-		doUpdate();
-		m_renderTarget->update( duration );
-		doUpdateGui( duration );
+		m_profiler->beginFrame();
+		{
+			Profiler::CpuScope scope{ *m_profiler, "Update" };
+			doUpdate();
+			m_renderTarget->update( duration );
+		}
+		{
+			Profiler::CpuScope scope{ *m_profiler, "GUI update" };
+			doUpdateGui( duration );
+		}
 		save = renderer::Clock::now();
 	}
 
@@ -172,17 +180,26 @@ namespace common
 	{
 		if ( m_ready )
 		{
-			auto result = m_renderTarget->draw( m_frameTime );
-			++m_frameCount;
-			m_framesTimes[m_frameIndex] = m_frameTime;
-			m_frameIndex = ++m_frameIndex % FrameSamplesCount;
+			auto result = m_renderTarget->draw( *m_profiler );
 
 			if ( !result )
 			{
 				throw std::runtime_error{ "Couldn't render offscreen frame." };
 			}
 
-			m_gui->submit( m_device->getGraphicsQueue() );
+			// The GPU times are those of the last resolved frame, Profiler::FrameCount frames ago.
+			if ( auto frame = m_profiler->getLastFrame() )
+			{
+				m_frameTime = std::chrono::duration_cast< std::chrono::microseconds >( frame->gpuTime );
+				++m_frameCount;
+				m_framesTimes[m_frameIndex] = m_frameTime;
+				m_frameIndex = ++m_frameIndex % FrameSamplesCount;
+			}
+
+			{
+				Profiler::CpuScope scope{ *m_profiler, "GUI" };
+				m_gui->submit( m_device->getGraphicsQueue() );
+			}
 
 			auto resources = m_swapChain->getResources();
 
@@ -202,8 +219,11 @@ namespace common
 				throw std::runtime_error{ "Couldn't render main frame." };
 			}
 
+			Profiler::CpuScope scope{ *m_profiler, "Present" };
 			m_swapChain->present( *resources );
 		}
+
+		m_profiler->endFrame();
 	}
 
 	void RenderPanel::doCleanup()
@@ -215,6 +235,7 @@ namespace common
 			m_device->waitIdle();
 
 			m_gui.reset();
+			m_profiler.reset();
 
 			m_renderTarget.reset();
 			m_commandBuffers.clear();
@@ -443,11 +464,35 @@ namespace common
 			ImGui::Text( "Min: %.2f ms, Max %.2f ms", ( minGpuTime.count() / 1000.0f ), ( maxGpuTime.count() / 1000.0f ) );
 		}
 
+#if RENDERLIB_STATISTICS
+		auto & statistics = m_device->getFrameStatistics();
+		ImGui::Text( "Draws: %u, Dispatches: %u"
+			, uint32_t( statistics[renderer::Statistic::eDrawCall] )
+			, uint32_t( statistics[renderer::Statistic::eDispatch] ) );
+		ImGui::Text( "Pipelines: %u, Descriptor sets: %u, Barriers: %u"
+			, uint32_t( statistics[renderer::Statistic::ePipelineBind] )
+			, uint32_t( statistics[renderer::Statistic::eDescriptorSetBind] )
+			, uint32_t( statistics[renderer::Statistic::eBarrier] ) );
+		ImGui::Text( "Maps: %u, Uploads: %u (%.1f kB)"
+			, uint32_t( statistics[renderer::Statistic::eBufferMap] )
+			, uint32_t( statistics[renderer::Statistic::eUpload] )
+			, statistics[renderer::Statistic::eUploadedBytes] / 1024.0f );
+		ImGui::Text( "Submits: %u"
+			, uint32_t( statistics[renderer::Statistic::eSubmittedCommandBuffer] ) );
+
+		if ( statistics[renderer::Statistic::eApiCall] )
+		{
+			ImGui::Text( "API calls: %u"
+				, uint32_t( statistics[renderer::Statistic::eApiCall] ) );
+		}
+#endif
+
 #if RENDERLIB_ANDROID
 		ImGui::PushStyleVar( ImGuiStyleVar_ItemSpacing, ImVec2( 0.0f, 5.0f * UIOverlay->scale ) );
 #endif
 
 		ImGui::PushItemWidth( 110.0f );
+		doUpdateProfiler();
 		doUpdateOverlays( *m_gui );
 		ImGui::PopItemWidth();
 
@@ -466,6 +511,41 @@ namespace common
 #endif
 	}
 
+	void RenderPanel::doUpdateProfiler()
+	{
+		if ( !m_gui->header( "Profiler" ) )
+		{
+			return;
+		}
+
+		if ( auto frame = m_profiler->getLastFrame() )
+		{
+			for ( auto & scope : frame->scopes )
+			{
+				ImGui::Text( "%*s%s %s: %.3f ms"
+					, int( 2u * scope.depth )
+					, ""
+					, scope.gpu ? "GPU" : "CPU"
+					, scope.name.c_str()
+					, std::chrono::duration< float, std::milli >( scope.end - scope.begin ).count() );
+			}
+		}
+
+		if ( m_gui->button( "Save trace" ) )
+		{
+			auto path = getExecutableDirectory() / ( m_appName + ".trace.json" );
+
+			if ( m_profiler->writeChromeTrace( path ) )
+			{
+				std::cout << "Profiler trace written to " << path << std::endl;
+			}
+			else
+			{
+				std::cerr << "Couldn't write the profiler trace to " << path << std::endl;
+			}
+		}
+	}
+
 	void RenderPanel::onSize( wxSizeEvent & event )
 	{
 		m_ready = false;
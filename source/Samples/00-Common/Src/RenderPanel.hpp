@@ -3,6 +3,7 @@
 #include "Camera.hpp"
 #include "RenderTarget.hpp"
 #include "Gui.hpp"
+#include "Profiler.hpp"
 
 #include <Core/Connection.hpp>
 #include <Core/Device.hpp>
@@ -58,6 +59,7 @@ namespace common
 		void doCreatePipeline();
 		void doPrepareFrames();
 		void doUpdateGui( std::chrono::microseconds const & duration );
+		void doUpdateProfiler();
 		void onSize( wxSizeEvent & event );
 		void onMouseLDown( wxMouseEvent & event );
 		void onMouseLUp( wxMouseEvent & event );
@@ -82,6 +84,7 @@ namespace common
 		size_t m_frameCount{ 0 };
 		std::vector< TexturedVertexData > m_vertexData;
 		std::unique_ptr< Gui > m_gui;
+		std::unique_ptr< Profiler > m_profiler;
 
 		renderer::DevicePtr m_device;
 		renderer::SwapChainPtr m_swapChain;
@@ -1,6 +1,7 @@
 #include "RenderTarget.hpp"
 
 #include "OpaqueRendering.hpp"
+#include "Profiler.hpp"
 #include "TransparentRendering.hpp"
 
 #include <Buffer/StagingBuffer.hpp>
@@ -29,7 +30,7 @@ namespace common
 {
 	namespace
 	{
-		static renderer::PixelFormat const DepthFormat = renderer::PixelFormat::eD24S8;
+		static renderer::PixelFormat const DepthFormat = renderer::PixelFormat::eD32F;
 		static renderer::PixelFormat const ColourFormat = renderer::PixelFormat::eR8G8B8A8;
 	}
 
@@ -79,15 +80,15 @@ namespace common
 	void RenderTarget::update( std::chrono::microseconds const & duration )
 	{
 		doUpdate( duration );
+		m_opaque->cull();
+		m_transparent->cull();
 	}
 
-	bool RenderTarget::draw( std::chrono::microseconds & gpu )
+	bool RenderTarget::draw( Profiler & profiler )
 	{
-		std::chrono::nanoseconds opaque;
-		std::chrono::nanoseconds transparent;
-		auto result = m_opaque->draw( opaque );
-		result &= m_transparent->draw( transparent );
-		gpu = std::chrono::duration_cast< std::chrono::microseconds >( opaque + transparent );
+		Profiler::CpuScope scope{ profiler, "Offscreen" };
+		auto result = m_opaque->draw( profiler );
+		result &= m_transparent->draw( profiler );
 		return result;
 	}
 
@@ -105,6 +106,17 @@ namespace common
 			, m_textureNodes );
 	}
 
+	void RenderTarget::doResetOpaqueRendering()
+	{
+		m_device.waitIdle();
+		m_opaque.reset();
+		m_opaque = doCreateOpaqueRendering( m_device
+			, *m_stagingBuffer
+			, { *m_depthView, *m_colourView }
+			, m_scene
+			, m_textureNodes );
+	}
+
 	void RenderTarget::doCleanup()
 	{
 		m_updateCommandBuffer.reset();
@@ -139,18 +151,50 @@ namespace common
 			textureNode->texture = m_device.createTexture();
 			textureNode->texture->setImage( image->format
 				, { image->size[0], image->size[1] }
-				, 4u
+				, TEXTURES_MIP_LEVELS
 				, renderer::ImageUsageFlag::eTransferSrc | renderer::ImageUsageFlag::eTransferDst | renderer::ImageUsageFlag::eSampled );
 			textureNode->view = textureNode->texture->createView( textureNode->texture->getType()
 				, textureNode->texture->getFormat()
 				, 0u
-				, 4u );
+				, TEXTURES_MIP_LEVELS );
 			auto view = textureNode->texture->createView( textureNode->texture->getType()
 				, textureNode->texture->getFormat() );
 			m_stagingBuffer->uploadTextureData( *m_updateCommandBuffer
-				, image->data
+				, image->getData()
+				, image->getSize()
 				, *view );
-			textureNode->texture->generateMipmaps();
+
+			if ( image->mips.size() + 1u == TEXTURES_MIP_LEVELS )
+			{
+				// The ImageLoader already generated the levels, they are uploaded as is.
+				for ( uint32_t level = 1u; level < TEXTURES_MIP_LEVELS; ++level )
+				{
+					auto & mip = image->mips[level - 1u];
+					auto levelView = textureNode->texture->createView( textureNode->texture->getType()
+						, textureNode->texture->getFormat()
+						, level
+						, 1u );
+					m_stagingBuffer->uploadTextureData( *m_updateCommandBuffer
+						, {
+							renderer::getAspectMask( levelView->getFormat() ),
+							level,
+							0u,
+							1u
+						}
+						, renderer::IVec3{ 0, 0, 0 }
+						, renderer::UIVec3{ std::max( 1u, image->size[0] >> level )
+							, std::max( 1u, image->size[1] >> level )
+							, 1u }
+						, mip.data()
+						, uint32_t( mip.size() )
+						, *levelView );
+				}
+			}
+			else
+			{
+				textureNode->texture->generateMipmaps();
+			}
+
 			m_textureNodes.emplace_back( textureNode );
 		}
 	}
@@ -174,7 +218,7 @@ namespace common
 		m_depth = m_device.createTexture();
 		m_depth->setImage( DepthFormat
 			, m_size
-			, renderer::ImageUsageFlag::eDepthStencilAttachment );
+			, renderer::ImageUsageFlag::eDepthStencilAttachment | renderer::ImageUsageFlag::eInputAttachment );
 		m_depthView = m_depth->createView( m_depth->getType()
 			, m_depth->getFormat() );
 	}
@@ -16,7 +16,7 @@ namespace common
 		virtual ~RenderTarget();
 		void resize( renderer::UIVec2 const & size );
 		void update( std::chrono::microseconds const & duration );
-		bool draw( std::chrono::microseconds & gpu );
+		bool draw( Profiler & profiler );
 
 		inline renderer::TextureView const & getColourView()const
 		{
@@ -30,6 +30,15 @@ namespace common
 
 	protected:
 		void doInitialise();
+		/**
+		*\~english
+		*\brief
+		*	Recreates the opaque nodes rendering, once the device is idle.
+		*\~french
+		*\brief
+		*	Recrée le rendu des noeuds opaques, une fois le périphérique inactif.
+		*/
+		void doResetOpaqueRendering();
 
 		inline OpaqueRendering const & getOpaqueRendering()const
 		{
@@ -26,6 +26,10 @@ namespace common
 		{
 			name = "vk";
 		}
+		else if ( m_library.getPath().find( "NullR" ) != std::string::npos )
+		{
+			name = "null";
+		}
 		else
 		{
 			throw std::runtime_error{ "Not a supported renderer plugin" };
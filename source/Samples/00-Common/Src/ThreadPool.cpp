@@ -0,0 +1,76 @@
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+
+namespace common
+{
+	ThreadPool::ThreadPool( uint32_t count )
+	{
+		if ( !count )
+		{
+			count = std::max( 1u, std::thread::hardware_concurrency() );
+		}
+
+		m_workers.reserve( count );
+
+		for ( uint32_t i = 0u; i < count; ++i )
+		{
+			m_workers.emplace_back( [this]()
+				{
+					doRun();
+				} );
+		}
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::unique_lock< std::mutex > lock{ m_mutex };
+			m_stopped = true;
+		}
+
+		m_condition.notify_all();
+
+		for ( auto & worker : m_workers )
+		{
+			worker.join();
+		}
+	}
+
+	void ThreadPool::doPush( std::function< void() > task )
+	{
+		{
+			std::unique_lock< std::mutex > lock{ m_mutex };
+			m_tasks.emplace_back( std::move( task ) );
+		}
+
+		m_condition.notify_one();
+	}
+
+	void ThreadPool::doRun()
+	{
+		while ( true )
+		{
+			std::function< void() > task;
+
+			{
+				std::unique_lock< std::mutex > lock{ m_mutex };
+				m_condition.wait( lock, [this]()
+					{
+						return m_stopped || !m_tasks.empty();
+					} );
+
+				if ( m_tasks.empty() )
+				{
+					// Stopped, and nothing left to process.
+					return;
+				}
+
+				task = std::move( m_tasks.front() );
+				m_tasks.pop_front();
+			}
+
+			task();
+		}
+	}
+}
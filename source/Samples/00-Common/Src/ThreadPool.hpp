@@ -0,0 +1,94 @@
+/*
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "Prerequisites.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+
+namespace common
+{
+	/**
+	*\~english
+	*\brief
+	*	A fixed set of worker threads, processing the submitted tasks in submission order.
+	*\remarks
+	*	The destructor waits for the remaining tasks' end.
+	*\~french
+	*\brief
+	*	Un ensemble fixe de threads de travail, traitant les tâches soumises dans leur ordre de soumission.
+	*\remarks
+	*	Le destructeur attend la fin des tâches restantes.
+	*/
+	class ThreadPool
+	{
+	public:
+		ThreadPool( ThreadPool const & ) = delete;
+		ThreadPool & operator=( ThreadPool const & ) = delete;
+		/**
+		*\~english
+		*\brief
+		*	Starts the worker threads.
+		*\param[in] count
+		*	The threads count, 0 to use one thread per hardware core.
+		*\~french
+		*\brief
+		*	Démarre les threads de travail.
+		*\param[in] count
+		*	Le nombre de threads, 0 pour utiliser un thread par coeur matériel.
+		*/
+		explicit ThreadPool( uint32_t count = 0u );
+		~ThreadPool();
+		/**
+		*\~english
+		*\brief
+		*	Submits a task.
+		*\param[in] task
+		*	The task, its exceptions are forwarded to the returned future.
+		*\return
+		*	The future receiving the task's result.
+		*\~french
+		*\brief
+		*	Soumet une tâche.
+		*\param[in] task
+		*	La tâche, ses exceptions sont transmises au future retourné.
+		*\return
+		*	Le future recevant le résultat de la tâche.
+		*/
+		template< typename TaskT >
+		auto submit( TaskT && task )
+		{
+			using ResultT = decltype( task() );
+			// std::function needs a copyable callable, hence the shared packaged_task.
+			auto packaged = std::make_shared< std::packaged_task< ResultT() > >( std::forward< TaskT >( task ) );
+			auto result = packaged->get_future();
+			doPush( [packaged]()
+				{
+					( *packaged )();
+				} );
+			return result;
+		}
+
+		inline uint32_t getCount()const
+		{
+			return uint32_t( m_workers.size() );
+		}
+
+	private:
+		void doPush( std::function< void() > task );
+		void doRun();
+
+	private:
+		std::vector< std::thread > m_workers;
+		std::deque< std::function< void() > > m_tasks;
+		std::mutex m_mutex;
+		std::condition_variable m_condition;
+		bool m_stopped{ false };
+	};
+}
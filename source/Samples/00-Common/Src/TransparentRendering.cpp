@@ -25,8 +25,13 @@ namespace common
 		m_renderer->update( target );
 	}
 
-	bool TransparentRendering::draw( std::chrono::nanoseconds & gpu )const
+	void TransparentRendering::cull()
 	{
-		return m_renderer->draw( gpu );
+		m_renderer->cull();
+	}
+
+	bool TransparentRendering::draw( Profiler & profiler )const
+	{
+		return m_renderer->draw( profiler );
 	}
 }
@@ -14,7 +14,8 @@ namespace common
 			, common::TextureNodePtrArray const & textureNodes );
 		virtual ~TransparentRendering() = default;
 		virtual void update( RenderTarget const & target );
-		virtual bool draw( std::chrono::nanoseconds & gpu )const;
+		virtual void cull();
+		virtual bool draw( Profiler & profiler )const;
 
 	protected:
 		void doInitialise( Object const & submeshes
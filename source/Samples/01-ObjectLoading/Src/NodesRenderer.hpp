@@ -22,6 +22,8 @@ namespace vkapp
 		void doFillObjectDescriptorLayoutBindings( renderer::DescriptorSetLayoutBindingArray & bindings )override;
 		void doFillObjectDescriptorSet( renderer::DescriptorSetLayout & descriptorLayout
 			, renderer::DescriptorSet & descriptorSet )override;
+		bool doGetCullingMatrices( renderer::Mat4 & viewProjection
+			, renderer::Mat4 & model )const override;
 
 	private:
 		renderer::UniformBuffer< common::SceneData > const & m_sceneUbo;
@@ -1,7 +1,10 @@
 #version 450
 #extension GL_KHR_vulkan_glsl : enable
+#extension GL_ARB_shader_storage_buffer_object : enable
 
 #define MAX_LIGHTS 10
+#define TILE_SIZE 16
+#define MAX_LIGHTS_PER_TILE 255
 
 struct Light
 {
@@ -42,11 +45,40 @@ layout( set=1, binding=1 ) uniform Matrix
 	mat4 mtxInvViewProj;
 };
 
+layout( set=1, binding=2 ) uniform LightCulling
+{
+	mat4 mtxInvProjection;
+	ivec4 cullingCounts;// .x = point lights count, .yz = tiles count, .w = tiled lighting
+	vec4 renderSize;
+};
+
+layout( std430, set=1, binding=3 ) readonly buffer PointLights
+{
+	PointLight scenePointLights[];
+};
+
+layout( std430, set=1, binding=4 ) readonly buffer TileLights
+{
+	uint tileLights[];
+};
+
+// The G-buffer is read from the previous subpass attachments.
+#ifdef VULKAN
+layout( input_attachment_index=0, set=0, binding=0 ) uniform subpassInput depthMap;
+layout( input_attachment_index=1, set=0, binding=1 ) uniform subpassInput diffuseMap;
+layout( input_attachment_index=2, set=0, binding=2 ) uniform subpassInput specularMap;
+layout( input_attachment_index=3, set=0, binding=3 ) uniform subpassInput emissiveMap;
+layout( input_attachment_index=4, set=0, binding=4 ) uniform subpassInput normalMap;
+#	define readInput( input ) subpassLoad( input )
+#else
+// OpenGL samples the frame buffer textures, made readable by a texture barrier.
 layout( set=0, binding=0 ) uniform sampler2D depthMap;
 layout( set=0, binding=1 ) uniform sampler2D diffuseMap;
 layout( set=0, binding=2 ) uniform sampler2D specularMap;
 layout( set=0, binding=3 ) uniform sampler2D emissiveMap;
 layout( set=0, binding=4 ) uniform sampler2D normalMap;
+#	define readInput( input ) texelFetch( input, ivec2( gl_FragCoord.xy ), 0 )
+#endif
 
 layout( location = 0 ) in vec2 vtx_texcoord;
 
@@ -57,8 +89,8 @@ void computeLight( Light light
 	, vec3 normal
 	, float shininess
 	, vec3 worldPosition
-	, out vec3 diffuse
-	, out vec3 specular )
+	, inout vec3 diffuse
+	, inout vec3 specular )
 {
 	float diffuseFactor = max( dot( normal, -direction ), 0.0 );
 	diffuse += light.colour.xyz * light.intensities.x * diffuseFactor;
@@ -73,8 +105,8 @@ void computeDirectionalLight( int index
 	, vec3 normal
 	, float shininess
 	, vec3 worldPosition
-	, out vec3 diffuse
-	, out vec3 specular )
+	, inout vec3 diffuse
+	, inout vec3 specular )
 {
 	DirectionalLight light = directionalLights[index];
 	computeLight( light.base
@@ -86,6 +118,78 @@ void computeDirectionalLight( int index
 		, specular );
 }
 
+void computePointLight( uint index
+	, vec3 normal
+	, float shininess
+	, vec3 worldPosition
+	, inout vec3 diffuse
+	, inout vec3 specular )
+{
+	PointLight light = scenePointLights[index];
+	vec3 direction = worldPosition - light.position.xyz;
+	float lightDistance = length( direction );
+
+	// position.w holds the light radius.
+	if ( lightDistance < light.position.w )
+	{
+		float attenuation = light.attenation.x
+			+ light.attenation.y * lightDistance
+			+ light.attenation.z * lightDistance * lightDistance;
+		vec3 lightDiffuse = vec3( 0.0, 0.0, 0.0 );
+		vec3 lightSpecular = vec3( 0.0, 0.0, 0.0 );
+		computeLight( light.base
+			, direction / max( lightDistance, 0.0001 )
+			, normal
+			, shininess
+			, worldPosition
+			, lightDiffuse
+			, lightSpecular );
+		diffuse += lightDiffuse / attenuation;
+		specular += lightSpecular / attenuation;
+	}
+}
+
+void computePointLights( vec3 normal
+	, float shininess
+	, vec3 worldPosition
+	, inout vec3 diffuse
+	, inout vec3 specular )
+{
+	if ( cullingCounts.w != 0 )
+	{
+		// Only the lights touching the pixel's tile.
+		uvec2 tile = uvec2( gl_FragCoord.xy ) / uint( TILE_SIZE );
+		uint offset = ( tile.y * uint( cullingCounts.y ) + tile.x ) * uint( MAX_LIGHTS_PER_TILE + 1 );
+		uint count = tileLights[offset];
+
+		// The tiles touched by more lights than their list holds process all of them, below.
+		if ( count <= uint( MAX_LIGHTS_PER_TILE ) )
+		{
+			for ( uint i = 0u; i < count; ++i )
+			{
+				computePointLight( tileLights[offset + 1u + i]
+					, normal
+					, shininess
+					, worldPosition
+					, diffuse
+					, specular );
+			}
+
+			return;
+		}
+	}
+
+	for ( uint i = 0u; i < uint( cullingCounts.x ); ++i )
+	{
+		computePointLight( i
+			, normal
+			, shininess
+			, worldPosition
+			, diffuse
+			, specular );
+	}
+}
+
 vec3 computeWorldSpacePosition( float depth
 	, vec2 uv
 	, mat4 invViewProj )
@@ -104,10 +208,10 @@ void main()
 	vec2 texcoord = vec2( vtx_texcoord.x, 1.0 - vtx_texcoord.y );
 #endif
 
-	float depth = texture( depthMap, texcoord ).x;
+	float depth = readInput( depthMap ).x;
 	vec3 worldPosition = computeWorldSpacePosition( depth, texcoord, mtxInvViewProj );
-	vec3 normal = texture( normalMap, texcoord ).xyz;
-	vec4 specular = texture( specularMap, texcoord );
+	vec3 normal = readInput( normalMap ).xyz;
+	vec4 specular = readInput( specularMap );
 	vec3 lightDiffuse = vec3( 0.0, 0.0, 0.0 );
 	vec3 lightSpecular = vec3( 0.0, 0.0, 0.0 );
 
@@ -120,6 +224,12 @@ void main()
 			, lightDiffuse
 			, lightSpecular );
 	}
-	
-	pxl_colour = vec4( texture( diffuseMap, texcoord ).xyz * ( lightDiffuse + lightSpecular ), 1.0 );
+
+	computePointLights( normal
+		, specular.w
+		, worldPosition
+		, lightDiffuse
+		, lightSpecular );
+
+	pxl_colour = vec4( readInput( diffuseMap ).xyz * ( lightDiffuse + lightSpecular ), 1.0 );
 }
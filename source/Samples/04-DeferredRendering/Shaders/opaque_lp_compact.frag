@@ -0,0 +1,254 @@
+#version 450
+#extension GL_KHR_vulkan_glsl : enable
+#extension GL_ARB_shader_storage_buffer_object : enable
+
+#define MAX_LIGHTS 10
+#define TILE_SIZE 16
+#define MAX_LIGHTS_PER_TILE 255
+#define MAX_SHININESS 1023.0
+
+struct Light
+{
+	vec4 colour;
+	vec4 intensities;
+};
+
+struct DirectionalLight
+{
+	Light base;
+	vec4 direction;
+};
+
+struct PointLight
+{
+	Light base;
+	vec4 position;
+	vec4 attenation;
+};
+
+struct SpotLight
+{
+	PointLight base;
+	vec4 direction;
+	vec4 coeffs;// .x = cutoff, .y = exponent
+};
+
+layout( set=1, binding=0 ) uniform Lights
+{
+	ivec4 lightsCount;
+	DirectionalLight directionalLights[MAX_LIGHTS];
+	PointLight pointLights[MAX_LIGHTS];
+	SpotLight spotLights[MAX_LIGHTS];
+};
+
+layout( set=1, binding=1 ) uniform Matrix
+{
+	mat4 mtxInvViewProj;
+};
+
+layout( set=1, binding=2 ) uniform LightCulling
+{
+	mat4 mtxInvProjection;
+	ivec4 cullingCounts;// .x = point lights count, .yz = tiles count, .w = tiled lighting
+	vec4 renderSize;
+};
+
+layout( std430, set=1, binding=3 ) readonly buffer PointLights
+{
+	PointLight scenePointLights[];
+};
+
+layout( std430, set=1, binding=4 ) readonly buffer TileLights
+{
+	uint tileLights[];
+};
+
+// The G-buffer is read from the previous subpass attachments.
+#ifdef VULKAN
+layout( input_attachment_index=0, set=0, binding=0 ) uniform subpassInput depthMap;
+layout( input_attachment_index=1, set=0, binding=1 ) uniform subpassInput albedoMap;
+layout( input_attachment_index=2, set=0, binding=2 ) uniform subpassInput normalMap;
+layout( input_attachment_index=3, set=0, binding=3 ) uniform subpassInput materialMap;
+#	define readInput( input ) subpassLoad( input )
+#else
+// OpenGL samples the frame buffer textures, made readable by a texture barrier.
+layout( set=0, binding=0 ) uniform sampler2D depthMap;
+layout( set=0, binding=1 ) uniform sampler2D albedoMap;
+layout( set=0, binding=2 ) uniform sampler2D normalMap;
+layout( set=0, binding=3 ) uniform sampler2D materialMap;
+#	define readInput( input ) texelFetch( input, ivec2( gl_FragCoord.xy ), 0 )
+#endif
+
+layout( location = 0 ) in vec2 vtx_texcoord;
+
+layout( location = 0 ) out vec4 pxl_colour;
+
+void computeLight( Light light
+	, vec3 direction
+	, vec3 normal
+	, float shininess
+	, vec3 worldPosition
+	, inout vec3 diffuse
+	, inout vec3 specular )
+{
+	float diffuseFactor = max( dot( normal, -direction ), 0.0 );
+	diffuse += light.colour.xyz * light.intensities.x * diffuseFactor;
+	vec3 vertexToEye = normalize( -worldPosition );
+	vec3 lightReflect = normalize( reflect( direction, normal ) );
+	float specularFactor = max( dot( vertexToEye, lightReflect ), 0.0 );
+	specularFactor = pow( specularFactor, light.intensities.y );
+	specular += vec3( light.colour * shininess * specularFactor );
+}
+
+void computeDirectionalLight( int index
+	, vec3 normal
+	, float shininess
+	, vec3 worldPosition
+	, inout vec3 diffuse
+	, inout vec3 specular )
+{
+	DirectionalLight light = directionalLights[index];
+	computeLight( light.base
+		, light.direction.xyz
+		, normal
+		, shininess
+		, worldPosition
+		, diffuse
+		, specular );
+}
+
+void computePointLight( uint index
+	, vec3 normal
+	, float shininess
+	, vec3 worldPosition
+	, inout vec3 diffuse
+	, inout vec3 specular )
+{
+	PointLight light = scenePointLights[index];
+	vec3 direction = worldPosition - light.position.xyz;
+	float lightDistance = length( direction );
+
+	// position.w holds the light radius.
+	if ( lightDistance < light.position.w )
+	{
+		float attenuation = light.attenation.x
+			+ light.attenation.y * lightDistance
+			+ light.attenation.z * lightDistance * lightDistance;
+		vec3 lightDiffuse = vec3( 0.0, 0.0, 0.0 );
+		vec3 lightSpecular = vec3( 0.0, 0.0, 0.0 );
+		computeLight( light.base
+			, direction / max( lightDistance, 0.0001 )
+			, normal
+			, shininess
+			, worldPosition
+			, lightDiffuse
+			, lightSpecular );
+		diffuse += lightDiffuse / attenuation;
+		specular += lightSpecular / attenuation;
+	}
+}
+
+void computePointLights( vec3 normal
+	, float shininess
+	, vec3 worldPosition
+	, inout vec3 diffuse
+	, inout vec3 specular )
+{
+	if ( cullingCounts.w != 0 )
+	{
+		// Only the lights touching the pixel's tile.
+		uvec2 tile = uvec2( gl_FragCoord.xy ) / uint( TILE_SIZE );
+		uint offset = ( tile.y * uint( cullingCounts.y ) + tile.x ) * uint( MAX_LIGHTS_PER_TILE + 1 );
+		uint count = tileLights[offset];
+
+		// The tiles touched by more lights than their list holds process all of them, below.
+		if ( count <= uint( MAX_LIGHTS_PER_TILE ) )
+		{
+			for ( uint i = 0u; i < count; ++i )
+			{
+				computePointLight( tileLights[offset + 1u + i]
+					, normal
+					, shininess
+					, worldPosition
+					, diffuse
+					, specular );
+			}
+
+			return;
+		}
+	}
+
+	for ( uint i = 0u; i < uint( cullingCounts.x ); ++i )
+	{
+		computePointLight( i
+			, normal
+			, shininess
+			, worldPosition
+			, diffuse
+			, specular );
+	}
+}
+
+vec2 signNotZero( vec2 value )
+{
+	return vec2( value.x >= 0.0 ? 1.0 : -1.0
+		, value.y >= 0.0 ? 1.0 : -1.0 );
+}
+
+vec3 decodeNormal( vec2 encoded )
+{
+	encoded = encoded * 2.0 - 1.0;
+	vec3 result = vec3( encoded, 1.0 - abs( encoded.x ) - abs( encoded.y ) );
+
+	if ( result.z < 0.0 )
+	{
+		result.xy = ( 1.0 - abs( result.yx ) ) * signNotZero( result.xy );
+	}
+
+	return normalize( result );
+}
+
+vec3 computeWorldSpacePosition( float depth
+	, vec2 uv
+	, mat4 invViewProj )
+{
+	vec3 csPosition = vec3( uv * 2.0f - 1.0f, depth * 2.0 - 1.0 );
+	vec4 wsPosition = invViewProj * vec4( csPosition, 1.0 );
+	wsPosition.xyz /= wsPosition.w;
+	return wsPosition.xyz;
+}
+
+void main()
+{
+#ifdef VULKAN
+	vec2 texcoord = vtx_texcoord;
+#else
+	vec2 texcoord = vec2( vtx_texcoord.x, 1.0 - vtx_texcoord.y );
+#endif
+
+	float depth = readInput( depthMap ).x;
+	vec3 worldPosition = computeWorldSpacePosition( depth, texcoord, mtxInvViewProj );
+	vec3 encoded = readInput( normalMap ).xyz;
+	vec3 normal = decodeNormal( encoded.xy );
+	float shininess = encoded.z * MAX_SHININESS;
+	vec3 lightDiffuse = vec3( 0.0, 0.0, 0.0 );
+	vec3 lightSpecular = vec3( 0.0, 0.0, 0.0 );
+
+	for ( int i = 0; i < lightsCount.x; ++i )
+	{
+		computeDirectionalLight( i
+			, normal
+			, shininess
+			, worldPosition
+			, lightDiffuse
+			, lightSpecular );
+	}
+
+	computePointLights( normal
+		, shininess
+		, worldPosition
+		, lightDiffuse
+		, lightSpecular );
+
+	pxl_colour = vec4( readInput( albedoMap ).xyz * ( lightDiffuse + lightSpecular ), 1.0 );
+}
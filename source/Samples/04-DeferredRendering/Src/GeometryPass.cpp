@@ -1,5 +1,6 @@
 #include "GeometryPass.hpp"
 
+#include "LightingPass.hpp"
 #include "RenderTarget.hpp"
 
 #include <Buffer/Buffer.hpp>
@@ -37,28 +38,109 @@ namespace vkapp
 {
 	namespace
 	{
-		std::vector< renderer::PixelFormat > doGetFormats( GeometryPassResult const & gbuffer
-			, renderer::PixelFormat depthFormat )
+		renderer::RenderPassPtr doCreateRenderPass( renderer::Device const & device
+			, GeometryPassResult const & gbuffer
+			, renderer::PixelFormat depthFormat
+			, renderer::PixelFormat colourFormat
+			, GBufferLayout layout )
 		{
-			std::vector< renderer::PixelFormat > result
+			// The depth buffer is kept for the transparent nodes.
+			renderer::RenderPassAttachmentArray attaches
 			{
-				depthFormat,
+				{
+					0u,
+					depthFormat,
+					renderer::SampleCountFlag::e1,
+					renderer::AttachmentLoadOp::eClear,
+					renderer::AttachmentStoreOp::eStore,
+					renderer::AttachmentLoadOp::eDontCare,
+					renderer::AttachmentStoreOp::eDontCare,
+					renderer::ImageLayout::eUndefined,
+					renderer::ImageLayout::eDepthStencilAttachmentOptimal,
+				}
 			};
+			renderer::RenderSubpassAttachmentArray gbufferAttaches;
+			renderer::RenderSubpassAttachmentArray inputAttaches;
 
+			// The compact layout rebuilds the position from the depth buffer.
+			if ( layout == GBufferLayout::eCompact )
+			{
+				inputAttaches.push_back( { 0u, renderer::ImageLayout::eDepthStencilReadOnlyOptimal } );
+			}
+
+			// The G-buffer is neither loaded nor stored, it only lives in the render pass.
 			for ( auto & texture : gbuffer )
 			{
-				result.push_back( texture.view->getFormat() );
+				auto index = uint32_t( attaches.size() );
+				attaches.push_back(
+				{
+					index,
+					texture.view->getFormat(),
+					renderer::SampleCountFlag::e1,
+					renderer::AttachmentLoadOp::eClear,
+					renderer::AttachmentStoreOp::eDontCare,
+					renderer::AttachmentLoadOp::eDontCare,
+					renderer::AttachmentStoreOp::eDontCare,
+					renderer::ImageLayout::eUndefined,
+					renderer::ImageLayout::eShaderReadOnlyOptimal,
+				} );
+				gbufferAttaches.push_back( { index, renderer::ImageLayout::eColourAttachmentOptimal } );
+				inputAttaches.push_back( { index, renderer::ImageLayout::eShaderReadOnlyOptimal } );
 			}
 
-			return result;
+			auto colourIndex = uint32_t( attaches.size() );
+			attaches.push_back(
+			{
+				colourIndex,
+				colourFormat,
+				renderer::SampleCountFlag::e1,
+				renderer::AttachmentLoadOp::eClear,
+				renderer::AttachmentStoreOp::eStore,
+				renderer::AttachmentLoadOp::eDontCare,
+				renderer::AttachmentStoreOp::eDontCare,
+				renderer::ImageLayout::eUndefined,
+				renderer::ImageLayout::eColourAttachmentOptimal,
+			} );
+
+			// The subpasses states give their dependency: the lighting subpass waits, per region,
+			// for the G-buffer and depth writes of the geometry subpass.
+			renderer::RenderSubpassAttachment depthAttach{ 0u, renderer::ImageLayout::eDepthStencilAttachmentOptimal };
+			renderer::RenderSubpassPtrArray subpasses;
+			subpasses.emplace_back( device.createRenderSubpass( renderer::PipelineBindPoint::eGraphics
+				, renderer::RenderSubpassState{ renderer::PipelineStageFlag::eColourAttachmentOutput | renderer::PipelineStageFlag::eLateFragmentTests
+					, renderer::AccessFlag::eColourAttachmentWrite | renderer::AccessFlag::eDepthStencilAttachmentWrite }
+				, renderer::RenderSubpassAttachmentArray{}
+				, gbufferAttaches
+				, renderer::RenderSubpassAttachmentArray{}
+				, &depthAttach
+				, renderer::UInt32Array{} ) );
+			subpasses.emplace_back( device.createRenderSubpass( renderer::PipelineBindPoint::eGraphics
+				, renderer::RenderSubpassState{ renderer::PipelineStageFlag::eFragmentShader | renderer::PipelineStageFlag::eColourAttachmentOutput
+					, renderer::AccessFlag::eInputAttachmentRead | renderer::AccessFlag::eColourAttachmentWrite }
+				, inputAttaches
+				, renderer::RenderSubpassAttachmentArray
+				{
+					{ colourIndex, renderer::ImageLayout::eColourAttachmentOptimal },
+				}
+				, renderer::RenderSubpassAttachmentArray{}
+				, nullptr
+				, renderer::UInt32Array{} ) );
+
+			return device.createRenderPass( attaches
+				, std::move( subpasses )
+				, renderer::RenderSubpassState{ renderer::PipelineStageFlag::eColourAttachmentOutput
+					, renderer::AccessFlag::eColourAttachmentWrite }
+				, renderer::RenderSubpassState{ renderer::PipelineStageFlag::eColourAttachmentOutput
+					, renderer::AccessFlag::eColourAttachmentWrite } );
 		}
 
 		renderer::TextureViewCRefArray doGetViews( GeometryPassResult const & gbuffer
-			, renderer::TextureView const & depthview )
+			, renderer::TextureView const & depthView
+			, renderer::TextureView const & colourView )
 		{
 			renderer::TextureViewCRefArray result
 			{
-				depthview
+				depthView
 			};
 
 			for ( auto & texture : gbuffer )
@@ -66,6 +148,7 @@ namespace vkapp
 				result.emplace_back( *texture.view );
 			}
 
+			result.emplace_back( colourView );
 			return result;
 		}
 	}
@@ -74,12 +157,13 @@ namespace vkapp
 		, std::string const & fragmentShaderFile
 		, GeometryPassResult const & gbuffer
 		, renderer::PixelFormat depthFormat
+		, renderer::PixelFormat colourFormat
+		, GBufferLayout layout
 		, renderer::UniformBuffer< common::SceneData > const & sceneUbo
 		, renderer::UniformBuffer< common::ObjectData > const & objectUbo )
 		: common::NodesRenderer{ device
 			, fragmentShaderFile
-			, doGetFormats( gbuffer, depthFormat )
-			, true
+			, doCreateRenderPass( device, gbuffer, depthFormat, colourFormat, layout )
 			, true }
 		, m_sceneUbo{ sceneUbo }
 		, m_objectUbo{ objectUbo }
@@ -89,7 +173,14 @@ namespace vkapp
 	void GeometryPass::update( common::RenderTarget const & target )
 	{
 		doUpdate( doGetViews( static_cast< RenderTarget const & >( target ).getGBuffer()
-			, target.getDepthView() ) );
+			, target.getDepthView()
+			, target.getColourView() ) );
+	}
+
+	void GeometryPass::setLightingPass( LightingPass const & lightingPass )
+	{
+		m_lightingPass = &lightingPass;
+		doRecordCommandBuffer();
 	}
 
 	void GeometryPass::doFillObjectDescriptorLayoutBindings( renderer::DescriptorSetLayoutBindingArray & bindings )
@@ -110,4 +201,24 @@ namespace vkapp
 			, 0u
 			, 1u );
 	}
+
+	bool GeometryPass::doGetCullingMatrices( renderer::Mat4 & viewProjection
+		, renderer::Mat4 & model )const
+	{
+		auto & scene = m_sceneUbo.getData( 0u );
+		viewProjection = scene.mtxProjection * scene.mtxView;
+		model = m_objectUbo.getData( 0u ).mtxModel;
+		return true;
+	}
+
+	void GeometryPass::doRecordNextSubpasses( renderer::CommandBuffer const & commandBuffer )const
+	{
+		// The lighting subpass must be run, even if empty.
+		commandBuffer.nextSubpass( renderer::SubpassContents::eInline );
+
+		if ( m_lightingPass )
+		{
+			m_lightingPass->record( commandBuffer, m_size );
+		}
+	}
 }
@@ -6,6 +6,20 @@
 
 namespace vkapp
 {
+	/**
+	*\~english
+	*\brief
+	*	Draws the opaque nodes in the G-buffer, in the first subpass of the opaque render pass.
+	*\remarks
+	*	The lighting pass is recorded in the second subpass, reading the G-buffer
+	*	through input attachments, so that it can stay in the tile memory.
+	*\~french
+	*\brief
+	*	Dessine les noeuds opaques dans le G-buffer, dans la première sous-passe de la passe de rendu opaque.
+	*\remarks
+	*	La passe d'éclairage est enregistrée dans la seconde sous-passe, lisant le G-buffer
+	*	via des attaches d'entrée, afin qu'il puisse rester dans la mémoire des tuiles.
+	*/
 	class GeometryPass
 		: public common::NodesRenderer
 	{
@@ -14,17 +28,37 @@ namespace vkapp
 			, std::string const & fragmentShaderFile
 			, GeometryPassResult const & gbuffer
 			, renderer::PixelFormat depthFormat
+			, renderer::PixelFormat colourFormat
+			, GBufferLayout layout
 			, renderer::UniformBuffer< common::SceneData > const & sceneUbo
 			, renderer::UniformBuffer< common::ObjectData > const & objectUbo );
 		void update( common::RenderTarget const & target )override;
+		/**
+		*\~english
+		*\brief
+		*	Sets the lighting pass recorded in the second subpass, and records the command buffer again.
+		*\~french
+		*\brief
+		*	Définit la passe d'éclairage enregistrée dans la seconde sous-passe, et réenregistre le tampon de commandes.
+		*/
+		void setLightingPass( LightingPass const & lightingPass );
+
+		inline renderer::RenderPass const & getRenderPass()const
+		{
+			return *m_renderPass;
+		}
 
 	private:
 		void doFillObjectDescriptorLayoutBindings( renderer::DescriptorSetLayoutBindingArray & bindings )override;
 		void doFillObjectDescriptorSet( renderer::DescriptorSetLayout & descriptorLayout
 			, renderer::DescriptorSet & descriptorSet )override;
+		bool doGetCullingMatrices( renderer::Mat4 & viewProjection
+			, renderer::Mat4 & model )const override;
+		void doRecordNextSubpasses( renderer::CommandBuffer const & commandBuffer )const override;
 
 	private:
 		renderer::UniformBuffer< common::SceneData > const & m_sceneUbo;
 		renderer::UniformBuffer< common::ObjectData > const & m_objectUbo;
+		LightingPass const * m_lightingPass{ nullptr };
 	};
 }
@@ -0,0 +1,136 @@
+#include "LightCulling.hpp"
+
+#include <Buffer/StagingBuffer.hpp>
+#include <Command/CommandBuffer.hpp>
+#include <Core/Device.hpp>
+#include <Descriptor/DescriptorSet.hpp>
+#include <Descriptor/DescriptorSetLayout.hpp>
+#include <Descriptor/DescriptorSetLayoutBinding.hpp>
+#include <Descriptor/DescriptorSetPool.hpp>
+#include <Pipeline/ComputePipeline.hpp>
+#include <Pipeline/PipelineLayout.hpp>
+#include <Shader/ShaderProgram.hpp>
+
+#include <Utils/Transform.hpp>
+
+#include <FileUtils.hpp>
+
+namespace vkapp
+{
+	LightCulling::LightCulling( renderer::Device const & device
+		, renderer::Buffer< common::PointLight > const & pointLights
+		, renderer::Vec2 const & sceneDistances
+		, bool tiled )
+		: m_device{ device }
+		, m_pointLights{ pointLights }
+		, m_sceneDistances{ sceneDistances }
+		, m_tiled{ tiled }
+		, m_configurationUbo{ renderer::makeUniformBuffer< Configuration >( device
+			, 1u
+			, renderer::BufferTarget::eTransferDst
+			, renderer::MemoryPropertyFlag::eDeviceLocal ) }
+	{
+		std::vector< renderer::DescriptorSetLayoutBinding > bindings
+		{
+			renderer::DescriptorSetLayoutBinding{ 0u, renderer::DescriptorType::eUniformBuffer, renderer::ShaderStageFlag::eCompute },
+			renderer::DescriptorSetLayoutBinding{ 1u, renderer::DescriptorType::eStorageBuffer, renderer::ShaderStageFlag::eCompute },
+			renderer::DescriptorSetLayoutBinding{ 2u, renderer::DescriptorType::eStorageBuffer, renderer::ShaderStageFlag::eCompute },
+		};
+		m_descriptorLayout = m_device.createDescriptorSetLayout( std::move( bindings ) );
+		m_descriptorPool = m_descriptorLayout->createPool( 1u, false );
+		doCreatePipeline();
+	}
+
+	void LightCulling::update( renderer::StagingBuffer & stagingBuffer
+		, renderer::CommandBuffer const & commandBuffer
+		, renderer::Mat4 const & projection
+		, renderer::UIVec2 const & size )
+	{
+		renderer::UIVec2 tilesCount
+		{
+			( size[0] + TileSize - 1u ) / TileSize,
+			( size[1] + TileSize - 1u ) / TileSize,
+		};
+
+		if ( !m_tileLights || tilesCount != m_tilesCount )
+		{
+			// Each tile holds its lights count, followed by their indices.
+			m_tilesCount = tilesCount;
+			m_tileLights = renderer::makeBuffer< uint32_t >( m_device
+				, m_tilesCount[0] * m_tilesCount[1] * ( MaxLightsPerTile + 1u )
+				, renderer::BufferTarget::eStorageBuffer
+				, renderer::MemoryPropertyFlag::eDeviceLocal );
+		}
+
+		auto & configuration = m_configurationUbo->getData( 0u );
+		configuration.mtxInvProjection = utils::inverse( projection );
+		configuration.counts = renderer::IVec4{ int( m_pointLights.getCount() )
+			, int( m_tilesCount[0] )
+			, int( m_tilesCount[1] )
+			, m_tiled ? 1 : 0 };
+		configuration.size = renderer::Vec4{ float( size[0] )
+			, float( size[1] )
+			, m_sceneDistances[0]
+			, m_sceneDistances[1] };
+		stagingBuffer.uploadUniformData( commandBuffer
+			, m_configurationUbo->getDatas()
+			, *m_configurationUbo
+			, renderer::PipelineStageFlag::eComputeShader );
+
+		m_descriptorSet.reset();
+		m_descriptorSet = m_descriptorPool->createDescriptorSet();
+		m_descriptorSet->createBinding( m_descriptorLayout->getBinding( 0u )
+			, *m_configurationUbo
+			, 0u
+			, 1u );
+		m_descriptorSet->createBinding( m_descriptorLayout->getBinding( 1u )
+			, m_pointLights
+			, 0u
+			, uint32_t( m_pointLights.getCount() * sizeof( common::PointLight ) ) );
+		m_descriptorSet->createBinding( m_descriptorLayout->getBinding( 2u )
+			, *m_tileLights
+			, 0u
+			, uint32_t( m_tileLights->getCount() * sizeof( uint32_t ) ) );
+		m_descriptorSet->update();
+	}
+
+	void LightCulling::cull( renderer::CommandBuffer const & commandBuffer )const
+	{
+		if ( m_tiled )
+		{
+			commandBuffer.transition( m_tileLights->getBuffer()
+				, renderer::AccessFlag::eShaderWrite
+				, renderer::PipelineStageFlag::eComputeShader );
+			commandBuffer.bindPipeline( *m_pipeline );
+			commandBuffer.bindDescriptorSet( *m_descriptorSet
+				, *m_pipelineLayout
+				, renderer::PipelineBindPoint::eCompute );
+			commandBuffer.dispatch( m_tilesCount[0]
+				, m_tilesCount[1]
+				, 1u );
+		}
+
+		commandBuffer.transition( m_tileLights->getBuffer()
+			, renderer::AccessFlag::eShaderRead
+			, renderer::PipelineStageFlag::eFragmentShader );
+	}
+
+	void LightCulling::doCreatePipeline()
+	{
+		m_pipelineLayout = m_device.createPipelineLayout( *m_descriptorLayout );
+		std::string shadersFolder = common::getPath( common::getExecutableDirectory() ) / "share" / AppName / "Shaders";
+
+		if ( !wxFileExists( shadersFolder / "light_culling.comp" ) )
+		{
+			throw std::runtime_error{ "Shader files are missing" };
+		}
+
+		renderer::ShaderStageState shaderStage
+		{
+			m_device.createShaderModule( renderer::ShaderStageFlag::eCompute )
+		};
+		shaderStage.getModule().loadShader( common::dumpTextFile( shadersFolder / "light_culling.comp" ) );
+
+		m_pipeline = m_pipelineLayout->createPipeline( std::move( shaderStage ) );
+	}
+}
@@ -0,0 +1,160 @@
+#pragma once
+
+#include "Prerequisites.hpp"
+
+#include <Buffer/Buffer.hpp>
+#include <Buffer/UniformBuffer.hpp>
+
+namespace vkapp
+{
+	/**
+	*\~english
+	*\brief
+	*	Tiled point lights culling.
+	*\remarks
+	*	A compute pass splits the screen in tiles, and writes the indices of the point lights
+	*	touching the frustum of each tile in a storage buffer.
+	*	The lighting subpass then only processes the lights of the pixel's tile.
+	*	The culling runs before the render pass, the tiles are thus not bounded by the depth
+	*	of their pixels, which is only known in the render pass, but by the scene depth range.
+	*	The tiles touched by more than MaxLightsPerTile lights process all the lights.
+	*\~french
+	*\brief
+	*	Culling des sources lumineuses ponctuelles par tuiles.
+	*\remarks
+	*	Une passe de calcul découpe l'écran en tuiles, et écrit les indices des sources ponctuelles
+	*	touchant le frustum de chaque tuile dans un tampon de stockage.
+	*	La sous-passe d'éclairage ne traite alors que les sources de la tuile du pixel.
+	*	Le culling est lancé avant la passe de rendu, les tuiles ne sont donc pas bornées par la
+	*	profondeur de leurs pixels, qui n'est connue que dans la passe de rendu, mais par l'intervalle
+	*	de profondeur de la scène.
+	*	Les tuiles touchées par plus de MaxLightsPerTile sources traitent toutes les sources.
+	*/
+	class LightCulling
+	{
+	public:
+		//!\~english	The tiles dimensions, in pixels.
+		//!\~french	Les dimensions des tuiles, en pixels.
+		static uint32_t constexpr TileSize = 16u;
+		//!\~english	The maximum number of lights listed per tile, beyond it the tile processes all the lights.
+		//!\~french	Le nombre maximal de sources listées par tuile, au-delà la tuile traite toutes les sources.
+		static uint32_t constexpr MaxLightsPerTile = 255u;
+
+		struct Configuration
+		{
+			renderer::Mat4 mtxInvProjection;
+			// .x = point lights count, .yz = tiles count, .w = tiled lighting
+			renderer::IVec4 counts;
+			// .xy = render size, .zw = scene near and far view distances
+			renderer::Vec4 size;
+		};
+
+	public:
+		/**
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] pointLights
+		*	The point lights, in view space, their radius being in position.w.
+		*\param[in] sceneDistances
+		*	The nearest and farthest view distances of the scene geometry.
+		*\param[in] tiled
+		*	Tells if the lights are culled, or if the lighting pass processes all of them.
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] pointLights
+		*	Les sources ponctuelles, dans l'espace de la vue, leur rayon étant dans position.w.
+		*\param[in] sceneDistances
+		*	Les distances à la vue la plus proche et la plus lointaine de la géométrie de la scène.
+		*\param[in] tiled
+		*	Dit si les sources sont filtrées, ou si la passe d'éclairage les traite toutes.
+		*/
+		LightCulling( renderer::Device const & device
+			, renderer::Buffer< common::PointLight > const & pointLights
+			, renderer::Vec2 const & sceneDistances
+			, bool tiled );
+		/**
+		*\~english
+		*\brief
+		*	Updates the tiles for the given render size.
+		*\param[in] stagingBuffer
+		*	The staging buffer used to upload the configuration.
+		*\param[in] commandBuffer
+		*	The command buffer used to upload the configuration.
+		*\param[in] projection
+		*	The projection matrix.
+		*\param[in] size
+		*	The render size.
+		*\~french
+		*\brief
+		*	Met à jour les tuiles pour la taille de rendu donnée.
+		*\param[in] stagingBuffer
+		*	Le tampon de transfert utilisé pour téléverser la configuration.
+		*\param[in] commandBuffer
+		*	Le tampon de commandes utilisé pour téléverser la configuration.
+		*\param[in] projection
+		*	La matrice de projection.
+		*\param[in] size
+		*	La taille de rendu.
+		*/
+		void update( renderer::StagingBuffer & stagingBuffer
+			, renderer::CommandBuffer const & commandBuffer
+			, renderer::Mat4 const & projection
+			, renderer::UIVec2 const & size );
+		/**
+		*\~english
+		*\brief
+		*	Records the culling pass.
+		*\remarks
+		*	Must be recorded outside of a render pass.
+		*\~french
+		*\brief
+		*	Enregistre la passe de culling.
+		*\remarks
+		*	Doit être enregistrée en dehors d'une passe de rendu.
+		*/
+		void cull( renderer::CommandBuffer const & commandBuffer )const;
+
+		inline renderer::UniformBuffer< Configuration > const & getConfigurationUbo()const
+		{
+			return *m_configurationUbo;
+		}
+
+		inline renderer::Buffer< common::PointLight > const & getPointLights()const
+		{
+			return m_pointLights;
+		}
+
+		inline renderer::Buffer< uint32_t > const & getTileLights()const
+		{
+			return *m_tileLights;
+		}
+
+		inline bool isTiled()const
+		{
+			return m_tiled;
+		}
+
+	private:
+		void doCreatePipeline();
+
+	private:
+		renderer::Device const & m_device;
+		renderer::Buffer< common::PointLight > const & m_pointLights;
+		renderer::Vec2 m_sceneDistances;
+		bool m_tiled;
+		renderer::UIVec2 m_tilesCount;
+		renderer::UniformBufferPtr< Configuration > m_configurationUbo;
+		renderer::BufferPtr< uint32_t > m_tileLights;
+		renderer::DescriptorSetLayoutPtr m_descriptorLayout;
+		renderer::DescriptorSetPoolPtr m_descriptorPool;
+		renderer::DescriptorSetPtr m_descriptorSet;
+		renderer::PipelineLayoutPtr m_pipelineLayout;
+		renderer::ComputePipelinePtr m_pipeline;
+	};
+}
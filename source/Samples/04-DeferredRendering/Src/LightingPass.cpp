@@ -1,5 +1,7 @@
 #include "LightingPass.hpp"
 
+#include <Profiler.hpp>
+
 #include <Buffer/Buffer.hpp>
 #include <Buffer/StagingBuffer.hpp>
 #include <Buffer/VertexBuffer.hpp>
@@ -34,12 +36,16 @@ namespace vkapp
 {
 	namespace
 	{
-		std::vector< renderer::ShaderStageState > doCreateProgram( renderer::Device const & device )
+		std::vector< renderer::ShaderStageState > doCreateProgram( renderer::Device const & device
+			, GBufferLayout layout )
 		{
 			std::string shadersFolder = common::getPath( common::getExecutableDirectory() ) / "share" / AppName / "Shaders";
+			std::string fragmentShaderFile = layout == GBufferLayout::eCompact
+				? "opaque_lp_compact.frag"
+				: "opaque_lp.frag";
 
 			if ( !wxFileExists( shadersFolder / "opaque_lp.vert" )
-				|| !wxFileExists( shadersFolder / "opaque_lp.frag" ) )
+				|| !wxFileExists( shadersFolder / fragmentShaderFile ) )
 			{
 				throw std::runtime_error{ "Shader files are missing" };
 			}
@@ -48,94 +54,24 @@ namespace vkapp
 			shaderStages.emplace_back( device.createShaderModule( renderer::ShaderStageFlag::eVertex ) );
 			shaderStages.emplace_back( device.createShaderModule( renderer::ShaderStageFlag::eFragment ) );
 			shaderStages[0].getModule().loadShader( common::dumpTextFile( shadersFolder / "opaque_lp.vert" ) );
-			shaderStages[1].getModule().loadShader( common::dumpTextFile( shadersFolder / "opaque_lp.frag" ) );
+			shaderStages[1].getModule().loadShader( common::dumpTextFile( shadersFolder / fragmentShaderFile ) );
 			return shaderStages;
 		}
 
-		std::vector< renderer::PixelFormat > doGetFormats( renderer::TextureView const & depthView
-			, renderer::TextureView const & colourView )
+		renderer::DescriptorSetLayoutPtr doCreateGBufferDescriptorLayout( renderer::Device const & device
+			, GBufferLayout layout )
 		{
-			return
-			{
-				depthView.getFormat(),
-				colourView.getFormat(),
-			};
-		}
+			// The compact layout reads the depth buffer, followed by its three textures.
+			auto count = layout == GBufferLayout::eCompact
+				? 4u
+				: 5u;
+			std::vector< renderer::DescriptorSetLayoutBinding > bindings;
 
-		renderer::RenderPassAttachmentArray doGetAttaches( renderer::TextureView const & depthView
-			, renderer::TextureView const & colourView )
-		{
-			return renderer::RenderPassAttachmentArray
+			for ( auto i = 0u; i < count; ++i )
 			{
-				{
-					0u,
-					depthView.getFormat(),
-					renderer::SampleCountFlag::e1,
-					renderer::AttachmentLoadOp::eLoad,
-					renderer::AttachmentStoreOp::eStore,
-					renderer::AttachmentLoadOp::eLoad,
-					renderer::AttachmentStoreOp::eStore,
-					renderer::ImageLayout::eUndefined,
-					renderer::ImageLayout::eDepthStencilAttachmentOptimal,
-				},
-				{
-					1u,
-					colourView.getFormat(),
-					renderer::SampleCountFlag::e1,
-					renderer::AttachmentLoadOp::eClear,
-					renderer::AttachmentStoreOp::eStore,
-					renderer::AttachmentLoadOp::eDontCare,
-					renderer::AttachmentStoreOp::eDontCare,
-					renderer::ImageLayout::eUndefined,
-					renderer::ImageLayout::eDepthStencilAttachmentOptimal,
-				}
-			};
-		}
-
-		renderer::RenderPassPtr doCreateRenderPass( renderer::Device const & device
-			, renderer::TextureView const & depthView
-			, renderer::TextureView const & colourView )
-		{
-			renderer::RenderSubpassAttachmentArray subAttaches
-			{
-				renderer::RenderSubpassAttachment{ 1u, renderer::ImageLayout::eColourAttachmentOptimal },
-			};
-			renderer::RenderSubpassPtrArray subpasses;
-			subpasses.emplace_back( device.createRenderSubpass( renderer::PipelineBindPoint::eGraphics
-				, renderer::RenderSubpassState{ renderer::PipelineStageFlag::eColourAttachmentOutput, renderer::AccessFlag::eColourAttachmentWrite }
-				, subAttaches
-				, renderer::RenderSubpassAttachment{ 0u, renderer::ImageLayout::eDepthStencilAttachmentOptimal } ) );
-			return device.createRenderPass( doGetAttaches( depthView, colourView )
-				, std::move( subpasses )
-				, renderer::RenderSubpassState{ renderer::PipelineStageFlag::eColourAttachmentOutput
-					, renderer::AccessFlag::eColourAttachmentWrite }
-				, renderer::RenderSubpassState{ renderer::PipelineStageFlag::eColourAttachmentOutput
-					, renderer::AccessFlag::eColourAttachmentWrite } );
-		}
-
-		renderer::FrameBufferPtr doCreateFrameBuffer( renderer::RenderPass const & renderPass
-			, renderer::TextureView const & depthView
-			, renderer::TextureView const & colourView )
-		{
-			auto formats = doGetFormats( depthView, colourView );
-			renderer::FrameBufferAttachmentArray attaches;
-			attaches.emplace_back( *( renderPass.begin() + 0u ), depthView );
-			attaches.emplace_back( *( renderPass.begin() + 1u ), colourView );
-			auto dimensions = colourView.getTexture().getDimensions();
-			return renderPass.createFrameBuffer( renderer::UIVec2{ dimensions[0], dimensions[1] }
-				, std::move( attaches ) );
-		}
+				bindings.emplace_back( i, renderer::DescriptorType::eInputAttachment, renderer::ShaderStageFlag::eFragment );
+			}
 
-		renderer::DescriptorSetLayoutPtr doCreateGBufferDescriptorLayout( renderer::Device const & device )
-		{
-			std::vector< renderer::DescriptorSetLayoutBinding > bindings
-			{
-				renderer::DescriptorSetLayoutBinding{ 0u, renderer::DescriptorType::eCombinedImageSampler, renderer::ShaderStageFlag::eFragment },
-				renderer::DescriptorSetLayoutBinding{ 1u, renderer::DescriptorType::eCombinedImageSampler, renderer::ShaderStageFlag::eFragment },
-				renderer::DescriptorSetLayoutBinding{ 2u, renderer::DescriptorType::eCombinedImageSampler, renderer::ShaderStageFlag::eFragment },
-				renderer::DescriptorSetLayoutBinding{ 3u, renderer::DescriptorType::eCombinedImageSampler, renderer::ShaderStageFlag::eFragment },
-				renderer::DescriptorSetLayoutBinding{ 4u, renderer::DescriptorType::eCombinedImageSampler, renderer::ShaderStageFlag::eFragment },
-			};
 			return device.createDescriptorSetLayout( std::move( bindings ) );
 		}
 
@@ -145,13 +81,17 @@ namespace vkapp
 			{
 				renderer::DescriptorSetLayoutBinding{ 0u, renderer::DescriptorType::eUniformBuffer, renderer::ShaderStageFlag::eFragment },
 				renderer::DescriptorSetLayoutBinding{ 1u, renderer::DescriptorType::eUniformBuffer, renderer::ShaderStageFlag::eFragment },
+				renderer::DescriptorSetLayoutBinding{ 2u, renderer::DescriptorType::eUniformBuffer, renderer::ShaderStageFlag::eFragment },
+				renderer::DescriptorSetLayoutBinding{ 3u, renderer::DescriptorType::eStorageBuffer, renderer::ShaderStageFlag::eFragment },
+				renderer::DescriptorSetLayoutBinding{ 4u, renderer::DescriptorType::eStorageBuffer, renderer::ShaderStageFlag::eFragment },
 			};
 			return device.createDescriptorSetLayout( std::move( bindings ) );
 		}
 
 		renderer::DescriptorSetPtr doCreateUboDescriptorSet( renderer::DescriptorSetPool const & pool
 			, renderer::UniformBuffer< common::LightsData > const & lightsUbo
-			, renderer::UniformBuffer< common::SceneData > const & sceneUbo )
+			, renderer::UniformBuffer< common::SceneData > const & sceneUbo
+			, LightCulling const & lightCulling )
 		{
 			auto & layout = pool.getLayout();
 			auto result = pool.createDescriptorSet( 1u );
@@ -163,6 +103,18 @@ namespace vkapp
 				, sceneUbo
 				, 0u
 				, 1u );
+			result->createBinding( layout.getBinding( 2u )
+				, lightCulling.getConfigurationUbo()
+				, 0u
+				, 1u );
+			result->createBinding( layout.getBinding( 3u )
+				, lightCulling.getPointLights()
+				, 0u
+				, uint32_t( lightCulling.getPointLights().getCount() * sizeof( common::PointLight ) ) );
+			result->createBinding( layout.getBinding( 4u )
+				, lightCulling.getTileLights()
+				, 0u
+				, uint32_t( lightCulling.getTileLights().getCount() * sizeof( uint32_t ) ) );
 			result->update();
 			return result;
 		}
@@ -203,40 +155,40 @@ namespace vkapp
 	LightingPass::LightingPass( renderer::Device const & device
 		, renderer::UniformBuffer< common::LightsData > const & lightsUbo
 		, renderer::StagingBuffer & stagingBuffer
-		, renderer::TextureViewCRefArray const & views )
+		, renderer::RenderPass const & renderPass
+		, GBufferLayout layout
+		, renderer::Buffer< common::PointLight > const & pointLights
+		, renderer::Vec2 const & sceneDistances
+		, bool tiled )
 		: m_device{ device }
+		, m_layout{ layout }
 		, m_lightsUbo{ lightsUbo }
 		, m_updateCommandBuffer{ m_device.getGraphicsCommandPool().createCommandBuffer() }
 		, m_commandBuffer{ m_device.getGraphicsCommandPool().createCommandBuffer() }
 		, m_sceneUbo{ renderer::makeUniformBuffer< common::SceneData >( device, 1u, renderer::BufferTarget::eTransferDst, renderer::MemoryPropertyFlag::eDeviceLocal ) }
-		, m_gbufferDescriptorLayout{ doCreateGBufferDescriptorLayout( m_device ) }
+		, m_lightCulling{ device, pointLights, sceneDistances, tiled }
+		, m_gbufferDescriptorLayout{ doCreateGBufferDescriptorLayout( m_device, m_layout ) }
 		, m_gbufferDescriptorPool{ m_gbufferDescriptorLayout->createPool( 1u, false ) }
 		, m_uboDescriptorLayout{ doCreateUboDescriptorLayout( m_device ) }
-		, m_uboDescriptorPool{ m_uboDescriptorLayout->createPool( 1u ) }
-		, m_uboDescriptorSet{ doCreateUboDescriptorSet( *m_uboDescriptorPool, m_lightsUbo, *m_sceneUbo ) }
-		, m_renderPass{ doCreateRenderPass( m_device, views[0].get(), views[1].get() ) }
-		, m_sampler{ m_device.createSampler( renderer::WrapMode::eClampToEdge
-			, renderer::WrapMode::eClampToEdge
-			, renderer::WrapMode::eClampToEdge
-			, renderer::Filter::eNearest
-			, renderer::Filter::eNearest ) }
+		, m_uboDescriptorPool{ m_uboDescriptorLayout->createPool( 1u, false ) }
 		, m_vertexBuffer{ doCreateVertexBuffer( m_device, stagingBuffer, *m_updateCommandBuffer ) }
 		, m_vertexLayout{ doCreateVertexLayout( m_device ) }
 		, m_pipelineLayout{ m_device.createPipelineLayout( { *m_gbufferDescriptorLayout, *m_uboDescriptorLayout } ) }
-		, m_pipeline{ m_pipelineLayout->createPipeline( 
-			{
-				doCreateProgram( m_device ),
-				*m_renderPass,
-				renderer::VertexInputState::create( *m_vertexLayout ),
-				{ renderer::PrimitiveTopology::eTriangleStrip },
-				renderer::RasterisationState{ 1.0f },
-				renderer::MultisampleState{},
-				renderer::ColourBlendState::createDefault(),
-				renderer::DepthStencilState{ 0u, false, false, renderer::CompareOp::eLess }
-			} )
-		}
-		, m_queryPool{ m_device.createQueryPool( renderer::QueryType::eTimestamp, 2u, 0u ) }
 	{
+		renderer::GraphicsPipelineCreateInfo createInfo
+		{
+			doCreateProgram( m_device, m_layout ),
+			renderPass,
+			renderer::VertexInputState::create( *m_vertexLayout ),
+			{ renderer::PrimitiveTopology::eTriangleStrip },
+			renderer::RasterisationState{ 1.0f },
+			renderer::MultisampleState{},
+			renderer::ColourBlendState::createDefault(),
+			renderer::DepthStencilState{ 0u, false, false, renderer::CompareOp::eLess }
+		};
+		// The lighting is the second subpass of the opaque render pass.
+		createInfo.subpass = 1u;
+		m_pipeline = m_pipelineLayout->createPipeline( std::move( createInfo ) );
 	}
 
 	void LightingPass::update( common::SceneData const & sceneData
@@ -246,7 +198,6 @@ namespace vkapp
 	{
 		m_geometryBuffers = &geometryBuffers;
 		m_depthView = &views[0].get();
-		m_colourView = &views[1].get();
 
 		m_sceneUbo->getData( 0u ).mtxProjection = utils::inverse( sceneData.mtxProjection );
 		stagingBuffer.uploadUniformData( *m_updateCommandBuffer
@@ -256,81 +207,70 @@ namespace vkapp
 
 		auto dimensions = m_depthView->getTexture().getDimensions();
 		auto size = renderer::UIVec2{ dimensions[0], dimensions[1] };
-		m_frameBuffer = doCreateFrameBuffer( *m_renderPass, *m_depthView, *m_colourView );
+		m_lightCulling.update( stagingBuffer
+			, *m_updateCommandBuffer
+			, sceneData.mtxProjection
+			, size );
+		m_uboDescriptorSet.reset();
+		m_uboDescriptorSet = doCreateUboDescriptorSet( *m_uboDescriptorPool
+			, m_lightsUbo
+			, *m_sceneUbo
+			, m_lightCulling );
+
+		// The input attachments layouts are the ones of the lighting subpass.
 		m_gbufferDescriptorSet.reset();
 		m_gbufferDescriptorSet = m_gbufferDescriptorPool->createDescriptorSet( 0u );
-		auto & gbuffer = *m_geometryBuffers;
+		uint32_t binding = 0u;
 
-		for ( size_t i = 0; i < gbuffer.size(); ++i )
+		if ( m_layout == GBufferLayout::eCompact )
 		{
-			m_gbufferDescriptorSet->createBinding( m_gbufferDescriptorLayout->getBinding( i )
-				, *gbuffer[i].view
-				, *m_sampler );
+			m_gbufferDescriptorSet->createBinding( m_gbufferDescriptorLayout->getBinding( binding++ )
+				, *m_depthView
+				, renderer::ImageLayout::eDepthStencilReadOnlyOptimal );
+		}
+
+		for ( auto & texture : *m_geometryBuffers )
+		{
+			m_gbufferDescriptorSet->createBinding( m_gbufferDescriptorLayout->getBinding( binding++ )
+				, *texture.view
+				, renderer::ImageLayout::eShaderReadOnlyOptimal );
 		}
 
 		m_gbufferDescriptorSet->update();
 		m_commandBuffer->reset();
 		auto & commandBuffer = *m_commandBuffer;
-		static renderer::DepthStencilClearValue const depth{ 1.0, 0 };
-		static renderer::RgbaColour const colour{ 1.0f, 0.8f, 0.4f, 0.0f };
 
 		if ( commandBuffer.begin( renderer::CommandBufferUsageFlag::eSimultaneousUse ) )
 		{
-			commandBuffer.resetQueryPool( *m_queryPool, 0u, 2u );
-			commandBuffer.writeTimestamp( renderer::PipelineStageFlag::eTopOfPipe
-				, *m_queryPool
-				, 0u );
-
-			for ( auto & texture : gbuffer )
-			{
-				commandBuffer.memoryBarrier( renderer::PipelineStageFlag::eColourAttachmentOutput
-					, renderer::PipelineStageFlag::eFragmentShader
-					, texture.view->makeShaderInputResource( renderer::ImageLayout::eColourAttachmentOptimal
-						, renderer::AccessFlag::eColourAttachmentWrite ) );
-			}
-
-			commandBuffer.beginRenderPass( *m_renderPass
-				, *m_frameBuffer
-				, { depth, colour }
-				, renderer::SubpassContents::eInline );
-			commandBuffer.bindPipeline( *m_pipeline );
-			commandBuffer.setViewport( { size[0]
-				, size[1]
-				, 0
-				, 0 } );
-			commandBuffer.setScissor( { 0
-				, 0
-				, size[0]
-				, size[1] } );
-			commandBuffer.bindVertexBuffer( 0u, m_vertexBuffer->getBuffer(), 0u );
-			commandBuffer.bindDescriptorSet( *m_gbufferDescriptorSet
-				, *m_pipelineLayout );
-			commandBuffer.bindDescriptorSet( *m_uboDescriptorSet
-				, *m_pipelineLayout );
-			commandBuffer.draw( 4u );
-			commandBuffer.endRenderPass();
-			commandBuffer.writeTimestamp( renderer::PipelineStageFlag::eTopOfPipe
-				, *m_queryPool
-				, 1u );
+			m_lightCulling.cull( commandBuffer );
 			commandBuffer.end();
 		}
 	}
 
-	bool LightingPass::draw( std::chrono::nanoseconds & gpu )const
+	void LightingPass::record( renderer::CommandBuffer const & commandBuffer
+		, renderer::UIVec2 const & size )const
 	{
-		bool result = m_device.getGraphicsQueue().submit( *m_commandBuffer, nullptr );
-
-		if ( result )
-		{
-			renderer::UInt32Array values{ 0u, 0u };
-			m_queryPool->getResults( 0u
-				, 2u
-				, 0u
-				, renderer::QueryResultFlag::eWait
-				, values );
-			gpu += std::chrono::nanoseconds{ uint64_t( ( values[1] - values[0] ) / float( m_device.getTimestampPeriod() ) ) };
-		}
+		commandBuffer.bindPipeline( *m_pipeline );
+		commandBuffer.setViewport( { size[0]
+			, size[1]
+			, 0
+			, 0 } );
+		commandBuffer.setScissor( { 0
+			, 0
+			, size[0]
+			, size[1] } );
+		commandBuffer.bindVertexBuffer( 0u, m_vertexBuffer->getBuffer(), 0u );
+		commandBuffer.bindDescriptorSet( *m_gbufferDescriptorSet
+			, *m_pipelineLayout );
+		commandBuffer.bindDescriptorSet( *m_uboDescriptorSet
+			, *m_pipelineLayout );
+		commandBuffer.draw( 4u );
+	}
 
-		return result;
+	bool LightingPass::cull( common::Profiler & profiler )const
+	{
+		return profiler.submit( m_device.getGraphicsQueue()
+			, *m_commandBuffer
+			, "Light culling" );
 	}
 }
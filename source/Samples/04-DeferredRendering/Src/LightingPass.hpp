@@ -1,47 +1,74 @@
 #pragma once
 
-#include "Prerequisites.hpp"
+#include "LightCulling.hpp"
 
 #include <Pipeline/VertexLayout.hpp>
 
 namespace vkapp
 {
+	/**
+	*\~english
+	*\brief
+	*	The lighting pass, run in the second subpass of the geometry pass render pass.
+	*\~french
+	*\brief
+	*	La passe d'éclairage, lancée dans la seconde sous-passe de la passe de rendu de la passe géométrique.
+	*/
 	class LightingPass
 	{
 	public:
 		LightingPass( renderer::Device const & device
 			, renderer::UniformBuffer< common::LightsData > const & lightsUbo
 			, renderer::StagingBuffer & stagingBuffer
-			, renderer::TextureViewCRefArray const & views );
+			, renderer::RenderPass const & renderPass
+			, GBufferLayout layout
+			, renderer::Buffer< common::PointLight > const & pointLights
+			, renderer::Vec2 const & sceneDistances
+			, bool tiled );
 		void update( common::SceneData const & sceneData
 			, renderer::StagingBuffer & stagingBuffer
 			, renderer::TextureViewCRefArray const & views
 			, GeometryPassResult const & geometryBuffers );
-		bool draw( std::chrono::nanoseconds & gpu )const;
+		/**
+		*\~english
+		*\brief
+		*	Records the lighting draw, in the lighting subpass.
+		*\~french
+		*\brief
+		*	Enregistre le dessin de l'éclairage, dans la sous-passe d'éclairage.
+		*/
+		void record( renderer::CommandBuffer const & commandBuffer
+			, renderer::UIVec2 const & size )const;
+		/**
+		*\~english
+		*\brief
+		*	Submits the lights culling, which must precede the opaque render pass.
+		*\~french
+		*\brief
+		*	Soumet le culling des sources, qui doit précéder la passe de rendu opaque.
+		*/
+		bool cull( common::Profiler & profiler )const;
 
 	private:
 		renderer::Device const & m_device;
+		GBufferLayout m_layout;
 		renderer::UniformBuffer< common::LightsData > const & m_lightsUbo;
-		renderer::TextureView const * m_colourView{ nullptr };
 		renderer::TextureView const * m_depthView{ nullptr };
 		GeometryPassResult const * m_geometryBuffers{ nullptr };
 
 		renderer::CommandBufferPtr m_updateCommandBuffer;
 		renderer::CommandBufferPtr m_commandBuffer;
 		renderer::UniformBufferPtr< common::SceneData > m_sceneUbo;
+		LightCulling m_lightCulling;
 		renderer::DescriptorSetLayoutPtr m_uboDescriptorLayout;
 		renderer::DescriptorSetPoolPtr m_uboDescriptorPool;
 		renderer::DescriptorSetPtr m_uboDescriptorSet;
 		renderer::DescriptorSetLayoutPtr m_gbufferDescriptorLayout;
 		renderer::DescriptorSetPoolPtr m_gbufferDescriptorPool;
 		renderer::DescriptorSetPtr m_gbufferDescriptorSet;
-		renderer::RenderPassPtr m_renderPass;
-		renderer::SamplerPtr m_sampler;
 		renderer::VertexBufferPtr< common::TexturedVertexData > m_vertexBuffer;
 		renderer::VertexLayoutPtr m_vertexLayout;
 		renderer::PipelineLayoutPtr m_pipelineLayout;
 		renderer::PipelinePtr m_pipeline;
-		renderer::FrameBufferPtr m_frameBuffer;
-		renderer::QueryPoolPtr m_queryPool;
 	};
 }
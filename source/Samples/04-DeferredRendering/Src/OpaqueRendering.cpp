@@ -2,6 +2,8 @@
 
 #include "RenderTarget.hpp"
 
+#include <Profiler.hpp>
+
 #include <Buffer/Buffer.hpp>
 #include <Buffer/StagingBuffer.hpp>
 #include <Buffer/VertexBuffer.hpp>
@@ -49,6 +51,7 @@ namespace vkapp
 				result.emplace_back( *texture.view );
 			}
 
+			result.emplace_back( views[1].get() );
 			return result;
 		}
 	}
@@ -60,7 +63,12 @@ namespace vkapp
 		, renderer::TextureViewCRefArray const & views
 		, common::TextureNodePtrArray const & textureNodes
 		, renderer::UniformBuffer< common::SceneData > const & sceneUbo
-		, renderer::UniformBuffer< common::LightsData > const & lightsUbo )
+		, renderer::UniformBuffer< common::LightsData > const & lightsUbo
+		, GBufferLayout layout
+		, renderer::Buffer< common::PointLight > const & pointLights
+		, renderer::Vec2 const & sceneDistances
+		, bool tiled
+		, GBufferTimings & timings )
 		: common::OpaqueRendering{ std::move( renderer )
 			, scene
 			, stagingBuffer
@@ -72,27 +80,44 @@ namespace vkapp
 		, m_lightingPass{ m_renderer->getDevice()
 			, lightsUbo
 			, stagingBuffer
-			, views }
+			, static_cast< GeometryPass const & >( *m_renderer ).getRenderPass()
+			, layout
+			, pointLights
+			, sceneDistances
+			, tiled }
+		, m_timings{ timings }
 	{
 		m_lightingPass.update( m_sceneUbo.getData( 0u )
 			, m_stagingBuffer
 			, views
 			, gbuffer );
+		static_cast< GeometryPass & >( *m_renderer ).setLightingPass( m_lightingPass );
 	}
 
 	void OpaqueRendering::update( common::RenderTarget const & target )
 	{
-		m_renderer->update( target );
+		// The lighting descriptors are updated before the geometry pass records them.
 		m_lightingPass.update( m_sceneUbo.getData( 0u )
 			, m_stagingBuffer
 			, { target.getDepthView(), target.getColourView() }
 			, static_cast< RenderTarget const & >( target ).getGBuffer() );
+		m_renderer->update( target );
 	}
 
-	bool OpaqueRendering::draw( std::chrono::nanoseconds & gpu )const
+	bool OpaqueRendering::draw( common::Profiler & profiler )const
 	{
-		auto result = m_renderer->draw( gpu );
-		result &= m_lightingPass.draw( gpu );
+		auto result = m_lightingPass.cull( profiler );
+		result &= m_renderer->draw( profiler );
+
+		// The profiler resolves a frame FrameCount frames later, the first ones would hence
+		// still measure the previous G-buffer layout.
+		if ( result && ++m_drawnFrames > common::Profiler::FrameCount )
+		{
+			m_timings.total += profiler.getGpuTime( "Light culling" )
+				+ profiler.getGpuTime( "Opaque nodes" );
+			++m_timings.count;
+		}
+
 		return result;
 	}
 }
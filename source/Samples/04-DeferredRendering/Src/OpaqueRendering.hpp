@@ -18,14 +18,21 @@ namespace vkapp
 			, renderer::TextureViewCRefArray const & views
 			, common::TextureNodePtrArray const & textureNodes
 			, renderer::UniformBuffer< common::SceneData > const & sceneUbo
-			, renderer::UniformBuffer< common::LightsData > const & lightsUbo );
+			, renderer::UniformBuffer< common::LightsData > const & lightsUbo
+			, GBufferLayout layout
+			, renderer::Buffer< common::PointLight > const & pointLights
+			, renderer::Vec2 const & sceneDistances
+			, bool tiled
+			, GBufferTimings & timings );
 		void update( common::RenderTarget const & target )override;
-		bool draw( std::chrono::nanoseconds & gpu )const override;
+		bool draw( common::Profiler & profiler )const override;
 
 	private:
 		renderer::UniformBuffer< common::SceneData > const & m_sceneUbo;
 		renderer::UniformBuffer< common::LightsData > const & m_lightsUbo;
 		renderer::StagingBuffer & m_stagingBuffer;
 		LightingPass m_lightingPass;
+		GBufferTimings & m_timings;
+		mutable uint32_t m_drawnFrames{ 0u };
 	};
 }
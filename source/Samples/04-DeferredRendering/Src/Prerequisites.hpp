@@ -10,12 +10,43 @@ namespace vkapp
 		renderer::TextureViewPtr view;
 	};
 
-	using GeometryPassResult = std::array < GeometryPassTexture, 5u >;
+	using GeometryPassResult = std::vector< GeometryPassTexture >;
+	/**
+	*\~english
+	*\brief
+	*	The G-buffer layouts.
+	*\~french
+	*\brief
+	*	Les agencements du G-buffer.
+	*/
+	enum class GBufferLayout
+	{
+		//!\~english	Full precision, position and normal in RGBA32F textures.
+		//!\~french	Pleine précision, position et normale dans des textures RGBA32F.
+		eFull,
+		//!\~english	Position from the depth buffer, octahedral normal in RGB10A2, colours in RGBA8.
+		//!\~french	Position depuis le tampon de profondeur, normale octaédrique en RGB10A2, couleurs en RGBA8.
+		eCompact,
+	};
+	/**
+	*\~english
+	*\brief
+	*	The GPU time spent in the opaque passes, for a G-buffer layout.
+	*\~french
+	*\brief
+	*	Le temps GPU passé dans les passes opaques, pour un agencement de G-buffer.
+	*/
+	struct GBufferTimings
+	{
+		std::chrono::nanoseconds total{ 0 };
+		uint32_t count{ 0u };
+	};
 
 	static wxString const AppName = wxT( "04-DeferredRendering" );
 	static wxString const AppDesc = wxT( "Deferred Rendering" );
 
 	class Application;
+	class LightingPass;
 	class MainFrame;
 	class OpaqueRendering;
 	class RenderPanel;
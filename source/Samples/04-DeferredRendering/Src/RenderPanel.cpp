@@ -7,6 +7,8 @@
 
 #include <Buffer/UniformBuffer.hpp>
 
+#include <algorithm>
+
 namespace vkapp
 {
 	RenderPanel::RenderPanel( wxWindow * parent
@@ -32,12 +34,49 @@ namespace vkapp
 
 	void RenderPanel::doUpdateOverlays( common::Gui const & overlay )
 	{
-		//if ( overlay.header( "Settings" ) )
-		//{
-		//	if ( overlay.checkBox( "Wireframe", &wireframe ) )
-		//	{
-		//		buildCommandBuffers();
-		//	}
-		//}
+		auto & target = static_cast< RenderTarget & >( *m_renderTarget );
+
+		if ( overlay.header( "G-buffer" ) )
+		{
+			bool compact = target.getGBufferLayout() == GBufferLayout::eCompact;
+
+			if ( overlay.checkBox( "Compact", &compact ) )
+			{
+				target.setGBufferLayout( compact
+					? GBufferLayout::eCompact
+					: GBufferLayout::eFull );
+			}
+
+			for ( auto layout : { GBufferLayout::eFull, GBufferLayout::eCompact } )
+			{
+				auto & timings = target.getTimings( layout );
+				auto average = timings.count
+					? std::chrono::duration_cast< std::chrono::microseconds >( timings.total / timings.count ).count() / 1000.0
+					: 0.0;
+				overlay.text( "%s: %u B/px, %.3f ms"
+					, layout == GBufferLayout::eCompact ? "Compact" : "Full"
+					, RenderTarget::getGBufferSize( layout )
+					, average );
+			}
+		}
+
+		if ( overlay.header( "Lights" ) )
+		{
+			static std::vector< uint32_t > const counts{ 16u, 256u, 4096u };
+			auto it = std::find( counts.begin(), counts.end(), target.getPointLightsCount() );
+			int32_t index = int32_t( std::distance( counts.begin(), it ) );
+
+			if ( overlay.comboBox( "Point lights", &index, { "16", "256", "4096" } ) )
+			{
+				target.setPointLightsCount( counts[size_t( index )] );
+			}
+
+			bool tiled = target.isTiledLighting();
+
+			if ( overlay.checkBox( "Tiled culling", &tiled ) )
+			{
+				target.setTiledLighting( tiled );
+			}
+		}
 	}
 }
@@ -3,17 +3,91 @@
 #include "OpaqueRendering.hpp"
 #include "TransparentRendering.hpp"
 
+#include <Bvh.hpp>
 #include <FileUtils.hpp>
 #include <OpaqueRendering.hpp>
+#include <Scene.hpp>
 #include <TransparentRendering.hpp>
 
 #include <Buffer/StagingBuffer.hpp>
 #include <Buffer/UniformBuffer.hpp>
+#include <Core/Device.hpp>
 
 #include <Utils/Transform.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <random>
+
 namespace vkapp
 {
+	namespace
+	{
+		// The object's distance to the camera.
+		static float constexpr ObjectDistance = 5.0f;
+
+		renderer::Vec2 getSceneDistances( common::Scene const & scene )
+		{
+			// The object rotates around its origin, so its bounding sphere gives its view distances range.
+			float radius = 0.0f;
+
+			for ( auto & box : common::getBoundingBoxes( scene.object ) )
+			{
+				if ( !box.isValid() )
+				{
+					continue;
+				}
+
+				// The box corner farthest from the origin.
+				auto x = std::max( std::abs( box.min[0] ), std::abs( box.max[0] ) );
+				auto y = std::max( std::abs( box.min[1] ), std::abs( box.max[1] ) );
+				auto z = std::max( std::abs( box.min[2] ), std::abs( box.max[2] ) );
+				radius = std::max( radius, std::sqrt( x * x + y * y + z * z ) );
+			}
+
+			return renderer::Vec2{ std::max( 0.01f, ObjectDistance - radius )
+				, ObjectDistance + radius };
+		}
+
+		std::vector< renderer::PixelFormat > const & getGBufferFormats( GBufferLayout layout )
+		{
+			static std::vector< renderer::PixelFormat > const full
+			{
+				renderer::PixelFormat::eR32F,
+				utils::PixelFormat::eRGBA32F,
+				utils::PixelFormat::eRGBA32F,
+				utils::PixelFormat::eRGBA32F,
+				utils::PixelFormat::eRGBA32F,
+			};
+			// The position is rebuilt from the depth buffer.
+			static std::vector< renderer::PixelFormat > const compact
+			{
+				utils::PixelFormat::eR8G8B8A8_SRGB,
+				utils::PixelFormat::eR10G10B10A2,
+				utils::PixelFormat::eR8G8B8A8,
+			};
+			return layout == GBufferLayout::eCompact
+				? compact
+				: full;
+		}
+
+		renderer::MemoryPropertyFlags getGBufferMemoryFlags( renderer::Device const & device )
+		{
+			// The G-buffer never leaves the render pass, tiled GPUs don't need to back it with memory.
+			auto & memoryTypes = device.getMemoryProperties().memoryTypes;
+			auto it = std::find_if( memoryTypes.begin()
+				, memoryTypes.end()
+				, []( renderer::MemoryType const & lookup )
+				{
+					return renderer::checkFlag( lookup.propertyFlags, renderer::MemoryPropertyFlag::eDeviceLocal )
+						&& renderer::checkFlag( lookup.propertyFlags, renderer::MemoryPropertyFlag::eLazilyAllocated );
+				} );
+			return it == memoryTypes.end()
+				? renderer::MemoryPropertyFlags{ renderer::MemoryPropertyFlag::eDeviceLocal }
+				: renderer::MemoryPropertyFlag::eDeviceLocal | renderer::MemoryPropertyFlag::eLazilyAllocated;
+		}
+	}
+
 	RenderTarget::RenderTarget( renderer::Device const & device
 		, renderer::UIVec2 const & size
 		, common::Scene && scene
@@ -33,17 +107,63 @@ namespace vkapp
 			, renderer::MemoryPropertyFlag::eDeviceLocal ) }
 	{
 		doCreateGBuffer();
+		doCreatePointLights();
 		doInitialise();
 		doUpdateMatrixUbo( size );
 		doInitialiseLights();
 	}
 
+	void RenderTarget::setGBufferLayout( GBufferLayout layout )
+	{
+		if ( layout != m_layout )
+		{
+			m_device.waitIdle();
+			m_layout = layout;
+			doCreateGBuffer();
+			doResetOpaqueRendering();
+		}
+	}
+
+	void RenderTarget::setPointLightsCount( uint32_t count )
+	{
+		if ( count != m_pointLightsCount )
+		{
+			m_device.waitIdle();
+			m_pointLightsCount = count;
+			m_timings = {};
+			doCreatePointLights();
+			doResetOpaqueRendering();
+		}
+	}
+
+	void RenderTarget::setTiledLighting( bool tiled )
+	{
+		if ( tiled != m_tiled )
+		{
+			m_tiled = tiled;
+			m_timings = {};
+			doResetOpaqueRendering();
+		}
+	}
+
+	uint32_t RenderTarget::getGBufferSize( GBufferLayout layout )
+	{
+		uint32_t result = utils::pixelSize( renderer::PixelFormat::eD32F );
+
+		for ( auto format : getGBufferFormats( layout ) )
+		{
+			result += utils::pixelSize( format );
+		}
+
+		return result;
+	}
+
 	void RenderTarget::doUpdate( std::chrono::microseconds const & duration )
 	{
 		static renderer::Mat4 const originalTranslate = []()
 		{
 			renderer::Mat4 result;
-			result = utils::translate( result, { 0, 0, -5 } );
+			result = utils::translate( result, { 0, 0, -ObjectDistance } );
 			return result;
 		}();
 		m_rotate = utils::rotate( m_rotate
@@ -60,6 +180,7 @@ namespace vkapp
 	{
 		doUpdateMatrixUbo( size );
 		doCreateGBuffer();
+		m_timings = {};
 	}
 
 	common::OpaqueRenderingPtr RenderTarget::doCreateOpaqueRendering( renderer::Device const & device
@@ -68,10 +189,15 @@ namespace vkapp
 		, common::Scene const & scene
 		, common::TextureNodePtrArray const & textureNodes )
 	{
+		std::string fragmentShaderFile = m_layout == GBufferLayout::eCompact
+			? "opaque_gp_compact.frag"
+			: "opaque_gp.frag";
 		return std::make_unique< OpaqueRendering >( std::make_unique< GeometryPass >( device
-				, common::getPath( common::getExecutableDirectory() ) / "share" / AppName / "Shaders" / "opaque_gp.frag"
+				, common::getPath( common::getExecutableDirectory() ) / "share" / AppName / "Shaders" / fragmentShaderFile
 				, m_gbuffer
 				, views[0].get().getFormat()
+				, views[1].get().getFormat()
+				, m_layout
 				, *m_sceneUbo
 				, *m_objectUbo )
 			, scene
@@ -80,7 +206,12 @@ namespace vkapp
 			, views
 			, textureNodes
 			, *m_sceneUbo
-			, *m_lightsUbo );
+			, *m_lightsUbo
+			, m_layout
+			, *m_pointLights
+			, getSceneDistances( scene )
+			, m_tiled
+			, m_timings[size_t( m_layout )] );
 	}
 
 	common::TransparentRenderingPtr RenderTarget::doCreateTransparentRendering( renderer::Device const & device
@@ -158,17 +289,47 @@ namespace vkapp
 			, renderer::PipelineStageFlag::eFragmentShader );
 	}
 
-	void RenderTarget::doCreateGBuffer()
+	void RenderTarget::doCreatePointLights()
 	{
-		static renderer::PixelFormat const formats[]
+		// The lights are scattered around the model, directly in view space,
+		// where the lighting pass rebuilds the positions.
+		std::mt19937 engine;
+		std::uniform_real_distribution< float > x{ -3.0f, 3.0f };
+		std::uniform_real_distribution< float > y{ -2.0f, 2.0f };
+		std::uniform_real_distribution< float > z{ -8.0f, -2.0f };
+		std::uniform_real_distribution< float > colour{ 0.2f, 1.0f };
+		// The radius shrinks with the count, to keep a similar overlap.
+		auto radius = 2.0f * std::cbrt( 16.0f / float( m_pointLightsCount ) );
+		std::vector< common::PointLight > lights;
+		lights.reserve( m_pointLightsCount );
+
+		for ( auto i = 0u; i < m_pointLightsCount; ++i )
 		{
-			renderer::PixelFormat::eR32F,
-			utils::PixelFormat::eRGBA32F,
-			utils::PixelFormat::eRGBA32F,
-			utils::PixelFormat::eRGBA32F,
-			utils::PixelFormat::eRGBA32F,
-		};
+			common::PointLight light;
+			light.base.colour = renderer::Vec4{ colour( engine ), colour( engine ), colour( engine ), 1.0f };
+			light.base.intensities = renderer::Vec4{ 1.0f, 32.0f, 0.0f, 0.0f };
+			light.position = renderer::Vec4{ x( engine ), y( engine ), z( engine ), radius };
+			// The attenuation reaches 1/256 at the radius.
+			light.attenation = renderer::Vec4{ 1.0f, 0.0f, 255.0f / ( radius * radius ), 0.0f };
+			lights.push_back( light );
+		}
+
+		m_pointLights = renderer::makeBuffer< common::PointLight >( m_device
+			, m_pointLightsCount
+			, renderer::BufferTarget::eStorageBuffer | renderer::BufferTarget::eTransferDst
+			, renderer::MemoryPropertyFlag::eDeviceLocal );
+		m_stagingBuffer->uploadBufferData( *m_updateCommandBuffer
+			, lights
+			, *m_pointLights );
+	}
+
+	void RenderTarget::doCreateGBuffer()
+	{
+		auto & formats = getGBufferFormats( m_layout );
+		auto memoryFlags = getGBufferMemoryFlags( m_device );
 		size_t index = 0u;
+		m_gbuffer.clear();
+		m_gbuffer.resize( formats.size() );
 		renderer::UIVec2 size
 		{
 			getColourView().getTexture().getDimensions()[0],
@@ -180,7 +341,10 @@ namespace vkapp
 			texture.texture = m_device.createTexture();
 			texture.texture->setImage( formats[index]
 				, size
-				, renderer::ImageUsageFlag::eColourAttachment | renderer::ImageUsageFlag::eSampled );
+				, renderer::ImageUsageFlag::eColourAttachment | renderer::ImageUsageFlag::eInputAttachment | renderer::ImageUsageFlag::eTransientAttachment
+				, renderer::ImageTiling::eOptimal
+				, renderer::SampleCountFlag::e1
+				, memoryFlags );
 			texture.view = texture.texture->createView( renderer::TextureType::e2D
 				, texture.texture->getFormat() );
 			++index;
@@ -4,6 +4,8 @@
 
 #include <RenderTarget.hpp>
 
+#include <Buffer/Buffer.hpp>
+
 namespace vkapp
 {
 	class RenderTarget
@@ -15,11 +17,68 @@ namespace vkapp
 			, common::Scene && scene
 			, common::ImagePtrArray && images );
 
+		/**
+		*\~english
+		*\brief
+		*	Changes the G-buffer layout, and recreates the opaque passes.
+		*\~french
+		*\brief
+		*	Change l'agencement du G-buffer, et recrée les passes opaques.
+		*/
+		void setGBufferLayout( GBufferLayout layout );
+		/**
+		*\~english
+		*\return
+		*	The bytes per pixel of the opaque render pass attachments, depth buffer included.
+		*\~french
+		*\return
+		*	Les octets par pixel des attaches de la passe de rendu opaque, tampon de profondeur inclus.
+		*/
+		static uint32_t getGBufferSize( GBufferLayout layout );
+		/**
+		*\~english
+		*\brief
+		*	Regenerates the point lights, and recreates the opaque passes.
+		*\~french
+		*\brief
+		*	Régénère les sources ponctuelles, et recrée les passes opaques.
+		*/
+		void setPointLightsCount( uint32_t count );
+		/**
+		*\~english
+		*\brief
+		*	Enables or disables the tiled light culling, and recreates the opaque passes.
+		*\~french
+		*\brief
+		*	Active ou désactive le culling des sources par tuiles, et recrée les passes opaques.
+		*/
+		void setTiledLighting( bool tiled );
+
 		inline GeometryPassResult const & getGBuffer()const
 		{
 			return m_gbuffer;
 		}
 
+		inline GBufferLayout getGBufferLayout()const
+		{
+			return m_layout;
+		}
+
+		inline GBufferTimings const & getTimings( GBufferLayout layout )const
+		{
+			return m_timings[size_t( layout )];
+		}
+
+		inline uint32_t getPointLightsCount()const
+		{
+			return m_pointLightsCount;
+		}
+
+		inline bool isTiledLighting()const
+		{
+			return m_tiled;
+		}
+
 	private:
 		void doUpdate( std::chrono::microseconds const & duration )override;
 		virtual void doResize( renderer::UIVec2 const & size )override;
@@ -35,13 +94,19 @@ namespace vkapp
 			, common::TextureNodePtrArray const & textureNodes )override;
 		void doUpdateMatrixUbo( renderer::UIVec2 const & size );
 		void doInitialiseLights();
+		void doCreatePointLights();
 		void doCreateGBuffer();
 
 	private:
 		renderer::UniformBufferPtr< common::SceneData > m_sceneUbo;
 		renderer::UniformBufferPtr< common::ObjectData > m_objectUbo;
 		renderer::UniformBufferPtr< common::LightsData > m_lightsUbo;
+		renderer::BufferPtr< common::PointLight > m_pointLights;
+		uint32_t m_pointLightsCount{ 16u };
+		bool m_tiled{ true };
 		renderer::Mat4 m_rotate;
+		GBufferLayout m_layout{ GBufferLayout::eFull };
 		GeometryPassResult m_gbuffer;
+		std::array< GBufferTimings, 2u > m_timings;
 	};
 }
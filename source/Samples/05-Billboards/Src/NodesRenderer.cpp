@@ -30,4 +30,13 @@ namespace vkapp
 			, 0u
 			, 1u );
 	}
+
+	bool NodesRenderer::doGetCullingMatrices( renderer::Mat4 & viewProjection
+		, renderer::Mat4 & model )const
+	{
+		auto & scene = m_sceneUbo.getData( 0u );
+		viewProjection = scene.mtxProjection * scene.mtxView;
+		model = renderer::Mat4{ 1.0f };
+		return true;
+	}
 }
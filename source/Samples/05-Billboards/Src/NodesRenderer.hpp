@@ -21,6 +21,8 @@ namespace vkapp
 		void doFillBillboardDescriptorLayoutBindings( renderer::DescriptorSetLayoutBindingArray & bindings )override;
 		void doFillBillboardDescriptorSet( renderer::DescriptorSetLayout & descriptorLayout
 			, renderer::DescriptorSet & descriptorSet )override;
+		bool doGetCullingMatrices( renderer::Mat4 & viewProjection
+			, renderer::Mat4 & model )const override;
 
 	private:
 		renderer::UniformBuffer< common::SceneData > const & m_sceneUbo;
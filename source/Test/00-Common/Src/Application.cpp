@@ -1,9 +1,15 @@
 #include "Application.hpp"
 
+#include "Benchmark.hpp"
 #include "FileUtils.hpp"
 #include "MainFrame.hpp"
 
+#include <Core/CaptureRenderer.hpp>
+#include <Core/Device.hpp>
+
 #include <wx/cmdline.h>
+#include <wx/log.h>
+#include <wx/msgout.h>
 
 #include <fstream>
 
@@ -197,6 +203,97 @@ namespace common
 				wxRemoveFile( LogFileName );
 			}
 		}
+
+		void doLoadPlugins( std::vector< RendererPlugin > & plugins
+			, RendererFactory & factory )
+		{
+			StringArray files;
+
+			if ( listDirectoryFiles( getExecutableDirectory(), files, false ) )
+			{
+				for ( auto file : files )
+				{
+					if ( file.find( ".dll" ) != std::string::npos 
+						|| file.find( ".so" ) != std::string::npos )
+					try
+					{
+						renderer::DynamicLibrary lib{ file };
+						plugins.emplace_back( std::move( lib )
+							, factory );
+					}
+					catch ( std::exception & exc )
+					{
+						std::clog << exc.what() << std::endl;
+					}
+				}
+			}
+		}
+
+		void doAddOptions( wxCmdLineParser & parser )
+		{
+			parser.AddSwitch( wxT( "h" ), wxT( "help" ), _( "Displays this help" ) );
+			parser.AddSwitch( wxT( "gl" ), wxEmptyString, _( "Defines the renderer to OpenGl" ) );
+			parser.AddSwitch( wxT( "vk" ), wxEmptyString, _( "Defines the renderer to Vulkan" ) );
+			parser.AddSwitch( wxT( "null" ), wxEmptyString, _( "Defines the renderer to the null one, which draws nothing" ) );
+			parser.AddSwitch( wxEmptyString, wxT( "headless" ), _( "Renders offscreen, the window still being shown (needs a display server)" ) );
+			parser.AddOption( wxEmptyString, wxT( "bench" ), _( "Runs the given number of frames, without any window, and writes their timings and statistics" ), wxCMD_LINE_VAL_NUMBER );
+			parser.AddOption( wxEmptyString, wxT( "bench-output" ), _( "Defines the benchmark JSON file (defaults to <name>-<renderer>.json)" ) );
+			parser.AddOption( wxEmptyString, wxT( "capture" ), _( "Captures the renderer calls into the given file, for CaptureReplay" ) );
+			parser.AddOption( wxEmptyString, wxT( "capture-first" ), _( "Defines the first captured frame (defaults to 0)" ), wxCMD_LINE_VAL_NUMBER );
+			parser.AddOption( wxEmptyString, wxT( "capture-frames" ), _( "Defines the captured frames count (defaults to 1)" ), wxCMD_LINE_VAL_NUMBER );
+		}
+
+		bool doParseOptions( wxCmdLineParser & parser
+			, wxString & rendererName
+			, capture_renderer::CaptureOptions & capture )
+		{
+			bool result = parser.Parse( false ) == 0;
+
+			// S'il y avait des erreurs ou "-h" ou "--help", on affiche l'aide et on sort
+			if ( !result || parser.Found( wxT( 'h' ) ) )
+			{
+				parser.Usage();
+				return false;
+			}
+
+			rendererName = wxT( "vk" );
+
+			if ( parser.Found( wxT( "vk" ) ) )
+			{
+				rendererName = wxT( "vk" );
+			}
+			else if ( parser.Found( wxT( "gl" ) ) )
+			{
+				rendererName = wxT( "gl" );
+			}
+			else if ( parser.Found( wxT( "null" ) ) )
+			{
+				rendererName = wxT( "null" );
+			}
+
+			wxString captureFile;
+
+			if ( parser.Found( wxT( "capture" ), &captureFile ) )
+			{
+				long firstFrame{ 0 };
+				long captureFrames{ 1 };
+				parser.Found( wxT( "capture-first" ), &firstFrame );
+				parser.Found( wxT( "capture-frames" ), &captureFrames );
+
+				if ( firstFrame < 0 || captureFrames <= 0 )
+				{
+					std::cerr << "The captured frames range is invalid" << std::endl;
+					parser.Usage();
+					return false;
+				}
+
+				capture.fileName = captureFile.ToStdString();
+				capture.firstFrame = uint32_t( firstFrame );
+				capture.frameCount = uint32_t( captureFrames );
+			}
+
+			return true;
+		}
 	}
 
 	App::App ( wxString const & name )
@@ -241,26 +338,7 @@ namespace common
 
 		wxInitAllImageHandlers();
 		bool result = false;
-		StringArray files;
-
-		if ( listDirectoryFiles( getExecutableDirectory(), files, false ) )
-		{
-			for ( auto file : files )
-			{
-				if ( file.find( ".dll" ) != std::string::npos 
-					|| file.find( ".so" ) != std::string::npos )
-				try
-				{
-					renderer::DynamicLibrary lib{ file };
-					m_plugins.emplace_back( std::move( lib )
-						, m_factory );
-				}
-				catch ( std::exception & exc )
-				{
-					std::clog << exc.what() << std::endl;
-				}
-			}
-		}
+		doLoadPlugins( m_plugins, m_factory );
 
 		try
 		{
@@ -316,32 +394,155 @@ namespace common
 	bool App::doParseCommandLine()
 	{
 		wxCmdLineParser parser( wxApp::argc, wxApp::argv );
-		parser.AddSwitch( wxT( "h" ), wxT( "help" ), _( "Displays this help" ) );
-		parser.AddSwitch( wxT( "gl" ), wxEmptyString, _( "Defines the renderer to OpenGl" ) );
-		parser.AddSwitch( wxT( "vk" ), wxEmptyString, _( "Defines the renderer to Vulkan" ) );
-		bool result = parser.Parse( false ) == 0;
+		doAddOptions( parser );
 
-		// S'il y avait des erreurs ou "-h" ou "--help", on affiche l'aide et on sort
-		if ( !result || parser.Found( wxT( 'h' ) ) )
+		if ( !doParseOptions( parser, m_rendererName, m_capture ) )
 		{
-			parser.Usage();
-			result = false;
+			return false;
 		}
 
-		if ( result )
+		if ( parser.Found( wxT( "bench" ) ) )
 		{
-			m_rendererName = wxT( "vk" );
+			// The benchmark is run before wxWidgets' initialisation, by the applications supporting it.
+			std::cerr << "This test application doesn't support the benchmark" << std::endl;
+			return false;
+		}
 
-			if ( parser.Found( wxT( "vk" ) ) )
+		m_headless = parser.Found( wxT( "headless" ) );
+		return true;
+	}
+
+	renderer::RendererPtr createRenderer( RendererFactory & factory
+		, wxString const & name
+		, wxString const & rendererName
+		, capture_renderer::CaptureOptions const & capture )
+	{
+		renderer::Renderer::Configuration config
+		{
+			name.ToStdString(),
+			"RendererLib",
+#if !defined( NDEBUG )
+			true,
+#else
+			false,
+#endif
+		};
+		auto result = factory.create( rendererName.ToStdString(), config );
+
+		if ( !capture.fileName.empty() )
+		{
+			result = std::make_unique< capture_renderer::Renderer >( std::move( result )
+				, config
+				, capture );
+		}
+
+		return result;
+	}
+
+	bool isBenchmarkCommandLine( int argc, char ** argv )
+	{
+		for ( int i = 1; i < argc; ++i )
+		{
+			std::string arg{ argv[i] };
+
+			if ( arg == "--bench"
+				|| arg.find( "--bench=" ) == 0u )
 			{
-				m_rendererName = wxT( "vk" );
+				return true;
 			}
-			else if ( parser.Found( wxT( "gl" ) ) )
+		}
+
+		return false;
+	}
+
+	int runBenchmark( wxString const & name
+		, int argc
+		, char ** argv
+		, ScenarioCreator const & creator )
+	{
+		// wxWidgets isn't initialised, its messages go straight to the standard outputs.
+		delete wxMessageOutput::Set( new wxMessageOutputStderr );
+		delete wxLog::SetActiveTarget( new wxLogStderr );
+		wxInitAllImageHandlers();
+		std::vector< RendererPlugin > plugins;
+		RendererFactory factory;
+		doLoadPlugins( plugins, factory );
+
+		wxCmdLineParser parser( argc, argv );
+		doAddOptions( parser );
+		wxString rendererName;
+		capture_renderer::CaptureOptions capture;
+		long frameCount{ 0 };
+		wxString output;
+		int result = EXIT_FAILURE;
+
+		if ( doParseOptions( parser, rendererName, capture )
+			&& parser.Found( wxT( "bench" ), &frameCount ) )
+		{
+			if ( frameCount <= 0 )
+			{
+				std::cerr << "The benchmark frame count must be positive" << std::endl;
+				parser.Usage();
+			}
+			else
 			{
-				m_rendererName = wxT( "gl" );
+				if ( !parser.Found( wxT( "bench-output" ), &output ) )
+				{
+					output = name + wxT( "-" ) + rendererName + wxT( ".json" );
+				}
+
+				try
+				{
+					Benchmark benchmark{ name.ToStdString()
+						, rendererName.ToStdString()
+						, uint32_t( frameCount ) };
+					auto renderer = createRenderer( factory, name, rendererName, capture );
+					std::cout << "Renderer instance created." << std::endl;
+					// No window: the renderer draws into an offscreen swap chain.
+					auto scenario = creator( renderer->createConnection( 0u, renderer::WindowHandle{} )
+						, renderer::UIVec2{ uint32_t( WindowSize.GetWidth() ), uint32_t( WindowSize.GetHeight() ) }
+						, *renderer );
+					auto connection = scenario->onFrame.connect( [&benchmark]( std::chrono::microseconds const & durationGpu
+						, std::chrono::microseconds const & durationCpu )
+						{
+							benchmark.addFrame( durationGpu, durationCpu );
+						} );
+					benchmark.setDevice( &scenario->getDevice() );
+					// Bounded, for a failing submission not to loop forever.
+					auto maxFrames = uint32_t( frameCount ) + Benchmark::WarmupFrames;
+
+					for ( uint32_t frame = 0u; frame < maxFrames && !benchmark.isComplete(); ++frame )
+					{
+						if ( !scenario->draw() )
+						{
+							break;
+						}
+					}
+
+					benchmark.setDevice( nullptr );
+
+					if ( !benchmark.isComplete() )
+					{
+						std::cerr << "Only part of the benchmark frames could be drawn" << std::endl;
+					}
+					else if ( benchmark.write( output.ToStdString() ) )
+					{
+						std::cout << "Benchmark written to " << output << std::endl;
+						result = EXIT_SUCCESS;
+					}
+					else
+					{
+						std::cerr << "Couldn't write the benchmark to " << output << std::endl;
+					}
+				}
+				catch ( std::exception & exc )
+				{
+					std::cerr << exc.what() << std::endl;
+				}
 			}
 		}
 
+		wxImage::CleanUpHandlers();
 		return result;
 	}
-};
+}
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "RendererPlugin.hpp"
+#include "Scenario.hpp"
+
+#include <Miscellaneous/CaptureWriter.hpp>
 
 #include <Utils/Factory.hpp>
 
@@ -28,6 +31,21 @@ namespace common
 			return m_rendererName;
 		}
 
+		inline bool isHeadless()const
+		{
+			return m_headless;
+		}
+
+		inline bool isCapturing()const
+		{
+			return !m_capture.fileName.empty();
+		}
+
+		inline capture_renderer::CaptureOptions const & getCaptureOptions()const
+		{
+			return m_capture;
+		}
+
 	private:
 		bool doParseCommandLine();
 		virtual MainFrame * doCreateMainFrame( wxString const & rendererName ) = 0;
@@ -36,6 +54,8 @@ namespace common
 		wxString m_name;
 		wxString m_rendererName;
 		bool m_allocated{ false };
+		bool m_headless{ false };
+		capture_renderer::CaptureOptions m_capture;
 		MainFrame * m_mainFrame{ nullptr };
 		std::streambuf * m_cout{ nullptr };
 		std::streambuf * m_cerr{ nullptr };
@@ -43,4 +63,79 @@ namespace common
 		std::vector< RendererPlugin > m_plugins;
 		RendererFactory m_factory;
 	};
+	/**
+	*\~english
+	*\brief
+	*	Creates the renderer, wrapped into the capture one if a capture is asked.
+	*\~french
+	*\brief
+	*	Crée le renderer, englobé dans celui de capture si une capture est demandée.
+	*/
+	renderer::RendererPtr createRenderer( RendererFactory & factory
+		, wxString const & name
+		, wxString const & rendererName
+		, capture_renderer::CaptureOptions const & capture );
+	/**
+	*\~english
+	*\return
+	*	\p true if the command line asks for a benchmark (\p --bench).
+	*\~french
+	*\return
+	*	\p true si la ligne de commande demande un benchmark (\p --bench).
+	*/
+	bool isBenchmarkCommandLine( int argc, char ** argv );
+	/**
+	*\~english
+	*\brief
+	*	Runs the benchmark asked by the command line, without initialising wxWidgets' GUI nor creating any window.
+	*\return
+	*	The process exit code, \p EXIT_FAILURE if the benchmark couldn't complete or be written.
+	*\~french
+	*\brief
+	*	Lance le benchmark demandé par la ligne de commande, sans initialiser la GUI de wxWidgets ni créer de fenêtre.
+	*\return
+	*	Le code de sortie du processus, \p EXIT_FAILURE si le benchmark n'a pas pu être terminé ou écrit.
+	*/
+	int runBenchmark( wxString const & name
+		, int argc
+		, char ** argv
+		, ScenarioCreator const & creator );
 }
+/**
+*\~english
+*\brief
+*	Replaces wxIMPLEMENT_APP, for a test application supporting the benchmark:
+*	a --bench command line runs the scenario before wxWidgets' initialisation, which needs a display.
+*\~french
+*\brief
+*	Remplace wxIMPLEMENT_APP, pour une application de test supportant le benchmark :
+*	une ligne de commande --bench lance le scénario avant l'initialisation de wxWidgets, qui a besoin d'un affichage.
+*/
+#if defined( __WXMSW__ )
+#	define TEST_IMPLEMENT_APP( AppT, ScenarioT, name )\
+	wxIMPLEMENT_WX_THEME_SUPPORT\
+	wxIMPLEMENT_APP_NO_MAIN( AppT );\
+	extern "C" int WINAPI WinMain( HINSTANCE instance\
+		, HINSTANCE prevInstance\
+		, wxCmdLineArgType\
+		, int cmdShow )\
+	{\
+		wxDISABLE_DEBUG_SUPPORT();\
+		if ( common::isBenchmarkCommandLine( __argc, __argv ) )\
+		{\
+			return common::runBenchmark( name, __argc, __argv, common::makeScenarioCreator< ScenarioT >() );\
+		}\
+		return wxEntry( instance, prevInstance, nullptr, cmdShow );\
+	}
+#else
+#	define TEST_IMPLEMENT_APP( AppT, ScenarioT, name )\
+	wxIMPLEMENT_APP_NO_MAIN( AppT );\
+	int main( int argc, char ** argv )\
+	{\
+		if ( common::isBenchmarkCommandLine( argc, argv ) )\
+		{\
+			return common::runBenchmark( name, argc, argv, common::makeScenarioCreator< ScenarioT >() );\
+		}\
+		return wxEntry( argc, argv );\
+	}
+#endif
@@ -0,0 +1,356 @@
+#include "Benchmark.hpp"
+
+#include <Core/Device.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <new>
+#include <numeric>
+#include <sstream>
+
+namespace
+{
+	std::atomic< uint64_t > g_allocationCount{ 0u };
+	std::atomic< uint64_t > g_allocationBytes{ 0u };
+
+	void * doAllocate( std::size_t size )noexcept
+	{
+		g_allocationCount.fetch_add( 1u, std::memory_order_relaxed );
+		g_allocationBytes.fetch_add( size, std::memory_order_relaxed );
+		return std::malloc( size ? size : 1u );
+	}
+
+	void * doAllocateThrow( std::size_t size )
+	{
+		if ( auto result = doAllocate( size ) )
+		{
+			return result;
+		}
+
+		throw std::bad_alloc{};
+	}
+
+#if defined( __cpp_aligned_new )
+
+	// The allocated block's address is stored right before the aligned address,
+	// there is always room for it, since the alignment is at least the size of a pointer.
+	void * doAllocateAligned( std::size_t size
+		, std::align_val_t alignment )noexcept
+	{
+		auto align = std::max( std::size_t( alignment ), sizeof( void * ) );
+		auto block = static_cast< char * >( doAllocate( size + align ) );
+
+		if ( !block )
+		{
+			return nullptr;
+		}
+
+		auto result = block + align - ( reinterpret_cast< std::uintptr_t >( block ) % align );
+		reinterpret_cast< void ** >( result )[-1] = block;
+		return result;
+	}
+
+	void * doAllocateAlignedThrow( std::size_t size
+		, std::align_val_t alignment )
+	{
+		if ( auto result = doAllocateAligned( size, alignment ) )
+		{
+			return result;
+		}
+
+		throw std::bad_alloc{};
+	}
+
+	void doFreeAligned( void * ptr )noexcept
+	{
+		if ( ptr )
+		{
+			std::free( static_cast< void ** >( ptr )[-1] );
+		}
+	}
+
+#endif
+}
+
+void * operator new( std::size_t size )
+{
+	return doAllocateThrow( size );
+}
+
+void * operator new[]( std::size_t size )
+{
+	return doAllocateThrow( size );
+}
+
+void * operator new( std::size_t size, std::nothrow_t const & )noexcept
+{
+	return doAllocate( size );
+}
+
+void * operator new[]( std::size_t size, std::nothrow_t const & )noexcept
+{
+	return doAllocate( size );
+}
+
+void operator delete( void * ptr )noexcept
+{
+	std::free( ptr );
+}
+
+void operator delete[]( void * ptr )noexcept
+{
+	std::free( ptr );
+}
+
+void operator delete( void * ptr, std::size_t )noexcept
+{
+	std::free( ptr );
+}
+
+void operator delete[]( void * ptr, std::size_t )noexcept
+{
+	std::free( ptr );
+}
+
+void operator delete( void * ptr, std::nothrow_t const & )noexcept
+{
+	std::free( ptr );
+}
+
+void operator delete[]( void * ptr, std::nothrow_t const & )noexcept
+{
+	std::free( ptr );
+}
+
+#if defined( __cpp_aligned_new )
+
+void * operator new( std::size_t size, std::align_val_t alignment )
+{
+	return doAllocateAlignedThrow( size, alignment );
+}
+
+void * operator new[]( std::size_t size, std::align_val_t alignment )
+{
+	return doAllocateAlignedThrow( size, alignment );
+}
+
+void * operator new( std::size_t size, std::align_val_t alignment, std::nothrow_t const & )noexcept
+{
+	return doAllocateAligned( size, alignment );
+}
+
+void * operator new[]( std::size_t size, std::align_val_t alignment, std::nothrow_t const & )noexcept
+{
+	return doAllocateAligned( size, alignment );
+}
+
+void operator delete( void * ptr, std::align_val_t )noexcept
+{
+	doFreeAligned( ptr );
+}
+
+void operator delete[]( void * ptr, std::align_val_t )noexcept
+{
+	doFreeAligned( ptr );
+}
+
+void operator delete( void * ptr, std::size_t, std::align_val_t )noexcept
+{
+	doFreeAligned( ptr );
+}
+
+void operator delete[]( void * ptr, std::size_t, std::align_val_t )noexcept
+{
+	doFreeAligned( ptr );
+}
+
+void operator delete( void * ptr, std::align_val_t, std::nothrow_t const & )noexcept
+{
+	doFreeAligned( ptr );
+}
+
+void operator delete[]( void * ptr, std::align_val_t, std::nothrow_t const & )noexcept
+{
+	doFreeAligned( ptr );
+}
+
+#endif
+
+namespace common
+{
+	namespace
+	{
+		std::string doEscape( std::string const & value )
+		{
+			std::stringstream result;
+
+			for ( auto c : value )
+			{
+				if ( c == '"' || c == '\\' )
+				{
+					result << '\\' << c;
+				}
+				else if ( static_cast< unsigned char >( c ) < 0x20u )
+				{
+					result << "\\u" << std::hex << std::setw( 4 ) << std::setfill( '0' ) << int( c );
+				}
+				else
+				{
+					result << c;
+				}
+			}
+
+			return result.str();
+		}
+
+		double doGetPercentile( std::vector< double > const & sorted
+			, double percentile )
+		{
+			// Nearest rank.
+			auto rank = size_t( std::ceil( percentile / 100.0 * double( sorted.size() ) ) );
+			return sorted[std::max( rank, size_t( 1u ) ) - 1u];
+		}
+
+		void doWriteDistribution( std::ofstream & file
+			, std::string const & name
+			, std::vector< double > values )
+		{
+			file << "\"" << name << "\":{";
+
+			if ( !values.empty() )
+			{
+				std::sort( values.begin(), values.end() );
+				file << "\"min\":" << values.front()
+					<< ",\"mean\":" << std::accumulate( values.begin(), values.end(), 0.0 ) / double( values.size() )
+					<< ",\"p50\":" << doGetPercentile( values, 50.0 )
+					<< ",\"p90\":" << doGetPercentile( values, 90.0 )
+					<< ",\"p95\":" << doGetPercentile( values, 95.0 )
+					<< ",\"p99\":" << doGetPercentile( values, 99.0 )
+					<< ",\"max\":" << values.back();
+			}
+
+			file << "}";
+		}
+	}
+
+	AllocationCounters getAllocationCounters()
+	{
+		return
+		{
+			g_allocationCount.load( std::memory_order_relaxed ),
+			g_allocationBytes.load( std::memory_order_relaxed ),
+		};
+	}
+
+	Benchmark::Benchmark( std::string const & scenario
+		, std::string const & rendererName
+		, uint32_t frameCount )
+		: m_scenario{ scenario }
+		, m_rendererName{ rendererName }
+		, m_frameCount{ frameCount }
+		, m_allocations{ getAllocationCounters() }
+	{
+		m_cpuTimes.reserve( m_frameCount );
+		m_gpuTimes.reserve( m_frameCount );
+		m_allocationCounts.reserve( m_frameCount );
+		m_allocationBytes.reserve( m_frameCount );
+
+		for ( auto & values : m_statisticValues )
+		{
+			values.reserve( m_frameCount );
+		}
+	}
+
+	void Benchmark::setDevice( renderer::Device const * device )
+	{
+		m_device = device;
+
+		if ( m_device )
+		{
+			m_deviceName = m_device->getProperties().deviceName;
+			m_statistics = m_device->getStatistics();
+		}
+	}
+
+	void Benchmark::addFrame( std::chrono::microseconds const & durationGpu
+		, std::chrono::microseconds const & durationCpu )
+	{
+		auto allocations = getAllocationCounters();
+		auto statistics = m_statistics;
+
+		if ( m_device )
+		{
+			statistics = m_device->getStatistics();
+		}
+
+		if ( m_skipped < WarmupFrames )
+		{
+			++m_skipped;
+		}
+		else if ( !isComplete() )
+		{
+			m_cpuTimes.push_back( double( durationCpu.count() ) );
+			m_gpuTimes.push_back( double( durationGpu.count() ) );
+			m_allocationCounts.push_back( double( allocations.count - m_allocations.count ) );
+			m_allocationBytes.push_back( double( allocations.bytes - m_allocations.bytes ) );
+
+			if ( m_device )
+			{
+				auto frame = statistics - m_statistics;
+
+				for ( size_t i = 0u; i < m_statisticValues.size(); ++i )
+				{
+					m_statisticValues[i].push_back( double( frame.values[i] ) );
+				}
+			}
+		}
+
+		m_allocations = allocations;
+		m_statistics = statistics;
+	}
+
+	bool Benchmark::write( std::string const & path )const
+	{
+		std::ofstream file{ path };
+
+		if ( !file )
+		{
+			return false;
+		}
+
+		file << std::fixed << std::setprecision( 3 );
+		file << "{\"scenario\":\"" << doEscape( m_scenario ) << "\""
+			<< ",\"renderer\":\"" << doEscape( m_rendererName ) << "\""
+			<< ",\"device\":\"" << doEscape( m_deviceName ) << "\""
+			<< ",\"warmupFrames\":" << WarmupFrames
+			<< ",\"frames\":" << m_cpuTimes.size()
+			<< ",\n";
+		doWriteDistribution( file, "cpuTimeUs", m_cpuTimes );
+		file << ",\n";
+		doWriteDistribution( file, "gpuTimeUs", m_gpuTimes );
+		file << ",\n";
+		doWriteDistribution( file, "allocations", m_allocationCounts );
+		file << ",\n";
+		doWriteDistribution( file, "allocatedBytes", m_allocationBytes );
+		file << ",\n\"statistics\":{";
+
+		if ( !m_statisticValues[0].empty() )
+		{
+			for ( size_t i = 0u; i < m_statisticValues.size(); ++i )
+			{
+				file << ( i ? ",\n" : "\n" );
+				doWriteDistribution( file
+					, renderer::getName( renderer::Statistic( i ) )
+					, m_statisticValues[i] );
+			}
+		}
+
+		file << "}}\n";
+		return bool( file );
+	}
+}
@@ -0,0 +1,162 @@
+/*
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "Prerequisites.hpp"
+
+#include <Core/DeviceStatistics.hpp>
+
+#include <chrono>
+
+namespace common
+{
+	/**
+	*\~english
+	*\brief
+	*	The allocations made through the global operators new, nothrow and aligned ones included, since the program start.
+	*\~french
+	*\brief
+	*	Les allocations faites via les operator new globaux, y compris nothrow et alignés, depuis le démarrage du programme.
+	*/
+	struct AllocationCounters
+	{
+		uint64_t count;
+		uint64_t bytes;
+	};
+	/**
+	*\~english
+	*\return
+	*	The current allocation counters.
+	*\remarks
+	*	The rendering plugins only share the application's operator new where the platform allows it,
+	*	on Windows, their allocations are hence not counted.
+	*\~french
+	*\return
+	*	Les compteurs d'allocation actuels.
+	*\remarks
+	*	Les plugins de rendu ne partagent l'operator new de l'application que là où la plateforme le permet,
+	*	sous Windows, leurs allocations ne sont donc pas comptées.
+	*/
+	AllocationCounters getAllocationCounters();
+	/**
+	*\~english
+	*\brief
+	*	Records the frames of a test application, run for a fixed number of frames,
+	*	and writes their distribution into a JSON file.
+	*\remarks
+	*	The first frames are skipped, for the measures not to include the resources warm up.
+	*	The device statistics are only recorded if a device is given, and if the renderer
+	*	counts them (RENDERER_STATISTICS).
+	*\~french
+	*\brief
+	*	Enregistre les frames d'une application de test, lancée pour un nombre fixé de frames,
+	*	et écrit leur distribution dans un fichier JSON.
+	*\remarks
+	*	Les premières frames sont ignorées, pour que les mesures n'incluent pas la mise en route des ressources.
+	*	Les statistiques du périphérique ne sont enregistrées que si un périphérique est donné, et si le renderer
+	*	les compte (RENDERER_STATISTICS).
+	*/
+	class Benchmark
+	{
+	public:
+		//! The frames skipped before recording.
+		static uint32_t constexpr WarmupFrames = 10u;
+
+	public:
+		/**
+		*\~english
+		*\param[in] scenario
+		*	The test application name.
+		*\param[in] rendererName
+		*	The renderer name.
+		*\param[in] frameCount
+		*	The number of recorded frames.
+		*\~french
+		*\param[in] scenario
+		*	Le nom de l'application de test.
+		*\param[in] rendererName
+		*	Le nom du renderer.
+		*\param[in] frameCount
+		*	Le nombre de frames enregistrées.
+		*/
+		Benchmark( std::string const & scenario
+			, std::string const & rendererName
+			, uint32_t frameCount );
+		/**
+		*\~english
+		*\brief
+		*	Sets the device from which the statistics are read.
+		*\param[in] device
+		*	The device, \p nullptr when it is destroyed.
+		*\~french
+		*\brief
+		*	Définit le périphérique depuis lequel les statistiques sont lues.
+		*\param[in] device
+		*	Le périphérique, \p nullptr lorsqu'il est détruit.
+		*/
+		void setDevice( renderer::Device const * device );
+		/**
+		*\~english
+		*\brief
+		*	Records a frame.
+		*\param[in] durationGpu
+		*	The GPU time, measured through timestamps.
+		*\param[in] durationCpu
+		*	The CPU time.
+		*\~french
+		*\brief
+		*	Enregistre une frame.
+		*\param[in] durationGpu
+		*	Le temps GPU, mesuré via des timestamps.
+		*\param[in] durationCpu
+		*	Le temps CPU.
+		*/
+		void addFrame( std::chrono::microseconds const & durationGpu
+			, std::chrono::microseconds const & durationCpu );
+		/**
+		*\~english
+		*\brief
+		*	Writes the frames distribution (min, mean, percentiles, max) into a JSON file.
+		*\param[in] path
+		*	The file path.
+		*\return
+		*	\p false if the file couldn't be written.
+		*\~french
+		*\brief
+		*	Ecrit la distribution des frames (min, moyenne, percentiles, max) dans un fichier JSON.
+		*\param[in] path
+		*	Le chemin du fichier.
+		*\return
+		*	\p false si le fichier n'a pas pu être écrit.
+		*/
+		bool write( std::string const & path )const;
+		/**
+		*\~english
+		*\return
+		*	\p true when all the frames are recorded.
+		*\~french
+		*\return
+		*	\p true lorsque toutes les frames sont enregistrées.
+		*/
+		inline bool isComplete()const
+		{
+			return m_cpuTimes.size() >= m_frameCount;
+		}
+
+	private:
+		std::string m_scenario;
+		std::string m_rendererName;
+		std::string m_deviceName;
+		uint32_t m_frameCount;
+		uint32_t m_skipped{ 0u };
+		renderer::Device const * m_device{ nullptr };
+		AllocationCounters m_allocations;
+		renderer::DeviceStatistics m_statistics;
+		std::vector< double > m_cpuTimes;
+		std::vector< double > m_gpuTimes;
+		std::vector< double > m_allocationCounts;
+		std::vector< double > m_allocationBytes;
+		std::array< std::vector< double >, size_t( renderer::Statistic::eCount ) > m_statisticValues;
+	};
+}
@@ -29,18 +29,10 @@ namespace common
 
 		try
 		{
-			renderer::Renderer::Configuration config
-			{
-				m_name.ToStdString(),
-				"RendererLib",
-#if !defined( NDEBUG )
-				true,
-#else
-				false,
-#endif
-			};
-			m_renderer = m_factory.create( m_rendererName.ToStdString(), config );
-
+			m_renderer = createRenderer( m_factory
+				, m_name
+				, m_rendererName
+				, static_cast< App const & >( *wxTheApp ).getCaptureOptions() );
 			std::cout << "Renderer instance created." << std::endl;
 			m_panel = doCreatePanel( WindowSize, *m_renderer );
 
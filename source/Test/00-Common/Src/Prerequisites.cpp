@@ -1,5 +1,7 @@
 #include "Prerequisites.hpp"
 
+#include "Application.hpp"
+
 #include <Core/Connection.hpp>
 #include <Core/PlatformWindowHandle.hpp>
 #include <Core/Renderer.hpp>
@@ -23,6 +25,13 @@ namespace common
 	renderer::ConnectionPtr makeConnection( wxWindow * window
 		, renderer::Renderer const & renderer )
 	{
+		if ( static_cast< App const & >( *wxTheApp ).isHeadless() )
+		{
+			// The window is still created, and needs a display server, but isn't rendered into.
+			return renderer.createConnection( 0u
+				, renderer::WindowHandle{} );
+		}
+
 #if defined( __WXMSW__ )
 
 		auto handle = renderer::WindowHandle{ std::make_unique< renderer::IMswWindowHandle >( wxGetInstance()
@@ -12,6 +12,7 @@
 
 #include <array>
 #include <chrono>
+#include <memory>
 
 namespace common
 {
@@ -65,4 +66,8 @@ namespace common
 
 	class Application;
 	class MainFrame;
+	class RenderPanel;
+	class Scenario;
+
+	using ScenarioPtr = std::unique_ptr< Scenario >;
 }
@@ -0,0 +1,77 @@
+#include "RenderPanel.hpp"
+
+#include "Application.hpp"
+
+namespace common
+{
+	namespace
+	{
+		enum class Ids
+		{
+			RenderTimer = 42
+		}	Ids;
+
+		renderer::UIVec2 doGetSize( wxSize const & size )
+		{
+			return renderer::UIVec2{ uint32_t( size.GetWidth() )
+				, uint32_t( size.GetHeight() ) };
+		}
+	}
+
+	RenderPanel::RenderPanel( wxWindow * parent
+		, wxSize const & size
+		, renderer::Renderer const & renderer
+		, ScenarioCreator const & creator
+		, int timerTimeMs )
+		: wxPanel{ parent, wxID_ANY, wxDefaultPosition, size }
+		, m_timerTimeMs{ timerTimeMs }
+		, m_scenario{ creator( makeConnection( this, renderer )
+			, doGetSize( GetClientSize() )
+			, renderer ) }
+	{
+		m_onFrame = m_scenario->onFrame.connect( []( std::chrono::microseconds const & durationGpu
+			, std::chrono::microseconds const & durationCpu )
+			{
+				static_cast< App & >( *wxTheApp ).updateFps( durationGpu, durationCpu );
+			} );
+		m_timer = new wxTimer{ this, int( Ids::RenderTimer ) };
+		m_timer->Start( m_timerTimeMs );
+
+		Connect( int( Ids::RenderTimer )
+			, wxEVT_TIMER
+			, wxTimerEventHandler( RenderPanel::onTimer )
+			, nullptr
+			, this );
+		Connect( wxID_ANY
+			, wxEVT_SIZE
+			, wxSizeEventHandler( RenderPanel::onSize )
+			, nullptr
+			, this );
+	}
+
+	RenderPanel::~RenderPanel()
+	{
+		delete m_timer;
+		m_onFrame.disconnect();
+		m_scenario.reset();
+	}
+
+	void RenderPanel::onTimer( wxTimerEvent & event )
+	{
+		if ( event.GetId() == int( Ids::RenderTimer ) )
+		{
+			if ( !m_scenario->draw() )
+			{
+				m_timer->Stop();
+			}
+		}
+	}
+
+	void RenderPanel::onSize( wxSizeEvent & event )
+	{
+		m_timer->Stop();
+		m_scenario->resize( doGetSize( GetClientSize() ) );
+		m_timer->Start( m_timerTimeMs );
+		event.Skip();
+	}
+}
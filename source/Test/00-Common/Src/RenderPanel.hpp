@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Scenario.hpp"
+
+#include <wx/panel.h>
+#include <wx/timer.h>
+
+namespace common
+{
+	/**
+	*\~english
+	*\brief
+	*	The panel drawing a scenario into its window, on a timer.
+	*\~french
+	*\brief
+	*	Le panneau dessinant un scénario dans sa fenêtre, sur un timer.
+	*/
+	class RenderPanel
+		: public wxPanel
+	{
+	public:
+		RenderPanel( wxWindow * parent
+			, wxSize const & size
+			, renderer::Renderer const & renderer
+			, ScenarioCreator const & creator
+			, int timerTimeMs = 20 );
+		~RenderPanel();
+
+	protected:
+		template< typename ScenarioT >
+		ScenarioT & getScenario()
+		{
+			return static_cast< ScenarioT & >( *m_scenario );
+		}
+
+	private:
+		void onTimer( wxTimerEvent & event );
+		void onSize( wxSizeEvent & event );
+
+	private:
+		int m_timerTimeMs;
+		wxTimer * m_timer{ nullptr };
+		ScenarioPtr m_scenario;
+		renderer::SignalConnection< Scenario::OnFrame > m_onFrame;
+	};
+}
@@ -0,0 +1,21 @@
+#include "Scenario.hpp"
+
+namespace common
+{
+	Scenario::Scenario( renderer::UIVec2 const & size )
+		: m_size{ size }
+	{
+	}
+
+	bool Scenario::draw()
+	{
+		doUpdate();
+		return doDraw();
+	}
+
+	void Scenario::resize( renderer::UIVec2 const & size )
+	{
+		m_size = size;
+		doResetSwapChain();
+	}
+}
@@ -0,0 +1,124 @@
+/*
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "Prerequisites.hpp"
+
+#include <Utils/UtilsSignal.hpp>
+
+#include <functional>
+
+namespace common
+{
+	/**
+	*\~english
+	*\brief
+	*	The rendering of a test application, independent from any window.
+	*\remarks
+	*	The render panel draws it on its timer, the benchmark draws it in a loop, without any window.
+	*\~french
+	*\brief
+	*	Le rendu d'une application de test, indépendant de toute fenêtre.
+	*\remarks
+	*	Le panneau de rendu le dessine sur son timer, le benchmark le dessine en boucle, sans fenêtre.
+	*/
+	class Scenario
+	{
+	public:
+		using OnFrameFunc = std::function< void( std::chrono::microseconds const &, std::chrono::microseconds const & ) >;
+		using OnFrame = renderer::Signal< OnFrameFunc >;
+
+	public:
+		/**
+		*\~english
+		*\param[in] size
+		*	The render size.
+		*\~french
+		*\param[in] size
+		*	La taille de rendu.
+		*/
+		explicit Scenario( renderer::UIVec2 const & size );
+		virtual ~Scenario() = default;
+		/**
+		*\~english
+		*\brief
+		*	Updates the scene, and draws a frame.
+		*\return
+		*	\p false if the swap chain couldn't give an image.
+		*\~french
+		*\brief
+		*	Met à jour la scène, et dessine une frame.
+		*\return
+		*	\p false si la swap chain n'a pas pu donner d'image.
+		*/
+		bool draw();
+		/**
+		*\~english
+		*\brief
+		*	Resets the swap chain to the given size.
+		*\param[in] size
+		*	The new render size.
+		*\~french
+		*\brief
+		*	Réinitialise la swap chain à la taille donnée.
+		*\param[in] size
+		*	La nouvelle taille de rendu.
+		*/
+		void resize( renderer::UIVec2 const & size );
+		/**
+		*\~english
+		*\return
+		*	The logical device.
+		*\~french
+		*\return
+		*	Le périphérique logique.
+		*/
+		virtual renderer::Device const & getDevice()const = 0;
+
+		inline renderer::UIVec2 const & getSize()const
+		{
+			return m_size;
+		}
+
+	private:
+		virtual void doUpdate()
+		{
+		}
+
+		virtual bool doDraw() = 0;
+		virtual void doResetSwapChain() = 0;
+
+	public:
+		//!\~english	Emitted for each drawn frame, with its GPU then CPU times.
+		//!\~french		Emis pour chaque frame dessinée, avec ses temps GPU puis CPU.
+		OnFrame onFrame;
+
+	private:
+		renderer::UIVec2 m_size;
+	};
+	/**
+	*\~english
+	*\brief
+	*	Creates a scenario, from its device connection, its render size and the renderer.
+	*\~french
+	*\brief
+	*	Crée un scénario, depuis sa connexion de périphérique, sa taille de rendu et le renderer.
+	*/
+	using ScenarioCreator = std::function< ScenarioPtr( renderer::ConnectionPtr
+		, renderer::UIVec2 const &
+		, renderer::Renderer const & ) >;
+
+	template< typename ScenarioT >
+	ScenarioCreator makeScenarioCreator()
+	{
+		return []( renderer::ConnectionPtr connection
+			, renderer::UIVec2 const & size
+			, renderer::Renderer const & renderer )
+		{
+			return ScenarioPtr{ std::make_unique< ScenarioT >( std::move( connection )
+				, size
+				, renderer ) };
+		};
+	}
+}
@@ -12,7 +12,7 @@ namespace vkapp
 
 	static wxString const AppName = wxT( "05-Texture2D" );
 
-	class RenderPanel;
+	class Scenario;
 	class MainFrame;
 	class Application;
 }
@@ -2,6 +2,8 @@
 
 #include "Prerequisites.hpp"
 
+#include <Scenario.hpp>
+
 #include <Descriptor/DescriptorSetLayout.hpp>
 #include <Descriptor/DescriptorSetPool.hpp>
 #include <Descriptor/DescriptorSet.hpp>
@@ -14,14 +16,16 @@
 
 namespace vkapp
 {
-	class RenderPanel
-		: public wxPanel
+	class Scenario
+		: public common::Scenario
 	{
 	public:
-		RenderPanel( wxWindow * parent
-			, wxSize const & size
+		Scenario( renderer::ConnectionPtr connection
+			, renderer::UIVec2 const & size
 			, renderer::Renderer const & renderer );
-		~RenderPanel();
+		~Scenario();
+
+		renderer::Device const & getDevice()const override;
 
 	private:
 		/**
@@ -30,7 +34,8 @@ namespace vkapp
 		*/
 		/**@{*/
 		void doCleanup();
-		void doCreateDevice( renderer::Renderer const & renderer );
+		void doCreateDevice( renderer::Renderer const & renderer
+			, renderer::ConnectionPtr connection );
 		void doCreateSwapChain();
 		void doCreateTexture();
 		void doCreateDescriptorSet();
@@ -45,20 +50,11 @@ namespace vkapp
 		*	Rendering.
 		*/
 		/**@{*/
-		void doDraw();
-		void doResetSwapChain();
-		/**@}*/
-		/**
-		*\name
-		*	Events.
-		*/
-		/**@{*/
-		void onTimer( wxTimerEvent & event );
-		void onSize( wxSizeEvent & event );
+		bool doDraw()override;
+		void doResetSwapChain()override;
 		/**@}*/
 
 	private:
-		wxTimer * m_timer{ nullptr };
 		std::vector< TexturedVertexData > m_vertexData;
 		/**
 		*\name
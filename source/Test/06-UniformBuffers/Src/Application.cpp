@@ -1,7 +1,8 @@
 #include "Application.hpp"
 #include "MainFrame.hpp"
+#include "Scenario.hpp"
 
-wxIMPLEMENT_APP( vkapp::Application );
+TEST_IMPLEMENT_APP( vkapp::Application, vkapp::Scenario, vkapp::AppName );
 
 namespace vkapp
 {
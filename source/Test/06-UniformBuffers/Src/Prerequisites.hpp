@@ -9,7 +9,7 @@ namespace vkapp
 		renderer::Vec4 position;
 		renderer::Vec2 uv;
 	};
-	class RenderPanel;
+	class Scenario;
 	class MainFrame;
 	class Application;
 
@@ -2,6 +2,8 @@
 
 #include "Prerequisites.hpp"
 
+#include <Scenario.hpp>
+
 #include <Core/Connection.hpp>
 #include <Core/Device.hpp>
 #include <Pipeline/Pipeline.hpp>
@@ -11,20 +13,20 @@
 
 #include <Utils/UtilsSignal.hpp>
 
-#include <wx/panel.h>
-
 #include <array>
 
 namespace vkapp
 {
-	class RenderPanel
-		: public wxPanel
+	class Scenario
+		: public common::Scenario
 	{
 	public:
-		RenderPanel( wxWindow * parent
-			, wxSize const & size
+		Scenario( renderer::ConnectionPtr connection
+			, renderer::UIVec2 const & size
 			, renderer::Renderer const & renderer );
-		~RenderPanel();
+		~Scenario();
+
+		renderer::Device const & getDevice()const override;
 
 	private:
 		/**
@@ -33,7 +35,8 @@ namespace vkapp
 		*/
 		/**@{*/
 		void doCleanup();
-		void doCreateDevice( renderer::Renderer const & renderer );
+		void doCreateDevice( renderer::Renderer const & renderer
+			, renderer::ConnectionPtr connection );
 		void doCreateSwapChain();
 		void doCreateTexture();
 		void doCreateUniformBuffer();
@@ -49,20 +52,11 @@ namespace vkapp
 		*	Rendering.
 		*/
 		/**@{*/
-		void doDraw();
-		void doResetSwapChain();
-		/**@}*/
-		/**
-		*\name
-		*	Events.
-		*/
-		/**@{*/
-		void onTimer( wxTimerEvent & event );
-		void onSize( wxSizeEvent & event );
+		bool doDraw()override;
+		void doResetSwapChain()override;
 		/**@}*/
 
 	private:
-		wxTimer * m_timer{ nullptr };
 		std::vector< TexturedVertexData > m_vertexData;
 		/**
 		*\name
@@ -1,7 +1,4 @@
-#include "RenderPanel.hpp"
-
-#include "Application.hpp"
-#include "MainFrame.hpp"
+#include "Scenario.hpp"
 
 #include <Buffer/StagingBuffer.hpp>
 #include <Buffer/UniformBuffer.hpp>
@@ -42,20 +39,13 @@ namespace vkapp
 {
 	namespace
 	{
-		enum class Ids
-		{
-			RenderTimer = 42
-		}	Ids;
-
-		static int const TimerTimeMs = 20;
 		static renderer::PixelFormat const DepthFormat = renderer::PixelFormat::eD32F;
 	}
 
-	RenderPanel::RenderPanel( wxWindow * parent
-		, wxSize const & size
+	Scenario::Scenario( renderer::ConnectionPtr connection
+		, renderer::UIVec2 const & size
 		, renderer::Renderer const & renderer )
-		: wxPanel{ parent, wxID_ANY, wxDefaultPosition, size }
-		, m_timer{ new wxTimer{ this, int( Ids::RenderTimer ) } }
+		: common::Scenario{ size }
 		, m_offscreenVertexData
 		{
 			// Front
@@ -114,7 +104,7 @@ namespace vkapp
 	{
 		try
 		{
-			doCreateDevice( renderer );
+			doCreateDevice( renderer, std::move( connection ) );
 			std::cout << "Logical device created." << std::endl;
 			doCreateSwapChain();
 			std::cout << "Swap chain created." << std::endl;
@@ -150,30 +140,20 @@ namespace vkapp
 			doCleanup();
 			throw;
 		}
-
-		m_timer->Start( TimerTimeMs );
-
-		Connect( int( Ids::RenderTimer )
-			, wxEVT_TIMER
-			, wxTimerEventHandler( RenderPanel::onTimer )
-			, nullptr
-			, this );
-		Connect( wxID_ANY
-			, wxEVT_SIZE
-			, wxSizeEventHandler( RenderPanel::onSize )
-			, nullptr
-			, this );
 	}
 
-	RenderPanel::~RenderPanel()
+	Scenario::~Scenario()
 	{
 		doCleanup();
 	}
 
-	void RenderPanel::doCleanup()
+	renderer::Device const & Scenario::getDevice()const
 	{
-		delete m_timer;
+		return *m_device;
+	}
 
+	void Scenario::doCleanup()
+	{
 		if ( m_device )
 		{
 			m_device->waitIdle();
@@ -219,7 +199,7 @@ namespace vkapp
 		}
 	}
 
-	void RenderPanel::doUpdateProjection()
+	void Scenario::doUpdateProjection()
 	{
 		auto size = m_swapChain->getDimensions();
 #if 0
@@ -257,15 +237,16 @@ namespace vkapp
 			, renderer::PipelineStageFlag::eVertexShader );
 	}
 
-	void RenderPanel::doCreateDevice( renderer::Renderer const & renderer )
+	void Scenario::doCreateDevice( renderer::Renderer const & renderer
+		, renderer::ConnectionPtr connection )
 	{
-		m_device = renderer.createDevice( common::makeConnection( this, renderer ) );
+		m_device = renderer.createDevice( std::move( connection ) );
 		m_device->enable();
 	}
 
-	void RenderPanel::doCreateSwapChain()
+	void Scenario::doCreateSwapChain()
 	{
-		wxSize size{ GetClientSize() };
+		auto size = getSize();
 		m_swapChain = m_device->createSwapChain( { size.x, size.y } );
 		m_swapChain->setClearColour( { 1.0f, 0.8f, 0.4f, 0.0f } );
 		m_swapChainReset = m_swapChain->onReset.connect( [this]()
@@ -278,7 +259,7 @@ namespace vkapp
 		m_updateCommandBuffer = m_device->getGraphicsCommandPool().createCommandBuffer();
 	}
 
-	void RenderPanel::doCreateTexture()
+	void Scenario::doCreateTexture()
 	{
 		std::string shadersFolder = common::getPath( common::getExecutableDirectory() ) / "share" / "Assets";
 		auto image = common::loadImage( shadersFolder / "texture.png" );
@@ -296,7 +277,7 @@ namespace vkapp
 			, *m_view );
 	}
 
-	void RenderPanel::doCreateUniformBuffer()
+	void Scenario::doCreateUniformBuffer()
 	{
 		m_matrixUbo = std::make_unique< renderer::UniformBuffer< renderer::Mat4 > >( *m_device
 			, 1u
@@ -308,14 +289,14 @@ namespace vkapp
 			, renderer::MemoryPropertyFlag::eDeviceLocal );
 	}
 
-	void RenderPanel::doCreateStagingBuffer()
+	void Scenario::doCreateStagingBuffer()
 	{
 		m_stagingBuffer = std::make_unique< renderer::StagingBuffer >( *m_device
 			, 0u
 			, 10000000u );
 	}
 
-	void RenderPanel::doCreateOffscreenDescriptorSet()
+	void Scenario::doCreateOffscreenDescriptorSet()
 	{
 		std::vector< renderer::DescriptorSetLayoutBinding > bindings
 		{
@@ -340,7 +321,7 @@ namespace vkapp
 		m_offscreenDescriptorSet->update();
 	}
 
-	void RenderPanel::doCreateOffscreenRenderPass()
+	void Scenario::doCreateOffscreenRenderPass()
 	{
 		renderer::RenderPassAttachmentArray attaches
 		{
@@ -385,30 +366,30 @@ namespace vkapp
 				, renderer::AccessFlag::eShaderRead } );
 	}
 
-	void RenderPanel::doCreateFrameBuffer()
+	void Scenario::doCreateFrameBuffer()
 	{
-		auto size = GetClientSize();
+		auto size = getSize();
 		m_renderTargetColour = m_device->createTexture();
 		m_renderTargetColour->setImage( renderer::PixelFormat::eR8G8B8A8
-			, { size.GetWidth(), size.GetHeight() }
+			, { size.x, size.y }
 			, renderer::ImageUsageFlag::eColourAttachment | renderer::ImageUsageFlag::eSampled );
 		m_renderTargetColourView = m_renderTargetColour->createView( m_renderTargetColour->getType()
 			, m_renderTargetColour->getFormat() );
 
 		m_renderTargetDepth = m_device->createTexture();
 		m_renderTargetDepth->setImage( DepthFormat
-			, { size.GetWidth(), size.GetHeight() }
+			, { size.x, size.y }
 			, renderer::ImageUsageFlag::eDepthStencilAttachment );
 		m_renderTargetDepthView = m_renderTargetDepth->createView( m_renderTargetDepth->getType()
 			, m_renderTargetDepth->getFormat() );
 		renderer::FrameBufferAttachmentArray attaches;
 		attaches.emplace_back( *( m_offscreenRenderPass->begin() + 0u ), *m_renderTargetColourView );
 		attaches.emplace_back( *( m_offscreenRenderPass->begin() + 1u ), *m_renderTargetDepthView );
-		m_frameBuffer = m_offscreenRenderPass->createFrameBuffer( { size.GetWidth(), size.GetHeight() }
+		m_frameBuffer = m_offscreenRenderPass->createFrameBuffer( { size.x, size.y }
 			, std::move( attaches ) );
 	}
 
-	void RenderPanel::doCreateOffscreenVertexBuffer()
+	void Scenario::doCreateOffscreenVertexBuffer()
 	{
 		m_offscreenVertexLayout = renderer::makeLayout< TexturedVertexData >( 0 );
 		m_offscreenVertexLayout->createAttribute< renderer::Vec4 >( 0u
@@ -435,10 +416,10 @@ namespace vkapp
 			, *m_offscreenIndexBuffer );
 	}
 
-	void RenderPanel::doCreateOffscreenPipeline()
+	void Scenario::doCreateOffscreenPipeline()
 	{
 		m_offscreenPipelineLayout = m_device->createPipelineLayout( *m_offscreenDescriptorLayout );
-		wxSize size{ GetClientSize() };
+		auto size = getSize();
 		std::string shadersFolder = common::getPath( common::getExecutableDirectory() ) / "share" / AppName / "Shaders";
 
 		if ( !wxFileExists( shadersFolder / "offscreen.vert" )
@@ -466,7 +447,7 @@ namespace vkapp
 		} );
 	}
 
-	void RenderPanel::doCreateMainDescriptorSet()
+	void Scenario::doCreateMainDescriptorSet()
 	{
 		std::vector< renderer::DescriptorSetLayoutBinding > bindings
 		{
@@ -481,7 +462,7 @@ namespace vkapp
 		m_mainDescriptorSet->update();
 	}
 
-	void RenderPanel::doCreateMainRenderPass()
+	void Scenario::doCreateMainRenderPass()
 	{
 		renderer::RenderPassAttachmentArray attaches
 		{
@@ -514,14 +495,14 @@ namespace vkapp
 				, renderer::AccessFlag::eMemoryRead } );
 	}
 
-	void RenderPanel::doPrepareOffscreenFrame()
+	void Scenario::doPrepareOffscreenFrame()
 	{
 		doUpdateProjection();
 		m_queryPool = m_device->createQueryPool( renderer::QueryType::eTimestamp
 			, 2u
 			, 0u );
 		m_commandBuffer = m_device->getGraphicsCommandPool().createCommandBuffer();
-		wxSize size{ GetClientSize() };
+		auto size = getSize();
 		auto & commandBuffer = *m_commandBuffer;
 		auto & frameBuffer = *m_frameBuffer;
 
@@ -567,7 +548,7 @@ namespace vkapp
 		}
 	}
 
-	void RenderPanel::doCreateMainVertexBuffer()
+	void Scenario::doCreateMainVertexBuffer()
 	{
 		m_mainVertexLayout = renderer::makeLayout< TexturedVertexData >( 0 );
 		m_mainVertexLayout->createAttribute< renderer::Vec4 >( 0u
@@ -585,10 +566,10 @@ namespace vkapp
 			, renderer::PipelineStageFlag::eVertexInput );
 	}
 
-	void RenderPanel::doCreateMainPipeline()
+	void Scenario::doCreateMainPipeline()
 	{
 		m_mainPipelineLayout = m_device->createPipelineLayout( *m_mainDescriptorLayout );
-		wxSize size{ GetClientSize() };
+		auto size = getSize();
 		std::string shadersFolder = common::getPath( common::getExecutableDirectory() ) / "share" / AppName / "Shaders";
 
 		if ( !wxFileExists( shadersFolder / "main.vert" )
@@ -613,7 +594,7 @@ namespace vkapp
 		} );
 	}
 
-	void RenderPanel::doPrepareMainFrames()
+	void Scenario::doPrepareMainFrames()
 	{
 		m_frameBuffers = m_swapChain->createFrameBuffers( *m_mainRenderPass );
 		m_commandBuffers = m_swapChain->createCommandBuffers();
@@ -623,7 +604,7 @@ namespace vkapp
 			auto & frameBuffer = *m_frameBuffers[i];
 			auto & commandBuffer = *m_commandBuffers[i];
 
-			wxSize size{ GetClientSize() };
+			auto size = getSize();
 
 			if ( commandBuffer.begin( renderer::CommandBufferUsageFlag::eSimultaneousUse ) )
 			{
@@ -659,7 +640,7 @@ namespace vkapp
 		}
 	}
 
-	void RenderPanel::doUpdate()
+	void Scenario::doUpdate()
 	{
 		static renderer::Mat4 const originalTranslate = []()
 		{
@@ -685,7 +666,7 @@ namespace vkapp
 			, renderer::PipelineStageFlag::eVertexShader );
 	}
 
-	void RenderPanel::doDraw()
+	bool Scenario::doDraw()
 	{
 		auto resources = m_swapChain->getResources();
 
@@ -704,47 +685,28 @@ namespace vkapp
 					, resources->getRenderingFinishedSemaphore()
 					, &resources->getFence() );
 				m_swapChain->present( *resources );
-				renderer::UInt32Array values{ 0u, 0u };
+				renderer::UInt64Array values{ 0u, 0u };
 				m_queryPool->getResults( 0u
 					, 2u
-					, 0u
-					, renderer::QueryResultFlag::eWait
+					, sizeof( uint64_t )
+					, renderer::QueryResultFlag::eWait | renderer::QueryResultFlag::e64
 					, values );
 
 				// Elapsed time in nanoseconds
-				auto elapsed = std::chrono::nanoseconds{ uint64_t( ( values[1] - values[0] ) / float( m_device->getTimestampPeriod() ) ) };
+				auto elapsed = std::chrono::nanoseconds{ uint64_t( double( values[1] - values[0] ) * double( m_device->getTimestampPeriod() ) ) };
 				auto after = std::chrono::high_resolution_clock::now();
-				wxGetApp().updateFps( std::chrono::duration_cast< std::chrono::microseconds >( elapsed )
+				onFrame( std::chrono::duration_cast< std::chrono::microseconds >( elapsed )
 					, std::chrono::duration_cast< std::chrono::microseconds >( after - before ) );
 			}
 		}
-		else
-		{
-			m_timer->Stop();
-		}
-	}
 
-	void RenderPanel::doResetSwapChain()
-	{
-		m_device->waitIdle();
-		wxSize size{ GetClientSize() };
-		m_swapChain->reset( { size.GetWidth(), size.GetHeight() } );
+		return resources != nullptr;
 	}
 
-	void RenderPanel::onTimer( wxTimerEvent & event )
+	void Scenario::doResetSwapChain()
 	{
-		if ( event.GetId() == int( Ids::RenderTimer ) )
-		{
-			doUpdate();
-			doDraw();
-		}
-	}
-
-	void RenderPanel::onSize( wxSizeEvent & event )
-	{
-		m_timer->Stop();
-		doResetSwapChain();
-		m_timer->Start( TimerTimeMs );
-		event.Skip();
+		m_device->waitIdle();
+		auto size = getSize();
+		m_swapChain->reset( { size.x, size.y } );
 	}
 }
@@ -2,6 +2,8 @@
 
 #include "Prerequisites.hpp"
 
+#include <Scenario.hpp>
+
 #include <Core/Connection.hpp>
 #include <Core/Device.hpp>
 #include <Pipeline/Pipeline.hpp>
@@ -13,20 +15,20 @@
 
 #include <ObjLoader.hpp>
 
-#include <wx/panel.h>
-
 #include <array>
 
 namespace vkapp
 {
-	class RenderPanel
-		: public wxPanel
+	class Scenario
+		: public common::Scenario
 	{
 	public:
-		RenderPanel( wxWindow * parent
-			, wxSize const & size
+		Scenario( renderer::ConnectionPtr connection
+			, renderer::UIVec2 const & size
 			, renderer::Renderer const & renderer );
-		~RenderPanel();
+		~Scenario();
+
+		renderer::Device const & getDevice()const override;
 
 	private:
 		/**
@@ -36,7 +38,8 @@ namespace vkapp
 		/**@{*/
 		void doCleanup();
 		void doUpdateProjection();
-		void doCreateDevice( renderer::Renderer const & renderer );
+		void doCreateDevice( renderer::Renderer const & renderer
+			, renderer::ConnectionPtr connection );
 		void doCreateSwapChain();
 		void doCreateTexture();
 		void doCreateUniformBuffer();
@@ -58,21 +61,12 @@ namespace vkapp
 		*	Rendering.
 		*/
 		/**@{*/
-		void doUpdate();
-		void doDraw();
-		void doResetSwapChain();
-		/**@}*/
-		/**
-		*\name
-		*	Events.
-		*/
-		/**@{*/
-		void onTimer( wxTimerEvent & event );
-		void onSize( wxSizeEvent & event );
+		void doUpdate()override;
+		bool doDraw()override;
+		void doResetSwapChain()override;
 		/**@}*/
 
 	private:
-		wxTimer * m_timer{ nullptr };
 		renderer::Mat4 m_rotate;
 		/**
 		*\name
@@ -0,0 +1,14 @@
+layout( location = 0 ) in vec4 position;
+
+out gl_PerVertex
+{
+  vec4 gl_Position;
+};
+
+layout( location = 0 ) out vec3 vtx_position;
+
+void main()
+{
+	vtx_position = position.xyz;
+	gl_Position = position;
+}
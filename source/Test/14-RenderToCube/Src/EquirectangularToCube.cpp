@@ -11,6 +11,7 @@
 #include <Descriptor/DescriptorSetPool.hpp>
 #include <Image/Texture.hpp>
 #include <Image/TextureView.hpp>
+#include <Miscellaneous/QueryPool.hpp>
 #include <Pipeline/DepthStencilState.hpp>
 #include <Pipeline/InputAssemblyState.hpp>
 #include <Pipeline/MultisampleState.hpp>
@@ -28,6 +29,9 @@
 
 #include <FileUtils.hpp>
 
+#include <chrono>
+#include <iostream>
+
 namespace vkapp
 {
 	using renderer::Vec3;
@@ -65,9 +69,7 @@ namespace vkapp
 				, renderer::Filter::eLinear );
 		}
 
-		renderer::UniformBufferPtr< Mat4 > doCreateMatrixUbo( renderer::Device & device
-			, renderer::CommandBuffer const & commandBuffer
-			, renderer::StagingBuffer & stagingBuffer )
+		std::array< Mat4, 6u > doGetFacesMatrices( renderer::Device & device )
 		{
 			static Mat4 const projection = device.perspective( utils::toRadians( 90.0_degrees ), 1.0f, 0.1f, 10.0f );
 			static Mat4 const views[] =
@@ -80,28 +82,43 @@ namespace vkapp
 				utils::lookAt( Vec3{ 0.0f, 0.0f, 0.0f }, Vec3{ +0.0f, +0.0f, -1.0f }, Vec3{ 0.0f, -1.0f, +0.0f } )
 			};
 
+			if ( device.getClipDirection() == renderer::ClipDirection::eTopDown )
+			{
+				return
+				{
+					projection * views[0],
+					projection * views[1],
+					projection * views[2],
+					projection * views[3],
+					projection * views[4],
+					projection * views[5],
+				};
+			}
+
+			return
+			{
+				projection * views[0],
+				projection * views[1],
+				projection * views[3],
+				projection * views[2],
+				projection * views[4],
+				projection * views[5],
+			};
+		}
+
+		renderer::UniformBufferPtr< Mat4 > doCreateMatrixUbo( renderer::Device & device
+			, renderer::CommandBuffer const & commandBuffer
+			, renderer::StagingBuffer & stagingBuffer )
+		{
+			auto matrices = doGetFacesMatrices( device );
 			auto result = renderer::makeUniformBuffer< renderer::Mat4 >( device
 				, 6u
 				, renderer::BufferTarget::eTransferDst
 				, renderer::MemoryPropertyFlag::eHostVisible );
 
-			if ( device.getClipDirection() == renderer::ClipDirection::eTopDown )
-			{
-				result->getData( 0u ) = projection * views[0];
-				result->getData( 1u ) = projection * views[1];
-				result->getData( 2u ) = projection * views[2];
-				result->getData( 3u ) = projection * views[3];
-				result->getData( 4u ) = projection * views[4];
-				result->getData( 5u ) = projection * views[5];
-			}
-			else
+			for ( uint32_t face = 0u; face < 6u; ++face )
 			{
-				result->getData( 0u ) = projection * views[0];
-				result->getData( 1u ) = projection * views[1];
-				result->getData( 2u ) = projection * views[3];
-				result->getData( 3u ) = projection * views[2];
-				result->getData( 4u ) = projection * views[4];
-				result->getData( 5u ) = projection * views[5];
+				result->getData( face ) = matrices[face];
 			}
 
 			stagingBuffer.uploadUniformData( commandBuffer
@@ -111,6 +128,24 @@ namespace vkapp
 			return result;
 		}
 
+		renderer::UniformBufferPtr< std::array< Mat4, 6u > > doCreateLayeredMatrixUbo( renderer::Device & device
+			, renderer::CommandBuffer const & commandBuffer
+			, renderer::StagingBuffer & stagingBuffer )
+		{
+			// The six matrices are packed in a single element, since the elements
+			// of a uniform buffer are aligned on the device's offset alignment.
+			auto result = renderer::makeUniformBuffer< std::array< Mat4, 6u > >( device
+				, 1u
+				, renderer::BufferTarget::eTransferDst
+				, renderer::MemoryPropertyFlag::eHostVisible );
+			result->getData( 0u ) = doGetFacesMatrices( device );
+			stagingBuffer.uploadUniformData( commandBuffer
+				, result->getDatas()
+				, *result
+				, renderer::PipelineStageFlag::eGeometryShader );
+			return result;
+		}
+
 		std::vector< renderer::ShaderStageState > doCreateProgram( renderer::Device & device )
 		{
 			std::string shadersFolder = common::getPath( common::getExecutableDirectory() ) / "share" / AppName / "Shaders";
@@ -130,6 +165,28 @@ namespace vkapp
 			return shaderStages;
 		}
 
+		std::vector< renderer::ShaderStageState > doCreateLayeredProgram( renderer::Device & device )
+		{
+			std::string shadersFolder = common::getPath( common::getExecutableDirectory() ) / "share" / AppName / "Shaders";
+
+			if ( !wxFileExists( shadersFolder / "equirectangular_layered.vert" )
+				|| !wxFileExists( shadersFolder / "equirectangular_layered.geom" )
+				|| !wxFileExists( shadersFolder / "equirectangular.frag" ) )
+			{
+				throw std::runtime_error{ "Shader files are missing" };
+			}
+
+			std::vector< renderer::ShaderStageState > shaderStages;
+			shaderStages.emplace_back( device.createShaderModule( renderer::ShaderStageFlag::eVertex ) );
+			shaderStages.emplace_back( device.createShaderModule( renderer::ShaderStageFlag::eGeometry ) );
+			shaderStages.emplace_back( device.createShaderModule( renderer::ShaderStageFlag::eFragment ) );
+			shaderStages[0].getModule().loadShader( common::parseShaderFile( device, shadersFolder / "equirectangular_layered.vert" ) );
+			shaderStages[1].getModule().loadShader( common::parseShaderFile( device, shadersFolder / "equirectangular_layered.geom" ) );
+			shaderStages[2].getModule().loadShader( common::parseShaderFile( device, shadersFolder / "equirectangular.frag" ) );
+
+			return shaderStages;
+		}
+
 		renderer::VertexBufferPtr< VertexData > doCreateVertexBuffer( renderer::Device & device
 			, renderer::CommandBuffer const & commandBuffer
 			, renderer::StagingBuffer & stagingBuffer )
@@ -174,6 +231,50 @@ namespace vkapp
 			};
 			return device.createDescriptorSetLayout( std::move( bindings ) );
 		}
+
+		renderer::DescriptorSetLayoutPtr doCreateLayeredDescriptorSetLayout( renderer::Device & device )
+		{
+			renderer::DescriptorSetLayoutBindingArray bindings
+			{
+				{ 0u, renderer::DescriptorType::eUniformBuffer, renderer::ShaderStageFlag::eGeometry },
+				{ 1u, renderer::DescriptorType::eCombinedImageSampler, renderer::ShaderStageFlag::eFragment },
+			};
+			return device.createDescriptorSetLayout( std::move( bindings ) );
+		}
+
+		renderer::RenderPassPtr doCreateRenderPass( renderer::Device & device
+			, renderer::PixelFormat format )
+		{
+			renderer::RenderPassAttachmentArray rpAttaches
+			{
+				{
+					0u,
+					format,
+					renderer::SampleCountFlag::e1,
+					renderer::AttachmentLoadOp::eClear,
+					renderer::AttachmentStoreOp::eStore,
+					renderer::AttachmentLoadOp::eDontCare,
+					renderer::AttachmentStoreOp::eDontCare,
+					renderer::ImageLayout::eUndefined,
+					renderer::ImageLayout::eShaderReadOnlyOptimal,
+				}
+			};
+			renderer::RenderSubpassAttachmentArray subAttaches
+			{
+				{ 0u, renderer::ImageLayout::eColourAttachmentOptimal }
+			};
+			renderer::RenderSubpassPtrArray subpasses;
+			subpasses.emplace_back( device.createRenderSubpass( renderer::PipelineBindPoint::eGraphics
+				, renderer::RenderSubpassState{ renderer::PipelineStageFlag::eColourAttachmentOutput
+					, renderer::AccessFlag::eColourAttachmentWrite }
+				, subAttaches ) );
+			return device.createRenderPass( rpAttaches
+				, std::move( subpasses )
+				, renderer::RenderSubpassState{ renderer::PipelineStageFlag::eColourAttachmentOutput
+					, renderer::AccessFlag::eColourAttachmentWrite }
+				, renderer::RenderSubpassState{ renderer::PipelineStageFlag::eColourAttachmentOutput
+					, renderer::AccessFlag::eShaderRead } );
+		}
 	}
 
 	EquirectangularToCube::EquirectangularToCube( std::string const & filePath
@@ -196,25 +297,6 @@ namespace vkapp
 	{
 		auto size = renderer::UIVec2{ texture.getDimensions()[0], texture.getDimensions()[1] };
 		uint32_t face = 0u;
-		std::vector< renderer::PixelFormat > formats{ 1u, m_target.getFormat() };
-		renderer::RenderPassAttachmentArray rpAttaches
-		{
-			{
-				0u,
-				m_target.getFormat(),
-				renderer::SampleCountFlag::e1,
-				renderer::AttachmentLoadOp::eClear,
-				renderer::AttachmentStoreOp::eStore,
-				renderer::AttachmentLoadOp::eDontCare,
-				renderer::AttachmentStoreOp::eDontCare,
-				renderer::ImageLayout::eUndefined,
-				renderer::ImageLayout::eShaderReadOnlyOptimal,
-			}
-		};
-		renderer::RenderSubpassAttachmentArray subAttaches
-		{
-			{ 0u, renderer::ImageLayout::eColourAttachmentOptimal }
-		};
 
 		for ( auto & facePipeline : m_faces )
 		{
@@ -231,17 +313,7 @@ namespace vkapp
 
 		for ( auto & facePipeline : m_faces )
 		{
-			renderer::RenderSubpassPtrArray subpasses;
-			subpasses.emplace_back( m_device.createRenderSubpass( renderer::PipelineBindPoint::eGraphics
-				, renderer::RenderSubpassState{ renderer::PipelineStageFlag::eColourAttachmentOutput
-					, renderer::AccessFlag::eColourAttachmentWrite }
-				, subAttaches ) );
-			facePipeline.renderPass = m_device.createRenderPass( rpAttaches
-				, std::move( subpasses )
-				, renderer::RenderSubpassState{ renderer::PipelineStageFlag::eColourAttachmentOutput
-					, renderer::AccessFlag::eColourAttachmentWrite }
-				, renderer::RenderSubpassState{ renderer::PipelineStageFlag::eColourAttachmentOutput
-					, renderer::AccessFlag::eShaderRead } );
+			facePipeline.renderPass = doCreateRenderPass( m_device, m_target.getFormat() );
 
 			renderer::FrameBufferAttachmentArray attaches;
 			attaches.emplace_back( *facePipeline.renderPass->begin(), *facePipeline.view );
@@ -274,9 +346,124 @@ namespace vkapp
 			facePipeline.descriptorSet->update();
 			++face;
 		}
+
+		if ( m_device.getFeatures().geometryShader )
+		{
+			// The whole cube is bound as a layered attachment, the geometry shader
+			// selects the face through gl_Layer, so that the six faces are drawn
+			// with a single render pass, pipeline and draw call.
+			m_layeredMatrixUbo = doCreateLayeredMatrixUbo( m_device, *m_commandBuffer, m_stagingBuffer );
+			m_layeredDescriptorLayout = doCreateLayeredDescriptorSetLayout( m_device );
+			m_layeredDescriptorPool = m_layeredDescriptorLayout->createPool( 1u );
+			m_layeredPipelineLayout = m_device.createPipelineLayout( *m_layeredDescriptorLayout );
+			m_layered.view = m_target.createView( renderer::TextureType::e2DArray
+				, m_target.getFormat()
+				, 0u
+				, 1u
+				, 0u
+				, 6u );
+			m_layered.renderPass = doCreateRenderPass( m_device, m_target.getFormat() );
+
+			renderer::FrameBufferAttachmentArray attaches;
+			attaches.emplace_back( *m_layered.renderPass->begin(), *m_layered.view );
+			m_layered.frameBuffer = m_layered.renderPass->createFrameBuffer( size
+				, std::move( attaches ) );
+
+			m_layered.pipeline = m_layeredPipelineLayout->createPipeline( renderer::GraphicsPipelineCreateInfo
+			{
+				doCreateLayeredProgram( m_device ),
+				*m_layered.renderPass,
+				renderer::VertexInputState::create( *m_vertexLayout ),
+				renderer::InputAssemblyState{ renderer::PrimitiveTopology::eTriangleList },
+				renderer::RasterisationState{ 1.0f },
+				renderer::MultisampleState{},
+				renderer::ColourBlendState::createDefault(),
+				renderer::DepthStencilState{ 0u, false, false },
+				renderer::TessellationState{},
+				renderer::Viewport{ size[0], size[1], 0, 0 },
+				renderer::Scissor{ 0, 0, size[0], size[1] }
+			} );
+
+			m_layered.descriptorSet = m_layeredDescriptorPool->createDescriptorSet();
+			m_layered.descriptorSet->createBinding( m_layeredDescriptorLayout->getBinding( 0u )
+				, *m_layeredMatrixUbo
+				, 0u
+				, 1u );
+			m_layered.descriptorSet->createBinding( m_layeredDescriptorLayout->getBinding( 1u )
+				, *m_view
+				, *m_sampler );
+			m_layered.descriptorSet->update();
+		}
+
+		m_queryPool = m_device.createQueryPool( renderer::QueryType::eTimestamp
+			, 4u
+			, 0u );
 	}
 
 	void EquirectangularToCube::render( renderer::CommandBuffer & commandBuffer )
+	{
+		if ( m_layered.pipeline )
+		{
+			doRenderLayered( commandBuffer );
+		}
+		else
+		{
+			doRenderFaces( commandBuffer );
+		}
+	}
+
+	void EquirectangularToCube::render()
+	{
+		if ( m_commandBuffer->begin( renderer::CommandBufferUsageFlag::eOneTimeSubmit ) )
+		{
+			m_commandBuffer->resetQueryPool( *m_queryPool
+				, 0u
+				, 4u );
+			m_commandBuffer->writeTimestamp( renderer::PipelineStageFlag::eTopOfPipe
+				, *m_queryPool
+				, 0u );
+			doRenderFaces( *m_commandBuffer );
+			m_commandBuffer->writeTimestamp( renderer::PipelineStageFlag::eBottomOfPipe
+				, *m_queryPool
+				, 1u );
+
+			if ( m_layered.pipeline )
+			{
+				m_commandBuffer->writeTimestamp( renderer::PipelineStageFlag::eTopOfPipe
+					, *m_queryPool
+					, 2u );
+				doRenderLayered( *m_commandBuffer );
+				m_commandBuffer->writeTimestamp( renderer::PipelineStageFlag::eBottomOfPipe
+					, *m_queryPool
+					, 3u );
+			}
+
+			m_commandBuffer->end();
+			m_device.getGraphicsQueue().submit( *m_commandBuffer, nullptr );
+			m_device.getGraphicsQueue().waitIdle();
+
+			// The timestamps are read on 64 bits, and the period is the number of nanoseconds per tick.
+			renderer::UInt64Array values{ 0u, 0u, 0u, 0u };
+			m_queryPool->getResults( 0u
+				, m_layered.pipeline ? 4u : 2u
+				, sizeof( uint64_t )
+				, renderer::QueryResultFlag::eWait | renderer::QueryResultFlag::e64
+				, values );
+			auto period = double( m_device.getTimestampPeriod() );
+			auto faces = std::chrono::nanoseconds{ uint64_t( double( values[1] - values[0] ) * period ) };
+			std::cout << "Cube map update, one pass per face: "
+				<< std::chrono::duration_cast< std::chrono::microseconds >( faces ).count() << " us." << std::endl;
+
+			if ( m_layered.pipeline )
+			{
+				auto layered = std::chrono::nanoseconds{ uint64_t( double( values[3] - values[2] ) * period ) };
+				std::cout << "Cube map update, single layered pass: "
+					<< std::chrono::duration_cast< std::chrono::microseconds >( layered ).count() << " us." << std::endl;
+			}
+		}
+	}
+
+	void EquirectangularToCube::doRenderFaces( renderer::CommandBuffer & commandBuffer )
 	{
 		for ( auto & facePipeline : m_faces )
 		{
@@ -295,17 +482,23 @@ namespace vkapp
 			commandBuffer.draw( 36u );
 			commandBuffer.endRenderPass();
 		}
-
 	}
 
-	void EquirectangularToCube::render()
+	void EquirectangularToCube::doRenderLayered( renderer::CommandBuffer & commandBuffer )
 	{
-		if ( m_commandBuffer->begin( renderer::CommandBufferUsageFlag::eOneTimeSubmit ) )
-		{
-			render( *m_commandBuffer );
-			m_commandBuffer->end();
-			m_device.getGraphicsQueue().submit( *m_commandBuffer, nullptr );
-			m_device.getGraphicsQueue().waitIdle();
-		}
+		commandBuffer.memoryBarrier( renderer::PipelineStageFlag::eTransfer
+			, renderer::PipelineStageFlag::eColourAttachmentOutput
+			, m_layered.view->makeColourAttachment( renderer::ImageLayout::eUndefined
+				, 0u ) );
+		commandBuffer.beginRenderPass( *m_layered.renderPass
+			, *m_layered.frameBuffer
+			, { renderer::RgbaColour{ 0, 0, 0, 0 } }
+			, renderer::SubpassContents::eInline );
+		commandBuffer.bindPipeline( *m_layered.pipeline );
+		commandBuffer.bindDescriptorSet( *m_layered.descriptorSet
+			, *m_layeredPipelineLayout );
+		commandBuffer.bindVertexBuffer( 0u, m_vertexBuffer->getBuffer(), 0u );
+		commandBuffer.draw( 36u );
+		commandBuffer.endRenderPass();
 	}
 }
@@ -27,9 +27,33 @@ namespace vkapp
 			, renderer::Device & device
 			, renderer::Texture & texture );
 
+		/**
+		*\~english
+		*\brief
+		*	Renders the cube map, and prints the GPU time spent by the per face
+		*	and the layered paths.
+		*\~french
+		*\brief
+		*	Dessine la cube map, et affiche le temps GPU pris par les chemins
+		*	par face et en couches.
+		*/
 		void render();
+		/**
+		*\~english
+		*\brief
+		*	Records the cube map rendering, in a single layered pass if geometry
+		*	shaders are supported, one pass per face otherwise.
+		*\~french
+		*\brief
+		*	Enregistre le dessin de la cube map, dans une seule passe en couches
+		*	si les geometry shaders sont supportés, une passe par face sinon.
+		*/
 		void render( renderer::CommandBuffer & commandBuffer );
 
+	private:
+		void doRenderFaces( renderer::CommandBuffer & commandBuffer );
+		void doRenderLayered( renderer::CommandBuffer & commandBuffer );
+
 	private:
 		struct FacePipeline
 		{
@@ -39,6 +63,7 @@ namespace vkapp
 			renderer::PipelinePtr pipeline;
 			renderer::DescriptorSetPtr descriptorSet;
 		};
+		using FacesMatrices = std::array< renderer::Mat4, 6u >;
 
 		renderer::Device & m_device;
 		renderer::Texture & m_target;
@@ -55,5 +80,11 @@ namespace vkapp
 		renderer::DescriptorSetPoolPtr m_descriptorPool;
 		renderer::PipelineLayoutPtr m_pipelineLayout;
 		std::array< FacePipeline, 6u > m_faces;
+		renderer::UniformBufferPtr< FacesMatrices > m_layeredMatrixUbo;
+		renderer::DescriptorSetLayoutPtr m_layeredDescriptorLayout;
+		renderer::DescriptorSetPoolPtr m_layeredDescriptorPool;
+		renderer::PipelineLayoutPtr m_layeredPipelineLayout;
+		FacePipeline m_layered;
+		renderer::QueryPoolPtr m_queryPool;
 	};
 }
@@ -13,6 +13,7 @@ namespace vkapp
 	static wxString const AppName = wxT( "15-Instantiation" );
 
 	class RenderPanel;
+	class Scenario;
 	class MainFrame;
 	class Application;
 }
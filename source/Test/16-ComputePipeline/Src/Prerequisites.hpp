@@ -12,7 +12,7 @@ namespace vkapp
 
 	static wxString const AppName = wxT( "16-ComputePipeline" );
 
-	class RenderPanel;
+	class Scenario;
 	class MainFrame;
 	class Application;
 }
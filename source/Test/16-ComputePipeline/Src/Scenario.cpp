@@ -1,7 +1,4 @@
-#include "RenderPanel.hpp"
-
-#include "Application.hpp"
-#include "MainFrame.hpp"
+#include "Scenario.hpp"
 
 #include <Buffer/PushConstantsBuffer.hpp>
 #include <Buffer/StagingBuffer.hpp>
@@ -45,21 +42,14 @@ namespace vkapp
 {
 	namespace
 	{
-		enum class Ids
-		{
-			RenderTimer = 42
-		}	Ids;
-
-		static int const TimerTimeMs = 20;
 		static renderer::PixelFormat const ColourFormat = renderer::PixelFormat::eRGBA32F;
 		static renderer::PixelFormat const DepthFormat = renderer::PixelFormat::eD32F;
 	}
 
-	RenderPanel::RenderPanel( wxWindow * parent
-		, wxSize const & size
+	Scenario::Scenario( renderer::ConnectionPtr connection
+		, renderer::UIVec2 const & size
 		, renderer::Renderer const & renderer )
-		: wxPanel{ parent, wxID_ANY, wxDefaultPosition, size }
-		, m_timer{ new wxTimer{ this, int( Ids::RenderTimer ) } }
+		: common::Scenario{ size }
 		, m_offscreenVertexData
 	{
 		// Front
@@ -125,7 +115,7 @@ namespace vkapp
 		*m_objectPcbs[1].getData() = renderer::RgbaColour{ 0.0, 1.0, 0.0, 1.0 };
 		try
 		{
-			doCreateDevice( renderer );
+			doCreateDevice( renderer, std::move( connection ) );
 			std::cout << "Logical device created." << std::endl;
 			doCreateSwapChain();
 			std::cout << "Swap chain created." << std::endl;
@@ -169,30 +159,20 @@ namespace vkapp
 			doCleanup();
 			throw;
 		}
-
-		m_timer->Start( TimerTimeMs );
-
-		Connect( int( Ids::RenderTimer )
-			, wxEVT_TIMER
-			, wxTimerEventHandler( RenderPanel::onTimer )
-			, nullptr
-			, this );
-		Connect( wxID_ANY
-			, wxEVT_SIZE
-			, wxSizeEventHandler( RenderPanel::onSize )
-			, nullptr
-			, this );
 	}
 
-	RenderPanel::~RenderPanel()
+	Scenario::~Scenario()
 	{
 		doCleanup();
 	}
 
-	void RenderPanel::doCleanup()
+	renderer::Device const & Scenario::getDevice()const
 	{
-		delete m_timer;
+		return *m_device;
+	}
 
+	void Scenario::doCleanup()
+	{
 		if ( m_device )
 		{
 			m_device->waitIdle();
@@ -251,7 +231,7 @@ namespace vkapp
 		}
 	}
 
-	void RenderPanel::doUpdateProjection()
+	void Scenario::doUpdateProjection()
 	{
 		auto size = m_swapChain->getDimensions();
 #if 0
@@ -289,15 +269,16 @@ namespace vkapp
 			, renderer::PipelineStageFlag::eVertexShader );
 	}
 
-	void RenderPanel::doCreateDevice( renderer::Renderer const & renderer )
+	void Scenario::doCreateDevice( renderer::Renderer const & renderer
+		, renderer::ConnectionPtr connection )
 	{
-		m_device = renderer.createDevice( common::makeConnection( this, renderer ) );
+		m_device = renderer.createDevice( std::move( connection ) );
 		m_device->enable();
 	}
 
-	void RenderPanel::doCreateSwapChain()
+	void Scenario::doCreateSwapChain()
 	{
-		wxSize size{ GetClientSize() };
+		auto size = getSize();
 		m_swapChain = m_device->createSwapChain( { size.x, size.y } );
 		m_swapChain->setClearColour( { 1.0f, 0.8f, 0.4f, 0.0f } );
 		m_swapChainReset = m_swapChain->onReset.connect( [this]()
@@ -314,7 +295,7 @@ namespace vkapp
 		m_updateCommandBuffer = m_device->getGraphicsCommandPool().createCommandBuffer();
 	}
 
-	void RenderPanel::doCreateTexture()
+	void Scenario::doCreateTexture()
 	{
 		std::string shadersFolder = common::getPath( common::getExecutableDirectory() ) / "share" / "Assets";
 		auto image = common::loadImage( shadersFolder / "texture.png" );
@@ -332,7 +313,7 @@ namespace vkapp
 			, *m_view );
 	}
 
-	void RenderPanel::doCreateUniformBuffers()
+	void Scenario::doCreateUniformBuffers()
 	{
 		m_matrixUbo = std::make_unique< renderer::UniformBuffer< renderer::Mat4 > >( *m_device
 			, 1u
@@ -348,14 +329,14 @@ namespace vkapp
 			, renderer::MemoryPropertyFlag::eDeviceLocal );
 	}
 
-	void RenderPanel::doCreateStagingBuffer()
+	void Scenario::doCreateStagingBuffer()
 	{
 		m_stagingBuffer = std::make_unique< renderer::StagingBuffer >( *m_device
 			, 0u
 			, 10000000u );
 	}
 
-	void RenderPanel::doCreateOffscreenDescriptorSet()
+	void Scenario::doCreateOffscreenDescriptorSet()
 	{
 		std::vector< renderer::DescriptorSetLayoutBinding > bindings
 		{
@@ -395,7 +376,7 @@ namespace vkapp
 		m_offscreenDescriptorSets[1]->update();
 	}
 
-	void RenderPanel::doCreateOffscreenRenderPass()
+	void Scenario::doCreateOffscreenRenderPass()
 	{
 		renderer::RenderPassAttachmentArray attaches
 		{
@@ -440,30 +421,30 @@ namespace vkapp
 				, renderer::AccessFlag::eShaderRead } );
 	}
 
-	void RenderPanel::doCreateFrameBuffer()
+	void Scenario::doCreateFrameBuffer()
 	{
-		auto size = GetClientSize();
+		auto size = getSize();
 		m_renderTargetColour = m_device->createTexture();
 		m_renderTargetColour->setImage( ColourFormat
-			, { size.GetWidth(), size.GetHeight() }
+			, { size.x, size.y }
 			, renderer::ImageUsageFlag::eColourAttachment | renderer::ImageUsageFlag::eSampled | renderer::ImageUsageFlag::eStorage );
 		m_renderTargetColourView = m_renderTargetColour->createView( m_renderTargetColour->getType()
 			, m_renderTargetColour->getFormat() );
 
 		m_renderTargetDepth = m_device->createTexture();
 		m_renderTargetDepth->setImage( DepthFormat
-			, { size.GetWidth(), size.GetHeight() }
+			, { size.x, size.y }
 			, renderer::ImageUsageFlag::eDepthStencilAttachment );
 		m_renderTargetDepthView = m_renderTargetDepth->createView( m_renderTargetDepth->getType()
 			, m_renderTargetDepth->getFormat() );
 		renderer::FrameBufferAttachmentArray attaches;
 		attaches.emplace_back( *( m_offscreenRenderPass->begin() + 0u ), *m_renderTargetColourView );
 		attaches.emplace_back( *( m_offscreenRenderPass->begin() + 1u ), *m_renderTargetDepthView );
-		m_frameBuffer = m_offscreenRenderPass->createFrameBuffer( { size.GetWidth(), size.GetHeight() }
+		m_frameBuffer = m_offscreenRenderPass->createFrameBuffer( { size.x, size.y }
 		, std::move( attaches ) );
 	}
 
-	void RenderPanel::doCreateOffscreenVertexBuffer()
+	void Scenario::doCreateOffscreenVertexBuffer()
 	{
 		m_offscreenVertexLayout = renderer::makeLayout< TexturedVertexData >( 0 );
 		m_offscreenVertexLayout->createAttribute< renderer::Vec4 >( 0u
@@ -490,12 +471,12 @@ namespace vkapp
 			, *m_offscreenIndexBuffer );
 	}
 
-	void RenderPanel::doCreateOffscreenPipeline()
+	void Scenario::doCreateOffscreenPipeline()
 	{
 		renderer::PushConstantRange range{ renderer::ShaderStageFlag::eFragment, 0u, m_objectPcbs[0].getSize() };
 		m_offscreenPipelineLayout = m_device->createPipelineLayout( renderer::DescriptorSetLayoutCRefArray{ { *m_offscreenDescriptorLayout } }
 		, renderer::PushConstantRangeCRefArray{ { range } } );
-		wxSize size{ GetClientSize() };
+		auto size = getSize();
 		std::string shadersFolder = common::getPath( common::getExecutableDirectory() ) / "share" / AppName / "Shaders";
 
 		if ( !wxFileExists( shadersFolder / "offscreen.vert" )
@@ -523,7 +504,7 @@ namespace vkapp
 		} );
 	}
 
-	void RenderPanel::doCreateMainDescriptorSet()
+	void Scenario::doCreateMainDescriptorSet()
 	{
 		std::vector< renderer::DescriptorSetLayoutBinding > bindings
 		{
@@ -538,7 +519,7 @@ namespace vkapp
 		m_mainDescriptorSet->update();
 	}
 
-	void RenderPanel::doCreateMainRenderPass()
+	void Scenario::doCreateMainRenderPass()
 	{
 		renderer::RenderPassAttachmentArray attaches
 		{
@@ -571,14 +552,14 @@ namespace vkapp
 				, renderer::AccessFlag::eMemoryRead } );
 	}
 
-	void RenderPanel::doPrepareOffscreenFrame()
+	void Scenario::doPrepareOffscreenFrame()
 	{
 		doUpdateProjection();
 		m_offscreenQueryPool = m_device->createQueryPool( renderer::QueryType::eTimestamp
 			, 2u
 			, 0u );
 		m_commandBuffer = m_device->getGraphicsCommandPool().createCommandBuffer();
-		wxSize size{ GetClientSize() };
+		auto size = getSize();
 		auto & commandBuffer = *m_commandBuffer;
 		auto & frameBuffer = *m_frameBuffer;
 
@@ -631,7 +612,7 @@ namespace vkapp
 		}
 	}
 
-	void RenderPanel::doCreateComputeDescriptorSet()
+	void Scenario::doCreateComputeDescriptorSet()
 	{
 		std::vector< renderer::DescriptorSetLayoutBinding > bindings
 		{
@@ -656,7 +637,7 @@ namespace vkapp
 			, renderer::PipelineStageFlag::eComputeShader );
 	}
 
-	void RenderPanel::doCreateComputePipeline()
+	void Scenario::doCreateComputePipeline()
 	{
 		m_computePipelineLayout = m_device->createPipelineLayout( *m_computeDescriptorLayout );
 		std::string shadersFolder = common::getPath( common::getExecutableDirectory() ) / "share" / AppName / "Shaders";
@@ -675,9 +656,9 @@ namespace vkapp
 		m_computePipeline = m_computePipelineLayout->createPipeline( std::move( shaderStage ) );
 	}
 
-	void RenderPanel::doPrepareCompute()
+	void Scenario::doPrepareCompute()
 	{
-		wxSize size{ GetClientSize() };
+		auto size = getSize();
 		m_computeQueryPool = m_device->createQueryPool( renderer::QueryType::eTimestamp
 			, 2u
 			, 0u );
@@ -697,8 +678,8 @@ namespace vkapp
 			commandBuffer.bindDescriptorSet( *m_computeDescriptorSet
 				, *m_computePipelineLayout
 				, renderer::PipelineBindPoint::eCompute );
-			commandBuffer.dispatch( size.GetWidth() / 16u
-				, size.GetHeight() / 16u
+			commandBuffer.dispatch( size.x / 16u
+				, size.y / 16u
 				, 1u );
 			commandBuffer.writeTimestamp( renderer::PipelineStageFlag::eBottomOfPipe
 				, *m_computeQueryPool
@@ -707,7 +688,7 @@ namespace vkapp
 		}
 	}
 
-	void RenderPanel::doCreateMainVertexBuffer()
+	void Scenario::doCreateMainVertexBuffer()
 	{
 		m_mainVertexLayout = renderer::makeLayout< TexturedVertexData >( 0 );
 		m_mainVertexLayout->createAttribute< renderer::Vec4 >( 0u
@@ -725,10 +706,10 @@ namespace vkapp
 			, renderer::PipelineStageFlag::eVertexInput );
 	}
 
-	void RenderPanel::doCreateMainPipeline()
+	void Scenario::doCreateMainPipeline()
 	{
 		m_mainPipelineLayout = m_device->createPipelineLayout( *m_mainDescriptorLayout );
-		wxSize size{ GetClientSize() };
+		auto size = getSize();
 		std::string shadersFolder = common::getPath( common::getExecutableDirectory() ) / "share" / AppName / "Shaders";
 
 		if ( !wxFileExists( shadersFolder / "main.vert" )
@@ -753,7 +734,7 @@ namespace vkapp
 		} );
 	}
 
-	void RenderPanel::doPrepareMainFrames()
+	void Scenario::doPrepareMainFrames()
 	{
 		m_frameBuffers = m_swapChain->createFrameBuffers( *m_mainRenderPass );
 		m_commandBuffers = m_swapChain->createCommandBuffers();
@@ -763,7 +744,7 @@ namespace vkapp
 			auto & frameBuffer = *m_frameBuffers[i];
 			auto & commandBuffer = *m_commandBuffers[i];
 
-			wxSize size{ GetClientSize() };
+			auto size = getSize();
 
 			if ( commandBuffer.begin( renderer::CommandBufferUsageFlag::eSimultaneousUse ) )
 			{
@@ -799,7 +780,7 @@ namespace vkapp
 		}
 	}
 
-	void RenderPanel::doUpdate()
+	void Scenario::doUpdate()
 	{
 		static renderer::Mat4 const originalTranslate1 = []()
 		{
@@ -833,7 +814,7 @@ namespace vkapp
 			, m_objectUbo->getDatas()
 			, *m_objectUbo
 			, renderer::PipelineStageFlag::eVertexShader );
-		m_computeUbo->getData( 0u ).roll = ( m_frame % GetClientSize().GetWidth() ) * 0.03f;
+		m_computeUbo->getData( 0u ).roll = ( m_frame % getSize().x ) * 0.03f;
 		m_stagingBuffer->uploadUniformData( *m_updateCommandBuffer
 			, m_computeUbo->getDatas()
 			, *m_computeUbo
@@ -841,7 +822,7 @@ namespace vkapp
 		++m_frame;
 	}
 
-	void RenderPanel::doDraw()
+	bool Scenario::doDraw()
 	{
 		auto resources = m_swapChain->getResources();
 
@@ -868,54 +849,35 @@ namespace vkapp
 					, resources->getRenderingFinishedSemaphore()
 					, &resources->getFence() );
 				m_swapChain->present( *resources );
-				renderer::UInt32Array values1{ 0u, 0u };
-				renderer::UInt32Array values2{ 0u, 0u };
+				renderer::UInt64Array values1{ 0u, 0u };
+				renderer::UInt64Array values2{ 0u, 0u };
 				m_offscreenQueryPool->getResults( 0u
 					, 2u
-					, 0u
-					, renderer::QueryResultFlag::eWait
+					, sizeof( uint64_t )
+					, renderer::QueryResultFlag::eWait | renderer::QueryResultFlag::e64
 					, values1 );
 				m_computeQueryPool->getResults( 0u
 					, 2u
-					, 0u
-					, renderer::QueryResultFlag::eWait
-					, values1 );
+					, sizeof( uint64_t )
+					, renderer::QueryResultFlag::eWait | renderer::QueryResultFlag::e64
+					, values2 );
 
 				// Elapsed time in nanoseconds
-				auto elapsed1 = std::chrono::nanoseconds{ uint64_t( ( values1[1] - values1[0] ) / float( m_device->getTimestampPeriod() ) ) };
-				auto elapsed2 = std::chrono::nanoseconds{ uint64_t( ( values2[1] - values2[0] ) / float( m_device->getTimestampPeriod() ) ) };
+				auto elapsed1 = std::chrono::nanoseconds{ uint64_t( double( values1[1] - values1[0] ) * double( m_device->getTimestampPeriod() ) ) };
+				auto elapsed2 = std::chrono::nanoseconds{ uint64_t( double( values2[1] - values2[0] ) * double( m_device->getTimestampPeriod() ) ) };
 				auto after = std::chrono::high_resolution_clock::now();
-				wxGetApp().updateFps( std::chrono::duration_cast< std::chrono::microseconds >( elapsed1 + elapsed2 )
+				onFrame( std::chrono::duration_cast< std::chrono::microseconds >( elapsed1 + elapsed2 )
 					, std::chrono::duration_cast< std::chrono::microseconds >( after - before ) );
 			}
 		}
-		else
-		{
-			m_timer->Stop();
-		}
-	}
-
-	void RenderPanel::doResetSwapChain()
-	{
-		m_device->waitIdle();
-		wxSize size{ GetClientSize() };
-		m_swapChain->reset( { size.GetWidth(), size.GetHeight() } );
-	}
 
-	void RenderPanel::onTimer( wxTimerEvent & event )
-	{
-		if ( event.GetId() == int( Ids::RenderTimer ) )
-		{
-			doUpdate();
-			doDraw();
-		}
+		return resources != nullptr;
 	}
 
-	void RenderPanel::onSize( wxSizeEvent & event )
+	void Scenario::doResetSwapChain()
 	{
-		m_timer->Stop();
-		doResetSwapChain();
-		m_timer->Start( TimerTimeMs );
-		event.Skip();
+		m_device->waitIdle();
+		auto size = getSize();
+		m_swapChain->reset( { size.x, size.y } );
 	}
 }
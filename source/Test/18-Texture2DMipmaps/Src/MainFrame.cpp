@@ -1,9 +1,16 @@
 #include "MainFrame.hpp"
 
-#include "RenderPanel.hpp"
+#include "Scenario.hpp"
+
+#include <RenderPanel.hpp>
 
 namespace vkapp
 {
+	namespace
+	{
+		static int const TimerTimeMs = 40;
+	}
+
 	MainFrame::MainFrame( wxString const & rendererName
 		, common::RendererFactory & factory )
 		: common::MainFrame{ AppName, rendererName, factory }
@@ -12,6 +19,10 @@ namespace vkapp
 
 	wxPanel * MainFrame::doCreatePanel( wxSize const & size, renderer::Renderer const & renderer )
 	{
-		return new RenderPanel( this, size, renderer );
+		return new common::RenderPanel( this
+			, size
+			, renderer
+			, common::makeScenarioCreator< Scenario >()
+			, TimerTimeMs );
 	}
 }
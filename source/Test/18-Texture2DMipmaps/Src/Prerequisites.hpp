@@ -12,7 +12,7 @@ namespace vkapp
 
 	static wxString const AppName = wxT( "17-CompressedTexture2D" );
 
-	class RenderPanel;
+	class Scenario;
 	class MainFrame;
 	class Application;
 }
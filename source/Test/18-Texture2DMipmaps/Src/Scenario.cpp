@@ -1,5 +1,4 @@
-#include "RenderPanel.hpp"
-#include "Application.hpp"
+#include "Scenario.hpp"
 
 #include <Buffer/VertexBuffer.hpp>
 #include <Command/CommandBuffer.hpp>
@@ -35,21 +34,10 @@
 
 namespace vkapp
 {
-	namespace
-	{
-		enum class Ids
-		{
-			RenderTimer = 42
-		}	Ids;
-
-		static int const TimerTimeMs = 40;
-	}
-
-	RenderPanel::RenderPanel( wxWindow * parent
-		, wxSize const & size
+	Scenario::Scenario( renderer::ConnectionPtr connection
+		, renderer::UIVec2 const & size
 		, renderer::Renderer const & renderer )
-		: wxPanel{ parent, wxID_ANY, wxDefaultPosition, size }
-		, m_timer{ new wxTimer{ this, int( Ids::RenderTimer ) } }
+		: common::Scenario{ size }
 		, m_vertexData{
 			{
 				{
@@ -72,7 +60,7 @@ namespace vkapp
 	{
 		try
 		{
-			doCreateDevice( renderer );
+			doCreateDevice( renderer, std::move( connection ) );
 			std::cout << "Logical device created." << std::endl;
 			doCreateSwapChain();
 			std::cout << "Swapchain created." << std::endl;
@@ -96,22 +84,20 @@ namespace vkapp
 			doCleanup();
 			throw;
 		}
-
-		m_timer->Start( TimerTimeMs );
-
-		Connect( int( Ids::RenderTimer ), wxEVT_TIMER, wxTimerEventHandler( RenderPanel::onTimer ), nullptr, this );
-		Connect( wxID_ANY, wxEVT_SIZE, wxSizeEventHandler( RenderPanel::onSize ), nullptr, this );
 	}
 
-	RenderPanel::~RenderPanel()
+	Scenario::~Scenario()
 	{
 		doCleanup();
 	}
 
-	void RenderPanel::doCleanup()
+	renderer::Device const & Scenario::getDevice()const
 	{
-		delete m_timer;
+		return *m_device;
+	}
 
+	void Scenario::doCleanup()
+	{
 		if ( m_device )
 		{
 			m_device->waitIdle();
@@ -136,15 +122,16 @@ namespace vkapp
 		}
 	}
 
-	void RenderPanel::doCreateDevice( renderer::Renderer const & renderer )
+	void Scenario::doCreateDevice( renderer::Renderer const & renderer
+		, renderer::ConnectionPtr connection )
 	{
-		m_device = renderer.createDevice( common::makeConnection( this, renderer ) );
+		m_device = renderer.createDevice( std::move( connection ) );
 		m_device->enable();
 	}
 
-	void RenderPanel::doCreateSwapChain()
+	void Scenario::doCreateSwapChain()
 	{
-		wxSize size{ GetClientSize() };
+		auto size = getSize();
 		m_swapChain = m_device->createSwapChain( { size.x, size.y } );
 		m_swapChain->setClearColour( renderer::RgbaColour{ 1.0f, 0.8f, 0.4f, 0.0f } );
 		m_swapChainReset = m_swapChain->onReset.connect( [this]()
@@ -153,7 +140,7 @@ namespace vkapp
 		} );
 	}
 
-	void RenderPanel::doCreateTexture()
+	void Scenario::doCreateTexture()
 	{
 		std::string assetsFolder = common::getPath( common::getExecutableDirectory() ) / "share" / "Assets";
 		renderer::PixelFormat format = renderer::PixelFormat::eR8G8B8A8;
@@ -259,7 +246,7 @@ namespace vkapp
 			, uint32_t( tex2D.levels() ) );
 	}
 
-	void RenderPanel::doCreateDescriptorSet()
+	void Scenario::doCreateDescriptorSet()
 	{
 		std::vector< renderer::DescriptorSetLayoutBinding > bindings
 		{
@@ -274,7 +261,7 @@ namespace vkapp
 		m_descriptorSet->update();
 	}
 
-	void RenderPanel::doCreateRenderPass()
+	void Scenario::doCreateRenderPass()
 	{
 		renderer::RenderPassAttachmentArray attaches
 		{
@@ -307,7 +294,7 @@ namespace vkapp
 				, renderer::AccessFlag::eMemoryRead } );
 	}
 
-	void RenderPanel::doCreateVertexBuffer()
+	void Scenario::doCreateVertexBuffer()
 	{
 		m_vertexBuffer = renderer::makeVertexBuffer< TexturedVertexData >( *m_device
 			, uint32_t( m_vertexData.size() )
@@ -324,17 +311,17 @@ namespace vkapp
 			, renderer::PipelineStageFlag::eVertexInput );
 	}
 
-	void RenderPanel::doCreateStagingBuffer()
+	void Scenario::doCreateStagingBuffer()
 	{
 		m_stagingBuffer = std::make_unique< renderer::StagingBuffer >( *m_device
 			, 0u
 			, 1000000u );
 	}
 
-	void RenderPanel::doCreatePipeline()
+	void Scenario::doCreatePipeline()
 	{
 		m_pipelineLayout = m_device->createPipelineLayout( *m_descriptorLayout );
-		wxSize size{ GetClientSize() };
+		auto size = getSize();
 		std::string shadersFolder = common::getPath( common::getExecutableDirectory() ) / "share" / AppName / "Shaders";
 
 		if ( !wxFileExists( shadersFolder / "shader.vert" )
@@ -359,7 +346,7 @@ namespace vkapp
 		} );
 	}
 
-	void RenderPanel::doPrepareFrames()
+	void Scenario::doPrepareFrames()
 	{
 		m_queryPool = m_device->createQueryPool( renderer::QueryType::eTimestamp
 			, 2u
@@ -415,7 +402,7 @@ namespace vkapp
 		}
 	}
 
-	void RenderPanel::doDraw()
+	bool Scenario::doDraw()
 	{
 		auto resources = m_swapChain->getResources();
 
@@ -430,44 +417,24 @@ namespace vkapp
 				, &resources->getFence() );
 			m_swapChain->present( *resources );
 
-			renderer::UInt32Array values{ 0u, 0u };
+			renderer::UInt64Array values{ 0u, 0u };
 			m_queryPool->getResults( 0u
 				, 2u
-				, 0u
-				, renderer::QueryResultFlag::eWait
+				, sizeof( uint64_t )
+				, renderer::QueryResultFlag::eWait | renderer::QueryResultFlag::e64
 				, values );
 			// Elapsed time in nanoseconds
-			auto elapsed = std::chrono::nanoseconds{ uint64_t( ( values[1] - values[0] ) / float( m_device->getTimestampPeriod() ) ) };
+			auto elapsed = std::chrono::nanoseconds{ uint64_t( double( values[1] - values[0] ) * double( m_device->getTimestampPeriod() ) ) };
 			auto after = std::chrono::high_resolution_clock::now();
-			wxGetApp().updateFps( std::chrono::duration_cast< std::chrono::microseconds >( elapsed )
+			onFrame( std::chrono::duration_cast< std::chrono::microseconds >( elapsed )
 				, std::chrono::duration_cast< std::chrono::microseconds >( after - before ) );
 		}
-		else
-		{
-			m_timer->Stop();
-		}
-	}
-
-	void RenderPanel::doResetSwapChain()
-	{
-		doPrepareFrames();
-	}
 
-	void RenderPanel::onTimer( wxTimerEvent & event )
-	{
-		if ( event.GetId() == int( Ids::RenderTimer ) )
-		{
-			doDraw();
-		}
+		return resources != nullptr;
 	}
 
-	void RenderPanel::onSize( wxSizeEvent & event )
+	void Scenario::doResetSwapChain()
 	{
-		m_timer->Stop();
-		m_device->waitIdle();
-		wxSize size{ GetClientSize() };
-		m_swapChain->reset( { size.GetWidth(), size.GetHeight() } );
-		m_timer->Start( TimerTimeMs );
-		event.Skip();
+		doPrepareFrames();
 	}
 }
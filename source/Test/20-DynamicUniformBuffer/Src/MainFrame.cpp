@@ -1,6 +1,8 @@
 #include "MainFrame.hpp"
 
-#include "RenderPanel.hpp"
+#include "Scenario.hpp"
+
+#include <RenderPanel.hpp>
 
 namespace vkapp
 {
@@ -12,6 +14,9 @@ namespace vkapp
 
 	wxPanel * MainFrame::doCreatePanel( wxSize const & size, renderer::Renderer const & renderer )
 	{
-		return new RenderPanel( this, size, renderer );
+		return new common::RenderPanel( this
+			, size
+			, renderer
+			, common::makeScenarioCreator< Scenario >() );
 	}
 }
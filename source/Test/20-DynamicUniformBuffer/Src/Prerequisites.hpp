@@ -12,7 +12,7 @@ namespace vkapp
 
 	static wxString const AppName = wxT( "20-DynamicUniformBuffer" );
 
-	class RenderPanel;
+	class Scenario;
 	class MainFrame;
 	class Application;
 }
@@ -1,7 +1,4 @@
-#include "RenderPanel.hpp"
-
-#include "Application.hpp"
-#include "MainFrame.hpp"
+#include "Scenario.hpp"
 
 #include <Buffer/PushConstantsBuffer.hpp>
 #include <Buffer/StagingBuffer.hpp>
@@ -44,20 +41,13 @@ namespace vkapp
 {
 	namespace
 	{
-		enum class Ids
-		{
-			RenderTimer = 42
-		}	Ids;
-
-		static int const TimerTimeMs = 20;
 		static renderer::PixelFormat const DepthFormat = renderer::PixelFormat::eD32F;
 	}
 
-	RenderPanel::RenderPanel( wxWindow * parent
-		, wxSize const & size
+	Scenario::Scenario( renderer::ConnectionPtr connection
+		, renderer::UIVec2 const & size
 		, renderer::Renderer const & renderer )
-		: wxPanel{ parent, wxID_ANY, wxDefaultPosition, size }
-		, m_timer{ new wxTimer{ this, int( Ids::RenderTimer ) } }
+		: common::Scenario{ size }
 		, m_offscreenVertexData
 		{
 			// Front
@@ -123,7 +113,7 @@ namespace vkapp
 		*m_objectPcbs[1].getData() = renderer::RgbaColour{ 0.0, 1.0, 0.0, 1.0 };
 		try
 		{
-			doCreateDevice( renderer );
+			doCreateDevice( renderer, std::move( connection ) );
 			std::cout << "Logical device created." << std::endl;
 			doCreateSwapChain();
 			std::cout << "Swap chain created." << std::endl;
@@ -159,30 +149,20 @@ namespace vkapp
 			doCleanup();
 			throw;
 		}
-
-		m_timer->Start( TimerTimeMs );
-
-		Connect( int( Ids::RenderTimer )
-			, wxEVT_TIMER
-			, wxTimerEventHandler( RenderPanel::onTimer )
-			, nullptr
-			, this );
-		Connect( wxID_ANY
-			, wxEVT_SIZE
-			, wxSizeEventHandler( RenderPanel::onSize )
-			, nullptr
-			, this );
 	}
 
-	RenderPanel::~RenderPanel()
+	Scenario::~Scenario()
 	{
 		doCleanup();
 	}
 
-	void RenderPanel::doCleanup()
+	renderer::Device const & Scenario::getDevice()const
 	{
-		delete m_timer;
+		return *m_device;
+	}
 
+	void Scenario::doCleanup()
+	{
 		if ( m_device )
 		{
 			m_device->waitIdle();
@@ -228,7 +208,7 @@ namespace vkapp
 		}
 	}
 
-	void RenderPanel::doUpdateProjection()
+	void Scenario::doUpdateProjection()
 	{
 		auto size = m_swapChain->getDimensions();
 #if 0
@@ -266,15 +246,16 @@ namespace vkapp
 			, renderer::PipelineStageFlag::eVertexShader );
 	}
 
-	void RenderPanel::doCreateDevice( renderer::Renderer const & renderer )
+	void Scenario::doCreateDevice( renderer::Renderer const & renderer
+		, renderer::ConnectionPtr connection )
 	{
-		m_device = renderer.createDevice( common::makeConnection( this, renderer ) );
+		m_device = renderer.createDevice( std::move( connection ) );
 		m_device->enable();
 	}
 
-	void RenderPanel::doCreateSwapChain()
+	void Scenario::doCreateSwapChain()
 	{
-		wxSize size{ GetClientSize() };
+		auto size = getSize();
 		m_swapChain = m_device->createSwapChain( { size.x, size.y } );
 		m_swapChain->setClearColour( { 1.0f, 0.8f, 0.4f, 0.0f } );
 		m_swapChainReset = m_swapChain->onReset.connect( [this]()
@@ -287,7 +268,7 @@ namespace vkapp
 		m_updateCommandBuffer = m_device->getGraphicsCommandPool().createCommandBuffer();
 	}
 
-	void RenderPanel::doCreateTexture()
+	void Scenario::doCreateTexture()
 	{
 		std::string shadersFolder = common::getPath( common::getExecutableDirectory() ) / "share" / "Assets";
 		auto image = common::loadImage( shadersFolder / "texture.png" );
@@ -305,7 +286,7 @@ namespace vkapp
 			, *m_view );
 	}
 
-	void RenderPanel::doCreateUniformBuffer()
+	void Scenario::doCreateUniformBuffer()
 	{
 		m_matrixUbo = std::make_unique< renderer::UniformBuffer< renderer::Mat4 > >( *m_device
 			, 1u
@@ -317,14 +298,14 @@ namespace vkapp
 			, renderer::MemoryPropertyFlag::eDeviceLocal );
 	}
 
-	void RenderPanel::doCreateStagingBuffer()
+	void Scenario::doCreateStagingBuffer()
 	{
 		m_stagingBuffer = std::make_unique< renderer::StagingBuffer >( *m_device
 			, 0u
 			, 10000000u );
 	}
 
-	void RenderPanel::doCreateOffscreenDescriptorSet()
+	void Scenario::doCreateOffscreenDescriptorSet()
 	{
 		std::vector< renderer::DescriptorSetLayoutBinding > bindings
 		{
@@ -350,7 +331,7 @@ namespace vkapp
 		m_offscreenDescriptorSet->update();
 	}
 
-	void RenderPanel::doCreateOffscreenRenderPass()
+	void Scenario::doCreateOffscreenRenderPass()
 	{
 		renderer::RenderPassAttachmentArray attaches
 		{
@@ -395,30 +376,30 @@ namespace vkapp
 				, renderer::AccessFlag::eShaderRead } );
 	}
 
-	void RenderPanel::doCreateFrameBuffer()
+	void Scenario::doCreateFrameBuffer()
 	{
-		auto size = GetClientSize();
+		auto size = getSize();
 		m_renderTargetColour = m_device->createTexture();
 		m_renderTargetColour->setImage( renderer::PixelFormat::eR8G8B8A8
-			, { size.GetWidth(), size.GetHeight() }
+			, { size.x, size.y }
 			, renderer::ImageUsageFlag::eColourAttachment | renderer::ImageUsageFlag::eSampled );
 		m_renderTargetColourView = m_renderTargetColour->createView( m_renderTargetColour->getType()
 			, m_renderTargetColour->getFormat() );
 
 		m_renderTargetDepth = m_device->createTexture();
 		m_renderTargetDepth->setImage( DepthFormat
-			, { size.GetWidth(), size.GetHeight() }
+			, { size.x, size.y }
 			, renderer::ImageUsageFlag::eDepthStencilAttachment );
 		m_renderTargetDepthView = m_renderTargetDepth->createView( m_renderTargetDepth->getType()
 			, m_renderTargetDepth->getFormat() );
 		renderer::FrameBufferAttachmentArray attaches;
 		attaches.emplace_back( *( m_offscreenRenderPass->begin() + 0u ), *m_renderTargetColourView );
 		attaches.emplace_back( *( m_offscreenRenderPass->begin() + 1u ), *m_renderTargetDepthView );
-		m_frameBuffer = m_offscreenRenderPass->createFrameBuffer( { size.GetWidth(), size.GetHeight() }
+		m_frameBuffer = m_offscreenRenderPass->createFrameBuffer( { size.x, size.y }
 			, std::move( attaches ) );
 	}
 
-	void RenderPanel::doCreateOffscreenVertexBuffer()
+	void Scenario::doCreateOffscreenVertexBuffer()
 	{
 		m_offscreenVertexLayout = renderer::makeLayout< TexturedVertexData >( 0 );
 		m_offscreenVertexLayout->createAttribute< renderer::Vec4 >( 0u
@@ -445,12 +426,12 @@ namespace vkapp
 			, *m_offscreenIndexBuffer );
 	}
 
-	void RenderPanel::doCreateOffscreenPipeline()
+	void Scenario::doCreateOffscreenPipeline()
 	{
 		renderer::PushConstantRange range{ renderer::ShaderStageFlag::eFragment, 0u, m_objectPcbs[0].getSize() };
 		m_offscreenPipelineLayout = m_device->createPipelineLayout( renderer::DescriptorSetLayoutCRefArray{ { *m_offscreenDescriptorLayout } }
 			, renderer::PushConstantRangeCRefArray{ { range } } );
-		wxSize size{ GetClientSize() };
+		auto size = getSize();
 		std::string shadersFolder = common::getPath( common::getExecutableDirectory() ) / "share" / AppName / "Shaders";
 
 		if ( !wxFileExists( shadersFolder / "offscreen.vert" )
@@ -478,7 +459,7 @@ namespace vkapp
 		} );
 	}
 
-	void RenderPanel::doCreateMainDescriptorSet()
+	void Scenario::doCreateMainDescriptorSet()
 	{
 		std::vector< renderer::DescriptorSetLayoutBinding > bindings
 		{
@@ -493,7 +474,7 @@ namespace vkapp
 		m_mainDescriptorSet->update();
 	}
 
-	void RenderPanel::doCreateMainRenderPass()
+	void Scenario::doCreateMainRenderPass()
 	{
 		renderer::RenderPassAttachmentArray attaches
 		{
@@ -526,14 +507,14 @@ namespace vkapp
 				, renderer::AccessFlag::eMemoryRead } );
 	}
 
-	void RenderPanel::doPrepareOffscreenFrame()
+	void Scenario::doPrepareOffscreenFrame()
 	{
 		doUpdateProjection();
 		m_queryPool = m_device->createQueryPool( renderer::QueryType::eTimestamp
 			, 2u
 			, 0u );
 		m_commandBuffer = m_device->getGraphicsCommandPool().createCommandBuffer();
-		wxSize size{ GetClientSize() };
+		auto size = getSize();
 		auto & commandBuffer = *m_commandBuffer;
 		auto & frameBuffer = *m_frameBuffer;
 
@@ -588,7 +569,7 @@ namespace vkapp
 		}
 	}
 
-	void RenderPanel::doCreateMainVertexBuffer()
+	void Scenario::doCreateMainVertexBuffer()
 	{
 		m_mainVertexLayout = renderer::makeLayout< TexturedVertexData >( 0 );
 		m_mainVertexLayout->createAttribute< renderer::Vec4 >( 0u
@@ -606,10 +587,10 @@ namespace vkapp
 			, renderer::PipelineStageFlag::eVertexInput );
 	}
 
-	void RenderPanel::doCreateMainPipeline()
+	void Scenario::doCreateMainPipeline()
 	{
 		m_mainPipelineLayout = m_device->createPipelineLayout( *m_mainDescriptorLayout );
-		wxSize size{ GetClientSize() };
+		auto size = getSize();
 		std::string shadersFolder = common::getPath( common::getExecutableDirectory() ) / "share" / AppName / "Shaders";
 
 		if ( !wxFileExists( shadersFolder / "main.vert" )
@@ -634,7 +615,7 @@ namespace vkapp
 		} );
 	}
 
-	void RenderPanel::doPrepareMainFrames()
+	void Scenario::doPrepareMainFrames()
 	{
 		m_frameBuffers = m_swapChain->createFrameBuffers( *m_mainRenderPass );
 		m_commandBuffers = m_swapChain->createCommandBuffers();
@@ -644,7 +625,7 @@ namespace vkapp
 			auto & frameBuffer = *m_frameBuffers[i];
 			auto & commandBuffer = *m_commandBuffers[i];
 
-			wxSize size{ GetClientSize() };
+			auto size = getSize();
 
 			if ( commandBuffer.begin( renderer::CommandBufferUsageFlag::eSimultaneousUse ) )
 			{
@@ -680,7 +661,7 @@ namespace vkapp
 		}
 	}
 
-	void RenderPanel::doUpdate()
+	void Scenario::doUpdate()
 	{
 		static renderer::Mat4 const originalTranslate1 = []()
 		{
@@ -716,7 +697,7 @@ namespace vkapp
 			, renderer::PipelineStageFlag::eVertexShader );
 	}
 
-	void RenderPanel::doDraw()
+	bool Scenario::doDraw()
 	{
 		auto resources = m_swapChain->getResources();
 
@@ -735,47 +716,28 @@ namespace vkapp
 					, resources->getRenderingFinishedSemaphore()
 					, &resources->getFence() );
 				m_swapChain->present( *resources );
-				renderer::UInt32Array values{ 0u, 0u };
+				renderer::UInt64Array values{ 0u, 0u };
 				m_queryPool->getResults( 0u
 					, 2u
-					, 0u
-					, renderer::QueryResultFlag::eWait
+					, sizeof( uint64_t )
+					, renderer::QueryResultFlag::eWait | renderer::QueryResultFlag::e64
 					, values );
 
 				// Elapsed time in nanoseconds
-				auto elapsed = std::chrono::nanoseconds{ uint64_t( ( values[1] - values[0] ) / float( m_device->getTimestampPeriod() ) ) };
+				auto elapsed = std::chrono::nanoseconds{ uint64_t( double( values[1] - values[0] ) * double( m_device->getTimestampPeriod() ) ) };
 				auto after = std::chrono::high_resolution_clock::now();
-				wxGetApp().updateFps( std::chrono::duration_cast< std::chrono::microseconds >( elapsed )
+				onFrame( std::chrono::duration_cast< std::chrono::microseconds >( elapsed )
 					, std::chrono::duration_cast< std::chrono::microseconds >( after - before ) );
 			}
 		}
-		else
-		{
-			m_timer->Stop();
-		}
-	}
 
-	void RenderPanel::doResetSwapChain()
-	{
-		m_device->waitIdle();
-		wxSize size{ GetClientSize() };
-		m_swapChain->reset( { size.GetWidth(), size.GetHeight() } );
+		return resources != nullptr;
 	}
 
-	void RenderPanel::onTimer( wxTimerEvent & event )
+	void Scenario::doResetSwapChain()
 	{
-		if ( event.GetId() == int( Ids::RenderTimer ) )
-		{
-			doUpdate();
-			doDraw();
-		}
-	}
-
-	void RenderPanel::onSize( wxSizeEvent & event )
-	{
-		m_timer->Stop();
-		doResetSwapChain();
-		m_timer->Start( TimerTimeMs );
-		event.Skip();
+		m_device->waitIdle();
+		auto size = getSize();
+		m_swapChain->reset( { size.x, size.y } );
 	}
 }
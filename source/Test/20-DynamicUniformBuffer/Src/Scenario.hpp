@@ -2,6 +2,8 @@
 
 #include "Prerequisites.hpp"
 
+#include <Scenario.hpp>
+
 #include <Buffer/PushConstantsBuffer.hpp>
 #include <Core/Connection.hpp>
 #include <Core/Device.hpp>
@@ -14,20 +16,20 @@
 
 #include <ObjLoader.hpp>
 
-#include <wx/panel.h>
-
 #include <array>
 
 namespace vkapp
 {
-	class RenderPanel
-		: public wxPanel
+	class Scenario
+		: public common::Scenario
 	{
 	public:
-		RenderPanel( wxWindow * parent
-			, wxSize const & size
+		Scenario( renderer::ConnectionPtr connection
+			, renderer::UIVec2 const & size
 			, renderer::Renderer const & renderer );
-		~RenderPanel();
+		~Scenario();
+
+		renderer::Device const & getDevice()const override;
 
 	private:
 		/**
@@ -37,7 +39,8 @@ namespace vkapp
 		/**@{*/
 		void doCleanup();
 		void doUpdateProjection();
-		void doCreateDevice( renderer::Renderer const & renderer );
+		void doCreateDevice( renderer::Renderer const & renderer
+			, renderer::ConnectionPtr connection );
 		void doCreateSwapChain();
 		void doCreateTexture();
 		void doCreateUniformBuffer();
@@ -59,21 +62,12 @@ namespace vkapp
 		*	Rendering.
 		*/
 		/**@{*/
-		void doUpdate();
-		void doDraw();
-		void doResetSwapChain();
-		/**@}*/
-		/**
-		*\name
-		*	Events.
-		*/
-		/**@{*/
-		void onTimer( wxTimerEvent & event );
-		void onSize( wxSizeEvent & event );
+		void doUpdate()override;
+		bool doDraw()override;
+		void doResetSwapChain()override;
 		/**@}*/
 
 	private:
-		wxTimer * m_timer{ nullptr };
 		renderer::Mat4 m_rotate[2];
 		/**
 		*\name
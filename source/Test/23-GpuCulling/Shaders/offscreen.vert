@@ -0,0 +1,22 @@
+layout( set=0, binding=1 ) uniform Matrix
+{
+	mat4 mtxViewProjection;
+};
+
+layout( location=0 ) in vec4 position;
+layout( location=1 ) in vec2 texcoord;
+layout( location=2 ) in vec4 instance;
+
+out gl_PerVertex
+{
+  vec4 gl_Position;
+};
+
+layout( location = 0 ) out vec2 vtx_texcoord;
+
+void main()
+{
+	// instance.xyz is the visible object's centre, instance.w its bounding radius.
+	gl_Position = mtxViewProjection * vec4( position.xyz + instance.xyz, 1.0 );
+	vtx_texcoord = texcoord;
+}
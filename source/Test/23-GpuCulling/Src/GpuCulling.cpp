@@ -0,0 +1,234 @@
+#include "GpuCulling.hpp"
+
+#include <Buffer/StagingBuffer.hpp>
+#include <Command/CommandBuffer.hpp>
+#include <Core/Device.hpp>
+#include <Descriptor/DescriptorSet.hpp>
+#include <Descriptor/DescriptorSetLayout.hpp>
+#include <Descriptor/DescriptorSetLayoutBinding.hpp>
+#include <Descriptor/DescriptorSetPool.hpp>
+#include <Pipeline/ComputePipeline.hpp>
+#include <Pipeline/PipelineLayout.hpp>
+#include <Shader/ShaderProgram.hpp>
+
+#include <FileUtils.hpp>
+
+#include <cmath>
+
+namespace vkapp
+{
+	namespace
+	{
+		static uint32_t constexpr GroupSize = 64u;
+
+		renderer::Vec4 getRow( renderer::Mat4 const & matrix
+			, size_t index )
+		{
+			return renderer::Vec4{ matrix[0][index]
+				, matrix[1][index]
+				, matrix[2][index]
+				, matrix[3][index] };
+		}
+
+		renderer::Vec4 normalisePlane( renderer::Vec4 const & plane )
+		{
+			auto length = std::sqrt( plane.x * plane.x
+				+ plane.y * plane.y
+				+ plane.z * plane.z );
+			return renderer::Vec4{ plane.x / length
+				, plane.y / length
+				, plane.z / length
+				, plane.w / length };
+		}
+
+		std::array< renderer::Vec4, 6u > getFrustumPlanes( renderer::Mat4 const & viewProjection )
+		{
+			// Gribb/Hartmann extraction, the near plane uses the [-w, w] clip range,
+			// which stays conservative for the [0, w] one.
+			auto r0 = getRow( viewProjection, 0u );
+			auto r1 = getRow( viewProjection, 1u );
+			auto r2 = getRow( viewProjection, 2u );
+			auto r3 = getRow( viewProjection, 3u );
+			return
+			{
+				normalisePlane( r3 + r0 ),
+				normalisePlane( r3 - r0 ),
+				normalisePlane( r3 + r1 ),
+				normalisePlane( r3 - r1 ),
+				normalisePlane( r3 + r2 ),
+				normalisePlane( r3 - r2 ),
+			};
+		}
+	}
+
+	GpuCulling::GpuCulling( renderer::Device const & device
+		, renderer::StagingBuffer const & stagingBuffer
+		, renderer::CommandBuffer const & commandBuffer
+		, std::vector< renderer::Vec4 > const & bounds
+		, renderer::DrawIndexedIndirectCommand const & command
+		, uint32_t instanceBinding )
+		: m_device{ device }
+		, m_stagingBuffer{ stagingBuffer }
+	{
+		doCreateBuffers( stagingBuffer
+			, commandBuffer
+			, bounds
+			, command
+			, instanceBinding );
+		doCreateDescriptorSet();
+		doCreatePipeline();
+	}
+
+	void GpuCulling::update( renderer::CommandBuffer const & commandBuffer
+		, renderer::Mat4 const & viewProjection
+		, uint32_t objectCount )
+	{
+		auto & configuration = m_configurationUbo->getData( 0u );
+		configuration.planes = getFrustumPlanes( viewProjection );
+		configuration.objectCount = renderer::IVec4{ int( std::min( objectCount, m_boundsBuffer->getCount() ) ), 0, 0, 0 };
+		m_stagingBuffer.uploadUniformData( commandBuffer
+			, m_configurationUbo->getDatas()
+			, *m_configurationUbo
+			, renderer::PipelineStageFlag::eComputeShader );
+	}
+
+	void GpuCulling::cull( renderer::CommandBuffer const & commandBuffer
+		, uint32_t objectCount )const
+	{
+		objectCount = std::min( objectCount, m_boundsBuffer->getCount() );
+		// Reset the instance count.
+		commandBuffer.transition( m_indirectBuffer->getBuffer()
+			, renderer::AccessFlag::eTransferWrite
+			, renderer::PipelineStageFlag::eTransfer );
+		commandBuffer.copyBuffer( m_commandTemplate->getBuffer()
+			, m_indirectBuffer->getBuffer()
+			, uint32_t( sizeof( renderer::DrawIndexedIndirectCommand ) ) );
+		// Cull and compact.
+		commandBuffer.transition( m_indirectBuffer->getBuffer()
+			, renderer::AccessFlag::eShaderRead | renderer::AccessFlag::eShaderWrite
+			, renderer::PipelineStageFlag::eComputeShader );
+		commandBuffer.transition( m_visibleBuffer->getBuffer()
+			, renderer::AccessFlag::eShaderWrite
+			, renderer::PipelineStageFlag::eComputeShader );
+		commandBuffer.bindPipeline( *m_pipeline );
+		commandBuffer.bindDescriptorSet( *m_descriptorSet
+			, *m_pipelineLayout
+			, renderer::PipelineBindPoint::eCompute );
+		commandBuffer.dispatch( ( objectCount + GroupSize - 1u ) / GroupSize
+			, 1u
+			, 1u );
+		// Make the results visible to the draw.
+		commandBuffer.transition( m_indirectBuffer->getBuffer()
+			, renderer::AccessFlag::eIndirectCommandRead
+			, renderer::PipelineStageFlag::eDrawIndirect );
+		commandBuffer.transition( m_visibleBuffer->getBuffer()
+			, renderer::AccessFlag::eVertexAttributeRead
+			, renderer::PipelineStageFlag::eVertexInput );
+	}
+
+	void GpuCulling::draw( renderer::CommandBuffer const & commandBuffer )const
+	{
+		commandBuffer.bindVertexBuffer( m_visibleLayout->getBindingSlot()
+			, m_visibleBuffer->getBuffer()
+			, 0u );
+		commandBuffer.drawIndexedIndirect( m_indirectBuffer->getBuffer()
+			, 0u
+			, 1u
+			, uint32_t( sizeof( renderer::DrawIndexedIndirectCommand ) ) );
+	}
+
+	void GpuCulling::doCreateBuffers( renderer::StagingBuffer const & stagingBuffer
+		, renderer::CommandBuffer const & commandBuffer
+		, std::vector< renderer::Vec4 > const & bounds
+		, renderer::DrawIndexedIndirectCommand const & command
+		, uint32_t instanceBinding )
+	{
+		auto count = uint32_t( bounds.size() );
+		m_configurationUbo = std::make_unique< renderer::UniformBuffer< Configuration > >( m_device
+			, 1u
+			, renderer::BufferTarget::eTransferDst
+			, renderer::MemoryPropertyFlag::eDeviceLocal );
+
+		m_boundsBuffer = renderer::makeBuffer< renderer::Vec4 >( m_device
+			, count
+			, renderer::BufferTarget::eStorageBuffer | renderer::BufferTarget::eTransferDst
+			, renderer::MemoryPropertyFlag::eDeviceLocal );
+		stagingBuffer.uploadBufferData( commandBuffer
+			, bounds
+			, *m_boundsBuffer );
+
+		m_visibleLayout = renderer::makeLayout< renderer::Vec4 >( instanceBinding
+			, renderer::VertexInputRate::eInstance );
+		m_visibleLayout->createAttribute< renderer::Vec4 >( 2u, 0u );
+		m_visibleBuffer = renderer::makeVertexBuffer< renderer::Vec4 >( m_device
+			, count
+			, renderer::BufferTarget::eStorageBuffer
+			, renderer::MemoryPropertyFlag::eDeviceLocal );
+
+		auto commandTemplate = command;
+		commandTemplate.instanceCount = 0u;
+		commandTemplate.firstInstance = 0u;
+		std::vector< renderer::DrawIndexedIndirectCommand > commands{ commandTemplate };
+		m_commandTemplate = renderer::makeBuffer< renderer::DrawIndexedIndirectCommand >( m_device
+			, 1u
+			, renderer::BufferTarget::eTransferSrc | renderer::BufferTarget::eTransferDst
+			, renderer::MemoryPropertyFlag::eDeviceLocal );
+		stagingBuffer.uploadBufferData( commandBuffer
+			, commands
+			, *m_commandTemplate );
+		m_indirectBuffer = renderer::makeBuffer< renderer::DrawIndexedIndirectCommand >( m_device
+			, 1u
+			, renderer::BufferTarget::eDrawIndirectBuffer | renderer::BufferTarget::eStorageBuffer | renderer::BufferTarget::eTransferDst
+			, renderer::MemoryPropertyFlag::eDeviceLocal );
+	}
+
+	void GpuCulling::doCreateDescriptorSet()
+	{
+		std::vector< renderer::DescriptorSetLayoutBinding > bindings
+		{
+			renderer::DescriptorSetLayoutBinding{ 0u, renderer::DescriptorType::eUniformBuffer, renderer::ShaderStageFlag::eCompute },
+			renderer::DescriptorSetLayoutBinding{ 1u, renderer::DescriptorType::eStorageBuffer, renderer::ShaderStageFlag::eCompute },
+			renderer::DescriptorSetLayoutBinding{ 2u, renderer::DescriptorType::eStorageBuffer, renderer::ShaderStageFlag::eCompute },
+			renderer::DescriptorSetLayoutBinding{ 3u, renderer::DescriptorType::eStorageBuffer, renderer::ShaderStageFlag::eCompute },
+		};
+		m_descriptorLayout = m_device.createDescriptorSetLayout( std::move( bindings ) );
+		m_descriptorPool = m_descriptorLayout->createPool( 1u );
+		m_descriptorSet = m_descriptorPool->createDescriptorSet();
+		m_descriptorSet->createBinding( m_descriptorLayout->getBinding( 0u )
+			, *m_configurationUbo
+			, 0u
+			, 1u );
+		m_descriptorSet->createBinding( m_descriptorLayout->getBinding( 1u )
+			, *m_boundsBuffer
+			, 0u
+			, uint32_t( m_boundsBuffer->getCount() * sizeof( renderer::Vec4 ) ) );
+		m_descriptorSet->createBinding( m_descriptorLayout->getBinding( 2u )
+			, m_visibleBuffer->getBuffer()
+			, 0u
+			, uint32_t( m_visibleBuffer->getCount() * sizeof( renderer::Vec4 ) ) );
+		m_descriptorSet->createBinding( m_descriptorLayout->getBinding( 3u )
+			, *m_indirectBuffer
+			, 0u
+			, uint32_t( sizeof( renderer::DrawIndexedIndirectCommand ) ) );
+		m_descriptorSet->update();
+	}
+
+	void GpuCulling::doCreatePipeline()
+	{
+		m_pipelineLayout = m_device.createPipelineLayout( *m_descriptorLayout );
+		std::string shadersFolder = common::getPath( common::getExecutableDirectory() ) / "share" / AppName / "Shaders";
+
+		if ( !wxFileExists( shadersFolder / "culling.comp" ) )
+		{
+			throw std::runtime_error{ "Shader files are missing" };
+		}
+
+		renderer::ShaderStageState shaderStage
+		{
+			m_device.createShaderModule( renderer::ShaderStageFlag::eCompute )
+		};
+		shaderStage.getModule().loadShader( common::parseShaderFile( m_device, shadersFolder / "culling.comp" ) );
+
+		m_pipeline = m_pipelineLayout->createPipeline( std::move( shaderStage ) );
+	}
+}
@@ -0,0 +1,179 @@
+#pragma once
+
+#include "Prerequisites.hpp"
+
+#include <Buffer/Buffer.hpp>
+#include <Buffer/UniformBuffer.hpp>
+#include <Buffer/VertexBuffer.hpp>
+#include <Miscellaneous/DrawIndexedIndirectCommand.hpp>
+#include <Pipeline/VertexLayout.hpp>
+
+#include <array>
+
+namespace vkapp
+{
+	/**
+	*\~english
+	*\brief
+	*	GPU frustum culling and indirect draw generation.
+	*\remarks
+	*	A compute pass tests each object's bounding sphere against the camera frustum,
+	*	and compacts the visible ones into a per-instance vertex buffer, incrementing
+	*	the instance count of an indirect draw command.
+	*	All the visible objects are then drawn through one drawIndexedIndirect call.
+	*\~french
+	*\brief
+	*	Culling de frustum et génération de dessins indirects sur le GPU.
+	*\remarks
+	*	Une passe de calcul teste la sphère englobante de chaque objet contre le frustum
+	*	de la caméra, et compacte les objets visibles dans un tampon de sommets par instance,
+	*	en incrémentant le nombre d'instances d'une commande de dessin indirect.
+	*	Tous les objets visibles sont ensuite dessinés via un seul appel à drawIndexedIndirect.
+	*/
+	class GpuCulling
+	{
+	public:
+		/**
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] stagingBuffer
+		*	The staging buffer used to upload the data.
+		*\param[in] commandBuffer
+		*	The command buffer used to upload the data.
+		*\param[in] bounds
+		*	The objects bounding spheres (xyz: centre, w: radius).
+		*\param[in] command
+		*	The draw command shared by all the objects, its instance count is ignored.
+		*\param[in] instanceBinding
+		*	The binding index of the per-instance vertex buffer.
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] stagingBuffer
+		*	Le tampon de transfert utilisé pour téléverser les données.
+		*\param[in] commandBuffer
+		*	Le tampon de commandes utilisé pour téléverser les données.
+		*\param[in] bounds
+		*	Les sphères englobantes des objets (xyz : centre, w : rayon).
+		*\param[in] command
+		*	La commande de dessin partagée par tous les objets, son nombre d'instances est ignoré.
+		*\param[in] instanceBinding
+		*	L'indice d'attache du tampon de sommets par instance.
+		*/
+		GpuCulling( renderer::Device const & device
+			, renderer::StagingBuffer const & stagingBuffer
+			, renderer::CommandBuffer const & commandBuffer
+			, std::vector< renderer::Vec4 > const & bounds
+			, renderer::DrawIndexedIndirectCommand const & command
+			, uint32_t instanceBinding );
+		/**
+		*\~english
+		*\brief
+		*	Updates the frustum planes and the number of culled objects.
+		*\param[in] commandBuffer
+		*	The command buffer used to upload the data.
+		*\param[in] viewProjection
+		*	The camera view projection matrix.
+		*\param[in] objectCount
+		*	The number of objects to process, from the beginning of the bounds buffer.
+		*\~french
+		*\brief
+		*	Met à jour les plans du frustum et le nombre d'objets traités.
+		*\param[in] commandBuffer
+		*	Le tampon de commandes utilisé pour téléverser les données.
+		*\param[in] viewProjection
+		*	La matrice vue projection de la caméra.
+		*\param[in] objectCount
+		*	Le nombre d'objets à traiter, depuis le début du tampon de volumes englobants.
+		*/
+		void update( renderer::CommandBuffer const & commandBuffer
+			, renderer::Mat4 const & viewProjection
+			, uint32_t objectCount );
+		/**
+		*\~english
+		*\brief
+		*	Records the culling pass.
+		*\remarks
+		*	Must be recorded outside of a render pass.
+		*\param[in] commandBuffer
+		*	The command buffer.
+		*\param[in] objectCount
+		*	The maximum number of objects processed by the recorded dispatch.
+		*\~french
+		*\brief
+		*	Enregistre la passe de culling.
+		*\remarks
+		*	Doit être enregistrée en dehors d'une passe de rendu.
+		*\param[in] commandBuffer
+		*	Le tampon de commandes.
+		*\param[in] objectCount
+		*	Le nombre maximal d'objets traités par le dispatch enregistré.
+		*/
+		void cull( renderer::CommandBuffer const & commandBuffer
+			, uint32_t objectCount )const;
+		/**
+		*\~english
+		*\brief
+		*	Records the indirect draw of the visible objects.
+		*\remarks
+		*	The pipeline, the index buffer and the per-vertex buffers must already be bound.
+		*\param[in] commandBuffer
+		*	The command buffer.
+		*\~french
+		*\brief
+		*	Enregistre le dessin indirect des objets visibles.
+		*\remarks
+		*	Le pipeline, le tampon d'indices et les tampons de sommets doivent déjà être liés.
+		*\param[in] commandBuffer
+		*	Le tampon de commandes.
+		*/
+		void draw( renderer::CommandBuffer const & commandBuffer )const;
+		/**
+		*\~english
+		*\return
+		*	The layout of the per-instance vertex buffer (one Vec4 per visible object).
+		*\~french
+		*\return
+		*	Le layout du tampon de sommets par instance (un Vec4 par objet visible).
+		*/
+		inline renderer::VertexLayout const & getInstanceLayout()const
+		{
+			return *m_visibleLayout;
+		}
+
+	private:
+		void doCreateBuffers( renderer::StagingBuffer const & stagingBuffer
+			, renderer::CommandBuffer const & commandBuffer
+			, std::vector< renderer::Vec4 > const & bounds
+			, renderer::DrawIndexedIndirectCommand const & command
+			, uint32_t instanceBinding );
+		void doCreateDescriptorSet();
+		void doCreatePipeline();
+
+	private:
+		struct Configuration
+		{
+			std::array< renderer::Vec4, 6u > planes;
+			renderer::IVec4 objectCount;
+		};
+
+		renderer::Device const & m_device;
+		renderer::StagingBuffer const & m_stagingBuffer;
+		renderer::UniformBufferPtr< Configuration > m_configurationUbo;
+		renderer::BufferPtr< renderer::Vec4 > m_boundsBuffer;
+		renderer::VertexBufferPtr< renderer::Vec4 > m_visibleBuffer;
+		renderer::VertexLayoutPtr m_visibleLayout;
+		renderer::BufferPtr< renderer::DrawIndexedIndirectCommand > m_indirectBuffer;
+		renderer::BufferPtr< renderer::DrawIndexedIndirectCommand > m_commandTemplate;
+		renderer::DescriptorSetLayoutPtr m_descriptorLayout;
+		renderer::DescriptorSetPoolPtr m_descriptorPool;
+		renderer::DescriptorSetPtr m_descriptorSet;
+		renderer::PipelineLayoutPtr m_pipelineLayout;
+		renderer::ComputePipelinePtr m_pipeline;
+	};
+}
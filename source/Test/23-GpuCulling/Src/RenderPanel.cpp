@@ -0,0 +1,924 @@
+#include "RenderPanel.hpp"
+
+#include "Application.hpp"
+#include "MainFrame.hpp"
+
+#include <Buffer/StagingBuffer.hpp>
+#include <Buffer/UniformBuffer.hpp>
+#include <Buffer/VertexBuffer.hpp>
+#include <Command/Queue.hpp>
+#include <Core/BackBuffer.hpp>
+#include <Core/Connection.hpp>
+#include <Core/Device.hpp>
+#include <Core/Renderer.hpp>
+#include <Core/SwapChain.hpp>
+#include <Descriptor/DescriptorSet.hpp>
+#include <Descriptor/DescriptorSetLayout.hpp>
+#include <Descriptor/DescriptorSetLayoutBinding.hpp>
+#include <Descriptor/DescriptorSetPool.hpp>
+#include <Image/Texture.hpp>
+#include <Image/TextureView.hpp>
+#include <Miscellaneous/QueryPool.hpp>
+#include <Pipeline/DepthStencilState.hpp>
+#include <Pipeline/InputAssemblyState.hpp>
+#include <Pipeline/MultisampleState.hpp>
+#include <Pipeline/Scissor.hpp>
+#include <Pipeline/VertexLayout.hpp>
+#include <Pipeline/Viewport.hpp>
+#include <RenderPass/FrameBuffer.hpp>
+#include <RenderPass/RenderPass.hpp>
+#include <RenderPass/RenderSubpass.hpp>
+#include <RenderPass/RenderSubpassState.hpp>
+#include <Shader/ShaderProgram.hpp>
+#include <Sync/ImageMemoryBarrier.hpp>
+
+#include <Utils/Transform.hpp>
+
+#include <FileUtils.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+
+namespace vkapp
+{
+	namespace
+	{
+		enum class Ids
+		{
+			RenderTimer = 42
+		}	Ids;
+
+		static int constexpr TimerTimeMs = 40;
+		static renderer::PixelFormat const DepthFormat = renderer::PixelFormat::eD32F;
+		static uint32_t constexpr ObjectSide = 64u;
+		static uint32_t constexpr MaxObjectCount = ObjectSide * ObjectSide * ObjectSide;
+		// The benchmark renders FramesPerStep frames for each of these object counts.
+		static std::array< uint32_t, 6u > const ObjectCounts
+		{
+			1024u,
+			8192u,
+			32768u,
+			65536u,
+			131072u,
+			MaxObjectCount,
+		};
+		static uint32_t constexpr FramesPerStep = 100u;
+
+		uint32_t countVisible( std::vector< renderer::Vec4 > const & bounds
+			, uint32_t objectCount
+			, renderer::Mat4 const & viewProjection )
+		{
+			// Same test as culling.comp, used as the CPU reference in the benchmark.
+			std::array< renderer::Vec4, 6u > planes;
+			renderer::Vec4 rows[4];
+
+			for ( size_t i = 0u; i < 4u; ++i )
+			{
+				rows[i] = renderer::Vec4{ viewProjection[0][i]
+					, viewProjection[1][i]
+					, viewProjection[2][i]
+					, viewProjection[3][i] };
+			}
+
+			planes[0] = rows[3] + rows[0];
+			planes[1] = rows[3] - rows[0];
+			planes[2] = rows[3] + rows[1];
+			planes[3] = rows[3] - rows[1];
+			planes[4] = rows[3] + rows[2];
+			planes[5] = rows[3] - rows[2];
+
+			for ( auto & plane : planes )
+			{
+				plane /= std::sqrt( plane.x * plane.x + plane.y * plane.y + plane.z * plane.z );
+			}
+
+			uint32_t result = 0u;
+
+			for ( uint32_t index = 0u; index < objectCount; ++index )
+			{
+				auto & sphere = bounds[index];
+				auto visible = true;
+
+				for ( auto & plane : planes )
+				{
+					visible = visible
+						&& ( plane.x * sphere.x + plane.y * sphere.y + plane.z * sphere.z + plane.w >= -sphere.w );
+				}
+
+				result += visible ? 1u : 0u;
+			}
+
+			return result;
+		}
+	}
+
+	RenderPanel::RenderPanel( wxWindow * parent
+		, wxSize const & size
+		, renderer::Renderer const & renderer )
+		: wxPanel{ parent, wxID_ANY, wxDefaultPosition, size }
+		, m_timer{ new wxTimer{ this, int( Ids::RenderTimer ) } }
+		, m_offscreenVertexData
+		{
+			// Front
+			{ { -1.0, -1.0, +1.0, 1.0 }, { 0.0, 0.0 } },
+			{ { -1.0, +1.0, +1.0, 1.0 }, { 0.0, 1.0 } },
+			{ { +1.0, -1.0, +1.0, 1.0 }, { 1.0, 0.0 } },
+			{ { +1.0, +1.0, +1.0, 1.0 }, { 1.0, 1.0 } },
+			// Top
+			{ { -1.0, +1.0, +1.0, 1.0 }, { 0.0, 0.0 } },
+			{ { -1.0, +1.0, -1.0, 1.0 }, { 0.0, 1.0 } },
+			{ { +1.0, +1.0, +1.0, 1.0 }, { 1.0, 0.0 } },
+			{ { +1.0, +1.0, -1.0, 1.0 }, { 1.0, 1.0 } },
+			// Back
+			{ { -1.0, +1.0, -1.0, 1.0 }, { 1.0, 1.0 } },
+			{ { -1.0, -1.0, -1.0, 1.0 }, { 1.0, 0.0 } },
+			{ { +1.0, +1.0, -1.0, 1.0 }, { 0.0, 1.0 } },
+			{ { +1.0, -1.0, -1.0, 1.0 }, { 0.0, 0.0 } },
+			// Bottom
+			{ { -1.0, -1.0, -1.0, 1.0 }, { 1.0, 1.0 } },
+			{ { -1.0, -1.0, +1.0, 1.0 }, { 1.0, 0.0 } },
+			{ { +1.0, -1.0, -1.0, 1.0 }, { 0.0, 1.0 } },
+			{ { +1.0, -1.0, +1.0, 1.0 }, { 0.0, 0.0 } },
+			// Right
+			{ { +1.0, -1.0, +1.0, 1.0 }, { 0.0, 0.0 } },
+			{ { +1.0, +1.0, +1.0, 1.0 }, { 0.0, 1.0 } },
+			{ { +1.0, -1.0, -1.0, 1.0 }, { 1.0, 0.0 } },
+			{ { +1.0, +1.0, -1.0, 1.0 }, { 1.0, 1.0 } },
+			// Left
+			{ { -1.0, -1.0, -1.0, 1.0 }, { 0.0, 0.0 } },
+			{ { -1.0, +1.0, -1.0, 1.0 }, { 0.0, 1.0 } },
+			{ { -1.0, -1.0, +1.0, 1.0 }, { 1.0, 0.0 } },
+			{ { -1.0, +1.0, +1.0, 1.0 }, { 1.0, 1.0 } },
+		}
+		, m_offscreenIndexData
+		{
+			// Front
+			0, 1, 2, 2, 1, 3,
+			// Top
+			4, 5, 6, 6, 5, 7,
+			// Back
+			8, 9, 10, 10, 9, 11,
+			// Bottom
+			12, 13, 14, 14, 13, 15,
+			// Right
+			16, 17, 18, 18, 17, 19,
+			// Left
+			20, 21, 22, 22, 21, 23,
+		}
+		, m_mainVertexData
+		{
+			{ { -1.0, -1.0, 0.0, 1.0 }, { 0.0, 0.0 } },
+			{ { -1.0, +1.0, 0.0, 1.0 }, { 0.0, 1.0 } },
+			{ { +1.0, -1.0, 0.0, 1.0 }, { 1.0, 0.0 } },
+			{ { +1.0, +1.0, 0.0, 1.0 }, { 1.0, 1.0 } },
+		}
+	{
+		try
+		{
+			doCreateDevice( renderer );
+			std::cout << "Logical device created." << std::endl;
+			doCreateSwapChain();
+			std::cout << "Swap chain created." << std::endl;
+			doCreateStagingBuffer();
+			std::cout << "Staging buffer created." << std::endl;
+			doCreateTexture();
+			std::cout << "Texture created." << std::endl;
+			doCreateUniformBuffer();
+			std::cout << "Uniform buffer created." << std::endl;
+			doCreateOffscreenDescriptorSet();
+			std::cout << "Offscreen descriptor set created." << std::endl;
+			doCreateOffscreenRenderPass();
+			std::cout << "Offscreen render pass created." << std::endl;
+			doCreateFrameBuffer();
+			std::cout << "Frame buffer created." << std::endl;
+			doCreateOffscreenVertexBuffer();
+			std::cout << "Offscreen vertex buffer created." << std::endl;
+			doCreateOffscreenPipeline();
+			std::cout << "Offscreen pipeline created." << std::endl;
+			doPrepareOffscreenFrame();
+			std::cout << "Offscreen frame prepared." << std::endl;
+			doCreateMainDescriptorSet();
+			std::cout << "Main descriptor set created." << std::endl;
+			doCreateMainRenderPass();
+			std::cout << "Main render pass created." << std::endl;
+			doCreateMainVertexBuffer();
+			std::cout << "Main vertex buffer created." << std::endl;
+			doCreateMainPipeline();
+			std::cout << "Main pipeline created." << std::endl;
+			doPrepareMainFrames();
+			std::cout << "Main frames prepared." << std::endl;
+		}
+		catch ( std::exception & )
+		{
+			doCleanup();
+			throw;
+		}
+
+		std::cout << "Benchmark: " << FramesPerStep << " frames per object count." << std::endl;
+		m_timer->Start( TimerTimeMs );
+
+		Connect( int( Ids::RenderTimer )
+			, wxEVT_TIMER
+			, wxTimerEventHandler( RenderPanel::onTimer )
+			, nullptr
+			, this );
+		Connect( wxID_ANY
+			, wxEVT_SIZE
+			, wxSizeEventHandler( RenderPanel::onSize )
+			, nullptr
+			, this );
+		Connect( GetId()
+			, wxEVT_LEFT_DOWN
+			, wxMouseEventHandler( RenderPanel::onMouseLDown )
+			, nullptr
+			, this );
+		Connect( GetId()
+			, wxEVT_LEFT_DCLICK
+			, wxMouseEventHandler( RenderPanel::onMouseLDoubleClick )
+			, nullptr
+			, this );
+		Connect( GetId()
+			, wxEVT_LEFT_UP
+			, wxMouseEventHandler( RenderPanel::onMouseLUp )
+			, nullptr
+			, this );
+		Connect( GetId()
+			, wxEVT_MOTION
+			, wxMouseEventHandler( RenderPanel::onMouseMove )
+			, nullptr
+			, this );
+	}
+
+	RenderPanel::~RenderPanel()
+	{
+		doCleanup();
+	}
+
+	void RenderPanel::doCleanup()
+	{
+		delete m_timer;
+
+		if ( m_device )
+		{
+			m_device->waitIdle();
+
+			m_updateCommandBuffer.reset();
+			m_commandBuffer.reset();
+			m_commandBuffers.clear();
+			m_frameBuffers.clear();
+			m_sampler.reset();
+			m_view.reset();
+			m_texture.reset();
+			m_stagingBuffer.reset();
+
+			m_matrixUbo.reset();
+			m_mainDescriptorSet.reset();
+			m_mainDescriptorPool.reset();
+			m_mainDescriptorLayout.reset();
+			m_mainPipeline.reset();
+			m_mainPipelineLayout.reset();
+			m_mainVertexBuffer.reset();
+			m_mainVertexBuffer.reset();
+			m_mainRenderPass.reset();
+
+			m_queryPool.reset();
+			m_offscreenDescriptorSet.reset();
+			m_offscreenDescriptorPool.reset();
+			m_offscreenDescriptorLayout.reset();
+			m_offscreenPipeline.reset();
+			m_offscreenPipelineLayout.reset();
+			m_culling.reset();
+			m_offscreenIndexBuffer.reset();
+			m_offscreenVertexBuffer.reset();
+			m_offscreenRenderPass.reset();
+
+			m_frameBuffer.reset();
+			m_renderTargetDepthView.reset();
+			m_renderTargetDepth.reset();
+			m_renderTargetColourView.reset();
+			m_renderTargetColour.reset();
+
+			m_swapChain.reset();
+			m_device->disable();
+			m_device.reset();
+		}
+	}
+
+	void RenderPanel::doUpdateProjection()
+	{
+		auto size = m_swapChain->getDimensions();
+#if 0
+		float halfWidth = static_cast< float >( size.x ) * 0.5f;
+		float halfHeight = static_cast< float >( size.y ) * 0.5f;
+		float wRatio = 1.0f;
+		float hRatio = 1.0f;
+
+		if ( halfHeight > halfWidth )
+		{
+			hRatio = halfHeight / halfWidth;
+		}
+		else
+		{
+			wRatio = halfWidth / halfHeight;
+		}
+
+		m_projection = m_device->ortho( -2.0f * wRatio
+			, 2.0f * wRatio
+			, -2.0f * hRatio
+			, 2.0f * hRatio
+			, 0.0f
+			, 1000.0f );
+#else
+		auto width = float( size.x );
+		auto height = float( size.y );
+		m_projection = m_device->perspective( utils::toRadians( 90.0_degrees )
+			, width / height
+			, 0.01f
+			, 1000.0f );
+#endif
+	}
+
+	void RenderPanel::doCreateDevice( renderer::Renderer const & renderer )
+	{
+		m_device = renderer.createDevice( common::makeConnection( this, renderer ) );
+		m_device->enable();
+	}
+
+	void RenderPanel::doCreateSwapChain()
+	{
+		wxSize size{ GetClientSize() };
+		m_swapChain = m_device->createSwapChain( { size.x, size.y } );
+		m_swapChain->setClearColour( { 1.0f, 0.8f, 0.4f, 0.0f } );
+		m_swapChainReset = m_swapChain->onReset.connect( [this]()
+		{
+			doCreateFrameBuffer();
+			doPrepareOffscreenFrame();
+			doCreateMainDescriptorSet();
+			doPrepareMainFrames();
+		} );
+		m_updateCommandBuffer = m_device->getGraphicsCommandPool().createCommandBuffer();
+	}
+
+	void RenderPanel::doCreateTexture()
+	{
+		std::string shadersFolder = common::getPath( common::getExecutableDirectory() ) / "share" / "Assets";
+		auto image = common::loadImage( shadersFolder / "texture.png" );
+		m_texture = m_device->createTexture();
+		m_texture->setImage( image.format, { image.size[0], image.size[1] } );
+		m_view = m_texture->createView( m_texture->getType()
+			, image.format );
+		m_sampler = m_device->createSampler( renderer::WrapMode::eClampToEdge
+			, renderer::WrapMode::eClampToEdge
+			, renderer::WrapMode::eClampToEdge
+			, renderer::Filter::eLinear
+			, renderer::Filter::eLinear );
+		m_stagingBuffer->uploadTextureData( m_swapChain->getDefaultResources().getCommandBuffer()
+			, image.data
+			, *m_view );
+	}
+
+	void RenderPanel::doCreateUniformBuffer()
+	{
+		m_matrixUbo = std::make_unique< renderer::UniformBuffer< renderer::Mat4 > >( *m_device
+			, 1u
+			, renderer::BufferTarget::eTransferDst
+			, renderer::MemoryPropertyFlag::eDeviceLocal );
+	}
+
+	void RenderPanel::doCreateStagingBuffer()
+	{
+		m_stagingBuffer = std::make_unique< renderer::StagingBuffer >( *m_device
+			, 0u
+			, MaxObjectCount * uint32_t( sizeof( renderer::Vec4 ) ) );
+	}
+
+	void RenderPanel::doCreateOffscreenDescriptorSet()
+	{
+		std::vector< renderer::DescriptorSetLayoutBinding > bindings
+		{
+			renderer::DescriptorSetLayoutBinding{ 0u, renderer::DescriptorType::eCombinedImageSampler, renderer::ShaderStageFlag::eFragment },
+			renderer::DescriptorSetLayoutBinding{ 1u, renderer::DescriptorType::eUniformBuffer, renderer::ShaderStageFlag::eVertex },
+		};
+		m_offscreenDescriptorLayout = m_device->createDescriptorSetLayout( std::move( bindings ) );
+		m_offscreenDescriptorPool = m_offscreenDescriptorLayout->createPool( 1u );
+		m_offscreenDescriptorSet = m_offscreenDescriptorPool->createDescriptorSet();
+		m_offscreenDescriptorSet->createBinding( m_offscreenDescriptorLayout->getBinding( 0u )
+			, *m_view
+			, *m_sampler );
+		m_offscreenDescriptorSet->createBinding( m_offscreenDescriptorLayout->getBinding( 1u )
+			, *m_matrixUbo
+			, 0u
+			, 1u );
+		m_offscreenDescriptorSet->update();
+	}
+
+	void RenderPanel::doCreateOffscreenRenderPass()
+	{
+		renderer::RenderPassAttachmentArray attaches
+		{
+			{
+				0u,
+				renderer::PixelFormat::eR8G8B8A8,
+				renderer::SampleCountFlag::e1,
+				renderer::AttachmentLoadOp::eClear,
+				renderer::AttachmentStoreOp::eStore,
+				renderer::AttachmentLoadOp::eDontCare,
+				renderer::AttachmentStoreOp::eDontCare,
+				renderer::ImageLayout::eUndefined,
+				renderer::ImageLayout::eShaderReadOnlyOptimal,
+			},
+			{
+				1u,
+				DepthFormat,
+				renderer::SampleCountFlag::e1,
+				renderer::AttachmentLoadOp::eClear,
+				renderer::AttachmentStoreOp::eStore,
+				renderer::AttachmentLoadOp::eDontCare,
+				renderer::AttachmentStoreOp::eDontCare,
+				renderer::ImageLayout::eUndefined,
+				renderer::ImageLayout::eDepthStencilAttachmentOptimal,
+			}
+		};
+		renderer::RenderSubpassAttachmentArray subAttaches
+		{
+			{ 0u, renderer::ImageLayout::eColourAttachmentOptimal }
+		};
+		renderer::RenderSubpassPtrArray subpasses;
+		subpasses.emplace_back( m_device->createRenderSubpass( renderer::PipelineBindPoint::eGraphics
+			, renderer::RenderSubpassState{ renderer::PipelineStageFlag::eColourAttachmentOutput
+				, renderer::AccessFlag::eColourAttachmentWrite }
+			, subAttaches
+			, { 1u, renderer::ImageLayout::eDepthStencilAttachmentOptimal } ) );
+		m_offscreenRenderPass = m_device->createRenderPass( attaches
+			, std::move( subpasses )
+			, renderer::RenderSubpassState{ renderer::PipelineStageFlag::eColourAttachmentOutput
+				, renderer::AccessFlag::eColourAttachmentWrite }
+			, renderer::RenderSubpassState{ renderer::PipelineStageFlag::eColourAttachmentOutput
+				, renderer::AccessFlag::eShaderRead } );
+	}
+
+	void RenderPanel::doCreateFrameBuffer()
+	{
+		auto size = GetClientSize();
+		m_renderTargetColour = m_device->createTexture();
+		m_renderTargetColour->setImage( renderer::PixelFormat::eR8G8B8A8
+			, { size.GetWidth(), size.GetHeight() }
+			, renderer::ImageUsageFlag::eColourAttachment | renderer::ImageUsageFlag::eSampled );
+		m_renderTargetColourView = m_renderTargetColour->createView( m_renderTargetColour->getType()
+			, m_renderTargetColour->getFormat() );
+
+		m_renderTargetDepth = m_device->createTexture();
+		m_renderTargetDepth->setImage( DepthFormat
+			, { size.GetWidth(), size.GetHeight() }
+			, renderer::ImageUsageFlag::eDepthStencilAttachment );
+		m_renderTargetDepthView = m_renderTargetDepth->createView( m_renderTargetDepth->getType()
+			, m_renderTargetDepth->getFormat() );
+		renderer::FrameBufferAttachmentArray attaches;
+		attaches.emplace_back( *( m_offscreenRenderPass->begin() + 0u ), *m_renderTargetColourView );
+		attaches.emplace_back( *( m_offscreenRenderPass->begin() + 1u ), *m_renderTargetDepthView );
+		m_frameBuffer = m_offscreenRenderPass->createFrameBuffer( { size.GetWidth(), size.GetHeight() }
+			, std::move( attaches ) );
+	}
+
+	void RenderPanel::doCreateOffscreenVertexBuffer()
+	{
+		m_offscreenVertexLayout = renderer::makeLayout< TexturedVertexData >( 0 );
+		m_offscreenVertexLayout->createAttribute< renderer::Vec4 >( 0u
+			, uint32_t( offsetof( TexturedVertexData, position ) ) );
+		m_offscreenVertexLayout->createAttribute< renderer::Vec2 >( 1u
+			, uint32_t( offsetof( TexturedVertexData, uv ) ) );
+
+		m_offscreenVertexBuffer = renderer::makeVertexBuffer< TexturedVertexData >( *m_device
+			, uint32_t( m_offscreenVertexData.size() )
+			, renderer::BufferTarget::eTransferDst
+			, renderer::MemoryPropertyFlag::eDeviceLocal );
+		m_stagingBuffer->uploadVertexData( m_swapChain->getDefaultResources().getCommandBuffer()
+			, m_offscreenVertexData
+			, *m_offscreenVertexBuffer
+			, renderer::PipelineStageFlag::eVertexInput );
+
+		m_offscreenIndexBuffer = renderer::makeBuffer< uint16_t >( *m_device
+			, uint32_t( m_offscreenIndexData.size() )
+			, renderer::BufferTarget::eIndexBuffer | renderer::BufferTarget::eTransferDst
+			, renderer::MemoryPropertyFlag::eDeviceLocal );
+		m_stagingBuffer->uploadBufferData( m_swapChain->getDefaultResources().getCommandBuffer()
+			, m_offscreenIndexData
+			, *m_offscreenIndexBuffer );
+
+		auto init = ObjectSide * -2.0f + 2.0f;
+		renderer::Vec3 position{ init, init, init };
+		// The cube's bounding sphere radius.
+		auto radius = std::sqrt( 3.0f );
+		m_offscreenBounds.reserve( MaxObjectCount );
+
+		for ( auto i = 0u; i < ObjectSide; ++i )
+		{
+			position[1] = init;
+
+			for ( auto j = 0u; j < ObjectSide; ++j )
+			{
+				position[2] = init;
+
+				for ( auto k = 0u; k < ObjectSide; ++k )
+				{
+					m_offscreenBounds.emplace_back( position[0], position[1], position[2], radius );
+					position[2] += 4;
+				}
+
+				position[1] += 4;
+			}
+
+			position[0] += 4;
+		}
+
+		m_culling = std::make_unique< GpuCulling >( *m_device
+			, *m_stagingBuffer
+			, m_swapChain->getDefaultResources().getCommandBuffer()
+			, m_offscreenBounds
+			, renderer::DrawIndexedIndirectCommand{ uint32_t( m_offscreenIndexData.size() ), 0u, 0u, 0u, 0u }
+			, 1u );
+	}
+
+	void RenderPanel::doCreateOffscreenPipeline()
+	{
+		m_offscreenPipelineLayout = m_device->createPipelineLayout( *m_offscreenDescriptorLayout );
+		wxSize size{ GetClientSize() };
+		std::string shadersFolder = common::getPath( common::getExecutableDirectory() ) / "share" / AppName / "Shaders";
+
+		if ( !wxFileExists( shadersFolder / "offscreen.vert" )
+			|| !wxFileExists( shadersFolder / "offscreen.frag" ) )
+		{
+			throw std::runtime_error{ "Shader files are missing" };
+		}
+
+		std::vector< renderer::ShaderStageState > shaderStages;
+		shaderStages.emplace_back( m_device->createShaderModule( renderer::ShaderStageFlag::eVertex ) );
+		shaderStages.emplace_back( m_device->createShaderModule( renderer::ShaderStageFlag::eFragment ) );
+		shaderStages[0].getModule().loadShader( common::parseShaderFile( *m_device, shadersFolder / "offscreen.vert" ) );
+		shaderStages[1].getModule().loadShader( common::parseShaderFile( *m_device, shadersFolder / "offscreen.frag" ) );
+
+		m_offscreenPipeline = m_offscreenPipelineLayout->createPipeline( renderer::GraphicsPipelineCreateInfo
+		{
+			std::move( shaderStages ),
+			*m_offscreenRenderPass,
+			renderer::VertexInputState::create( { *m_offscreenVertexLayout, m_culling->getInstanceLayout() } ),
+			renderer::InputAssemblyState{ renderer::PrimitiveTopology::eTriangleList },
+			renderer::RasterisationState{ 1.0f, 0, false, false, renderer::PolygonMode::eFill },
+			renderer::MultisampleState{},
+			renderer::ColourBlendState::createDefault(),
+			renderer::DepthStencilState{}
+		} );
+	}
+
+	void RenderPanel::doCreateMainDescriptorSet()
+	{
+		std::vector< renderer::DescriptorSetLayoutBinding > bindings
+		{
+			renderer::DescriptorSetLayoutBinding{ 0u, renderer::DescriptorType::eCombinedImageSampler, renderer::ShaderStageFlag::eFragment },
+		};
+		m_mainDescriptorLayout = m_device->createDescriptorSetLayout( std::move( bindings ) );
+		m_mainDescriptorPool = m_mainDescriptorLayout->createPool( 1u );
+		m_mainDescriptorSet = m_mainDescriptorPool->createDescriptorSet();
+		m_mainDescriptorSet->createBinding( m_mainDescriptorLayout->getBinding( 0u )
+			, *m_renderTargetColourView
+			, *m_sampler );
+		m_mainDescriptorSet->update();
+	}
+
+	void RenderPanel::doCreateMainRenderPass()
+	{
+		renderer::RenderPassAttachmentArray attaches
+		{
+			{
+				0u,
+				m_swapChain->getFormat(),
+				renderer::SampleCountFlag::e1,
+				renderer::AttachmentLoadOp::eClear,
+				renderer::AttachmentStoreOp::eStore,
+				renderer::AttachmentLoadOp::eDontCare,
+				renderer::AttachmentStoreOp::eDontCare,
+				renderer::ImageLayout::eUndefined,
+				renderer::ImageLayout::ePresentSrc,
+			}
+		};
+		renderer::RenderSubpassAttachmentArray subAttaches
+		{
+			{ 0u, renderer::ImageLayout::eColourAttachmentOptimal }
+		};
+		renderer::RenderSubpassPtrArray subpasses;
+		subpasses.emplace_back( m_device->createRenderSubpass( renderer::PipelineBindPoint::eGraphics
+			, renderer::RenderSubpassState{ renderer::PipelineStageFlag::eColourAttachmentOutput
+				, renderer::AccessFlag::eColourAttachmentWrite }
+			, subAttaches ) );
+		m_mainRenderPass = m_device->createRenderPass( attaches
+			, std::move( subpasses )
+			, renderer::RenderSubpassState{ renderer::PipelineStageFlag::eBottomOfPipe
+				, renderer::AccessFlag::eMemoryRead }
+			, renderer::RenderSubpassState{ renderer::PipelineStageFlag::eBottomOfPipe
+				, renderer::AccessFlag::eMemoryRead } );
+	}
+
+	void RenderPanel::doPrepareOffscreenFrame()
+	{
+		doUpdateProjection();
+		m_commandBuffer = m_device->getGraphicsCommandPool().createCommandBuffer();
+		m_queryPool = m_device->createQueryPool( renderer::QueryType::eTimestamp
+			, 2u
+			, 0u );
+		wxSize size{ GetClientSize() };
+		auto & commandBuffer = *m_commandBuffer;
+		auto & frameBuffer = *m_frameBuffer;
+		auto dimensions = m_swapChain->getDimensions();
+
+		if ( commandBuffer.begin( renderer::CommandBufferUsageFlag::eSimultaneousUse ) )
+		{
+			commandBuffer.resetQueryPool( *m_queryPool
+				, 0u
+				, 2u );
+			commandBuffer.writeTimestamp( renderer::PipelineStageFlag::eTopOfPipe
+				, *m_queryPool
+				, 0u );
+			m_culling->cull( commandBuffer
+				, ObjectCounts[std::min( m_step, uint32_t( ObjectCounts.size() - 1u ) )] );
+			commandBuffer.beginRenderPass( *m_offscreenRenderPass
+				, frameBuffer
+				, { renderer::ClearValue{ m_swapChain->getClearColour() }, renderer::ClearValue{ renderer::DepthStencilClearValue{ 1.0f, 0u } } }
+			, renderer::SubpassContents::eInline );
+			commandBuffer.bindPipeline( *m_offscreenPipeline );
+			commandBuffer.setViewport( { uint32_t( dimensions.x )
+				, uint32_t( dimensions.y )
+				, 0
+				, 0 } );
+			commandBuffer.setScissor( { 0
+				, 0
+				, uint32_t( dimensions.x )
+				, uint32_t( dimensions.y ) } );
+			commandBuffer.bindVertexBuffer( 0u
+				, m_offscreenVertexBuffer->getBuffer()
+				, 0u );
+			commandBuffer.bindIndexBuffer( m_offscreenIndexBuffer->getBuffer(), 0u, renderer::IndexType::eUInt16 );
+			commandBuffer.bindDescriptorSet( *m_offscreenDescriptorSet
+				, *m_offscreenPipelineLayout );
+			m_culling->draw( commandBuffer );
+			commandBuffer.endRenderPass();
+			commandBuffer.writeTimestamp( renderer::PipelineStageFlag::eBottomOfPipe
+				, *m_queryPool
+				, 1u );
+			auto res = commandBuffer.end();
+
+			if ( !res )
+			{
+				std::stringstream stream;
+				stream << "Command buffers recording failed.";
+				throw std::runtime_error{ stream.str() };
+			}
+		}
+	}
+
+	void RenderPanel::doCreateMainVertexBuffer()
+	{
+		m_mainVertexLayout = renderer::makeLayout< TexturedVertexData >( 0 );
+		m_mainVertexLayout->createAttribute< renderer::Vec4 >( 0u
+			, uint32_t( offsetof( TexturedVertexData, position ) ) );
+		m_mainVertexLayout->createAttribute< renderer::Vec2 >( 1u
+			, uint32_t( offsetof( TexturedVertexData, uv ) ) );
+
+		m_mainVertexBuffer = renderer::makeVertexBuffer< TexturedVertexData >( *m_device
+			, uint32_t( m_mainVertexData.size() )
+			, renderer::BufferTarget::eTransferDst
+			, renderer::MemoryPropertyFlag::eDeviceLocal );
+		m_stagingBuffer->uploadVertexData( m_swapChain->getDefaultResources().getCommandBuffer()
+			, m_mainVertexData
+			, *m_mainVertexBuffer
+			, renderer::PipelineStageFlag::eVertexInput );
+	}
+
+	void RenderPanel::doCreateMainPipeline()
+	{
+		m_mainPipelineLayout = m_device->createPipelineLayout( *m_mainDescriptorLayout );
+		wxSize size{ GetClientSize() };
+		std::string shadersFolder = common::getPath( common::getExecutableDirectory() ) / "share" / AppName / "Shaders";
+
+		if ( !wxFileExists( shadersFolder / "main.vert" )
+			|| !wxFileExists( shadersFolder / "main.frag" ) )
+		{
+			throw std::runtime_error{ "Shader files are missing" };
+		}
+
+		std::vector< renderer::ShaderStageState > shaderStages;
+		shaderStages.emplace_back( m_device->createShaderModule( renderer::ShaderStageFlag::eVertex ) );
+		shaderStages.emplace_back( m_device->createShaderModule( renderer::ShaderStageFlag::eFragment ) );
+		shaderStages[0].getModule().loadShader( common::parseShaderFile( *m_device, shadersFolder / "main.vert" ) );
+		shaderStages[1].getModule().loadShader( common::parseShaderFile( *m_device, shadersFolder / "main.frag" ) );
+
+		m_mainPipeline = m_mainPipelineLayout->createPipeline( renderer::GraphicsPipelineCreateInfo
+		{
+			std::move( shaderStages ),
+			*m_mainRenderPass,
+			renderer::VertexInputState::create( *m_mainVertexLayout ),
+			renderer::InputAssemblyState{ renderer::PrimitiveTopology::eTriangleStrip },
+			renderer::RasterisationState{ 1.0f }
+		} );
+	}
+
+	void RenderPanel::doPrepareMainFrames()
+	{
+		m_frameBuffers = m_swapChain->createFrameBuffers( *m_mainRenderPass );
+		m_commandBuffers = m_swapChain->createCommandBuffers();
+
+		for ( size_t i = 0u; i < m_frameBuffers.size(); ++i )
+		{
+			auto & frameBuffer = *m_frameBuffers[i];
+			auto & commandBuffer = *m_commandBuffers[i];
+
+			wxSize size{ GetClientSize() };
+
+			if ( commandBuffer.begin( renderer::CommandBufferUsageFlag::eSimultaneousUse ) )
+			{
+				auto dimensions = m_swapChain->getDimensions();
+				commandBuffer.beginRenderPass( *m_mainRenderPass
+					, frameBuffer
+					, { renderer::ClearValue{ { 1.0, 0.0, 0.0, 1.0 } } }
+					, renderer::SubpassContents::eInline );
+				commandBuffer.bindPipeline( *m_mainPipeline );
+				commandBuffer.setViewport( { uint32_t( dimensions.x )
+					, uint32_t( dimensions.y )
+					, 0
+					, 0 } );
+				commandBuffer.setScissor( { 0
+					, 0
+					, uint32_t( dimensions.x )
+					, uint32_t( dimensions.y ) } );
+				commandBuffer.bindVertexBuffer( 0u, m_mainVertexBuffer->getBuffer(), 0u );
+				commandBuffer.bindDescriptorSet( *m_mainDescriptorSet
+					, *m_mainPipelineLayout );
+				commandBuffer.draw( 4u );
+				commandBuffer.endRenderPass();
+
+				auto res = commandBuffer.end();
+
+				if ( !res )
+				{
+					std::stringstream stream;
+					stream << "Command buffers recording failed.";
+					throw std::runtime_error{ stream.str() };
+				}
+			}
+		}
+	}
+
+	void RenderPanel::doUpdate()
+	{
+		m_frameStart = std::chrono::high_resolution_clock::now();
+		m_camera.update();
+		m_matrixUbo->getData( 0u ) = m_projection * m_camera.getView();
+		m_stagingBuffer->uploadUniformData( *m_updateCommandBuffer
+			, m_matrixUbo->getDatas()
+			, *m_matrixUbo
+			, renderer::PipelineStageFlag::eVertexShader );
+		m_culling->update( *m_updateCommandBuffer
+			, m_matrixUbo->getData( 0u )
+			, ObjectCounts[std::min( m_step, uint32_t( ObjectCounts.size() - 1u ) )] );
+	}
+
+	void RenderPanel::doDraw()
+	{
+		auto resources = m_swapChain->getResources();
+
+		if ( resources )
+		{
+			auto & queue = m_device->getGraphicsQueue();
+			auto res = queue.submit( *m_commandBuffer
+				, nullptr );
+			// The frame's CPU cost: uniforms update and submission, without the GPU wait.
+			auto after = std::chrono::high_resolution_clock::now();
+
+			if ( res )
+			{
+				renderer::UInt32Array values{ 0u, 0u };
+				m_queryPool->getResults( 0u
+					, 2u
+					, 0u
+					, renderer::QueryResultFlag::eWait
+					, values );
+
+				auto res = queue.submit( *m_commandBuffers[resources->getBackBuffer()]
+					, resources->getImageAvailableSemaphore()
+					, renderer::PipelineStageFlag::eColourAttachmentOutput
+					, resources->getRenderingFinishedSemaphore()
+					, &resources->getFence() );
+				m_swapChain->present( *resources );
+
+				// Elapsed time in nanoseconds
+				auto elapsed = std::chrono::nanoseconds{ uint64_t( ( values[1] - values[0] ) / float( m_device->getTimestampPeriod() ) ) };
+				auto gpu = std::chrono::duration_cast< std::chrono::microseconds >( elapsed );
+				auto cpu = std::chrono::duration_cast< std::chrono::microseconds >( after - m_frameStart );
+				wxGetApp().updateFps( gpu, cpu );
+				doUpdateBenchmark( gpu, cpu );
+			}
+		}
+		else
+		{
+			m_timer->Stop();
+		}
+	}
+
+	void RenderPanel::doResetSwapChain()
+	{
+		m_device->waitIdle();
+		wxSize size{ GetClientSize() };
+		m_swapChain->reset( { size.GetWidth(), size.GetHeight() } );
+	}
+
+	void RenderPanel::doUpdateBenchmark( std::chrono::microseconds const & gpu
+		, std::chrono::microseconds const & cpu )
+	{
+		if ( m_step >= ObjectCounts.size() )
+		{
+			return;
+		}
+
+		m_gpuTime += gpu;
+		m_cpuTime += cpu;
+
+		if ( ++m_frameCount == FramesPerStep )
+		{
+			auto objectCount = ObjectCounts[m_step];
+			auto before = std::chrono::high_resolution_clock::now();
+			auto visible = countVisible( m_offscreenBounds
+				, objectCount
+				, m_matrixUbo->getData( 0u ) );
+			auto cpuCulling = std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::high_resolution_clock::now() - before );
+			std::cout << "Objects: " << std::setw( 7 ) << objectCount
+				<< ", visible: " << std::setw( 7 ) << visible
+				<< ", CPU frame: " << std::setw( 6 ) << ( m_cpuTime / FramesPerStep ).count() << " us"
+				<< ", GPU frame: " << std::setw( 6 ) << ( m_gpuTime / FramesPerStep ).count() << " us"
+				<< ", CPU culling (reference): " << std::setw( 6 ) << cpuCulling.count() << " us" << std::endl;
+			m_gpuTime = std::chrono::microseconds{ 0 };
+			m_cpuTime = std::chrono::microseconds{ 0 };
+			m_frameCount = 0u;
+			++m_step;
+
+			if ( m_step < ObjectCounts.size() )
+			{
+				m_device->waitIdle();
+				doPrepareOffscreenFrame();
+			}
+			else
+			{
+				std::cout << "Benchmark done." << std::endl;
+			}
+		}
+	}
+
+	void RenderPanel::onTimer( wxTimerEvent & event )
+	{
+		if ( event.GetId() == int( Ids::RenderTimer ) )
+		{
+			doUpdate();
+			doDraw();
+		}
+	}
+
+	void RenderPanel::onSize( wxSizeEvent & event )
+	{
+		m_timer->Stop();
+		doResetSwapChain();
+		m_timer->Start( TimerTimeMs );
+		event.Skip();
+	}
+
+	void RenderPanel::onMouseLDoubleClick( wxMouseEvent & event )
+	{
+		m_moveCamera = false;
+		m_camera.reset();
+	}
+
+	void RenderPanel::onMouseLDown( wxMouseEvent & event )
+	{
+		m_moveCamera = true;
+		m_previousMousePosition[0] = event.GetPosition().x;
+		m_previousMousePosition[1] = event.GetPosition().y;
+	}
+
+	void RenderPanel::onMouseLUp( wxMouseEvent & event )
+	{
+		m_moveCamera = false;
+	}
+
+	void RenderPanel::onMouseMove( wxMouseEvent & event )
+	{
+		if ( m_moveCamera )
+		{
+			auto size = GetClientSize();
+			auto currentPosition = renderer::IVec2{ event.GetPosition().x, event.GetPosition().y };
+			auto delta = currentPosition - m_previousMousePosition;
+			auto & result = m_camera.getRotation();
+			result = utils::pitch( result, renderer::Radians{ float( delta[1] ) / size.GetHeight() } );
+			result = utils::yaw( result, renderer::Radians{ float( -delta[0] ) / size.GetWidth() } );
+			m_previousMousePosition[0] = event.GetPosition().x;
+			m_previousMousePosition[1] = event.GetPosition().y;
+		}
+	}
+}
@@ -0,0 +1,165 @@
+﻿#pragma once
+
+#include "Prerequisites.hpp"
+
+#include "GpuCulling.hpp"
+
+#include <Core/Connection.hpp>
+#include <Core/Device.hpp>
+#include <Pipeline/Pipeline.hpp>
+#include <Pipeline/PipelineLayout.hpp>
+#include <Image/Sampler.hpp>
+#include <Core/SwapChain.hpp>
+
+#include <Utils/UtilsSignal.hpp>
+
+#include <Camera.hpp>
+
+#include <wx/panel.h>
+
+#include <array>
+#include <chrono>
+
+namespace vkapp
+{
+	class RenderPanel
+		: public wxPanel
+	{
+	public:
+		RenderPanel( wxWindow * parent
+			, wxSize const & size
+			, renderer::Renderer const & renderer );
+		~RenderPanel();
+
+	private:
+		/**
+		*\name
+		*	Initialisation.
+		*/
+		/**@{*/
+		void doCleanup();
+		void doUpdateProjection();
+		void doCreateDevice( renderer::Renderer const & renderer );
+		void doCreateSwapChain();
+		void doCreateTexture();
+		void doCreateUniformBuffer();
+		void doCreateStagingBuffer();
+		void doCreateOffscreenDescriptorSet();
+		void doCreateOffscreenRenderPass();
+		void doCreateFrameBuffer();
+		void doCreateOffscreenVertexBuffer();
+		void doCreateOffscreenPipeline();
+		void doPrepareOffscreenFrame();
+		void doCreateMainDescriptorSet();
+		void doCreateMainRenderPass();
+		void doCreateMainVertexBuffer();
+		void doCreateMainPipeline();
+		void doPrepareMainFrames();
+		/**@}*/
+		/**
+		*\name
+		*	Rendering.
+		*/
+		/**@{*/
+		void doUpdate();
+		void doDraw();
+		void doResetSwapChain();
+		void doUpdateBenchmark( std::chrono::microseconds const & gpu
+			, std::chrono::microseconds const & cpu );
+		/**@}*/
+		/**
+		*\name
+		*	Events.
+		*/
+		/**@{*/
+		void onTimer( wxTimerEvent & event );
+		void onSize( wxSizeEvent & event );
+		void onMouseLDoubleClick( wxMouseEvent & event );
+		void onMouseLDown( wxMouseEvent & event );
+		void onMouseLUp( wxMouseEvent & event );
+		void onMouseMove( wxMouseEvent & event );
+		/**@}*/
+
+	private:
+		wxTimer * m_timer{ nullptr };
+		bool m_moveCamera{ false };
+		renderer::IVec2 m_previousMousePosition;
+		renderer::Mat4 m_projection;
+		Camera m_camera;
+		/**
+		*\name
+		*	Global.
+		*/
+		/**@{*/
+		renderer::DevicePtr m_device;
+		renderer::SwapChainPtr m_swapChain;
+		renderer::StagingBufferPtr m_stagingBuffer;
+		renderer::TexturePtr m_texture;
+		renderer::TextureViewPtr m_view;
+		renderer::SamplerPtr m_sampler;
+		renderer::TexturePtr m_renderTargetColour;
+		renderer::TextureViewPtr m_renderTargetColourView;
+		renderer::TexturePtr m_renderTargetDepth;
+		renderer::TextureViewPtr m_renderTargetDepthView;
+		renderer::FrameBufferPtr m_frameBuffer;
+		renderer::UniformBufferPtr< renderer::Mat4 > m_matrixUbo;
+		renderer::CommandBufferPtr m_updateCommandBuffer;
+		/**@}*/
+		/**
+		*\name
+		*	Offscreen.
+		*/
+		/**@{*/
+		renderer::CommandBufferPtr m_commandBuffer;
+		renderer::RenderPassPtr m_offscreenRenderPass;
+		renderer::PipelineLayoutPtr m_offscreenPipelineLayout;
+		renderer::PipelinePtr m_offscreenPipeline;
+		renderer::VertexBufferPtr< TexturedVertexData > m_offscreenVertexBuffer;
+		renderer::BufferPtr< uint16_t > m_offscreenIndexBuffer;
+		renderer::VertexLayoutPtr m_offscreenVertexLayout;
+		std::vector< renderer::Vec4 > m_offscreenBounds;
+		std::unique_ptr< GpuCulling > m_culling;
+		renderer::DescriptorSetLayoutPtr m_offscreenDescriptorLayout;
+		renderer::DescriptorSetPoolPtr m_offscreenDescriptorPool;
+		renderer::DescriptorSetPtr m_offscreenDescriptorSet;
+		std::vector< TexturedVertexData > m_offscreenVertexData;
+		renderer::UInt16Array m_offscreenIndexData;
+		renderer::QueryPoolPtr m_queryPool;
+		/**@}*/
+		/**
+		*\name
+		*	Main.
+		*/
+		/**@{*/
+		renderer::RenderPassPtr m_mainRenderPass;
+		renderer::PipelineLayoutPtr m_mainPipelineLayout;
+		renderer::PipelinePtr m_mainPipeline;
+		renderer::VertexBufferPtr< TexturedVertexData > m_mainVertexBuffer;
+		renderer::VertexLayoutPtr m_mainVertexLayout;
+		renderer::DescriptorSetLayoutPtr m_mainDescriptorLayout;
+		renderer::DescriptorSetPoolPtr m_mainDescriptorPool;
+		renderer::DescriptorSetPtr m_mainDescriptorSet;
+		std::vector< TexturedVertexData > m_mainVertexData;
+		/**@}*/
+		/**
+		*\name
+		*	Swapchain.
+		*/
+		/**@{*/
+		std::vector< renderer::FrameBufferPtr > m_frameBuffers;
+		std::vector< renderer::CommandBufferPtr > m_commandBuffers;
+		renderer::SignalConnection< renderer::SwapChain::OnReset > m_swapChainReset;
+		/**@}*/
+		/**
+		*\name
+		*	Benchmark.
+		*/
+		/**@{*/
+		std::chrono::high_resolution_clock::time_point m_frameStart;
+		std::chrono::microseconds m_gpuTime{ 0 };
+		std::chrono::microseconds m_cpuTime{ 0 };
+		uint32_t m_frameCount{ 0u };
+		uint32_t m_step{ 0u };
+		/**@}*/
+	};
+}
@@ -0,0 +1,53 @@
+# Runs the benchmark scenarios, without any window, against each given renderer,
+# and gathers their results into ${OUTPUT_DIR}/Benchmark.json.
+#
+# Expected variables:
+#	BINARY_DIR: the folder holding the test applications.
+#	OUTPUT_DIR: the folder receiving the JSON files.
+#	SCENARIOS: the test applications names, comma separated (10-SpinningCube,...).
+#	RENDERERS: the renderers names, comma separated (vk,gl,null).
+#	FRAMES: the recorded frames count, per scenario.
+#	EXECUTABLE_SUFFIX: the platform's executable suffix.
+
+string( REPLACE "," ";" SCENARIOS "${SCENARIOS}" )
+string( REPLACE "," ";" RENDERERS "${RENDERERS}" )
+file( MAKE_DIRECTORY ${OUTPUT_DIR} )
+set( RESULT_FILE ${OUTPUT_DIR}/Benchmark.json )
+file( WRITE ${RESULT_FILE} "[\n" )
+set( SEPARATOR "" )
+set( FAILURES 0 )
+
+foreach( RENDERER ${RENDERERS} )
+	foreach( SCENARIO ${SCENARIOS} )
+		set( SCENARIO_FILE ${OUTPUT_DIR}/${SCENARIO}-${RENDERER}.json )
+		file( REMOVE ${SCENARIO_FILE} )
+		message( STATUS "Benchmarking ${SCENARIO} (${RENDERER}), ${FRAMES} frames" )
+		execute_process(
+			COMMAND ${BINARY_DIR}/Test-${SCENARIO}${EXECUTABLE_SUFFIX}
+				-${RENDERER}
+				--bench ${FRAMES}
+				--bench-output ${SCENARIO_FILE}
+			WORKING_DIRECTORY ${BINARY_DIR}
+			RESULT_VARIABLE RESULT
+		)
+
+		if ( NOT RESULT EQUAL 0 )
+			message( WARNING "${SCENARIO} (${RENDERER}) failed (${RESULT})" )
+			math( EXPR FAILURES "${FAILURES} + 1" )
+		elseif ( EXISTS ${SCENARIO_FILE} )
+			file( READ ${SCENARIO_FILE} CONTENT )
+			file( APPEND ${RESULT_FILE} "${SEPARATOR}${CONTENT}" )
+			set( SEPARATOR "," )
+		else ()
+			message( WARNING "${SCENARIO} (${RENDERER}) produced no result" )
+			math( EXPR FAILURES "${FAILURES} + 1" )
+		endif ()
+	endforeach()
+endforeach()
+
+file( APPEND ${RESULT_FILE} "]\n" )
+message( STATUS "Benchmark results written to ${RESULT_FILE}" )
+
+if ( FAILURES GREATER 0 )
+	message( FATAL_ERROR "${FAILURES} benchmark run(s) failed" )
+endif ()
@@ -18,11 +18,13 @@ for i, folder in ipairs( folders ) do
 				path.join( sourceDir, "Core" ),
 				path.join( sourceDir, "Renderer", "Renderer", "Src" ),
 				path.join( binaryDir, "Renderer", "Renderer", "Src" ),
+				path.join( sourceDir, "Renderer", "CaptureRenderer", "Src" ),
 				path.join( currentBinaryDir, "Src" ),
 				path.join( currentSourceDir, "Src" )
 			}
 			links{
 				"Utils",
+				"CaptureRenderer",
 				"Renderer"
 			}
 			postbuildcommands {
@@ -35,14 +37,16 @@ for i, folder in ipairs( folders ) do
 				path.join( sourceDir, "Core" ),
 				path.join( sourceDir, "Renderer", "Renderer", "Src" ),
 				path.join( binaryDir, "Renderer", "Renderer", "Src" ),
+				path.join( sourceDir, "Renderer", "CaptureRenderer", "Src" ),
 				path.join( sourceDir, "Test", "00-Common", "Src" ),
 				path.join( currentBinaryDir, "Src" ),
 				path.join( currentSourceDir, "Src" )
 			}
 			links{
 				"Utils",
-				"Renderer",
-				"Test-00-Common"
+				"Test-00-Common",
+				"CaptureRenderer",
+				"Renderer"
 			}
 			shadersFolder = path.join( sourceDir, "Test", folder, "Shaders" )
 			if ( os.isdir( shadersFolder ) ) then